@@ -0,0 +1,112 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#ifndef CDSLIB_ALGO_PREFETCH_H
+#define CDSLIB_ALGO_PREFETCH_H
+
+#include <iterator>   // std::iterator_traits
+#include <cds/details/defs.h>
+
+namespace cds { namespace algo {
+
+    /// Default prefetch distance for batched lookups, see \p prefetch_pipeline()
+    static CDS_CONSTEXPR const size_t c_nPrefetchDistance = 8;
+
+    /// Empty pipeline stage for \p prefetch_pipeline()
+    struct empty_prefetch_stage {
+        //@cond
+        template <typename State>
+        void operator()( State& ) const
+        {}
+        //@endcond
+    };
+
+    /// Software prefetch pipelining for batched lookups
+    /**
+        Searching a lot of keys one by one in a large hash table is bound by memory latency:
+        each lookup misses the cache on the bucket and on the first node.
+        The pipeline issues prefetches for the keys that will be searched later,
+        so the memory accesses for up to \p Distance keys are in flight while the current key is being resolved.
+
+        Each key passes three stages:
+        - \p stage1( key ) - computes the hash, prefetches the first memory location (for example, the bucket)
+            and returns a state of type \p State that is passed to next stages;
+        - \p stage2( State& ) - is called when the key is \p Distance / 2 steps ahead of resolving;
+            it can read the location prefetched by \p stage1 and prefetch the next one (for example, the first node);
+        - \p resolve( key, State& ) - performs the lookup and returns \p true if the key is found.
+
+        \p State must be default-constructible and copy-assignable. \p Iterator must be a forward iterator,
+        the keys are not copied, the pipeline holds up to \p Distance iterators.
+
+        The function returns the number of keys found.
+    */
+    template <size_t Distance, typename State, typename Iterator, typename Stage1, typename Stage2, typename Resolve>
+    static inline size_t prefetch_pipeline( Iterator itFirst, Iterator itLast, Stage1 stage1, Stage2 stage2, Resolve resolve )
+    {
+        static_assert( Distance > 1, "Prefetch distance must be greater than 1" );
+
+        Iterator keys[Distance];
+        State    states[Distance];
+        size_t   nFound = 0;
+        size_t   nCount = 0;
+
+        // Fill the pipeline
+        Iterator it = itFirst;
+        for ( ; nCount < Distance && it != itLast; ++nCount, ++it ) {
+            keys[nCount] = it;
+            states[nCount] = stage1( *it );
+        }
+        for ( size_t i = 0; i < nCount && i < Distance / 2; ++i )
+            stage2( states[i] );
+
+        size_t nHead = 0;
+        while ( nCount ) {
+            if ( nCount > Distance / 2 )
+                stage2( states[( nHead + Distance / 2 ) % Distance] );
+
+            if ( resolve( *keys[nHead], states[nHead] ))
+                ++nFound;
+
+            if ( it != itLast ) {
+                keys[nHead] = it;
+                states[nHead] = stage1( *it );
+                ++it;
+            }
+            else
+                --nCount;
+
+            nHead = ( nHead + 1 ) % Distance;
+        }
+        return nFound;
+    }
+
+}} // namespace cds::algo
+
+#endif // #ifndef CDSLIB_ALGO_PREFETCH_H
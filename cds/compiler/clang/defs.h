@@ -121,6 +121,9 @@
 #define CDS_CLASS_ALIGNMENT(n)  __attribute__ ((aligned (n)))
 #define CDS_DATA_ALIGNMENT(n)   __attribute__ ((aligned (n)))
 
+// Prefetch
+#define CDS_PREFETCH( p )       __builtin_prefetch( (p) )
+
 
 #include <cds/compiler/gcc/compiler_barriers.h>
 
@@ -65,6 +65,11 @@
 #   define CDS_EXPORT_API
 #endif
 
+// Prefetch is a hint, it may be unsupported by the compiler or the processor
+#ifndef CDS_PREFETCH
+#   define CDS_PREFETCH( p )    ((void) 0)
+#endif
+
 // Features
 #include <cds/compiler/feature_tsan.h>
 
@@ -84,6 +84,9 @@
 #define CDS_CLASS_ALIGNMENT(n)  __attribute__ ((aligned (n)))
 #define CDS_DATA_ALIGNMENT(n)   __attribute__ ((aligned (n)))
 
+// Prefetch
+#define CDS_PREFETCH( p )       __builtin_prefetch( (p) )
+
 // Attributes
 #if CDS_COMPILER_VERSION >= 40900
 #   if __cplusplus < 201103
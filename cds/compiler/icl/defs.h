@@ -130,6 +130,14 @@
 #   define CDS_DATA_ALIGNMENT(n)   __attribute__ ((aligned (n)))
 #endif
 
+// Prefetch
+#if CDS_OS_INTERFACE == CDS_OSI_WINDOWS
+#   include <xmmintrin.h>
+#   define CDS_PREFETCH( p )    _mm_prefetch( reinterpret_cast<char const *>( p ), _MM_HINT_T0 )
+#else
+#   define CDS_PREFETCH( p )    __builtin_prefetch( (p) )
+#endif
+
 // Attributes
 #if CDS_OS_INTERFACE == CDS_OSI_WINDOWS
 #   define CDS_DEPRECATED( reason ) __declspec(deprecated( reason ))
@@ -152,6 +152,12 @@
 #define CDS_DATA_ALIGNMENT(n)     __declspec( align(n) )
 #define CDS_CLASS_ALIGNMENT(n)    __declspec( align(n) )
 
+// Prefetch
+#if defined(_M_IX86) || defined(_M_X64)
+#   include <xmmintrin.h>
+#   define CDS_PREFETCH( p )    _mm_prefetch( reinterpret_cast<char const *>( p ), _MM_HINT_T0 )
+#endif
+
 // Attributes
 #if CDS_COMPILER_VERSION >= CDS_COMPILER_MSVC14
 #   define CDS_DEPRECATED( reason ) [[deprecated( reason )]]
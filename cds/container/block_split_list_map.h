@@ -0,0 +1,1153 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#ifndef CDSLIB_CONTAINER_BLOCK_SPLIT_LIST_MAP_H
+#define CDSLIB_CONTAINER_BLOCK_SPLIT_LIST_MAP_H
+
+#include <new>          // placement new
+#include <algorithm>    // std::copy
+#include <cds/container/details/block_split_list_base.h>
+#include <cds/details/allocator.h>
+#include <cds/details/marked_ptr.h>
+
+namespace cds { namespace container {
+
+    /// Split-ordered map with sorted blocks
+    /** @ingroup cds_nonintrusive_map
+        \anchor cds_nonintrusive_BlockSplitListMap
+
+        The map is a variant of \ref cds_nonintrusive_SplitListMap_hp "SplitListMap" [2003 Ori Shalev, Nir Shavit "Split-Ordered Lists - Lock-free Resizable Hash Tables"].
+        As in \p SplitListMap, all items are kept in one list ordered by bit-reversed hash value,
+        and the bucket table points to the head (dummy) nodes of the buckets. When the table grows,
+        a new bucket head is linked into the list, and no item is moved.
+
+        \p SplitListMap allocates one list node per item, so a bucket lookup chases a pointer per item.
+        Here a list node holds a small sorted block of (reversed hash, item pointer) pairs
+        together with the link to the next node. A lookup finds the node covering the hash value
+        and scans the hashes of its block sequentially. It dereferences an item only when the hash matches.
+
+        A block is immutable. Every change of a node copies its block and publishes the copy
+        by a CAS on the node's block pointer. The link to the next node is a part of the block,
+        so the items of a node and its successor are changed atomically:
+        - an item is inserted or erased by replacing the block of its node;
+        - a full block (\p Traits::block_capacity items) is split: the upper half is moved to a new node,
+          and the block of the old node is replaced by the lower half linked to the new node;
+        - a new bucket head node is linked in the same way, by splitting the block it falls into;
+        - an erasure that leaves a node empty, or small enough to fit into its predecessor,
+          freezes the node by marking its block pointer. Any thread that meets a frozen node
+          merges it into the predecessor by replacing the predecessor's block.
+          The frozen node and the old blocks are retired via \p GC.
+
+        All operations are lock-free. The items are allocated separately and never moved,
+        so \p get() and \p extract() return a guarded pointer, as \p SplitListMap does.
+        The bucket heads are never removed, the bucket table does not shrink.
+        The map has no iterators.
+
+        Template arguments:
+        - \p GC - garbage collector used: \p gc::HP or \p gc::DHP. RCU is not supported.
+        - \p Key - key type of an item stored in the map. It should be copy-constructible
+        - \p T - value type stored in the map
+        - \p Traits - map traits, default is \p block_split_list::traits.
+            It is possible to declare option-based map with \p cds::container::block_split_list::make_traits metafunction
+            instead of \p Traits template argument. \p opt::hash option is mandatory.
+
+        The load factor passed to the constructor is the average count of items per bucket.
+        Since a bucket is scanned sequentially, the load factor may be larger than for \p SplitListMap,
+        up to a half of \p Traits::block_capacity.
+
+        You should include the header of the \p GC and <tt><cds/container/block_split_list_map.h></tt>.
+    */
+    template <
+        class GC,
+        typename Key,
+        typename T,
+#ifdef CDS_DOXYGEN_INVOKED
+        class Traits = block_split_list::traits
+#else
+        class Traits
+#endif
+    >
+    class BlockSplitListMap
+    {
+    public:
+        typedef GC      gc;             ///< Garbage collector
+        typedef Key     key_type;       ///< Key type
+        typedef T       mapped_type;    ///< Mapped type
+        typedef Traits  traits;         ///< Map traits
+        typedef std::pair< key_type const, mapped_type > value_type; ///< Value type stored in the map
+
+#   ifdef CDS_DOXYGEN_INVOKED
+        typedef implementation_defined key_comparator;  ///< key comparison functor based on \p opt::compare and \p opt::less option setter.
+#   else
+        typedef typename opt::details::make_comparator< key_type, traits >::type key_comparator;
+#   endif
+        /// Hash functor for \p key_type and all its derivatives that you use
+        typedef typename cds::opt::v::hash_selector< typename traits::hash >::type hash;
+
+        typedef typename traits::item_counter   item_counter;   ///< Item counter type
+        typedef typename traits::memory_model   memory_model;   ///< Memory ordering. See cds::opt::memory_model option
+        typedef typename traits::back_off       back_off;       ///< Back-off strategy
+        typedef typename traits::allocator      allocator;      ///< Allocator for items, nodes, blocks and the bucket table
+        typedef typename traits::stat           stat;           ///< Internal statistics type
+
+        typedef typename gc::template guarded_ptr< value_type > guarded_ptr; ///< Guarded pointer
+
+        static CDS_CONSTEXPR const size_t c_nBlockCapacity = traits::block_capacity; ///< Count of items in a block after that the block is split
+        static CDS_CONSTEXPR const size_t c_nHazardPtrCount = 7; ///< Count of hazard pointers required
+
+        static_assert( c_nBlockCapacity >= 4, "block_capacity must be at least 4" );
+
+    protected:
+        //@cond
+        struct node;
+
+        struct entry {
+            size_t          nHash;  // bit-reversed hash value of the item
+            value_type *    pVal;
+        };
+
+        // The block is immutable after it has been published
+        struct block {
+            node *  m_pNext;    // next node of the split-ordered list
+            size_t  m_nSize;    // count of items
+            entry   m_arr[1];   // the items ordered by (nHash, key)
+
+            block( node * pNext, size_t nSize )
+                : m_pNext( pNext )
+                , m_nSize( nSize )
+            {}
+
+            entry const * begin() const
+            {
+                return m_arr;
+            }
+
+            entry const * end() const
+            {
+                return m_arr + m_nSize;
+            }
+
+            static size_t alloc_size( size_t nSize )
+            {
+                return sizeof( block ) + ( nSize > 0 ? nSize - 1 : 0 ) * sizeof( entry );
+            }
+        };
+
+        // The marked block pointer means that the node is frozen and should be merged into its predecessor
+        typedef cds::details::marked_ptr< block, 1 >    marked_block_ptr;
+        typedef atomics::atomic< marked_block_ptr >     atomic_block_ptr;
+
+        struct node {
+            size_t const        m_nHash;    // split-ordered key, the lower bound of the item hashes in the block
+            atomic_block_ptr    m_pBlock;
+
+            node( size_t nHash, block * pBlock )
+                : m_nHash( nHash )
+                , m_pBlock( marked_block_ptr( pBlock ))
+            {}
+
+            bool is_dummy() const
+            {
+                return ( m_nHash & 1 ) == 0;
+            }
+        };
+
+        typedef typename cds::intrusive::split_list::details::bucket_table_selector<
+            traits::dynamic_bucket_table
+            , gc
+            , node
+            , opt::allocator< allocator >
+            , opt::memory_model< memory_model >
+        >::type bucket_table;
+
+        typedef cds::details::Allocator< value_type, allocator >    cxx_value_allocator;
+        typedef cds::details::Allocator< node, allocator >          cxx_node_allocator;
+        typedef typename allocator::template rebind< char >::other  block_allocator;
+
+        enum {
+            guard_pred,         // predecessor of the current node
+            guard_pred_block,   // block of the predecessor
+            guard_cur,          // current node
+            guard_cur_block,    // block of the current node
+            guard_next,         // next node or the block being published
+            guard_item,         // item found
+            guard_count
+        };
+
+        struct position {
+            node *  pPred;      // nullptr if unknown
+            block * pPredBlock;
+            node *  pCur;
+            block * pCurBlock;  // not marked
+            typename gc::template GuardArray< guard_count > guards;
+        };
+
+        enum search_result {
+            search_not_found,
+            search_found,
+            search_retry    // the block has been changed while the item was being accessed
+        };
+        //@endcond
+
+    protected:
+        bucket_table            m_Buckets;          ///< Bucket table
+        atomics::atomic<size_t> m_nBucketCountLog2; ///< log2( current bucket count )
+        atomics::atomic<size_t> m_nMaxItemCount;    ///< Number of items the map can hold before the bucket table is grown
+        item_counter            m_ItemCounter;      ///< Item counter
+        hash                    m_HashFunctor;      ///< Hash functor
+        stat                    m_Stat;             ///< Internal statistics
+
+    public:
+        /// Initializes the map with default bucket table
+        BlockSplitListMap()
+            : m_nBucketCountLog2(1)
+            , m_nMaxItemCount( max_item_count(2, m_Buckets.load_factor()))
+        {
+            init();
+        }
+
+        /// Initializes the map
+        BlockSplitListMap(
+            size_t nItemCount           ///< estimate average item count
+            , size_t nLoadFactor = 1    ///< load factor - average item count per bucket, default is 1.
+            )
+            : m_Buckets( nItemCount, nLoadFactor )
+            , m_nBucketCountLog2(1)
+            , m_nMaxItemCount( max_item_count(2, m_Buckets.load_factor()))
+        {
+            init();
+        }
+
+        /// Destroys the map
+        ~BlockSplitListMap()
+        {
+            node * pNode = m_Buckets.bucket( 0 );
+            while ( pNode != nullptr ) {
+                block * pBlock = pNode->m_pBlock.load( atomics::memory_order_relaxed ).ptr();
+                node * pNext = pBlock->m_pNext;
+                for ( entry const * p = pBlock->begin(); p != pBlock->end(); ++p )
+                    free_value( p->pVal );
+                free_block( pBlock );
+                free_node( pNode );
+                pNode = pNext;
+            }
+        }
+
+    public:
+        /// Inserts new item with key and default value
+        /**
+            The function creates an item with \p key and default value, and then inserts the item into the map.
+
+            Preconditions:
+            - The \p key_type should be constructible from a value of type \p K.
+                In trivial case, \p K is equal to \p key_type.
+            - The \p mapped_type should be default-constructible.
+
+            Returns \p true if inserting successful, \p false otherwise.
+        */
+        template <typename K>
+        bool insert( K const& key )
+        {
+            return insert_( cxx_value_allocator().New( key, mapped_type()), []( value_type& ) {} );
+        }
+
+        /// Inserts new item
+        /**
+            The function creates an item with copy of \p val value
+            and then inserts the item into the map.
+
+            Preconditions:
+            - The \p key_type should be constructible from \p key of type \p K.
+            - The \p mapped_type should be constructible from \p val of type \p V.
+
+            Returns \p true if \p val is inserted into the map, \p false otherwise.
+        */
+        template <typename K, typename V>
+        bool insert( K const& key, V const& val )
+        {
+            return insert_( cxx_value_allocator().New( key, mapped_type( val )), []( value_type& ) {} );
+        }
+
+        /// Inserts new item and initializes it by a functor
+        /**
+            This function inserts new item with key \p key and if inserting is successful then it calls
+            \p func functor with signature
+            \code
+                struct functor {
+                    void operator()( value_type& item );
+                };
+            \endcode
+
+            The argument \p item of user-defined functor \p func is the reference
+            to the map's item inserted:
+                - <tt>item.first</tt> is a const reference to item's key that cannot be changed.
+                - <tt>item.second</tt> is a reference to item's value that may be changed.
+
+            The functor is called after the item has been linked into the map,
+            so the item may be concurrently found by other threads.
+            The user-defined functor is called only if inserting is successful.
+        */
+        template <typename K, typename Func>
+        bool insert_with( K const& key, Func func )
+        {
+            return insert_( cxx_value_allocator().New( key, mapped_type()), func );
+        }
+
+        /// For key \p key inserts data of type \p mapped_type created in-place from <tt>std::forward<Args>(args)...</tt>
+        /**
+            Returns \p true if inserting successful, \p false otherwise.
+        */
+        template <typename K, typename... Args>
+        bool emplace( K&& key, Args&&... args )
+        {
+            return insert_( cxx_value_allocator().MoveNew( std::forward<K>( key ), mapped_type( std::forward<Args>( args )... )),
+                []( value_type& ) {} );
+        }
+
+        /// Updates data by \p key
+        /**
+            If the \p key not found in the map, then the new item created from \p key
+            will be inserted into the map iff \p bAllowInsert is \p true
+            (note that in this case the \ref key_type should be constructible from type \p K).
+            Otherwise, if \p key is found, the functor \p func is called with item found.
+            The functor \p Func signature:
+            \code
+                struct my_functor {
+                    void operator()( bool bNew, value_type& item );
+                };
+            \endcode
+            where:
+            - \p bNew - \p true if the item has been inserted, \p false otherwise
+            - \p item - item of the map
+
+            The functor may change any fields of the \p item.second. The item is not locked,
+            so the functor should take care of concurrent access to \p item.second.
+
+            Returns <tt> std::pair<bool, bool> </tt> where \p first is \p true if operation is successful,
+            \p second is \p true if new item has been added or \p false if \p key already exists.
+        */
+        template <typename K, typename Func>
+        std::pair<bool, bool> update( K const& key, Func func, bool bAllowInsert = true )
+        {
+            return update_( key, func, bAllowInsert );
+        }
+
+        /// Deletes \p key from the map
+        /**
+            Returns \p true if \p key is found and deleted, \p false otherwise
+        */
+        template <typename K>
+        bool erase( K const& key )
+        {
+            return erase_( key, key_comparator(), []( value_type const& ) {} );
+        }
+
+        /// Deletes the item from the map using \p pred predicate for searching
+        /**
+            The function is an analog of \p erase(K const&)
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p Less must imply the same element order as the comparator used for building the map.
+        */
+        template <typename K, typename Less>
+        bool erase_with( K const& key, Less pred )
+        {
+            CDS_UNUSED( pred );
+            return erase_( key, cds::opt::details::make_comparator_from_less<Less>(), []( value_type const& ) {} );
+        }
+
+        /// Deletes \p key from the map
+        /**
+            The function searches an item with key \p key, calls \p f functor
+            and deletes the item. If \p key is not found, the functor is not called.
+
+            The functor \p Func interface:
+            \code
+            struct extractor {
+                void operator()(value_type& item) { ... }
+            };
+            \endcode
+
+            Returns \p true if key is found and deleted, \p false otherwise
+        */
+        template <typename K, typename Func>
+        bool erase( K const& key, Func f )
+        {
+            return erase_( key, key_comparator(), f );
+        }
+
+        /// Deletes the item from the map using \p pred predicate for searching
+        /**
+            The function is an analog of \p erase(K const&, Func)
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p Less must imply the same element order as the comparator used for building the map.
+        */
+        template <typename K, typename Less, typename Func>
+        bool erase_with( K const& key, Less pred, Func f )
+        {
+            CDS_UNUSED( pred );
+            return erase_( key, cds::opt::details::make_comparator_from_less<Less>(), f );
+        }
+
+        /// Extracts the item with specified \p key
+        /**
+            The function searches an item with key equal to \p key,
+            unlinks it from the map, and returns it as \p guarded_ptr.
+            If \p key is not found the function returns an empty guarded pointer.
+
+            The item extracted is freed by the garbage collector \p GC
+            when returned \p guarded_ptr object will be destroyed or released.
+            @note Each \p guarded_ptr object uses one GC's guard which can be limited resource.
+        */
+        template <typename K>
+        guarded_ptr extract( K const& key )
+        {
+            guarded_ptr gp;
+            extract_( gp.guard(), key, key_comparator());
+            return gp;
+        }
+
+        /// Extracts the item using compare functor \p pred
+        /**
+            The function is an analog of \p extract(K const&)
+            but \p pred predicate is used for key comparing.
+            \p Less functor has the semantics like \p std::less.
+            \p pred must imply the same element order as the comparator used for building the map.
+        */
+        template <typename K, typename Less>
+        guarded_ptr extract_with( K const& key, Less pred )
+        {
+            CDS_UNUSED( pred );
+            guarded_ptr gp;
+            extract_( gp.guard(), key, cds::opt::details::make_comparator_from_less<Less>());
+            return gp;
+        }
+
+        /// Finds the key \p key
+        /**
+            The function searches the item with key equal to \p key and calls the functor \p f for item found.
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( value_type& item );
+            };
+            \endcode
+            where \p item is the item found.
+
+            The functor may change \p item.second. Note that the functor is only guarantee
+            that \p item cannot be disposed during functor is executing.
+            The functor does not serialize simultaneous access to the map's \p item.
+
+            The function returns \p true if \p key is found, \p false otherwise.
+        */
+        template <typename K, typename Func>
+        bool find( K const& key, Func f )
+        {
+            return find_( key, key_comparator(), f );
+        }
+
+        /// Finds the key \p val using \p pred predicate for searching
+        /**
+            The function is an analog of \p find(K const&, Func)
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p Less must imply the same element order as the comparator used for building the map.
+        */
+        template <typename K, typename Less, typename Func>
+        bool find_with( K const& key, Less pred, Func f )
+        {
+            CDS_UNUSED( pred );
+            return find_( key, cds::opt::details::make_comparator_from_less<Less>(), f );
+        }
+
+        /// Checks whether the map contains \p key
+        template <typename K>
+        bool contains( K const& key )
+        {
+            return find_( key, key_comparator(), []( value_type& ) {} );
+        }
+
+        /// Checks whether the map contains \p key using \p pred predicate for searching
+        /**
+            The function is similar to <tt>contains( key )</tt> but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p Less must imply the same element order as the comparator used for building the map.
+        */
+        template <typename K, typename Less>
+        bool contains( K const& key, Less pred )
+        {
+            CDS_UNUSED( pred );
+            return find_( key, cds::opt::details::make_comparator_from_less<Less>(), []( value_type& ) {} );
+        }
+
+        /// Finds \p key and returns the item found
+        /**
+            The function searches the item with key equal to \p key
+            and returns the item found as a guarded pointer.
+            If \p key is not found the function returns an empty guarded pointer.
+
+            @note Each \p guarded_ptr object uses one GC's guard which can be limited resource.
+        */
+        template <typename K>
+        guarded_ptr get( K const& key )
+        {
+            guarded_ptr gp;
+            get_( gp.guard(), key, key_comparator());
+            return gp;
+        }
+
+        /// Finds \p key and returns the item found
+        /**
+            The function is an analog of \p get(K const&)
+            but \p pred is used for comparing the keys.
+            \p Less functor has the semantics like \p std::less.
+            \p pred must imply the same element order as the comparator used for building the map.
+        */
+        template <typename K, typename Less>
+        guarded_ptr get_with( K const& key, Less pred )
+        {
+            CDS_UNUSED( pred );
+            guarded_ptr gp;
+            get_( gp.guard(), key, cds::opt::details::make_comparator_from_less<Less>());
+            return gp;
+        }
+
+        /// Clears the map (not atomic)
+        /**
+            The function empties the blocks one by one, the items are retired via \p GC.
+            The items inserted concurrently may remain in the map.
+        */
+        void clear()
+        {
+            node * pHead = m_Buckets.bucket( 0 );
+            position pos;
+
+        try_again:
+            start_from( pHead, pos );
+            while ( true ) {
+                block * pOld = pos.pCurBlock;
+                if ( pOld->m_nSize > 0 ) {
+                    bool const bFreeze = !pos.pCur->is_dummy();
+                    block * pEmpty = alloc_block( pOld->m_pNext, 0 );
+
+                    // Keep the old block guarded while its items are being retired
+                    pos.guards.copy( guard_item, guard_cur_block );
+                    if ( !replace_block( pos, pEmpty, bFreeze )) {
+                        free_block( pEmpty );
+                        goto try_again;
+                    }
+                    for ( entry const * p = pOld->begin(); p != pOld->end(); ++p ) {
+                        --m_ItemCounter;
+                        gc::retire( p->pVal, free_value );
+                    }
+
+                    if ( bFreeze ) {
+                        m_Stat.onNodeFrozen();
+                        if ( pos.pPred == nullptr || !merge_frozen( pos, pEmpty ))
+                            goto try_again;
+                    }
+                }
+
+                node * pNext = pos.pCurBlock->m_pNext;
+                if ( pNext == nullptr )
+                    break;
+                pos.guards.assign( guard_next, pNext );
+                if ( pos.pCur->m_pBlock.load( memory_model::memory_order_acquire ) != marked_block_ptr( pos.pCurBlock )
+                    || !step( pos, pNext ))
+                {
+                    goto try_again;
+                }
+            }
+        }
+
+        /// Checks if the map is empty
+        /**
+            Emptiness is checked by item counting: if item count is zero then the map is empty.
+        */
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+        /// Returns item count in the map
+        size_t size() const
+        {
+            return m_ItemCounter;
+        }
+
+        /// Returns const reference to internal statistics
+        stat const& statistics() const
+        {
+            return m_Stat;
+        }
+
+    protected:
+        //@cond
+        static block * alloc_block( node * pNext, size_t nSize )
+        {
+            char * p = block_allocator().allocate( block::alloc_size( nSize ));
+            return new( p ) block( pNext, nSize );
+        }
+
+        static void free_block( block * p )
+        {
+            size_t const nAllocSize = block::alloc_size( p->m_nSize );
+            p->~block();
+            block_allocator().deallocate( reinterpret_cast<char *>( p ), nAllocSize );
+        }
+
+        // Copies [pSrc, pSrc + nCount) to new block
+        static block * make_block( node * pNext, entry const * pSrc, size_t nCount )
+        {
+            block * p = alloc_block( pNext, nCount );
+            std::copy( pSrc, pSrc + nCount, p->m_arr );
+            return p;
+        }
+
+        // Copies [pSrc, pSrc + nCount) to new block inserting e at position nIdx
+        static block * make_block( node * pNext, entry const * pSrc, size_t nCount, size_t nIdx, entry const& e )
+        {
+            assert( nIdx <= nCount );
+            block * p = alloc_block( pNext, nCount + 1 );
+            std::copy( pSrc, pSrc + nIdx, p->m_arr );
+            p->m_arr[nIdx] = e;
+            std::copy( pSrc + nIdx, pSrc + nCount, p->m_arr + nIdx + 1 );
+            return p;
+        }
+
+        static node * alloc_node( size_t nHash, block * pBlock )
+        {
+            return cxx_node_allocator().New( nHash, pBlock );
+        }
+
+        static void free_node( node * p )
+        {
+            cxx_node_allocator().Delete( p );
+        }
+
+        static void free_value( value_type * p )
+        {
+            cxx_value_allocator().Delete( p );
+        }
+
+        template <typename Q>
+        size_t hash_value( Q const& key ) const
+        {
+            return m_HashFunctor( key );
+        }
+
+        size_t bucket_no( size_t nHash ) const
+        {
+            return nHash & (( static_cast<size_t>(1) << m_nBucketCountLog2.load( memory_model::memory_order_relaxed )) - 1 );
+        }
+
+        static size_t parent_bucket( size_t nBucket )
+        {
+            assert( nBucket > 0 );
+            return nBucket & ~( static_cast<size_t>(1) << bitop::MSBnz( nBucket ));
+        }
+
+        void init()
+        {
+            // atomicity::empty_item_counter is not allowed as a item counter
+            static_assert( !std::is_same<item_counter, cds::atomicity::empty_item_counter>::value,
+                           "cds::atomicity::empty_item_counter is not allowed as a item counter");
+
+            m_Buckets.bucket( 0, alloc_node( 0 /*split_list::dummy_hash(0)*/, alloc_block( nullptr, 0 )));
+        }
+
+        static size_t max_item_count( size_t nBucketCount, size_t nLoadFactor )
+        {
+            return nBucketCount * nLoadFactor;
+        }
+
+        void inc_item_count()
+        {
+            size_t nMaxCount = m_nMaxItemCount.load( memory_model::memory_order_relaxed );
+            if ( ++m_ItemCounter <= nMaxCount )
+                return;
+
+            size_t sz = m_nBucketCountLog2.load( memory_model::memory_order_relaxed );
+            const size_t nBucketCount = static_cast<size_t>(1) << sz;
+            if ( nBucketCount < m_Buckets.capacity()) {
+                // we may grow the bucket table
+                const size_t nLoadFactor = m_Buckets.load_factor();
+                if ( nMaxCount < max_item_count( nBucketCount, nLoadFactor ))
+                    return; // someone already have updated m_nBucketCountLog2, so stop here
+
+                m_nMaxItemCount.compare_exchange_strong( nMaxCount, max_item_count( nBucketCount << 1, nLoadFactor ),
+                                                         memory_model::memory_order_relaxed, atomics::memory_order_relaxed );
+                m_nBucketCountLog2.compare_exchange_strong( sz, sz + 1, memory_model::memory_order_relaxed, atomics::memory_order_relaxed );
+            }
+            else
+                m_nMaxItemCount.store( std::numeric_limits<size_t>::max(), memory_model::memory_order_relaxed );
+        }
+
+        node * get_bucket( size_t nHash )
+        {
+            size_t nBucket = bucket_no( nHash );
+
+            node * pHead = m_Buckets.bucket( nBucket );
+            if ( pHead == nullptr )
+                pHead = init_bucket( nBucket );
+
+            assert( pHead->is_dummy());
+            return pHead;
+        }
+
+        node * init_bucket( size_t nBucket )
+        {
+            assert( nBucket > 0 );
+            size_t nParent = parent_bucket( nBucket );
+
+            node * pParentBucket = m_Buckets.bucket( nParent );
+            if ( pParentBucket == nullptr ) {
+                pParentBucket = init_bucket( nParent );
+                m_Stat.onRecursiveInitBucket();
+            }
+            assert( pParentBucket != nullptr );
+
+            size_t const nHash = cds::intrusive::split_list::dummy_hash( nBucket );
+            position pos;
+            back_off bkoff;
+            while ( true ) {
+                search( pParentBucket, nHash, pos );
+                if ( pos.pCur->m_nHash == nHash ) {
+                    // Another thread has linked the head node, it will set the bucket soon
+                    m_Stat.onBucketInitContenton();
+                    return pos.pCur;
+                }
+
+                // The head node takes the items greater than nHash from the block it falls into
+                block * pOld = pos.pCurBlock;
+                entry const * pSplit = pOld->begin();
+                while ( pSplit != pOld->end() && pSplit->nHash < nHash )
+                    ++pSplit;
+
+                node * pHead = alloc_node( nHash, make_block( pOld->m_pNext, pSplit, pOld->end() - pSplit ));
+                block * pLower = make_block( pHead, pOld->begin(), pSplit - pOld->begin());
+                if ( replace_block( pos, pLower )) {
+                    m_Buckets.bucket( nBucket, pHead );
+                    m_Stat.onNewBucket();
+                    return pHead;
+                }
+
+                free_block( pLower );
+                free_block( pHead->m_pBlock.load( atomics::memory_order_relaxed ).ptr());
+                free_node( pHead );
+                bkoff();
+            }
+        }
+
+        // Publishes pNew as the block of pos.pCur instead of pos.pCurBlock, pos.pCurBlock is retired
+        bool replace_block( position& pos, block * pNew, bool bFreeze = false )
+        {
+            // pNew may be retired by another thread just after publishing
+            pos.guards.assign( guard_next, pNew );
+
+            marked_block_ptr pExpected( pos.pCurBlock );
+            if ( pos.pCur->m_pBlock.compare_exchange_strong( pExpected, marked_block_ptr( pNew, bFreeze ? 1 : 0 ),
+                memory_model::memory_order_release, atomics::memory_order_relaxed ))
+            {
+                gc::retire( pos.pCurBlock, free_block );
+                pos.guards.copy( guard_cur_block, guard_next );
+                pos.pCurBlock = pNew;
+                return true;
+            }
+            return false;
+        }
+
+        // pos.pCur is frozen, its block is pFrozen. Merges pos.pCur into pos.pPred.
+        // On success pos.pCur is the predecessor with the merged block.
+        bool merge_frozen( position& pos, block * pFrozen )
+        {
+            assert( pos.pPred != nullptr );
+            block * pPredBlock = pos.pPredBlock;
+            assert( pPredBlock->m_pNext == pos.pCur );
+
+            block * pMerged = alloc_block( pFrozen->m_pNext, pPredBlock->m_nSize + pFrozen->m_nSize );
+            std::copy( pFrozen->begin(), pFrozen->end(),
+                std::copy( pPredBlock->begin(), pPredBlock->end(), pMerged->m_arr ));
+            pos.guards.assign( guard_next, pMerged );
+
+            marked_block_ptr pExpected( pPredBlock );
+            if ( pos.pPred->m_pBlock.compare_exchange_strong( pExpected, marked_block_ptr( pMerged ),
+                memory_model::memory_order_release, atomics::memory_order_relaxed ))
+            {
+                gc::retire( pPredBlock, free_block );
+                gc::retire( pFrozen, free_block );
+                gc::retire( pos.pCur, free_node );
+                m_Stat.onNodeMerged();
+
+                pos.guards.copy( guard_cur, guard_pred );
+                pos.guards.copy( guard_cur_block, guard_next );
+                pos.pCur = pos.pPred;
+                pos.pCurBlock = pMerged;
+                pos.pPred = nullptr;
+                pos.pPredBlock = nullptr;
+                return true;
+            }
+
+            free_block( pMerged );
+            m_Stat.onNodeMergeFailed();
+            return false;
+        }
+
+        void start_from( node * pHead, position& pos )
+        {
+            assert( pHead->is_dummy());
+            pos.pPred = nullptr;
+            pos.pPredBlock = nullptr;
+            pos.pCur = pHead;
+            // A bucket head is never frozen
+            pos.pCurBlock = pos.guards.protect( guard_cur_block, pHead->m_pBlock, []( marked_block_ptr p ) { return p.ptr(); }).ptr();
+        }
+
+        // Moves pos to pNext that is the successor of pos.pCur guarded by guard_next.
+        // A frozen node is merged into its predecessor, returns false if the merging is failed
+        bool step( position& pos, node * pNext )
+        {
+            pos.guards.copy( guard_pred, guard_cur );
+            pos.guards.copy( guard_pred_block, guard_cur_block );
+            pos.pPred = pos.pCur;
+            pos.pPredBlock = pos.pCurBlock;
+
+            pos.guards.copy( guard_cur, guard_next );
+            pos.pCur = pNext;
+            marked_block_ptr pBlock = pos.guards.protect( guard_cur_block, pNext->m_pBlock, []( marked_block_ptr p ) { return p.ptr(); });
+            pos.pCurBlock = pBlock.ptr();
+            if ( pBlock.bits())
+                return merge_frozen( pos, pBlock.ptr());
+            return true;
+        }
+
+        // Finds the node which block covers nHash: pos.pCur->m_nHash <= nHash < pos.pCurBlock->m_pNext->m_nHash
+        void search( node * pHead, size_t nHash, position& pos )
+        {
+        try_again:
+            start_from( pHead, pos );
+            while ( true ) {
+                node * pNext = pos.pCurBlock->m_pNext;
+                if ( pNext == nullptr )
+                    return;
+
+                pos.guards.assign( guard_next, pNext );
+                if ( pos.pCur->m_pBlock.load( memory_model::memory_order_acquire ) != marked_block_ptr( pos.pCurBlock )) {
+                    // The block of pos.pCur has been changed, pNext may be retired
+                    m_Stat.onSearchRetry();
+                    marked_block_ptr pBlock = pos.guards.protect( guard_cur_block, pos.pCur->m_pBlock, []( marked_block_ptr p ) { return p.ptr(); });
+                    if ( pBlock.bits())
+                        goto try_again;
+                    pos.pCurBlock = pBlock.ptr();
+                    continue;
+                }
+
+                if ( pNext->m_nHash > nHash )
+                    return;
+
+                if ( !step( pos, pNext )) {
+                    m_Stat.onSearchRetry();
+                    goto try_again;
+                }
+            }
+        }
+
+        // Searches the item with (nHash, key) in pos.pCurBlock.
+        // nIdx is the position of the item found or the insert position
+        template <typename Q, typename Compare>
+        search_result find_in_block( position& pos, size_t nHash, Q const& key, Compare cmp, size_t& nIdx )
+        {
+            block const * pBlock = pos.pCurBlock;
+            entry const * p = pBlock->begin();
+            entry const * pEnd = pBlock->end();
+
+            while ( p != pEnd && p->nHash < nHash )
+                ++p;
+
+            for ( ; p != pEnd && p->nHash == nHash; ++p ) {
+                // The item may be erased and retired since pBlock has been read
+                pos.guards.assign( guard_item, p->pVal );
+                if ( pos.pCur->m_pBlock.load( memory_model::memory_order_acquire ) != marked_block_ptr( pos.pCurBlock ))
+                    return search_retry;
+
+                int nCmp = cmp( p->pVal->first, key );
+                if ( nCmp == 0 ) {
+                    nIdx = p - pBlock->begin();
+                    return search_found;
+                }
+                if ( nCmp > 0 )
+                    break;
+            }
+            nIdx = p - pBlock->begin();
+            return search_not_found;
+        }
+
+        // Selects the split position of a full block. The items with equal hash are not separated.
+        // Returns 0 if the block cannot be split
+        static size_t split_point( block const * pBlock )
+        {
+            entry const * pArr = pBlock->m_arr;
+            size_t const nSize = pBlock->m_nSize;
+            size_t const nMid = nSize / 2;
+
+            for ( size_t nDist = 0; nDist < nSize; ++nDist ) {
+                size_t i = nMid + nDist;
+                if ( i < nSize && pArr[i].nHash != pArr[i - 1].nHash )
+                    return i;
+                if ( nDist > 0 && nDist < nMid ) {
+                    i = nMid - nDist;
+                    if ( pArr[i].nHash != pArr[i - 1].nHash )
+                        return i;
+                }
+            }
+            return 0;
+        }
+
+        // Inserts pVal into pos.pCurBlock at position nIdx, the full block is split
+        bool insert_at( position& pos, size_t nIdx, size_t nHash, value_type * pVal )
+        {
+            block * pOld = pos.pCurBlock;
+            size_t const nSize = pOld->m_nSize;
+            entry const e = { nHash, pVal };
+
+            // pVal may be erased by another thread just after publishing
+            pos.guards.assign( guard_item, pVal );
+
+            if ( nSize >= c_nBlockCapacity ) {
+                size_t const nSplit = split_point( pOld );
+                if ( nSplit != 0 ) {
+                    entry const * pArr = pOld->m_arr;
+                    size_t const nSplitHash = pArr[nSplit].nHash;
+                    node * pNew;
+                    block * pLower;
+                    if ( nIdx < nSplit || ( nIdx == nSplit && nHash < nSplitHash )) {
+                        pNew = alloc_node( nSplitHash, make_block( pOld->m_pNext, pArr + nSplit, nSize - nSplit ));
+                        pLower = make_block( pNew, pArr, nSplit, nIdx, e );
+                    }
+                    else {
+                        pNew = alloc_node( nSplitHash, make_block( pOld->m_pNext, pArr + nSplit, nSize - nSplit, nIdx - nSplit, e ));
+                        pLower = make_block( pNew, pArr, nSplit );
+                    }
+
+                    if ( replace_block( pos, pLower )) {
+                        m_Stat.onBlockSplit();
+                        return true;
+                    }
+
+                    free_block( pLower );
+                    free_block( pNew->m_pBlock.load( atomics::memory_order_relaxed ).ptr());
+                    free_node( pNew );
+                    return false;
+                }
+                // All items of the block have the same hash value
+            }
+
+            block * pNew = make_block( pOld->m_pNext, pOld->m_arr, nSize, nIdx, e );
+            if ( replace_block( pos, pNew ))
+                return true;
+            free_block( pNew );
+            return false;
+        }
+
+        // Erases the item at position nIdx of pos.pCurBlock
+        template <typename Func>
+        bool erase_at( position& pos, size_t nIdx, Func f )
+        {
+            block * pOld = pos.pCurBlock;
+            value_type * pVal = pOld->m_arr[nIdx].pVal;
+            size_t const nSize = pOld->m_nSize - 1;
+
+            block * pNew = alloc_block( pOld->m_pNext, nSize );
+            std::copy( pOld->begin() + nIdx + 1, pOld->end(),
+                std::copy( pOld->begin(), pOld->begin() + nIdx, pNew->m_arr ));
+
+            // The underfull node is frozen by the same CAS and then it is merged into its predecessor
+            bool const bFreeze = !pos.pCur->is_dummy()
+                && ( nSize == 0 || ( pos.pPred != nullptr && pos.pPredBlock->m_nSize + nSize <= c_nBlockCapacity / 2 ));
+            if ( !replace_block( pos, pNew, bFreeze )) {
+                free_block( pNew );
+                return false;
+            }
+
+            --m_ItemCounter;
+            f( *pVal );
+            gc::retire( pVal, free_value );
+
+            if ( bFreeze ) {
+                m_Stat.onNodeFrozen();
+                if ( pos.pPred != nullptr )
+                    merge_frozen( pos, pNew );
+            }
+            return true;
+        }
+
+        template <typename Func>
+        bool insert_( value_type * pVal, Func f )
+        {
+            size_t nHash = hash_value( pVal->first );
+            node * pHead = get_bucket( nHash );
+            nHash = cds::intrusive::split_list::regular_hash( nHash );
+
+            position pos;
+            back_off bkoff;
+            size_t nIdx;
+            while ( true ) {
+                search( pHead, nHash, pos );
+                search_result res = find_in_block( pos, nHash, pVal->first, key_comparator(), nIdx );
+                if ( res == search_found ) {
+                    free_value( pVal );
+                    m_Stat.onInsertFailed();
+                    return false;
+                }
+                if ( res == search_not_found ) {
+                    if ( insert_at( pos, nIdx, nHash, pVal ))
+                        break;
+                    m_Stat.onInsertRetry();
+                    bkoff();
+                }
+            }
+
+            f( *pVal );
+            inc_item_count();
+            m_Stat.onInsertSuccess();
+            return true;
+        }
+
+        template <typename K, typename Func>
+        std::pair<bool, bool> update_( K const& key, Func func, bool bAllowInsert )
+        {
+            size_t nHash = hash_value( key );
+            node * pHead = get_bucket( nHash );
+            nHash = cds::intrusive::split_list::regular_hash( nHash );
+
+            position pos;
+            back_off bkoff;
+            size_t nIdx;
+            value_type * pVal = nullptr;
+            while ( true ) {
+                search( pHead, nHash, pos );
+                search_result res = find_in_block( pos, nHash, key, key_comparator(), nIdx );
+                if ( res == search_found ) {
+                    if ( pVal )
+                        free_value( pVal );
+                    func( false, *pos.pCurBlock->m_arr[nIdx].pVal );
+                    m_Stat.onUpdateExisting();
+                    return std::make_pair( true, false );
+                }
+                if ( res == search_not_found ) {
+                    if ( !bAllowInsert ) {
+                        m_Stat.onUpdateFailed();
+                        return std::make_pair( false, false );
+                    }
+                    if ( !pVal )
+                        pVal = cxx_value_allocator().New( key, mapped_type());
+                    if ( insert_at( pos, nIdx, nHash, pVal ))
+                        break;
+                    m_Stat.onInsertRetry();
+                    bkoff();
+                }
+            }
+
+            func( true, *pVal );
+            inc_item_count();
+            m_Stat.onUpdateNew();
+            return std::make_pair( true, true );
+        }
+
+        template <typename Q, typename Compare, typename Func>
+        bool erase_( Q const& key, Compare cmp, Func f )
+        {
+            size_t nHash = hash_value( key );
+            node * pHead = get_bucket( nHash );
+            nHash = cds::intrusive::split_list::regular_hash( nHash );
+
+            position pos;
+            back_off bkoff;
+            size_t nIdx;
+            while ( true ) {
+                search( pHead, nHash, pos );
+                search_result res = find_in_block( pos, nHash, key, cmp, nIdx );
+                if ( res == search_not_found ) {
+                    m_Stat.onEraseFailed();
+                    return false;
+                }
+                if ( res == search_found ) {
+                    if ( erase_at( pos, nIdx, f )) {
+                        m_Stat.onEraseSuccess();
+                        return true;
+                    }
+                    m_Stat.onEraseRetry();
+                    bkoff();
+                }
+            }
+        }
+
+        template <typename Q, typename Compare>
+        void extract_( typename guarded_ptr::native_guard& guard, Q const& key, Compare cmp )
+        {
+            erase_( key, cmp, [&guard]( value_type& item ) { guard.set( &item ); } );
+        }
+
+        template <typename Q, typename Compare, typename Func>
+        bool find_( Q const& key, Compare cmp, Func f )
+        {
+            size_t nHash = hash_value( key );
+            node * pHead = get_bucket( nHash );
+            nHash = cds::intrusive::split_list::regular_hash( nHash );
+
+            position pos;
+            size_t nIdx;
+            while ( true ) {
+                search( pHead, nHash, pos );
+                search_result res = find_in_block( pos, nHash, key, cmp, nIdx );
+                if ( res == search_found ) {
+                    f( *pos.pCurBlock->m_arr[nIdx].pVal );
+                    m_Stat.onFindSuccess();
+                    return true;
+                }
+                if ( res == search_not_found ) {
+                    m_Stat.onFindFailed();
+                    return false;
+                }
+            }
+        }
+
+        template <typename Q, typename Compare>
+        void get_( typename guarded_ptr::native_guard& guard, Q const& key, Compare cmp )
+        {
+            find_( key, cmp, [&guard]( value_type& item ) { guard.set( &item ); } );
+        }
+        //@endcond
+    };
+
+}} // namespace cds::container
+
+#endif // #ifndef CDSLIB_CONTAINER_BLOCK_SPLIT_LIST_MAP_H
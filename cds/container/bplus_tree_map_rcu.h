@@ -0,0 +1,1777 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#ifndef CDSLIB_CONTAINER_BPLUS_TREE_MAP_RCU_H
+#define CDSLIB_CONTAINER_BPLUS_TREE_MAP_RCU_H
+
+#include <type_traits> // is_copy_assignable, is_trivially_copyable
+#include <functional>
+#include <cds/container/details/bplus_tree_base.h>
+#include <cds/urcu/details/check_deadlock.h>
+#include <cds/urcu/exempt_ptr.h>
+#include <cds/details/allocator.h>
+
+namespace cds { namespace container {
+
+    /// Concurrent B+-tree map with optimistic lock coupling (RCU specialization)
+    /** @ingroup cds_nonintrusive_map
+        @ingroup cds_nonintrusive_tree
+        @anchor cds_container_BPlusTreeMap_rcu
+
+        Source:
+            - [2016] V.Leis, F.Scheibner, A.Kemper, T.Neumann "The ART of Practical Synchronization"
+
+        The map is a B+-tree: the keys are stored in sorted arrays of high-fanout nodes,
+        the leaf nodes keep the keys with the pointers to the values, the inner nodes
+        keep the separator keys and the pointers to their children. Compared with the binary trees
+        (\p BronsonAVLTreeMap, \p EllenBinTreeMap) and the skip-list the tree is several times lower
+        and a lookup touches a few cache-friendly nodes instead of one node per tree level.
+
+        Each node has a version word that is used as a lock (optimistic lock coupling):
+        - readers never write to shared memory. A reader remembers the version of a node,
+          reads the node and then checks that the version has not been changed. If the node
+          has been modified concurrently, the operation is restarted from the root.
+          Descending the tree the reader validates the parent node after it has got the version of the child.
+        - writers lock only the nodes to be modified by upgrading the remembered version to the locked state.
+          Upgrade is a single CAS that fails if the node has been changed after it was read,
+          so writers never wait for a lock while holding another one, and deadlock is impossible.
+        - full inner nodes are split eagerly during the descent of an insertion,
+          so a split touches only the node and its parent.
+        - the node that has lost three quarters of its keys after an erasure is merged
+          with its neighbour under the parent lock if the result is no more than three quarters full.
+          Merging may cascade up to the root; the root with a single child is replaced by the child.
+
+        The nodes removed from the tree are freed by RCU, so optimistic readers never access freed memory.
+
+        Since the keys are read without locking and may be read while a writer moves them,
+        the tree has the following requirements:
+        - \p Key must be trivially copyable and default-constructible, for example, an integral type
+          or a POD structure;
+        - the key comparator must not dereference pointers stored in the key:
+          it can be called for the key being overwritten by a concurrent writer.
+          The result of such comparison is discarded after the validation.
+
+        The value of type \p T is allocated separately and the leaf keeps the pointer to it.
+        The value is never moved, so the functors get the reference to the value that remains valid
+        in RCU critical section, and \p extract() functions return the value as \p exempt_ptr.
+
+        <b>Template arguments</b>:
+        - \p RCU - one of \ref cds_urcu_gc "RCU type"
+        - \p Key - key type, see requirements above
+        - \p T - value type to be stored in the tree
+        - \p Traits - tree traits, default is \p bplus_tree::traits
+            It is possible to declare option-based tree with \p bplus_tree::make_traits metafunction
+            instead of \p Traits template argument.
+
+        The interface of the map is the same as the interface of \ref cds_container_BronsonAVLTreeMap_rcu "BronsonAVLTreeMap",
+        so the trees are interchangeable.
+
+        @note Before including <tt><cds/container/bplus_tree_map_rcu.h></tt> you should include appropriate RCU header file,
+        see \ref cds_urcu_gc "RCU type" for list of existing RCU class and corresponding header files.
+    */
+    template <
+        typename RCU,
+        typename Key,
+        typename T,
+#   ifdef CDS_DOXYGEN_INVOKED
+        typename Traits = bplus_tree::traits
+#else
+        typename Traits
+#endif
+    >
+    class BPlusTreeMap< cds::urcu::gc<RCU>, Key, T, Traits >
+    {
+    public:
+        typedef cds::urcu::gc<RCU>  gc;   ///< RCU Garbage collector
+        typedef Key     key_type;    ///< type of a key stored in the map
+        typedef T       mapped_type; ///< type of value stored in the map
+        typedef Traits  traits;      ///< Traits template parameter
+
+#   ifdef CDS_DOXYGEN_INVOKED
+        typedef implementation_defined key_comparator;    ///< key compare functor based on \p Traits::compare and \p Traits::less
+#   else
+        typedef typename opt::details::make_comparator< key_type, traits >::type key_comparator;
+#endif
+        typedef typename traits::item_counter           item_counter;       ///< Item counting policy
+        typedef typename traits::memory_model           memory_model;       ///< Memory ordering, see \p cds::opt::memory_model option
+        typedef typename traits::allocator              allocator_type;     ///< allocator for value
+        typedef typename traits::node_allocator         node_allocator_type;///< allocator for tree nodes
+        typedef typename traits::stat                   stat;               ///< internal statistics
+        typedef typename traits::rcu_check_deadlock     rcu_check_deadlock; ///< Deadlock checking policy
+        typedef typename traits::back_off               back_off;           ///< Back-off strategy
+
+        /// Max count of keys in a node
+        static CDS_CONSTEXPR size_t const c_nNodeCapacity = traits::node_capacity;
+        static_assert( c_nNodeCapacity >= 4, "The node capacity must be at least 4" );
+#if !( CDS_COMPILER == CDS_COMPILER_GCC && CDS_COMPILER_VERSION < 50000 )
+        // libstdc++ of GCC 4.x has no std::is_trivially_copyable
+        static_assert( std::is_trivially_copyable< key_type >::value,
+            "BPlusTreeMap requires trivially copyable key type: the keys are read and compared without locking" );
+#endif
+
+        /// Group of \p extract_xxx functions does not require external locking
+        static CDS_CONSTEXPR const bool c_bExtractLockExternal = false;
+
+    protected:
+        //@cond
+        typedef cds::details::Allocator< mapped_type, allocator_type > cxx_allocator;
+
+        struct value_disposer {
+            void operator()( mapped_type * p ) const
+            {
+                cxx_allocator().Delete( p );
+            }
+        };
+        //@endcond
+
+    public:
+#   ifdef CDS_DOXYGEN_INVOKED
+        /// Returned pointer to \p mapped_type of extracted item
+        typedef cds::urcu::exempt_ptr< gc, T, T, value_disposer, void > exempt_ptr;
+#   else
+        typedef cds::urcu::exempt_ptr< gc, mapped_type, mapped_type, value_disposer, void > exempt_ptr;
+#   endif
+
+        typedef typename gc::scoped_lock    rcu_lock;  ///< RCU scoped lock
+        typedef typename gc::batch_lock     rcu_batch_lock; ///< RCU batch lock for a sequence of lookups
+
+    protected:
+        //@cond
+        typedef uint64_t version_type;
+
+        enum version_bits : version_type {
+            obsolete_bit = 1,   // the node has been removed from the tree
+            lock_bit     = 2    // the node is locked by a writer
+            // the rest is version counter
+        };
+
+        struct node
+        {
+            atomics::atomic<version_type>   m_nVersion; // version word, see version_bits
+            atomics::atomic<uint32_t>       m_nCount;   // count of keys
+            bool const                      m_bLeaf;
+            node *                          m_pNextRetired; // thread-local list of retired nodes
+            key_type                        m_arrKeys[c_nNodeCapacity];
+
+            explicit node( bool bLeaf )
+                : m_nVersion( 0 )
+                , m_nCount( 0 )
+                , m_bLeaf( bLeaf )
+                , m_pNextRetired( nullptr )
+            {}
+
+            uint32_t count() const
+            {
+                return m_nCount.load( memory_model::memory_order_relaxed );
+            }
+
+            void count( uint32_t n )
+            {
+                m_nCount.store( n, memory_model::memory_order_relaxed );
+            }
+        };
+
+        struct leaf_node: public node
+        {
+            atomics::atomic<mapped_type *>  m_arrValues[c_nNodeCapacity];
+
+            leaf_node()
+                : node( true )
+            {}
+
+            mapped_type * value( uint32_t nPos ) const
+            {
+                return m_arrValues[nPos].load( memory_model::memory_order_relaxed );
+            }
+
+            void value( uint32_t nPos, mapped_type * pVal )
+            {
+                m_arrValues[nPos].store( pVal, memory_model::memory_order_relaxed );
+            }
+        };
+
+        struct inner_node: public node
+        {
+            atomics::atomic<node *>         m_arrChildren[c_nNodeCapacity + 1];
+
+            inner_node()
+                : node( false )
+            {}
+
+            node * child( uint32_t nPos ) const
+            {
+                return m_arrChildren[nPos].load( memory_model::memory_order_acquire );
+            }
+
+            void child( uint32_t nPos, node * pChild )
+            {
+                m_arrChildren[nPos].store( pChild, memory_model::memory_order_release );
+            }
+        };
+
+        typedef cds::details::Allocator< leaf_node, node_allocator_type >  leaf_allocator;
+        typedef cds::details::Allocator< inner_node, node_allocator_type > inner_allocator;
+        typedef cds::urcu::details::check_deadlock_policy< gc, rcu_check_deadlock >   check_deadlock_policy;
+
+        struct update_flags
+        {
+            enum {
+                allow_insert = 1,
+                allow_update = 2,
+
+                failed = 0,
+                result_inserted = allow_insert,
+                result_updated = allow_update
+            };
+        };
+
+        enum seek_mode {
+            seek_key,           // the leaf that may contain the key
+            seek_key_strict,    // the leaf that may contain the keys greater than the key
+            seek_leftmost,
+            seek_rightmost
+        };
+
+        // Max count of the path items kept by a search; the deeper items overwrite the upper ones
+        enum { c_nMaxPathLength = 32 };
+
+        struct path_item {
+            inner_node *    pNode;
+            version_type    nVersion;
+            uint32_t        nPos;   // index of the child followed
+        };
+
+        struct search_result {
+            path_item       arrPath[c_nMaxPathLength];
+            size_t          nDepth;     // count of inner nodes between the root and the leaf
+            size_t          nLowest;    // the lowest depth kept in arrPath
+            leaf_node *     pLeaf;
+            version_type    nLeafVersion;
+
+            // The leaf may contain only the keys in range (lowFence, highFence]
+            key_type        lowFence;
+            key_type        highFence;
+            bool            bLowFence;
+            bool            bHighFence;
+
+            // The fences are initialized once, so a fence copied by an optimistic reader is never an unset key
+            search_result()
+                : nDepth( 0 )
+                , nLowest( 0 )
+                , pLeaf( nullptr )
+                , nLeafVersion( 0 )
+                , lowFence()
+                , highFence()
+                , bLowFence( false )
+                , bHighFence( false )
+            {}
+
+            void reset()
+            {
+                nDepth = 0;
+                bLowFence = bHighFence = false;
+            }
+
+            void push( inner_node * pNode, version_type nVersion, uint32_t nPos )
+            {
+                path_item& item = arrPath[ nDepth % c_nMaxPathLength ];
+                item.pNode = pNode;
+                item.nVersion = nVersion;
+                item.nPos = nPos;
+                ++nDepth;
+            }
+
+            bool has_parent() const
+            {
+                return nDepth > nLowest;
+            }
+
+            path_item const& parent() const
+            {
+                assert( has_parent());
+                return arrPath[ (nDepth - 1) % c_nMaxPathLength ];
+            }
+
+            void pop()
+            {
+                assert( has_parent());
+                --nDepth;
+            }
+
+            void done()
+            {
+                nLowest = nDepth > c_nMaxPathLength ? nDepth - c_nMaxPathLength : 0;
+            }
+        };
+
+        // RCU safe disposer
+        class rcu_disposer
+        {
+            node *          m_pRetiredList;     ///< head of retired node list
+            mapped_type *   m_pRetiredValue;    ///< value retired
+
+        public:
+            rcu_disposer()
+                : m_pRetiredList( nullptr )
+                , m_pRetiredValue( nullptr )
+            {}
+
+            ~rcu_disposer()
+            {
+                clean();
+            }
+
+            void dispose( node * pNode )
+            {
+                pNode->m_pNextRetired = m_pRetiredList;
+                m_pRetiredList = pNode;
+            }
+
+            void dispose_value( mapped_type * pVal )
+            {
+                assert( m_pRetiredValue == nullptr );
+                m_pRetiredValue = pVal;
+            }
+
+        private:
+            struct internal_disposer
+            {
+                void operator()( node * p ) const
+                {
+                    free_node( p );
+                }
+            };
+
+            void clean()
+            {
+                assert( !gc::is_locked() );
+
+                for ( node * p = m_pRetiredList; p; ) {
+                    node * pNext = p->m_pNextRetired;
+                    gc::template retire_ptr<internal_disposer>( p );
+                    p = pNext;
+                }
+
+                if ( m_pRetiredValue )
+                    gc::template retire_ptr<value_disposer>( m_pRetiredValue );
+            }
+        };
+        //@endcond
+
+    protected:
+        //@cond
+        atomics::atomic<node *> m_pRoot;
+        item_counter            m_ItemCounter;
+        mutable stat            m_stat;
+        //@endcond
+
+    public:
+        /// Creates empty map
+        BPlusTreeMap()
+            : m_pRoot( alloc_leaf())
+        {}
+
+        /// Destroys the map
+        ~BPlusTreeMap()
+        {
+            unsafe_clear( m_pRoot.load( memory_model::memory_order_relaxed ));
+        }
+
+        /// Inserts new item with \p key and default value
+        /**
+            The function creates an item with \p key and default value, and then inserts the item created into the map.
+
+            Preconditions:
+            - The \p key_type should be constructible from a value of type \p K.
+            - The \p mapped_type should be default-constructible.
+
+            The function applies RCU lock internally.
+
+            Returns \p true if inserting successful, \p false otherwise.
+        */
+        template <typename K>
+        bool insert( K const& key )
+        {
+            return do_update( key, key_comparator(),
+                []( key_type const&, mapped_type * pVal ) -> mapped_type *
+                {
+                    assert( pVal == nullptr );
+                    CDS_UNUSED( pVal );
+                    return cxx_allocator().New();
+                },
+                update_flags::allow_insert
+            ) == update_flags::result_inserted;
+        }
+
+        /// Inserts new item
+        /**
+            The function creates an item with copy of \p val value
+            and then inserts the item created into the map.
+
+            Preconditions:
+            - The \p key_type should be constructible from \p key of type \p K.
+            - The \p mapped_type should be constructible from \p val of type \p V.
+
+            The function applies RCU lock internally.
+
+            Returns \p true if \p val is inserted into the map, \p false otherwise.
+        */
+        template <typename K, typename V>
+        bool insert( K const& key, V const& val )
+        {
+            return do_update( key, key_comparator(),
+                [&val]( key_type const&, mapped_type * pVal ) -> mapped_type *
+                {
+                    assert( pVal == nullptr );
+                    CDS_UNUSED( pVal );
+                    return cxx_allocator().New( val );
+                },
+                update_flags::allow_insert
+            ) == update_flags::result_inserted;
+        }
+
+        /// Inserts new item and initialize it by a functor
+        /**
+            This function inserts new item with key \p key and if inserting is successful then it calls
+            \p func functor with signature
+            \code
+                struct functor {
+                    void operator()( key_type const& key, mapped_type& item );
+                };
+            \endcode
+
+            The key_type should be constructible from value of type \p K.
+
+            The function allows to split creating of new item into two part:
+            - create item from \p key;
+            - insert new item into the map;
+            - if inserting is successful, initialize the value of item by calling \p func functor
+
+            This can be useful if complete initialization of object of \p value_type is heavyweight and
+            it is preferable that the initialization should be completed only if inserting is successful.
+            The functor is called under the leaf node lock.
+
+            The function applies RCU lock internally.
+        */
+        template <typename K, typename Func>
+        bool insert_with( K const& key, Func func )
+        {
+            return do_update( key, key_comparator(),
+                [&func]( key_type const& k, mapped_type * pVal ) -> mapped_type *
+                {
+                    assert( pVal == nullptr );
+                    CDS_UNUSED( pVal );
+                    mapped_type * pNew = cxx_allocator().New();
+                    func( k, *pNew );
+                    return pNew;
+                },
+                update_flags::allow_insert
+            ) == update_flags::result_inserted;
+        }
+
+        /// For key \p key inserts data of type \p mapped_type created in-place from \p args
+        /**
+            Returns \p true if inserting successful, \p false otherwise.
+
+            The function applies RCU lock internally.
+        */
+        template <typename K, typename... Args>
+        bool emplace( K&& key, Args&&... args )
+        {
+            // The value is created before the search; it is destroyed if the key already exists
+            mapped_type * pNew = cxx_allocator().New( std::forward<Args>(args)... );
+            bool bInserted = do_update( key, key_comparator(),
+                [pNew]( key_type const&, mapped_type * pVal ) -> mapped_type *
+                {
+                    assert( pVal == nullptr );
+                    CDS_UNUSED( pVal );
+                    return pNew;
+                },
+                update_flags::allow_insert
+            ) == update_flags::result_inserted;
+            if ( !bInserted )
+                cxx_allocator().Delete( pNew );
+            return bInserted;
+        }
+
+        /// Updates the value for \p key
+        /**
+            If the \p key not found in the map, then the new item created from \p key
+            will be inserted into the map iff \p bAllowInsert is \p true
+            (note that in this case the \ref key_type should be constructible from type \p K).
+            Otherwise, the functor \p func is called with item found.
+            The functor \p Func signature is:
+            \code
+                struct my_functor {
+                    void operator()( bool bNew, key_type const& key, mapped_type& item );
+                };
+            \endcode
+
+            with arguments:
+            - \p bNew - \p true if the item has been inserted, \p false otherwise
+            - \p item - value
+
+            The functor may change any fields of the \p item. The functor is called under the leaf node lock;
+            note that \p find() does not lock the node.
+
+            The function applies RCU lock internally.
+
+            Returns <tt> std::pair<bool, bool> </tt> where \p first is \p true if operation is successfull,
+            \p second is \p true if new item has been added or \p false if the item with \p key
+            already exists.
+        */
+        template <typename K, typename Func>
+        std::pair<bool, bool> update( K const& key, Func func, bool bAllowInsert = true )
+        {
+            int result = do_update( key, key_comparator(),
+                [&func]( key_type const& k, mapped_type * pVal ) -> mapped_type *
+                {
+                    if ( !pVal ) {
+                        pVal = cxx_allocator().New();
+                        func( true, k, *pVal );
+                    }
+                    else
+                        func( false, k, *pVal );
+                    return pVal;
+                },
+                (bAllowInsert ? update_flags::allow_insert : 0) | update_flags::allow_update
+            );
+            return std::make_pair( result != 0, (result & update_flags::result_inserted) != 0 );
+        }
+
+        /// Delete \p key from the map
+        /**
+            RCU \p synchronize() method can be called. RCU should not be locked.
+
+            Return \p true if \p key is found and deleted, \p false otherwise
+        */
+        template <typename K>
+        bool erase( K const& key )
+        {
+            return do_erase( key, key_comparator(), []( key_type const&, mapped_type& ) {} );
+        }
+
+        /// Deletes the item from the map using \p pred predicate for searching
+        /**
+            The function is an analog of \p erase(K const&)
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p Less must imply the same element order as the comparator used for building the map.
+        */
+        template <typename K, typename Less>
+        bool erase_with( K const& key, Less pred )
+        {
+            CDS_UNUSED( pred );
+            return do_erase( key, cds::opt::details::make_comparator_from_less<Less>(), []( key_type const&, mapped_type& ) {} );
+        }
+
+        /// Delete \p key from the map
+        /** \anchor cds_nonintrusive_BPlusTreeMap_rcu_erase_func
+
+            The function searches an item with key \p key, calls \p f functor
+            and deletes the item. If \p key is not found, the functor is not called.
+
+            The functor \p Func interface:
+            \code
+            struct extractor {
+                void operator()(key_type const& key, mapped_type& item) { ... }
+            };
+            \endcode
+            The functor is called under the leaf node lock.
+
+            RCU \p synchronize method can be called. RCU should not be locked.
+
+            Return \p true if key is found and deleted, \p false otherwise
+        */
+        template <typename K, typename Func>
+        bool erase( K const& key, Func f )
+        {
+            return do_erase( key, key_comparator(), f );
+        }
+
+        /// Deletes the item from the map using \p pred predicate for searching
+        /**
+            The function is an analog of \ref cds_nonintrusive_BPlusTreeMap_rcu_erase_func "erase(K const&, Func)"
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p Less must imply the same element order as the comparator used for building the map.
+        */
+        template <typename K, typename Less, typename Func>
+        bool erase_with( K const& key, Less pred, Func f )
+        {
+            CDS_UNUSED( pred );
+            return do_erase( key, cds::opt::details::make_comparator_from_less<Less>(), f );
+        }
+
+        /// Extracts a value with minimal key from the map
+        /**
+            Returns \p exempt_ptr pointer to the leftmost item.
+            If the map is empty, returns empty \p exempt_ptr.
+
+            Note that the function returns only the value for minimal key.
+            To retrieve its key use \p extract_min( Func ) member function.
+
+            @note Due the concurrent nature of the map, the function extracts <i>nearly</i> minimum key.
+            It means that the function gets leftmost leaf of the tree and removes its first item.
+            During removing, a concurrent thread may insert an item with key less than leftmost item's key.
+            So, the function returns the item with minimum key at the moment of tree traversing.
+
+            RCU \p synchronize method can be called. RCU should NOT be locked.
+            The function does not free the item.
+            The deallocator will be implicitly invoked when the returned object is destroyed or when
+            its \p release() member function is called.
+        */
+        exempt_ptr extract_min()
+        {
+            return exempt_ptr( do_extract_minmax( true, []( key_type const& ) {} ));
+        }
+
+        /// Extracts minimal key and corresponding value
+        /**
+            Returns \p exempt_ptr to the leftmost item.
+            If the tree is empty, returns empty \p exempt_ptr.
+
+            \p Func functor is used to store minimal key.
+            \p Func has the following signature:
+            \code
+                struct functor {
+                    void operator()( key_type const& key );
+                };
+            \endcode
+            If the tree is empty, \p f is not called.
+            Otherwise, is it called with minimal key, the pointer to corresponding value is returned
+            as \p exempt_ptr.
+
+            @note Due the concurrent nature of the map, the function extracts <i>nearly</i> minimum key,
+            see \p extract_min().
+
+            RCU \p synchronize method can be called. RCU should NOT be locked.
+            The function does not free the item.
+            The deallocator will be implicitly invoked when the returned object is destroyed or when
+            its \p release() member function is called.
+        */
+        template <typename Func>
+        exempt_ptr extract_min( Func f )
+        {
+            return exempt_ptr( do_extract_minmax( true, [&f]( key_type const& key ) { f( key ); } ));
+        }
+
+        /// Extracts minimal key and corresponding value
+        /**
+            This function is a shortcut for the following call:
+            \code
+                key_type key;
+                exempt_ptr xp = theTree.extract_min( [&key]( key_type const& k ) { key = k; } );
+            \endcode
+            \p key_type should be copy-assignable. The copy of minimal key
+            is returned in \p min_key argument.
+        */
+        typename std::enable_if< std::is_copy_assignable<key_type>::value, exempt_ptr >::type
+        extract_min_key( key_type& min_key )
+        {
+            return exempt_ptr( do_extract_minmax( true, [&min_key]( key_type const& key ) { min_key = key; } ));
+        }
+
+        /// Extracts an item with maximal key from the map
+        /**
+            Returns \p exempt_ptr pointer to the rightmost item.
+            If the map is empty, returns empty \p exempt_ptr.
+
+            Note that the function returns only the value for maximal key.
+            To retrieve its key use \p extract_max( Func ) or \p extract_max_key(key_type&) member function.
+
+            @note Due the concurrent nature of the map, the function extracts <i>nearly</i> maximal key.
+            It means that the function gets rightmost leaf of the tree and removes its last item.
+            During removing, a concurrent thread may insert an item with key greater than rightmost item's key.
+            So, the function returns the item with maximum key at the moment of tree traversing.
+
+            RCU \p synchronize method can be called. RCU should NOT be locked.
+            The function does not free the item.
+            The deallocator will be implicitly invoked when the returned object is destroyed or when
+            its \p release() is called.
+        */
+        exempt_ptr extract_max()
+        {
+            return exempt_ptr( do_extract_minmax( false, []( key_type const& ) {} ));
+        }
+
+        /// Extracts the maximal key and corresponding value
+        /**
+            Returns \p exempt_ptr pointer to the rightmost item.
+            If the map is empty, returns empty \p exempt_ptr.
+
+            \p Func functor is used to store maximal key.
+            \p Func has the following signature:
+            \code
+                struct functor {
+                    void operator()( key_type const& key );
+                };
+            \endcode
+            If the tree is empty, \p f is not called.
+            Otherwise, is it called with maximal key, the pointer to corresponding value is returned
+            as \p exempt_ptr.
+
+            @note Due the concurrent nature of the map, the function extracts <i>nearly</i> maximal key,
+            see \p extract_max().
+
+            RCU \p synchronize method can be called. RCU should NOT be locked.
+            The function does not free the item.
+            The deallocator will be implicitly invoked when the returned object is destroyed or when
+            its \p release() is called.
+        */
+        template <typename Func>
+        exempt_ptr extract_max( Func f )
+        {
+            return exempt_ptr( do_extract_minmax( false, [&f]( key_type const& key ) { f( key ); } ));
+        }
+
+        /// Extracts the maximal key and corresponding value
+        /**
+            This function is a shortcut for the following call:
+            \code
+                key_type key;
+                exempt_ptr xp = theTree.extract_max( [&key]( key_type const& k ) { key = k; } );
+            \endcode
+            \p key_type should be copy-assignable. The copy of maximal key
+            is returned in \p max_key argument.
+        */
+        typename std::enable_if< std::is_copy_assignable<key_type>::value, exempt_ptr >::type
+        extract_max_key( key_type& max_key )
+        {
+            return exempt_ptr( do_extract_minmax( false, [&max_key]( key_type const& key ) { max_key = key; } ));
+        }
+
+        /// Extracts an item from the map
+        /**
+            The function searches an item with key equal to \p key in the tree,
+            removes it, and returns \p exempt_ptr pointer to a value found.
+            If \p key is not found the function returns an empty \p exempt_ptr.
+
+            RCU \p synchronize method can be called. RCU should NOT be locked.
+            The function does not destroy the value found.
+            The dealloctor will be implicitly invoked when the returned object is destroyed or when
+            its \p release() member function is called.
+        */
+        template <typename Q>
+        exempt_ptr extract( Q const& key )
+        {
+            return exempt_ptr( do_extract( key, key_comparator()));
+        }
+
+        /// Extracts an item from the map using \p pred for searching
+        /**
+            The function is an analog of \p extract(Q const&)
+            but \p pred is used for key compare.
+            \p Less has the interface like \p std::less.
+            \p pred must imply the same element order as the comparator used for building the map.
+        */
+        template <typename Q, typename Less>
+        exempt_ptr extract_with( Q const& key, Less pred )
+        {
+            CDS_UNUSED( pred );
+            return exempt_ptr( do_extract( key, cds::opt::details::make_comparator_from_less<Less>()));
+        }
+
+        /// Find the key \p key
+        /**
+            The function searches the item with key equal to \p key and calls the functor \p f for item found.
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( key_type const& key, mapped_type& val );
+            };
+            \endcode
+            where \p val is the item found for \p key.
+            The functor is called without any lock, the item may be changed concurrently by \p update().
+
+            The function applies RCU lock internally.
+
+            The function returns \p true if \p key is found, \p false otherwise.
+        */
+        template <typename K, typename Func>
+        bool find( K const& key, Func f )
+        {
+            rcu_lock l;
+            return do_find( key, key_comparator(), f );
+        }
+
+        /// Finds the key \p val using \p pred predicate for searching
+        /**
+            The function is an analog of \p find(K const&, Func)
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p Less must imply the same element order as the comparator used for building the map.
+        */
+        template <typename K, typename Less, typename Func>
+        bool find_with( K const& key, Less pred, Func f )
+        {
+            CDS_UNUSED( pred );
+            rcu_lock l;
+            return do_find( key, cds::opt::details::make_comparator_from_less<Less>(), f );
+        }
+
+        /// Checks whether the map contains \p key
+        /**
+            The function searches the item with key equal to \p key
+            and returns \p true if it is found, and \p false otherwise.
+
+            The function applies RCU lock internally.
+        */
+        template <typename K>
+        bool contains( K const& key )
+        {
+            rcu_lock l;
+            return do_find( key, key_comparator(), []( key_type const&, mapped_type& ) {} );
+        }
+
+        /// Checks whether the map contains \p key, batch version
+        /**
+            The function does not lock RCU: the caller holds the batch lock \p bl
+            that covers a sequence of lookups.
+            Before searching the function calls <tt>bl.step()</tt> that can leave RCU critical section
+            for a moment if some thread is waiting in \p synchronize().
+        */
+        template <typename K>
+        bool contains( rcu_batch_lock& bl, K const& key )
+        {
+            bl.step();
+            assert( gc::is_locked() );
+            return do_find( key, key_comparator(), []( key_type const&, mapped_type& ) {} );
+        }
+
+        /// Finds the key \p key, batch version
+        /**
+            The function is an analog of \p find(K const&, Func) but it does not lock RCU,
+            see \p contains( rcu_batch_lock&, K const& ).
+        */
+        template <typename K, typename Func>
+        bool find( rcu_batch_lock& bl, K const& key, Func f )
+        {
+            bl.step();
+            assert( gc::is_locked() );
+            return do_find( key, key_comparator(), f );
+        }
+
+        /// Checks whether the map contains \p key using \p pred predicate for searching
+        /**
+            The function is similar to <tt>contains( key )</tt> but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p Less must imply the same element order as the comparator used for building the set.
+        */
+        template <typename K, typename Less>
+        bool contains( K const& key, Less pred )
+        {
+            CDS_UNUSED( pred );
+            rcu_lock l;
+            return do_find( key, cds::opt::details::make_comparator_from_less<Less>(), []( key_type const&, mapped_type& ) {} );
+        }
+
+        /// Calls \p f for each item with key in range <tt>[lo, hi)</tt> in ascending key order
+        /**
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( key_type const& key, mapped_type& val );
+            };
+            \endcode
+
+            The scan is performed leaf by leaf inside a single RCU read-side critical section.
+            The content of each leaf is copied and validated by the leaf version, so the items
+            of one leaf are a consistent snapshot; if the leaf has been changed concurrently,
+            it is re-read. The next leaf is searched from the root by the upper bound of the keys
+            of the current leaf, so the scan never visits a key twice and never goes back.
+            The functor is called without any lock and must not modify the map.
+
+            The function applies RCU lock internally.
+        */
+        template <typename K, typename Func>
+        void for_each_in_range( K const& lo, K const& hi, Func f )
+        {
+            key_comparator cmp;
+            rcu_lock l;
+            m_stat.onRangeScan();
+            do_scan( key_type( lo ), seek_key,
+                [&f, &hi, &cmp]( key_type const& key, mapped_type * pVal ) -> bool
+                {
+                    if ( cmp( key, hi ) >= 0 )
+                        return false;
+                    f( key, *pVal );
+                    return true;
+                }
+            );
+        }
+
+        /// Calls \p f for each item of the map in ascending key order
+        /**
+            The function is an analog of \p for_each_in_range() that visits the whole map.
+
+            The function applies RCU lock internally.
+        */
+        template <typename Func>
+        void for_each( Func f )
+        {
+            rcu_lock l;
+            m_stat.onRangeScan();
+            do_scan( key_type(), seek_leftmost,
+                [&f]( key_type const& key, mapped_type * pVal ) -> bool
+                {
+                    f( key, *pVal );
+                    return true;
+                }
+            );
+        }
+
+        /// Clears the map
+        /**
+            The function removes the items one by one with \p extract_min().
+
+            RCU \p synchronize method can be called. RCU should not be locked.
+        */
+        void clear()
+        {
+            while ( extract_min());
+        }
+
+        /// Checks if the map is empty
+        bool empty() const
+        {
+            bool bEmpty = true;
+            rcu_lock l;
+            do_scan( key_type(), seek_leftmost,
+                [&bEmpty]( key_type const&, mapped_type * ) -> bool
+                {
+                    bEmpty = false;
+                    return false;
+                }
+            );
+            return bEmpty;
+        }
+
+        /// Returns item count in the map
+        /**
+            The value returned depends on item counter type provided by \p Traits template parameter.
+            If it is \p atomicity::empty_item_counter this function always returns 0.
+
+            The function is not suitable for checking the tree emptiness, use \p empty()
+            member function for this purpose.
+        */
+        size_t size() const
+        {
+            return m_ItemCounter;
+        }
+
+        /// Returns const reference to internal statistics
+        stat const& statistics() const
+        {
+            return m_stat;
+        }
+
+        /// Checks internal consistency (not atomic, not thread-safe)
+        /**
+            The debugging function to check internal consistency of the tree:
+            the keys of each node are sorted and lie in the range defined by the parent,
+            all leaves have the same depth.
+        */
+        bool check_consistency() const
+        {
+            return check_consistency( []( size_t /*nLevel*/, size_t /*hLeft*/, size_t /*hRight*/ ) {} );
+        }
+
+        /// Checks internal consistency (not atomic, not thread-safe)
+        /**
+            The debugging function to check internal consistency of the tree.
+            The functor \p Func is called if the subtrees of an inner node have different heights:
+            \code
+            struct functor {
+                void operator()( size_t nLevel, size_t hLeft, size_t hRight );
+            };
+            \endcode
+            where
+            - \p nLevel - the level where the violation is found
+            - \p hLeft - the height of the leftmost subtree of the node
+            - \p hRight - the height of the subtree that differs from the leftmost one
+
+            The functor is called for each violation found.
+        */
+        template <typename Func>
+        bool check_consistency( Func f ) const
+        {
+            bool bConsistent = true;
+            check_node( m_pRoot.load( memory_model::memory_order_relaxed ), 0, nullptr, nullptr, f, bConsistent );
+            return bConsistent;
+        }
+
+    protected:
+        //@cond
+        static leaf_node * alloc_leaf()
+        {
+            return leaf_allocator().New();
+        }
+
+        static inner_node * alloc_inner()
+        {
+            return inner_allocator().New();
+        }
+
+        static void free_node( node * pNode )
+        {
+            if ( pNode->m_bLeaf )
+                leaf_allocator().Delete( static_cast<leaf_node *>( pNode ));
+            else
+                inner_allocator().Delete( static_cast<inner_node *>( pNode ));
+        }
+
+        // Optimistic lock coupling primitives
+
+        static bool read_lock( node const * pNode, version_type& nVersion )
+        {
+            back_off bkoff;
+            for ( ;; ) {
+                nVersion = pNode->m_nVersion.load( memory_model::memory_order_acquire );
+                if ( nVersion & obsolete_bit )
+                    return false;
+                if ( !( nVersion & lock_bit ))
+                    return true;
+                bkoff();
+            }
+        }
+
+        static bool validate( node const * pNode, version_type nVersion )
+        {
+            atomics::atomic_thread_fence( memory_model::memory_order_acquire );
+            return pNode->m_nVersion.load( memory_model::memory_order_relaxed ) == nVersion;
+        }
+
+        static bool upgrade( node * pNode, version_type nVersion )
+        {
+            if ( pNode->m_nVersion.compare_exchange_strong( nVersion, nVersion + lock_bit,
+                memory_model::memory_order_acquire, atomics::memory_order_relaxed ))
+            {
+                // The stores into the node must not become visible before the lock bit
+                atomics::atomic_thread_fence( memory_model::memory_order_release );
+                return true;
+            }
+            return false;
+        }
+
+        static bool try_lock( node * pNode )
+        {
+            version_type nVersion = pNode->m_nVersion.load( memory_model::memory_order_acquire );
+            return !( nVersion & ( lock_bit | obsolete_bit )) && upgrade( pNode, nVersion );
+        }
+
+        static void write_unlock( node * pNode )
+        {
+            assert( pNode->m_nVersion.load( atomics::memory_order_relaxed ) & lock_bit );
+            pNode->m_nVersion.fetch_add( lock_bit, memory_model::memory_order_release );
+        }
+
+        static void write_unlock_obsolete( node * pNode )
+        {
+            assert( pNode->m_nVersion.load( atomics::memory_order_relaxed ) & lock_bit );
+            pNode->m_nVersion.fetch_add( lock_bit | obsolete_bit, memory_model::memory_order_release );
+        }
+
+        // Search inside a node
+
+        template <typename Q, typename Compare>
+        static uint32_t lower_bound( node const * pNode, uint32_t nCount, Q const& key, Compare cmp )
+        {
+            // the index of the first key that is not less than key
+            uint32_t nLow = 0;
+            while ( nLow < nCount ) {
+                uint32_t nMid = ( nLow + nCount ) / 2;
+                if ( cmp( pNode->m_arrKeys[nMid], key ) < 0 )
+                    nLow = nMid + 1;
+                else
+                    nCount = nMid;
+            }
+            return nLow;
+        }
+
+        template <typename Q, typename Compare>
+        static uint32_t upper_bound( node const * pNode, uint32_t nCount, Q const& key, Compare cmp )
+        {
+            // the index of the first key that is greater than key
+            uint32_t nLow = 0;
+            while ( nLow < nCount ) {
+                uint32_t nMid = ( nLow + nCount ) / 2;
+                if ( cmp( pNode->m_arrKeys[nMid], key ) <= 0 )
+                    nLow = nMid + 1;
+                else
+                    nCount = nMid;
+            }
+            return nLow;
+        }
+
+        // Finds the leaf for the key. Returns false if the search should be restarted.
+        // If bSplit is true, the full inner node found on the path is split and the search should be restarted.
+        template <typename Q, typename Compare>
+        bool descend( Q const& key, Compare cmp, int nMode, bool bSplit, search_result& res ) const
+        {
+            res.reset();
+
+            node * pNode = m_pRoot.load( memory_model::memory_order_acquire );
+            version_type nVersion;
+            if ( !read_lock( pNode, nVersion ) || pNode != m_pRoot.load( memory_model::memory_order_acquire ))
+                return false;
+
+            while ( !pNode->m_bLeaf ) {
+                inner_node * pInner = static_cast<inner_node *>( pNode );
+                uint32_t const nCount = pInner->count();
+                if ( bSplit && nCount == c_nNodeCapacity ) {
+                    res.done();
+                    const_cast<BPlusTreeMap *>( this )->split( res, pInner, nVersion );
+                    return false;
+                }
+
+                uint32_t nPos;
+                switch ( nMode ) {
+                case seek_key:
+                    nPos = lower_bound( pInner, nCount, key, cmp );
+                    break;
+                case seek_key_strict:
+                    nPos = upper_bound( pInner, nCount, key, cmp );
+                    break;
+                case seek_leftmost:
+                    nPos = 0;
+                    break;
+                default:
+                    assert( nMode == seek_rightmost );
+                    nPos = nCount;
+                }
+                if ( nPos < nCount ) {
+                    res.highFence = pInner->m_arrKeys[nPos];
+                    res.bHighFence = true;
+                }
+                if ( nPos > 0 ) {
+                    res.lowFence = pInner->m_arrKeys[nPos - 1];
+                    res.bLowFence = true;
+                }
+                node * pChild = pInner->child( nPos );
+
+                // The child pointer may be dereferenced only if the node has not been changed
+                if ( !validate( pInner, nVersion ))
+                    return false;
+
+                version_type nChildVersion;
+                if ( !read_lock( pChild, nChildVersion ))
+                    return false;
+
+                // The child has not been split after we have read the link to it
+                if ( !validate( pInner, nVersion ))
+                    return false;
+
+                res.push( pInner, nVersion, nPos );
+                pNode = pChild;
+                nVersion = nChildVersion;
+            }
+
+            res.done();
+            res.pLeaf = static_cast<leaf_node *>( pNode );
+            res.nLeafVersion = nVersion;
+            return true;
+        }
+
+        // Splits the node pNode of version nVersion; the parent of pNode is on the top of res path.
+        // On success, the parent gets new separator key and new child.
+        void split( search_result& res, node * pNode, version_type nVersion )
+        {
+            inner_node * pParent = nullptr;
+            uint32_t nParentPos = 0;
+            if ( res.nDepth > 0 ) {
+                if ( !res.has_parent())
+                    return; // the path is too long, the parent is unknown
+                path_item const& pi = res.parent();
+                if ( !upgrade( pi.pNode, pi.nVersion ))
+                    return;
+                pParent = pi.pNode;
+                nParentPos = pi.nPos;
+            }
+            if ( !upgrade( pNode, nVersion )) {
+                if ( pParent )
+                    write_unlock( pParent );
+                return;
+            }
+            assert( pParent || pNode == m_pRoot.load( memory_model::memory_order_relaxed ));
+            assert( !pParent || pParent->count() < c_nNodeCapacity );
+
+            key_type sep;
+            node * pRight;
+            if ( pNode->m_bLeaf ) {
+                pRight = split_leaf( static_cast<leaf_node *>( pNode ), sep );
+                m_stat.onLeafSplit();
+            }
+            else {
+                pRight = split_inner( static_cast<inner_node *>( pNode ), sep );
+                m_stat.onInnerSplit();
+            }
+
+            if ( pParent ) {
+                insert_child( pParent, nParentPos, sep, pRight );
+                write_unlock( pNode );
+                write_unlock( pParent );
+            }
+            else {
+                inner_node * pRoot = alloc_inner();
+                pRoot->m_arrKeys[0] = sep;
+                pRoot->child( 0, pNode );
+                pRoot->child( 1, pRight );
+                pRoot->count( 1 );
+                m_pRoot.store( pRoot, memory_model::memory_order_release );
+                write_unlock( pNode );
+                m_stat.onHeightIncrease();
+            }
+        }
+
+        static leaf_node * split_leaf( leaf_node * pLeaf, key_type& sep )
+        {
+            uint32_t const nCount = pLeaf->count();
+            uint32_t const nMid = nCount / 2;
+
+            leaf_node * pRight = alloc_leaf();
+            for ( uint32_t i = nMid; i < nCount; ++i ) {
+                pRight->m_arrKeys[i - nMid] = pLeaf->m_arrKeys[i];
+                pRight->value( i - nMid, pLeaf->value( i ));
+            }
+            pRight->count( nCount - nMid );
+            pLeaf->count( nMid );
+            sep = pLeaf->m_arrKeys[nMid - 1];
+            return pRight;
+        }
+
+        static inner_node * split_inner( inner_node * pInner, key_type& sep )
+        {
+            uint32_t const nCount = pInner->count();
+            uint32_t const nMid = nCount / 2;
+
+            // keys[nMid] goes up to the parent
+            inner_node * pRight = alloc_inner();
+            for ( uint32_t i = nMid + 1; i < nCount; ++i )
+                pRight->m_arrKeys[i - nMid - 1] = pInner->m_arrKeys[i];
+            for ( uint32_t i = nMid + 1; i <= nCount; ++i )
+                pRight->child( i - nMid - 1, pInner->child( i ));
+            pRight->count( nCount - nMid - 1 );
+            sep = pInner->m_arrKeys[nMid];
+            pInner->count( nMid );
+            return pRight;
+        }
+
+        static void insert_child( inner_node * pParent, uint32_t nPos, key_type const& sep, node * pChild )
+        {
+            // pChild becomes the right neighbour of child nPos, sep separates them
+            uint32_t const nCount = pParent->count();
+            assert( nCount < c_nNodeCapacity );
+            for ( uint32_t i = nCount; i > nPos; --i )
+                pParent->m_arrKeys[i] = pParent->m_arrKeys[i - 1];
+            for ( uint32_t i = nCount + 1; i > nPos + 1; --i )
+                pParent->child( i, pParent->child( i - 1 ));
+            pParent->m_arrKeys[nPos] = sep;
+            pParent->child( nPos + 1, pChild );
+            pParent->count( nCount + 1 );
+        }
+
+        static void remove_child( inner_node * pParent, uint32_t nPos )
+        {
+            // removes key nPos and child nPos + 1
+            uint32_t const nCount = pParent->count();
+            assert( nPos < nCount );
+            for ( uint32_t i = nPos + 1; i < nCount; ++i )
+                pParent->m_arrKeys[i - 1] = pParent->m_arrKeys[i];
+            for ( uint32_t i = nPos + 2; i <= nCount; ++i )
+                pParent->child( i - 1, pParent->child( i ));
+            pParent->count( nCount - 1 );
+        }
+
+        template <typename K>
+        static void leaf_insert( leaf_node * pLeaf, uint32_t nPos, K const& key )
+        {
+            uint32_t const nCount = pLeaf->count();
+            assert( nCount < c_nNodeCapacity );
+            for ( uint32_t i = nCount; i > nPos; --i ) {
+                pLeaf->m_arrKeys[i] = pLeaf->m_arrKeys[i - 1];
+                pLeaf->value( i, pLeaf->value( i - 1 ));
+            }
+            pLeaf->m_arrKeys[nPos] = key_type( key );
+            pLeaf->value( nPos, nullptr );
+            pLeaf->count( nCount + 1 );
+        }
+
+        static void leaf_remove( leaf_node * pLeaf, uint32_t nPos )
+        {
+            uint32_t const nCount = pLeaf->count();
+            assert( nPos < nCount );
+            for ( uint32_t i = nPos + 1; i < nCount; ++i ) {
+                pLeaf->m_arrKeys[i - 1] = pLeaf->m_arrKeys[i];
+                pLeaf->value( i - 1, pLeaf->value( i ));
+            }
+            pLeaf->count( nCount - 1 );
+        }
+
+        // Merges pRight into pLeft if the result fits in 3/4 of a node. Both nodes and their parent are locked.
+        bool merge( node * pLeft, node * pRight, key_type const& sep )
+        {
+            uint32_t const nLeft = pLeft->count();
+            uint32_t const nRight = pRight->count();
+
+            if ( pLeft->m_bLeaf ) {
+                if ( nLeft + nRight > c_nNodeCapacity * 3 / 4 )
+                    return false;
+                leaf_node * pDst = static_cast<leaf_node *>( pLeft );
+                leaf_node * pSrc = static_cast<leaf_node *>( pRight );
+                for ( uint32_t i = 0; i < nRight; ++i ) {
+                    pDst->m_arrKeys[nLeft + i] = pSrc->m_arrKeys[i];
+                    pDst->value( nLeft + i, pSrc->value( i ));
+                }
+                pDst->count( nLeft + nRight );
+                m_stat.onLeafMerge();
+            }
+            else {
+                if ( nLeft + nRight + 1 > c_nNodeCapacity * 3 / 4 )
+                    return false;
+                inner_node * pDst = static_cast<inner_node *>( pLeft );
+                inner_node * pSrc = static_cast<inner_node *>( pRight );
+                pDst->m_arrKeys[nLeft] = sep;
+                for ( uint32_t i = 0; i < nRight; ++i )
+                    pDst->m_arrKeys[nLeft + 1 + i] = pSrc->m_arrKeys[i];
+                for ( uint32_t i = 0; i <= nRight; ++i )
+                    pDst->child( nLeft + 1 + i, pSrc->child( i ));
+                pDst->count( nLeft + nRight + 1 );
+                m_stat.onInnerMerge();
+            }
+            return true;
+        }
+
+        // pNode is locked; merges underfull nodes up the path and unlocks pNode
+        void rebalance( search_result& res, node * pNode, rcu_disposer& removed_list )
+        {
+            while ( pNode->count() <= c_nNodeCapacity / 4 && res.has_parent()) {
+                path_item const& pi = res.parent();
+                inner_node * pParent = pi.pNode;
+                if ( !upgrade( pParent, pi.nVersion )) {
+                    m_stat.onMergeFailed();
+                    break;
+                }
+
+                uint32_t const nParentCount = pParent->count();
+                if ( nParentCount == 0 ) {
+                    write_unlock( pParent );
+                    m_stat.onMergeFailed();
+                    break;
+                }
+
+                uint32_t const nLeftPos = pi.nPos < nParentCount ? pi.nPos : pi.nPos - 1;
+                node * pLeft = pParent->child( nLeftPos );
+                node * pRight = pParent->child( nLeftPos + 1 );
+                assert( pLeft == pNode || pRight == pNode );
+
+                node * pSibling = pLeft == pNode ? pRight : pLeft;
+                if ( !try_lock( pSibling )) {
+                    write_unlock( pParent );
+                    m_stat.onMergeFailed();
+                    break;
+                }
+                if ( !merge( pLeft, pRight, pParent->m_arrKeys[nLeftPos] )) {
+                    write_unlock( pSibling );
+                    write_unlock( pParent );
+                    m_stat.onMergeFailed();
+                    break;
+                }
+
+                remove_child( pParent, nLeftPos );
+                write_unlock( pLeft );
+                write_unlock_obsolete( pRight );
+                removed_list.dispose( pRight );
+                m_stat.onDisposeNode();
+
+                res.pop();
+                pNode = pParent;
+            }
+
+            if ( res.nDepth == 0 && !pNode->m_bLeaf && pNode->count() == 0 ) {
+                // The root has a single child that becomes new root
+                assert( pNode == m_pRoot.load( memory_model::memory_order_relaxed ));
+                m_pRoot.store( static_cast<inner_node *>( pNode )->child( 0 ), memory_model::memory_order_release );
+                write_unlock_obsolete( pNode );
+                removed_list.dispose( pNode );
+                m_stat.onDisposeNode();
+                m_stat.onHeightDecrease();
+            }
+            else
+                write_unlock( pNode );
+        }
+
+        template <typename K, typename Compare, typename Func>
+        int do_update( K const& key, Compare cmp, Func funcUpdate, int nFlags )
+        {
+            search_result res;
+            rcu_lock l;
+
+            for ( ;; ) {
+                if ( !descend( key, cmp, seek_key, ( nFlags & update_flags::allow_insert ) != 0, res )) {
+                    m_stat.onUpdateRetry();
+                    continue;
+                }
+
+                leaf_node * pLeaf = res.pLeaf;
+                uint32_t const nCount = pLeaf->count();
+                uint32_t const nPos = lower_bound( pLeaf, nCount, key, cmp );
+                bool const bFound = nPos < nCount && cmp( pLeaf->m_arrKeys[nPos], key ) == 0;
+
+                if ( bFound ? !( nFlags & update_flags::allow_update ) : !( nFlags & update_flags::allow_insert )) {
+                    if ( !validate( pLeaf, res.nLeafVersion )) {
+                        m_stat.onUpdateRetry();
+                        continue;
+                    }
+                    if ( bFound )
+                        m_stat.onInsertFailed();
+                    else
+                        m_stat.onUpdateFailed();
+                    return update_flags::failed;
+                }
+
+                if ( !bFound && nCount == c_nNodeCapacity ) {
+                    split( res, pLeaf, res.nLeafVersion );
+                    m_stat.onUpdateRetry();
+                    continue;
+                }
+
+                if ( !upgrade( pLeaf, res.nLeafVersion )) {
+                    m_stat.onUpdateRetry();
+                    continue;
+                }
+
+                if ( bFound ) {
+                    funcUpdate( pLeaf->m_arrKeys[nPos], pLeaf->value( nPos ));
+                    write_unlock( pLeaf );
+                    m_stat.onUpdateSuccess();
+                    return update_flags::result_updated;
+                }
+
+                leaf_insert( pLeaf, nPos, key );
+                pLeaf->value( nPos, funcUpdate( pLeaf->m_arrKeys[nPos], static_cast<mapped_type *>( nullptr )));
+                write_unlock( pLeaf );
+                ++m_ItemCounter;
+                m_stat.onInsertSuccess();
+                return update_flags::result_inserted;
+            }
+        }
+
+        // Removes the item found by funcSeek; funcRemove( key, pVal ) is called under leaf lock.
+        // funcSeek( res ) returns 1 and the position of the item in the leaf, 0 if the item is not found, -1 for retry
+        template <typename SeekFunc, typename RemoveFunc>
+        bool do_remove( SeekFunc funcSeek, RemoveFunc funcRemove, rcu_disposer& removed_list )
+        {
+            search_result res;
+            rcu_lock l;
+
+            for ( ;; ) {
+                uint32_t nPos;
+                int const nResult = funcSeek( res, nPos );
+                if ( nResult == 0 )
+                    return false;
+                if ( nResult < 0 || !upgrade( res.pLeaf, res.nLeafVersion )) {
+                    m_stat.onRemoveRetry();
+                    continue;
+                }
+
+                leaf_node * pLeaf = res.pLeaf;
+                funcRemove( pLeaf->m_arrKeys[nPos], pLeaf->value( nPos ));
+                leaf_remove( pLeaf, nPos );
+                --m_ItemCounter;
+                rebalance( res, pLeaf, removed_list );
+                return true;
+            }
+        }
+
+        template <typename Q, typename Compare, typename RemoveFunc>
+        bool do_remove_key( Q const& key, Compare cmp, RemoveFunc funcRemove, rcu_disposer& removed_list )
+        {
+            return do_remove(
+                [this, &key, &cmp]( search_result& res, uint32_t& nPos ) -> int
+                {
+                    if ( !descend( key, cmp, seek_key, false, res ))
+                        return -1;
+
+                    leaf_node * pLeaf = res.pLeaf;
+                    uint32_t const nCount = pLeaf->count();
+                    nPos = lower_bound( pLeaf, nCount, key, cmp );
+                    if ( nPos < nCount && cmp( pLeaf->m_arrKeys[nPos], key ) == 0 )
+                        return 1;
+                    return validate( pLeaf, res.nLeafVersion ) ? 0 : -1;
+                },
+                funcRemove, removed_list );
+        }
+
+        template <typename Q, typename Compare, typename Func>
+        bool do_erase( Q const& key, Compare cmp, Func f )
+        {
+            check_deadlock_policy::check();
+
+            rcu_disposer removed_list;
+            bool const bRemoved = do_remove_key( key, cmp,
+                [&f, &removed_list]( key_type const& k, mapped_type * pVal )
+                {
+                    f( k, *pVal );
+                    removed_list.dispose_value( pVal );
+                },
+                removed_list );
+
+            m_stat.onRemove( bRemoved );
+            if ( bRemoved )
+                m_stat.onDisposeValue();
+            return bRemoved;
+        }
+
+        template <typename Q, typename Compare>
+        mapped_type * do_extract( Q const& key, Compare cmp )
+        {
+            check_deadlock_policy::check();
+
+            mapped_type * pExtracted = nullptr;
+            {
+                rcu_disposer removed_list;
+                do_remove_key( key, cmp,
+                    [&pExtracted]( key_type const&, mapped_type * pVal )
+                    {
+                        pExtracted = pVal;
+                    },
+                    removed_list );
+            }
+
+            m_stat.onExtract( pExtracted != nullptr );
+            if ( pExtracted )
+                m_stat.onExtractValue();
+            return pExtracted;
+        }
+
+        template <typename Func>
+        mapped_type * do_extract_minmax( bool bMin, Func f )
+        {
+            check_deadlock_policy::check();
+
+            mapped_type * pExtracted = nullptr;
+            {
+                rcu_disposer removed_list;
+                key_type fence;
+                int nMode = bMin ? seek_leftmost : seek_rightmost;
+                key_comparator cmp;
+
+                do_remove(
+                    [this, bMin, &fence, &nMode, &cmp]( search_result& res, uint32_t& nPos ) -> int
+                    {
+                        for ( ;; ) {
+                            if ( !descend( fence, cmp, nMode, false, res ))
+                                return -1;
+
+                            leaf_node * pLeaf = res.pLeaf;
+                            uint32_t const nCount = pLeaf->count();
+                            if ( nCount > 0 ) {
+                                nPos = bMin ? 0 : nCount - 1;
+                                return 1;
+                            }
+
+                            // The leaf is empty, go to its neighbour
+                            if ( !validate( pLeaf, res.nLeafVersion ))
+                                return -1;
+                            if ( bMin ) {
+                                if ( !res.bHighFence )
+                                    return 0;
+                                fence = res.highFence;
+                                nMode = seek_key_strict;
+                            }
+                            else {
+                                if ( !res.bLowFence )
+                                    return 0;
+                                fence = res.lowFence;
+                                nMode = seek_key;
+                            }
+                        }
+                    },
+                    [&pExtracted, &f]( key_type const& key, mapped_type * pVal )
+                    {
+                        f( key );
+                        pExtracted = pVal;
+                    },
+                    removed_list );
+            }
+
+            m_stat.onExtract( pExtracted != nullptr );
+            if ( pExtracted )
+                m_stat.onExtractValue();
+            return pExtracted;
+        }
+
+        template <typename Q, typename Compare, typename Func>
+        bool do_find( Q const& key, Compare cmp, Func f ) const
+        {
+            assert( gc::is_locked());
+
+            search_result res;
+            for ( ;; ) {
+                if ( !descend( key, cmp, seek_key, false, res )) {
+                    m_stat.onFindRetry();
+                    continue;
+                }
+
+                leaf_node * pLeaf = res.pLeaf;
+                uint32_t const nCount = pLeaf->count();
+                uint32_t const nPos = lower_bound( pLeaf, nCount, key, cmp );
+                if ( nPos < nCount && cmp( pLeaf->m_arrKeys[nPos], key ) == 0 ) {
+                    key_type const foundKey( pLeaf->m_arrKeys[nPos] );
+                    mapped_type * pVal = pLeaf->value( nPos );
+                    if ( !validate( pLeaf, res.nLeafVersion )) {
+                        m_stat.onFindRetry();
+                        continue;
+                    }
+                    f( foundKey, *pVal );
+                    m_stat.onFindSuccess();
+                    return true;
+                }
+
+                if ( !validate( pLeaf, res.nLeafVersion )) {
+                    m_stat.onFindRetry();
+                    continue;
+                }
+                m_stat.onFindFailed();
+                return false;
+            }
+        }
+
+        // Calls f( key, pVal ) for each item starting from the leaf found by nMode for the key
+        // while f returns true. RCU should be locked.
+        template <typename Func>
+        void do_scan( key_type const& key, int nMode, Func f ) const
+        {
+            assert( gc::is_locked());
+
+            key_comparator  cmp;
+            key_type        arrKeys[c_nNodeCapacity];
+            mapped_type *   arrValues[c_nNodeCapacity];
+            search_result   res;
+
+            // The current leaf is searched by seekKey and nMode.
+            // The items not greater (for seek_key_strict) or less (for seek_key) than seekKey are skipped:
+            // a concurrent merge can move already visited items into the current leaf
+            key_type        seekKey( key );
+
+            for ( ;; ) {
+                while ( !descend( seekKey, cmp, nMode, false, res ))
+                    m_stat.onRangeRestart();
+
+                leaf_node * pLeaf = res.pLeaf;
+                uint32_t const nCount = pLeaf->count();
+                for ( uint32_t i = 0; i < nCount; ++i ) {
+                    arrKeys[i] = pLeaf->m_arrKeys[i];
+                    arrValues[i] = pLeaf->value( i );
+                }
+                bool const bNext = res.bHighFence;
+                key_type upperBound( seekKey );
+                if ( bNext )
+                    upperBound = res.highFence;
+                if ( !validate( pLeaf, res.nLeafVersion )) {
+                    // re-read the leaf
+                    m_stat.onRangeRestart();
+                    continue;
+                }
+
+                for ( uint32_t i = 0; i < nCount; ++i ) {
+                    if ( nMode == seek_key && cmp( arrKeys[i], seekKey ) < 0 )
+                        continue;
+                    if ( nMode == seek_key_strict && cmp( arrKeys[i], seekKey ) <= 0 )
+                        continue;
+                    if ( !f( arrKeys[i], arrValues[i] ))
+                        return;
+                }
+
+                if ( !bNext )
+                    return;
+
+                // the next leaf contains the keys greater than the upper bound of the current leaf
+                seekKey = upperBound;
+                nMode = seek_key_strict;
+            }
+        }
+
+        template <typename Func>
+        size_t check_node( node * pNode, size_t nLevel, key_type const * pLow, key_type const * pHigh, Func& f, bool& bConsistent ) const
+        {
+            key_comparator cmp;
+            uint32_t const nCount = pNode->count();
+
+            for ( uint32_t i = 0; i < nCount; ++i ) {
+                if ( i > 0 && cmp( pNode->m_arrKeys[i - 1], pNode->m_arrKeys[i] ) >= 0 )
+                    bConsistent = false;
+                if ( pLow && cmp( pNode->m_arrKeys[i], *pLow ) <= 0 )
+                    bConsistent = false;
+                if ( pHigh && cmp( pNode->m_arrKeys[i], *pHigh ) > 0 )
+                    bConsistent = false;
+            }
+
+            if ( pNode->m_bLeaf )
+                return 1;
+
+            inner_node * pInner = static_cast<inner_node *>( pNode );
+            size_t hFirst = 0;
+            for ( uint32_t i = 0; i <= nCount; ++i ) {
+                size_t h = check_node( pInner->child( i ), nLevel + 1,
+                    i > 0 ? &pNode->m_arrKeys[i - 1] : pLow,
+                    i < nCount ? &pNode->m_arrKeys[i] : pHigh,
+                    f, bConsistent );
+                if ( i == 0 )
+                    hFirst = h;
+                else if ( h != hFirst ) {
+                    f( nLevel, hFirst, h );
+                    bConsistent = false;
+                }
+            }
+            return hFirst + 1;
+        }
+
+        void unsafe_clear( node * pNode )
+        {
+            if ( pNode->m_bLeaf ) {
+                leaf_node * pLeaf = static_cast<leaf_node *>( pNode );
+                for ( uint32_t i = 0, nCount = pLeaf->count(); i < nCount; ++i )
+                    value_disposer()( pLeaf->value( i ));
+            }
+            else {
+                inner_node * pInner = static_cast<inner_node *>( pNode );
+                for ( uint32_t i = 0, nCount = pInner->count(); i <= nCount; ++i )
+                    unsafe_clear( pInner->child( i ));
+            }
+            free_node( pNode );
+        }
+        //@endcond
+    };
+
+}} // namespace cds::container
+
+#endif // #ifndef CDSLIB_CONTAINER_BPLUS_TREE_MAP_RCU_H
@@ -150,6 +150,7 @@ namespace cds { namespace container {
         static CDS_CONSTEXPR const bool c_bExtractLockExternal = base_class::c_bExtractLockExternal;
 
         typedef typename base_class::rcu_lock   rcu_lock;  ///< RCU scoped lock
+        typedef typename base_class::rcu_batch_lock rcu_batch_lock; ///< RCU batch lock for a sequence of lookups
 
         /// Returned pointer to \p mapped_type of extracted node
         typedef typename base_class::exempt_ptr exempt_ptr;
@@ -634,6 +635,30 @@ namespace cds { namespace container {
             return base_class::contains( key );
         }
 
+        /// Checks whether the map contains \p key, batch version
+        /**
+            The function does not lock RCU: the caller holds the batch lock \p bl
+            that covers a sequence of lookups.
+            Before searching the function calls <tt>bl.step()</tt> that can leave RCU critical section
+            for a moment if some thread is waiting in \p synchronize().
+        */
+        template <typename K>
+        bool contains( rcu_batch_lock& bl, K const& key )
+        {
+            return base_class::contains( bl, key );
+        }
+
+        /// Finds the key \p key, batch version
+        /**
+            The function is an analog of \p find(K const&, Func) but it does not lock RCU,
+            see \p contains( rcu_batch_lock&, K const& ).
+        */
+        template <typename K, typename Func>
+        bool find( rcu_batch_lock& bl, K const& key, Func f )
+        {
+            return base_class::find( bl, key, f );
+        }
+
         /// Checks whether the map contains \p key using \p pred predicate for searching
         /**
             The function is similar to <tt>contains( key )</tt> but \p pred is used for key comparing.
@@ -646,6 +671,40 @@ namespace cds { namespace container {
             return base_class::contains( key, pred );
         }
 
+        /// Calls \p f for each item with key in range <tt>[lo, hi)</tt> in ascending key order
+        /**
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( key_type const& key, mapped_type& val );
+            };
+            \endcode
+
+            The scan is performed inside a single RCU read-side critical section and is validated
+            by node version numbers, see \ref cds_container_BronsonAVLTreeMap_rcu_ptr_for_each_in_range "for_each_in_range()"
+            of the pointer-based map for details. The functor is called without node-level lock
+            and must not modify the map.
+
+            The function applies RCU lock internally.
+        */
+        template <typename K, typename Func>
+        void for_each_in_range( K const& lo, K const& hi, Func f )
+        {
+            base_class::for_each_in_range( lo, hi, f );
+        }
+
+        /// Calls \p f for each item of the map in ascending key order
+        /**
+            The function is an analog of \p for_each_in_range() that visits the whole map.
+
+            The function applies RCU lock internally.
+        */
+        template <typename Func>
+        void for_each( Func f )
+        {
+            base_class::for_each( f );
+        }
+
         /// Clears the map
         void clear()
         {
@@ -144,7 +144,9 @@ namespace cds { namespace container {
             set may temporarily hold more than \p THRESHOLD but never more than \p PROBE_SET items.
 
             In current implementation, a probe set can be defined either as a (single-linked) list
-            or as a fixed-sized vector, optionally ordered.
+            or as a fixed-sized vector, optionally ordered, or as a bucket with inline hash fingerprints
+            (\p cuckoo::bucketized) that is filled up to its capacity; when all buckets of an item are full,
+            a short displacement path is searched before resizing.
 
             In description above two-table cuckoo hashing (<tt>k = 2</tt>) has been considered.
             We can generalize this approach for <tt>k >= 2</tt> when we have \p k hash functions
@@ -423,9 +425,10 @@ namespace cds { namespace container {
 
             Probe set size:
             - \ref c_nDefaultProbesetSize if \p probeset_type is \p cuckoo::list
-            - \p Capacity if \p probeset_type is <tt> cuckoo::vector<Capacity> </tt>
+            - \p Capacity if \p probeset_type is <tt> cuckoo::vector<Capacity> </tt> or <tt> cuckoo::bucketized<Capacity> </tt>
 
-            Probe set threshold = probe set size - 1
+            Probe set threshold = probe set size - 1; for <tt> cuckoo::bucketized<Capacity> </tt>
+            the threshold is equal to \p Capacity
         */
         CuckooSet()
         {}
@@ -620,7 +623,7 @@ namespace cds { namespace container {
         {
             node_type * pNode = base_class::erase( key );
             if ( pNode ) {
-                free_node( pNode );
+                base_class::template dispose_erased<node_disposer>( pNode );
                 return true;
             }
             return false;
@@ -640,7 +643,7 @@ namespace cds { namespace container {
             CDS_UNUSED( pred );
             node_type * pNode = base_class::erase_with( key, typename maker::template predicate_wrapper<Predicate, bool>() );
             if ( pNode ) {
-                free_node( pNode );
+                base_class::template dispose_erased<node_disposer>( pNode );
                 return true;
             }
             return false;
@@ -667,7 +670,7 @@ namespace cds { namespace container {
             node_type * pNode = base_class::erase( key );
             if ( pNode ) {
                 f( pNode->m_val );
-                free_node( pNode );
+                base_class::template dispose_erased<node_disposer>( pNode );
                 return true;
             }
             return false;
@@ -688,7 +691,7 @@ namespace cds { namespace container {
             node_type * pNode = base_class::erase_with( key, typename maker::template predicate_wrapper<Predicate, bool>() );
             if ( pNode ) {
                 f( pNode->m_val );
-                free_node( pNode );
+                base_class::template dispose_erased<node_disposer>( pNode );
                 return true;
             }
             return false;
@@ -761,7 +764,7 @@ namespace cds { namespace container {
         template <typename Q>
         bool contains( Q const& key )
         {
-            return base_class::find( key, [](node_type&, Q const&) {});
+            return base_class::contains( key );
         }
         //@cond
         template <typename Q>
@@ -782,7 +785,7 @@ namespace cds { namespace container {
         bool contains( Q const& key, Predicate pred )
         {
             CDS_UNUSED( pred );
-            return base_class::find_with( key, typename maker::template predicate_wrapper<Predicate, bool>(), [](node_type&, Q const&) {});
+            return base_class::contains( key, typename maker::template predicate_wrapper<Predicate, bool>());
         }
         //@cond
         template <typename Q, typename Predicate>
@@ -0,0 +1,242 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#ifndef CDSLIB_CONTAINER_DETAILS_BLOCK_SPLIT_LIST_BASE_H
+#define CDSLIB_CONTAINER_DETAILS_BLOCK_SPLIT_LIST_BASE_H
+
+#include <cds/opt/compare.h>
+#include <cds/intrusive/details/split_list_base.h>
+
+namespace cds { namespace container {
+
+    /// \p BlockSplitListMap related definitions
+    /** @ingroup cds_nonintrusive_helper
+    */
+    namespace block_split_list {
+
+        /// Selector of bucket table implementation - typedef for \p intrusive::split_list::dynamic_bucket_table
+        template <bool Value>
+        using dynamic_bucket_table = cds::intrusive::split_list::dynamic_bucket_table<Value>;
+
+        /// Option specifying the count of items in a block after that the block is split
+        /**
+            @copydetails traits::block_capacity
+        */
+        template <size_t Capacity>
+        struct block_capacity {
+            //@cond
+            template <typename Base> struct pack: public Base
+            {
+                enum { block_capacity = Capacity };
+            };
+            //@endcond
+        };
+
+        /// \p BlockSplitListMap internal statistics
+        template <typename EventCounter = cds::atomicity::event_counter>
+        struct stat {
+            typedef EventCounter event_counter ; ///< Event counter type
+
+            event_counter   m_nInsertSuccess;       ///< Number of success \p insert() operations
+            event_counter   m_nInsertFailed;        ///< Number of failed \p insert() operations
+            event_counter   m_nInsertRetry;         ///< Number of attempts to insert the item again since the block has been changed concurrently
+            event_counter   m_nUpdateNew;           ///< Number of new item inserted for \p update()
+            event_counter   m_nUpdateExisting;      ///< Number of existing item updates
+            event_counter   m_nUpdateFailed;        ///< Number of failed \p update() call
+            event_counter   m_nEraseSuccess;        ///< Number of successful \p erase() and \p extract() operations
+            event_counter   m_nEraseFailed;         ///< Number of failed \p erase() and \p extract() operations
+            event_counter   m_nEraseRetry;          ///< Number of attempts to erase the item again since the block has been changed concurrently
+            event_counter   m_nFindSuccess;         ///< Number of successful \p find(), \p contains() and \p get() operations
+            event_counter   m_nFindFailed;          ///< Number of failed \p find(), \p contains() and \p get() operations
+            event_counter   m_nSearchRetry;         ///< Number of search restarts since the node traversed has been changed
+            event_counter   m_nBlockSplit;          ///< Number of full blocks split into two nodes
+            event_counter   m_nNodeFrozen;          ///< Number of underfull nodes frozen for merging
+            event_counter   m_nNodeMerged;          ///< Number of frozen nodes merged into the predecessor
+            event_counter   m_nNodeMergeFailed;     ///< Number of failed attempts to merge the frozen node
+            event_counter   m_nNewBucket;           ///< Number of new bucket head nodes linked
+            event_counter   m_nInitBucketRecursive; ///< Number of recursive bucket initializations
+            event_counter   m_nInitBucketContention;///< Number of bucket init contentions
+
+            //@cond
+            void onInsertSuccess()          { ++m_nInsertSuccess;       }
+            void onInsertFailed()           { ++m_nInsertFailed;        }
+            void onInsertRetry()            { ++m_nInsertRetry;         }
+            void onUpdateNew()              { ++m_nUpdateNew;           }
+            void onUpdateExisting()         { ++m_nUpdateExisting;      }
+            void onUpdateFailed()           { ++m_nUpdateFailed;        }
+            void onEraseSuccess()           { ++m_nEraseSuccess;        }
+            void onEraseFailed()            { ++m_nEraseFailed;         }
+            void onEraseRetry()             { ++m_nEraseRetry;          }
+            void onFindSuccess()            { ++m_nFindSuccess;         }
+            void onFindFailed()             { ++m_nFindFailed;          }
+            void onSearchRetry()            { ++m_nSearchRetry;         }
+            void onBlockSplit()             { ++m_nBlockSplit;          }
+            void onNodeFrozen()             { ++m_nNodeFrozen;          }
+            void onNodeMerged()             { ++m_nNodeMerged;          }
+            void onNodeMergeFailed()        { ++m_nNodeMergeFailed;     }
+            void onNewBucket()              { ++m_nNewBucket;           }
+            void onRecursiveInitBucket()    { ++m_nInitBucketRecursive; }
+            void onBucketInitContenton()    { ++m_nInitBucketContention;}
+            //@endcond
+        };
+
+        /// \p BlockSplitListMap empty internal statistics
+        struct empty_stat {
+            //@cond
+            void onInsertSuccess()          const {}
+            void onInsertFailed()           const {}
+            void onInsertRetry()            const {}
+            void onUpdateNew()              const {}
+            void onUpdateExisting()         const {}
+            void onUpdateFailed()           const {}
+            void onEraseSuccess()           const {}
+            void onEraseFailed()            const {}
+            void onEraseRetry()             const {}
+            void onFindSuccess()            const {}
+            void onFindFailed()             const {}
+            void onSearchRetry()            const {}
+            void onBlockSplit()             const {}
+            void onNodeFrozen()             const {}
+            void onNodeMerged()             const {}
+            void onNodeMergeFailed()        const {}
+            void onNewBucket()              const {}
+            void onRecursiveInitBucket()    const {}
+            void onBucketInitContenton()    const {}
+            //@endcond
+        };
+
+        /// \p BlockSplitListMap traits
+        struct traits
+        {
+            /// Hash function
+            /**
+                Hash function converts the key of the map into hash value of type \p size_t.
+                By default, \p std::hash is used.
+            */
+            typedef opt::none                       hash;
+
+            /// Key comparison functor
+            /**
+                The items with equal hash value are ordered in a block by the key.
+                No default functor is provided. If the option is not specified, the \p less is used.
+            */
+            typedef opt::none                       compare;
+
+            /// Specifies binary predicate used for key compare.
+            /**
+                Default is \p std::less<Key>.
+            */
+            typedef opt::none                       less;
+
+            /// Item counter
+            /**
+                As for \p SplitListSet, the item counter is used to grow the bucket table and
+                \p empty() depends on it, so \p cds::atomicity::empty_item_counter is not allowed.
+
+                Default is \p cds::atomicity::item_counter.
+            */
+            typedef cds::atomicity::item_counter    item_counter;
+
+            /// Allocator for items, nodes, blocks and the bucket table
+            typedef CDS_DEFAULT_ALLOCATOR           allocator;
+
+            /// C++ memory ordering model
+            /**
+                Can be \p opt::v::relaxed_ordering (relaxed memory model, the default)
+                or \p opt::v::sequential_consistent (sequentially consisnent memory model).
+            */
+            typedef opt::v::relaxed_ordering        memory_model;
+
+            /// Back-off strategy, default is \p cds::backoff::Default
+            typedef cds::backoff::Default           back_off;
+
+            /// Internal statistics, by default disabled. To enable, use \p block_split_list::stat
+            typedef empty_stat                      stat;
+
+            /// What type of bucket table is used
+            /**
+                See \p split_list::traits::dynamic_bucket_table. Default is \p true.
+            */
+            static const bool dynamic_bucket_table = true;
+
+            /// Count of items in a block after that the block is split, default is 16
+            /**
+                A node of the split-ordered list keeps a sorted block of (reversed hash, item pointer) pairs.
+                When an item is being inserted into a block of \p block_capacity items or more,
+                the block is split in halves and the upper half is moved to a new node.
+                Any change of a block copies it, so the reasonable values are 8 to 32.
+                The items with equal hash value are never separated, so a block can be larger
+                than \p block_capacity if the hash function produces many collisions.
+
+                Use \p block_split_list::block_capacity option setter to change the capacity.
+                The capacity must be at least 4.
+            */
+            enum { block_capacity = 16 };
+        };
+
+        /// Metafunction converting option list to \p BlockSplitListMap traits
+        /**
+            \p Options are:
+            - \p opt::hash - mandatory option, specifies hash functor.
+            - \p opt::compare - key comparison functor. No default functor is provided.
+                If the option is not specified, the \p opt::less is used.
+            - \p opt::less - specifies binary predicate used for key comparison. Default is \p std::less<Key>.
+            - \p opt::item_counter - the type of item counting feature. Default is \p atomicity::item_counter.
+            - \p opt::allocator - allocator for items, nodes, blocks and the bucket table. Default is \ref CDS_DEFAULT_ALLOCATOR.
+            - \p opt::memory_model - C++ memory ordering model. Can be \p opt::v::relaxed_ordering (relaxed memory model, the default)
+                or \p opt::v::sequential_consistent (sequentially consisnent memory model).
+            - \p opt::back_off - back-off strategy used. If the option is not specified, the \p cds::backoff::Default is used.
+            - \p block_split_list::dynamic_bucket_table - use dynamic or static bucket table implementation.
+            - \p block_split_list::block_capacity - count of items in a block after that the block is split. Default is 16.
+            - \p opt::stat - internal statistics. Available types: \p block_split_list::stat, \p block_split_list::empty_stat (the default)
+        */
+        template <typename... Options>
+        struct make_traits {
+#   ifdef CDS_DOXYGEN_INVOKED
+            typedef implementation_defined type ;   ///< Metafunction result
+#   else
+            typedef typename cds::opt::make_options<
+                typename cds::opt::find_type_traits< traits, Options... >::type
+                ,Options...
+            >::type   type;
+#   endif
+        };
+
+    } // namespace block_split_list
+
+    //@cond
+    // Forward declaration
+    template <class GC, typename Key, typename T, class Traits = block_split_list::traits >
+    class BlockSplitListMap;
+    //@endcond
+
+}} // namespace cds::container
+
+#endif // #ifndef CDSLIB_CONTAINER_DETAILS_BLOCK_SPLIT_LIST_BASE_H
@@ -0,0 +1,266 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#ifndef CDSLIB_CONTAINER_DETAILS_BPLUS_TREE_BASE_H
+#define CDSLIB_CONTAINER_DETAILS_BPLUS_TREE_BASE_H
+
+#include <cds/container/details/base.h>
+#include <cds/opt/compare.h>
+#include <cds/urcu/options.h>
+#include <cds/algo/backoff_strategy.h>
+
+namespace cds { namespace container {
+
+    /// BPlusTreeMap related declarations
+    namespace bplus_tree {
+
+        /// Option specifying the max count of keys in a tree node
+        /**
+            @copydetails traits::node_capacity
+        */
+        template <size_t Capacity>
+        struct node_capacity {
+            //@cond
+            template <typename Base> struct pack: public Base
+            {
+                enum { node_capacity = Capacity };
+            };
+            //@endcond
+        };
+
+        /// BPlusTreeMap internal statistics
+        template <typename Counter = cds::atomicity::event_counter>
+        struct stat {
+            typedef Counter   event_counter; ///< Event counter type
+
+            event_counter   m_nFindSuccess;     ///< Count of success \p find() call
+            event_counter   m_nFindFailed;      ///< Count of failed \p find() call
+            event_counter   m_nFindRetry;       ///< Count of restarts of the search from the root during \p find()
+            event_counter   m_nInsertSuccess;   ///< Count of inserting new item
+            event_counter   m_nInsertFailed;    ///< Count of insert failures (the key already exists)
+            event_counter   m_nUpdateSuccess;   ///< Count of updating existing item
+            event_counter   m_nUpdateFailed;    ///< Count of \p update() failures (the key is not found and the inserting is disabled)
+            event_counter   m_nUpdateRetry;     ///< Count of restarts from the root during \p insert() or \p update()
+            event_counter   m_nRemoveSuccess;   ///< Count of successfully \p erase() call
+            event_counter   m_nRemoveFailed;    ///< Count of failed \p erase() call
+            event_counter   m_nRemoveRetry;     ///< Count of restarts from the root during \p erase() or \p extract()
+            event_counter   m_nExtractSuccess;  ///< Count of successfully \p extract() call
+            event_counter   m_nExtractFailed;   ///< Count of failed \p extract() call
+            event_counter   m_nLeafSplit;       ///< Count of leaf node splits
+            event_counter   m_nInnerSplit;      ///< Count of inner node splits
+            event_counter   m_nHeightIncrease;  ///< Count of root splits, i.e. how many times the tree has grown in height
+            event_counter   m_nLeafMerge;       ///< Count of leaf node merges
+            event_counter   m_nInnerMerge;      ///< Count of inner node merges
+            event_counter   m_nMergeFailed;     ///< Count of refused merges since the neighbour is locked or too full
+            event_counter   m_nHeightDecrease;  ///< Count of root collapses, i.e. how many times the tree has lost a level
+            event_counter   m_nDisposedNode;    ///< Count of disposed node
+            event_counter   m_nDisposedValue;   ///< Count of disposed value
+            event_counter   m_nExtractedValue;  ///< Count of extracted value
+            event_counter   m_nRangeScan;       ///< Count of \p for_each() and \p for_each_in_range() calls
+            event_counter   m_nRangeRestart;    ///< Count of leaf re-reads during a range scan caused by concurrent modifications
+
+            //@cond
+            void onFindSuccess()        { ++m_nFindSuccess;     }
+            void onFindFailed()         { ++m_nFindFailed;      }
+            void onFindRetry()          { ++m_nFindRetry;       }
+            void onInsertSuccess()      { ++m_nInsertSuccess;   }
+            void onInsertFailed()       { ++m_nInsertFailed;    }
+            void onUpdateSuccess()      { ++m_nUpdateSuccess;   }
+            void onUpdateFailed()       { ++m_nUpdateFailed;    }
+            void onUpdateRetry()        { ++m_nUpdateRetry;     }
+            void onRemove( bool bSuccess )
+            {
+                if ( bSuccess )
+                    ++m_nRemoveSuccess;
+                else
+                    ++m_nRemoveFailed;
+            }
+            void onRemoveRetry()        { ++m_nRemoveRetry;     }
+            void onExtract( bool bSuccess )
+            {
+                if ( bSuccess )
+                    ++m_nExtractSuccess;
+                else
+                    ++m_nExtractFailed;
+            }
+            void onLeafSplit()          { ++m_nLeafSplit;       }
+            void onInnerSplit()         { ++m_nInnerSplit;      }
+            void onHeightIncrease()     { ++m_nHeightIncrease;  }
+            void onLeafMerge()          { ++m_nLeafMerge;       }
+            void onInnerMerge()         { ++m_nInnerMerge;      }
+            void onMergeFailed()        { ++m_nMergeFailed;     }
+            void onHeightDecrease()     { ++m_nHeightDecrease;  }
+            void onDisposeNode()        { ++m_nDisposedNode;    }
+            void onDisposeValue()       { ++m_nDisposedValue;   }
+            void onExtractValue()       { ++m_nExtractedValue;  }
+            void onRangeScan()          { ++m_nRangeScan;       }
+            void onRangeRestart()       { ++m_nRangeRestart;    }
+            //@endcond
+        };
+
+        /// BPlusTreeMap empty statistics
+        struct empty_stat {
+            //@cond
+            void onFindSuccess()        const {}
+            void onFindFailed()         const {}
+            void onFindRetry()          const {}
+            void onInsertSuccess()      const {}
+            void onInsertFailed()       const {}
+            void onUpdateSuccess()      const {}
+            void onUpdateFailed()       const {}
+            void onUpdateRetry()        const {}
+            void onRemove( bool /*bSuccess*/ ) const {}
+            void onRemoveRetry()        const {}
+            void onExtract( bool /*bSuccess*/ ) const {}
+            void onLeafSplit()          const {}
+            void onInnerSplit()         const {}
+            void onHeightIncrease()     const {}
+            void onLeafMerge()          const {}
+            void onInnerMerge()         const {}
+            void onMergeFailed()        const {}
+            void onHeightDecrease()     const {}
+            void onDisposeNode()        const {}
+            void onDisposeValue()       const {}
+            void onExtractValue()       const {}
+            void onRangeScan()          const {}
+            void onRangeRestart()       const {}
+            //@endcond
+        };
+
+        /// BPlusTreeMap traits
+        struct traits
+        {
+            /// Key comparison functor
+            /**
+                No default functor is provided. If the option is not specified, the \p less is used.
+
+                See \p cds::opt::compare option description for functor interface.
+
+                You should provide \p compare or \p less functor.
+            */
+            typedef opt::none                       compare;
+
+            /// Specifies binary predicate used for key compare.
+            /**
+                See \p cds::opt::less option description for predicate interface.
+
+                You should provide \p compare or \p less functor.
+            */
+            typedef opt::none                       less;
+
+            /// Allocator for tree nodes
+            typedef CDS_DEFAULT_ALLOCATOR           node_allocator;
+
+            /// Allocator for values
+            typedef CDS_DEFAULT_ALLOCATOR           allocator;
+
+            /// Max count of keys in a tree node, default is 64
+            /**
+                A leaf node keeps up to \p node_capacity sorted keys with the pointers to their values,
+                an inner node keeps up to \p node_capacity separator keys and <tt>node_capacity + 1</tt> children.
+                The full node is split in halves; the node that has lost three quarters of its keys
+                is merged with its neighbour if the result fits in three quarters of the node.
+                Reasonable values are from 16 to 256: large nodes reduce the tree height and the memory
+                overhead per key, but an insertion or an erasure shifts the half of the node in average
+                and invalidates optimistic readers of the node.
+
+                Use \p bplus_tree::node_capacity option setter to change the capacity.
+                The capacity must be at least 4.
+            */
+            enum { node_capacity = 64 };
+
+            /// Item counter
+            /**
+                The type for item counter, by default it is disabled (\p atomicity::empty_item_counter).
+                To enable it use \p atomicity::item_counter
+            */
+            typedef atomicity::empty_item_counter     item_counter;
+
+            /// C++ memory ordering model
+            /**
+                List of available memory ordering see \p opt::memory_model
+            */
+            typedef opt::v::relaxed_ordering        memory_model;
+
+            /// Internal statistics
+            /**
+                By default, internal statistics is disabled (\p bplus_tree::empty_stat).
+                To enable it use \p bplus_tree::stat.
+            */
+            typedef empty_stat                      stat;
+
+            /// Back-off strategy used to wait until a locked node is released
+            typedef cds::backoff::Default           back_off;
+
+            /// RCU deadlock checking policy
+            /**
+                List of available options see \p opt::rcu_check_deadlock
+            */
+            typedef cds::opt::v::rcu_throw_deadlock      rcu_check_deadlock;
+        };
+
+        /// Metafunction converting option list to BPlusTreeMap traits
+        /**
+            \p Options are:
+            - \p opt::compare - key compare functor. No default functor is provided.
+                If the option is not specified, \p %opt::less is used.
+            - \p opt::less - specifies binary predicate used for key compare. At least \p %opt::compare or \p %opt::less should be defined.
+            - \p opt::node_allocator - the allocator for tree nodes. Default is \ref CDS_DEFAULT_ALLOCATOR.
+            - \p opt::allocator - the allocator for values. Default is \ref CDS_DEFAULT_ALLOCATOR.
+            - \p bplus_tree::node_capacity - max count of keys in a tree node. Default is 64.
+            - \p opt::item_counter - the type of item counting feature, by default it is disabled (\p atomicity::empty_item_counter)
+                To enable it use \p atomicity::item_counter
+            - \p opt::memory_model - C++ memory ordering model. Can be \p opt::v::relaxed_ordering (relaxed memory model, the default)
+                or \p opt::v::sequential_consistent (sequentially consisnent memory model).
+            - \p opt::stat - internal statistics, by default it is disabled (\p bplus_tree::empty_stat)
+                To enable statistics use \p bplus_tree::stat
+            - \p opt::back_off - back-off strategy, by default \p cds::backoff::Default is used
+            - \p opt::rcu_check_deadlock - a deadlock checking policy for RCU-based tree, default is \p opt::v::rcu_throw_deadlock
+        */
+        template <typename... Options>
+        struct make_traits {
+#   ifdef CDS_DOXYGEN_INVOKED
+            typedef implementation_defined type ;   ///< Metafunction result
+#   else
+            typedef typename cds::opt::make_options<
+                typename cds::opt::find_type_traits< traits, Options... >::type
+                ,Options...
+            >::type   type;
+#   endif
+        };
+    } // namespace bplus_tree
+
+    // Forwards
+    template < class GC, typename Key, typename T, class Traits = bplus_tree::traits >
+    class BPlusTreeMap;
+
+}} // namespace cds::container
+
+#endif // #ifndef CDSLIB_CONTAINER_DETAILS_BPLUS_TREE_BASE_H
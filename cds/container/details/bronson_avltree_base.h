@@ -250,6 +250,9 @@ namespace cds { namespace container {
             event_counter   m_nInsertRebalanceReq;  ///< Count of rebalance required after inserting
             event_counter   m_nRemoveRebalanceReq;  ///< Count of rebalance required after removing
 
+            event_counter   m_nRangeScan;           ///< Count of \p for_each() and \p for_each_in_range() calls
+            event_counter   m_nRangeRestart;        ///< Count of range scan restarts from the root caused by concurrent rotations
+
             //@cond
             void onFindSuccess()        { ++m_nFindSuccess      ; }
             void onFindFailed()         { ++m_nFindFailed       ; }
@@ -307,6 +310,9 @@ namespace cds { namespace container {
 
             void onInsertRebalanceRequired() { ++m_nInsertRebalanceReq; }
             void onRemoveRebalanceRequired() { ++m_nRemoveRebalanceReq; }
+
+            void onRangeScan()              { ++m_nRangeScan; }
+            void onRangeRestart()           { ++m_nRangeRestart; }
             //@endcond
         };
 
@@ -357,6 +363,9 @@ namespace cds { namespace container {
 
             void onInsertRebalanceRequired() const {}
             void onRemoveRebalanceRequired() const {}
+
+            void onRangeScan()              const {}
+            void onRangeRestart()           const {}
             //@endcond
         };
 
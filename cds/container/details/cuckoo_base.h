@@ -55,6 +55,14 @@ namespace cds { namespace container {
         using intrusive::cuckoo::refinable;
 #endif
 
+#ifdef CDS_DOXYGEN_INVOKED
+        /// Lock striping concurrent access policy with optimistic lookups. This is typedef for intrusive::cuckoo::optimistic_striping template
+        class optimistic_striping
+        {};
+#else
+        using intrusive::cuckoo::optimistic_striping;
+#endif
+
 #ifdef CDS_DOXYGEN_INVOKED
         /// Striping internal statistics. This is typedef for intrusive::cuckoo::striping_stat
         class striping_stat
@@ -139,6 +147,7 @@ namespace cds { namespace container {
 
         using intrusive::cuckoo::list;
         using intrusive::cuckoo::vector;
+        using intrusive::cuckoo::bucketized;
 
         /// Type traits for CuckooSet and CuckooMap classes
         struct traits
@@ -167,6 +176,7 @@ namespace cds { namespace container {
                 Available opt::mutex_policy types:
                 - cuckoo::striping - simple, but the lock array is not resizable
                 - cuckoo::refinable - resizable lock array, but more complex access to set data.
+                - cuckoo::optimistic_striping - lock striping with lookups without locking, \p cuckoo::bucketized probeset only.
 
                 Default is cuckoo::striping.
             */
@@ -202,6 +212,7 @@ namespace cds { namespace container {
             /// Allocator type
             /**
                 The allocator type for allocating bucket tables.
+                The bucket tables of \p cuckoo::bucketized probeset are allocated by \p CDS_DEFAULT_ALIGNED_ALLOCATOR.
                 Default is \p CDS_DEFAULT_ALLOCATOR that is \p std::allocator
             */
             typedef CDS_DEFAULT_ALLOCATOR       allocator;
@@ -230,7 +241,7 @@ namespace cds { namespace container {
                 The hash functors are passed as <tt> std::tuple< H1, H2, ... Hn > </tt>. The number of hash functors specifies
                 the number \p k - the count of hash tables in cuckoo hashing.
             - \p opt::mutex_policy - concurrent access policy.
-                Available policies: \p cuckoo::striping, \p cuckoo::refinable.
+                Available policies: \p cuckoo::striping, \p cuckoo::refinable, \p cuckoo::optimistic_striping.
                 Default is \p %cuckoo::striping.
             - \p opt::equal_to - key equality functor like \p std::equal_to.
                 If this functor is defined then the probe-set will be unordered.
@@ -251,7 +262,8 @@ namespace cds { namespace container {
                 the unordered container will store the calculated hash value in the node and rehashing operations won't need
                 to recalculate the hash of the value. This option will improve the performance of unordered containers
                 when rehashing is frequent or hashing the value is a slow operation. Default value is \p false.
-            - \ref intrusive::cuckoo::probeset_type "cuckoo::probeset_type" - type of probe set, may be \p cuckoo::list or <tt>cuckoo::vector<Capacity></tt>,
+            - \ref intrusive::cuckoo::probeset_type "cuckoo::probeset_type" - type of probe set, may be \p cuckoo::list, <tt>cuckoo::vector<Capacity></tt>
+                or <tt>cuckoo::bucketized<Capacity></tt>,
                 Default is \p cuckoo::list.
             - \p opt::stat - internal statistics. Possibly types: \p cuckoo::stat, \p cuckoo::empty_stat.
                 Default is \p %cuckoo::empty_stat
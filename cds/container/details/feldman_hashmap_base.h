@@ -54,6 +54,20 @@ namespace cds { namespace container {
         /// \p FeldmanHashMap level statistics
         typedef cds::intrusive::feldman_hashset::level_statistics level_statistics;
 
+        /// Dense array node layout, see \p cds::intrusive::feldman_hashset::dense_layout
+        typedef cds::intrusive::feldman_hashset::dense_layout dense_layout;
+
+        /// Compressed array node layout, see \p cds::intrusive::feldman_hashset::compressed_layout
+        typedef cds::intrusive::feldman_hashset::compressed_layout compressed_layout;
+
+        /// Array node layout option, see \p cds::intrusive::feldman_hashset::node_layout
+        template <typename Layout>
+        using node_layout = cds::intrusive::feldman_hashset::node_layout< Layout >;
+
+        /// Head node growth option, see \p cds::intrusive::feldman_hashset::head_growth
+        template <bool Enable>
+        using head_growth = cds::intrusive::feldman_hashset::head_growth< Enable >;
+
         /// \p FeldmanHashMap traits
         struct traits
         {
@@ -152,6 +166,18 @@ namespace cds { namespace container {
             */
             typedef CDS_DEFAULT_ALLOCATOR node_allocator;
 
+            /// Array node layout
+            /**
+                @copydetails cds::intrusive::feldman_hashset::traits::node_layout
+            */
+            typedef dense_layout node_layout;
+
+            /// Enables online growth of the head node
+            /**
+                @copydetails cds::intrusive::feldman_hashset::traits::head_growth
+            */
+            static const bool head_growth = false;
+
             /// C++ memory ordering model
             /**
                 @copydetails cds::intrusive::feldman_hashset::traits::memory_model
@@ -183,6 +209,9 @@ namespace cds { namespace container {
                 @copydetails traits::allocator
             - \p opt::node_allocator - array node allocator.
                 @copydetails traits::node_allocator
+            - \p feldman_hashmap::node_layout - array node layout, \p feldman_hashmap::dense_layout (the default)
+                or \p feldman_hashmap::compressed_layout.
+            - \p feldman_hashmap::head_growth - enables online growth of the head node, default is \p false.
             - \p opt::compare - hash comparison functor. No default functor is provided.
                 If the option is not specified, the \p opt::less is used.
             - \p opt::less - specifies binary predicate used for hash comparison.
@@ -0,0 +1,295 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#ifndef CDSLIB_CONTAINER_DETAILS_FLAT_HASHMAP_BASE_H
+#define CDSLIB_CONTAINER_DETAILS_FLAT_HASHMAP_BASE_H
+
+#include <functional>   // std::equal_to
+#include <cds/container/details/base.h>
+#include <cds/opt/hash.h>
+#include <cds/algo/atomic.h>
+#include <cds/algo/bitop.h>
+#include <cds/algo/backoff_strategy.h>
+#include <cds/urcu/details/base.h>
+#include <cds/details/aligned_allocator.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || ( defined(_M_IX86_FP) && _M_IX86_FP >= 2 )
+#   include <emmintrin.h>
+#   define CDS_FLAT_HASHMAP_SSE2
+#endif
+
+namespace cds { namespace container {
+
+    /// \p FlatHashMap related definitions
+    /** @ingroup cds_nonintrusive_helper
+    */
+    namespace flat_hashmap {
+
+        /// \p FlatHashMap internal statistics
+        template <typename EventCounter = cds::atomicity::event_counter>
+        struct stat {
+            typedef EventCounter event_counter ; ///< Event counter type
+
+            event_counter   m_nInsertSuccess;   ///< Number of success \p insert() operations
+            event_counter   m_nInsertFailed;    ///< Number of failed \p insert() operations
+            event_counter   m_nUpdateNew;       ///< Number of new item inserted for \p update()
+            event_counter   m_nUpdateExisting;  ///< Number of existing item updates
+            event_counter   m_nUpdateFailed;    ///< Number of failed \p update() call
+            event_counter   m_nEraseSuccess;    ///< Number of successful \p erase() operations
+            event_counter   m_nEraseFailed;     ///< Number of failed \p erase() operations
+            event_counter   m_nFindSuccess;     ///< Number of successful \p find() and \p contains() operations
+            event_counter   m_nFindFailed;      ///< Number of failed \p find() and \p contains() operations
+            event_counter   m_nReadRetry;       ///< Number of optimistic group reads repeated since the group has been changed
+            event_counter   m_nLockContention;  ///< Number of back-offs on a group lock held by another writer
+            event_counter   m_nGroupMigrated;   ///< Number of groups and stashes moved to the new table by the writers
+            event_counter   m_nResize;          ///< Number of table resizing
+            event_counter   m_nStashInsert;     ///< Number of items placed into the overflow stash since both groups of the key were full
+
+            //@cond
+            void onInsertSuccess()      { ++m_nInsertSuccess;   }
+            void onInsertFailed()       { ++m_nInsertFailed;    }
+            void onUpdateNew()          { ++m_nUpdateNew;       }
+            void onUpdateExisting()     { ++m_nUpdateExisting;  }
+            void onUpdateFailed()       { ++m_nUpdateFailed;    }
+            void onEraseSuccess()       { ++m_nEraseSuccess;    }
+            void onEraseFailed()        { ++m_nEraseFailed;     }
+            void onFindSuccess()        { ++m_nFindSuccess;     }
+            void onFindFailed()         { ++m_nFindFailed;      }
+            void onReadRetry()          { ++m_nReadRetry;       }
+            void onLockContention()     { ++m_nLockContention;  }
+            void onGroupMigrated()      { ++m_nGroupMigrated;   }
+            void onResize()             { ++m_nResize;          }
+            void onStashInsert()        { ++m_nStashInsert;     }
+            //@endcond
+        };
+
+        /// \p FlatHashMap empty internal statistics
+        struct empty_stat {
+            //@cond
+            void onInsertSuccess()      const {}
+            void onInsertFailed()       const {}
+            void onUpdateNew()          const {}
+            void onUpdateExisting()     const {}
+            void onUpdateFailed()       const {}
+            void onEraseSuccess()       const {}
+            void onEraseFailed()        const {}
+            void onFindSuccess()        const {}
+            void onFindFailed()         const {}
+            void onReadRetry()          const {}
+            void onLockContention()     const {}
+            void onGroupMigrated()      const {}
+            void onResize()             const {}
+            void onStashInsert()        const {}
+            //@endcond
+        };
+
+        /// \p FlatHashMap traits
+        struct traits
+        {
+            /// Hash functor, default is \p std::hash
+            /**
+                The map mixes the hash value returned by the functor by itself,
+                so the identity hash like \p std::hash for integers is good enough.
+            */
+            typedef opt::none hash;
+
+            /// Key equality functor, default is \p std::equal_to
+            typedef opt::none equal_to;
+
+            /// Item counter, default is \p atomicity::item_counter
+            typedef cds::atomicity::item_counter item_counter;
+
+            /// Aligned allocator for the group array, default is \ref CDS_DEFAULT_ALIGNED_ALLOCATOR
+            typedef CDS_DEFAULT_ALIGNED_ALLOCATOR allocator;
+
+            /// Back-off strategy for group and stash locks and optimistic read retries
+            typedef cds::backoff::Default back_off;
+
+            /// Internal statistics, default is \p flat_hashmap::empty_stat (disabled)
+            /**
+                Use \p flat_hashmap::stat to enable it.
+            */
+            typedef empty_stat stat;
+        };
+
+        /// Metafunction converting option list to \p flat_hashmap::traits
+        /**
+            Supported \p Options are:
+            - \p opt::hash - a hash functor, default is \p std::hash
+            - \p opt::equal_to - key equality functor, default is \p std::equal_to
+            - \p opt::item_counter - item counter, default is \p atomicity::item_counter
+            - \p opt::allocator - aligned allocator for the group array, default is \ref CDS_DEFAULT_ALIGNED_ALLOCATOR
+            - \p opt::back_off - back-off strategy, default is \p cds::backoff::Default
+            - \p opt::stat - internal statistics, possible types: \p flat_hashmap::stat, \p flat_hashmap::empty_stat (the default)
+        */
+        template <typename... Options>
+        struct make_traits {
+#   ifdef CDS_DOXYGEN_INVOKED
+            typedef implementation_defined type ;   ///< Metafunction result
+#   else
+            typedef typename cds::opt::make_options<
+                typename cds::opt::find_type_traits< traits, Options... >::type
+                ,Options...
+            >::type   type;
+#   endif
+        };
+
+        //@cond
+        namespace details {
+
+            /// Count of slots in the group, equal to SSE2 register width in bytes
+            /**
+                The group is not one cache line: its tags share the first line with the version and the first slots,
+                the slots span several lines. Fewer slots per group would overflow the two-choice table earlier,
+                see \p FlatHashMap description.
+            */
+            static CDS_CONSTEXPR const size_t c_nGroupSize = 16;
+
+            /// Returns the bit mask of \p pTags[i] == \p tag for 16 tags
+            static inline uint32_t match_tags( uint8_t const * pTags, uint8_t tag )
+            {
+#   ifdef CDS_FLAT_HASHMAP_SSE2
+                __m128i tags = _mm_loadu_si128( reinterpret_cast<__m128i const *>( pTags ));
+                return static_cast<uint32_t>( _mm_movemask_epi8( _mm_cmpeq_epi8( tags, _mm_set1_epi8( static_cast<char>( tag )))));
+#   else
+                uint32_t nMask = 0;
+                for ( size_t i = 0; i < c_nGroupSize; ++i ) {
+                    if ( pTags[i] == tag )
+                        nMask |= uint32_t( 1 ) << i;
+                }
+                return nMask;
+#   endif
+            }
+
+            /// Hash finalizer: the group index is taken from low bits and the tag from high bits of the mixed hash
+            static inline uint64_t mix( uint64_t h )
+            {
+                h ^= h >> 33;
+                h *= 0xff51afd7ed558ccdULL;
+                h ^= h >> 33;
+                h *= 0xc4ceb9fe1a85ec53ULL;
+                h ^= h >> 33;
+                return h;
+            }
+
+            /// Access to the current bucket table and its next table: hazard pointer guards for HP-like GC
+            template <typename GC>
+            class table_access
+            {
+                typename GC::template GuardArray<2> m_Guards; // current table, next table
+            public:
+                template <typename T>
+                T * protect( atomics::atomic<T *> const& p )
+                {
+                    return m_Guards.protect( 0, p );
+                }
+
+                // Returns the next table of \p t or \p nullptr if \p t is not current anymore
+                template <typename T>
+                T * protect_next( T * t, atomics::atomic<T *> const& pCurrent )
+                {
+                    T * pNext = m_Guards.assign( 1, t->pNext.load( atomics::memory_order_acquire ));
+                    // While t is current its next table cannot be retired
+                    if ( pCurrent.load( atomics::memory_order_acquire ) != t )
+                        return nullptr;
+                    return pNext;
+                }
+
+                // Moves the protection to \p p returned by protect_next()
+                template <typename T>
+                T * assign( T * p )
+                {
+                    return m_Guards.assign( 0, p );
+                }
+
+                template <typename T>
+                static void retire( T * p, void (* pFunc)( T * ))
+                {
+                    GC::retire( p, pFunc );
+                }
+
+                static bool can_retire()
+                {
+                    return true;
+                }
+            };
+
+            /// Access to the current bucket table: RCU read-side critical section
+            template <typename RCU>
+            class table_access< cds::urcu::gc< RCU > >
+            {
+                typedef cds::urcu::gc< RCU > gc;
+                typename gc::scoped_lock    m_Lock;
+            public:
+                template <typename T>
+                T * protect( atomics::atomic<T *> const& p )
+                {
+                    return p.load( atomics::memory_order_acquire );
+                }
+
+                // The next table is retired after \p t, so it is alive while RCU is locked
+                template <typename T>
+                T * protect_next( T * t, atomics::atomic<T *> const& /*pCurrent*/ )
+                {
+                    return t->pNext.load( atomics::memory_order_acquire );
+                }
+
+                template <typename T>
+                T * assign( T * p )
+                {
+                    return p;
+                }
+
+                template <typename T>
+                static void retire( T * p, void (* pFunc)( T * ))
+                {
+                    gc::retire_ptr( p, pFunc );
+                }
+
+                static bool can_retire()
+                {
+                    return !gc::is_locked();
+                }
+            };
+
+        } // namespace details
+        //@endcond
+
+    } // namespace flat_hashmap
+
+    //@cond
+    // Forward declaration
+    template < class GC, typename Key, typename T, class Traits = flat_hashmap::traits >
+    class FlatHashMap;
+    //@endcond
+
+}} // namespace cds::container
+
+#endif // #ifndef CDSLIB_CONTAINER_DETAILS_FLAT_HASHMAP_BASE_H
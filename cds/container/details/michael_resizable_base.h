@@ -0,0 +1,624 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#ifndef CDSLIB_CONTAINER_DETAILS_MICHAEL_RESIZABLE_BASE_H
+#define CDSLIB_CONTAINER_DETAILS_MICHAEL_RESIZABLE_BASE_H
+
+#include <cds/container/details/michael_set_base.h>
+#include <cds/details/allocator.h>
+#include <cds/algo/backoff_strategy.h>
+
+namespace cds { namespace container {
+
+    namespace michael_set {
+
+        //@cond
+        namespace details {
+
+            /// Migration state of a bucket of resizable Michael's hash table
+            /**
+                \p nWriters word contains two flags (\p migrating, \p migrated) in low bits
+                and the count of modifying operations working in the bucket.
+                A writer may enter the bucket only if no flag is set.
+                The readers are not counted: a reader is protected by the GC of the bucket, see \p resizable_table.
+                Readers must not change the items: the migration copies them concurrently.
+            */
+            struct bucket_state
+            {
+                static CDS_CONSTEXPR const size_t migrating  = 1;
+                static CDS_CONSTEXPR const size_t migrated   = 2;
+                static CDS_CONSTEXPR const size_t writer_inc = 4;
+
+                typedef cds::backoff::Default back_off;
+
+                atomics::atomic<size_t> nWriters;
+
+                bucket_state()
+                    : nWriters( 0 )
+                {}
+
+                // Returns 0 if the writer has entered the bucket, otherwise the migration flags of the bucket
+                size_t try_enter_writer()
+                {
+                    size_t s = nWriters.load( atomics::memory_order_acquire );
+                    while ( !( s & ( migrating | migrated ))) {
+                        if ( nWriters.compare_exchange_weak( s, s + writer_inc, atomics::memory_order_acquire, atomics::memory_order_relaxed ))
+                            return 0;
+                    }
+                    return s & ( migrating | migrated );
+                }
+
+                bool enter_writer()
+                {
+                    back_off bkoff;
+                    for (;;) {
+                        size_t const s = try_enter_writer();
+                        if ( s == 0 )
+                            return true;
+                        if ( s & migrated )
+                            return false;
+                        bkoff();
+                    }
+                }
+
+                void leave_writer()
+                {
+                    nWriters.fetch_sub( writer_inc, atomics::memory_order_release );
+                }
+
+                bool is_migrated() const
+                {
+                    return ( nWriters.load( atomics::memory_order_acquire ) & migrated ) != 0;
+                }
+
+                // Stops new writers and waits while current writers leave the bucket
+                void freeze()
+                {
+                    nWriters.fetch_or( migrating, atomics::memory_order_acq_rel );
+                    back_off bkoff;
+                    while ( nWriters.load( atomics::memory_order_acquire ) != migrating )
+                        bkoff();
+                }
+
+                // Redirects all new operations to the next table
+                void seal()
+                {
+                    nWriters.store( migrating | migrated, atomics::memory_order_release );
+                }
+            };
+
+            template <typename Bucket>
+            struct has_rcu_lock
+            {
+                template <typename T> static char test( typename T::rcu_lock * );
+                template <typename T> static int  test( ... );
+                static CDS_CONSTEXPR const bool value = sizeof( test<Bucket>( nullptr )) == 1;
+            };
+
+            /// Lock for traversing the bucket being migrated: RCU read-side lock for RCU-based buckets, no-op otherwise
+            template <typename Bucket, bool IsRCU = has_rcu_lock<Bucket>::value >
+            struct traverse_lock
+            {
+                traverse_lock()
+                {}
+
+                static bool can_migrate()
+                {
+                    return true;
+                }
+            };
+
+            template <typename Bucket>
+            struct traverse_lock< Bucket, true >
+            {
+                typename Bucket::rcu_lock   m_lock;
+
+                // Migration clears the source bucket that may call RCU synchronize
+                static bool can_migrate()
+                {
+                    return !Bucket::gc::is_locked();
+                }
+            };
+
+            /// Guard of the bucket array for HP-like GC: the array is protected by the guards, the replaced array is retired through GC
+            /**
+                The guard is needed only until the thread enters a bucket of the array: the array cannot be replaced
+                while one of its buckets is in use, see \p resizable_table.
+            */
+            template <typename Bucket, bool IsRCU = has_rcu_lock<Bucket>::value >
+            struct table_guard
+            {
+                typedef typename Bucket::gc gc;
+
+                typename gc::template GuardArray<2> m_guards; // current array, next array
+
+                template <typename Table>
+                Table * protect( atomics::atomic<Table *> const& pCurrent )
+                {
+                    return m_guards.protect( 0, pCurrent );
+                }
+
+                // Returns the next array of \p t or \p nullptr if \p t is not current anymore
+                template <typename Table>
+                Table * protect_next( Table * t, atomics::atomic<Table *> const& pCurrent )
+                {
+                    Table * pNext = m_guards.assign( 1, t->pNext.load( atomics::memory_order_acquire ));
+                    // While t is current its next array cannot be retired
+                    if ( pCurrent.load( atomics::memory_order_acquire ) != t )
+                        return nullptr;
+                    return m_guards.assign( 0, pNext );
+                }
+
+                template <typename Table>
+                static void retire( Table * p, void (* pFunc)( Table * ))
+                {
+                    gc::retire( p, pFunc );
+                }
+            };
+
+            /// Guard of the bucket array for RCU: the array is accessed under RCU lock, the replaced array is retired outside of RCU lock
+            template <typename Bucket>
+            struct table_guard< Bucket, true >
+            {
+                typedef typename Bucket::gc gc;
+
+                typename Bucket::rcu_lock   m_lock;
+
+                template <typename Table>
+                Table * protect( atomics::atomic<Table *> const& pCurrent )
+                {
+                    return pCurrent.load( atomics::memory_order_acquire );
+                }
+
+                // The next array is retired after \p t, so it is alive while RCU is locked
+                template <typename Table>
+                Table * protect_next( Table * t, atomics::atomic<Table *> const& /*pCurrent*/ )
+                {
+                    return t->pNext.load( atomics::memory_order_acquire );
+                }
+
+                template <typename Table>
+                static void retire( Table * p, void (* pFunc)( Table * ))
+                {
+                    gc::retire_ptr( p, pFunc );
+                }
+            };
+
+            /// Set item policy for \p resizable_table
+            struct set_item_policy
+            {
+                template <typename Value>
+                static Value const& key( Value const& v )
+                {
+                    return v;
+                }
+
+                template <typename Bucket, typename Value>
+                static void copy( Bucket& b, Value const& v )
+                {
+                    b.insert( v );
+                }
+            };
+
+            /// Map item policy for \p resizable_table
+            struct map_item_policy
+            {
+                template <typename Value>
+                static typename Value::first_type const& key( Value const& v )
+                {
+                    return v.first;
+                }
+
+                template <typename Bucket, typename Value>
+                static void copy( Bucket& b, Value const& v )
+                {
+                    b.insert( v.first, v.second );
+                }
+            };
+
+            /// Bucket table of resizable Michael's hash set/map
+            /**
+                The table holds a chain of bucket arrays, each next array has twice as many buckets as the previous one.
+                Each modifying operation on the set, after completion, helps to move \p c_nMigrationStep buckets
+                from the current array to the next one. When all buckets of the current array have been moved,
+                the next array becomes current.
+
+                The bucket \p i of the old array with \p N buckets is split into buckets \p i and \p i + \p N of the new array.
+                While the bucket is being migrated the writers for that bucket help to migrate other buckets
+                of the array and back off only when there is nothing left to take; the readers go on
+                with the old bucket. After migration all operations are redirected to the new array.
+                A lookup whose functor may change the item found is a writer, see \p lookup_for_update().
+
+                The readers do not touch any shared counter. A reader holds \p table_guard for the whole lookup,
+                so the array and its buckets are alive, and the items of the bucket are protected by the bucket's GC
+                while the migration clears the old bucket. If the item is not found in the bucket that has been
+                migrated meanwhile, the lookup is repeated in the next array.
+
+                When the last bucket of the old array has been moved, the array is retired through the bucket's GC.
+                A writer or a migrating thread holds \p table_guard until it enters a bucket or takes a bucket
+                to migrate; after that the array cannot be replaced until the thread leaves the bucket,
+                so the guard is released before calling the bucket functor.
+            */
+            template <typename Bucket, typename Traits, typename Hash, typename ItemPolicy>
+            class resizable_table
+            {
+            public:
+                typedef Bucket      bucket_type;
+                typedef Traits      traits;
+                typedef Hash        hash;
+                typedef ItemPolicy  item_policy;
+                typedef typename traits::item_counter item_counter;
+
+                /// Count of buckets moved by one modifying operation
+                static CDS_CONSTEXPR const size_t c_nMigrationStep = 4;
+
+            protected:
+                typedef details::traverse_lock< bucket_type > traverse_lock;
+                typedef details::table_guard< bucket_type >   table_guard;
+
+                struct table
+                {
+                    size_t const                    nMask;
+                    bucket_type * const             pBuckets;
+                    bucket_state * const            pState;
+                    atomics::atomic< table * >      pNext;
+                    atomics::atomic< size_t >       nCursor;   // next bucket to migrate
+                    atomics::atomic< size_t >       nMigrated; // count of migrated buckets
+
+                    table( size_t nMask_, bucket_type * pBuckets_, bucket_state * pState_ )
+                        : nMask( nMask_ )
+                        , pBuckets( pBuckets_ )
+                        , pState( pState_ )
+                        , pNext( nullptr )
+                        , nCursor( 0 )
+                        , nMigrated( 0 )
+                    {}
+                };
+
+                typedef cds::details::Allocator< table, typename traits::allocator >        table_allocator;
+                typedef cds::details::Allocator< bucket_type, typename traits::allocator >  bucket_table_allocator;
+                typedef cds::details::Allocator< bucket_state, typename traits::allocator > state_allocator;
+
+                struct writer_scope
+                {
+                    bucket_state& m_state;
+                    explicit writer_scope( bucket_state& st ) : m_state( st ) {}
+                    ~writer_scope() { m_state.leave_writer(); }
+                };
+
+            protected:
+                atomics::atomic< table * >  m_pTable;       // current bucket array
+                hash                        m_HashFunctor;
+                item_counter                m_ItemCounter;
+                size_t const                m_nLoadFactor;
+                atomics::atomic< size_t >   m_nResizeCount;
+
+            public:
+                resizable_table( size_t nMaxItemCount, size_t nLoadFactor )
+                    : m_pTable( alloc_table( init_hash_bitmask( nMaxItemCount, nLoadFactor )))
+                    , m_nLoadFactor( nLoadFactor ? nLoadFactor : 1 )
+                    , m_nResizeCount( 0 )
+                {}
+
+                ~resizable_table()
+                {
+                    // The replaced arrays have been retired, only the current one and its next array remain
+                    table * t = m_pTable.load( atomics::memory_order_relaxed );
+                    while ( t ) {
+                        table * pNext = t->pNext.load( atomics::memory_order_relaxed );
+                        free_table( t );
+                        t = pNext;
+                    }
+                }
+
+                /// Calls <tt>f( bucket_type& )</tt> for the bucket of \p key as a writer, then helps to migrate
+                template <typename Q, typename Func>
+                auto modify( Q const& key, Func f ) -> decltype( f( std::declval<bucket_type&>()))
+                {
+                    // Modifying operations may wait for the migration that may call RCU synchronize
+                    assert( traverse_lock::can_migrate());
+
+                    auto ret = modify_bucket( key, f );
+                    help_migrate();
+                    return ret;
+                }
+
+                /// Calls <tt>bool f( bucket_type& )</tt> for the bucket of \p key as a reader
+                /**
+                    \p f returns \p true if the item is found. The bucket may be cleared by the migration
+                    while \p f searches in it, so the search that fails in the migrated bucket
+                    is repeated in the next array.
+                */
+                template <typename Q, typename Func>
+                bool lookup( Q const& key, Func f )
+                {
+                    size_t const nHash = m_HashFunctor( key );
+                    table_guard g;
+                    table * t = g.protect( m_pTable );
+                    for (;;) {
+                        size_t const nIdx = nHash & t->nMask;
+                        bucket_state const& st = t->pState[nIdx];
+                        if ( !st.is_migrated()) {
+                            if ( f( t->pBuckets[nIdx] ))
+                                return true;
+                            if ( !st.is_migrated())
+                                return false;
+                        }
+                        t = next_table( g, t );
+                    }
+                }
+
+                /// Calls <tt>f( bucket_type& )</tt> for the bucket of \p key as a writer without helping to migrate
+                /**
+                    For the lookups whose functor may change the item found. Such a lookup cannot be a reader
+                    since the migration copies the items of the bucket without locking.
+                */
+                template <typename Q, typename Func>
+                auto lookup_for_update( Q const& key, Func f ) -> decltype( f( std::declval<bucket_type&>()))
+                {
+                    return modify_bucket( key, f );
+                }
+
+                /// Clears all buckets; not atomic
+                void clear()
+                {
+                    finish_migration();
+
+                    for ( size_t i = 0; ; ++i ) {
+                        table * t;
+                        {
+                            table_guard g;
+                            t = g.protect( m_pTable );
+                            if ( i > t->nMask )
+                                break;
+
+                            // The bucket can be migrated by concurrent resizing
+                            if ( !t->pState[i].enter_writer())
+                                continue;
+                        }
+                        writer_scope ws( t->pState[i] );
+                        t->pBuckets[i].clear();
+                    }
+                    m_ItemCounter.reset();
+                }
+
+                item_counter& counter()
+                {
+                    return m_ItemCounter;
+                }
+
+                item_counter const& counter() const
+                {
+                    return m_ItemCounter;
+                }
+
+                size_t bucket_count() const
+                {
+                    table_guard g;
+                    return g.protect( m_pTable )->nMask + 1;
+                }
+
+                size_t load_factor() const
+                {
+                    return m_nLoadFactor;
+                }
+
+                size_t resize_count() const
+                {
+                    return m_nResizeCount.load( atomics::memory_order_relaxed );
+                }
+
+                bool is_resizing() const
+                {
+                    table_guard g;
+                    return g.protect( m_pTable )->pNext.load( atomics::memory_order_acquire ) != nullptr;
+                }
+
+                /// Starts the resizing if the load factor is exceeded and moves up to \p c_nMigrationStep buckets
+                void help_migrate()
+                {
+                    if ( !traverse_lock::can_migrate())
+                        return;
+
+                    for ( size_t n = 0; n < c_nMigrationStep; ++n ) {
+                        table * t;
+                        table * pNext;
+                        size_t nIdx;
+                        {
+                            table_guard g;
+                            t = g.protect( m_pTable );
+                            pNext = t->pNext.load( atomics::memory_order_acquire );
+                            if ( !pNext ) {
+                                if ( static_cast<size_t>( m_ItemCounter ) <= ( t->nMask + 1 ) * m_nLoadFactor )
+                                    return;
+                                pNext = grow( t );
+                            }
+
+                            // The bucket taken keeps the array alive until it is migrated
+                            nIdx = t->nCursor.fetch_add( 1, atomics::memory_order_relaxed );
+                            if ( nIdx > t->nMask )
+                                return;
+                        }
+                        migrate_bucket( t, pNext, nIdx );
+                    }
+                }
+
+            protected:
+                template <typename Q, typename Func>
+                auto modify_bucket( Q const& key, Func& f ) -> decltype( f( std::declval<bucket_type&>()))
+                {
+                    size_t const nHash = m_HashFunctor( key );
+                    typename bucket_state::back_off bkoff;
+                    for (;;) {
+                        table * t;
+                        table * pNext = nullptr;
+                        size_t nIdx;
+                        {
+                            table_guard g;
+                            t = g.protect( m_pTable );
+                            for (;;) {
+                                nIdx = nHash & t->nMask;
+                                size_t const nState = t->pState[nIdx].try_enter_writer();
+                                if ( nState == 0 )
+                                    break;
+                                if ( !( nState & bucket_state::migrated )) {
+                                    // The bucket is being migrated by another thread, take one more bucket of the array
+                                    pNext = t->pNext.load( atomics::memory_order_acquire );
+                                    nIdx = take_bucket( t );
+                                    if ( nIdx > t->nMask )
+                                        t = nullptr;
+                                    break;
+                                }
+                                t = next_table( g, t );
+                            }
+                        }
+
+                        if ( !pNext ) {
+                            // The bucket we are in cannot be migrated, so the array is alive
+                            writer_scope ws( t->pState[nIdx] );
+                            return f( t->pBuckets[nIdx] );
+                        }
+
+                        if ( t )
+                            migrate_bucket( t, pNext, nIdx );
+                        else
+                            bkoff();
+                    }
+                }
+
+                // Takes one more bucket of \p t to migrate; returns the bucket index, or the value greater than \p t->nMask if no bucket is taken
+                static size_t take_bucket( table * t )
+                {
+                    if ( !traverse_lock::can_migrate())
+                        return t->nMask + 1;
+                    return t->nCursor.fetch_add( 1, atomics::memory_order_relaxed );
+                }
+
+                // Returns the array following \p t, or the current array if \p t has been replaced
+                table * next_table( table_guard& g, table * t )
+                {
+                    assert( t->pNext.load( atomics::memory_order_relaxed ) != nullptr );
+                    table * pNext = g.protect_next( t, m_pTable );
+                    return pNext ? pNext : g.protect( m_pTable );
+                }
+
+                static table * alloc_table( size_t nMask )
+                {
+                    return table_allocator().New( nMask,
+                        bucket_table_allocator().NewArray( nMask + 1 ),
+                        state_allocator().NewArray( nMask + 1 ));
+                }
+
+                // Disposer of the replaced array, its buckets have been cleared by the migration
+                static void free_table( table * t )
+                {
+                    bucket_table_allocator().Delete( t->pBuckets, t->nMask + 1 );
+                    state_allocator().Delete( t->pState, t->nMask + 1 );
+                    table_allocator().Delete( t );
+                }
+
+                table * grow( table * t )
+                {
+                    table * pNew = alloc_table( t->nMask * 2 + 1 );
+                    table * pExpected = nullptr;
+                    if ( t->pNext.compare_exchange_strong( pExpected, pNew, atomics::memory_order_acq_rel, atomics::memory_order_acquire )) {
+                        m_nResizeCount.fetch_add( 1, atomics::memory_order_relaxed );
+                        return pNew;
+                    }
+
+                    // Another thread has started the resizing
+                    free_table( pNew );
+                    return pExpected;
+                }
+
+                void migrate_bucket( table * pFrom, table * pTo, size_t nIdx )
+                {
+                    bucket_state& st = pFrom->pState[nIdx];
+                    bucket_type& src = pFrom->pBuckets[nIdx];
+
+                    st.freeze();
+                    {
+                        // The target buckets are not visible to anyone until the source is sealed
+                        traverse_lock l;
+                        for ( auto it = src.begin(), itEnd = src.end(); it != itEnd; ++it ) {
+                            size_t const nNew = m_HashFunctor( item_policy::key( *it )) & pTo->nMask;
+                            item_policy::copy( pTo->pBuckets[nNew], *it );
+                        }
+                    }
+                    st.seal();
+
+                    // No writer can enter the source bucket now, the readers in it are protected by the bucket's GC
+                    src.clear();
+
+                    if ( pFrom->nMigrated.fetch_add( 1, atomics::memory_order_acq_rel ) == pFrom->nMask ) {
+                        // The last bucket has been moved. All buckets of pFrom are sealed,
+                        // but a thread holding table_guard can still read the array
+                        m_pTable.store( pTo, atomics::memory_order_release );
+                        table_guard::retire( pFrom, free_table );
+                    }
+                }
+
+                void finish_migration()
+                {
+                    typename bucket_state::back_off bkoff;
+                    for (;;) {
+                        table * t;
+                        table * pNext;
+                        size_t nIdx;
+                        {
+                            table_guard g;
+                            t = g.protect( m_pTable );
+                            pNext = t->pNext.load( atomics::memory_order_acquire );
+                            if ( !pNext )
+                                return;
+                            nIdx = t->nCursor.fetch_add( 1, atomics::memory_order_relaxed );
+                            if ( nIdx > t->nMask ) {
+                                // Other threads complete the buckets they have taken;
+                                // do not wait under the guard: RCU-based migration calls synchronize()
+                                t = nullptr;
+                            }
+                        }
+
+                        if ( t )
+                            migrate_bucket( t, pNext, nIdx );
+                        else
+                            bkoff();
+                    }
+                }
+            };
+
+        } // namespace details
+        //@endcond
+
+    } // namespace michael_set
+
+}} // namespace cds::container
+
+#endif // #ifndef CDSLIB_CONTAINER_DETAILS_MICHAEL_RESIZABLE_BASE_H
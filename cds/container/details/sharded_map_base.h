@@ -0,0 +1,87 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#ifndef CDSLIB_CONTAINER_DETAILS_SHARDED_MAP_BASE_H
+#define CDSLIB_CONTAINER_DETAILS_SHARDED_MAP_BASE_H
+
+#include <cds/container/details/base.h>
+#include <cds/opt/hash.h>
+
+namespace cds { namespace container {
+
+    /// \p ShardedMap related definitions
+    /** @ingroup cds_nonintrusive_helper
+    */
+    namespace sharded_map {
+
+        /// \p ShardedMap traits
+        struct traits
+        {
+            /// Hash functor used to select the shard for a key
+            /**
+                The hash value is mixed before the shard is selected, so the shard index
+                does not correlate with the bits that the shard map uses for its own hashing.
+                By default, \p std::hash is used.
+            */
+            typedef opt::none                       hash;
+
+            /// Allocator for the shard objects
+            typedef CDS_DEFAULT_ALLOCATOR           allocator;
+        };
+
+        /// Metafunction converting option list to \p ShardedMap traits
+        /**
+            \p Options are:
+            - \p opt::hash - hash functor used to select the shard. Default is \p std::hash<key_type>.
+            - \p opt::allocator - allocator for the shard objects. Default is \ref CDS_DEFAULT_ALLOCATOR.
+        */
+        template <typename... Options>
+        struct make_traits {
+#   ifdef CDS_DOXYGEN_INVOKED
+            typedef implementation_defined type ;   ///< Metafunction result
+#   else
+            typedef typename cds::opt::make_options<
+                typename cds::opt::find_type_traits< traits, Options... >::type
+                ,Options...
+            >::type   type;
+#   endif
+        };
+
+    } // namespace sharded_map
+
+    //@cond
+    // Forward declaration
+    template <class Map, size_t ShardCount, class Traits = sharded_map::traits >
+    class ShardedMap;
+    //@endcond
+
+}} // namespace cds::container
+
+#endif // #ifndef CDSLIB_CONTAINER_DETAILS_SHARDED_MAP_BASE_H
@@ -57,6 +57,16 @@ namespace cds { namespace container {
         /// Skip list empty internal statistics
         typedef cds::intrusive::skip_list::empty_stat empty_stat;
 
+        /// Version counter for \p snapshot_range(), see \p cds::intrusive::skip_list::version_counter
+        typedef cds::intrusive::skip_list::version_counter version_counter;
+
+        /// Empty version counter, see \p cds::intrusive::skip_list::empty_version_counter
+        typedef cds::intrusive::skip_list::empty_version_counter empty_version_counter;
+
+        /// Option specifying version counter for \p snapshot_range()
+        template <typename Type>
+        using snapshot_counter = cds::intrusive::skip_list::snapshot_counter< Type >;
+
         /// SkipListSet traits
         struct traits
         {
@@ -105,6 +115,9 @@ namespace cds { namespace container {
             /// Internal statistics, by default disabled. To enable, use \p split_list::stat
             typedef empty_stat                      stat;
 
+            /// Version counter for \p snapshot_range(), by default disabled. To enable, use \p skip_list::version_counter
+            typedef empty_version_counter           snapshot_counter;
+
             /// RCU deadlock checking policy (for \ref cds_nonintrusive_SkipListSet_rcu "RCU-based SkipListSet")
             /**
                 List of available options see opt::rcu_check_deadlock
@@ -132,6 +145,8 @@ namespace cds { namespace container {
             - \p opt::allocator - allocator for skip-list node. Default is \ref CDS_DEFAULT_ALLOCATOR.
             - \p opt::back_off - back-off strategy used. If the option is not specified, the \p cds::backoff::Default is used.
             - \p opt::stat - internal statistics. Available types: \p skip_list::stat, \p skip_list::empty_stat (the default)
+            - \p skip_list::snapshot_counter - version counter for \p snapshot_range().
+                Available types: \p skip_list::version_counter, \p skip_list::empty_version_counter (the default)
             - \p opt::rcu_check_deadlock - a deadlock checking policy for RCU-based skip-list.
                 Default is \p opt::v::rcu_throw_deadlock
 
@@ -53,6 +53,10 @@ namespace cds { namespace container {
         template <bool Value>
         using dynamic_bucket_table = cds::intrusive::split_list::dynamic_bucket_table<Value>;
 
+        /// Shrinkable bucket table option - typedef for \p intrusive::split_list::shrinkable_bucket_table
+        template <bool Value>
+        using shrinkable_bucket_table = cds::intrusive::split_list::shrinkable_bucket_table<Value>;
+
         using cds::intrusive::split_list::static_bucket_table;
         using cds::intrusive::split_list::expandable_bucket_table;
 
@@ -0,0 +1,234 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#ifndef CDSLIB_CONTAINER_DETAILS_UNROLLED_SKIP_LIST_BASE_H
+#define CDSLIB_CONTAINER_DETAILS_UNROLLED_SKIP_LIST_BASE_H
+
+#include <cds/container/details/skip_list_base.h>
+#include <cds/sync/spinlock.h>
+
+namespace cds { namespace container {
+
+    /// \p UnrolledSkipListSet related definitions
+    /** @ingroup cds_nonintrusive_helper
+    */
+    namespace unrolled_skip_list {
+
+        /// Option specifying random level generator, see \p skip_list::random_level_generator
+        template <typename Type>
+        using random_level_generator = cds::intrusive::skip_list::random_level_generator<Type>;
+
+        /// Xor-shift random level generator
+        typedef cds::intrusive::skip_list::xorshift xorshift;
+
+        /// Turbo-pascal random level generator
+        typedef cds::intrusive::skip_list::turbo_pascal turbo_pascal;
+
+        /// Option specifying the max count of items in a chunk node
+        /**
+            @copydetails traits::node_capacity
+        */
+        template <size_t Capacity>
+        struct node_capacity {
+            //@cond
+            template <typename Base> struct pack: public Base
+            {
+                enum { node_capacity = Capacity };
+            };
+            //@endcond
+        };
+
+        /// \p UnrolledSkipListSet internal statistics
+        template <typename EventCounter = cds::atomicity::event_counter>
+        struct stat {
+            typedef EventCounter event_counter ; ///< Event counter type
+
+            event_counter   m_nInsertSuccess;   ///< Number of success \p insert() operations
+            event_counter   m_nInsertFailed;    ///< Number of failed \p insert() operations
+            event_counter   m_nUpdateNew;       ///< Number of new item inserted for \p update()
+            event_counter   m_nUpdateExisting;  ///< Number of existing item updates
+            event_counter   m_nUpdateFailed;    ///< Number of failed \p update() call
+            event_counter   m_nEraseSuccess;    ///< Number of successful \p erase() operations
+            event_counter   m_nEraseFailed;     ///< Number of failed \p erase() operations
+            event_counter   m_nFindSuccess;     ///< Number of successful \p find() and \p contains() operations
+            event_counter   m_nFindFailed;      ///< Number of failed \p find() and \p contains() operations
+            event_counter   m_nSearchRetry;     ///< Number of search retries since the chunk found has been split or merged concurrently
+            event_counter   m_nIndexRetry;      ///< Number of index level link/unlink retries since the predecessor has been changed concurrently
+            event_counter   m_nNodeSplit;       ///< Number of chunk splits
+            event_counter   m_nNodeMerge;       ///< Number of chunk merges
+            event_counter   m_nNodeMergeFailed; ///< Number of merge attempts rejected since the neighbour chunk is too full or has been changed
+            event_counter   m_nNodeCreated;     ///< Number of chunk nodes created
+            event_counter   m_nNodeRetired;     ///< Number of chunk nodes retired
+
+            //@cond
+            void onInsertSuccess()      { ++m_nInsertSuccess;   }
+            void onInsertFailed()       { ++m_nInsertFailed;    }
+            void onUpdateNew()          { ++m_nUpdateNew;       }
+            void onUpdateExisting()     { ++m_nUpdateExisting;  }
+            void onUpdateFailed()       { ++m_nUpdateFailed;    }
+            void onEraseSuccess()       { ++m_nEraseSuccess;    }
+            void onEraseFailed()        { ++m_nEraseFailed;     }
+            void onFindSuccess()        { ++m_nFindSuccess;     }
+            void onFindFailed()         { ++m_nFindFailed;      }
+            void onSearchRetry()        { ++m_nSearchRetry;     }
+            void onIndexRetry()         { ++m_nIndexRetry;      }
+            void onNodeSplit()          { ++m_nNodeSplit;       }
+            void onNodeMerge()          { ++m_nNodeMerge;       }
+            void onNodeMergeFailed()    { ++m_nNodeMergeFailed; }
+            void onNodeCreated()        { ++m_nNodeCreated;     }
+            void onNodeRetired()        { ++m_nNodeRetired;     }
+            //@endcond
+        };
+
+        /// \p UnrolledSkipListSet empty internal statistics
+        struct empty_stat {
+            //@cond
+            void onInsertSuccess()      const {}
+            void onInsertFailed()       const {}
+            void onUpdateNew()          const {}
+            void onUpdateExisting()     const {}
+            void onUpdateFailed()       const {}
+            void onEraseSuccess()       const {}
+            void onEraseFailed()        const {}
+            void onFindSuccess()        const {}
+            void onFindFailed()         const {}
+            void onSearchRetry()        const {}
+            void onIndexRetry()         const {}
+            void onNodeSplit()          const {}
+            void onNodeMerge()          const {}
+            void onNodeMergeFailed()    const {}
+            void onNodeCreated()        const {}
+            void onNodeRetired()        const {}
+            //@endcond
+        };
+
+        /// \p UnrolledSkipListSet traits
+        struct traits
+        {
+            /// Key comparison functor
+            /**
+                No default functor is provided. If the option is not specified, the \p less is used.
+            */
+            typedef opt::none                       compare;
+
+            /// Specifies binary predicate used for key compare.
+            /**
+                Default is \p std::less<T>.
+            */
+            typedef opt::none                       less;
+
+            /// Item counter
+            /**
+                The type for item counting feature,
+                by default disabled (\p atomicity::empty_item_counter)
+            */
+            typedef atomicity::empty_item_counter   item_counter;
+
+            /// C++ memory ordering model
+            /**
+                List of available memory ordering see \p opt::memory_model
+            */
+            typedef opt::v::relaxed_ordering        memory_model;
+
+            /// Random level generator for the index levels of chunk nodes
+            /**
+                See \p skip_list::traits::random_level_generator
+            */
+            typedef turbo_pascal                    random_level_generator;
+
+            /// Allocator for chunk nodes, \p std::allocator interface
+            typedef CDS_DEFAULT_ALLOCATOR           allocator;
+
+            /// Back-off strategy, default is \p cds::backoff::Default
+            typedef cds::backoff::Default           back_off;
+
+            /// Lock type of a chunk node, default is \p cds::sync::spin
+            typedef cds::sync::spin                 lock_type;
+
+            /// Max count of items in a chunk node, default is 32
+            /**
+                A chunk node keeps up to \p node_capacity items in a sorted array.
+                The full chunk is split in halves, a chunk that has lost three quarters of its items
+                is merged into its left neighbour. Reasonable values are 16 to 64:
+                a lookup makes a binary search inside a chunk, an insertion and an erasure shift
+                the half of the chunk in average.
+
+                Use \p unrolled_skip_list::node_capacity option setter to change the capacity.
+                The capacity must be at least 4.
+            */
+            enum { node_capacity = 32 };
+
+            /// Internal statistics, by default disabled. To enable, use \p unrolled_skip_list::stat
+            typedef empty_stat                      stat;
+        };
+
+        /// Metafunction converting option list to \p UnrolledSkipListSet traits
+        /**
+            \p Options are:
+            - \p opt::compare - key comparison functor. No default functor is provided.
+                If the option is not specified, the \p opt::less is used.
+            - \p opt::less - specifies binary predicate used for key comparison. Default is \p std::less<T>.
+            - \p opt::item_counter - the type of item counting feature. Default is \p atomicity::empty_item_counter that is no item counting.
+            - \p opt::memory_model - C++ memory ordering model. Can be \p opt::v::relaxed_ordering (relaxed memory model, the default)
+                or \p opt::v::sequential_consistent (sequentially consisnent memory model).
+            - \p unrolled_skip_list::random_level_generator - random level generator. Can be \p unrolled_skip_list::xorshift,
+                \p unrolled_skip_list::turbo_pascal (the default) or user-provided one.
+            - \p opt::allocator - allocator for chunk nodes. Default is \ref CDS_DEFAULT_ALLOCATOR.
+            - \p opt::back_off - back-off strategy used. If the option is not specified, the \p cds::backoff::Default is used.
+            - \p opt::lock_type - lock type of a chunk node. Default is \p cds::sync::spin
+            - \p unrolled_skip_list::node_capacity - max count of items in a chunk node. Default is 32.
+            - \p opt::stat - internal statistics. Available types: \p unrolled_skip_list::stat, \p unrolled_skip_list::empty_stat (the default)
+        */
+        template <typename... Options>
+        struct make_traits {
+#   ifdef CDS_DOXYGEN_INVOKED
+            typedef implementation_defined type ;   ///< Metafunction result
+#   else
+            typedef typename cds::opt::make_options<
+                typename cds::opt::find_type_traits< traits, Options... >::type
+                ,Options...
+            >::type   type;
+#   endif
+        };
+
+    } // namespace unrolled_skip_list
+
+    //@cond
+    // Forward declaration
+    template <class GC, typename T, class Traits = unrolled_skip_list::traits >
+    class UnrolledSkipListSet;
+
+    template <class GC, typename Key, typename T, class Traits = unrolled_skip_list::traits >
+    class UnrolledSkipListMap;
+    //@endcond
+
+}} // namespace cds::container
+
+#endif // #ifndef CDSLIB_CONTAINER_DETAILS_UNROLLED_SKIP_LIST_BASE_H
@@ -171,6 +171,7 @@ namespace cds { namespace container {
 
     public:
         typedef typename gc::scoped_lock    rcu_lock;  ///< RCU scoped lock
+        typedef typename gc::batch_lock     rcu_batch_lock; ///< RCU batch lock for a sequence of lookups
 
         /// pointer to extracted node
         using exempt_ptr = cds::urcu::exempt_ptr < gc, leaf_node, value_type, typename maker::intrusive_traits::disposer,
@@ -528,6 +529,35 @@ namespace cds { namespace container {
         {
             return base_class::contains( key );
         }
+
+        /// Checks whether the set contains \p key, batch version
+        /**
+            The function does not lock RCU: the caller holds the batch lock \p bl
+            that covers a sequence of lookups, see \p cds::intrusive::EllenBinTree::contains( rcu_batch_lock&, Q const& ).
+        */
+        template <typename Q>
+        bool contains( rcu_batch_lock& bl, Q const& key ) const
+        {
+            return base_class::contains( bl, key );
+        }
+
+        /// Finds the key \p key, batch version
+        /**
+            The function is an analog of \p find(Q&, Func) but it does not lock RCU:
+            the caller holds the batch lock \p bl that covers a sequence of lookups.
+        */
+        template <typename Q, typename Func>
+        bool find( rcu_batch_lock& bl, Q& key, Func f ) const
+        {
+            return base_class::find( bl, key, [&f]( leaf_node& node, Q& v ) { f( node.m_Value, v ); });
+        }
+        //@cond
+        template <typename Q, typename Func>
+        bool find( rcu_batch_lock& bl, Q const& key, Func f ) const
+        {
+            return base_class::find( bl, key, [&f]( leaf_node& node, Q const& v ) { f( node.m_Value, v ); } );
+        }
+        //@endcond
         //@cond
         template <typename Q>
         CDS_DEPRECATED("deprecated, use contains()")
@@ -593,6 +623,39 @@ namespace cds { namespace container {
             return pNode ? &pNode->m_Value : nullptr;
         }
 
+        /// Calls \p f for each item with key in range <tt>[lo, hi)</tt> in ascending key order
+        /**
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( value_type& item );
+            };
+            \endcode
+
+            The scan is performed inside a single RCU read-side critical section, see
+            \ref cds_intrusive_EllenBinTree_rcu_for_each_in_range "intrusive for_each_in_range()" for details.
+            The functor must not modify the set.
+
+            The function applies RCU lock internally.
+        */
+        template <typename Q, typename Func>
+        void for_each_in_range( Q const& lo, Q const& hi, Func f ) const
+        {
+            base_class::for_each_in_range( lo, hi, [&f]( leaf_node& node ) { f( node.m_Value ); } );
+        }
+
+        /// Calls \p f for each item of the set in ascending key order
+        /**
+            The function is an analog of \p for_each_in_range() that visits the whole set.
+
+            The function applies RCU lock internally.
+        */
+        template <typename Func>
+        void for_each( Func f ) const
+        {
+            base_class::for_each( [&f]( leaf_node& node ) { f( node.m_Value ); } );
+        }
+
         /// Clears the set (non-atomic)
         /**
             The function unlink all items from the tree.
@@ -318,6 +318,9 @@ namespace cds { namespace container {
         /**
             @param head_bits: 2<sup>head_bits</sup> specifies the size of head array, minimum is 4.
             @param array_bits: 2<sup>array_bits</sup> specifies the size of array node, minimum is 2.
+            @param max_head_bits: 2<sup>max_head_bits</sup> specifies the max size of head array.
+                If \p traits::head_growth is enabled and \p max_head_bits is greater than \p head_bits the head array grows online,
+                see \ref cds_intrusive_FeldmanHashSet_hp_ctor "intrusive FeldmanHashSet constructor".
 
             Equation for \p head_bits and \p array_bits:
             \code
@@ -325,8 +328,8 @@ namespace cds { namespace container {
             \endcode
             where \p N is multi-level array depth.
         */
-        FeldmanHashMap( size_t head_bits = 8, size_t array_bits = 4 )
-            : base_class( head_bits, array_bits )
+        FeldmanHashMap( size_t head_bits = 8, size_t array_bits = 4, size_t max_head_bits = 0 )
+            : base_class( head_bits, array_bits, max_head_bits )
         {}
 
         /// Destructs the map and frees all data
@@ -589,6 +592,46 @@ namespace cds { namespace container {
             return base_class::find( m_Hasher( key_type( key )), [&f](node_type& node) { f( node.m_Value );});
         }
 
+        /// Finds a batch of keys
+        /**
+            The function searches each key from the range <tt>[itFirst, itLast)</tt> and calls the functor \p f
+            for each item found, the functor interface is the same as for \p find().
+            \p Iterator is a forward iterator, its value type should be convertible to \p key_type.
+
+            The hashes of next keys are computed and their slots are prefetched
+            while the current key is being searched,
+            see \ref cds_intrusive_FeldmanHashSet_hp_find_batch "intrusive FeldmanHashSet::find_batch()".
+            The whole batch is performed under one RCU \p batch_lock.
+            The function should not be called under RCU lock.
+
+            The function returns the number of keys found.
+        */
+        template <typename Iterator, typename Func>
+        size_t find_batch( Iterator itFirst, Iterator itLast, Func f )
+        {
+            typedef typename std::iterator_traits<Iterator>::value_type key_arg;
+            typename gc::batch_lock bl;
+            return cds::algo::prefetch_pipeline< cds::algo::c_nPrefetchDistance, hash_type >( itFirst, itLast,
+                [this]( key_arg const& key ) -> hash_type {
+                    hash_type hash = m_Hasher( key_type( key ));
+                    base_class::prefetch_slot( hash, 1 );
+                    return hash;
+                },
+                [this]( hash_type const& hash ) {
+                    base_class::prefetch_slot( hash, 2 );
+                },
+                [this, &f, &bl]( key_arg const&, hash_type const& hash ) -> bool {
+                    bl.step();
+                    node_type * p = base_class::search( hash );
+                    if ( p ) {
+                        f( p->m_Value );
+                        return true;
+                    }
+                    return false;
+                }
+            );
+        }
+
         /// Finds the key \p key and return the item found
         /**
             The function searches the item by its \p hash
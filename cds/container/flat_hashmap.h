@@ -0,0 +1,1061 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#ifndef CDSLIB_CONTAINER_FLAT_HASHMAP_H
+#define CDSLIB_CONTAINER_FLAT_HASHMAP_H
+
+#include <string.h>     // memset
+#include <type_traits>
+#include <cds/container/details/flat_hashmap_base.h>
+#include <cds/algo/int_algo.h>
+#include <cds/details/allocator.h>
+
+namespace cds { namespace container {
+
+    /// Open-addressing hash map with cache-aligned groups and SIMD tag probing
+    /** @ingroup cds_nonintrusive_map
+        \anchor cds_nonintrusive_FlatHashMap
+
+        The map stores key/value pairs inline in a flat array of groups, there is no per-item allocation.
+        Each group holds 16 slots, a version counter and a 16-byte tag array placed at the beginning
+        of the group; the group is aligned on \p cds::c_nCacheLineSize boundary.
+        A tag is the high 7 bits of the mixed hash value with the high bit set, zero tag means empty slot.
+        The lookup compares the tag array with the key's tag in one SSE2 instruction (with a scalar
+        fallback if SSE2 is not available), so only the slots with matching tag are examined.
+
+        Note that a group is not one cache line: the version and the tags (20 bytes) share the first line
+        of the group with the first slots, and the slots of the group span several lines
+        (five lines for 8-byte keys and values). A probe reads the header line and then only the lines
+        of the slots whose tag matches, usually one. Sixteen inline slots cannot fit one cache line
+        for any useful slot size, and fewer slots per group would make the two-choice table overflow earlier.
+
+        Each key is mapped onto two groups (two-choice hashing); a new item is placed into the less loaded one.
+        The group is protected by seqlock-like version counter:
+        - a writer locks both groups of the key in index order, modifies the slots and increments the version;
+        - a reader never writes to shared memory: it copies the matching slot optimistically and re-checks
+          the version of the group, repeating the read if the group has been changed concurrently.
+
+        When both groups of a new key are full the table is doubled if it is at least half full.
+        The table load is counted internally, so the resizing does not depend on \p Traits::item_counter
+        and works with \p atomicity::empty_item_counter as well.
+        Otherwise the groups are full because of hash collisions and doubling would not help
+        (for example, 33 keys with the same hash value never fit into two groups), so the item is placed
+        into the overflow stash of the table: an unordered chain of 16-slot blocks protected
+        by its own version counter. Both groups of the key are marked as overflowed, and only the lookups
+        for the keys of the marked groups scan the stash. Thus the table size is bounded by twice the item count
+        whatever the hash distribution is, but a lookup in heavily colliding groups is linear in the stash size.
+
+        The resizing is incremental. The writer that finds the table full allocates the new table twice as large
+        and links it to the current one; then the groups of the old table are moved to the new table one at a time.
+        A moved group is frozen: its writers go to the new table, the readers look for the key in the new table.
+        The groups are taken by a migration cursor, and every writer that meets the resizing
+        moves the groups of its key and then up to \p c_nMigrationStep groups from the cursor,
+        so no writer copies the whole table and no writer waits for another one.
+        The thread that moves the last group (or the stash) publishes the new table and retires the old one by \p GC.
+        The table never shrinks.
+
+        Since the items are copied by the optimistic readers and by the resizing,
+        \p Key and \p T must be trivially copyable types (integers, PODs and so on),
+        and \p Traits::equal_to must be able to compare partially written key safely.
+        The map is intended for small keys and values; use \p FeldmanHashMap or \p MichaelHashMap for other cases.
+
+        Template parameters:
+        - \p GC - garbage collector used to reclaim old tables: \p gc::HP, \p gc::DHP, \p gc::HE, \p gc::EBR
+            or \ref cds_urcu_gc "RCU". The map uses two guards per operation: the current table and the next one.
+            For \ref cds_urcu_desc "RCU" the member functions must be called outside of RCU critical section
+            since the readers lock RCU internally and the writers can retire the old table.
+        - \p Key - key type, trivially copyable
+        - \p T - mapped type, trivially copyable
+        - \p Traits - map traits, default is \p flat_hashmap::traits.
+            It is possible to declare option-based map with \p flat_hashmap::make_traits metafunction
+            instead of \p Traits template argument.
+
+        The map does not support iterators, \p get() and \p extract().
+        The functors passed to \p find() and \p update() receive a copy of the item,
+        so they can be called more than once for one operation (\p find()) and must not store the reference.
+
+        The header <tt>cds/container/flat_hashmap.h</tt> does not include any GC header,
+        include the header of the \p GC you use before it.
+    */
+    template <
+        class GC,
+        typename Key,
+        typename T,
+#ifdef CDS_DOXYGEN_INVOKED
+        class Traits = flat_hashmap::traits
+#else
+        class Traits
+#endif
+    >
+    class FlatHashMap
+    {
+    public:
+        typedef GC      gc;          ///< Garbage collector
+        typedef Key     key_type;    ///< key type
+        typedef T       mapped_type; ///< mapped type
+        typedef std::pair< key_type const, mapped_type > value_type; ///< key/value pair passed to the functors
+        typedef Traits  traits;      ///< Map traits
+
+        /// Hash functor
+        typedef typename cds::opt::v::hash_selector< typename traits::hash >::type hash;
+
+        /// Key equality functor
+        typedef typename std::conditional<
+            std::is_same< typename traits::equal_to, opt::none >::value,
+            std::equal_to< key_type >,
+            typename traits::equal_to
+        >::type key_equal;
+
+        typedef typename traits::item_counter item_counter; ///< Item counter type
+        typedef typename traits::back_off     back_off;     ///< Back-off strategy
+        typedef typename traits::stat         stat;         ///< Internal statistics type
+        typedef typename traits::allocator    allocator;    ///< Aligned allocator for the groups
+
+        static CDS_CONSTEXPR const size_t c_nHazardPtrCount = 2; ///< Count of hazard pointer required
+        static CDS_CONSTEXPR const size_t c_nGroupSize = flat_hashmap::details::c_nGroupSize; ///< Count of slots in the group
+        static CDS_CONSTEXPR const size_t c_nMigrationStep = 4; ///< Count of groups moved from the migration cursor by one writer
+
+    protected:
+        //@cond
+        typedef flat_hashmap::details::table_access< gc > table_access;
+
+        static CDS_CONSTEXPR const uint32_t c_nLocked = 1;
+        static CDS_CONSTEXPR const uint32_t c_nFrozen = 2;     // the group or the stash has been moved to the next table
+        static CDS_CONSTEXPR const uint32_t c_nOverflow = 4;   // some items of the group are in the stash
+        static CDS_CONSTEXPR const uint32_t c_nVersionInc = 8;
+        static CDS_CONSTEXPR const uint8_t  c_nEmptyTag = 0;
+
+        struct slot {
+            key_type    key;
+            mapped_type val;
+        };
+
+        struct group {
+            CDS_DATA_ALIGNMENT( cds::c_nCacheLineSize ) atomics::atomic<uint32_t> nVersion;
+            uint8_t tags[c_nGroupSize];
+            slot    slots[c_nGroupSize];
+
+            group()
+                : nVersion( 0 )
+            {
+                memset( tags, 0, sizeof( tags ));
+            }
+        };
+
+        // Overflow stash block
+        struct stash_block {
+            uint8_t     tags[c_nGroupSize];
+            slot        slots[c_nGroupSize];
+            stash_block * pNext;
+
+            explicit stash_block( stash_block * next )
+                : pNext( next )
+            {
+                memset( tags, 0, sizeof( tags ));
+            }
+        };
+
+        struct table {
+            size_t const                    nMask;      // group count - 1
+            group * const                   pGroups;
+            atomics::atomic<uint32_t>       nStashVersion;
+            atomics::atomic<stash_block *>  pStash;     // blocks are freed with the table
+            atomics::atomic<table *>        pNext;      // the table the items are moved to
+            atomics::atomic<size_t>         nCursor;    // next group to migrate, nMask + 1 is the stash
+            atomics::atomic<size_t>         nMigrated;  // count of moved groups and stash
+
+            table( size_t mask, group * groups )
+                : nMask( mask )
+                , pGroups( groups )
+                , nStashVersion( 0 )
+                , pStash( nullptr )
+                , pNext( nullptr )
+                , nCursor( 0 )
+                , nMigrated( 0 )
+            {}
+        };
+
+        // Result of the modifying functor called under the group locks of the key
+        enum update_status {
+            update_done,    // the operation is completed
+            update_moved,   // the key must be looked for in the next table
+            update_grow     // both groups of the key are full, the table must be resized
+        };
+
+        typedef cds::details::AlignedAllocator< group, allocator > group_allocator;
+        typedef cds::details::Allocator< table > table_allocator;
+        typedef cds::details::Allocator< stash_block > stash_allocator;
+
+        struct hash_value {
+            size_t  nGroup1;
+            size_t  nGroup2;
+            uint8_t nTag;
+        };
+
+        struct find_result {
+            uint8_t *   pTag;
+            slot *      pSlot;
+        };
+        //@endcond
+
+    protected:
+        //@cond
+        atomics::atomic< table * >  m_pTable;   ///< Current table
+        item_counter                m_ItemCounter;
+        atomicity::item_counter     m_SlotCounter;  // occupied slots, drives the resizing whatever item_counter is
+        mutable stat                m_Stat;
+        hash                        m_Hasher;
+        key_equal                   m_Equal;
+        //@endcond
+
+    public:
+        /// Initializes the map
+        /**
+            \p nCapacity is the expected item count. The initial table is about 25% larger,
+            its group count is a power of two.
+        */
+        FlatHashMap( size_t nCapacity = 1024 )
+            : m_pTable( alloc_table( calc_group_count( nCapacity )))
+        {}
+
+        /// Destroys the map
+        ~FlatHashMap()
+        {
+            // The resizing can be unfinished, some items are in the next table
+            table * pTable = m_pTable.load( atomics::memory_order_relaxed );
+            table * pNext = pTable->pNext.load( atomics::memory_order_relaxed );
+            free_table( pTable );
+            if ( pNext )
+                free_table( pNext );
+        }
+
+        /// Inserts new item with key \p key and default mapped value
+        /**
+            Returns \p true if inserting successful, \p false if the map already contains \p key.
+        */
+        bool insert( key_type const& key )
+        {
+            return insert( key, mapped_type());
+        }
+
+        /// Inserts new item with key \p key and mapped value \p val
+        /**
+            Returns \p true if inserting successful, \p false if the map already contains \p key.
+        */
+        bool insert( key_type const& key, mapped_type const& val )
+        {
+            return insert_with( key, [&val]( value_type& item ) { item.second = val; } );
+        }
+
+        /// Inserts new item and initializes it by functor \p func
+        /**
+            The functor signature is:
+            \code
+                struct functor {
+                    void operator()( value_type& item );
+                };
+            \endcode
+            The \p item.second is default-constructed mapped value; the functor is called under the group lock.
+
+            Returns \p true if inserting successful, \p false if the map already contains \p key.
+        */
+        template <typename Func>
+        bool insert_with( key_type const& key, Func func )
+        {
+            std::pair<bool, bool> res = modify( key, [&func]( value_type& item, bool bNew ) { if ( bNew ) func( item ); }, true, false );
+            if ( res.second )
+                m_Stat.onInsertSuccess();
+            else
+                m_Stat.onInsertFailed();
+            return res.second;
+        }
+
+        /// Updates the item with key \p key or inserts new one if \p bAllowInsert is \p true
+        /**
+            The functor signature is:
+            \code
+                struct functor {
+                    void operator()( bool bNew, value_type& item );
+                };
+            \endcode
+            with arguments:
+            - \p bNew - \p true if the item has been inserted, \p false otherwise
+            - \p item - a copy of the item, the new value of \p item.second is stored in the map after the call.
+
+            The functor is called under the group lock.
+
+            Returns <tt> std::pair<bool, bool> </tt> where \p first is \p true if operation is successful,
+            \p second is \p true if new item has been added or \p false if the item with \p key
+            already exists.
+        */
+        template <typename Func>
+        std::pair<bool, bool> update( key_type const& key, Func func, bool bAllowInsert = true )
+        {
+            std::pair<bool, bool> res = modify( key, [&func]( value_type& item, bool bNew ) { func( bNew, item ); }, bAllowInsert, true );
+            if ( !res.first )
+                m_Stat.onUpdateFailed();
+            else if ( res.second )
+                m_Stat.onUpdateNew();
+            else
+                m_Stat.onUpdateExisting();
+            return res;
+        }
+
+        /// Deletes \p key from the map
+        /**
+            Returns \p true if \p key is found and deleted, \p false otherwise.
+        */
+        bool erase( key_type const& key )
+        {
+            return erase( key, []( value_type const& ) {} );
+        }
+
+        /// Deletes \p key from the map calling \p f before deleting
+        /**
+            The functor signature is:
+            \code
+                struct functor {
+                    void operator()( value_type const& item );
+                };
+            \endcode
+            The functor is called under the group lock.
+
+            Returns \p true if \p key is found and deleted, \p false otherwise.
+        */
+        template <typename Func>
+        bool erase( key_type const& key, Func f )
+        {
+            assert( table_access::can_retire());
+
+            hash_value h = hashing( key );
+            bool bFound = false;
+            update_key( h, [&]( table * pTable, group * g1, group * g2, bool& bStash, back_off& ) -> update_status {
+                find_result pos;
+                bFound = locate( pTable, g1, g2, bStash, h.nTag, key, pos );
+                if ( bFound ) {
+                    f( value_type( pos.pSlot->key, pos.pSlot->val ));
+                    *pos.pTag = c_nEmptyTag;
+                    --m_ItemCounter;
+                    --m_SlotCounter;
+                }
+                return update_done;
+            });
+
+            if ( bFound )
+                m_Stat.onEraseSuccess();
+            else
+                m_Stat.onEraseFailed();
+            return bFound;
+        }
+
+        /// Finds \p key and calls \p f for the copy of the item found
+        /**
+            The functor signature is:
+            \code
+                struct functor {
+                    void operator()( value_type const& item );
+                };
+            \endcode
+            The functor is called for a consistent copy of the item after the optimistic read has been validated,
+            the item in the map can be changed concurrently.
+
+            Returns \p true if \p key is found, \p false otherwise.
+        */
+        template <typename Func>
+        bool find( key_type const& key, Func f ) const
+        {
+            slot s;
+            if ( lookup( key, s )) {
+                f( value_type( s.key, s.val ));
+                return true;
+            }
+            return false;
+        }
+
+        /// Checks whether the map contains \p key
+        bool contains( key_type const& key ) const
+        {
+            slot s;
+            return lookup( key, s );
+        }
+
+        /// Clears the map (not atomic)
+        /**
+            The function must be called outside of RCU critical section.
+        */
+        void clear()
+        {
+            assert( table_access::can_retire());
+
+            back_off bkoff;
+            for ( ;; ) {
+                finish_migration( bkoff );
+
+                // The groups are frozen if new resizing has been started meanwhile
+                bool bFrozen = false;
+                {
+                    table_access acc;
+                    table * pTable = acc.protect( m_pTable );
+                    for ( size_t i = 0; i <= pTable->nMask; ++i ) {
+                        group * g = pTable->pGroups + i;
+                        if ( !lock_group( g, bkoff )) {
+                            bFrozen = true;
+                            break;
+                        }
+                        for ( size_t k = 0; k < c_nGroupSize; ++k ) {
+                            if ( g->tags[k] != c_nEmptyTag ) {
+                                g->tags[k] = c_nEmptyTag;
+                                --m_ItemCounter;
+                                --m_SlotCounter;
+                            }
+                        }
+                        unlock_group( g );
+                    }
+                    if ( !bFrozen && lock_stash( pTable, bkoff )) {
+                        for ( stash_block * b = pTable->pStash.load( atomics::memory_order_relaxed ); b; b = b->pNext ) {
+                            for ( size_t k = 0; k < c_nGroupSize; ++k ) {
+                                if ( b->tags[k] != c_nEmptyTag ) {
+                                    b->tags[k] = c_nEmptyTag;
+                                    --m_ItemCounter;
+                                    --m_SlotCounter;
+                                }
+                            }
+                        }
+                        unlock_stash( pTable );
+                    }
+                    else
+                        bFrozen = true;
+                }
+                if ( !bFrozen )
+                    return;
+            }
+        }
+
+        /// Checks if the map is empty
+        /**
+            Emptiness is checked by item counting: if item count is zero then the map is empty.
+            Thus, the correct item counting feature is an important part of the map implementation.
+        */
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+        /// Returns item count in the map
+        size_t size() const
+        {
+            return static_cast<size_t>( m_ItemCounter );
+        }
+
+        /// Returns the number of groups in the current table
+        size_t group_count() const
+        {
+            return m_pTable.load( atomics::memory_order_acquire )->nMask + 1;
+        }
+
+        /// Returns the number of slots in the current table
+        size_t capacity() const
+        {
+            return group_count() * c_nGroupSize;
+        }
+
+        /// Returns const reference to internal statistics
+        stat const& statistics() const
+        {
+            return m_Stat;
+        }
+
+    protected:
+        //@cond
+        static size_t calc_group_count( size_t nCapacity )
+        {
+            size_t nCount = cds::beans::ceil2(( nCapacity + nCapacity / 4 ) / c_nGroupSize + 1 );
+            return nCount < 2 ? 2 : nCount;
+        }
+
+        static table * alloc_table( size_t nGroupCount )
+        {
+            return table_allocator().New( nGroupCount - 1, group_allocator().NewArray( cds::c_nCacheLineSize, nGroupCount ));
+        }
+
+        static void free_table( table * pTable )
+        {
+            stash_block * b = pTable->pStash.load( atomics::memory_order_relaxed );
+            while ( b ) {
+                stash_block * pNext = b->pNext;
+                stash_allocator().Delete( b );
+                b = pNext;
+            }
+            group_allocator().Delete( pTable->pGroups, pTable->nMask + 1 );
+            table_allocator().Delete( pTable );
+        }
+
+        hash_value hashing( key_type const& key ) const
+        {
+            uint64_t h = flat_hashmap::details::mix( static_cast<uint64_t>( m_Hasher( key )));
+            hash_value hv;
+            hv.nGroup1 = static_cast<size_t>( h );
+            hv.nGroup2 = hv.nGroup1 ^ ( static_cast<size_t>( flat_hashmap::details::mix( h >> 32 )) | 1 );
+            hv.nTag = static_cast<uint8_t>(( h >> 57 ) | 0x80 );
+            return hv;
+        }
+
+        // Optimistic read of the group: returns true if the result is consistent.
+        // The items of the frozen group have been moved to the next table, so the frozen group is not searched
+        bool read_group( group const * g, uint8_t nTag, key_type const& key, slot& dest, bool& bFound, uint32_t& nFlags ) const
+        {
+            uint32_t nVersion = g->nVersion.load( atomics::memory_order_acquire );
+            if ( nVersion & c_nLocked )
+                return false;
+            nFlags = nVersion & ( c_nFrozen | c_nOverflow );
+
+            bFound = false;
+            if ( nVersion & c_nFrozen )
+                return true;
+
+            uint32_t nMatch = flat_hashmap::details::match_tags( g->tags, nTag );
+            while ( nMatch ) {
+                slot s = g->slots[ cds::bitop::LSBnz( nMatch ) ];
+                if ( m_Equal( s.key, key )) {
+                    dest = s;
+                    bFound = true;
+                    break;
+                }
+                nMatch &= nMatch - 1;
+            }
+
+            atomics::atomic_thread_fence( atomics::memory_order_acquire );
+            return g->nVersion.load( atomics::memory_order_relaxed ) == nVersion;
+        }
+
+        // Optimistic read of the stash: returns true if the result is consistent
+        bool read_stash( table const * pTable, uint8_t nTag, key_type const& key, slot& dest, bool& bFound, bool& bFrozen ) const
+        {
+            uint32_t nVersion = pTable->nStashVersion.load( atomics::memory_order_acquire );
+            if ( nVersion & c_nLocked )
+                return false;
+
+            bFound = false;
+            bFrozen = ( nVersion & c_nFrozen ) != 0;
+            if ( bFrozen )
+                return true;
+
+            for ( stash_block const * b = pTable->pStash.load( atomics::memory_order_acquire ); b && !bFound; b = b->pNext ) {
+                uint32_t nMatch = flat_hashmap::details::match_tags( b->tags, nTag );
+                while ( nMatch ) {
+                    slot s = b->slots[ cds::bitop::LSBnz( nMatch ) ];
+                    if ( m_Equal( s.key, key )) {
+                        dest = s;
+                        bFound = true;
+                        break;
+                    }
+                    nMatch &= nMatch - 1;
+                }
+            }
+
+            atomics::atomic_thread_fence( atomics::memory_order_acquire );
+            return pTable->nStashVersion.load( atomics::memory_order_relaxed ) == nVersion;
+        }
+
+        bool lookup( key_type const& key, slot& dest ) const
+        {
+            hash_value h = hashing( key );
+            table_access acc;
+            table * pTable = acc.protect( m_pTable );
+
+            back_off bkoff;
+            for ( ;; ) {
+                group const * groups[2] = { pTable->pGroups + ( h.nGroup1 & pTable->nMask ), pTable->pGroups + ( h.nGroup2 & pTable->nMask ) };
+                bool bFound;
+                uint32_t nFlags = 0;
+                for ( group const * g : groups ) {
+                    uint32_t nGroupFlags;
+                    while ( !read_group( g, h.nTag, key, dest, bFound, nGroupFlags )) {
+                        m_Stat.onReadRetry();
+                        bkoff();
+                    }
+                    if ( bFound ) {
+                        m_Stat.onFindSuccess();
+                        return true;
+                    }
+                    nFlags |= nGroupFlags;
+                }
+
+                if ( nFlags & c_nOverflow ) {
+                    bool bFrozen;
+                    while ( !read_stash( pTable, h.nTag, key, dest, bFound, bFrozen )) {
+                        m_Stat.onReadRetry();
+                        bkoff();
+                    }
+                    if ( bFound ) {
+                        m_Stat.onFindSuccess();
+                        return true;
+                    }
+                    if ( bFrozen )
+                        nFlags |= c_nFrozen;
+                }
+
+                if ( !( nFlags & c_nFrozen )) {
+                    m_Stat.onFindFailed();
+                    return false;
+                }
+
+                // The key may have been moved to the next table
+                table * pNext = acc.protect_next( pTable, m_pTable );
+                pTable = pNext ? acc.assign( pNext ) : acc.protect( m_pTable );
+            }
+        }
+
+        // Locks the group; returns false if the group is frozen by resizing
+        bool lock_group( group * g, back_off& bkoff )
+        {
+            for ( ;; ) {
+                uint32_t nVersion = g->nVersion.load( atomics::memory_order_relaxed );
+                if ( nVersion & c_nFrozen )
+                    return false;
+                if ( !( nVersion & c_nLocked )
+                    && g->nVersion.compare_exchange_weak( nVersion, nVersion | c_nLocked, atomics::memory_order_acquire, atomics::memory_order_relaxed ))
+                {
+                    atomics::atomic_thread_fence( atomics::memory_order_release );
+                    return true;
+                }
+                m_Stat.onLockContention();
+                bkoff();
+            }
+        }
+
+        static void unlock_group( group * g )
+        {
+            uint32_t nVersion = g->nVersion.load( atomics::memory_order_relaxed );
+            assert( nVersion & c_nLocked );
+            g->nVersion.store(( nVersion & ~c_nLocked ) + c_nVersionInc, atomics::memory_order_release );
+        }
+
+        // Locks both groups of the key in index order; returns false if any group has been moved to the next table
+        bool lock_groups( table * pTable, hash_value const& h, group *& g1, group *& g2, back_off& bkoff )
+        {
+            g1 = pTable->pGroups + ( h.nGroup1 & pTable->nMask );
+            g2 = pTable->pGroups + ( h.nGroup2 & pTable->nMask );
+            assert( g1 != g2 );
+
+            group * gFirst = g1 < g2 ? g1 : g2;
+            group * gSecond = g1 < g2 ? g2 : g1;
+            if ( lock_group( gFirst, bkoff )) {
+                if ( lock_group( gSecond, bkoff ))
+                    return true;
+                unlock_group( gFirst );
+            }
+            return false;
+        }
+
+        static void unlock_groups( group * g1, group * g2 )
+        {
+            unlock_group( g1 );
+            unlock_group( g2 );
+        }
+
+        // Checks the overflow flag of the groups locked by the caller
+        static bool is_overflowed( group const * g1, group const * g2 )
+        {
+            return (( g1->nVersion.load( atomics::memory_order_relaxed ) | g2->nVersion.load( atomics::memory_order_relaxed )) & c_nOverflow ) != 0;
+        }
+
+        static void set_overflow( group * g )
+        {
+            g->nVersion.store( g->nVersion.load( atomics::memory_order_relaxed ) | c_nOverflow, atomics::memory_order_relaxed );
+        }
+
+        // The stash is changed by the writers holding the locks of both groups of the key, so the stash lock is taken last.
+        // Returns false if the stash has been moved to the next table
+        bool lock_stash( table * pTable, back_off& bkoff )
+        {
+            for ( ;; ) {
+                uint32_t nVersion = pTable->nStashVersion.load( atomics::memory_order_relaxed );
+                if ( nVersion & c_nFrozen )
+                    return false;
+                if ( !( nVersion & c_nLocked )
+                    && pTable->nStashVersion.compare_exchange_weak( nVersion, nVersion | c_nLocked, atomics::memory_order_acquire, atomics::memory_order_relaxed ))
+                {
+                    atomics::atomic_thread_fence( atomics::memory_order_release );
+                    return true;
+                }
+                m_Stat.onLockContention();
+                bkoff();
+            }
+        }
+
+        static void unlock_stash( table * pTable )
+        {
+            uint32_t nVersion = pTable->nStashVersion.load( atomics::memory_order_relaxed );
+            assert( nVersion & c_nLocked );
+            pTable->nStashVersion.store(( nVersion & ~c_nLocked ) + c_nVersionInc, atomics::memory_order_release );
+        }
+
+        bool locate_in( uint8_t * pTags, slot * pSlots, uint8_t nTag, key_type const& key, find_result& pos ) const
+        {
+            uint32_t nMatch = flat_hashmap::details::match_tags( pTags, nTag );
+            while ( nMatch ) {
+                size_t nSlot = static_cast<size_t>( cds::bitop::LSBnz( nMatch ));
+                if ( m_Equal( pSlots[nSlot].key, key )) {
+                    pos.pTag = pTags + nSlot;
+                    pos.pSlot = pSlots + nSlot;
+                    return true;
+                }
+                nMatch &= nMatch - 1;
+            }
+            return false;
+        }
+
+        // Searches the key in locked groups and, if \p bStash, in the stash locked by the caller
+        bool locate( table * pTable, group * g1, group * g2, bool bStash, uint8_t nTag, key_type const& key, find_result& pos ) const
+        {
+            if ( locate_in( g1->tags, g1->slots, nTag, key, pos ) || locate_in( g2->tags, g2->slots, nTag, key, pos ))
+                return true;
+            if ( bStash ) {
+                for ( stash_block * b = pTable->pStash.load( atomics::memory_order_relaxed ); b; b = b->pNext ) {
+                    if ( locate_in( b->tags, b->slots, nTag, key, pos ))
+                        return true;
+                }
+            }
+            return false;
+        }
+
+        // Finds an empty slot in the less loaded group
+        static bool find_empty( group * g1, group * g2, find_result& pos )
+        {
+            uint32_t nEmpty1 = flat_hashmap::details::match_tags( g1->tags, c_nEmptyTag );
+            uint32_t nEmpty2 = flat_hashmap::details::match_tags( g2->tags, c_nEmptyTag );
+            if ( nEmpty1 == 0 && nEmpty2 == 0 )
+                return false;
+
+            group * g = g2;
+            uint32_t nEmpty = nEmpty2;
+            if ( cds::bitop::SBC( nEmpty1 ) >= cds::bitop::SBC( nEmpty2 )) {
+                g = g1;
+                nEmpty = nEmpty1;
+            }
+            size_t const nSlot = static_cast<size_t>( cds::bitop::LSBnz( nEmpty ));
+            pos.pTag = g->tags + nSlot;
+            pos.pSlot = g->slots + nSlot;
+            return true;
+        }
+
+        // Finds an empty slot in the stash locked by the caller (or not published yet), allocates new block if needed
+        static void stash_empty( table * pTable, find_result& pos )
+        {
+            stash_block * pHead = pTable->pStash.load( atomics::memory_order_relaxed );
+            for ( stash_block * b = pHead; b; b = b->pNext ) {
+                uint32_t nEmpty = flat_hashmap::details::match_tags( b->tags, c_nEmptyTag );
+                if ( nEmpty ) {
+                    size_t const nSlot = static_cast<size_t>( cds::bitop::LSBnz( nEmpty ));
+                    pos.pTag = b->tags + nSlot;
+                    pos.pSlot = b->slots + nSlot;
+                    return;
+                }
+            }
+
+            // The new block is linked to the head, the readers may traverse the chain concurrently
+            stash_block * b = stash_allocator().New( pHead );
+            pTable->pStash.store( b, atomics::memory_order_release );
+            pos.pTag = b->tags;
+            pos.pSlot = b->slots;
+        }
+
+        // Returns std::pair< success, inserted >
+        template <typename Func>
+        std::pair<bool, bool> modify( key_type const& key, Func f, bool bAllowInsert, bool bAllowUpdate )
+        {
+            assert( table_access::can_retire());
+
+            hash_value h = hashing( key );
+            std::pair<bool, bool> ret( false, false );
+            update_key( h, [&]( table * pTable, group * g1, group * g2, bool& bStash, back_off& bkoff ) -> update_status {
+                find_result pos;
+                if ( locate( pTable, g1, g2, bStash, h.nTag, key, pos )) {
+                    if ( bAllowUpdate ) {
+                        value_type item( pos.pSlot->key, pos.pSlot->val );
+                        f( item, false );
+                        pos.pSlot->val = item.second;
+                    }
+                    ret.first = bAllowUpdate;
+                    return update_done;
+                }
+                if ( !bAllowInsert )
+                    return update_done;
+
+                if ( !find_empty( g1, g2, pos )) {
+                    if ( static_cast<size_t>( m_SlotCounter ) * 2 >= ( pTable->nMask + 1 ) * c_nGroupSize ) {
+                        if ( pTable->pNext.load( atomics::memory_order_acquire ))
+                            return update_moved;
+                        // The next table of the resizing cannot be resized until it becomes current, its stash takes the item
+                        if ( m_pTable.load( atomics::memory_order_acquire ) == pTable )
+                            return update_grow;
+                    }
+
+                    // The table is sparse, the groups are full because of hash collisions: doubling would not help
+                    if ( !bStash ) {
+                        if ( !lock_stash( pTable, bkoff ))
+                            return update_moved;
+                        bStash = true;
+                    }
+                    set_overflow( g1 );
+                    set_overflow( g2 );
+                    stash_empty( pTable, pos );
+                    m_Stat.onStashInsert();
+                }
+
+                value_type item( key, mapped_type());
+                f( item, true );
+                pos.pSlot->key = key;
+                pos.pSlot->val = item.second;
+                *pos.pTag = h.nTag;
+                ++m_ItemCounter;
+                ++m_SlotCounter;
+                ret.first = ret.second = true;
+                return update_done;
+            });
+            return ret;
+        }
+
+        // Calls f( pTable, g1, g2, bStash, bkoff ) under the locks of the key's groups (and of the stash if bStash)
+        // in the table holding the key. If the table is being resized, the groups of the key are moved
+        // to the next table before the key is looked for there, and the writer helps to move the other groups
+        template <typename Func>
+        void update_key( hash_value const& h, Func f )
+        {
+            back_off bkoff;
+            for ( bool bDone = false; !bDone; ) {
+                table * pRetired = nullptr;
+                {
+                    table_access acc;
+                    table * pTable = acc.protect( m_pTable );
+                    while ( !pRetired ) {
+                        update_status st = update_moved;
+                        group * g1;
+                        group * g2;
+                        if ( lock_groups( pTable, h, g1, g2, bkoff )) {
+                            bool bStash = is_overflowed( g1, g2 );
+                            if ( !bStash || lock_stash( pTable, bkoff ))
+                                st = f( pTable, g1, g2, bStash, bkoff );
+                            else
+                                bStash = false;
+
+                            if ( bStash )
+                                unlock_stash( pTable );
+                            unlock_groups( g1, g2 );
+                        }
+
+                        if ( st == update_done ) {
+                            bDone = true;
+                            if ( pTable->pNext.load( atomics::memory_order_relaxed )) {
+                                table * pNext = acc.protect_next( pTable, m_pTable );
+                                if ( pNext )
+                                    pRetired = help_migrate( pTable, pNext, bkoff );
+                            }
+                            break;
+                        }
+
+                        if ( st == update_grow )
+                            grow( pTable );
+
+                        table * pNext = acc.protect_next( pTable, m_pTable );
+                        if ( !pNext ) {
+                            // The table has been replaced, its items are in the current table
+                            pTable = acc.protect( m_pTable );
+                            continue;
+                        }
+
+                        pRetired = migrate_key( pTable, pNext, h, bkoff );
+                        if ( !pRetired )
+                            pRetired = help_migrate( pTable, pNext, bkoff );
+                        pTable = acc.assign( pNext );
+                    }
+                }
+
+                // The old table is retired outside of the guard / RCU critical section
+                if ( pRetired )
+                    table_access::retire( pRetired, free_table );
+            }
+        }
+
+        // Starts the resizing of the current table pTable
+        void grow( table * pTable )
+        {
+            table * pNew = alloc_table(( pTable->nMask + 1 ) * 2 );
+            table * pExpected = nullptr;
+            if ( pTable->pNext.compare_exchange_strong( pExpected, pNew, atomics::memory_order_acq_rel, atomics::memory_order_acquire ))
+                m_Stat.onResize();
+            else {
+                // Another thread has started the resizing
+                free_table( pNew );
+            }
+        }
+
+        // Inserts the item of the group (or the stash) being moved into the next table.
+        // The key is absent in pTo since all its groups in the old table are not frozen yet;
+        // if both groups are full the item goes to the stash
+        void move_item( table * pTo, slot const& s, uint8_t nTag, back_off& bkoff )
+        {
+            hash_value h = hashing( s.key );
+            group * g1;
+            group * g2;
+            // The next table cannot be resized until the migration is completed
+            CDS_VERIFY( lock_groups( pTo, h, g1, g2, bkoff ));
+
+            find_result pos;
+            bool const bStash = !find_empty( g1, g2, pos );
+            if ( bStash ) {
+                CDS_VERIFY( lock_stash( pTo, bkoff ));
+                set_overflow( g1 );
+                set_overflow( g2 );
+                stash_empty( pTo, pos );
+                m_Stat.onStashInsert();
+            }
+            *pos.pSlot = s;
+            *pos.pTag = nTag;
+
+            if ( bStash )
+                unlock_stash( pTo );
+            unlock_groups( g1, g2 );
+        }
+
+        // Moves the group to pTo and freezes it; returns false if the group has already been moved
+        bool migrate_group( table * pTo, group * g, back_off& bkoff )
+        {
+            if ( !lock_group( g, bkoff ))
+                return false;
+
+            for ( size_t k = 0; k < c_nGroupSize; ++k ) {
+                if ( g->tags[k] != c_nEmptyTag )
+                    move_item( pTo, g->slots[k], g->tags[k], bkoff );
+            }
+
+            // The overflow flag is kept: the readers and the writers of the key check the stash of the old table
+            uint32_t nVersion = g->nVersion.load( atomics::memory_order_relaxed );
+            g->nVersion.store((( nVersion & ~c_nLocked ) + c_nVersionInc ) | c_nFrozen, atomics::memory_order_release );
+            return true;
+        }
+
+        // Moves the stash to pTo and freezes it; returns false if the stash has already been moved
+        bool migrate_stash( table * pFrom, table * pTo, back_off& bkoff )
+        {
+            if ( !lock_stash( pFrom, bkoff ))
+                return false;
+
+            for ( stash_block const * b = pFrom->pStash.load( atomics::memory_order_relaxed ); b; b = b->pNext ) {
+                for ( size_t k = 0; k < c_nGroupSize; ++k ) {
+                    if ( b->tags[k] != c_nEmptyTag )
+                        move_item( pTo, b->slots[k], b->tags[k], bkoff );
+                }
+            }
+
+            uint32_t nVersion = pFrom->nStashVersion.load( atomics::memory_order_relaxed );
+            pFrom->nStashVersion.store((( nVersion & ~c_nLocked ) + c_nVersionInc ) | c_nFrozen, atomics::memory_order_release );
+            return true;
+        }
+
+        // Moves the group nIdx of pFrom (the stash if nIdx == pFrom->nMask + 1) to pTo.
+        // Returns true if it was the last unit: the caller must retire pFrom after leaving the guard
+        bool migrate_unit( table * pFrom, table * pTo, size_t nIdx, back_off& bkoff )
+        {
+            bool const bMoved = nIdx <= pFrom->nMask
+                ? migrate_group( pTo, pFrom->pGroups + nIdx, bkoff )
+                : migrate_stash( pFrom, pTo, bkoff );
+            if ( !bMoved )
+                return false;
+
+            m_Stat.onGroupMigrated();
+            if ( pFrom->nMigrated.fetch_add( 1, atomics::memory_order_acq_rel ) != pFrom->nMask + 1 )
+                return false;
+
+            // All groups and the stash have been moved
+            m_pTable.store( pTo, atomics::memory_order_release );
+            return true;
+        }
+
+        // Moves both groups of the key and, if they are overflowed, the stash; returns pFrom if its migration is completed
+        table * migrate_key( table * pFrom, table * pTo, hash_value const& h, back_off& bkoff )
+        {
+            size_t const nIdx1 = h.nGroup1 & pFrom->nMask;
+            size_t const nIdx2 = h.nGroup2 & pFrom->nMask;
+            if ( migrate_unit( pFrom, pTo, nIdx1, bkoff ) || migrate_unit( pFrom, pTo, nIdx2, bkoff ))
+                return pFrom;
+            if ( is_overflowed( pFrom->pGroups + nIdx1, pFrom->pGroups + nIdx2 ) && migrate_unit( pFrom, pTo, pFrom->nMask + 1, bkoff ))
+                return pFrom;
+            return nullptr;
+        }
+
+        // Moves up to c_nMigrationStep units taken from the migration cursor; returns pFrom if its migration is completed
+        table * help_migrate( table * pFrom, table * pTo, back_off& bkoff )
+        {
+            for ( size_t n = 0; n < c_nMigrationStep; ++n ) {
+                size_t const nIdx = pFrom->nCursor.fetch_add( 1, atomics::memory_order_relaxed );
+                if ( nIdx > pFrom->nMask + 1 )
+                    break;
+                if ( migrate_unit( pFrom, pTo, nIdx, bkoff ))
+                    return pFrom;
+            }
+            return nullptr;
+        }
+
+        // Moves all remaining units of the table being resized and waits until the next table is published
+        void finish_migration( back_off& bkoff )
+        {
+            for ( ;; ) {
+                table * pRetired = nullptr;
+                {
+                    table_access acc;
+                    table * pTable = acc.protect( m_pTable );
+                    if ( !pTable->pNext.load( atomics::memory_order_acquire ))
+                        return;
+
+                    table * pNext = acc.protect_next( pTable, m_pTable );
+                    for ( size_t i = 0; pNext && i <= pTable->nMask + 1; ++i ) {
+                        if ( migrate_unit( pTable, pNext, i, bkoff )) {
+                            pRetired = pTable;
+                            break;
+                        }
+                    }
+                }
+
+                if ( pRetired )
+                    table_access::retire( pRetired, free_table );
+                else {
+                    // The units taken by other threads are being moved
+                    bkoff();
+                }
+            }
+        }
+        //@endcond
+    };
+
+}} // namespace cds::container
+
+#endif // #ifndef CDSLIB_CONTAINER_FLAT_HASHMAP_H
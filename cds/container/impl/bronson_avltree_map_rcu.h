@@ -112,6 +112,7 @@ namespace cds { namespace container {
 #   endif
 
         typedef typename gc::scoped_lock    rcu_lock;  ///< RCU scoped lock
+        typedef typename gc::batch_lock     rcu_batch_lock; ///< RCU batch lock for a sequence of lookups
 
     protected:
         //@cond
@@ -655,6 +656,40 @@ namespace cds { namespace container {
             return do_find( key, key_comparator(), []( node_type * ) -> bool { return true; });
         }
 
+        /// Checks whether the map contains \p key, batch version
+        /**
+            The function is an analog of \p contains(K const&) but it does not lock RCU:
+            the caller holds the batch lock \p bl that covers a sequence of lookups.
+            Before searching the function calls <tt>bl.step()</tt> that can leave RCU critical section
+            for a moment if some thread is waiting in \p synchronize().
+        */
+        template <typename K>
+        bool contains( rcu_batch_lock& bl, K const& key )
+        {
+            return do_find_batch( bl, key, key_comparator(), []( node_type * ) -> bool { return true; });
+        }
+
+        /// Finds the key \p key, batch version
+        /**
+            The function is an analog of \p find(K const&, Func) but it does not lock RCU,
+            see \p contains( rcu_batch_lock&, K const& ).
+        */
+        template <typename K, typename Func>
+        bool find( rcu_batch_lock& bl, K const& key, Func f )
+        {
+            return do_find_batch( bl, key, key_comparator(),
+                [&f]( node_type * pNode ) -> bool {
+                    assert( pNode != nullptr );
+                    mapped_type pVal = pNode->m_pValue.load( memory_model::memory_order_relaxed );
+                    if ( pVal ) {
+                        f( pNode->m_key, *pVal );
+                        return true;
+                    }
+                    return false;
+                }
+            );
+        }
+
         /// Checks whether the map contains \p key using \p pred predicate for searching
         /**
             The function is similar to <tt>contains( key )</tt> but \p pred is used for key comparing.
@@ -668,6 +703,60 @@ namespace cds { namespace container {
             return do_find( key, cds::opt::details::make_comparator_from_less<Less>(), []( node_type * ) -> bool { return true; } );
         }
 
+        /// Calls \p f for each item with key in range <tt>[lo, hi)</tt> in ascending key order
+        /** @anchor cds_container_BronsonAVLTreeMap_rcu_ptr_for_each_in_range
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( key_type const& key, mapped_type& item );
+            };
+            \endcode
+
+            The whole scan is performed inside a single RCU read-side critical section,
+            so the nodes and the values visited cannot be freed while the scan is in progress.
+            The scan walks the tree in-order using a stack of the nodes passed from the root;
+            each node is stamped with its version number. When the scan moves to the next node
+            it re-checks the versions of the nodes it passes through. If some of them has been changed
+            by a concurrent rotation (shrinking) or unlinking, the scan restarts from the root
+            by searching the first key greater than the last key visited. Thus each key is visited at most once
+            and the keys are visited in strictly ascending order. The items that are present in the map
+            during the whole scan are visited; the items inserted or removed concurrently
+            may be visited or not.
+
+            Routing (valueless) nodes are skipped.
+            Unlike \p find(), the functor is called without node-level lock.
+            The functor must not modify the map.
+
+            The function applies RCU lock internally.
+        */
+        template <typename K, typename Func>
+        void for_each_in_range( K const& lo, K const& hi, Func f )
+        {
+            key_comparator cmp;
+            rcu_lock l;
+            do_scan(
+                [&lo, &cmp]( key_type const& key ) -> int { return cmp( lo, key ); },
+                [&hi, &cmp]( key_type const& key ) -> bool { return cmp( key, hi ) < 0; },
+                f );
+        }
+
+        /// Calls \p f for each item of the map in ascending key order
+        /**
+            The function is an analog of \ref cds_container_BronsonAVLTreeMap_rcu_ptr_for_each_in_range "for_each_in_range()"
+            that visits the whole map.
+
+            The function applies RCU lock internally.
+        */
+        template <typename Func>
+        void for_each( Func f )
+        {
+            rcu_lock l;
+            do_scan(
+                []( key_type const& ) -> int { return -1; },
+                []( key_type const& ) -> bool { return true; },
+                f );
+        }
+
         /// Clears the tree (thread safe, not atomic)
         /**
             The function unlink all items from the tree.
@@ -823,6 +912,18 @@ namespace cds { namespace container {
             return result == find_result::found;
         }
 
+        template <typename Q, typename Compare, typename Func>
+        bool do_find_batch( rcu_batch_lock& bl, Q& key, Compare cmp, Func f ) const
+        {
+            // RCU is locked by the batch lock
+            bl.step();
+            assert( gc::is_locked() );
+
+            find_result result = try_find( key, cmp, f, m_pRoot, right_child, 0 );
+            assert( result != find_result::retry );
+            return result == find_result::found;
+        }
+
         template <typename K, typename Compare, typename Func>
         int do_update( K const& key, Compare cmp, Func funcUpdate, int nFlags )
         {
@@ -1056,6 +1157,163 @@ namespace cds { namespace container {
             return find_result::retry;
         }
 
+        struct scan_record
+        {
+            node_type *  pNode;
+            version_type nVersion;
+            int          nDir;   // direction to the next node of the path
+        };
+
+        static CDS_CONSTEXPR int const c_scanEnd = -1;
+        static CDS_CONSTEXPR int const c_scanRestart = -2;
+
+        template <typename Seek, typename InRange, typename Func>
+        void do_scan( Seek seek, InRange in_range, Func f ) const
+        {
+            assert( gc::is_locked() );
+
+            scan_record stack[c_stackSize];
+            int pos = scan_seek( stack, seek, false );
+            while ( pos >= 0 ) {
+                node_type * pNode = stack[pos].pNode;
+                if ( !in_range( pNode->m_key ))
+                    break;
+
+                mapped_type pVal = pNode->m_pValue.load( memory_model::memory_order_acquire );
+                if ( pVal )
+                    f( pNode->m_key, *pVal );
+
+                pos = scan_next( stack, pos );
+                if ( pos == c_scanRestart ) {
+                    // The path has been changed by concurrent update, seek for the successor from the root
+                    m_stat.onRangeRestart();
+                    key_comparator cmp;
+                    pos = scan_seek( stack, [pNode, &cmp]( key_type const& key ) -> int { return cmp( pNode->m_key, key ); }, true );
+                }
+            }
+            m_stat.onRangeScan();
+        }
+
+        // Pushes onto the path the child of the top node in direction stack[pos].nDir.
+        // Returns the new top index, c_scanEnd if there is no such child, or c_scanRestart if the top node has been changed
+        int scan_push_child( scan_record * stack, int pos ) const
+        {
+            node_type * pNode = stack[pos].pNode;
+            version_type nVersion = stack[pos].nVersion;
+            int nDir = stack[pos].nDir;
+
+            while ( true ) {
+                node_type * pChild = child( pNode, nDir, memory_model::memory_order_acquire );
+                if ( !pChild ) {
+                    if ( pNode->version( memory_model::memory_order_acquire ) != nVersion )
+                        return c_scanRestart;
+                    return c_scanEnd;
+                }
+
+                version_type nChildVersion = pChild->version( memory_model::memory_order_acquire );
+                if ( nChildVersion & node_type::shrinking ) {
+                    m_stat.onFindWaitShrinking();
+                    pChild->template wait_until_shrink_completed<back_off>( memory_model::memory_order_acquire );
+                }
+                else if ( nChildVersion != node_type::unlinked && child( pNode, nDir, memory_model::memory_order_acquire ) == pChild ) {
+                    if ( pNode->version( memory_model::memory_order_acquire ) != nVersion )
+                        return c_scanRestart;
+
+                    ++pos;
+                    assert( pos < c_stackSize );
+                    stack[pos].pNode = pChild;
+                    stack[pos].nVersion = nChildVersion;
+                    stack[pos].nDir = left_child;
+                    return pos;
+                }
+
+                if ( pNode->version( memory_model::memory_order_acquire ) != nVersion )
+                    return c_scanRestart;
+            }
+        }
+
+        // Continues the path from stack[pos] in direction stack[pos].nDir to the first node which key is not less than
+        // the key of \p seek (greater than if \p bStrict is \p true). \p seek( node_key ) compares the key sought with node_key.
+        // Returns the index of the node found, nFound if the subtree contains no such node,
+        // or c_scanRestart if the path has been changed by concurrent update
+        template <typename Seek>
+        int scan_descend( scan_record * stack, int pos, Seek seek, bool bStrict, int nFound ) const
+        {
+            while ( true ) {
+                int nChild = scan_push_child( stack, pos );
+                if ( nChild == c_scanEnd )
+                    return nFound;
+                if ( nChild == c_scanRestart )
+                    return c_scanRestart;
+
+                pos = nChild;
+                int nCmp = seek( stack[pos].pNode->m_key );
+                if ( nCmp < 0 || ( nCmp == 0 && !bStrict )) {
+                    nFound = pos;
+                    if ( nCmp == 0 )
+                        return pos;
+                }
+                else
+                    stack[pos].nDir = right_child;
+            }
+        }
+
+        // Builds the version-stamped path from the root, see scan_descend()
+        template <typename Seek>
+        int scan_seek( scan_record * stack, Seek seek, bool bStrict ) const
+        {
+            while ( true ) {
+                stack[0].pNode = m_pRoot;
+                stack[0].nVersion = m_pRoot->version( memory_model::memory_order_acquire );
+                stack[0].nDir = right_child;
+
+                int pos = scan_descend( stack, 0, seek, bStrict, c_scanEnd );
+                if ( pos != c_scanRestart )
+                    return pos;
+                m_stat.onRangeRestart();
+            }
+        }
+
+        // Replaces the top of the path with the in-order successor of the top node.
+        // Returns the index of the successor, c_scanEnd if the top node is the greatest one,
+        // or c_scanRestart if a node of the path has been changed by concurrent update
+        int scan_next( scan_record * stack, int pos ) const
+        {
+            // The successor is the least node of the right subtree...
+            stack[pos].nDir = right_child;
+            int nChild = scan_push_child( stack, pos );
+            if ( nChild == c_scanRestart )
+                return c_scanRestart;
+            if ( nChild != c_scanEnd ) {
+                // A node of the right subtree can grow by a concurrent rotation and, as a result, contain
+                // the keys that are not greater than the top one. So we cannot just take the leftmost node,
+                // we should search for the least key greater than the key of the top node.
+                key_comparator cmp;
+                node_type * pTop = stack[pos].pNode;
+                auto seek = [pTop, &cmp]( key_type const& key ) -> int { return cmp( pTop->m_key, key ); };
+
+                int nFound = c_scanEnd;
+                if ( seek( stack[nChild].pNode->m_key ) < 0 )
+                    nFound = nChild;
+                else
+                    stack[nChild].nDir = right_child;
+
+                nFound = scan_descend( stack, nChild, seek, true, nFound );
+                return nFound == c_scanEnd ? c_scanRestart : nFound;
+            }
+
+            // ... or, if the right subtree is empty, the nearest ancestor which left subtree contains the top node
+            while ( stack[pos].nDir == right_child ) {
+                if ( stack[pos].pNode->version( memory_model::memory_order_acquire ) != stack[pos].nVersion )
+                    return c_scanRestart;
+                if ( --pos < 0 )
+                    return c_scanEnd;
+            }
+            if ( stack[pos].pNode->version( memory_model::memory_order_acquire ) != stack[pos].nVersion )
+                return c_scanRestart;
+            return pos;
+        }
+
         template <typename K, typename Compare, typename Func>
         int try_update_root( K const& key, Compare cmp, int nFlags, Func funcUpdate, rcu_disposer& disp )
         {
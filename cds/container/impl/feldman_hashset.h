@@ -164,6 +164,9 @@ namespace cds { namespace container {
         /**
             @param head_bits: 2<sup>head_bits</sup> specifies the size of head array, minimum is 4.
             @param array_bits: 2<sup>array_bits</sup> specifies the size of array node, minimum is 2.
+            @param max_head_bits: 2<sup>max_head_bits</sup> specifies the max size of head array.
+                If \p traits::head_growth is enabled and \p max_head_bits is greater than \p head_bits the head array grows online,
+                see \ref cds_intrusive_FeldmanHashSet_hp_ctor "intrusive FeldmanHashSet constructor".
 
             Equation for \p head_bits and \p array_bits:
             \code
@@ -171,8 +174,8 @@ namespace cds { namespace container {
             \endcode
             where \p N is multi-level array depth.
         */
-        FeldmanHashSet( size_t head_bits = 8, size_t array_bits = 4 )
-            : base_class( head_bits, array_bits )
+        FeldmanHashSet( size_t head_bits = 8, size_t array_bits = 4, size_t max_head_bits = 0 )
+            : base_class( head_bits, array_bits, max_head_bits )
         {}
 
         /// Destructs the set and frees all data
@@ -89,7 +89,8 @@ namespace cds { namespace container {
         \warning Due to concurrent nature of skip-list set it is not guarantee that you can iterate
         all elements in the set: any concurrent deletion can exclude the element
         pointed by the iterator from the set, and your iteration can be terminated
-        before end of the set. Therefore, such iteration is more suitable for debugging purpose only
+        before end of the set. Therefore, such iteration is more suitable for debugging purpose only.
+        To scan a key range use \p for_each_in_range() or \p snapshot_range().
 
         Remember, each iterator object requires 2 additional hazard pointers, that may be
         a limited resource for \p GC like \p gc::HP (for \p gc::DHP the count of
@@ -678,6 +679,59 @@ namespace cds { namespace container {
             return gp;
         }
 
+        /// Returns an iterator addressing the first item which key is not less than \p key
+        /**
+            The function descends from the upper levels of the skip-list, so the cost is logarithmic.
+            If no such item exists the function returns \p end().
+            The iteration from the iterator returned has the same limitations as one from \p begin().
+        */
+        template <typename K>
+        iterator lower_bound( K const& key )
+        {
+            return iterator( base_class::lower_bound( key ));
+        }
+
+        /// Returns an iterator addressing the first item which key is greater than \p key
+        template <typename K>
+        iterator upper_bound( K const& key )
+        {
+            return iterator( base_class::upper_bound( key ));
+        }
+
+        /// Calls \p f for each item which key is in range <tt>[lo, hi)</tt>
+        /**
+            The items are visited in ascending key order. The functor signature is:
+            \code
+            struct functor {
+                void operator()( value_type& item );
+            };
+            \endcode
+            The functor may change <tt>non-key fields</tt> of \p item.
+
+            The scan is not terminated by concurrent deletions: each item that is in the set during whole scan
+            is visited exactly once, an item inserted or deleted concurrently may or may not be visited.
+            See \ref cds_intrusive_SkipListSet_hp_for_each_in_range "intrusive for_each_in_range()" for details.
+        */
+        template <typename K, typename Func>
+        void for_each_in_range( K const& lo, K const& hi, Func f )
+        {
+            base_class::for_each_in_range( lo, hi, [&f]( node_type& node ) { f( node.m_Value ); } );
+        }
+
+        /// Copies the items of range <tt>[lo, hi)</tt> to \p dest as a linearizable snapshot
+        /**
+            The function is available only if \p Traits::snapshot_counter is \p skip_list::version_counter.
+            \p dest is cleared and then filled by copies of the items in ascending key order
+            via <tt>dest.push_back()</tt>. The copies represent a consistent state of the range at some point of time
+            during the call. If the set is modified while the range is being scanned, the scan is repeated;
+            after several failed attempts the range is scanned with insertions and deletions blocked.
+        */
+        template <typename K, typename Container>
+        void snapshot_range( K const& lo, K const& hi, Container& dest )
+        {
+            base_class::snapshot_range( lo, hi, dest, []( node_type const& node ) -> value_type { return node.m_Value; } );
+        }
+
         /// Clears the set (not atomic).
         /**
             The function deletes all items from the set.
@@ -135,6 +135,7 @@ namespace cds { namespace container {
         typedef typename base_class::rcu_check_deadlock rcu_check_deadlock ; ///< RCU deadlock checking policy
 
         typedef typename gc::scoped_lock    rcu_lock ;  ///< RCU scoped lock
+        typedef typename gc::batch_lock     rcu_batch_lock; ///< RCU batch lock for a sequence of lookups
         static CDS_CONSTEXPR const bool c_bExtractLockExternal = base_class::c_bExtractLockExternal; ///< Group of \p extract_xxx functions require external locking
 
     protected:
@@ -689,6 +690,23 @@ namespace cds { namespace container {
             return find_at( head(), key, typename maker::template less_wrapper<Less>::type(), f );
         }
 
+        /// Finds \p key inside the batch lock \p bl
+        /**
+            The function is an analog of \ref cds_nonintrusive_LazyKVList_rcu_find_func "find(Q const&, Func)"
+            but it does not lock RCU: the RCU is locked by \p bl.
+        */
+        template <typename Q, typename Func>
+        bool find( rcu_batch_lock& bl, Q const& key, Func f ) const
+        {
+            return find_at( bl, head(), key, intrusive_key_comparator(), f );
+        }
+
+        /// Prefetches the first node of the list
+        void prefetch_head() const
+        {
+            CDS_PREFETCH( head().m_pNext.load( memory_model::memory_order_relaxed ).ptr() );
+        }
+
         /// Finds \p key and return the item found
         /** \anchor cds_nonintrusive_LazyKVList_rcu_get
             The function searches the item with \p key and returns the pointer to item found.
@@ -852,6 +870,12 @@ namespace cds { namespace container {
             return base_class::find_at( &refHead, key, cmp, [&f]( node_type& node, K& ){ f( node.m_Data ); });
         }
 
+        template <typename K, typename Compare, typename Func>
+        bool find_at( rcu_batch_lock& bl, head_type& refHead, K& key, Compare cmp, Func f ) const
+        {
+            return base_class::find_at( bl, &refHead, key, cmp, [&f]( node_type& node, K& ){ f( node.m_Data ); });
+        }
+
         template <typename K, typename Compare>
         value_type * get_at( head_type& refHead, K const& val, Compare cmp ) const
         {
@@ -33,6 +33,7 @@
 
 #include <cds/container/details/michael_map_base.h>
 #include <cds/details/allocator.h>
+#include <cds/algo/prefetch.h>
 
 namespace cds { namespace container {
 
@@ -762,6 +763,36 @@ namespace cds { namespace container {
         }
         //@endcond
 
+        /// Finds a batch of keys
+        /** \anchor cds_nonintrusive_MichaelHashMap_find_batch
+            The function searches each key from the range <tt>[itFirst, itLast)</tt> and calls the functor \p f
+            for each item found, the functor interface is the same as for
+            \ref cds_nonintrusive_MichaelMap_find_cfunc "find(K const&, Func)".
+            \p Iterator is a forward iterator with the value type acceptable by \p find().
+
+            Unlike the sequence of \p find() calls, the function computes the hashes and prefetches
+            the buckets for \p cds::algo::c_nPrefetchDistance next keys while the current key is being searched,
+            so the cache misses for several keys overlap, see \p cds::algo::prefetch_pipeline().
+
+            The function returns the number of keys found.
+        */
+        template <typename Iterator, typename Func>
+        size_t find_batch( Iterator itFirst, Iterator itLast, Func f )
+        {
+            typedef typename std::iterator_traits<Iterator>::value_type key_arg;
+            return cds::algo::prefetch_pipeline< cds::algo::c_nPrefetchDistance, bucket_type * >( itFirst, itLast,
+                [this]( key_arg const& key ) -> bucket_type * {
+                    bucket_type * pBucket = &bucket( key );
+                    CDS_PREFETCH( pBucket );
+                    return pBucket;
+                },
+                cds::algo::empty_prefetch_stage(),
+                [&f]( key_arg const& key, bucket_type * pBucket ) -> bool {
+                    return pBucket->find( key, [&f]( value_type& item ) { f( item ); } );
+                }
+            );
+        }
+
         /// Finds \p key and return the item found
         /** \anchor cds_nonintrusive_MichaelHashMap_hp_get
             The function searches the item with key equal to \p key
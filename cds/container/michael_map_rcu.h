@@ -33,6 +33,7 @@
 
 #include <cds/container/details/michael_map_base.h>
 #include <cds/details/allocator.h>
+#include <cds/algo/prefetch.h>
 
 namespace cds { namespace container {
 
@@ -709,6 +710,43 @@ namespace cds { namespace container {
         }
         //@endcond
 
+        /// Finds a batch of keys
+        /**
+            The function searches each key from the range <tt>[itFirst, itLast)</tt> and calls the functor \p f
+            for each item found, the functor interface is the same as for
+            \ref cds_nonintrusive_MichaelMap_rcu_find_cfunc "find(K const&, Func)".
+            \p Iterator is a forward iterator with the value type acceptable by \p find().
+
+            The buckets and their first nodes for next keys are prefetched while the current key is being searched,
+            see \ref cds_nonintrusive_MichaelHashMap_find_batch "MichaelHashMap::find_batch()".
+            The whole batch is performed under one RCU \p batch_lock
+            that yields periodically if some thread is waiting for grace period;
+            the nodes unlinked by the lookups are disposed after the batch lock is released.
+            The function should not be called under RCU lock.
+
+            The function returns the number of keys found.
+        */
+        template <typename Iterator, typename Func>
+        size_t find_batch( Iterator itFirst, Iterator itLast, Func f )
+        {
+            typedef typename std::iterator_traits<Iterator>::value_type key_arg;
+            typename gc::batch_lock bl;
+            return cds::algo::prefetch_pipeline< cds::algo::c_nPrefetchDistance, bucket_type * >( itFirst, itLast,
+                [this]( key_arg const& key ) -> bucket_type * {
+                    bucket_type * pBucket = &bucket( key );
+                    CDS_PREFETCH( pBucket );
+                    return pBucket;
+                },
+                []( bucket_type * pBucket ) {
+                    pBucket->prefetch_head();
+                },
+                [&f, &bl]( key_arg const& key, bucket_type * pBucket ) -> bool {
+                    bl.step();
+                    return pBucket->find( bl, key, [&f]( value_type& item ) { f( item ); } );
+                }
+            );
+        }
+
         /// Finds \p key and return the item found
         /** \anchor cds_nonintrusive_MichaelHashMap_rcu_get
             The function searches the item with key equal to \p key and returns the pointer to item found.
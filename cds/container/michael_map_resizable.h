@@ -0,0 +1,349 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#ifndef CDSLIB_CONTAINER_MICHAEL_MAP_RESIZABLE_H
+#define CDSLIB_CONTAINER_MICHAEL_MAP_RESIZABLE_H
+
+#include <cds/container/details/michael_map_base.h>
+#include <cds/container/details/michael_resizable_base.h>
+
+namespace cds { namespace container {
+
+    /// Michael's hash map with online resizing
+    /** @ingroup cds_nonintrusive_map
+        \anchor cds_nonintrusive_ResizableMichaelHashMap
+
+        The map is a variant of \ref cds_nonintrusive_MichaelHashMap_hp "MichaelHashMap" that doubles
+        its bucket table when the average bucket length exceeds \p nLoadFactor passed to the constructor.
+        The resizing is incremental, see \ref cds_nonintrusive_ResizableMichaelHashSet "ResizableMichaelHashSet"
+        for the algorithm description. Since the items are copied to the new table,
+        \p key_type and \p mapped_type must be copy-constructible.
+
+        Template parameters are the same as for \p MichaelHashMap:
+        - \p GC - Garbage collector used. Note the \p GC must be the same as the \p GC used for \p OrderedList
+        - \p OrderedList - ordered key-value list implementation used as bucket for hash map, for example, \p MichaelKVList,
+            \p LazyKVList. Any \p GC is supported: \p gc::HP, \p gc::DHP and \ref cds_urcu_gc "RCU" - include
+            the ordered list header for the \p GC before this header.
+        - \p Traits - map traits, default is \p michael_map::traits.
+
+        Unlike \p MichaelHashMap the resizable map does not support iterators, \p get() and \p extract().
+
+        For \ref cds_urcu_desc "RCU"-based buckets the modifying member functions must be called
+        outside of RCU critical section.
+    */
+    template <
+        class GC,
+        class OrderedList,
+#ifdef CDS_DOXYGEN_INVOKED
+        class Traits = michael_map::traits
+#else
+        class Traits
+#endif
+    >
+    class ResizableMichaelHashMap
+    {
+    public:
+        typedef GC          gc;          ///< Garbage collector
+        typedef OrderedList bucket_type; ///< type of ordered list to be used as a bucket
+        typedef Traits      traits;      ///< Map traits
+
+        typedef typename bucket_type::key_type    key_type;    ///< key type
+        typedef typename bucket_type::mapped_type mapped_type; ///< value type
+        typedef typename bucket_type::value_type  value_type;  ///< key/value pair stored in the map
+
+        typedef typename bucket_type::key_comparator key_comparator;  ///< key compare functor
+
+        /// Hash functor for \ref key_type and all its derivatives that you use
+        typedef typename cds::opt::v::hash_selector< typename traits::hash >::type hash;
+        typedef typename traits::item_counter  item_counter;   ///< Item counter type
+
+    protected:
+        //@cond
+        typedef michael_set::details::resizable_table< bucket_type, traits, hash, michael_set::details::map_item_policy > table_type;
+        //@endcond
+
+        table_type  m_Table; ///< Bucket table chain
+
+    public:
+        /// Initializes the map
+        /**
+            \p nMaxItemCount and \p nLoadFactor define the initial bucket table size as for \p MichaelHashMap.
+            The table is doubled each time the item count exceeds <tt>bucket_count() * nLoadFactor</tt>.
+        */
+        ResizableMichaelHashMap(
+            size_t nMaxItemCount,   ///< estimation of initial item count in the hash map
+            size_t nLoadFactor      ///< load factor: max average number of items in the bucket
+        ) : m_Table( nMaxItemCount, nLoadFactor )
+        {
+            static_assert( std::is_same<gc, typename bucket_type::gc>::value, "GC and OrderedList::gc must be the same");
+
+            // atomicity::empty_item_counter is not allowed as a item counter
+            static_assert( !std::is_same<item_counter, atomicity::empty_item_counter>::value,
+                           "cds::atomicity::empty_item_counter is not allowed as a item counter");
+        }
+
+        /// Clears hash map object and destroys it
+        ~ResizableMichaelHashMap()
+        {
+            clear();
+        }
+
+        /// Inserts new node with key and default value
+        /**
+            The function creates a node with \p key and default value, and then inserts the node created into the map.
+
+            Returns \p true if inserting successful, \p false otherwise.
+        */
+        template <typename K>
+        bool insert( K const& key )
+        {
+            const bool bRet = m_Table.modify( key, [&key]( bucket_type& b ) { return b.insert( key ); } );
+            if ( bRet )
+                ++m_Table.counter();
+            return bRet;
+        }
+
+        /// Inserts new node
+        /**
+            The function creates a node with copy of \p val value
+            and then inserts the node created into the map.
+
+            Returns \p true if \p val is inserted into the map, \p false otherwise.
+        */
+        template <typename K, typename V>
+        bool insert( K const& key, V const& val )
+        {
+            const bool bRet = m_Table.modify( key, [&key, &val]( bucket_type& b ) { return b.insert( key, val ); } );
+            if ( bRet )
+                ++m_Table.counter();
+            return bRet;
+        }
+
+        /// Inserts new node and initialize it by a functor
+        /**
+            The function is similar to \p MichaelHashMap::insert_with():
+            if inserting is successful, calls <tt>void func( value_type& item )</tt> for the item inserted.
+        */
+        template <typename K, typename Func>
+        bool insert_with( K const& key, Func func )
+        {
+            const bool bRet = m_Table.modify( key, [&key, &func]( bucket_type& b ) { return b.insert_with( key, func ); } );
+            if ( bRet )
+                ++m_Table.counter();
+            return bRet;
+        }
+
+        /// Updates data by \p key
+        /**
+            The function is similar to \p MichaelHashMap::update(): the functor
+            <tt>void func( bool bNew, value_type& item )</tt> is called for the item found or inserted.
+
+            Returns <tt> std::pair<bool, bool> </tt> where \p first is true if operation is successfull,
+            \p second is true if new item has been added or \p false if the item with \p key
+            already exists.
+        */
+        template <typename K, typename Func >
+        std::pair<bool, bool> update( K const& key, Func func, bool bAllowInsert = true )
+        {
+            std::pair<bool, bool> bRet = m_Table.modify( key,
+                [&key, &func, bAllowInsert]( bucket_type& b ) { return b.update( key, func, bAllowInsert ); } );
+            if ( bRet.first && bRet.second )
+                ++m_Table.counter();
+            return bRet;
+        }
+
+        /// For key \p key inserts data of type \p mapped_type created from \p args
+        /**
+            \p key_type should be constructible from type \p K
+
+            Returns \p true if inserting successful, \p false otherwise.
+        */
+        template <typename K, typename... Args>
+        bool emplace( K&& key, Args&&... args )
+        {
+            key_type k( std::forward<K>( key ));
+            mapped_type v( std::forward<Args>( args )... );
+            const bool bRet = m_Table.modify( k, [&k, &v]( bucket_type& b ) { return b.insert( k, v ); } );
+            if ( bRet )
+                ++m_Table.counter();
+            return bRet;
+        }
+
+        /// Deletes \p key from the map
+        /**
+            Return \p true if \p key is found and deleted, \p false otherwise
+        */
+        template <typename K>
+        bool erase( K const& key )
+        {
+            const bool bRet = m_Table.modify( key, [&key]( bucket_type& b ) { return b.erase( key ); } );
+            if ( bRet )
+                --m_Table.counter();
+            return bRet;
+        }
+
+        /// Deletes the item from the map using \p pred predicate for searching
+        /**
+            The function is an analog of \p erase(K const&) but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p Less must imply the same element order as the comparator used for building the map.
+        */
+        template <typename K, typename Less>
+        bool erase_with( K const& key, Less pred )
+        {
+            const bool bRet = m_Table.modify( key, [&key, &pred]( bucket_type& b ) { return b.erase_with( key, pred ); } );
+            if ( bRet )
+                --m_Table.counter();
+            return bRet;
+        }
+
+        /// Deletes \p key from the map
+        /**
+            The function searches an item with key \p key, calls <tt>void f( value_type& item )</tt> functor
+            and deletes the item. If \p key is not found, the functor is not called.
+
+            Return \p true if key is found and deleted, \p false otherwise
+        */
+        template <typename K, typename Func>
+        bool erase( K const& key, Func f )
+        {
+            const bool bRet = m_Table.modify( key, [&key, &f]( bucket_type& b ) { return b.erase( key, f ); } );
+            if ( bRet )
+                --m_Table.counter();
+            return bRet;
+        }
+
+        /// Deletes the item from the map using \p pred predicate for searching
+        /**
+            The function is an analog of \p erase(K const&, Func) but \p pred is used for key comparing.
+        */
+        template <typename K, typename Less, typename Func>
+        bool erase_with( K const& key, Less pred, Func f )
+        {
+            const bool bRet = m_Table.modify( key, [&key, &pred, &f]( bucket_type& b ) { return b.erase_with( key, pred, f ); } );
+            if ( bRet )
+                --m_Table.counter();
+            return bRet;
+        }
+
+        /// Finds the key \p key
+        /**
+            The function searches the item with key equal to \p key and calls the functor
+            <tt>void f( value_type& item )</tt> for item found.
+            The functor may change \p item.second.
+
+            The function returns \p true if \p key is found, \p false otherwise.
+        */
+        template <typename K, typename Func>
+        bool find( K const& key, Func f )
+        {
+            return m_Table.lookup_for_update( key, [&key, &f]( bucket_type& b ) { return b.find( key, f ); } );
+        }
+
+        /// Finds the key \p key using \p pred predicate for searching
+        /**
+            The function is an analog of \p find(K const&, Func) but \p pred is used for key comparing.
+        */
+        template <typename K, typename Less, typename Func>
+        bool find_with( K const& key, Less pred, Func f )
+        {
+            return m_Table.lookup_for_update( key, [&key, &pred, &f]( bucket_type& b ) { return b.find_with( key, pred, f ); } );
+        }
+
+        /// Checks whether the map contains \p key
+        template <typename K>
+        bool contains( K const& key )
+        {
+            return m_Table.lookup( key, [&key]( bucket_type& b ) { return b.contains( key ); } );
+        }
+
+        /// Checks whether the map contains \p key using \p pred predicate for searching
+        template <typename K, typename Less>
+        bool contains( K const& key, Less pred )
+        {
+            return m_Table.lookup( key, [&key, &pred]( bucket_type& b ) { return b.contains( key, pred ); } );
+        }
+
+        /// Clears the map (not atomic)
+        /**
+            The function completes the resizing in progress, if any, then clears each bucket of the current table.
+        */
+        void clear()
+        {
+            m_Table.clear();
+        }
+
+        /// Checks if the map is empty
+        /**
+            Emptiness is checked by item counting: if item count is zero then the map is empty.
+        */
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+        /// Returns item count in the map
+        size_t size() const
+        {
+            return m_Table.counter();
+        }
+
+        /// Returns the size of current bucket table
+        /**
+            The value is doubled on each resizing; while the resizing is in progress
+            the size of the old table is returned.
+        */
+        size_t bucket_count() const
+        {
+            return m_Table.bucket_count();
+        }
+
+        /// Returns the load factor passed to the constructor
+        size_t load_factor() const
+        {
+            return m_Table.load_factor();
+        }
+
+        /// Returns how many times the bucket table has been doubled
+        size_t resize_count() const
+        {
+            return m_Table.resize_count();
+        }
+
+        /// Checks whether the bucket migration is in progress
+        bool is_resizing() const
+        {
+            return m_Table.is_resizing();
+        }
+    };
+
+}} // namespace cds::container
+
+#endif // ifndef CDSLIB_CONTAINER_MICHAEL_MAP_RESIZABLE_H
@@ -0,0 +1,351 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#ifndef CDSLIB_CONTAINER_MICHAEL_SET_RESIZABLE_H
+#define CDSLIB_CONTAINER_MICHAEL_SET_RESIZABLE_H
+
+#include <cds/container/details/michael_resizable_base.h>
+
+namespace cds { namespace container {
+
+    /// Michael's hash set with online resizing
+    /** @ingroup cds_nonintrusive_set
+        \anchor cds_nonintrusive_ResizableMichaelHashSet
+
+        The set is a variant of \ref cds_nonintrusive_MichaelHashSet_hp "MichaelHashSet" that doubles
+        its bucket table when the average bucket length exceeds \p nLoadFactor passed to the constructor.
+        The resizing is incremental: there is no stop-the-world pause. When the table is overloaded,
+        the new table is allocated, and each modifying operation (\p insert, \p update, \p emplace, \p erase)
+        after it completes moves a few buckets (\p michael_set::details::resizable_table::c_nMigrationStep)
+        from the old table to the new one. When all buckets are moved, the new table becomes current.
+
+        The migration of one bucket is short and blocking: the items of the old bucket are copied to the new table,
+        and while copying is in progress the modifying operations on that bucket help to migrate other buckets
+        of the old table instead of spinning. \p contains() is never blocked; \p find() and \p find_with()
+        with a functor are treated as modifying operations since the functor may change the item being copied,
+        but they do not help to migrate. Since the items are copied, \p value_type must be copy-constructible.
+        When all buckets of the old table are moved, its buckets are freed and the rest of the table
+        is retired through \p GC since a slow thread can still read it.
+
+        Template parameters are the same as for \p MichaelHashSet:
+        - \p GC - Garbage collector used. Note the \p GC must be the same as the \p GC used for \p OrderedList
+        - \p OrderedList - ordered list implementation used as bucket for hash set, for example, \p MichaelList, \p LazyList.
+            Any \p GC is supported: \p gc::HP, \p gc::DHP and \ref cds_urcu_gc "RCU" - include the ordered list header
+            for the \p GC before this header.
+        - \p Traits - set traits, default is \p michael_set::traits.
+
+        Unlike \p MichaelHashSet the resizable set does not support iterators, \p get() and \p extract():
+        an item may be moved to another table at any time.
+
+        For \ref cds_urcu_desc "RCU"-based buckets the modifying member functions must be called
+        outside of RCU critical section since they can wait for the bucket migration that calls RCU \p synchronize().
+    */
+    template <
+        class GC,
+        class OrderedList,
+#ifdef CDS_DOXYGEN_INVOKED
+        class Traits = michael_set::traits
+#else
+        class Traits
+#endif
+    >
+    class ResizableMichaelHashSet
+    {
+    public:
+        typedef GC          gc;          ///< Garbage collector
+        typedef OrderedList bucket_type; ///< type of ordered list used as a bucket implementation
+        typedef Traits      traits;      ///< Set traits
+
+        typedef typename bucket_type::value_type     value_type;     ///< type of value to be stored in the list
+        typedef typename bucket_type::key_comparator key_comparator; ///< key comparison functor
+
+        /// Hash functor for \ref value_type and all its derivatives that you use
+        typedef typename cds::opt::v::hash_selector< typename traits::hash >::type hash;
+        typedef typename traits::item_counter item_counter; ///< Item counter type
+
+    protected:
+        //@cond
+        typedef michael_set::details::resizable_table< bucket_type, traits, hash, michael_set::details::set_item_policy > table_type;
+        //@endcond
+
+        table_type  m_Table; ///< Bucket table chain
+
+    public:
+        /// Initialize hash set
+        /**
+            \p nMaxItemCount and \p nLoadFactor define the initial bucket table size as for \p MichaelHashSet.
+            The table is doubled each time the item count exceeds <tt>bucket_count() * nLoadFactor</tt>.
+        */
+        ResizableMichaelHashSet(
+            size_t nMaxItemCount,   ///< estimation of initial item count in the hash set
+            size_t nLoadFactor      ///< load factor: max average number of items in the bucket
+        ) : m_Table( nMaxItemCount, nLoadFactor )
+        {
+            // GC and OrderedList::gc must be the same
+            static_assert( std::is_same<gc, typename bucket_type::gc>::value, "GC and OrderedList::gc must be the same");
+
+            // atomicity::empty_item_counter is not allowed as a item counter
+            static_assert( !std::is_same<item_counter, atomicity::empty_item_counter>::value,
+                           "cds::atomicity::empty_item_counter is not allowed as a item counter");
+        }
+
+        /// Clears hash set and destroys it
+        ~ResizableMichaelHashSet()
+        {
+            clear();
+        }
+
+        /// Inserts new node
+        /**
+            The function creates a node with copy of \p val value
+            and then inserts the node created into the set.
+
+            Returns \p true if \p val is inserted into the set, \p false otherwise.
+        */
+        template <typename Q>
+        bool insert( Q const& val )
+        {
+            const bool bRet = m_Table.modify( val, [&val]( bucket_type& b ) { return b.insert( val ); } );
+            if ( bRet )
+                ++m_Table.counter();
+            return bRet;
+        }
+
+        /// Inserts new node
+        /**
+            The function is similar to \p MichaelHashSet::insert( Q const&, Func ):
+            if inserting is success, calls \p f functor to initialize value-fields of the new item.
+        */
+        template <typename Q, typename Func>
+        bool insert( Q const& val, Func f )
+        {
+            const bool bRet = m_Table.modify( val, [&val, &f]( bucket_type& b ) { return b.insert( val, f ); } );
+            if ( bRet )
+                ++m_Table.counter();
+            return bRet;
+        }
+
+        /// Updates the element
+        /**
+            The function is similar to \p MichaelHashSet::update().
+
+            Returns <tt> std::pair<bool, bool> </tt> where \p first is \p true if operation is successfull,
+            \p second is \p true if new item has been added or \p false if the item with \p key
+            already is in the set.
+        */
+        template <typename Q, typename Func>
+        std::pair<bool, bool> update( Q const& val, Func func, bool bAllowInsert = true )
+        {
+            std::pair<bool, bool> bRet = m_Table.modify( val,
+                [&val, &func, bAllowInsert]( bucket_type& b ) { return b.update( val, func, bAllowInsert ); } );
+            if ( bRet.second )
+                ++m_Table.counter();
+            return bRet;
+        }
+
+        /// Inserts data of type \p value_type constructed from \p args
+        /**
+            Returns \p true if inserting successful, \p false otherwise.
+        */
+        template <typename... Args>
+        bool emplace( Args&&... args )
+        {
+            value_type val( std::forward<Args>( args )... );
+            const bool bRet = m_Table.modify( val, [&val]( bucket_type& b ) { return b.insert( val ); } );
+            if ( bRet )
+                ++m_Table.counter();
+            return bRet;
+        }
+
+        /// Deletes \p key from the set
+        /**
+            Return \p true if key is found and deleted, \p false otherwise
+        */
+        template <typename Q>
+        bool erase( Q const& key )
+        {
+            const bool bRet = m_Table.modify( key, [&key]( bucket_type& b ) { return b.erase( key ); } );
+            if ( bRet )
+                --m_Table.counter();
+            return bRet;
+        }
+
+        /// Deletes the item from the set using \p pred predicate for searching
+        /**
+            The function is an analog of \p erase(Q const&) but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p Less must imply the same element order as the comparator used for building the set.
+        */
+        template <typename Q, typename Less>
+        bool erase_with( Q const& key, Less pred )
+        {
+            const bool bRet = m_Table.modify( key, [&key, &pred]( bucket_type& b ) { return b.erase_with( key, pred ); } );
+            if ( bRet )
+                --m_Table.counter();
+            return bRet;
+        }
+
+        /// Deletes \p key from the set
+        /**
+            The function searches an item with key \p key, calls \p f functor <tt>void f( value_type& item )</tt>
+            and deletes the item. If \p key is not found, the functor is not called.
+
+            Return \p true if key is found and deleted, \p false otherwise
+        */
+        template <typename Q, typename Func>
+        bool erase( Q const& key, Func f )
+        {
+            const bool bRet = m_Table.modify( key, [&key, &f]( bucket_type& b ) { return b.erase( key, f ); } );
+            if ( bRet )
+                --m_Table.counter();
+            return bRet;
+        }
+
+        /// Deletes the item from the set using \p pred predicate for searching
+        /**
+            The function is an analog of \p erase(Q const&, Func) but \p pred is used for key comparing.
+        */
+        template <typename Q, typename Less, typename Func>
+        bool erase_with( Q const& key, Less pred, Func f )
+        {
+            const bool bRet = m_Table.modify( key, [&key, &pred, &f]( bucket_type& b ) { return b.erase_with( key, pred, f ); } );
+            if ( bRet )
+                --m_Table.counter();
+            return bRet;
+        }
+
+        /// Finds the key \p key
+        /**
+            The function searches the item with key equal to \p key and calls the functor
+            <tt>void f( value_type& item, Q& key )</tt> for item found.
+            The functor may change non-key fields of \p item.
+
+            The function returns \p true if \p key is found, \p false otherwise.
+        */
+        template <typename Q, typename Func>
+        bool find( Q& key, Func f )
+        {
+            return m_Table.lookup_for_update( key, [&key, &f]( bucket_type& b ) { return b.find( key, f ); } );
+        }
+        //@cond
+        template <typename Q, typename Func>
+        bool find( Q const& key, Func f )
+        {
+            return m_Table.lookup_for_update( key, [&key, &f]( bucket_type& b ) { return b.find( key, f ); } );
+        }
+        //@endcond
+
+        /// Finds the key \p key using \p pred predicate for searching
+        /**
+            The function is an analog of \p find(Q&, Func) but \p pred is used for key comparing.
+        */
+        template <typename Q, typename Less, typename Func>
+        bool find_with( Q& key, Less pred, Func f )
+        {
+            return m_Table.lookup_for_update( key, [&key, &pred, &f]( bucket_type& b ) { return b.find_with( key, pred, f ); } );
+        }
+        //@cond
+        template <typename Q, typename Less, typename Func>
+        bool find_with( Q const& key, Less pred, Func f )
+        {
+            return m_Table.lookup_for_update( key, [&key, &pred, &f]( bucket_type& b ) { return b.find_with( key, pred, f ); } );
+        }
+        //@endcond
+
+        /// Checks whether the set contains \p key
+        template <typename Q>
+        bool contains( Q const& key )
+        {
+            return m_Table.lookup( key, [&key]( bucket_type& b ) { return b.contains( key ); } );
+        }
+
+        /// Checks whether the set contains \p key using \p pred predicate for searching
+        template <typename Q, typename Less>
+        bool contains( Q const& key, Less pred )
+        {
+            return m_Table.lookup( key, [&key, &pred]( bucket_type& b ) { return b.contains( key, pred ); } );
+        }
+
+        /// Clears the set (not atomic)
+        /**
+            The function completes the resizing in progress, if any, then clears each bucket of the current table.
+        */
+        void clear()
+        {
+            m_Table.clear();
+        }
+
+        /// Checks if the set is empty
+        /**
+            Emptiness is checked by item counting: if item count is zero then the set is empty.
+        */
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+        /// Returns item count in the set
+        size_t size() const
+        {
+            return m_Table.counter();
+        }
+
+        /// Returns the size of current bucket table
+        /**
+            The value is doubled on each resizing; while the resizing is in progress
+            the size of the old table is returned.
+        */
+        size_t bucket_count() const
+        {
+            return m_Table.bucket_count();
+        }
+
+        /// Returns the load factor passed to the constructor
+        size_t load_factor() const
+        {
+            return m_Table.load_factor();
+        }
+
+        /// Returns how many times the bucket table has been doubled
+        size_t resize_count() const
+        {
+            return m_Table.resize_count();
+        }
+
+        /// Checks whether the bucket migration is in progress
+        bool is_resizing() const
+        {
+            return m_Table.is_resizing();
+        }
+    };
+
+}} // namespace cds::container
+
+#endif // ifndef CDSLIB_CONTAINER_MICHAEL_SET_RESIZABLE_H
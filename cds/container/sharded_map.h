@@ -0,0 +1,400 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#ifndef CDSLIB_CONTAINER_SHARDED_MAP_H
+#define CDSLIB_CONTAINER_SHARDED_MAP_H
+
+#include <utility>
+#include <cds/container/details/sharded_map_base.h>
+#include <cds/details/allocator.h>
+#include <cds/os/topology.h>
+
+namespace cds { namespace container {
+
+    /// Hash-partitioned map with NUMA home nodes of the shards
+    /** @ingroup cds_nonintrusive_map
+        \anchor cds_nonintrusive_ShardedMap
+
+        The map partitions the keys by hash into \p ShardCount independent maps of type \p Map, the shards.
+        \p Map can be any map of the library, for example, \p SplitListMap, \p FeldmanHashMap or \p MichaelHashMap.
+        An operation with key \p key is performed on the shard <tt>shard_index( key )</tt> only,
+        so the threads working with different shards do not share any data.
+
+        Each shard has a home NUMA node. The shards are distributed evenly between the online NUMA nodes
+        reported by \p cds::OS::topology::numa_online_node(), the adjacent shards have the same home node.
+        The shard is constructed with the preferred memory policy of its home node
+        (see \p cds::OS::topology::set_numa_preferred_node()), the memory policy of the constructing thread
+        is restored after that. Only the memory allocated at construction time, that is, the shard object
+        and the memory it allocates in the constructor (for example, the bucket table), is placed on the home node
+        if the OS supports it. The nodes the shard allocates later are placed by the memory policy of the thread
+        that inserts them, by default on the node that thread is running on, so the items inserted by the threads
+        running on the home node of the shard are allocated on that node. The map does not move the threads:
+        to avoid cross-node traffic, the application should perform the operations on a shard by the threads bound to its home node,
+        using \p shard_index(), \p home_node() and \p is_local() to route the operations.
+
+        The map forwards the operations to the shard, so the interface of \p %ShardedMap is the interface of \p Map:
+        the functions are available only if \p Map supports them. The return type of a function
+        is the same as for \p Map, for example, \p get() returns \p Map::guarded_ptr.
+        The iterators are not supported, use \p shard() to iterate over a shard.
+
+        \p size() and \p empty() sum up the item counters of the shards, so the result is not
+        an atomic snapshot when the map is being changed.
+
+        Template arguments:
+        - \p Map - the type of shard map
+        - \p ShardCount - the number of shards, should be at least the number of NUMA nodes
+        - \p Traits - map traits, default is \p sharded_map::traits.
+            Instead of defining \p Traits struct you may use option-based syntax with \p sharded_map::make_traits metafunction.
+
+        Example: the map of 16 shards of \p SplitListMap
+        \code
+        #include <cds/container/michael_list_hp.h>
+        #include <cds/container/split_list_map.h>
+        #include <cds/container/sharded_map.h>
+
+        typedef cds::container::SplitListMap< cds::gc::HP, int, std::string, split_list_traits > shard_map;
+        typedef cds::container::ShardedMap< shard_map, 16 > map_type;
+
+        // Each shard is constructed with arguments ( 100000, 1 )
+        map_type theMap( 100000, 1 );
+        \endcode
+    */
+    template <class Map, size_t ShardCount, class Traits>
+    class ShardedMap
+    {
+    public:
+        typedef Map     shard_type; ///< Shard map type
+        typedef Traits  traits;     ///< Map traits
+
+        typedef typename shard_type::key_type    key_type;    ///< Key type
+        typedef typename shard_type::mapped_type mapped_type; ///< Mapped type
+        typedef typename shard_type::value_type  value_type;  ///< Key-value pair type
+        typedef typename shard_type::item_counter item_counter; ///< Item counter type of the shards
+
+        typedef typename cds::opt::v::hash_selector< typename traits::hash >::type hash; ///< Hash functor to select the shard
+        typedef typename traits::allocator allocator; ///< Allocator for the shard objects
+
+        static CDS_CONSTEXPR const size_t c_nShardCount = ShardCount; ///< Shard count
+
+        static_assert( ShardCount > 0, "The shard count must be positive" );
+
+    protected:
+        //@cond
+        typedef cds::details::Allocator< shard_type, allocator > shard_allocator;
+
+        shard_type *    m_arrShards[ ShardCount ];
+        unsigned int    m_arrHomeNode[ ShardCount ];
+        hash            m_Hash;
+        //@endcond
+
+    protected:
+        //@cond
+        static size_t mix( uint64_t h )
+        {
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdULL;
+            h ^= h >> 33;
+            h *= 0xc4ceb9fe1a85ec53ULL;
+            h ^= h >> 33;
+            return static_cast<size_t>( h );
+        }
+
+        template <typename Q>
+        shard_type& shard_for( Q const& key )
+        {
+            return *m_arrShards[ shard_index( key ) ];
+        }
+
+        template <typename Q>
+        shard_type const& shard_for( Q const& key ) const
+        {
+            return *m_arrShards[ shard_index( key ) ];
+        }
+
+        // Sets the preferred NUMA node for the allocations of the current thread while it is alive,
+        // the policy of the thread (set by the application or by numactl) is restored after
+        class numa_preferred_node_scope
+        {
+            cds::OS::topology::numa_memory_policy m_Policy;
+            bool const m_bSet;
+        public:
+            explicit numa_preferred_node_scope( unsigned int nNode )
+                : m_bSet( cds::OS::topology::numa_online_node_count() > 1
+                       && cds::OS::topology::get_numa_memory_policy( m_Policy )
+                       && cds::OS::topology::set_numa_preferred_node( nNode ))
+            {}
+
+            ~numa_preferred_node_scope()
+            {
+                if ( m_bSet )
+                    cds::OS::topology::set_numa_memory_policy( m_Policy );
+            }
+        };
+
+        // Destroys the first nCount shards unless they are released to the map
+        struct shard_array_guard
+        {
+            shard_type ** pShards;
+            size_t        nCount;
+
+            ~shard_array_guard()
+            {
+                for ( size_t i = 0; i < nCount; ++i )
+                    shard_allocator().Delete( pShards[i] );
+            }
+
+            void release()
+            {
+                nCount = 0;
+            }
+        };
+        //@endcond
+
+    public:
+        /// Constructs the map, each shard is constructed with \p args
+        /**
+            If the constructor of a shard throws, the shards already constructed are destroyed
+            and the exception is propagated.
+        */
+        template <typename... Args>
+        explicit ShardedMap( Args const&... args )
+        {
+            shard_array_guard built = { m_arrShards, 0 };
+
+            // Node ids can be sparse, so the shards are mapped onto the list of online nodes
+            unsigned int const nNodeCount = cds::OS::topology::numa_online_node_count();
+            for ( size_t i = 0; i < ShardCount; ++i ) {
+                m_arrHomeNode[i] = cds::OS::topology::numa_online_node( static_cast<unsigned int>( i * nNodeCount / ShardCount ));
+
+                numa_preferred_node_scope ns( m_arrHomeNode[i] );
+                m_arrShards[i] = shard_allocator().New( args... );
+                ++built.nCount;
+            }
+            built.release();
+        }
+
+        //@cond
+        ShardedMap( ShardedMap const& ) = delete;
+        ShardedMap& operator=( ShardedMap const& ) = delete;
+        //@endcond
+
+        /// Destroys the map and all its shards
+        ~ShardedMap()
+        {
+            for ( size_t i = 0; i < ShardCount; ++i )
+                shard_allocator().Delete( m_arrShards[i] );
+        }
+
+    public:
+        /// Returns the index of the shard for \p key
+        /**
+            \p key may be of any type \p Q for which the hash functor is defined
+            and gives the same value as for the equal key of \p key_type.
+        */
+        template <typename Q>
+        size_t shard_index( Q const& key ) const
+        {
+            return mix( static_cast<uint64_t>( m_Hash( key ))) % ShardCount;
+        }
+
+        /// Returns the shard \p nShard, <tt>nShard < ShardCount</tt>
+        shard_type& shard( size_t nShard )
+        {
+            assert( nShard < ShardCount );
+            return *m_arrShards[ nShard ];
+        }
+
+        /// Returns the shard \p nShard, <tt>nShard < ShardCount</tt> (const version)
+        shard_type const& shard( size_t nShard ) const
+        {
+            assert( nShard < ShardCount );
+            return *m_arrShards[ nShard ];
+        }
+
+        /// Returns the shard count
+        static CDS_CONSTEXPR size_t shard_count()
+        {
+            return ShardCount;
+        }
+
+        /// Returns the home NUMA node of the shard \p nShard
+        unsigned int home_node( size_t nShard ) const
+        {
+            assert( nShard < ShardCount );
+            return m_arrHomeNode[ nShard ];
+        }
+
+        /// Checks if the home node of the shard for \p key is the NUMA node of the current processor
+        template <typename Q>
+        bool is_local( Q const& key ) const
+        {
+            return home_node( shard_index( key )) == cds::OS::topology::current_numa_node();
+        }
+
+    public:
+        /// Inserts new item, see \p Map::insert()
+        template <typename K, typename... Args>
+        auto insert( K const& key, Args&&... args )
+            -> decltype( std::declval<shard_type&>().insert( key, std::forward<Args>( args )... ))
+        {
+            return shard_for( key ).insert( key, std::forward<Args>( args )... );
+        }
+
+        /// Inserts new item and initializes it by a functor, see \p Map::insert_with()
+        template <typename K, typename Func>
+        auto insert_with( K const& key, Func func )
+            -> decltype( std::declval<shard_type&>().insert_with( key, func ))
+        {
+            return shard_for( key ).insert_with( key, func );
+        }
+
+        /// Inserts data of type \p mapped_type constructed from \p args, see \p Map::emplace()
+        template <typename K, typename... Args>
+        auto emplace( K&& key, Args&&... args )
+            -> decltype( std::declval<shard_type&>().emplace( std::forward<K>( key ), std::forward<Args>( args )... ))
+        {
+            shard_type& s = shard_for( key );
+            return s.emplace( std::forward<K>( key ), std::forward<Args>( args )... );
+        }
+
+        /// Updates the item, see \p Map::update()
+        template <typename K, typename... Args>
+        auto update( K const& key, Args&&... args )
+            -> decltype( std::declval<shard_type&>().update( key, std::forward<Args>( args )... ))
+        {
+            return shard_for( key ).update( key, std::forward<Args>( args )... );
+        }
+
+        /// Deletes the item, see \p Map::erase()
+        template <typename K, typename... Args>
+        auto erase( K const& key, Args&&... args )
+            -> decltype( std::declval<shard_type&>().erase( key, std::forward<Args>( args )... ))
+        {
+            return shard_for( key ).erase( key, std::forward<Args>( args )... );
+        }
+
+        /// Deletes the item using \p pred for searching, see \p Map::erase_with()
+        template <typename K, typename... Args>
+        auto erase_with( K const& key, Args&&... args )
+            -> decltype( std::declval<shard_type&>().erase_with( key, std::forward<Args>( args )... ))
+        {
+            return shard_for( key ).erase_with( key, std::forward<Args>( args )... );
+        }
+
+        /// Extracts the item, see \p Map::extract()
+        template <typename K>
+        auto extract( K const& key )
+            -> decltype( std::declval<shard_type&>().extract( key ))
+        {
+            return shard_for( key ).extract( key );
+        }
+
+        /// Extracts the item using \p pred for searching, see \p Map::extract_with()
+        template <typename K, typename Less>
+        auto extract_with( K const& key, Less pred )
+            -> decltype( std::declval<shard_type&>().extract_with( key, pred ))
+        {
+            return shard_for( key ).extract_with( key, pred );
+        }
+
+        /// Finds the key and calls the functor for the item found, see \p Map::find()
+        template <typename K, typename Func>
+        auto find( K const& key, Func f )
+            -> decltype( std::declval<shard_type&>().find( key, f ))
+        {
+            return shard_for( key ).find( key, f );
+        }
+
+        /// Finds the key using \p pred for searching, see \p Map::find_with()
+        template <typename K, typename Less, typename Func>
+        auto find_with( K const& key, Less pred, Func f )
+            -> decltype( std::declval<shard_type&>().find_with( key, pred, f ))
+        {
+            return shard_for( key ).find_with( key, pred, f );
+        }
+
+        /// Checks whether the map contains \p key, see \p Map::contains()
+        template <typename K, typename... Args>
+        auto contains( K const& key, Args&&... args )
+            -> decltype( std::declval<shard_type&>().contains( key, std::forward<Args>( args )... ))
+        {
+            return shard_for( key ).contains( key, std::forward<Args>( args )... );
+        }
+
+        /// Finds the key and returns the item found, see \p Map::get()
+        template <typename K>
+        auto get( K const& key )
+            -> decltype( std::declval<shard_type&>().get( key ))
+        {
+            return shard_for( key ).get( key );
+        }
+
+        /// Finds the key using \p pred for searching and returns the item found, see \p Map::get_with()
+        template <typename K, typename Less>
+        auto get_with( K const& key, Less pred )
+            -> decltype( std::declval<shard_type&>().get_with( key, pred ))
+        {
+            return shard_for( key ).get_with( key, pred );
+        }
+
+        /// Clears all shards
+        /**
+            The shards are cleared one by one, so the map is not empty
+            at any moment if other threads insert items concurrently.
+        */
+        void clear()
+        {
+            for ( size_t i = 0; i < ShardCount; ++i )
+                m_arrShards[i]->clear();
+        }
+
+        /// Checks if the map is empty
+        bool empty() const
+        {
+            for ( size_t i = 0; i < ShardCount; ++i ) {
+                if ( !m_arrShards[i]->empty())
+                    return false;
+            }
+            return true;
+        }
+
+        /// Returns item count in the map, the sum of item counts of the shards
+        size_t size() const
+        {
+            size_t nSize = 0;
+            for ( size_t i = 0; i < ShardCount; ++i )
+                nSize += m_arrShards[i]->size();
+            return nSize;
+        }
+    };
+
+}} // namespace cds::container
+
+#endif // #ifndef CDSLIB_CONTAINER_SHARDED_MAP_H
@@ -389,6 +389,37 @@ namespace cds { namespace container {
             return pNode ? &pNode->m_Value : nullptr;
         }
 
+        /// Calls \p f for each item which key is in range <tt>[lo, hi)</tt>
+        /**
+            The items are visited in ascending key order. The functor signature is:
+            \code
+            struct functor {
+                void operator()( value_type& item );
+            };
+            \endcode
+            The functor may change <tt>non-key fields</tt> of \p item.
+            An item inserted concurrently may or may not be visited.
+        */
+        template <typename K, typename Func>
+        void for_each_in_range( K const& lo, K const& hi, Func f ) const
+        {
+            base_class::for_each_in_range( lo, hi, [&f]( node_type& node ) { f( node.m_Value ); } );
+        }
+
+        /// Copies the items of range <tt>[lo, hi)</tt> to \p dest as a linearizable snapshot
+        /**
+            The function is available only if \p Traits::snapshot_counter is \p skip_list::version_counter.
+            \p dest is cleared and then filled by copies of the items in ascending key order
+            via <tt>dest.push_back()</tt>. The copies represent a consistent state of the range at some point of time
+            during the call. If an item is inserted while the range is being scanned, the scan is repeated;
+            after several failed attempts the range is scanned with insertions blocked.
+        */
+        template <typename K, typename Container>
+        void snapshot_range( K const& lo, K const& hi, Container& dest )
+        {
+            base_class::snapshot_range( lo, hi, dest, []( node_type const& node ) -> value_type { return node.m_Value; } );
+        }
+
         /// Clears the set (non-atomic)
         /**
             The function is not atomic.
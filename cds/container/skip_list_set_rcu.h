@@ -209,6 +209,7 @@ namespace cds { namespace container {
 
     public:
         typedef typename base_class::rcu_lock  rcu_lock;   ///< RCU scoped lock
+        typedef typename base_class::rcu_batch_lock rcu_batch_lock; ///< RCU batch lock for a sequence of lookups
         /// Group of \p extract_xxx functions do not require external locking
         static CDS_CONSTEXPR const bool c_bExtractLockExternal = base_class::c_bExtractLockExternal;
 
@@ -637,6 +638,35 @@ namespace cds { namespace container {
         {
             return base_class::contains( key );
         }
+
+        /// Checks whether the set contains \p key, batch version
+        /**
+            The function does not lock RCU: the caller holds the batch lock \p bl
+            that covers a sequence of lookups, see \p cds::intrusive::SkipListSet::contains( rcu_batch_lock&, Q const& ).
+        */
+        template <typename Q>
+        bool contains( rcu_batch_lock& bl, Q const& key )
+        {
+            return base_class::contains( bl, key );
+        }
+
+        /// Finds \p val and applies \p f to the item found, batch version
+        /**
+            The function is an analog of \p find(Q&, Func) but it does not lock RCU:
+            the caller holds the batch lock \p bl that covers a sequence of lookups.
+        */
+        template <typename Q, typename Func>
+        bool find( rcu_batch_lock& bl, Q& val, Func f )
+        {
+            return base_class::find( bl, val, [&f]( node_type& node, Q& v ) { f( node.m_Value, v ); });
+        }
+        //@cond
+        template <typename Q, typename Func>
+        bool find( rcu_batch_lock& bl, Q const& val, Func f )
+        {
+            return base_class::find( bl, val, [&f]( node_type& node, Q const& v ) { f( node.m_Value, v ); });
+        }
+        //@endcond
         //@cond
         template <typename Q>
         CDS_DEPRECATED("deprecated, use contains()")
@@ -718,6 +748,41 @@ namespace cds { namespace container {
             return raw_ptr( base_class::get_with( val, cds::details::predicate_wrapper< node_type, Less, typename maker::value_accessor >() ));
         }
 
+        /// Calls \p f for each item which key is in range <tt>[lo, hi)</tt>
+        /**
+            The items are visited in ascending key order. The functor signature is:
+            \code
+            struct functor {
+                void operator()( value_type& item );
+            };
+            \endcode
+            The functor may change <tt>non-key fields</tt> of \p item.
+
+            The function locks RCU internally, RCU should not be locked by the caller.
+            Each item that is in the set during whole scan is visited exactly once,
+            an item inserted or deleted concurrently may or may not be visited.
+        */
+        template <typename K, typename Func>
+        void for_each_in_range( K const& lo, K const& hi, Func f )
+        {
+            base_class::for_each_in_range( lo, hi, [&f]( node_type& node ) { f( node.m_Value ); } );
+        }
+
+        /// Copies the items of range <tt>[lo, hi)</tt> to \p dest as a linearizable snapshot
+        /**
+            The function is available only if \p Traits::snapshot_counter is \p skip_list::version_counter.
+            RCU should not be locked by the caller.
+            \p dest is cleared and then filled by copies of the items in ascending key order
+            via <tt>dest.push_back()</tt>. The copies represent a consistent state of the range at some point of time
+            during the call. If the set is modified while the range is being scanned, the scan is repeated;
+            after several failed attempts the range is scanned with insertions and deletions blocked.
+        */
+        template <typename K, typename Container>
+        void snapshot_range( K const& lo, K const& hi, Container& dest )
+        {
+            base_class::snapshot_range( lo, hi, dest, []( node_type const& node ) -> value_type { return node.m_Value; } );
+        }
+
         /// Clears the set (non-atomic).
         /**
             The function deletes all items from the set.
@@ -578,6 +578,25 @@ namespace cds { namespace container {
         }
         //@endcond
 
+        /// Finds a batch of keys
+        /**
+            The function searches each key from the range <tt>[itFirst, itLast)</tt> and calls the functor \p f
+            for each item found, the functor interface is the same as for \ref cds_nonintrusive_SplitListMap_find_cfunc "find(K const&, Func)".
+            \p Iterator is a forward iterator with the value type acceptable by \p find().
+
+            The hashes, the bucket table entries and the bucket heads for next keys
+            are prefetched while the current key is being searched,
+            see \ref cds_intrusive_SplitListSet_hp_find_batch "intrusive::SplitListSet::find_batch()".
+
+            The function returns the number of keys found.
+        */
+        template <typename Iterator, typename Func>
+        size_t find_batch( Iterator itFirst, Iterator itLast, Func f )
+        {
+            typedef typename std::iterator_traits<Iterator>::value_type key_arg;
+            return base_class::find_batch( itFirst, itLast, [&f]( value_type& pair, key_arg const& ) { f( pair ); } );
+        }
+
         /// Finds \p key and return the item found
         /** \anchor cds_nonintrusive_SplitListMap_hp_get
             The function searches the item with key equal to \p key
@@ -629,6 +629,29 @@ namespace cds { namespace container {
         }
         //@endcond
 
+        /// Finds a batch of keys
+        /**
+            The function searches each key from the range <tt>[itFirst, itLast)</tt> and calls the functor \p f
+            for each item found, the functor interface is the same as for \ref cds_nonintrusive_SplitListMap_rcu_find_cfunc "find(K const&, Func)".
+            \p Iterator is a forward iterator with the value type acceptable by \p find().
+
+            The hashes, the bucket table entries and the bucket heads for next keys
+            are prefetched while the current key is being searched,
+            see \ref cds_intrusive_SplitListSet_hp_find_batch "intrusive::SplitListSet::find_batch()".
+
+            The whole batch is performed under one RCU \p batch_lock
+            that yields periodically if some thread is waiting for grace period.
+            The function should not be called under RCU lock.
+
+            The function returns the number of keys found.
+        */
+        template <typename Iterator, typename Func>
+        size_t find_batch( Iterator itFirst, Iterator itLast, Func f )
+        {
+            typedef typename std::iterator_traits<Iterator>::value_type key_arg;
+            return base_class::find_batch( itFirst, itLast, [&f]( value_type& pair, key_arg const& ) { f( pair ); } );
+        }
+
         /// Finds \p key and return the item found
         /** \anchor cds_intrusive_SplitListMap_rcu_get
             The function searches the item with key equal to \p key and returns the pointer to item found.
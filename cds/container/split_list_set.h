@@ -731,6 +731,31 @@ namespace cds { namespace container {
         }
         //@endcond
 
+        /// Finds a batch of keys
+        /**
+            The function searches each key from the range <tt>[itFirst, itLast)</tt> and calls the functor \p f
+            for each item found:
+            \code
+            struct functor {
+                void operator()( value_type& item, Q const& key );
+            };
+            \endcode
+            where \p Q is the value type of forward iterator \p Iterator.
+            The functor has the same restrictions as for \ref cds_nonintrusive_SplitListSet_find_func "find(Q&, Func)".
+
+            The hashes, the bucket table entries and the bucket heads for next keys
+            are prefetched while the current key is being searched,
+            see \ref cds_intrusive_SplitListSet_hp_find_batch "intrusive::SplitListSet::find_batch()".
+
+            The function returns the number of keys found.
+        */
+        template <typename Iterator, typename Func>
+        size_t find_batch( Iterator itFirst, Iterator itLast, Func f )
+        {
+            typedef typename std::iterator_traits<Iterator>::value_type key_arg;
+            return base_class::find_batch( itFirst, itLast, [&f]( node_type& item, key_arg const& key ) { f( item.m_Value, key ); } );
+        }
+
         /// Finds the key \p key and return the item found
         /** \anchor cds_nonintrusive_SplitListSet_hp_get
             The function searches the item with key equal to \p key
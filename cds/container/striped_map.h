@@ -97,8 +97,11 @@ namespace cds { namespace container {
 
         The \p Options are:
             - \p cds::opt::mutex_policy - concurrent access policy.
-                Available policies: \p striped_set::striping, \p striped_set::refinable.
+                Available policies: \p striped_set::striping, \p striped_set::refinable, \p striped_set::incremental_refinable,
+                \p striped_set::seqlock_striping.
                 Default is \p %striped_set::striping.
+                \p %seqlock_striping is applicable only to \p boost::container::flat_map bucket
+                with trivially destructible key and value.
             - \p cds::opt::hash - hash functor. Default option value see <tt>opt::v::hash_selector<opt::none> </tt>
                 which selects default hash functor for your compiler.
             - \p cds::opt::compare - key comparison functor. No default functor is provided.
@@ -660,6 +663,7 @@ template <class Container, typename... Options>
 
             if ( bResize )
                 base_class::resize();
+            base_class::help_resize();
 
             return bOk;
         }
@@ -702,6 +706,7 @@ template <class Container, typename... Options>
 
             if ( bResize )
                 base_class::resize();
+            base_class::help_resize();
             return result;
         }
         //@cond
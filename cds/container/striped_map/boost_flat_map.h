@@ -38,6 +38,7 @@
 
 #include <cds/container/striped_set/adapter.h>
 #include <boost/container/flat_map.hpp>
+#include <algorithm>    // std::lower_bound
 
 //#if CDS_COMPILER == CDS_COMPILER_MSVC && CDS_COMPILER_VERSION >= 1700
 //#   error "boost::container::flat_map is not compatible with MS VC++ 11"
@@ -65,6 +66,40 @@ namespace cds { namespace container {
         struct move_item_policy< boost::container::flat_map< Key, T, Traits, Alloc > >
             : public details::boost_map_copy_policies<boost::container::flat_map< Key, T, Traits, Alloc > >::move_item_policy
         {};
+
+        namespace details {
+            // The items of boost::container::flat_map are stored in contiguous array,
+            // so the adapter supports optimistic reading of seqlock_striping policy
+            template <class Map, typename... Options>
+            class boost_flat_map_adapter: public boost_map_adapter< Map, Options... >
+            {
+                typedef boost_map_adapter< Map, Options... > base_class;
+            public:
+                typedef typename base_class::container_type container_type;
+                typedef typename base_class::value_type     value_type;
+                typedef typename base_class::key_type       key_type;
+                typedef typename container_type::key_compare key_compare;
+
+                typedef std::pair< value_type const*, value_type const* > item_range;
+
+                item_range optimistic_range() const
+                {
+                    if ( this->size() == 0 )
+                        return item_range( nullptr, nullptr );
+                    value_type const* pBegin = &*this->begin();
+                    return item_range( pBegin, pBegin + this->size());
+                }
+
+                template <typename Q>
+                static bool optimistic_find( item_range r, Q const& val )
+                {
+                    key_type const key( val );
+                    value_type const* it = std::lower_bound( r.first, r.second, key,
+                        []( value_type const& item, key_type const& k ) { return key_compare()( item.first, k ); } );
+                    return it != r.second && !key_compare()( key, it->first );
+                }
+            };
+        } // namespace details
     }   // namespace striped_set
 }} // namespace cds::container
 
@@ -75,7 +110,7 @@ namespace cds { namespace intrusive { namespace striped_set {
     {
     public:
         typedef boost::container::flat_map< Key, T, Traits, Alloc>     container_type          ;   ///< underlying container type
-        typedef cds::container::striped_set::details::boost_map_adapter< container_type, Options... >    type;
+        typedef cds::container::striped_set::details::boost_flat_map_adapter< container_type, Options... >    type;
     };
 }}} // namespace cds::intrusive::striped_set
 
@@ -62,8 +62,11 @@ namespace cds { namespace container {
 
         The \p Options are:
             - \p opt::mutex_policy - concurrent access policy.
-                Available policies: \p intrusive::striped_set::striping, \p intrusive::striped_set::refinable.
+                Available policies: \p intrusive::striped_set::striping, \p intrusive::striped_set::refinable,
+                \p intrusive::striped_set::incremental_refinable, \p intrusive::striped_set::seqlock_striping.
                 Default is \p %striped_set::striping.
+                \p %seqlock_striping is applicable only to \p std::vector, \p boost::container::vector
+                and \p boost::container::flat_set buckets with trivially destructible \p value_type.
             - \p opt::hash - hash functor. Default option value see <tt>opt::v::hash_selector<opt::none> </tt>
                 which selects default hash functor for your compiler.
             - \p opt::compare - key comparison functor. No default functor is provided.
@@ -612,6 +615,7 @@ namespace cds { namespace container {
 
             if ( bResize )
                 base_class::resize();
+            base_class::help_resize();
             return bOk;
         }
 
@@ -636,6 +640,7 @@ namespace cds { namespace container {
 
             if ( bResize )
                 base_class::resize();
+            base_class::help_resize();
             return bOk;
         }
 
@@ -680,6 +685,7 @@ namespace cds { namespace container {
 
             if ( bResize )
                 base_class::resize();
+            base_class::help_resize();
             return result;
         }
         //@cond
@@ -750,6 +756,7 @@ namespace cds { namespace container {
 
             if ( bOk )
                 --base_class::m_ItemCounter;
+            base_class::help_resize();
             return bOk;
         }
 
@@ -779,6 +786,7 @@ namespace cds { namespace container {
 
             if ( bOk )
                 --base_class::m_ItemCounter;
+            base_class::help_resize();
             return bOk;
         }
 
@@ -234,6 +234,22 @@ namespace cds { namespace container {
         >
         using refinable = cds::intrusive::striped_set::refinable<RecursiveLock, BackOff, Alloc >;
 
+        ///@copydoc cds::intrusive::striped_set::incremental_refinable
+        template <
+            class RecursiveLock = std::recursive_mutex,
+            typename BackOff = cds::backoff::yield,
+            class Alloc = CDS_DEFAULT_ALLOCATOR
+        >
+        using incremental_refinable = cds::intrusive::striped_set::incremental_refinable<RecursiveLock, BackOff, Alloc >;
+
+        ///@copydoc cds::intrusive::striped_set::seqlock_striping
+        template <class RCU, class Lock = std::mutex, unsigned int ReadAttempts = 4, class Alloc = CDS_DEFAULT_ALLOCATOR >
+        using seqlock_striping = cds::intrusive::striped_set::seqlock_striping<RCU, Lock, ReadAttempts, Alloc>;
+
+        ///@copydoc cds::intrusive::striped_set::rcu_retired_allocator
+        template <class RCU, typename T, class Alloc = CDS_DEFAULT_ALLOCATOR >
+        using rcu_retired_allocator = cds::intrusive::striped_set::rcu_retired_allocator<RCU, T, Alloc>;
+
         //@cond
         namespace details {
 
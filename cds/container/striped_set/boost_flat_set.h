@@ -38,6 +38,7 @@
 
 #include <cds/container/striped_set/adapter.h>
 #include <boost/container/flat_set.hpp>
+#include <algorithm>    // std::lower_bound
 
 //#if CDS_COMPILER == CDS_COMPILER_MSVC && CDS_COMPILER_VERSION >= 1700
 //#   error "boost::container::flat_set is not compatible with MS VC++ 11"
@@ -65,6 +66,38 @@ namespace cds { namespace container {
             : public details::boost_set_copy_policies< boost::container::flat_set< T, Traits, Alloc > >::move_item_policy
         {};
 
+        namespace details {
+            // The items of boost::container::flat_set are stored in contiguous array,
+            // so the adapter supports optimistic reading of seqlock_striping policy
+            template <class Set, typename... Options>
+            class boost_flat_set_adapter: public boost_set_adapter< Set, Options... >
+            {
+                typedef boost_set_adapter< Set, Options... > base_class;
+            public:
+                typedef typename base_class::container_type container_type;
+                typedef typename base_class::value_type     value_type;
+                typedef typename container_type::key_compare key_compare;
+
+                typedef std::pair< value_type const*, value_type const* > item_range;
+
+                item_range optimistic_range() const
+                {
+                    if ( this->size() == 0 )
+                        return item_range( nullptr, nullptr );
+                    value_type const* pBegin = &*this->begin();
+                    return item_range( pBegin, pBegin + this->size());
+                }
+
+                template <typename Q>
+                static bool optimistic_find( item_range r, Q const& val )
+                {
+                    value_type const key( val );
+                    value_type const* it = std::lower_bound( r.first, r.second, key, key_compare() );
+                    return it != r.second && !key_compare()( key, *it );
+                }
+            };
+        } // namespace details
+
     }   // namespace striped_set
 }} // namespace cds::container
 
@@ -74,7 +107,7 @@ namespace cds { namespace intrusive { namespace striped_set {
     {
     public:
         typedef boost::container::flat_set<T, Traits, Alloc>    container_type ;   ///< underlying container type
-        typedef cds::container::striped_set::details::boost_set_adapter< container_type, Options... >    type;
+        typedef cds::container::striped_set::details::boost_flat_set_adapter< container_type, Options... >    type;
     };
 }}}
 
@@ -249,6 +249,33 @@ namespace cds { namespace intrusive { namespace striped_set {
                 return true;
             }
 
+            //@cond
+            // Optimistic reading support for seqlock_striping: the items are stored in contiguous array,
+            // so the array can be searched without the lock, see StripedSet::optimistic_find_in_bucket().
+            // The search only tells whether the key is found, the item found can be torn by a concurrent writer
+            typedef std::pair< value_type const*, value_type const* > item_range;
+
+            item_range optimistic_range() const
+            {
+                value_type const* pBegin = m_Vector.data();
+                return item_range( pBegin, pBegin + m_Vector.size());
+            }
+
+            template <typename Q>
+            static bool optimistic_find( item_range r, Q const& val )
+            {
+                value_type const* it = std::lower_bound( r.first, r.second, val, find_predicate() );
+                return it != r.second && key_comparator()( val, *it ) == 0;
+            }
+
+            template <typename Q, typename Less>
+            static bool optimistic_find( item_range r, Q const& val, Less pred )
+            {
+                value_type const* it = std::lower_bound( r.first, r.second, val, pred );
+                return it != r.second && !pred( val, *it ) && !pred( *it, val );
+            }
+            //@endcond
+
             /// Clears the container
             void clear()
             {
@@ -0,0 +1,408 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#ifndef CDSLIB_CONTAINER_UNROLLED_SKIP_LIST_MAP_H
+#define CDSLIB_CONTAINER_UNROLLED_SKIP_LIST_MAP_H
+
+#include <cds/container/unrolled_skip_list_set.h>
+#include <cds/details/binary_functor_wrapper.h>
+
+namespace cds { namespace container {
+
+    //@cond
+    namespace details {
+
+        template <typename GC, typename K, typename T, typename Traits>
+        struct make_unrolled_skip_list_map
+        {
+            typedef K       key_type;
+            typedef T       mapped_type;
+            typedef std::pair< key_type const, mapped_type > value_type;
+
+            struct key_accessor
+            {
+                key_type const& operator()( value_type const& item ) const
+                {
+                    return item.first;
+                }
+            };
+            typedef typename opt::details::make_comparator< key_type, Traits >::type key_comparator;
+
+            struct set_traits: public Traits
+            {
+                typedef cds::details::compare_wrapper< value_type, key_comparator, key_accessor > compare;
+            };
+
+            typedef UnrolledSkipListSet< GC, value_type, set_traits > type;
+        };
+
+    } // namespace details
+    //@endcond
+
+    /// Unrolled skip-list map
+    /** @ingroup cds_nonintrusive_map
+        \anchor cds_nonintrusive_UnrolledSkipListMap
+
+        The map of <tt>std::pair< Key const, T ></tt> items based on \ref cds_nonintrusive_UnrolledSkipListSet "UnrolledSkipListSet":
+        the items are stored in the sorted chunks of \p Traits::node_capacity items, the chunks are
+        linked into a skip-list. See \p UnrolledSkipListSet for the algorithm description.
+
+        Since the items are moved between chunks, the map has no iterators, no \p get() and no \p extract():
+        the item can be accessed only by a functor called under the chunk lock.
+        \p Key and \p T should be copy-constructible.
+
+        Template arguments:
+        - \p GC - garbage collector used: \p gc::HP, \p gc::DHP, \p gc::HE or \p gc::EBR. RCU is not supported.
+        - \p Key - key type of an item stored in the map. It should be copy-constructible
+        - \p T - value type stored in the map
+        - \p Traits - map traits, default is \p unrolled_skip_list::traits.
+            It is possible to declare option-based map with \p cds::container::unrolled_skip_list::make_traits metafunction
+            instead of \p Traits template argument.
+
+        You should include the header of the \p GC and <tt><cds/container/unrolled_skip_list_map.h></tt>.
+    */
+    template <
+        class GC,
+        typename Key,
+        typename T,
+#ifdef CDS_DOXYGEN_INVOKED
+        class Traits = unrolled_skip_list::traits
+#else
+        class Traits
+#endif
+    >
+    class UnrolledSkipListMap:
+#ifdef CDS_DOXYGEN_INVOKED
+        protected UnrolledSkipListSet< GC, std::pair< Key const, T >, Traits >
+#else
+        protected details::make_unrolled_skip_list_map< GC, Key, T, Traits >::type
+#endif
+    {
+        //@cond
+        typedef details::make_unrolled_skip_list_map< GC, Key, T, Traits > maker;
+        typedef typename maker::type base_class;
+        //@endcond
+    public:
+        typedef GC      gc;             ///< Garbage collector
+        typedef Key     key_type;       ///< Key type
+        typedef T       mapped_type;    ///< Mapped type
+        typedef Traits  traits;         ///< Map traits
+        typedef typename maker::value_type  value_type;     ///< Value type stored in the map
+
+#   ifdef CDS_DOXYGEN_INVOKED
+        typedef implementation_defined key_comparator;  ///< key comparison functor based on \p opt::compare and \p opt::less option setter.
+#   else
+        typedef typename maker::key_comparator key_comparator;
+#   endif
+        typedef typename base_class::item_counter   item_counter;   ///< Item counting policy used
+        typedef typename base_class::memory_model   memory_model;   ///< Memory ordering. See cds::opt::memory_model option
+        typedef typename base_class::random_level_generator random_level_generator; ///< random level generator
+        typedef typename base_class::allocator_type allocator_type; ///< Allocator type used for allocate/deallocate the chunk nodes
+        typedef typename base_class::back_off       back_off;       ///< Back-off strategy
+        typedef typename base_class::lock_type      lock_type;      ///< Lock type of a chunk node
+        typedef typename base_class::stat           stat;           ///< Internal statistics type
+
+        static CDS_CONSTEXPR const size_t c_nNodeCapacity = base_class::c_nNodeCapacity;     ///< Max count of items in a chunk node
+        static CDS_CONSTEXPR const size_t c_nHazardPtrCount = base_class::c_nHazardPtrCount; ///< Count of hazard pointers required
+
+    public:
+        /// Default ctor
+        UnrolledSkipListMap()
+            : base_class()
+        {}
+
+        /// Destructor destroys the map object
+        ~UnrolledSkipListMap()
+        {}
+
+    public:
+        /// Inserts new item with key and default value
+        /**
+            The function creates an item with \p key and default value, and then inserts the item into the map.
+
+            Preconditions:
+            - The \p key_type should be constructible from a value of type \p K.
+                In trivial case, \p K is equal to \p key_type.
+            - The \p mapped_type should be default-constructible.
+
+            Returns \p true if inserting successful, \p false otherwise.
+        */
+        template <typename K>
+        bool insert( K const& key )
+        {
+            return insert_with( key, []( value_type& ) {} );
+        }
+
+        /// Inserts new item
+        /**
+            The function creates an item with copy of \p val value
+            and then inserts the item into the map.
+
+            Preconditions:
+            - The \p key_type should be constructible from \p key of type \p K.
+            - The \p mapped_type should be assignable from \p val of type \p V.
+
+            Returns \p true if \p val is inserted into the map, \p false otherwise.
+        */
+        template <typename K, typename V>
+        bool insert( K const& key, V const& val )
+        {
+            return insert_with( key, [&val]( value_type& item ) { item.second = val; } );
+        }
+
+        /// Inserts new item and initializes it by a functor
+        /**
+            This function inserts new item with key \p key and if inserting is successful then it calls
+            \p func functor with signature
+            \code
+                struct functor {
+                    void operator()( value_type& item );
+                };
+            \endcode
+
+            The argument \p item of user-defined functor \p func is the reference
+            to the map's item inserted:
+                - <tt>item.first</tt> is a const reference to item's key that cannot be changed.
+                - <tt>item.second</tt> is a reference to item's value that may be changed.
+
+            The functor is called under the chunk lock.
+        */
+        template <typename K, typename Func>
+        bool insert_with( K const& key, Func func )
+        {
+            value_type v( key, mapped_type());
+            return base_class::insert_( v, func );
+        }
+
+        /// For key \p key inserts data of type \p mapped_type created in-place from <tt>std::forward<Args>(args)...</tt>
+        /**
+            Returns \p true if inserting successful, \p false otherwise.
+        */
+        template <typename K, typename... Args>
+        bool emplace( K&& key, Args&&... args )
+        {
+            value_type v( std::forward<K>( key ), mapped_type( std::forward<Args>( args )... ));
+            return base_class::insert_( v, []( value_type& ) {} );
+        }
+
+        /// Updates data by \p key
+        /**
+            If the \p key not found in the map, then the new item created from \p key
+            will be inserted into the map iff \p bInsert is \p true
+            (note that in this case the \ref key_type should be constructible from type \p K).
+            Otherwise, if \p key is found, the functor \p func is called with item found.
+            The functor \p Func signature:
+            \code
+                struct my_functor {
+                    void operator()( bool bNew, value_type& item );
+                };
+            \endcode
+            where:
+            - \p bNew - \p true if the item has been inserted, \p false otherwise
+            - \p item - item of the map
+
+            The functor may change any fields of the \p item.second; it is called under the chunk lock.
+
+            Returns <tt> std::pair<bool, bool> </tt> where \p first is \p true if operation is successful,
+            \p second is \p true if new item has been added or \p false if \p key already exists.
+        */
+        template <typename K, typename Func>
+        std::pair<bool, bool> update( K const& key, Func func, bool bInsert = true )
+        {
+            return base_class::update_( key, typename base_class::key_comparator(), func,
+                [&key]() { return value_type( key, mapped_type()); },
+                bInsert );
+        }
+
+        /// Delete \p key from the map
+        /**
+            Return \p true if \p key is found and deleted, \p false otherwise
+        */
+        template <typename K>
+        bool erase( K const& key )
+        {
+            return base_class::erase( key );
+        }
+
+        /// Deletes the item from the map using \p pred predicate for searching
+        /**
+            The function is an analog of \p erase(K const&)
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p Less must imply the same element order as the comparator used for building the map.
+        */
+        template <typename K, typename Less>
+        bool erase_with( K const& key, Less pred )
+        {
+            CDS_UNUSED( pred );
+            return base_class::erase_with( key, cds::details::predicate_wrapper< value_type, Less, typename maker::key_accessor >());
+        }
+
+        /// Delete \p key from the map
+        /**
+            The function searches an item with key \p key, calls \p f functor
+            and deletes the item. If \p key is not found, the functor is not called.
+
+            The functor \p Func interface:
+            \code
+            struct extractor {
+                void operator()(value_type& item) { ... }
+            };
+            \endcode
+
+            Return \p true if key is found and deleted, \p false otherwise
+        */
+        template <typename K, typename Func>
+        bool erase( K const& key, Func f )
+        {
+            return base_class::erase( key, [&f]( value_type& item ) { f( item ); } );
+        }
+
+        /// Deletes the item from the map using \p pred predicate for searching
+        /**
+            The function is an analog of \p erase(K const&, Func)
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p Less must imply the same element order as the comparator used for building the map.
+        */
+        template <typename K, typename Less, typename Func>
+        bool erase_with( K const& key, Less pred, Func f )
+        {
+            CDS_UNUSED( pred );
+            return base_class::erase_with( key, cds::details::predicate_wrapper< value_type, Less, typename maker::key_accessor >(),
+                [&f]( value_type& item ) { f( item ); } );
+        }
+
+        /// Finds the key \p key
+        /**
+            The function searches the item with key equal to \p key and calls the functor \p f for item found.
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( value_type& item );
+            };
+            \endcode
+            where \p item is the item found.
+
+            The functor may change \p item.second; it is called under the chunk lock.
+
+            The function returns \p true if \p key is found, \p false otherwise.
+        */
+        template <typename K, typename Func>
+        bool find( K const& key, Func f )
+        {
+            return base_class::find( key, [&f]( value_type& item, K const& ) { f( item ); } );
+        }
+
+        /// Finds the key \p val using \p pred predicate for searching
+        /**
+            The function is an analog of \p find(K const&, Func)
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p Less must imply the same element order as the comparator used for building the map.
+        */
+        template <typename K, typename Less, typename Func>
+        bool find_with( K const& key, Less pred, Func f )
+        {
+            CDS_UNUSED( pred );
+            return base_class::find_with( key, cds::details::predicate_wrapper< value_type, Less, typename maker::key_accessor >(),
+                [&f]( value_type& item, K const& ) { f( item ); } );
+        }
+
+        /// Checks whether the map contains \p key
+        template <typename K>
+        bool contains( K const& key )
+        {
+            return base_class::contains( key );
+        }
+
+        /// Checks whether the map contains \p key using \p pred predicate for searching
+        /**
+            The function is similar to <tt>contains( key )</tt> but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p Less must imply the same element order as the comparator used for building the map.
+        */
+        template <typename K, typename Less>
+        bool contains( K const& key, Less pred )
+        {
+            CDS_UNUSED( pred );
+            return base_class::contains( key, cds::details::predicate_wrapper< value_type, Less, typename maker::key_accessor >());
+        }
+
+        /// Calls \p f for each item of the map in ascending key order
+        /**
+            The functor interface:
+            \code
+            struct functor {
+                void operator()( value_type& item );
+            };
+            \endcode
+            See \p UnrolledSkipListSet::for_each() for details.
+        */
+        template <typename Func>
+        void for_each( Func f )
+        {
+            base_class::for_each( f );
+        }
+
+        /// Clears the map (not atomic)
+        void clear()
+        {
+            base_class::clear();
+        }
+
+        /// Checks if the map is empty
+        bool empty() const
+        {
+            return base_class::empty();
+        }
+
+        /// Returns item count in the map
+        /**
+            The value returned depends on item counter type provided by \p Traits template parameter.
+            If it is \p atomicity::empty_item_counter this function always returns 0.
+            Therefore, the function is not suitable for checking the map emptiness, use \p empty()
+            member function for this purpose.
+        */
+        size_t size() const
+        {
+            return base_class::size();
+        }
+
+        /// Returns const reference to internal statistics
+        stat const& statistics() const
+        {
+            return base_class::statistics();
+        }
+    };
+
+}} // namespace cds::container
+
+#endif // #ifndef CDSLIB_CONTAINER_UNROLLED_SKIP_LIST_MAP_H
@@ -0,0 +1,1011 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#ifndef CDSLIB_CONTAINER_UNROLLED_SKIP_LIST_SET_H
+#define CDSLIB_CONTAINER_UNROLLED_SKIP_LIST_SET_H
+
+#include <mutex>        // unique_lock
+#include <type_traits>  // aligned_storage
+#include <cds/container/details/unrolled_skip_list_base.h>
+#include <cds/opt/compare.h>
+
+namespace cds { namespace container {
+
+    /// Unrolled skip-list set
+    /** @ingroup cds_nonintrusive_set
+        \anchor cds_nonintrusive_UnrolledSkipListSet
+
+        The unrolled (fat-node) skip-list keeps the items in the chunk nodes. A chunk node
+        stores up to \p Traits::node_capacity items in a sorted array, the chunks are linked into
+        a skip-list by their lower bound. So, a lookup goes down the index levels by the chunk bounds
+        and then makes a binary search inside the chunk found. Compared to \p SkipListSet, which allocates
+        a node with a tower for each item, the unrolled skip-list allocates a node per 16 - 32 items,
+        its index is 16 - 32 times smaller and a range of neighbouring keys is located in adjacent memory,
+        that is more cache-friendly for lookups and ordered traversal.
+
+        Each chunk has its own lock (\p Traits::lock_type). An operation searches the chunk without locking,
+        locks it and validates that the chunk is still alive and still covers the key; otherwise the search is repeated.
+        The items of a chunk are accessed only under the chunk lock.
+        - A full chunk is split in halves: the upper half is moved to a new chunk which is published
+          in the bottom level under the lock of the split chunk. The index levels of the new chunk are linked after that.
+        - When a chunk has lost three quarters of its items, it is merged into its left neighbour if
+          the items fit in. The chunk is marked as removed, unlinked and retired via \p GC.
+        The index levels above the bottom level are changed only on split and merge, i.e. once per several dozens
+          of insertions or erasures. A chunk tower is linked bottom-up and unlinked top-down level by level,
+          each level is changed under the index lock of the predecessor chunk in that level, so the splits and merges
+          of distant chunks do not wait for each other.
+        The readers are guarded by the \p GC guards, so the search never waits for the index locks.
+
+        Since the items are moved between chunks and inside a chunk, the set has no iterators, no \p get()
+        and no \p extract() member functions: the item can be accessed only by a functor called under the chunk lock.
+        The functor must be fast and must not call the set's member functions.
+        The value type should be move-constructible and copy-constructible: a copy of the first item
+        of the upper half is the lower bound of the new chunk.
+
+        Template arguments:
+        - \p GC - garbage collector used: \p gc::HP, \p gc::DHP, \p gc::HE or \p gc::EBR. RCU is not supported.
+        - \p T - type to be stored in the set
+        - \p Traits - set traits, default is \p unrolled_skip_list::traits.
+            It is possible to declare option-based set with \p cds::container::unrolled_skip_list::make_traits metafunction
+            instead of \p Traits template argument.
+
+        The set requires up to 4 hazard pointers per thread.
+
+        You should include the header of the \p GC and <tt><cds/container/unrolled_skip_list_set.h></tt>.
+    */
+    template <
+        class GC,
+        typename T,
+#ifdef CDS_DOXYGEN_INVOKED
+        class Traits = unrolled_skip_list::traits
+#else
+        class Traits
+#endif
+    >
+    class UnrolledSkipListSet
+    {
+    public:
+        typedef GC     gc;          ///< Garbage collector
+        typedef T      value_type;  ///< Value type to be stored in the set
+        typedef Traits traits;      ///< Set traits
+
+#   ifdef CDS_DOXYGEN_INVOKED
+        typedef implementation_defined key_comparator;  ///< key comparison functor based on \p opt::compare and \p opt::less option setter.
+#   else
+        typedef typename opt::details::make_comparator< value_type, traits >::type key_comparator;
+#   endif
+        typedef typename traits::item_counter   item_counter;   ///< Item counting policy used
+        typedef typename traits::memory_model   memory_model;   ///< Memory ordering. See cds::opt::memory_model option
+        typedef typename traits::random_level_generator random_level_generator; ///< random level generator
+        typedef typename traits::allocator      allocator_type; ///< Allocator type used for allocate/deallocate the chunk nodes
+        typedef typename traits::back_off       back_off;       ///< Back-off strategy
+        typedef typename traits::lock_type      lock_type;      ///< Lock type of a chunk node
+        typedef typename traits::stat           stat;           ///< Internal statistics type
+
+        static CDS_CONSTEXPR const size_t c_nNodeCapacity = traits::node_capacity;   ///< Max count of items in a chunk node
+        static CDS_CONSTEXPR const unsigned int c_nMaxHeight = random_level_generator::c_nUpperBound; ///< Max height of a chunk node
+        static CDS_CONSTEXPR const size_t c_nHazardPtrCount = 4; ///< Count of hazard pointers required
+
+        static_assert( c_nNodeCapacity >= 4, "unrolled_skip_list::node_capacity must be at least 4" );
+
+    protected:
+        //@cond
+        struct node;
+        typedef atomics::atomic< node * > atomic_node_ptr;
+        typedef typename std::aligned_storage< sizeof( value_type ), alignof( value_type )>::type value_storage;
+
+        struct node
+        {
+            lock_type               m_Lock;         // protects m_nSize, the items and m_arrNext[0] changing
+            lock_type               m_IndexLock;    // protects the index levels of the tower changing
+            atomics::atomic<bool>   m_bRemoved;     // the chunk has been merged into its left neighbour
+            unsigned int const      m_nHeight;
+            bool const              m_bHead;
+            size_t                  m_nSize;
+            atomic_node_ptr *       m_arrNext;      // tower, m_arrNext[0] is the bottom level
+            value_storage           m_Low;          // lower bound, not constructed for the head node
+            value_storage           m_arrItems[c_nNodeCapacity];
+
+            // head node
+            node( unsigned int nHeight, atomic_node_ptr * pTower )
+                : m_bRemoved( false )
+                , m_nHeight( nHeight )
+                , m_bHead( true )
+                , m_nSize( 0 )
+                , m_arrNext( pTower )
+            {
+                init_tower();
+            }
+
+            node( unsigned int nHeight, atomic_node_ptr * pTower, value_type const& low )
+                : m_bRemoved( false )
+                , m_nHeight( nHeight )
+                , m_bHead( false )
+                , m_nSize( 0 )
+                , m_arrNext( pTower )
+            {
+                new ( &m_Low ) value_type( low );
+                init_tower();
+            }
+
+            ~node()
+            {
+                for ( size_t i = 0; i < m_nSize; ++i )
+                    item_ptr( i )->~value_type();
+                if ( !m_bHead )
+                    reinterpret_cast<value_type *>( &m_Low )->~value_type();
+            }
+
+            value_type const& low() const
+            {
+                assert( !m_bHead );
+                return *reinterpret_cast<value_type const *>( &m_Low );
+            }
+
+            value_type * item_ptr( size_t nIndex )
+            {
+                assert( nIndex < c_nNodeCapacity );
+                return reinterpret_cast<value_type *>( &m_arrItems[nIndex] );
+            }
+
+            value_type& item( size_t nIndex )
+            {
+                assert( nIndex < m_nSize );
+                return *item_ptr( nIndex );
+            }
+
+            atomic_node_ptr& next( unsigned int nLevel )
+            {
+                assert( nLevel < m_nHeight );
+                return m_arrNext[nLevel];
+            }
+
+        private:
+            void init_tower()
+            {
+                for ( unsigned int i = 0; i < m_nHeight; ++i )
+                    new ( m_arrNext + i ) atomic_node_ptr( nullptr );
+            }
+        };
+
+        typedef typename allocator_type::template rebind< unsigned char >::other raw_allocator;
+        typedef typename gc::Guard guard;
+
+        static CDS_CONSTEXPR const size_t c_nTowerOffset = ( sizeof( node ) + sizeof( atomic_node_ptr ) - 1 ) / sizeof( atomic_node_ptr ) * sizeof( atomic_node_ptr );
+
+        static CDS_CONSTEXPR size_t node_size( unsigned int nHeight )
+        {
+            return c_nTowerOffset + nHeight * sizeof( atomic_node_ptr );
+        }
+        //@endcond
+
+    protected:
+        //@cond
+        atomic_node_ptr         m_HeadTower[c_nMaxHeight];
+        node                    m_Head;
+        atomics::atomic<unsigned int> m_nHeight;    // current height of the list
+        random_level_generator  m_RandomLevelGen;
+        item_counter            m_ItemCounter;
+        mutable stat            m_Stat;
+        //@endcond
+
+    public:
+        /// Default ctor
+        UnrolledSkipListSet()
+            : m_Head( c_nMaxHeight, m_HeadTower )
+            , m_nHeight( 1 )
+        {}
+
+        /// Destructor destroys the set object
+        ~UnrolledSkipListSet()
+        {
+            node * pNode = m_Head.next( 0 ).load( atomics::memory_order_relaxed );
+            while ( pNode ) {
+                node * pNext = pNode->next( 0 ).load( atomics::memory_order_relaxed );
+                free_node( pNode );
+                pNode = pNext;
+            }
+        }
+
+    public:
+        /// Inserts new item
+        /**
+            The function creates an item with copy of \p val value
+            and then inserts the item into the set.
+
+            The type \p Q should contain as minimum the complete key for the item.
+            The object of \ref value_type should be constructible from a value of type \p Q.
+            In trivial case, \p Q is equal to \ref value_type.
+
+            Returns \p true if \p val is inserted into the set, \p false otherwise.
+        */
+        template <typename Q>
+        bool insert( Q const& val )
+        {
+            value_type v( val );
+            return insert_( v, []( value_type& ) {} );
+        }
+
+        /// Inserts new item
+        /**
+            The function allows to split creating of new item into two part:
+            - create item with key only
+            - insert new item into the set
+            - if inserting is success, calls \p f functor to initialize value-fields of new item.
+
+            The functor signature is:
+            \code
+                void func( value_type& val );
+            \endcode
+            where \p val is the item inserted. The functor is called under the chunk lock.
+
+            The user-defined functor is called only if the inserting is success.
+        */
+        template <typename Q, typename Func>
+        bool insert( Q const& val, Func f )
+        {
+            value_type v( val );
+            return insert_( v, f );
+        }
+
+        /// Updates the item
+        /**
+            If the item \p val not found in the set, then \p val is inserted into the set
+            iff \p bInsert is \p true.
+            Otherwise, the functor \p func is called with item found.
+            The functor signature is:
+            \code
+                void func( bool bNew, value_type& item, const Q& val );
+            \endcode
+            with arguments:
+            - \p bNew - \p true if the item has been inserted, \p false otherwise
+            - \p item - item of the set
+            - \p val - argument \p val passed into the \p %update() function
+
+            The functor may change non-key fields of the \p item; the functor is called under the chunk lock.
+
+            Returns <tt> std::pair<bool, bool> </tt> where \p first is \p true if operation is successful,
+            \p second is \p true if new item has been added or \p false if the item with \p key
+            already exists.
+        */
+        template <typename Q, typename Func>
+        std::pair<bool, bool> update( Q const& val, Func func, bool bInsert = true )
+        {
+            return update_( val, key_comparator(),
+                [&func, &val]( bool bNew, value_type& item ) { func( bNew, item, val ); },
+                [&val]() { return value_type( val ); },
+                bInsert );
+        }
+
+        /// Inserts data of type \p value_type created in-place from <tt>std::forward<Args>(args)...</tt>
+        /**
+            Returns \p true if inserting successful, \p false otherwise.
+        */
+        template <typename... Args>
+        bool emplace( Args&&... args )
+        {
+            value_type v( std::forward<Args>( args )... );
+            return insert_( v, []( value_type& ) {} );
+        }
+
+        /// Delete \p key from the set
+        /**
+            The set item comparator should be able to compare the type \p value_type
+            and the type \p Q.
+
+            Return \p true if key is found and deleted, \p false otherwise
+        */
+        template <typename Q>
+        bool erase( Q const& key )
+        {
+            return erase_( key, key_comparator(), []( value_type const& ) {} );
+        }
+
+        /// Deletes the item from the set using \p pred predicate for searching
+        /**
+            The function is an analog of \p erase(Q const&)
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p Less must imply the same element order as the comparator used for building the set.
+        */
+        template <typename Q, typename Less>
+        bool erase_with( Q const& key, Less pred )
+        {
+            CDS_UNUSED( pred );
+            return erase_( key, cds::opt::details::make_comparator_from_less<Less>(), []( value_type const& ) {} );
+        }
+
+        /// Delete \p key from the set
+        /**
+            The function searches an item with key \p key, calls \p f functor
+            and deletes the item. If \p key is not found, the functor is not called.
+
+            The functor \p Func interface:
+            \code
+            struct extractor {
+                void operator()(value_type const& val);
+            };
+            \endcode
+
+            Since the key of skip-list's item is immutable, the type \p Q may be differ from \p value_type.
+            The set item comparator should be able to compare the values of type \p value_type
+            and the type \p Q.
+
+            Return \p true if key is found and deleted, \p false otherwise
+        */
+        template <typename Q, typename Func>
+        bool erase( Q const& key, Func f )
+        {
+            return erase_( key, key_comparator(), f );
+        }
+
+        /// Deletes the item from the set using \p pred predicate for searching
+        /**
+            The function is an analog of \p erase(Q const&, Func)
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p Less must imply the same element order as the comparator used for building the set.
+        */
+        template <typename Q, typename Less, typename Func>
+        bool erase_with( Q const& key, Less pred, Func f )
+        {
+            CDS_UNUSED( pred );
+            return erase_( key, cds::opt::details::make_comparator_from_less<Less>(), f );
+        }
+
+        /// Finds the key \p key
+        /**
+            The function searches the item with key equal to \p key and calls the functor \p f for item found.
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( value_type& item, Q& key );
+            };
+            \endcode
+            where \p item is the item found, \p key is the <tt>find</tt> function argument.
+
+            The functor may change non-key fields of \p item. The functor is called under the chunk lock.
+
+            The type \p Q can differ from \p value_type of items storing in the set.
+
+            The function returns \p true if \p key is found, \p false otherwise.
+        */
+        template <typename Q, typename Func>
+        bool find( Q& key, Func f )
+        {
+            return find_( key, key_comparator(), f );
+        }
+        //@cond
+        template <typename Q, typename Func>
+        bool find( Q const& key, Func f )
+        {
+            return find_( key, key_comparator(), f );
+        }
+        //@endcond
+
+        /// Finds the key \p key using \p pred predicate for searching
+        /**
+            The function is an analog of \p find(Q&, Func)
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p Less must imply the same element order as the comparator used for building the set.
+        */
+        template <typename Q, typename Less, typename Func>
+        bool find_with( Q& key, Less pred, Func f )
+        {
+            CDS_UNUSED( pred );
+            return find_( key, cds::opt::details::make_comparator_from_less<Less>(), f );
+        }
+        //@cond
+        template <typename Q, typename Less, typename Func>
+        bool find_with( Q const& key, Less pred, Func f )
+        {
+            CDS_UNUSED( pred );
+            return find_( key, cds::opt::details::make_comparator_from_less<Less>(), f );
+        }
+        //@endcond
+
+        /// Checks whether the set contains \p key
+        /**
+            The function searches the item with key equal to \p key
+            and returns \p true if it is found, and \p false otherwise.
+        */
+        template <typename Q>
+        bool contains( Q const& key )
+        {
+            return find_( key, key_comparator(), []( value_type&, Q const& ) {} );
+        }
+
+        /// Checks whether the set contains \p key using \p pred predicate for searching
+        /**
+            The function is similar to <tt>contains( key )</tt> but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p Less must imply the same element order as the comparator used for building the set.
+        */
+        template <typename Q, typename Less>
+        bool contains( Q const& key, Less pred )
+        {
+            CDS_UNUSED( pred );
+            return find_( key, cds::opt::details::make_comparator_from_less<Less>(), []( value_type&, Q const& ) {} );
+        }
+
+        /// Calls \p f for each item of the set in ascending key order
+        /**
+            The functor interface:
+            \code
+            struct functor {
+                void operator()( value_type& item );
+            };
+            \endcode
+            The functor is called under the lock of the chunk containing \p item; it may change non-key fields of \p item.
+
+            The traversal is performed chunk by chunk, so concurrent insertions and erasures
+            may or may not be visible. Each item that is in the set during the whole traversal is visited exactly once.
+        */
+        template <typename Func>
+        void for_each( Func f )
+        {
+            scan_( [&f]( value_type& item ) -> bool { f( item ); return true; } );
+        }
+
+        /// Clears the set
+        /**
+            The chunks are merged into the head chunk one by one and all items are destroyed.
+            The function is not atomic: the items inserted concurrently may remain in the set.
+        */
+        void clear()
+        {
+            guard gPred;
+            guard gCur;
+            while ( true ) {
+                std::unique_lock< lock_type > lHead( m_Head.m_Lock );
+                clear_items( &m_Head );
+
+                node * pNext = m_Head.next( 0 ).load( memory_model::memory_order_relaxed );
+                if ( !pNext )
+                    break;
+
+                {
+                    std::unique_lock< lock_type > lNext( pNext->m_Lock );
+                    clear_items( pNext );
+                    pNext->m_bRemoved.store( true, memory_model::memory_order_release );
+                    m_Head.next( 0 ).store( pNext->next( 0 ).load( memory_model::memory_order_relaxed ), memory_model::memory_order_release );
+                }
+                lHead.unlock();
+
+                unlink_index( pNext, gPred, gCur );
+                retire_node( pNext );
+            }
+        }
+
+        /// Checks if the set is empty
+        /**
+            The function traverses the chunks until the first item is found.
+        */
+        bool empty() const
+        {
+            bool bEmpty = true;
+            const_cast<UnrolledSkipListSet *>( this )->scan_( [&bEmpty]( value_type& ) -> bool { bEmpty = false; return false; } );
+            return bEmpty;
+        }
+
+        /// Returns item count in the set
+        /**
+            The value returned depends on item counter type provided by \p Traits template parameter.
+            If it is \p atomicity::empty_item_counter this function always returns 0.
+            Therefore, the function is not suitable for checking the set emptiness, use \p empty()
+            member function for this purpose.
+        */
+        size_t size() const
+        {
+            return m_ItemCounter;
+        }
+
+        /// Returns const reference to internal statistics
+        stat const& statistics() const
+        {
+            return m_Stat;
+        }
+
+    protected:
+        //@cond
+        unsigned int random_level()
+        {
+            // Random generator produces a number from range [0..31]
+            // We need a number from range [1..32]
+            return m_RandomLevelGen() + 1;
+        }
+
+        node * alloc_node( unsigned int nHeight, value_type const& low )
+        {
+            unsigned char * pMem = raw_allocator().allocate( node_size( nHeight ));
+            node * pNode = new ( pMem ) node( nHeight, reinterpret_cast<atomic_node_ptr *>( pMem + c_nTowerOffset ), low );
+            m_Stat.onNodeCreated();
+            return pNode;
+        }
+
+        static void free_node( node * pNode )
+        {
+            unsigned int const nHeight = pNode->m_nHeight;
+            pNode->~node();
+            raw_allocator().deallocate( reinterpret_cast<unsigned char *>( pNode ), node_size( nHeight ));
+        }
+
+        void retire_node( node * pNode )
+        {
+            m_Stat.onNodeRetired();
+            gc::retire( pNode, free_node );
+        }
+
+        static void relocate( value_type * pDest, value_type * pSrc )
+        {
+            new ( pDest ) value_type( std::move( *pSrc ));
+            pSrc->~value_type();
+        }
+
+        void clear_items( node * pNode )
+        {
+            for ( size_t i = 0; i < pNode->m_nSize; ++i ) {
+                pNode->item_ptr( i )->~value_type();
+                --m_ItemCounter;
+            }
+            pNode->m_nSize = 0;
+        }
+
+        // Returns the position of the first item that is not less than key
+        template <typename Q, typename Compare>
+        static size_t lower_bound( node * pNode, Q const& key, Compare cmp )
+        {
+            size_t nLow = 0;
+            size_t nHigh = pNode->m_nSize;
+            while ( nLow < nHigh ) {
+                size_t const nMid = ( nLow + nHigh ) / 2;
+                if ( cmp( *pNode->item_ptr( nMid ), key ) < 0 )
+                    nLow = nMid + 1;
+                else
+                    nHigh = nMid;
+            }
+            return nLow;
+        }
+
+        // Finds the rightmost alive chunk whose lower bound is less than (bStrict) or equal to key.
+        // The chunk found is guarded by gPred
+        template <typename Q, typename Compare>
+        node * search( Q const& key, Compare cmp, bool bStrict, guard& gPred, guard& gCur )
+        {
+        retry:
+            node * pPred = &m_Head;
+            gPred.clear();
+            for ( int nLevel = static_cast<int>( m_nHeight.load( memory_model::memory_order_acquire )) - 1; nLevel >= 0; --nLevel ) {
+                while ( true ) {
+                    node * pCur = gCur.protect( pPred->next( nLevel ));
+                    if ( pPred->m_bRemoved.load( memory_model::memory_order_acquire )) {
+                        // pPred has been merged, its tower may point to retired nodes
+                        m_Stat.onSearchRetry();
+                        goto retry;
+                    }
+
+                    // A removed chunk is skipped: its items have been moved to its left neighbour
+                    if ( !pCur || pCur->m_bRemoved.load( memory_model::memory_order_acquire ))
+                        break;
+
+                    int const nCmp = cmp( pCur->low(), key );
+                    if ( nCmp > 0 || ( bStrict && nCmp == 0 ))
+                        break;
+
+                    pPred = pCur;
+                    gPred.copy( gCur );
+                }
+            }
+            return pPred;
+        }
+
+        // Finds and locks the chunk that should contain key. The chunk is guarded by gPred
+        template <typename Q, typename Compare>
+        node * lock_chunk( Q const& key, Compare cmp, guard& gPred, guard& gCur )
+        {
+            back_off bkoff;
+            while ( true ) {
+                node * pNode = search( key, cmp, false, gPred, gCur );
+                pNode->m_Lock.lock();
+                if ( !pNode->m_bRemoved.load( memory_model::memory_order_relaxed )) {
+                    // The next chunk cannot be retired while pNode is locked
+                    node * pNext = pNode->next( 0 ).load( memory_model::memory_order_relaxed );
+                    if ( !pNext || cmp( pNext->low(), key ) > 0 )
+                        return pNode;
+                }
+
+                // pNode has been split or merged after the search
+                pNode->m_Lock.unlock();
+                m_Stat.onSearchRetry();
+                bkoff();
+            }
+        }
+
+        // Moves the upper half of the full locked chunk to new chunk.
+        // The new chunk is published in the bottom level, locked and guarded by gNew
+        node * split( node * pNode, guard& gNew )
+        {
+            assert( pNode->m_nSize == c_nNodeCapacity );
+            size_t const nHalf = c_nNodeCapacity / 2;
+
+            node * pNew = alloc_node( random_level(), *pNode->item_ptr( nHalf ));
+            for ( size_t i = nHalf; i < c_nNodeCapacity; ++i )
+                relocate( pNew->item_ptr( i - nHalf ), pNode->item_ptr( i ));
+            pNew->m_nSize = c_nNodeCapacity - nHalf;
+            pNode->m_nSize = nHalf;
+
+            pNew->m_Lock.lock();
+            gNew.assign( pNew );
+            pNew->next( 0 ).store( pNode->next( 0 ).load( memory_model::memory_order_relaxed ), memory_model::memory_order_relaxed );
+            pNode->next( 0 ).store( pNew, memory_model::memory_order_release );
+
+            m_Stat.onNodeSplit();
+            return pNew;
+        }
+
+        // Finds the predecessor of pNode in the index level nLevel. The upper levels are passed by the lower bound
+        // strictly less than pNode's one; in nLevel the chunks with the same lower bound are passed too unless bStrict.
+        // The predecessor found is guarded by gPred, its successor pSucc is guarded by gCur
+        node * index_pred( node * pNode, unsigned int nLevel, bool bStrict, node *& pSucc, guard& gPred, guard& gCur )
+        {
+            key_comparator cmp;
+        retry:
+            node * pPred = &m_Head;
+            gPred.clear();
+            unsigned int const nHeight = m_nHeight.load( memory_model::memory_order_acquire );
+            for ( unsigned int nCur = ( nHeight > nLevel ? nHeight : nLevel + 1 ) - 1; ; --nCur ) {
+                node * pCur;
+                while ( true ) {
+                    pCur = gCur.protect( pPred->next( nCur ));
+                    if ( pPred->m_bRemoved.load( memory_model::memory_order_acquire )) {
+                        // pPred has been merged, its tower may point to retired nodes
+                        m_Stat.onIndexRetry();
+                        goto retry;
+                    }
+
+                    // A removed chunk cannot be passed: the nodes after it may be retired
+                    if ( !pCur || pCur == pNode || pCur->m_bRemoved.load( memory_model::memory_order_acquire ))
+                        break;
+                    int const nCmp = cmp( pCur->low(), pNode->low());
+                    if ( nCmp > 0 || ( nCmp == 0 && ( bStrict || nCur != nLevel )))
+                        break;
+
+                    pPred = pCur;
+                    gPred.copy( gCur );
+                }
+
+                if ( nCur == nLevel ) {
+                    pSucc = pCur;
+                    return pPred;
+                }
+            }
+        }
+
+        // Links the index levels of pNode bottom-up unless it has been merged already.
+        // pNode is guarded by the caller
+        void link_index( node * pNode, guard& gPred, guard& gCur )
+        {
+            key_comparator cmp;
+            back_off bkoff;
+            for ( unsigned int nLevel = 1; nLevel < pNode->m_nHeight; ) {
+                node * pSucc;
+                node * pPred = index_pred( pNode, nLevel, true, pSucc, gPred, gCur );
+
+                // pSucc may be a removed chunk that is being unlinked, wait for it
+                if ( !pSucc || !pSucc->m_bRemoved.load( memory_model::memory_order_acquire ) || cmp( pSucc->low(), pNode->low()) >= 0 ) {
+                    std::unique_lock< lock_type > lNode( pNode->m_IndexLock );
+                    if ( pNode->m_bRemoved.load( memory_model::memory_order_relaxed ))
+                        return; // unlink_index() unlinks the levels linked so far
+
+                    std::unique_lock< lock_type > lPred( pPred->m_IndexLock );
+                    if ( !pPred->m_bRemoved.load( memory_model::memory_order_relaxed )
+                      && pPred->next( nLevel ).load( memory_model::memory_order_relaxed ) == pSucc )
+                    {
+                        pNode->next( nLevel ).store( pSucc, memory_model::memory_order_relaxed );
+                        pPred->next( nLevel ).store( pNode, memory_model::memory_order_release );
+                        ++nLevel;
+                        continue;
+                    }
+                }
+
+                m_Stat.onIndexRetry();
+                bkoff();
+            }
+
+            unsigned int nHeight = m_nHeight.load( memory_model::memory_order_relaxed );
+            while ( nHeight < pNode->m_nHeight
+                 && !m_nHeight.compare_exchange_weak( nHeight, pNode->m_nHeight, memory_model::memory_order_release, atomics::memory_order_relaxed ))
+            {}
+        }
+
+        // Unlinks the index levels of the removed chunk top-down. pNode is guarded by the caller or not retired yet
+        void unlink_index( node * pNode, guard& gPred, guard& gCur )
+        {
+            assert( pNode->m_bRemoved.load( atomics::memory_order_relaxed ));
+            if ( pNode->m_nHeight == 1 )
+                return;
+
+            // After this barrier no index level of pNode is linked anymore
+            // and no chunk is linked after pNode since pNode is removed
+            { std::unique_lock< lock_type > l( pNode->m_IndexLock ); }
+
+            back_off bkoff;
+            for ( unsigned int nLevel = pNode->m_nHeight - 1; nLevel > 0; ) {
+                // A newer chunk with the same lower bound may be linked before pNode
+                node * pSucc;
+                node * pPred = index_pred( pNode, nLevel, false, pSucc, gPred, gCur );
+                if ( pSucc == pNode ) {
+                    std::unique_lock< lock_type > lPred( pPred->m_IndexLock );
+                    if ( !pPred->m_bRemoved.load( memory_model::memory_order_relaxed )
+                      && pPred->next( nLevel ).load( memory_model::memory_order_relaxed ) == pNode )
+                    {
+                        pPred->next( nLevel ).store( pNode->next( nLevel ).load( memory_model::memory_order_relaxed ), memory_model::memory_order_release );
+                        --nLevel;
+                        continue;
+                    }
+                }
+                else if ( !pSucc || !pSucc->m_bRemoved.load( memory_model::memory_order_acquire ) || key_comparator()( pSucc->low(), pNode->low()) > 0 ) {
+                    // pNode has not been linked in nLevel
+                    --nLevel;
+                    continue;
+                }
+
+                // pPred has been changed or a removed chunk before pNode is being unlinked
+                m_Stat.onIndexRetry();
+                bkoff();
+            }
+        }
+
+        // Merges pNode into its left neighbour if the items fit in. pNode is guarded by the caller
+        void merge( node * pNode )
+        {
+            guard gPred;
+            guard gCur;
+            node * pPred = search( pNode->low(), key_comparator(), true, gPred, gCur );
+
+            bool bMerged = false;
+            {
+                std::unique_lock< lock_type > lPred( pPred->m_Lock );
+                std::unique_lock< lock_type > lNode( pNode->m_Lock );
+                if ( !pPred->m_bRemoved.load( memory_model::memory_order_relaxed )
+                  && !pNode->m_bRemoved.load( memory_model::memory_order_relaxed )
+                  && pPred->next( 0 ).load( memory_model::memory_order_relaxed ) == pNode
+                  && pPred->m_nSize + pNode->m_nSize <= c_nNodeCapacity )
+                {
+                    for ( size_t i = 0; i < pNode->m_nSize; ++i )
+                        relocate( pPred->item_ptr( pPred->m_nSize + i ), pNode->item_ptr( i ));
+                    pPred->m_nSize += pNode->m_nSize;
+                    pNode->m_nSize = 0;
+
+                    pNode->m_bRemoved.store( true, memory_model::memory_order_release );
+                    pPred->next( 0 ).store( pNode->next( 0 ).load( memory_model::memory_order_relaxed ), memory_model::memory_order_release );
+                    bMerged = true;
+                }
+            }
+
+            if ( bMerged ) {
+                m_Stat.onNodeMerge();
+                unlink_index( pNode, gPred, gCur );
+                retire_node( pNode );
+            }
+            else
+                m_Stat.onNodeMergeFailed();
+        }
+
+        template <typename Func>
+        bool insert_( value_type& val, Func f )
+        {
+            key_comparator cmp;
+            guard gPred;
+            guard gCur;
+            guard gNew;
+
+            node * pNode = lock_chunk( val, cmp, gPred, gCur );
+            std::unique_lock< lock_type > l( pNode->m_Lock, std::adopt_lock );
+
+            size_t const nPos = lower_bound( pNode, val, cmp );
+            if ( nPos < pNode->m_nSize && cmp( pNode->item( nPos ), val ) == 0 ) {
+                m_Stat.onInsertFailed();
+                return false;
+            }
+
+            node * pNew = nullptr;
+            {
+                std::unique_lock< lock_type > lNew;
+                f( *place( pNode, nPos, val, pNew, gNew, lNew ));
+            }
+            l.unlock();
+
+            ++m_ItemCounter;
+            m_Stat.onInsertSuccess();
+
+            if ( pNew && pNew->m_nHeight > 1 )
+                link_index( pNew, gPred, gCur );
+            return true;
+        }
+
+        // Moves val into the locked chunk at nPos splitting the chunk if it is full
+        value_type * place( node * pNode, size_t nPos, value_type& val, node *& pNew, guard& gNew, std::unique_lock< lock_type >& lNew )
+        {
+            if ( pNode->m_nSize == c_nNodeCapacity ) {
+                pNew = split( pNode, gNew );
+                lNew = std::unique_lock< lock_type >( pNew->m_Lock, std::adopt_lock );
+                if ( nPos > pNode->m_nSize ) {
+                    nPos -= pNode->m_nSize;
+                    pNode = pNew;
+                }
+            }
+
+            for ( size_t i = pNode->m_nSize; i > nPos; --i )
+                relocate( pNode->item_ptr( i ), pNode->item_ptr( i - 1 ));
+            value_type * pItem = new ( pNode->item_ptr( nPos )) value_type( std::move( val ));
+            ++pNode->m_nSize;
+            return pItem;
+        }
+
+        template <typename Q, typename Compare, typename Func, typename Maker>
+        std::pair<bool, bool> update_( Q const& key, Compare cmp, Func func, Maker make, bool bInsert )
+        {
+            guard gPred;
+            guard gCur;
+            guard gNew;
+
+            node * pNode = lock_chunk( key, cmp, gPred, gCur );
+            std::unique_lock< lock_type > l( pNode->m_Lock, std::adopt_lock );
+
+            size_t const nPos = lower_bound( pNode, key, cmp );
+            if ( nPos < pNode->m_nSize && cmp( pNode->item( nPos ), key ) == 0 ) {
+                func( false, pNode->item( nPos ));
+                m_Stat.onUpdateExisting();
+                return std::make_pair( true, false );
+            }
+
+            if ( !bInsert ) {
+                m_Stat.onUpdateFailed();
+                return std::make_pair( false, false );
+            }
+
+            value_type val( make());
+            node * pNew = nullptr;
+            {
+                std::unique_lock< lock_type > lNew;
+                func( true, *place( pNode, nPos, val, pNew, gNew, lNew ));
+            }
+            l.unlock();
+
+            ++m_ItemCounter;
+            m_Stat.onUpdateNew();
+
+            if ( pNew && pNew->m_nHeight > 1 )
+                link_index( pNew, gPred, gCur );
+            return std::make_pair( true, true );
+        }
+
+        template <typename Q, typename Compare, typename Func>
+        bool erase_( Q const& key, Compare cmp, Func f )
+        {
+            guard gPred;
+            guard gCur;
+
+            node * pNode = lock_chunk( key, cmp, gPred, gCur );
+            std::unique_lock< lock_type > l( pNode->m_Lock, std::adopt_lock );
+
+            size_t const nPos = lower_bound( pNode, key, cmp );
+            if ( nPos == pNode->m_nSize || cmp( pNode->item( nPos ), key ) != 0 ) {
+                m_Stat.onEraseFailed();
+                return false;
+            }
+
+            f( pNode->item( nPos ));
+            pNode->item_ptr( nPos )->~value_type();
+            for ( size_t i = nPos + 1; i < pNode->m_nSize; ++i )
+                relocate( pNode->item_ptr( i - 1 ), pNode->item_ptr( i ));
+            --pNode->m_nSize;
+
+            bool const bMerge = !pNode->m_bHead && pNode->m_nSize <= c_nNodeCapacity / 4;
+            l.unlock();
+
+            --m_ItemCounter;
+            m_Stat.onEraseSuccess();
+
+            if ( bMerge )
+                merge( pNode );
+            return true;
+        }
+
+        template <typename Q, typename Compare, typename Func>
+        bool find_( Q& key, Compare cmp, Func f )
+        {
+            guard gPred;
+            guard gCur;
+
+            node * pNode = lock_chunk( key, cmp, gPred, gCur );
+            std::unique_lock< lock_type > l( pNode->m_Lock, std::adopt_lock );
+
+            size_t const nPos = lower_bound( pNode, key, cmp );
+            if ( nPos < pNode->m_nSize && cmp( pNode->item( nPos ), key ) == 0 ) {
+                f( pNode->item( nPos ), key );
+                m_Stat.onFindSuccess();
+                return true;
+            }
+
+            m_Stat.onFindFailed();
+            return false;
+        }
+
+        // Calls f for each item in ascending order until f returns false
+        template <typename Func>
+        void scan_( Func f )
+        {
+            key_comparator cmp;
+            guard gPred;
+            guard gCur;
+            guard gNext;
+
+            node * pNode = &m_Head;
+            pNode->m_Lock.lock();
+            size_t nPos = 0;
+            while ( true ) {
+                for ( ; nPos < pNode->m_nSize; ++nPos ) {
+                    if ( !f( pNode->item( nPos ))) {
+                        pNode->m_Lock.unlock();
+                        return;
+                    }
+                }
+
+                node * pNext = pNode->next( 0 ).load( memory_model::memory_order_relaxed );
+                if ( !pNext ) {
+                    pNode->m_Lock.unlock();
+                    return;
+                }
+                gNext.assign( pNext );
+                pNode->m_Lock.unlock();
+
+                pNext->m_Lock.lock();
+                if ( !pNext->m_bRemoved.load( memory_model::memory_order_relaxed )) {
+                    pNode = pNext;
+                    nPos = 0;
+                }
+                else {
+                    // pNext has been merged into its left neighbour after we left it:
+                    // continue from the lower bound of pNext
+                    pNext->m_Lock.unlock();
+                    pNode = lock_chunk( pNext->low(), cmp, gPred, gCur );
+                    nPos = lower_bound( pNode, pNext->low(), cmp );
+                }
+            }
+        }
+        //@endcond
+    };
+
+}} // namespace cds::container
+
+#endif // #ifndef CDSLIB_CONTAINER_UNROLLED_SKIP_LIST_SET_H
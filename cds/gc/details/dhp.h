@@ -35,6 +35,7 @@
 #include <cds/algo/atomic.h>
 #include <cds/algo/int_algo.h>
 #include <cds/gc/details/retired_ptr.h>
+#include <cds/gc/telemetry.h>
 #include <cds/details/aligned_allocator.h>
 #include <cds/details/allocator.h>
 #include <cds/sync/spinlock.h>
@@ -82,6 +83,7 @@ namespace cds { namespace gc {
 
             // Forward declaration
             class liberate_set;
+            class reclaimer_thread;
 
             /// Retired pointer buffer node
             struct retired_ptr_node {
@@ -120,19 +122,30 @@ namespace cds { namespace gc {
             };
 
             /// Guard allocator
+            /**
+                The guards are returned to the allocator by whole thread's lists (magazines).
+                The allocator keeps the magazines in the depot, that is, a fixed array of slots.
+                A magazine is put into an empty slot by CAS and is taken from the slot by \p exchange(),
+                so the depot is lock-free and ABA-free. Only if the depot is full or empty
+                the allocator falls back to the lock-based free list of guards.
+            */
             template <class Alloc = CDS_DEFAULT_ALLOCATOR>
             class guard_allocator
             {
                 cds::details::Allocator<details::guard_data>  m_GuardAllocator    ;   ///< guard allocator
 
+                static CDS_CONSTEXPR const size_t c_nDepotSize = 32;   ///< Slot count of the magazine depot
+
                 atomics::atomic<guard_data *>  m_GuardList;     ///< Head of allocated guard list (linked by guard_data::pGlobalNext field)
+                atomics::atomic<guard_data *>  m_Depot[c_nDepotSize]; ///< Depot of magazines (linked by guard_data::pThreadNext and pNextFree fields)
                 atomics::atomic<guard_data *>  m_FreeGuardList; ///< Head of free guard list (linked by guard_data::pNextFree field)
                 cds::sync::spin                m_freeListLock;  ///< Access to m_FreeGuardList
+                atomics::atomic<size_t>        m_nGuardCount;   ///< Count of guards allocated from the heap
 
                 /*
-                    Unfortunately, access to the list of free guard is lock-based.
-                    Lock-free manipulations with guard free-list are ABA-prone.
-                    TODO: working with m_FreeGuardList in lock-free manner.
+                    Access to the list of free guard is lock-based since
+                    lock-free manipulations with guard free-list are ABA-prone.
+                    The free-list is used only when the depot is full or empty.
                 */
 
             private:
@@ -142,6 +155,7 @@ namespace cds { namespace gc {
                     //TODO: the allocator should make block allocation
 
                     details::guard_data * pGuard = m_GuardAllocator.New();
+                    m_nGuardCount.fetch_add( 1, atomics::memory_order_relaxed );
 
                     // Link guard to the list
                     // m_GuardList is an accumulating list and it cannot support concurrent deletion,
@@ -161,7 +175,11 @@ namespace cds { namespace gc {
                 guard_allocator() CDS_NOEXCEPT
                     : m_GuardList( nullptr )
                     , m_FreeGuardList( nullptr )
-                {}
+                    , m_nGuardCount( 0 )
+                {
+                    for ( size_t i = 0; i < c_nDepotSize; ++i )
+                        m_Depot[i].store( nullptr, atomics::memory_order_relaxed );
+                }
 
                 // Destructor
                 ~guard_allocator()
@@ -205,6 +223,43 @@ namespace cds { namespace gc {
                     m_FreeGuardList.store( pGuard, atomics::memory_order_relaxed );
                 }
 
+                /// Pushes magazine \p pList into the depot
+                /**
+                    The magazine is linked by guard's \p pThreadNext and \p pNextFree fields,
+                    the last guard's links are \p nullptr.
+                    Returns \p false if the depot is full.
+                */
+                bool pushMagazine( guard_data * pList ) CDS_NOEXCEPT
+                {
+                    assert( pList != nullptr );
+                    for ( size_t i = 0; i < c_nDepotSize; ++i ) {
+                        guard_data * pEmpty = nullptr;
+                        if ( m_Depot[i].load( atomics::memory_order_relaxed ) == nullptr
+                            && m_Depot[i].compare_exchange_strong( pEmpty, pList, atomics::memory_order_release, atomics::memory_order_relaxed ))
+                        {
+                            return true;
+                        }
+                    }
+                    return false;
+                }
+
+                /// Pops a magazine from the depot
+                /**
+                    The magazine is linked by guard's \p pThreadNext and \p pNextFree fields.
+                    Returns \p nullptr if the depot is empty.
+                */
+                guard_data * popMagazine() CDS_NOEXCEPT
+                {
+                    for ( size_t i = 0; i < c_nDepotSize; ++i ) {
+                        if ( m_Depot[i].load( atomics::memory_order_relaxed ) != nullptr ) {
+                            guard_data * pList = m_Depot[i].exchange( nullptr, atomics::memory_order_acquire );
+                            if ( pList )
+                                return pList;
+                        }
+                    }
+                    return nullptr;
+                }
+
                 /// Allocates list of guard
                 /**
                     The list returned is linked by guard's \p pThreadNext and \p pNextFree fields.
@@ -252,11 +307,22 @@ namespace cds { namespace gc {
                         pLast = p;
                     }
 
+                    pLast->pPost.store( nullptr, atomics::memory_order_relaxed );
+                    pLast->pNextFree.store( nullptr, atomics::memory_order_relaxed );
+                    if ( pushMagazine( pList ))
+                        return;
+
                     std::unique_lock<cds::sync::spin> al( m_freeListLock );
                     pLast->pNextFree.store( m_FreeGuardList.load(atomics::memory_order_relaxed), atomics::memory_order_relaxed );
                     m_FreeGuardList.store( pList, atomics::memory_order_relaxed );
                 }
 
+                /// Returns count of guards allocated from the heap
+                size_t guardCount() const CDS_NOEXCEPT
+                {
+                    return m_nGuardCount.load( atomics::memory_order_relaxed );
+                }
+
                 /// Returns the list's head of guards allocated
                 guard_data * begin() CDS_NOEXCEPT
                 {
@@ -372,11 +438,17 @@ namespace cds { namespace gc {
                 typedef cds::details::Allocator< block, Alloc > block_allocator;
                 typedef cds::details::Allocator< atomics::atomic<item *>, Alloc > epoch_array_alloc;
 
+                atomics::atomic<size_t>  m_nBlockCount;         ///< Count of allocated blocks
+
+            public:
+                static CDS_CONSTEXPR const size_t c_nMagazineSize = 32;  ///< Max count of retired pointer nodes taken by \p alloc_magazine()
+
             private:
-                void allocNewBlock()
+                block * newBlock()
                 {
                     // allocate new block
                     block * pNew = block_allocator().New();
+                    m_nBlockCount.fetch_add( 1, atomics::memory_order_relaxed );
 
                     // link items within the block
                     item * pLastItem = pNew->items + m_nItemPerBlock - 1;
@@ -384,6 +456,7 @@ namespace cds { namespace gc {
                         pItem->m_pNextFree.store( pItem + 1, atomics::memory_order_release );
                         CDS_STRICT_DO( pItem->m_pNext.store( nullptr, atomics::memory_order_relaxed ));
                     }
+                    pLastItem->m_pNextFree.store( nullptr, atomics::memory_order_release );
 
                     // links new block to the block list
                     {
@@ -393,6 +466,13 @@ namespace cds { namespace gc {
                             // pHead is changed by compare_exchange_weak
                         } while ( !m_pBlockListHead.compare_exchange_weak( pHead, pNew, atomics::memory_order_relaxed, atomics::memory_order_relaxed ));
                     }
+                    return pNew;
+                }
+
+                void allocNewBlock()
+                {
+                    block * pNew = newBlock();
+                    item * pLastItem = pNew->items + m_nItemPerBlock - 1;
 
                     // links block's items to the free list
                     {
@@ -414,6 +494,39 @@ namespace cds { namespace gc {
                     return (m_nCurEpoch.load(atomics::memory_order_acquire) - 1) & m_nEpochBitmask;
                 }
 
+                // Cuts the first c_nMagazineSize items off the free list pHead taken from list,
+                // the rest is pushed back to list.
+                // The rest must not be pushed to another list: alloc() pops the lists by CAS,
+                // so a recycled item appearing in the global free list can cause ABA
+                item * cut_magazine( item * pHead, atomics::atomic<item *>& list )
+                {
+                    item * pLast = pHead;
+                    for ( size_t n = 1; n < c_nMagazineSize; ++n ) {
+                        item * pNext = pLast->m_pNextFree.load( atomics::memory_order_relaxed );
+                        if ( !pNext )
+                            return pHead;
+                        pLast = pNext;
+                    }
+
+                    item * pRest = pLast->m_pNextFree.load( atomics::memory_order_relaxed );
+                    if ( pRest ) {
+                        pLast->m_pNextFree.store( nullptr, atomics::memory_order_relaxed );
+
+                        // Fast path: the list is still empty, the tail of the rest is not needed
+                        item * pListHead = nullptr;
+                        if ( !list.compare_exchange_strong( pListHead, pRest, atomics::memory_order_release, atomics::memory_order_relaxed )) {
+                            item * pTail = pRest;
+                            for ( item * pNext = pTail->m_pNextFree.load( atomics::memory_order_relaxed ); pNext; pNext = pNext->m_pNextFree.load( atomics::memory_order_relaxed ))
+                                pTail = pNext;
+                            do {
+                                pTail->m_pNextFree.store( pListHead, atomics::memory_order_release );
+                                // pListHead is changed by compare_exchange_weak
+                            } while ( !list.compare_exchange_weak( pListHead, pRest, atomics::memory_order_release, atomics::memory_order_relaxed ));
+                        }
+                    }
+                    return pHead;
+                }
+
             public:
                 retired_ptr_pool( unsigned int nEpochCount = 8 )
                     : m_pBlockListHead( nullptr )
@@ -421,6 +534,7 @@ namespace cds { namespace gc {
                     , m_nCurEpoch(0)
                     , m_pEpochFree( epoch_array_alloc().NewArray( m_nEpochBitmask + 1))
                     , m_pGlobalFreeHead( nullptr )
+                    , m_nBlockCount( 0 )
                 {
 
 
@@ -492,6 +606,40 @@ namespace cds { namespace gc {
                     return node;
                 }
 
+                /// Allocates a magazine of free retired pointers for a thread
+                /**
+                    The function takes whole free list of current epoch or, if it is empty,
+                    whole global free list by \p exchange() that is ABA-free.
+                    If both lists are empty, a new block is allocated for the caller.
+                    At most \p c_nMagazineSize items are returned to the caller, the rest of the list
+                    is pushed back to the list it has been taken from, so one thread does not hoard the whole pool.
+                    Recycled items never reach the global free list since \p alloc() pops it by CAS
+                    that is ABA-safe only for the items that are never returned to it.
+                    The magazine returned is linked by \p m_pNextFree field, the last item has \p nullptr link.
+                    The items of magazine can be returned to the pool by \p free_range().
+
+                    cds::gc::dhp::ThreadGC supporting method
+                */
+                retired_ptr_node * alloc_magazine()
+                {
+                    atomics::atomic<item *>& epochList = m_pEpochFree[ current_epoch() ];
+                    item * pItem = epochList.exchange( nullptr, atomics::memory_order_acquire );
+                    if ( pItem )
+                        return cut_magazine( pItem, epochList );
+
+                    // The global free list contains never allocated items only
+                    pItem = m_pGlobalFreeHead.exchange( nullptr, atomics::memory_order_acquire );
+                    if ( !pItem )
+                        pItem = newBlock()->items;
+                    return cut_magazine( pItem, m_pGlobalFreeHead );
+                }
+
+                /// Returns count of allocated blocks
+                size_t block_count() const CDS_NOEXCEPT
+                {
+                    return m_nBlockCount.load( atomics::memory_order_relaxed );
+                }
+
                 /// Places the list [pHead, pTail] of retired pointers to pool (frees retired pointers)
                 /**
                     The list is linked on the m_pNextFree field
@@ -722,10 +870,20 @@ namespace cds { namespace gc {
             {
                 atomics::atomic<size_t>  m_nGuardCount       ;   ///< Total guard count
                 atomics::atomic<size_t>  m_nFreeGuardCount   ;   ///< Count of free guard
+                atomics::atomic<size_t>  m_nBackgroundScanCount; ///< Count of \p scan() calls by the reclaimer thread
+                atomics::atomic<size_t>  m_nInlineScanCount  ;   ///< Count of \p scan() calls by retiring threads
+                atomics::atomic<size_t>  m_nGuardMagazineHit ;   ///< Count of guard lists taken from the depot of magazines
+                atomics::atomic<size_t>  m_nGuardMagazineMiss;   ///< Count of guard lists allocated from free list or heap since the depot is empty
+                atomics::atomic<size_t>  m_nRetiredMagazineCount; ///< Count of magazines of retired pointer nodes allocated for threads
 
                 internal_stat()
                     : m_nGuardCount(0)
                     , m_nFreeGuardCount(0)
+                    , m_nBackgroundScanCount(0)
+                    , m_nInlineScanCount(0)
+                    , m_nGuardMagazineHit(0)
+                    , m_nGuardMagazineMiss(0)
+                    , m_nRetiredMagazineCount(0)
                 {}
             };
 
@@ -746,17 +904,34 @@ namespace cds { namespace gc {
             {
                 size_t m_nGuardCount       ;   ///< Total guard count
                 size_t m_nFreeGuardCount   ;   ///< Count of free guard
+                size_t m_nBackgroundScanCount; ///< Count of \p scan() calls by the reclaimer thread
+                size_t m_nInlineScanCount  ;   ///< Count of \p scan() calls by retiring threads
+                size_t m_nGuardMagazineHit ;   ///< Count of guard lists taken from the depot of magazines
+                size_t m_nGuardMagazineMiss;   ///< Count of guard lists allocated from free list or heap since the depot is empty
+                size_t m_nRetiredMagazineCount; ///< Count of magazines of retired pointer nodes allocated for threads
+                size_t m_nRetiredBlockCount;   ///< Count of blocks of retired pointer nodes allocated
 
                 //@cond
                 InternalState()
                     : m_nGuardCount(0)
                     , m_nFreeGuardCount(0)
+                    , m_nBackgroundScanCount(0)
+                    , m_nInlineScanCount(0)
+                    , m_nGuardMagazineHit(0)
+                    , m_nGuardMagazineMiss(0)
+                    , m_nRetiredMagazineCount(0)
+                    , m_nRetiredBlockCount(0)
                 {}
 
                 InternalState& operator =( internal_stat const& s )
                 {
                     m_nGuardCount = s.m_nGuardCount.load(atomics::memory_order_relaxed);
                     m_nFreeGuardCount = s.m_nFreeGuardCount.load(atomics::memory_order_relaxed);
+                    m_nBackgroundScanCount = s.m_nBackgroundScanCount.load(atomics::memory_order_relaxed);
+                    m_nInlineScanCount = s.m_nInlineScanCount.load(atomics::memory_order_relaxed);
+                    m_nGuardMagazineHit = s.m_nGuardMagazineHit.load(atomics::memory_order_relaxed);
+                    m_nGuardMagazineMiss = s.m_nGuardMagazineMiss.load(atomics::memory_order_relaxed);
+                    m_nRetiredMagazineCount = s.m_nRetiredMagazineCount.load(atomics::memory_order_relaxed);
 
                     return *this;
                 }
@@ -773,8 +948,13 @@ namespace cds { namespace gc {
             details::retired_ptr_pool<>     m_RetiredAllocator  ;   ///< Pool of free retired pointers
             details::retired_ptr_buffer     m_RetiredBuffer     ;   ///< Retired pointer buffer for liberating
 
+            details::reclaimer_thread *     m_pReclaimer        ;   ///< Background reclaimer thread, \p nullptr if it is disabled
+            size_t const                    m_nBackpressureRatio;   ///< Backpressure threshold as a multiple of current \p m_nLiberateThreshold
+            atomics::atomic<bool>           m_bReclaimRequested ;   ///< \p true if the reclaimer thread is requested to do \p scan()
+
             internal_stat   m_stat  ;   ///< Internal statistics
             bool            m_bStatEnabled  ;   ///< Internal Statistics enabled
+            telemetry::gc_collector m_Telemetry;   ///< Reclamation telemetry
 
         public:
             /// Initializes DHP memory manager singleton
@@ -796,11 +976,26 @@ namespace cds { namespace gc {
                     ABA problem for internal data. \p nEpochCount specifies the epoch count,
                     i.e. the count of simultaneously working threads that remove the elements
                     of DHP-based concurrent data structure. Default value is 16.
+                - \p bBackgroundReclaim - if \p true, the GC starts the dedicated reclaimer thread.
+                    When the retired pointer buffer reaches \p nLiberateThreshold the retiring thread just wakes up
+                    the reclaimer thread that calls \p scan(), like \p cds::urcu::general_threaded does
+                    with its \p cds::urcu::dispose_thread. Default is \p false: \p scan() is called by the retiring thread.
+                    The reclaimer thread is not attached to libcds (it has no thread record) since \p scan()
+                    works only with the global pools of the GC. So the disposers of the retired pointers
+                    are called by an unattached thread and must not use libcds GC in this mode.
+                - \p nBackpressureThreshold - if the reclaimer thread lags and the retired pointer buffer
+                    reaches this value, the retiring thread calls \p scan() by itself. The value is used only
+                    if \p bBackgroundReclaim is \p true. Default value 0 means <tt>4 * nLiberateThreshold</tt>.
+                    Since \p scan() doubles the liberate threshold when it cannot free anything, the backpressure threshold
+                    is kept as the ratio <tt>nBackpressureThreshold / nLiberateThreshold</tt> (at least 2)
+                    of the current liberate threshold, see \p getBackpressureThreshold().
             */
             static void CDS_STDCALL Construct(
                 size_t nLiberateThreshold = 1024
                 , size_t nInitialThreadGuardCount = 8
                 , size_t nEpochCount = 16
+                , bool bBackgroundReclaim = false
+                , size_t nBackpressureThreshold = 0
             );
 
             /// Destroys DHP memory manager
@@ -845,8 +1040,23 @@ namespace cds { namespace gc {
             }
 
             /// Allocates guard list for a thread.
+            /**
+                The function returns a magazine from the depot of guard pool if it is possible,
+                the magazine may contain more or less than \p nCount guards.
+                Otherwise, \p nCount guards are allocated from the free list or the heap.
+                The list returned is linked by guard's \p pThreadNext and \p pNextFree fields.
+            */
             details::guard_data * allocGuardList( size_t nCount )
             {
+                details::guard_data * pList = m_GuardPool.popMagazine();
+                if ( pList ) {
+                    if ( m_bStatEnabled )
+                        m_stat.m_nGuardMagazineHit.fetch_add( 1, atomics::memory_order_relaxed );
+                    return pList;
+                }
+
+                if ( m_bStatEnabled )
+                    m_stat.m_nGuardMagazineMiss.fetch_add( 1, atomics::memory_order_relaxed );
                 return m_GuardPool.allocList( nCount );
             }
 
@@ -868,8 +1078,71 @@ namespace cds { namespace gc {
             /// Places retired pointer \p into thread's array of retired pointer for deferred reclamation
             void retirePtr( retired_ptr const& p )
             {
-                if ( m_RetiredBuffer.push( m_RetiredAllocator.alloc(p)) >= m_nLiberateThreshold.load(atomics::memory_order_relaxed) )
-                    scan();
+                retireNode( m_RetiredAllocator.alloc(p) );
+            }
+
+            /// Places retired pointer node \p node allocated from the pool of retired pointers into the buffer for deferred reclamation
+            void retireNode( details::retired_ptr_node& node )
+            {
+                size_t const nSize = m_RetiredBuffer.push( node );
+                size_t const nLiberateThreshold = m_nLiberateThreshold.load(atomics::memory_order_relaxed);
+                if ( nSize >= nLiberateThreshold ) {
+                    if ( m_pReclaimer && nSize < nLiberateThreshold * m_nBackpressureRatio ) {
+                        // Hand the buffer to the reclaimer thread
+                        if ( !m_bReclaimRequested.load( atomics::memory_order_relaxed )
+                          && !m_bReclaimRequested.exchange( true, atomics::memory_order_acquire ))
+                        {
+                            wake_reclaimer();
+                        }
+                    }
+                    else {
+                        if ( m_bStatEnabled )
+                            m_stat.m_nInlineScanCount.fetch_add( 1, atomics::memory_order_relaxed );
+                        scan();
+                    }
+                }
+            }
+
+            /// Allocates a magazine of free retired pointer nodes for a thread
+            /**
+                The magazine is linked by \p m_pNextFree field, see \p details::retired_ptr_pool::alloc_magazine()
+            */
+            details::retired_ptr_node * allocRetiredMagazine()
+            {
+                if ( m_bStatEnabled )
+                    m_stat.m_nRetiredMagazineCount.fetch_add( 1, atomics::memory_order_relaxed );
+                return m_RetiredAllocator.alloc_magazine();
+            }
+
+            /// Returns the magazine [pHead, pTail] of free retired pointer nodes to the pool
+            void freeRetiredMagazine( details::retired_ptr_node * pHead, details::retired_ptr_node * pTail )
+            {
+                m_RetiredAllocator.free_range( pHead, pTail );
+            }
+
+            /// Checks if the background reclaimer thread is enabled
+            bool isBackgroundReclaim() const CDS_NOEXCEPT
+            {
+                return m_pReclaimer != nullptr;
+            }
+
+            /// Returns current \p scan() threshold of the retired pointer buffer
+            /**
+                The threshold is doubled by \p scan() if the scan cycle cannot free any retired pointer.
+            */
+            size_t getLiberateThreshold() const CDS_NOEXCEPT
+            {
+                return m_nLiberateThreshold.load( atomics::memory_order_relaxed );
+            }
+
+            /// Returns current backpressure threshold of the retired pointer buffer, see \p Construct()
+            /**
+                The threshold follows the current liberate threshold, so the retiring threads
+                keep handing the buffer to the reclaimer after \p scan() has grown the liberate threshold.
+            */
+            size_t getBackpressureThreshold() const CDS_NOEXCEPT
+            {
+                return getLiberateThreshold() * m_nBackpressureRatio;
             }
 
         protected:
@@ -877,15 +1150,40 @@ namespace cds { namespace gc {
             /** @anchor dhp_gc_liberate
                 The main function of Dynamic Hazard Pointer algorithm. It tries to free retired pointers if they are not
                 trapped by any guard.
+
+                The function uses only the global retired buffer, guard pool and retired pointer pool,
+                it does not look up the thread record of the caller. This is the entry point
+                of the background reclaimer thread that is not attached to libcds.
             */
             void scan();
             //@}
 
+        private:
+            //@cond
+            friend class details::reclaimer_thread;
+            void wake_reclaimer();
+            //@endcond
+
         public:
             /// Get internal statistics
             InternalState& getInternalState(InternalState& stat) const
             {
-                return stat = m_stat;
+                stat = m_stat;
+                stat.m_nGuardCount = m_GuardPool.guardCount();
+                stat.m_nRetiredBlockCount = m_RetiredAllocator.block_count();
+                return stat;
+            }
+
+            /// Get reclamation telemetry, see \ref cds_gc_telemetry "cds::gc::telemetry"
+            /**
+                DHP has no per-thread retired arrays, so \p threads field of the snapshot is empty.
+            */
+            telemetry::snapshot& get_telemetry( telemetry::snapshot& s ) const
+            {
+                s.clear();
+                m_Telemetry.get( s );
+                s.nRetiredBacklog = m_RetiredBuffer.size();
+                return s;
             }
 
             /// Checks if internal statistics enabled
@@ -903,7 +1201,7 @@ namespace cds { namespace gc {
             }
 
         private:
-            GarbageCollector( size_t nLiberateThreshold, size_t nInitialThreadGuardCount, size_t nEpochCount );
+            GarbageCollector( size_t nLiberateThreshold, size_t nInitialThreadGuardCount, size_t nEpochCount, bool bBackgroundReclaim, size_t nBackpressureThreshold );
             ~GarbageCollector();
         };
 
@@ -914,16 +1212,21 @@ namespace cds { namespace gc {
             on the start of each thread that uses DHP GC. Before terminating the thread linked to DHP GC it is necessary to call
             \ref cds_threading "cds::threading::Manager::detachThread()".
 
-            The ThreadGC object maintains two list:
+            The ThreadGC object maintains three list:
             \li Thread guard list: the list of thread-local guards (linked by \p pThreadNext field)
             \li Free guard list: the list of thread-local free guards (linked by \p pNextFree field)
             Free guard list is a subset of thread guard list.
+            \li Retired magazine: the list of thread-local free retired pointer nodes (linked by \p m_pNextFree field)
+
+            The guard lists and the retired magazine are refilled by batches from the GC pools
+            and are returned to the pools as a whole, so the threads rarely contend on the global free lists.
         */
         class ThreadGC
         {
             GarbageCollector&   m_gc    ;   ///< reference to GC singleton
             details::guard_data *    m_pList ;   ///< Local list of guards owned by the thread
             details::guard_data *    m_pFree ;   ///< The list of free guard from m_pList
+            details::retired_ptr_node * m_pRetiredFree; ///< Local magazine of free retired pointer nodes
 
         public:
             /// Default constructor
@@ -931,6 +1234,7 @@ namespace cds { namespace gc {
                 : m_gc( GarbageCollector::instance() )
                 , m_pList( nullptr )
                 , m_pFree( nullptr )
+                , m_pRetiredFree( nullptr )
             {}
 
             /// The object is not copy-constructible
@@ -959,23 +1263,43 @@ namespace cds { namespace gc {
                     m_pList =
                         m_pFree = nullptr;
                 }
+                if ( m_pRetiredFree ) {
+                    details::retired_ptr_node * pTail = m_pRetiredFree;
+                    for ( details::retired_ptr_node * p = pTail->m_pNextFree.load( atomics::memory_order_relaxed ); p; p = p->m_pNextFree.load( atomics::memory_order_relaxed ))
+                        pTail = p;
+                    m_gc.freeRetiredMagazine( m_pRetiredFree, pTail );
+                    m_pRetiredFree = nullptr;
+                }
             }
 
+        private:
+            //@cond
+            // Refills the free guard list by the batch of guards from GC pool
+            void refillGuards()
+            {
+                assert( m_pFree == nullptr );
+
+                details::guard_data * pBatch = m_gc.allocGuardList( m_gc.m_nInitialThreadGuardCount );
+                details::guard_data * pLast = pBatch;
+                while ( pLast->pThreadNext )
+                    pLast = pLast->pThreadNext;
+
+                pLast->pThreadNext = m_pList;
+                m_pList =
+                    m_pFree = pBatch;
+            }
+            //@endcond
+
         public:
             /// Initializes guard \p g
             void allocGuard( dhp::details::guard& g )
             {
                 assert( m_pList != nullptr );
                 if ( !g.m_pGuard ) {
-                    if ( m_pFree ) {
-                        g.m_pGuard = m_pFree;
-                        m_pFree = m_pFree->pNextFree.load( atomics::memory_order_relaxed );
-                    }
-                    else {
-                        g.m_pGuard = m_gc.allocGuard();
-                        g.m_pGuard->pThreadNext = m_pList;
-                        m_pList = g.m_pGuard;
-                    }
+                    if ( !m_pFree )
+                        refillGuards();
+                    g.m_pGuard = m_pFree;
+                    m_pFree = m_pFree->pNextFree.load( atomics::memory_order_relaxed );
                 }
             }
 
@@ -996,19 +1320,12 @@ namespace cds { namespace gc {
             void allocGuard( GuardArray<Count>& arr )
             {
                 assert( m_pList != nullptr );
-                size_t nCount = 0;
 
-                while ( m_pFree && nCount < Count ) {
+                for ( size_t nCount = 0; nCount < Count; ++nCount ) {
+                    if ( !m_pFree )
+                        refillGuards();
                     arr[nCount].set_guard( m_pFree );
                     m_pFree = m_pFree->pNextFree.load(atomics::memory_order_relaxed);
-                    ++nCount;
-                }
-
-                while ( nCount < Count ) {
-                    details::guard& g = arr[nCount++];
-                    g.set_guard( m_gc.allocGuard() );
-                    g.get_guard()->pThreadNext = m_pList;
-                    m_pList = g.get_guard();
                 }
             }
 
@@ -1034,7 +1351,23 @@ namespace cds { namespace gc {
             template <typename T>
             void retirePtr( T * p, void (* pFunc)(T *) )
             {
-                m_gc.retirePtr( p, pFunc );
+                retirePtr( retired_ptr( reinterpret_cast<void *>( p ), reinterpret_cast<free_retired_ptr_func>( pFunc )));
+            }
+
+            /// Places retired pointer \p p into list of retired pointer for deferred reclamation
+            /**
+                The node for \p p is allocated from thread's magazine of retired pointer nodes.
+            */
+            void retirePtr( retired_ptr const& p )
+            {
+                if ( !m_pRetiredFree )
+                    m_pRetiredFree = m_gc.allocRetiredMagazine();
+
+                details::retired_ptr_node * pNode = m_pRetiredFree;
+                m_pRetiredFree = pNode->m_pNextFree.load( atomics::memory_order_relaxed );
+                CDS_STRICT_DO( pNode->m_pNextFree.store( nullptr, atomics::memory_order_relaxed ));
+                pNode->m_ptr = p;
+                m_gc.retireNode( *pNode );
             }
 
             /// Run retiring cycle
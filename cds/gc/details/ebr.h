@@ -0,0 +1,913 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#ifndef CDSLIB_GC_DETAILS_EBR_H
+#define CDSLIB_GC_DETAILS_EBR_H
+
+#include <algorithm>    // std::copy
+#include <utility>      // std::swap
+#include <cds/algo/atomic.h>
+#include <cds/os/thread.h>
+#include <cds/details/allocator.h>
+#include <cds/user_setup/cache_line.h>
+#include <cds/gc/details/retired_ptr.h>
+#include <cds/gc/details/thread_record.h>
+#include <cds/gc/telemetry.h>
+
+#if CDS_COMPILER == CDS_COMPILER_MSVC
+#   pragma warning(push)
+    // warning C4251: 'cds::gc::ebr::GarbageCollector::m_pListHead' : class 'cds::cxx11_atomic::atomic<T>'
+    // needs to have dll-interface to be used by clients of class 'cds::gc::ebr::GarbageCollector'
+    // warning C4275: non dll-interface class 'cds::gc::details::thread_record_list<...>' used as base
+    // for dll-interface class 'cds::gc::ebr::GarbageCollector'
+#   pragma warning(disable: 4251 4275)
+#endif
+
+//@cond
+namespace cds { namespace gc {
+
+    /// Epoch-based reclamation schema
+    /**
+    \par Sources:
+        - [2004] K.Fraser "Practical lock-freedom", technical report UCAM-CL-TR-579
+        - [2006] T.Hart, P.McKenney, A.D.Brown "Making lockless synchronization fast: performance implications of memory reclamation"
+
+        The \p cds::gc::ebr namespace and its members are internal representation of epoch-based GC and should not be used directly.
+        Use \p cds::gc::EBR class in your code.
+
+        A thread owning at least one guard is inside of a critical section: it announces the global epoch
+        observed on entering. A guard itself is a plain thread-private pointer, protecting and traversing
+        costs nothing. Retired pointers are collected in three limbo bags stamped by the global epoch,
+        a bag can be freed when the global epoch has been advanced twice since its stamp.
+    */
+    namespace ebr {
+
+        // forwards
+        class GarbageCollector;
+        class ThreadGC;
+
+        /// Epoch type
+        typedef uint64_t epoch_type;
+
+        /// Announced epoch of the thread outside of critical section
+        static CDS_CONSTEXPR const epoch_type c_nQuiescent = 0;
+
+        /// Pointer to function to free (destruct and deallocate) retired pointer of specific type
+        typedef cds::gc::details::free_retired_ptr_func free_retired_ptr_func;
+
+        namespace details {
+
+            /// Retired pointer
+            typedef cds::gc::details::retired_ptr   retired_ptr;
+
+            // forward
+            class guard_allocator;
+
+            /// Epoch guard
+            /**
+                It is unsafe to use this class directly.
+                Instead, the \p ebr::guard class should be used.
+
+                The guard is the thread-private slot keeping a pointer for \p get().
+                It is not read by other threads: the protection is provided by the critical section
+                of the owner thread that lasts while the thread has at least one allocated guard.
+            */
+            class epoch_guard
+            {
+                void *  m_pGuarded; ///< Guarded pointer
+
+            public:
+                //@cond
+                epoch_guard() CDS_NOEXCEPT
+                    : m_pGuarded( nullptr )
+                {}
+                //@endcond
+
+                /// Returns the pointer guarded
+                void * get( atomics::memory_order /*order*/ = atomics::memory_order_acquire ) const CDS_NOEXCEPT
+                {
+                    return m_pGuarded;
+                }
+
+                /// Stores the pointer \p p
+                template <typename T>
+                void set( T * p, atomics::memory_order /*order*/ = atomics::memory_order_release ) CDS_NOEXCEPT
+                {
+                    m_pGuarded = reinterpret_cast<void *>( const_cast<T *>( p ));
+                }
+
+                /// Copies the pointer from \p src guard
+                void copy( epoch_guard const& src ) CDS_NOEXCEPT
+                {
+                    m_pGuarded = src.m_pGuarded;
+                }
+
+                /// Clears the guard
+                void clear( atomics::memory_order /*order*/ = atomics::memory_order_release ) CDS_NOEXCEPT
+                {
+                    m_pGuarded = nullptr;
+                }
+
+                //@cond
+                template <typename T>
+                T * operator =( T * p ) CDS_NOEXCEPT
+                {
+                    set( p );
+                    return p;
+                }
+
+                std::nullptr_t operator =( std::nullptr_t ) CDS_NOEXCEPT
+                {
+                    clear();
+                    return nullptr;
+                }
+                //@endcond
+            };
+
+            /// Array of epoch guards
+            /**
+                It is unsafe to use this class directly. Instead, the \p ebr::array should be used.
+
+                Template parameter \p Count defines the size of the array. \p Count should not exceed
+                \p GarbageCollector::getGuardCount().
+            */
+            template <size_t Count>
+            class ebr_array
+            {
+            public:
+                typedef epoch_guard guard_type;     ///< Element type of the array
+                static CDS_CONSTEXPR const size_t c_nCapacity = Count ;   ///< Capacity of the array
+
+            private:
+                guard_type * m_arr;     ///< Guard array of size = \p Count
+                friend class guard_allocator;
+
+            public:
+                /// Constructs uninitialized array.
+                ebr_array() CDS_NOEXCEPT
+                {}
+
+                /// Returns max count of guards for this array
+                CDS_CONSTEXPR size_t capacity() const
+                {
+                    return c_nCapacity;
+                }
+
+                /// Returns reference to the guard of index \p nIndex (0 <= \p nIndex < \p Count)
+                guard_type& operator []( size_t nIndex ) CDS_NOEXCEPT
+                {
+                    assert( nIndex < capacity() );
+                    return m_arr[nIndex];
+                }
+
+                /// Returns reference to the guard of index \p nIndex (0 <= \p nIndex < \p Count) [const version]
+                guard_type& operator []( size_t nIndex ) const CDS_NOEXCEPT
+                {
+                    assert( nIndex < capacity() );
+                    return m_arr[nIndex];
+                }
+
+                /// Clears the guard \p nIndex
+                void clear( size_t nIndex ) CDS_NOEXCEPT
+                {
+                    assert( nIndex < capacity() );
+                    m_arr[ nIndex ].clear();
+                }
+            };
+
+            /// Allocator of epoch guards for the thread
+            /**
+                The same stack-based schema as \p hp::details::hp_allocator is used.
+                Each allocator object is thread-private.
+
+                The allocator enters the critical section when the first guard is allocated
+                and leaves it when the last guard is freed, so the depth of the stack
+                is the nesting level of the critical section.
+            */
+            class guard_allocator
+            {
+                typedef cds::details::Allocator< epoch_guard, CDS_DEFAULT_ALLOCATOR > allocator_impl;
+
+                atomics::atomic<epoch_type>&    m_GlobalEpoch;  ///< Global epoch
+                atomics::atomic<epoch_type>     m_nAnnounced;   ///< Announced epoch, \p c_nQuiescent outside of critical section
+                epoch_guard * const             m_arrGuard;     ///< Array of guards
+                size_t                          m_nTop;         ///< The top of stack
+                const size_t                    m_nCapacity;    ///< Array capacity
+
+            public:
+                /// Ctor
+                guard_allocator( atomics::atomic<epoch_type>& globalEpoch, size_t nCapacity )
+                    : m_GlobalEpoch( globalEpoch )
+                    , m_nAnnounced( c_nQuiescent )
+                    , m_arrGuard( allocator_impl().NewArray( nCapacity ))
+                    , m_nTop( nCapacity )
+                    , m_nCapacity( nCapacity )
+                {}
+
+                /// Dtor
+                ~guard_allocator()
+                {
+                    allocator_impl().Delete( m_arrGuard, capacity() );
+                }
+
+                /// Get capacity of array
+                size_t capacity() const CDS_NOEXCEPT
+                {
+                    return m_nCapacity;
+                }
+
+                /// Checks if all guards are allocated
+                bool isFull() const CDS_NOEXCEPT
+                {
+                    return m_nTop == 0;
+                }
+
+                /// Checks if the thread is inside of critical section
+                bool isPinned() const CDS_NOEXCEPT
+                {
+                    return m_nTop != m_nCapacity;
+                }
+
+                /// Allocates a guard
+                epoch_guard& alloc()
+                {
+                    assert( m_nTop > 0 );
+                    if ( !isPinned() )
+                        pin();
+                    --m_nTop;
+                    return m_arrGuard[m_nTop];
+                }
+
+                /// Frees previously allocated guard
+                void free( epoch_guard& g ) CDS_NOEXCEPT
+                {
+                    assert( m_nTop < capacity() );
+                    g.clear();
+                    ++m_nTop;
+                    if ( !isPinned() )
+                        unpin();
+                }
+
+                /// Allocates the guard array
+                template <size_t Count>
+                void alloc( ebr_array<Count>& arr )
+                {
+                    assert( m_nTop >= Count );
+                    if ( !isPinned() )
+                        pin();
+                    m_nTop -= Count;
+                    arr.m_arr = m_arrGuard + m_nTop;
+                }
+
+                /// Frees the guard array allocated by previous call \p this->alloc
+                template <size_t Count>
+                void free( ebr_array<Count> const& arr ) CDS_NOEXCEPT
+                {
+                    CDS_UNUSED( arr );
+
+                    assert( m_nTop + Count <= capacity());
+                    for ( size_t i = m_nTop; i < m_nTop + Count; ++i )
+                        m_arrGuard[i].clear();
+                    m_nTop += Count;
+                    if ( !isPinned() )
+                        unpin();
+                }
+
+                /// Makes all guards free and leaves the critical section
+                void clear() CDS_NOEXCEPT
+                {
+                    for ( size_t i = 0; i < capacity(); ++i )
+                        m_arrGuard[i].clear();
+                    m_nTop = capacity();
+                    unpin();
+                }
+
+                /// Re-enters the critical section if no allocated guard keeps a pointer
+                /**
+                    The thread having only empty guards does not reference any shared node,
+                    so it may announce the current global epoch instead of the epoch it has entered
+                    the critical section. Otherwise, the thread holding an empty guard for a long time
+                    (for example, an empty \p guarded_ptr) blocks the advance of the global epoch.
+                    Returns \p true if the announced epoch has been refreshed.
+                */
+                bool refresh() CDS_NOEXCEPT
+                {
+                    if ( !isPinned() )
+                        return false;
+                    for ( size_t i = m_nTop; i < capacity(); ++i ) {
+                        if ( m_arrGuard[i].get() )
+                            return false;
+                    }
+                    pin();
+                    return true;
+                }
+
+                /// Returns announced epoch: <tt>(epoch << 1) | 1</tt> inside of critical section, \p c_nQuiescent otherwise
+                epoch_type announced( atomics::memory_order order = atomics::memory_order_acquire ) const CDS_NOEXCEPT
+                {
+                    return m_nAnnounced.load( order );
+                }
+
+            private:
+                //@cond
+                void pin() CDS_NOEXCEPT
+                {
+                    // The store must be visible before any load of the shared data in the critical section
+                    m_nAnnounced.store( ( m_GlobalEpoch.load( atomics::memory_order_relaxed ) << 1 ) | 1, atomics::memory_order_relaxed );
+                    atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+                }
+
+                void unpin() CDS_NOEXCEPT
+                {
+                    m_nAnnounced.store( c_nQuiescent, atomics::memory_order_release );
+                }
+                //@endcond
+            };
+
+            /// Limbo bag of retired pointers
+            /**
+                The bag belongs to the thread and grows when needed.
+                The epoch of the bag is the global epoch observed when the retired pointers have been put into the bag.
+            */
+            class retired_bag {
+                typedef cds::details::Allocator< retired_ptr, CDS_DEFAULT_ALLOCATOR > allocator_impl;
+
+                retired_ptr *   m_arr;          ///< the array of retired pointers
+                size_t          m_nCapacity;    ///< Current capacity of \p m_arr
+                size_t          m_nSize;        ///< Current size of \p m_arr
+                epoch_type      m_nEpoch;       ///< Epoch of the bag
+
+            public:
+                /// Iterator
+                typedef retired_ptr * iterator;
+
+                /// Constructs an empty bag, no memory is allocated
+                retired_bag() CDS_NOEXCEPT
+                    : m_arr( nullptr )
+                    , m_nCapacity( 0 )
+                    , m_nSize( 0 )
+                    , m_nEpoch( 0 )
+                {}
+
+                /// Constructs the bag of capacity \p nCapacity
+                explicit retired_bag( size_t nCapacity )
+                    : m_arr( allocator_impl().NewArray( nCapacity ))
+                    , m_nCapacity( nCapacity )
+                    , m_nSize( 0 )
+                    , m_nEpoch( 0 )
+                {}
+
+                retired_bag( retired_bag const& ) = delete;
+
+                ~retired_bag()
+                {
+                    if ( m_arr )
+                        allocator_impl().Delete( m_arr, m_nCapacity );
+                }
+
+                /// Allocates the array of capacity \p nCapacity for the empty bag
+                void reserve( size_t nCapacity )
+                {
+                    assert( empty() );
+                    if ( nCapacity > m_nCapacity ) {
+                        if ( m_arr )
+                            allocator_impl().Delete( m_arr, m_nCapacity );
+                        m_arr = allocator_impl().NewArray( nCapacity );
+                        m_nCapacity = nCapacity;
+                    }
+                }
+
+                /// Bag capacity
+                size_t capacity() const CDS_NOEXCEPT
+                {
+                    return m_nCapacity;
+                }
+
+                /// Current bag size (count of retired pointers in the bag)
+                size_t size() const CDS_NOEXCEPT
+                {
+                    return m_nSize;
+                }
+
+                /// Checks if the bag is empty
+                bool empty() const CDS_NOEXCEPT
+                {
+                    return m_nSize == 0;
+                }
+
+                /// Returns the epoch of the bag
+                epoch_type epoch() const CDS_NOEXCEPT
+                {
+                    return m_nEpoch;
+                }
+
+                /// Sets the epoch of the bag
+                void epoch( epoch_type nEpoch ) CDS_NOEXCEPT
+                {
+                    m_nEpoch = nEpoch;
+                }
+
+                /// Pushes retired pointer to the bag, returns \p true if the bag has been grown
+                bool push( retired_ptr const& p )
+                {
+                    bool bGrown = false;
+                    if ( m_nSize >= capacity() ) {
+                        grow();
+                        bGrown = true;
+                    }
+                    m_arr[ m_nSize++ ] = p;
+                    return bGrown;
+                }
+
+                /// Moves all pointers from \p src bag to the bag
+                /**
+                    If the bag is empty, the arrays are swapped, no copy is made.
+                    \p src is empty after the call.
+                */
+                void splice( retired_bag& src )
+                {
+                    if ( empty() && capacity() <= src.capacity() ) {
+                        std::swap( m_arr, src.m_arr );
+                        std::swap( m_nCapacity, src.m_nCapacity );
+                        std::swap( m_nSize, src.m_nSize );
+                    }
+                    else {
+                        for ( iterator it = src.begin(), itEnd = src.end(); it != itEnd; ++it )
+                            push( *it );
+                        src.clear();
+                    }
+                }
+
+                /// Frees all retired pointers of the bag, returns the count of freed pointers
+                size_t free_all()
+                {
+                    size_t const nCount = m_nSize;
+                    for ( iterator it = begin(), itEnd = end(); it != itEnd; ++it )
+                        it->free();
+                    clear();
+                    return nCount;
+                }
+
+                /// Begin iterator
+                iterator begin() CDS_NOEXCEPT
+                {
+                    return m_arr;
+                }
+
+                /// End iterator
+                iterator end() CDS_NOEXCEPT
+                {
+                    return m_arr + m_nSize;
+                }
+
+                /// Clears the bag. After clearing, size() == 0
+                void clear() CDS_NOEXCEPT
+                {
+                    m_nSize = 0;
+                }
+
+            private:
+                //@cond
+                void grow()
+                {
+                    size_t const nNewCapacity = m_nCapacity ? m_nCapacity * 2 : 16;
+                    retired_ptr * pNew = allocator_impl().NewArray( nNewCapacity );
+                    if ( m_arr ) {
+                        std::copy( m_arr, m_arr + m_nSize, pNew );
+                        allocator_impl().Delete( m_arr, m_nCapacity );
+                    }
+                    m_arr = pNew;
+                    m_nCapacity = nNewCapacity;
+                }
+                //@endcond
+            };
+
+            /// Epoch-based reclamation record of the thread
+            /**
+                Only the announced epoch of \p m_Guards is read by other threads,
+                the limbo bags are accessed by the owner of the record only.
+            */
+            struct ebr_record {
+                static CDS_CONSTEXPR const size_t c_nLimboCount = 3;  ///< Count of limbo bags
+
+                guard_allocator m_Guards;                   ///< epoch guards
+                retired_bag     m_Pending;                  ///< Retired pointers not yet stamped by an epoch
+                retired_bag     m_Limbo[c_nLimboCount];     ///< Limbo bags, the bag of epoch \p e is <tt>m_Limbo[e % 3]</tt>
+
+                /// Ctor
+                ebr_record( cds::gc::ebr::GarbageCollector& gc );    // inline
+                ~ebr_record()
+                {}
+
+                /// Clears all guards
+                void clear()
+                {
+                    m_Guards.clear();
+                }
+
+                /// Returns count of retired pointers of the record
+                size_t retired_count() const
+                {
+                    size_t nCount = m_Pending.size();
+                    for ( size_t i = 0; i < c_nLimboCount; ++i )
+                        nCount += m_Limbo[i].size();
+                    return nCount;
+                }
+            };
+        }    // namespace details
+
+        /// Epoch-based reclamation singleton
+        /**
+            Epoch-based reclamation schema by K.Fraser.
+
+            The garbage collector maintains the global epoch. A thread entering a critical section
+            (that is, allocating the first guard) announces the global epoch it has observed; the thread
+            having no allocated guards is quiescent and never blocks the reclamation.
+            The global epoch may be advanced from \p e to <tt>e + 1</tt> only if every thread inside of
+            critical section has announced \p e.
+
+            Retired pointers are accumulated in the pending bag of the thread. Every \p nEpochAdvanceFreq retired pointers
+            the pending bag is stamped by the global epoch \p e and moved to the limbo bag <tt>e % 3</tt>.
+            The limbo bag can be freed when the global epoch has reached <tt>e + 2</tt>: any thread
+            that can refer to a pointer of the bag has entered its critical section at epoch \p e or earlier.
+
+            A thread stalled inside a critical section prevents the reclamation of all pointers retired
+            since its announced epoch, so the limbo bags grow dynamically.
+        */
+        class CDS_EXPORT_API GarbageCollector: public cds::gc::details::thread_record_list< details::ebr_record >
+        {
+            friend class cds::gc::details::thread_gc_base< GarbageCollector, details::ebr_record, details::epoch_guard >;
+
+        public:
+            typedef cds::atomicity::event_counter  event_counter   ;   ///< event counter type
+
+            /// Internal GC statistics
+            struct InternalState {
+                size_t              nGuardCount             ;   ///< Epoch guard count per thread (const)
+                size_t              nMaxThreadCount         ;   ///< Max thread count (const)
+                size_t              nInitRetiredPtrCount    ;   ///< Initial capacity of limbo bag per thread (const)
+                size_t              nEpochAdvanceFreq       ;   ///< Count of retired pointers per thread between epoch advance attempts (const)
+                epoch_type          nCurrentEpoch           ;   ///< Current global epoch
+
+                size_t              nEBRRecAllocated        ;   ///< Count of EBR record allocations
+                size_t              nEBRRecUsed             ;   ///< Count of EBR record used
+                size_t              nTotalRetiredPtrCount   ;   ///< Current total count of retired pointers
+                size_t              nRetiredPtrInFreeEBRRecs;   ///< Count of retired pointer in free (unused) EBR records
+
+                event_counter::value_type   evcAllocEBRRec  ;   ///< Count of \p ebr_record allocations
+                event_counter::value_type   evcRetireEBRRec ;   ///< Count of \p ebr_record retire events
+                event_counter::value_type   evcAllocNewEBRRec;  ///< Count of new \p ebr_record allocations from heap
+                event_counter::value_type   evcDeleteEBRRec ;   ///< Count of \p ebr_record deletions
+
+                event_counter::value_type   evcScanCall     ;   ///< Count of Scan calling
+                event_counter::value_type   evcHelpScanCall ;   ///< Count of HelpScan calling
+                event_counter::value_type   evcEpochAdvance ;   ///< Count of global epoch increments
+                event_counter::value_type   evcEpochBlocked ;   ///< Count of failed attempts to advance global epoch because of a lagging thread
+                event_counter::value_type   evcBagGrow      ;   ///< Count of limbo bag growing
+
+                event_counter::value_type   evcDeletedNode  ;   ///< Count of deleting of retired objects
+            };
+
+            /// No GarbageCollector object is created
+            class not_initialized : public std::runtime_error
+            {
+            public:
+                //@cond
+                not_initialized()
+                    : std::runtime_error( "Global epoch-based GarbageCollector is not initialized" )
+                {}
+                //@endcond
+            };
+
+        private:
+            /// Internal GC statistics
+            struct Statistics {
+                event_counter  m_AllocEBRRec        ;    ///< Count of \p ebr_record allocations
+                event_counter  m_RetireEBRRec       ;    ///< Count of \p ebr_record retire events
+                event_counter  m_AllocNewEBRRec     ;    ///< Count of new \p ebr_record allocations from heap
+                event_counter  m_DeleteEBRRec       ;    ///< Count of \p ebr_record deletions
+
+                event_counter  m_ScanCallCount      ;    ///< Count of Scan calling
+                event_counter  m_HelpScanCallCount  ;    ///< Count of HelpScan calling
+                event_counter  m_EpochAdvance       ;    ///< Count of global epoch increments
+                event_counter  m_EpochBlocked       ;    ///< Count of failed attempts to advance global epoch
+                event_counter  m_BagGrow            ;    ///< Count of limbo bag growing
+
+                event_counter  m_DeletedNode        ;    ///< Count of retired objects deleting
+            };
+
+            /// Internal list node of cds::gc::ebr::details::ebr_record
+            typedef cds::gc::details::thread_record_list< details::ebr_record >::node_type ebrlist_node;
+
+            static GarbageCollector *    m_pEBRManager  ;   ///< GC instance pointer
+
+            char pad1_[cds::c_nCacheLineSize];
+            atomics::atomic<epoch_type> m_nGlobalEpoch  ;   ///< Global epoch
+            char pad2_[cds::c_nCacheLineSize - sizeof(atomics::atomic<epoch_type>)];
+
+            Statistics              m_Stat              ;   ///< Internal statistics
+            bool                    m_bStatEnabled      ;   ///< true - statistics enabled
+            telemetry::gc_collector m_Telemetry         ;   ///< Reclamation telemetry
+
+            const size_t            m_nGuardCount           ;   ///< max count of thread's guards
+            const size_t            m_nMaxThreadCount       ;   ///< max count of thread
+            const size_t            m_nInitRetiredPtrCount  ;   ///< initial capacity of limbo bag per thread
+            const size_t            m_nEpochAdvanceFreq     ;   ///< count of retired pointers between epoch advance attempts
+
+        private:
+            /// Ctor
+            GarbageCollector(
+                size_t nGuardCount = 0,             ///< Epoch guard count per thread
+                size_t nMaxThreadCount = 0,         ///< Max count of thread
+                size_t nInitRetiredPtrCount = 0,    ///< Initial capacity of limbo bags
+                size_t nEpochAdvanceFreq = 0        ///< Count of retired objects between epoch advance attempts
+            );
+
+            /// Dtor
+            ~GarbageCollector();
+
+            /// Allocate new EBR record
+            ebrlist_node * NewEBRRec();
+
+            /// Permanently deletes EBR record \p pNode
+            void DeleteEBRRec( ebrlist_node * pNode );
+
+            void detachAllThread();
+
+        public:
+            /// Creates GarbageCollector singleton
+            /**
+                GC is the singleton. If GC instance is not exist then the function creates the instance.
+                Otherwise it does nothing.
+
+                The epoch-based schema depends of the following parameters:
+
+                \p nGuardCount - guard count per thread. A guard costs nothing, the count only limits
+                                 the nesting of guards in the thread. By default, if \p nGuardCount = 0,
+                                 the function uses maximum of guard count for CDS library.
+
+                \p nMaxThreadCount - max count of thread with using EBR GC in your application. Default is 100.
+
+                \p nInitRetiredPtrCount - initial capacity of each limbo bag of the thread.
+                                    Default is 2 * \p nEpochAdvanceFreq. The bags grow if needed.
+
+                \p nEpochAdvanceFreq - the thread tries to advance the global epoch after it has retired \p nEpochAdvanceFreq pointers.
+                                    Default is 64.
+            */
+            static void CDS_STDCALL Construct(
+                size_t nGuardCount = 0,         ///< Epoch guard count per thread
+                size_t nMaxThreadCount = 0,     ///< Max count of simultaneous working thread in your application
+                size_t nInitRetiredPtrCount = 0,///< Initial capacity of the limbo bags of the thread
+                size_t nEpochAdvanceFreq = 0    ///< Count of retired objects between epoch advance attempts
+            );
+
+            /// Destroys global instance of GarbageCollector
+            /**
+                If \p bDetachAll is \p true the destroying GC automatically detaches all attached threads.
+            */
+            static void CDS_STDCALL Destruct(
+                bool bDetachAll = false     ///< Detach all threads
+            );
+
+            /// Returns pointer to GarbageCollector instance
+            static GarbageCollector&   instance()
+            {
+                if ( !m_pEBRManager )
+                    throw not_initialized();
+                return *m_pEBRManager;
+            }
+
+            /// Checks if global GC object is constructed and may be used
+            static bool isUsed() CDS_NOEXCEPT
+            {
+                return m_pEBRManager != nullptr;
+            }
+
+            /// Returns max guard count defined in construction time
+            size_t getGuardCount() const CDS_NOEXCEPT
+            {
+                return m_nGuardCount;
+            }
+
+            /// Returns max thread count defined in construction time
+            size_t getMaxThreadCount() const CDS_NOEXCEPT
+            {
+                return m_nMaxThreadCount;
+            }
+
+            /// Returns initial capacity of limbo bags. It is defined in construction time
+            size_t getInitRetiredPtrCount() const CDS_NOEXCEPT
+            {
+                return m_nInitRetiredPtrCount;
+            }
+
+            /// Returns count of retired objects between epoch advance attempts
+            size_t getEpochAdvanceFreq() const CDS_NOEXCEPT
+            {
+                return m_nEpochAdvanceFreq;
+            }
+
+            /// Returns the current global epoch
+            epoch_type current_epoch() const CDS_NOEXCEPT
+            {
+                return m_nGlobalEpoch.load( atomics::memory_order_acquire );
+            }
+
+            // Internal statistics
+
+            /// Get internal statistics
+            InternalState& getInternalState(InternalState& stat) const;
+
+            /// Get reclamation telemetry, see \ref cds_gc_telemetry "cds::gc::telemetry"
+            telemetry::snapshot& get_telemetry( telemetry::snapshot& s ) const;
+
+            /// Checks if internal statistics enabled
+            bool              isStatisticsEnabled() const { return m_bStatEnabled; }
+
+            /// Enables/disables internal statistics
+            bool              enableStatistics( bool bEnable )
+            {
+                bool bEnabled = m_bStatEnabled;
+                m_bStatEnabled = bEnable;
+                return bEnabled;
+            }
+
+        public:    // Internals for threads
+
+            /// Allocates EBR record. For internal use only
+            details::ebr_record * alloc_record();
+
+            /// Free EBR record. For internal use only
+            void free_record( details::ebr_record * pRec );
+
+            /// Pushes retired pointer \p p to the pending bag of \p pRec. For internal use only
+            void retire( details::ebr_record * pRec, details::retired_ptr const& p )
+            {
+                if ( pRec->m_Pending.push( p ) && m_bStatEnabled )
+                    ++m_Stat.m_BagGrow;
+                if ( pRec->m_Pending.size() >= m_nEpochAdvanceFreq )
+                    Scan( pRec );
+            }
+
+            /// The main garbage collecting function
+            /**
+                The function stamps the pending bag of \p pRec by the global epoch and moves it to the limbo,
+                tries to advance the global epoch and frees the limbo bags that are two epochs old.
+                If no thread is inside of critical section, all retired pointers of \p pRec are freed.
+            */
+            void Scan( details::ebr_record * pRec );
+
+            /// Helper scan routine
+            /**
+                The function frees the expired limbo bags of the records that are not owned by any thread.
+            */
+            void HelpScan( details::ebr_record * pThis );
+
+        private:
+            //@cond
+            size_t seal( details::ebr_record * pRec );
+            bool try_advance( epoch_type& nEpoch );
+            size_t collect( details::ebr_record * pRec, epoch_type nEpoch );
+            //@endcond
+
+            friend struct details::ebr_record;
+        };
+
+        /// Thread's epoch-based reclamation manager
+        /**
+            To use epoch-based reclamation schema each thread object must be linked with the object of ThreadGC class
+            that interacts with GarbageCollector global object. The linkage is performed by calling \ref cds_threading "cds::threading::Manager::attachThread()"
+            on the start of each thread that uses EBR GC. Before terminating the thread linked to EBR GC it is necessary to call
+            \ref cds_threading "cds::threading::Manager::detachThread()".
+        */
+        class ThreadGC: public cds::gc::details::thread_gc_base< GarbageCollector, details::ebr_record, details::epoch_guard >
+        {
+            //@cond
+            typedef cds::gc::details::thread_gc_base< GarbageCollector, details::ebr_record, details::epoch_guard > base_class;
+            //@endcond
+
+        public:
+            /// Places retired pointer \p and its deleter \p pFunc into thread's pending bag for deferred reclamation
+            template <typename T>
+            void retirePtr( T * p, void (* pFunc)(T *) )
+            {
+                retirePtr( details::retired_ptr( reinterpret_cast<void *>( p ), reinterpret_cast<free_retired_ptr_func>( pFunc )));
+            }
+
+            /// Places retired pointer \p into thread's pending bag for deferred reclamation
+            void retirePtr( details::retired_ptr const& p )
+            {
+                assert( m_pRec );
+                m_gc.retire( m_pRec, p );
+            }
+        };
+
+        /// Auto epoch guard
+        /**
+            This class encapsulates epoch guard to protect a pointer against deletion.
+            It allocates one guard from thread's guard array in constructor and frees it in destructor.
+        */
+        class guard
+        {
+        protected:
+            details::epoch_guard&  m_guard; ///< Guard
+
+        public:
+            typedef void * guarded_pointer;  ///< Guarded pointer type
+
+        public:
+            /// Allocates guard
+            guard(); // inline in ebr_impl.h
+
+            /// Frees guard. The pointer guarded may be deleted after this.
+            ~guard(); // inline in ebr_impl.h
+
+            /// Get raw guarded pointer
+            guarded_pointer get() const
+            {
+                return m_guard.get();
+            }
+
+            /// Returns native guard
+            details::epoch_guard& native_guard() const
+            {
+                return m_guard;
+            }
+        };
+
+        /// Auto-managed array of epoch guards
+        /**
+            This class is wrapper around \p cds::gc::ebr::details::ebr_array class.
+            \p Count is the size of the array
+        */
+        template <size_t Count>
+        class array : public details::ebr_array<Count>
+        {
+        public:
+            /// Rebind array for other size \p COUNT2
+            template <size_t Count2>
+            struct rebind {
+                typedef array<Count2>  other;   ///< rebinding result
+            };
+
+        public:
+            /// Allocates array of guards
+            array(); // inline in ebr_impl.h
+
+            /// Frees array of guards
+            ~array(); //inline in ebr_impl.h
+        };
+
+    }   // namespace ebr
+}}  // namespace cds::gc
+//@endcond
+
+//@cond
+// Inlines
+namespace cds {
+    namespace gc { namespace ebr { namespace details {
+
+        inline ebr_record::ebr_record( cds::gc::ebr::GarbageCollector& gc )
+            : m_Guards( gc.m_nGlobalEpoch, gc.getGuardCount() )
+            , m_Pending( gc.getInitRetiredPtrCount() )
+        {
+            for ( size_t i = 0; i < c_nLimboCount; ++i )
+                m_Limbo[i].reserve( gc.getInitRetiredPtrCount() );
+        }
+
+    }}} // namespace gc::ebr::details
+} // namespace cds
+//@endcond
+
+#if CDS_COMPILER == CDS_COMPILER_MSVC
+#   pragma warning(pop)
+#endif
+
+#endif  // #ifndef CDSLIB_GC_DETAILS_EBR_H
@@ -0,0 +1,889 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#ifndef CDSLIB_GC_DETAILS_HE_H
+#define CDSLIB_GC_DETAILS_HE_H
+
+#include <cds/algo/atomic.h>
+#include <cds/os/thread.h>
+#include <cds/details/allocator.h>
+#include <cds/user_setup/cache_line.h>
+#include <cds/gc/details/retired_ptr.h>
+#include <cds/gc/details/thread_record.h>
+#include <cds/gc/telemetry.h>
+
+#if CDS_COMPILER == CDS_COMPILER_MSVC
+#   pragma warning(push)
+    // warning C4251: 'cds::gc::he::GarbageCollector::m_pListHead' : class 'cds::cxx11_atomic::atomic<T>'
+    // needs to have dll-interface to be used by clients of class 'cds::gc::he::GarbageCollector'
+    // warning C4275: non dll-interface class 'cds::gc::details::thread_record_list<...>' used as base
+    // for dll-interface class 'cds::gc::he::GarbageCollector'
+#   pragma warning(disable: 4251 4275)
+#endif
+
+//@cond
+namespace cds { namespace gc {
+
+    /// Hazard Eras reclamation schema
+    /**
+    \par Sources:
+        - [2017] Pedro Ramalhete, Andreia Correia "Brief Announcement: Hazard Eras - Non-Blocking Memory Reclamation"
+        - [2018] Haosen Wen et al. "Interval-Based Memory Reclamation"
+
+        The \p cds::gc::he namespace and its members are internal representation of Hazard Eras GC and should not be used directly.
+        Use \p cds::gc::HE class in your code.
+
+        Unlike Hazard Pointers, a guard publishes not the pointer itself but the current value of the global era clock.
+        The guard is re-published (with a full fence) only when the global era has changed since its last publication,
+        so a traversal step is a plain load in the common case.
+        A retired pointer is stamped with the era of retirement and it can be freed when all published eras are greater
+        than that stamp.
+    */
+    namespace he {
+
+        // forwards
+        class GarbageCollector;
+        class ThreadGC;
+
+        /// Era type
+        typedef uint64_t era_type;
+
+        /// "No era" value: a guard with this era does not protect anything
+        static CDS_CONSTEXPR const era_type c_nNoEra = 0;
+
+        /// Pointer to function to free (destruct and deallocate) retired pointer of specific type
+        typedef cds::gc::details::free_retired_ptr_func free_retired_ptr_func;
+
+        namespace details {
+
+            /// Retired pointer
+            typedef cds::gc::details::retired_ptr   retired_ptr;
+
+            // forward
+            class era_allocator;
+
+            /// Retired pointer stamped with the era of retirement
+            struct retired_era_ptr {
+                retired_ptr m_ptr;          ///< retired pointer
+                era_type    m_nRetireEra;   ///< global era when the pointer has been retired
+
+                //@cond
+                retired_era_ptr() CDS_NOEXCEPT
+                    : m_nRetireEra( c_nNoEra )
+                {}
+
+                void free()
+                {
+                    m_ptr.free();
+                }
+                //@endcond
+            };
+
+            /// Hazard era guard
+            /**
+                It is unsafe to use this class directly.
+                Instead, the \p he::guard class should be used.
+
+                The guard consists of the era published for other threads and of the pointer guarded.
+                The pointer is private for the owner thread, only the era is read by \p GarbageCollector::Scan().
+            */
+            class era_guard
+            {
+                friend class era_allocator;
+
+                atomics::atomic<era_type>   m_nEra;     ///< Published era, \p c_nNoEra if the guard is empty
+                atomics::atomic<void *>     m_pGuarded; ///< Guarded pointer
+                era_allocator *             m_pOwner;   ///< Thread's era allocator
+
+            public:
+                //@cond
+                era_guard() CDS_NOEXCEPT
+                    : m_nEra( c_nNoEra )
+                    , m_pGuarded( nullptr )
+                    , m_pOwner( nullptr )
+                {}
+                //@endcond
+
+                /// Returns the pointer guarded
+                void * get( atomics::memory_order order = atomics::memory_order_acquire ) const CDS_NOEXCEPT
+                {
+                    return m_pGuarded.load( order );
+                }
+
+                /// Returns the era published
+                era_type era( atomics::memory_order order = atomics::memory_order_acquire ) const CDS_NOEXCEPT
+                {
+                    return m_nEra.load( order );
+                }
+
+                /// Guards the pointer \p p that is already protected by another guard of current thread
+                /**
+                    The guard publishes the oldest era of current thread, so it is safe to assign
+                    a pointer guarded by another guard or a pointer that will be validated later.
+                */
+                template <typename T>
+                void set( T * p, atomics::memory_order /*order*/ = atomics::memory_order_release ) CDS_NOEXCEPT; // inline below
+
+                /// Guards the pointer \p p just read from a shared location
+                /**
+                    The guard publishes the current global era. The caller must re-read the shared location
+                    to validate \p p (see \p HE::Guard::protect()).
+                */
+                template <typename T>
+                void set_current( T * p ) CDS_NOEXCEPT; // inline below
+
+                /// Copies the pointer and the era from \p src guard
+                void copy( era_guard const& src ) CDS_NOEXCEPT
+                {
+                    m_pGuarded.store( src.get( atomics::memory_order_relaxed ), atomics::memory_order_relaxed );
+                    publish( src.era( atomics::memory_order_relaxed ));
+                }
+
+                /// Clears the guard
+                void clear( atomics::memory_order order = atomics::memory_order_release ) CDS_NOEXCEPT
+                {
+                    m_pGuarded.store( nullptr, atomics::memory_order_relaxed );
+                    m_nEra.store( c_nNoEra, order );
+                }
+
+                //@cond
+                template <typename T>
+                T * operator =( T * p ) CDS_NOEXCEPT
+                {
+                    set( p );
+                    return p;
+                }
+
+                std::nullptr_t operator =( std::nullptr_t ) CDS_NOEXCEPT
+                {
+                    clear();
+                    return nullptr;
+                }
+                //@endcond
+
+            private:
+                //@cond
+                void publish( era_type nEra ) CDS_NOEXCEPT
+                {
+                    // The full fence is paid only if the era is changed
+                    if ( m_nEra.load( atomics::memory_order_relaxed ) != nEra )
+                        m_nEra.store( nEra, atomics::memory_order_seq_cst );
+                }
+                //@endcond
+            };
+
+            /// Array of hazard era guards
+            /**
+                It is unsafe to use this class directly. Instead, the \p he::array should be used.
+
+                Template parameter \p Count defines the size of the array. \p Count should not exceed
+                \p GarbageCollector::getHazardEraCount().
+            */
+            template <size_t Count>
+            class he_array
+            {
+            public:
+                typedef era_guard   guard_type;     ///< Element type of the array
+                static CDS_CONSTEXPR const size_t c_nCapacity = Count ;   ///< Capacity of the array
+
+            private:
+                guard_type * m_arr;     ///< Guard array of size = \p Count
+                friend class era_allocator;
+
+            public:
+                /// Constructs uninitialized array.
+                he_array() CDS_NOEXCEPT
+                {}
+
+                /// Returns max count of guards for this array
+                CDS_CONSTEXPR size_t capacity() const
+                {
+                    return c_nCapacity;
+                }
+
+                /// Returns reference to the guard of index \p nIndex (0 <= \p nIndex < \p Count)
+                guard_type& operator []( size_t nIndex ) CDS_NOEXCEPT
+                {
+                    assert( nIndex < capacity() );
+                    return m_arr[nIndex];
+                }
+
+                /// Returns reference to the guard of index \p nIndex (0 <= \p nIndex < \p Count) [const version]
+                guard_type& operator []( size_t nIndex ) const CDS_NOEXCEPT
+                {
+                    assert( nIndex < capacity() );
+                    return m_arr[nIndex];
+                }
+
+                /// Clears the guard \p nIndex
+                void clear( size_t nIndex ) CDS_NOEXCEPT
+                {
+                    assert( nIndex < capacity() );
+                    m_arr[ nIndex ].clear();
+                }
+            };
+
+            /// Allocator of hazard era guards for the thread
+            /**
+                The same stack-based schema as \p hp::details::hp_allocator is used.
+                Each allocator object is thread-private.
+            */
+            class era_allocator
+            {
+                typedef cds::details::Allocator< era_guard, CDS_DEFAULT_ALLOCATOR > allocator_impl;
+
+                atomics::atomic<era_type>&  m_EraClock;     ///< Global era clock
+                era_guard * const           m_arrGuard;     ///< Array of guards
+                size_t                      m_nTop;         ///< The top of stack
+                const size_t                m_nCapacity;    ///< Array capacity
+
+            public:
+                /// Ctor
+                era_allocator( atomics::atomic<era_type>& eraClock, size_t nCapacity )
+                    : m_EraClock( eraClock )
+                    , m_arrGuard( allocator_impl().NewArray( nCapacity ))
+                    , m_nCapacity( nCapacity )
+                {
+                    for ( size_t i = 0; i < capacity(); ++i )
+                        m_arrGuard[i].m_pOwner = this;
+                    make_free();
+                }
+
+                /// Dtor
+                ~era_allocator()
+                {
+                    allocator_impl().Delete( m_arrGuard, capacity() );
+                }
+
+                /// Get capacity of array
+                size_t capacity() const CDS_NOEXCEPT
+                {
+                    return m_nCapacity;
+                }
+
+                /// Checks if all guards are allocated
+                bool isFull() const CDS_NOEXCEPT
+                {
+                    return m_nTop == 0;
+                }
+
+                /// Allocates a guard
+                era_guard& alloc()
+                {
+                    assert( m_nTop > 0 );
+                    --m_nTop;
+                    return m_arrGuard[m_nTop];
+                }
+
+                /// Frees previously allocated guard
+                void free( era_guard& g ) CDS_NOEXCEPT
+                {
+                    assert( m_nTop < capacity() );
+                    g.clear();
+                    ++m_nTop;
+                }
+
+                /// Allocates the guard array
+                template <size_t Count>
+                void alloc( he_array<Count>& arr )
+                {
+                    assert( m_nTop >= Count );
+                    m_nTop -= Count;
+                    arr.m_arr = m_arrGuard + m_nTop;
+                }
+
+                /// Frees the guard array allocated by previous call \p this->alloc
+                template <size_t Count>
+                void free( he_array<Count> const& arr ) CDS_NOEXCEPT
+                {
+                    CDS_UNUSED( arr );
+
+                    assert( m_nTop + Count <= capacity());
+                    for ( size_t i = m_nTop; i < m_nTop + Count; ++i )
+                        m_arrGuard[i].clear();
+                    m_nTop += Count;
+                }
+
+                /// Makes all guards free
+                void clear() CDS_NOEXCEPT
+                {
+                    make_free();
+                }
+
+                /// Returns the i-th guard
+                era_guard& operator []( size_t i ) CDS_NOEXCEPT
+                {
+                    assert( i < capacity() );
+                    return m_arrGuard[i];
+                }
+
+                /// Returns the current global era
+                era_type current_era() const CDS_NOEXCEPT
+                {
+                    return m_EraClock.load( atomics::memory_order_seq_cst );
+                }
+
+                /// Returns the oldest era published by the thread or the current era if the thread publishes nothing
+                era_type safe_era() const CDS_NOEXCEPT
+                {
+                    era_type nEra = current_era();
+                    for ( size_t i = m_nTop; i < m_nCapacity; ++i ) {
+                        era_type nGuardEra = m_arrGuard[i].era( atomics::memory_order_relaxed );
+                        if ( nGuardEra != c_nNoEra && nGuardEra < nEra )
+                            nEra = nGuardEra;
+                    }
+                    return nEra;
+                }
+
+            private:
+                //@cond
+                void make_free() CDS_NOEXCEPT
+                {
+                    for ( size_t i = 0; i < capacity(); ++i )
+                        m_arrGuard[i].clear();
+                    m_nTop = capacity();
+                }
+                //@endcond
+            };
+
+            /// Array of retired pointers
+            /**
+                The array belongs to the thread: owner thread writes to the array, other threads
+                just read it. Unlike \p hp::details::retired_vector the array is growing:
+                a thread that stalls inside an era may hold back any number of retired pointers.
+            */
+            class retired_vector {
+                typedef cds::details::Allocator< retired_era_ptr, CDS_DEFAULT_ALLOCATOR > allocator_impl;
+
+                retired_era_ptr *   m_arr;          ///< the array of retired pointers
+                size_t              m_nCapacity;    ///< Current capacity of \p m_arr
+                size_t              m_nSize;        ///< Current size of \p m_arr
+
+            public:
+                /// Iterator
+                typedef retired_era_ptr * iterator;
+
+                /// Constructor
+                explicit retired_vector( size_t nCapacity )
+                    : m_arr( allocator_impl().NewArray( nCapacity ))
+                    , m_nCapacity( nCapacity )
+                    , m_nSize( 0 )
+                {}
+
+                ~retired_vector()
+                {
+                    allocator_impl().Delete( m_arr, m_nCapacity );
+                }
+
+                /// Vector capacity
+                size_t capacity() const CDS_NOEXCEPT
+                {
+                    return m_nCapacity;
+                }
+
+                /// Current vector size (count of retired pointers in the vector)
+                size_t size() const CDS_NOEXCEPT
+                {
+                    return m_nSize;
+                }
+
+                /// Set vector size. Uses internally
+                void size( size_t nSize )
+                {
+                    assert( nSize <= capacity() );
+                    m_nSize = nSize;
+                }
+
+                /// Pushes retired pointer to the vector
+                void push( retired_ptr const& p, era_type nEra )
+                {
+                    assert( m_nSize < capacity() );
+                    m_arr[ m_nSize ].m_ptr = p;
+                    m_arr[ m_nSize ].m_nRetireEra = nEra;
+                    ++m_nSize;
+                }
+
+                /// Pushes retired pointer to the vector
+                void push( retired_era_ptr const& p )
+                {
+                    push( p.m_ptr, p.m_nRetireEra );
+                }
+
+                /// Checks if the vector is full (size() == capacity() )
+                bool isFull() const CDS_NOEXCEPT
+                {
+                    return m_nSize >= capacity();
+                }
+
+                /// Doubles the capacity of the vector
+                void grow()
+                {
+                    size_t const nNewCapacity = m_nCapacity * 2;
+                    retired_era_ptr * pNew = allocator_impl().NewArray( nNewCapacity );
+                    std::copy( m_arr, m_arr + m_nSize, pNew );
+                    allocator_impl().Delete( m_arr, m_nCapacity );
+                    m_arr = pNew;
+                    m_nCapacity = nNewCapacity;
+                }
+
+                /// Begin iterator
+                iterator begin() CDS_NOEXCEPT
+                {
+                    return m_arr;
+                }
+
+                /// End iterator
+                iterator end() CDS_NOEXCEPT
+                {
+                    return m_arr + m_nSize;
+                }
+
+                /// Clears the vector. After clearing, size() == 0
+                void clear() CDS_NOEXCEPT
+                {
+                    m_nSize = 0;
+                }
+            };
+
+            /// Hazard era record of the thread
+            /**
+                The structure of type "single writer - multiple reader": only the owner thread may write to this structure
+                other threads have read-only access.
+            */
+            struct he_record {
+                era_allocator   m_Guards;       ///< array of hazard era guards
+                retired_vector  m_arrRetired;   ///< Retired pointer array
+                size_t          m_nRetireCount; ///< Count of retired pointers since last era increment
+
+                /// Ctor
+                he_record( cds::gc::he::GarbageCollector& gc );    // inline
+                ~he_record()
+                {}
+
+                /// Clears all guards
+                void clear()
+                {
+                    m_Guards.clear();
+                }
+            };
+        }    // namespace details
+
+        /// Hazard Eras singleton
+        /**
+            Safe memory reclamation schema "Hazard Eras" by Ramalhete and Correia.
+
+            The garbage collector maintains the global era clock. A guard publishes the era
+            it has observed when the guarded pointer was read. A pointer is stamped with the current era
+            when it is retired. The retired pointer can be freed if its stamp is less than
+            any published era: a thread that reads the pointer after it has been unlinked
+            cannot publish an era older than the stamp.
+
+            The node allocation is performed by containers, so the GC does not know the birth era of an object,
+            the lifetime interval of any object begins at era zero. Thus a thread that stalls while holding a guard
+            prevents freeing objects retired after the era it has published. The threads having no active guards
+            never block the reclamation.
+        */
+        class CDS_EXPORT_API GarbageCollector: public cds::gc::details::thread_record_list< details::he_record >
+        {
+            friend class cds::gc::details::thread_gc_base< GarbageCollector, details::he_record, details::era_guard >;
+
+        public:
+            typedef cds::atomicity::event_counter  event_counter   ;   ///< event counter type
+
+            /// Internal GC statistics
+            struct InternalState {
+                size_t              nHECount                ;   ///< Hazard era guard count per thread (const)
+                size_t              nMaxThreadCount         ;   ///< Max thread count (const)
+                size_t              nInitRetiredPtrCount    ;   ///< Initial capacity of retired pointer array per thread (const)
+                size_t              nEraAdvanceFreq         ;   ///< Count of retired pointers per thread between era increments (const)
+                era_type            nCurrentEra             ;   ///< Current global era
+
+                size_t              nHERecAllocated         ;   ///< Count of HE record allocations
+                size_t              nHERecUsed              ;   ///< Count of HE record used
+                size_t              nTotalRetiredPtrCount   ;   ///< Current total count of retired pointers
+                size_t              nRetiredPtrInFreeHERecs ;   ///< Count of retired pointer in free (unused) HE records
+
+                event_counter::value_type   evcAllocHERec   ;   ///< Count of \p he_record allocations
+                event_counter::value_type   evcRetireHERec  ;   ///< Count of \p he_record retire events
+                event_counter::value_type   evcAllocNewHERec;   ///< Count of new \p he_record allocations from heap
+                event_counter::value_type   evcDeleteHERec  ;   ///< Count of \p he_record deletions
+
+                event_counter::value_type   evcScanCall     ;   ///< Count of Scan calling
+                event_counter::value_type   evcHelpScanCall ;   ///< Count of HelpScan calling
+                event_counter::value_type   evcScanFromHelpScan;///< Count of Scan calls from HelpScan
+                event_counter::value_type   evcRetiredGrow  ;   ///< Count of retired array growing
+
+                event_counter::value_type   evcDeletedNode  ;   ///< Count of deleting of retired objects
+                event_counter::value_type   evcDeferredNode ;   ///< Count of objects that cannot be deleted in Scan phase because of an era guards it
+            };
+
+            /// No GarbageCollector object is created
+            class not_initialized : public std::runtime_error
+            {
+            public:
+                //@cond
+                not_initialized()
+                    : std::runtime_error( "Global Hazard Eras GarbageCollector is not initialized" )
+                {}
+                //@endcond
+            };
+
+        private:
+            /// Internal GC statistics
+            struct Statistics {
+                event_counter  m_AllocHERec         ;    ///< Count of \p he_record allocations
+                event_counter  m_RetireHERec        ;    ///< Count of \p he_record retire events
+                event_counter  m_AllocNewHERec      ;    ///< Count of new \p he_record allocations from heap
+                event_counter  m_DeleteHERec        ;    ///< Count of \p he_record deletions
+
+                event_counter  m_ScanCallCount      ;    ///< Count of Scan calling
+                event_counter  m_HelpScanCallCount  ;    ///< Count of HelpScan calling
+                event_counter  m_CallScanFromHelpScan;   ///< Count of Scan calls from HelpScan
+                event_counter  m_RetiredGrow        ;    ///< Count of retired array growing
+
+                event_counter  m_DeletedNode        ;    ///< Count of retired objects deleting
+                event_counter  m_DeferredNode       ;    ///< Count of objects that cannot be deleted in Scan phase
+            };
+
+            /// Internal list node of cds::gc::he::details::he_record
+            typedef cds::gc::details::thread_record_list< details::he_record >::node_type helist_node;
+
+            static GarbageCollector *    m_pHEManager   ;   ///< GC instance pointer
+
+            char pad1_[cds::c_nCacheLineSize];
+            atomics::atomic<era_type>   m_nEraClock     ;   ///< Global era clock
+            char pad2_[cds::c_nCacheLineSize - sizeof(atomics::atomic<era_type>)];
+
+            Statistics              m_Stat              ;   ///< Internal statistics
+            bool                    m_bStatEnabled      ;   ///< true - statistics enabled
+            telemetry::gc_collector m_Telemetry         ;   ///< Reclamation telemetry
+
+            const size_t            m_nHazardEraCount       ;   ///< max count of thread's guards
+            const size_t            m_nMaxThreadCount       ;   ///< max count of thread
+            const size_t            m_nInitRetiredPtrCount  ;   ///< initial capacity of retired ptr array per thread
+            const size_t            m_nEraAdvanceFreq       ;   ///< count of retired pointers between era increments
+
+        private:
+            /// Ctor
+            GarbageCollector(
+                size_t nHazardEraCount = 0,         ///< Hazard era guard count per thread
+                size_t nMaxThreadCount = 0,         ///< Max count of thread
+                size_t nInitRetiredPtrCount = 0,    ///< Initial capacity of the array of retired objects
+                size_t nEraAdvanceFreq = 0          ///< Count of retired objects between era increments
+            );
+
+            /// Dtor
+            ~GarbageCollector();
+
+            /// Allocate new HE record
+            helist_node * NewHERec();
+
+            /// Permanently deletes HE record \p pNode
+            void DeleteHERec( helist_node * pNode );
+
+            void detachAllThread();
+
+        public:
+            /// Creates GarbageCollector singleton
+            /**
+                GC is the singleton. If GC instance is not exist then the function creates the instance.
+                Otherwise it does nothing.
+
+                The Hazard Eras schema depends of the following parameters:
+
+                \p nHazardEraCount - guard count per thread. Usually it is small number (2-4) depending from
+                                     the data structure algorithms. By default, if \p nHazardEraCount = 0,
+                                     the function uses maximum of guard count for CDS library.
+
+                \p nMaxThreadCount - max count of thread with using HE GC in your application. Default is 100.
+
+                \p nInitRetiredPtrCount - initial capacity of array of retired pointers for each thread.
+                                    Default is 2 * \p nHazardEraCount * \p nMaxThreadCount. The array grows if needed.
+
+                \p nEraAdvanceFreq - the global era is incremented after the thread retires \p nEraAdvanceFreq pointers.
+                                    Default is 64.
+            */
+            static void CDS_STDCALL Construct(
+                size_t nHazardEraCount = 0,     ///< Hazard era guard count per thread
+                size_t nMaxThreadCount = 0,     ///< Max count of simultaneous working thread in your application
+                size_t nInitRetiredPtrCount = 0,///< Initial capacity of the array of retired objects for the thread
+                size_t nEraAdvanceFreq = 0      ///< Count of retired objects between era increments
+            );
+
+            /// Destroys global instance of GarbageCollector
+            /**
+                If \p bDetachAll is \p true the destroying GC automatically detaches all attached threads.
+            */
+            static void CDS_STDCALL Destruct(
+                bool bDetachAll = false     ///< Detach all threads
+            );
+
+            /// Returns pointer to GarbageCollector instance
+            static GarbageCollector&   instance()
+            {
+                if ( !m_pHEManager )
+                    throw not_initialized();
+                return *m_pHEManager;
+            }
+
+            /// Checks if global GC object is constructed and may be used
+            static bool isUsed() CDS_NOEXCEPT
+            {
+                return m_pHEManager != nullptr;
+            }
+
+            /// Returns max guard count defined in construction time
+            size_t getHazardEraCount() const CDS_NOEXCEPT
+            {
+                return m_nHazardEraCount;
+            }
+
+            /// Returns max thread count defined in construction time
+            size_t getMaxThreadCount() const CDS_NOEXCEPT
+            {
+                return m_nMaxThreadCount;
+            }
+
+            /// Returns initial size of retired objects array. It is defined in construction time
+            size_t getInitRetiredPtrCount() const CDS_NOEXCEPT
+            {
+                return m_nInitRetiredPtrCount;
+            }
+
+            /// Returns count of retired objects between era increments
+            size_t getEraAdvanceFreq() const CDS_NOEXCEPT
+            {
+                return m_nEraAdvanceFreq;
+            }
+
+            /// Returns the current global era
+            era_type current_era() const CDS_NOEXCEPT
+            {
+                return m_nEraClock.load( atomics::memory_order_seq_cst );
+            }
+
+            /// Increments the global era
+            void advance_era() CDS_NOEXCEPT
+            {
+                m_nEraClock.fetch_add( 1, atomics::memory_order_acq_rel );
+            }
+
+            // Internal statistics
+
+            /// Get internal statistics
+            InternalState& getInternalState(InternalState& stat) const;
+
+            /// Get reclamation telemetry, see \ref cds_gc_telemetry "cds::gc::telemetry"
+            telemetry::snapshot& get_telemetry( telemetry::snapshot& s ) const;
+
+            /// Checks if internal statistics enabled
+            bool              isStatisticsEnabled() const { return m_bStatEnabled; }
+
+            /// Enables/disables internal statistics
+            bool              enableStatistics( bool bEnable )
+            {
+                bool bEnabled = m_bStatEnabled;
+                m_bStatEnabled = bEnable;
+                return bEnabled;
+            }
+
+        public:    // Internals for threads
+
+            /// Allocates Hazard Era GC record. For internal use only
+            details::he_record * alloc_record();
+
+            /// Free HE record. For internal use only
+            void free_record( details::he_record * pRec );
+
+            /// The main garbage collecting function
+            /**
+                The function increments the global era, computes the minimal era published by all threads
+                and frees any retired pointer of \p pRec stamped by an older era.
+                The scan neither allocates memory nor sorts anything.
+            */
+            void Scan( details::he_record * pRec );
+
+            /// Helper scan routine
+            /**
+                The function moves retired pointers of inactive HE records to \p pThis record
+                like \p hp::GarbageCollector::HelpScan() does.
+            */
+            void HelpScan( details::he_record * pThis );
+
+        private:
+            //@cond
+            era_type min_published_era() const;
+            void push_retired( details::he_record * pRec, details::retired_era_ptr const& p );
+            //@endcond
+
+            friend struct details::he_record;
+        };
+
+        /// Thread's hazard era manager
+        /**
+            To use Hazard Eras reclamation schema each thread object must be linked with the object of ThreadGC class
+            that interacts with GarbageCollector global object. The linkage is performed by calling \ref cds_threading "cds::threading::Manager::attachThread()"
+            on the start of each thread that uses HE GC. Before terminating the thread linked to HE GC it is necessary to call
+            \ref cds_threading "cds::threading::Manager::detachThread()".
+        */
+        class ThreadGC: public cds::gc::details::thread_gc_base< GarbageCollector, details::he_record, details::era_guard >
+        {
+            //@cond
+            typedef cds::gc::details::thread_gc_base< GarbageCollector, details::he_record, details::era_guard > base_class;
+            //@endcond
+
+        public:
+            /// Places retired pointer \p and its deleter \p pFunc into thread's array of retired pointer for deferred reclamation
+            template <typename T>
+            void retirePtr( T * p, void (* pFunc)(T *) )
+            {
+                retirePtr( details::retired_ptr( reinterpret_cast<void *>( p ), reinterpret_cast<free_retired_ptr_func>( pFunc )));
+            }
+
+            /// Places retired pointer \p into thread's array of retired pointer for deferred reclamation
+            void retirePtr( details::retired_ptr const& p )
+            {
+                assert( m_pRec );
+                m_pRec->m_arrRetired.push( p, m_gc.current_era() );
+
+                if ( ++m_pRec->m_nRetireCount >= m_gc.getEraAdvanceFreq() ) {
+                    m_pRec->m_nRetireCount = 0;
+                    m_gc.advance_era();
+                }
+
+                if ( m_pRec->m_arrRetired.isFull() ) {
+                    // Max of retired pointer count is reached. Do scan
+                    scan();
+                }
+            }
+        };
+
+        /// Auto era guard
+        /**
+            This class encapsulates hazard era guard to protect a pointer against deletion.
+            It allocates one guard from thread's guard array in constructor and frees it in destructor.
+        */
+        class guard
+        {
+        protected:
+            details::era_guard&  m_guard; ///< Guard
+
+        public:
+            typedef void * guarded_pointer;  ///< Guarded pointer type
+
+        public:
+            /// Allocates guard
+            guard(); // inline in he_impl.h
+
+            /// Frees guard. The pointer guarded may be deleted after this.
+            ~guard(); // inline in he_impl.h
+
+            /// Get raw guarded pointer
+            guarded_pointer get() const
+            {
+                return m_guard.get();
+            }
+
+            /// Returns native guard
+            details::era_guard& native_guard() const
+            {
+                return m_guard;
+            }
+        };
+
+        /// Auto-managed array of hazard era guards
+        /**
+            This class is wrapper around \p cds::gc::he::details::he_array class.
+            \p Count is the size of the array
+        */
+        template <size_t Count>
+        class array : public details::he_array<Count>
+        {
+        public:
+            /// Rebind array for other size \p COUNT2
+            template <size_t Count2>
+            struct rebind {
+                typedef array<Count2>  other;   ///< rebinding result
+            };
+
+        public:
+            /// Allocates array of guards
+            array(); // inline in he_impl.h
+
+            /// Frees array of guards
+            ~array(); //inline in he_impl.h
+        };
+
+    }   // namespace he
+}}  // namespace cds::gc
+//@endcond
+
+//@cond
+// Inlines
+namespace cds {
+    namespace gc { namespace he { namespace details {
+
+        template <typename T>
+        inline void era_guard::set( T * p, atomics::memory_order /*order*/ ) CDS_NOEXCEPT
+        {
+            if ( p ) {
+                m_pGuarded.store( reinterpret_cast<void *>( const_cast<T *>( p )), atomics::memory_order_relaxed );
+                publish( m_pOwner->safe_era() );
+            }
+            else
+                clear();
+        }
+
+        template <typename T>
+        inline void era_guard::set_current( T * p ) CDS_NOEXCEPT
+        {
+            if ( p ) {
+                m_pGuarded.store( reinterpret_cast<void *>( const_cast<T *>( p )), atomics::memory_order_relaxed );
+                publish( m_pOwner->current_era() );
+            }
+            else
+                clear();
+        }
+
+        inline he_record::he_record( cds::gc::he::GarbageCollector& gc )
+            : m_Guards( gc.m_nEraClock, gc.getHazardEraCount() )
+            , m_arrRetired( gc.getInitRetiredPtrCount() )
+            , m_nRetireCount( 0 )
+        {}
+
+    }}} // namespace gc::he::details
+} // namespace cds
+//@endcond
+
+#if CDS_COMPILER == CDS_COMPILER_MSVC
+#   pragma warning(pop)
+#endif
+
+#endif  // #ifndef CDSLIB_GC_DETAILS_HE_H
@@ -34,10 +34,14 @@
 #include <cds/algo/atomic.h>
 #include <cds/os/thread.h>
 #include <cds/details/bounded_array.h>
+#include <cds/details/allocator.h>
 #include <cds/user_setup/cache_line.h>
 
 #include <cds/gc/details/hp_type.h>
 #include <cds/gc/details/hp_alloc.h>
+#include <cds/gc/telemetry.h>
+
+#include <algorithm>    // std::copy
 
 #if CDS_COMPILER == CDS_COMPILER_MSVC
 #   pragma warning(push)
@@ -171,6 +175,208 @@ namespace cds {
                 }
             };
 
+            /// Batch of retired pointers spilled to the global orphan list
+            /**
+                If the thread's \p retired_vector is still too full after \p GarbageCollector::Scan(),
+                the retired pointers are moved to a batch that is pushed onto the lock-free orphan list
+                of \p GarbageCollector (see \p GarbageCollector::setSpillThreshold()).
+                The batch belongs to the thread that has taken it from the orphan list.
+
+                The capacity of a batch is equal to the capacity of \p retired_vector, so the batch
+                emptied by \p GarbageCollector::reclaim_orphans() can be reused for the next spill
+                instead of heap allocation (see \p hp_record::m_pSpareBatch).
+            */
+            class retired_batch {
+                typedef cds::details::Allocator< retired_ptr, CDS_DEFAULT_ALLOCATOR > allocator_impl;
+
+                retired_ptr *   m_arr;      ///< retired pointers
+                size_t          m_nSize;    ///< count of retired pointers in \p m_arr
+                size_t const    m_nCapacity;///< capacity of \p m_arr
+
+            public:
+                retired_batch * m_pNext;    ///< next batch in the orphan list
+
+                /// Iterator
+                typedef retired_ptr * iterator;
+
+                /// Allocates an empty batch of capacity \p nCapacity
+                explicit retired_batch( size_t nCapacity )
+                    : m_arr( allocator_impl().NewArray( nCapacity ))
+                    , m_nSize( 0 )
+                    , m_nCapacity( nCapacity )
+                    , m_pNext( nullptr )
+                {}
+
+                //@cond
+                retired_batch( retired_batch const& ) = delete;
+
+                ~retired_batch()
+                {
+                    allocator_impl().Delete( m_arr, m_nCapacity );
+                }
+                //@endcond
+
+                /// Moves all pointers of \p src to the batch; \p src becomes empty
+                void assign( retired_vector& src )
+                {
+                    assert( src.size() <= m_nCapacity );
+                    std::copy( src.begin(), src.end(), m_arr );
+                    m_nSize = src.size();
+                    m_pNext = nullptr;
+                    src.clear();
+                }
+
+                /// Capacity of the batch
+                size_t capacity() const CDS_NOEXCEPT
+                {
+                    return m_nCapacity;
+                }
+
+                /// Count of retired pointers in the batch
+                size_t size() const CDS_NOEXCEPT
+                {
+                    return m_nSize;
+                }
+
+                /// Shrinks the batch to \p nSize retired pointers
+                void size( size_t nSize )
+                {
+                    assert( nSize <= m_nSize );
+                    m_nSize = nSize;
+                }
+
+                /// Begin iterator
+                iterator begin() CDS_NOEXCEPT
+                {
+                    return m_arr;
+                }
+
+                /// End iterator
+                iterator end() CDS_NOEXCEPT
+                {
+                    return m_arr + m_nSize;
+                }
+            };
+
+            /// Snapshot of hazard pointers of all threads
+            /**
+                The snapshot is a thread-private buffer that is filled by \p GarbageCollector::Scan()
+                and reused by each subsequent scan of the thread, so the scan does not allocate memory.
+                The buffers are allocated on first use: the array of \p capacity() hazard pointers
+                and, for \p hashed scan only, the open-addressing hash set of <tt>2 * capacity()</tt> rounded up to power of two.
+                The snapshot grows only if the count of HP records exceeds max thread count specified in GC ctor.
+            */
+            class hp_snapshot {
+                typedef cds::details::Allocator< void *, CDS_DEFAULT_ALLOCATOR > allocator_impl;
+
+                void **     m_arr;          ///< hazard pointers snapshot
+                size_t      m_nCapacity;    ///< capacity of \p m_arr
+                size_t      m_nSize;        ///< count of hazard pointers in \p m_arr
+
+                void **     m_pHash;        ///< open-addressing hash set of hazard pointers
+                size_t      m_nHashCapacity;///< capacity of \p m_pHash, power of two
+                size_t      m_nHashMask;    ///< hash mask of the hash set built, \p m_nHashMask + 1 <= \p m_nHashCapacity
+
+            public:
+                /// Iterator
+                typedef void ** iterator;
+
+                //@cond
+                explicit hp_snapshot( size_t nCapacity )
+                    : m_arr( nullptr )
+                    , m_nCapacity( nCapacity )
+                    , m_nSize( 0 )
+                    , m_pHash( nullptr )
+                    , m_nHashCapacity( 0 )
+                    , m_nHashMask( 0 )
+                {}
+
+                ~hp_snapshot()
+                {
+                    if ( m_arr )
+                        allocator_impl().Delete( m_arr, m_nCapacity );
+                    if ( m_pHash )
+                        allocator_impl().Delete( m_pHash, m_nHashCapacity );
+                }
+                //@endcond
+
+                /// Snapshot capacity
+                size_t capacity() const CDS_NOEXCEPT
+                {
+                    return m_nCapacity;
+                }
+
+                /// Count of hazard pointers in the snapshot
+                size_t size() const CDS_NOEXCEPT
+                {
+                    return m_nSize;
+                }
+
+                /// Clears the snapshot, the buffers are not freed
+                void clear() CDS_NOEXCEPT
+                {
+                    if ( !m_arr )
+                        m_arr = allocator_impl().NewArray( m_nCapacity );
+                    m_nSize = 0;
+                }
+
+                /// Adds hazard pointer \p p into the snapshot
+                void push( void * p )
+                {
+                    assert( m_arr );
+                    if ( m_nSize >= m_nCapacity )
+                        grow();
+                    m_arr[ m_nSize++ ] = p;
+                }
+
+                /// Begin iterator
+                iterator begin() CDS_NOEXCEPT
+                {
+                    return m_arr;
+                }
+
+                /// End iterator
+                iterator end() CDS_NOEXCEPT
+                {
+                    return m_arr + m_nSize;
+                }
+
+                /// Sorts the snapshot for \p binary_search()
+                void sort();
+
+                /// Checks if \p p is in the sorted snapshot
+                bool binary_search( void * p ) const;
+
+                /// Builds the hash set for \p hash_contains()
+                void build_hash();
+
+                /// Checks if \p p is in the hash set built
+                bool hash_contains( void * p ) const CDS_NOEXCEPT
+                {
+                    for ( size_t i = hash( p ) & m_nHashMask; ; i = ( i + 1 ) & m_nHashMask ) {
+                        void * q = m_pHash[i];
+                        if ( q == p )
+                            return true;
+                        if ( q == nullptr )
+                            return false;
+                    }
+                }
+
+            private:
+                //@cond
+                static size_t hash( void * p ) CDS_NOEXCEPT
+                {
+                    // Low bits of a pointer are zero due to alignment; mix high bits into low ones
+                    size_t h = static_cast<size_t>( reinterpret_cast<uintptr_t>( p ) >> 3 );
+                    h ^= h >> 17;
+                    h *= static_cast<size_t>( 0x9E3779B97F4A7C15ULL );
+                    return h ^ ( h >> 29 );
+                }
+
+                void grow();
+                //@endcond
+            };
+
             /// Hazard pointer record of the thread
             /**
                 The structure of type "single writer - multiple reader": only the owner thread may write to this structure
@@ -179,6 +385,8 @@ namespace cds {
             struct hp_record {
                 hp_allocator<>    m_hzp;         ///< array of hazard pointers. Implicit \ref CDS_DEFAULT_ALLOCATOR dependency
                 retired_vector    m_arrRetired ; ///< Retired pointer array
+                hp_snapshot       m_Snapshot   ; ///< Hazard pointer snapshot used by \p GarbageCollector::Scan()
+                retired_batch *   m_pSpareBatch; ///< Preallocated batch for the next spill, may be \p nullptr
 
                 char padding[cds::c_nCacheLineSize];
                 atomics::atomic<unsigned int> m_nSync; ///< dummy var to introduce synchronizes-with relationship between threads
@@ -186,7 +394,9 @@ namespace cds {
                 /// Ctor
                 hp_record( const cds::gc::hp::GarbageCollector& HzpMgr );    // inline
                 ~hp_record()
-                {}
+                {
+                    delete m_pSpareBatch;
+                }
 
                 /// Clears all hazard pointers
                 void clear()
@@ -207,7 +417,8 @@ namespace cds {
         */
         enum scan_type {
             classic,    ///< classic scan as described in Michael's works (see GarbageCollector::classic_scan)
-            inplace     ///< inplace scan without allocation (see GarbageCollector::inplace_scan)
+            inplace,    ///< inplace scan without allocation (see GarbageCollector::inplace_scan)
+            hashed      ///< hash set based scan (see GarbageCollector::hashed_scan)
         };
 
         /// Hazard Pointer singleton
@@ -248,6 +459,11 @@ namespace cds {
 
                 event_counter::value_type   evcDeletedNode  ;   ///< Count of deleting of retired objects
                 event_counter::value_type   evcDeferredNode ;   ///< Count of objects that cannot be deleted in Scan phase because of a hazard_pointer guards it
+
+                size_t                      nOrphanRetiredCount ;   ///< Current count of retired pointers in the orphan list
+                event_counter::value_type   evcSpilledBatch     ;   ///< Count of retired batches spilled to the orphan list
+                event_counter::value_type   evcSpilledNode      ;   ///< Count of retired pointers spilled to the orphan list
+                event_counter::value_type   evcReclaimOrphanCall;   ///< Count of reclaim_orphans calls that have found the orphan list non-empty
             };
 
             /// No GarbageCollector object is created
@@ -286,6 +502,10 @@ namespace cds {
 
                 event_counter  m_DeletedNode            ;    ///< Count of retired objects deleting
                 event_counter  m_DeferredNode            ;    ///< Count of objects that cannot be deleted in Scan phase because of a hazard_pointer guards it
+
+                event_counter  m_SpilledBatch            ;    ///< Count of retired batches spilled to the orphan list
+                event_counter  m_SpilledNode             ;    ///< Count of retired pointers spilled to the orphan list
+                event_counter  m_ReclaimOrphanCall       ;    ///< Count of reclaim_orphans calls that have found the orphan list non-empty
             };
 
             /// Internal list of cds::gc::hp::details::hp_record
@@ -312,16 +532,20 @@ namespace cds {
             };
 
             atomics::atomic<hplist_node *>   m_pListHead  ;  ///< Head of GC list
+            atomics::atomic<details::retired_batch *> m_pOrphanList ;   ///< Lock-free list of spilled retired batches
+            atomics::atomic<size_t>          m_nOrphanCount ;   ///< Count of retired pointers in \p m_pOrphanList
 
             static GarbageCollector *    m_pHZPManager  ;   ///< GC instance pointer
 
             Statistics              m_Stat              ;   ///< Internal statistics
             bool                    m_bStatEnabled      ;   ///< true - statistics enabled
+            telemetry::gc_collector    m_Telemetry         ;   ///< Reclamation telemetry
 
             const size_t            m_nHazardPointerCount   ;   ///< max count of thread's hazard pointer
             const size_t            m_nMaxThreadCount       ;   ///< max count of thread
             const size_t            m_nMaxRetiredPtrCount   ;   ///< max count of retired ptr per thread
             scan_type               m_nScanType             ;   ///< scan type (see \ref scan_type enum)
+            atomics::atomic<size_t> m_nSpillThreshold       ;   ///< spill threshold, 0 - spilling is disabled (see \ref hzp_gc_setSpillThreshold "setSpillThreshold")
 
 
         private:
@@ -420,6 +644,9 @@ namespace cds {
             /// Get internal statistics
             InternalState& getInternalState(InternalState& stat) const;
 
+            /// Get reclamation telemetry, see \ref cds_gc_telemetry "cds::gc::telemetry"
+            telemetry::snapshot& get_telemetry( telemetry::snapshot& s ) const;
+
             /// Checks if internal statistics enabled
             bool              isStatisticsEnabled() const { return m_bStatEnabled; }
 
@@ -458,6 +685,44 @@ namespace cds {
                 m_nScanType = nScanType;
             }
 
+            /// Get current spill threshold
+            size_t getSpillThreshold() const
+            {
+                return m_nSpillThreshold.load( atomics::memory_order_relaxed );
+            }
+
+            /// Set spill threshold
+            /** @anchor hzp_gc_setSpillThreshold
+                By default (\p nThreshold = 0) the thread whose array of retired pointers is full does \p Scan()
+                and \p HelpScan() until the array has free space. If the most of retired pointers are guarded
+                the thread calls \p Scan() almost on each \p retire() call, and \p HelpScan() moves all retired pointers
+                of dead threads to the unlucky thread that causes latency spikes.
+
+                If \p nThreshold > 0 the overflow mode is enabled:
+                - if after \p Scan() the thread's array still contains more than \p nThreshold retired pointers,
+                  the array is spilled as a batch to the global lock-free orphan list;
+                - \p HelpScan() spills retired pointers of dead threads to the orphan list instead of scanning them.
+
+                The orphan list is drained cooperatively by \ref hzp_gc_reclaim_orphans "reclaim_orphans"
+                called at the end of \p ThreadGC::scan() that has spilled nothing; also it may be called
+                by a dedicated thread via \p cds::gc::HP::reclaim_orphans().
+                The spilling thread does not drain the orphan list in the same scan, otherwise it would re-check
+                the batch just spilled and the latency of \p retire() would not be bounded.
+
+                The batches are not allocated on each spill: the HP record of each thread keeps a spare batch
+                that is preallocated when the record is allocated in the overflow mode
+                and is refilled by the batches emptied by \p reclaim_orphans().
+
+                Spill threshold changing is allowed on the fly.
+            */
+            void setSpillThreshold(
+                size_t nThreshold   ///< new spill threshold, 0 - disable spilling
+            )
+            {
+                m_nSpillThreshold.store( nThreshold < m_nMaxRetiredPtrCount ? nThreshold : m_nMaxRetiredPtrCount - 1,
+                    atomics::memory_order_relaxed );
+            }
+
         public:    // Internals for threads
 
             /// Allocates Hazard Pointer GC record. For internal use only
@@ -472,23 +737,43 @@ namespace cds {
                 is reached.
 
                 There are the following scan algorithm:
-                - \ref hzp_gc_classic_scan "classic_scan" allocates memory for internal use
-                - \ref hzp_gc_inplace_scan "inplace_scan" does not allocate any memory
+                - \ref hzp_gc_classic_scan "classic_scan" sorts the snapshot of hazard pointers and uses binary search
+                - \ref hzp_gc_inplace_scan "inplace_scan" sorts the array of retired pointers and marks guarded ones in-place
+                - \ref hzp_gc_hashed_scan "hashed_scan" builds the hash set of hazard pointers, it is suitable for large thread count
+
+                No algorithm allocates memory on each call: the snapshot of hazard pointers is thread-private buffer
+                reused by each scan of the thread.
 
                 Use \ref hzp_gc_setScanType "setScanType" member function to setup appropriate scan algorithm.
+
+                Returns \p true if the retired pointers left after the scan have been spilled to the orphan list
+                (see \ref hzp_gc_setSpillThreshold "setSpillThreshold").
             */
-            void Scan( details::hp_record * pRec )
+            bool Scan( details::hp_record * pRec )
             {
+                telemetry::gc_collector::stopwatch sw;
+                size_t const nRetired = pRec->m_arrRetired.size();
+
                 switch ( m_nScanType ) {
                     case inplace:
                         inplace_scan( pRec );
                         break;
+                    case hashed:
+                        hashed_scan( pRec );
+                        break;
                     default:
                         assert(false)   ;   // Forgotten something?..
                     case classic:
                         classic_scan( pRec );
                         break;
                 }
+
+                m_Telemetry.on_scan( sw.elapsed(), nRetired - pRec->m_arrRetired.size());
+
+                size_t const nSpillThreshold = m_nSpillThreshold.load( atomics::memory_order_relaxed );
+                if ( nSpillThreshold && pRec->m_arrRetired.size() > nSpillThreshold )
+                    return spill( pRec );
+                return false;
             }
 
             /// Helper scan routine
@@ -499,8 +784,34 @@ namespace cds {
                 to thread's list of reclaimed pointers.
 
                 The function is called internally by Scan.
+
+                In the overflow mode the retired pointers of dead threads are spilled to the orphan list;
+                the function returns \p true if something has been spilled.
             */
-            void HelpScan( details::hp_record * pThis );
+            bool HelpScan( details::hp_record * pThis );
+
+            /// Reclaims retired pointers from the orphan list
+            /** @anchor hzp_gc_reclaim_orphans
+                The function takes the whole orphan list, makes the snapshot of hazard pointers
+                and frees unguarded pointers of the batches until \p getMaxRetiredPtrCount() retired pointers are checked.
+                Unchecked batches and the batches containing guarded pointers are returned to the orphan list.
+                Thus, the latency of the function is bounded like the latency of \p Scan().
+
+                The function is called internally by \p ThreadGC::scan() if the scan has spilled nothing.
+                It does nothing if the orphan list is empty.
+                The emptied batch is kept as the spare batch of \p pRec if \p pRec has no one.
+            */
+            void reclaim_orphans( details::hp_record * pRec );
+
+            /// Checks if the orphan list is not empty
+            /**
+                The check is a single relaxed load; \p ThreadGC::scan() calls it
+                to avoid the out-of-line \p reclaim_orphans() call when there are no orphans.
+            */
+            bool has_orphans() const CDS_NOEXCEPT
+            {
+                return m_pOrphanList.load( atomics::memory_order_relaxed ) != nullptr;
+            }
 
         protected:
             /// Classic scan algorithm
@@ -522,7 +833,7 @@ namespace cds {
                 The forth stage prepares new thread's private list of reclaimed pointers
                 that could not be freed during the current scan, where they remain until the next scan.
 
-                This algorithm allocates memory for internal HP array.
+                The local list is the thread's snapshot buffer \p hp_record::m_Snapshot, it is allocated once.
 
                 This function is called internally by ThreadGC object when upper bound of thread's list of reclaimed pointers
                 is reached.
@@ -535,6 +846,23 @@ namespace cds {
                 All operations are performed in-place.
             */
             void inplace_scan( details::hp_record * pRec );
+
+            /// Hash set based scan algorithm
+            /** @anchor hzp_gc_hashed_scan
+                The algorithm copies non-null hazard pointers to the snapshot like \ref hzp_gc_classic_scan "classic_scan"
+                but instead of sorting it builds an open-addressing hash set over the snapshot.
+                Then each retired pointer is checked in O(1) expected time. The algorithm is preferable when
+                the product of thread count and hazard pointer count is large.
+            */
+            void hashed_scan( details::hp_record * pRec );
+
+        private:
+            //@cond
+            void make_snapshot( details::hp_record * pRec );
+            void prealloc_batch( details::hp_record * pRec );
+            bool spill( details::hp_record * pRec );
+            void push_orphans( details::retired_batch * pFirst, details::retired_batch * pLast, size_t nCount );
+            //@endcond
         };
 
         /// Thread's hazard pointer manager
@@ -650,8 +978,19 @@ namespace cds {
             /// Run retiring scan cycle
             void scan()
             {
-                m_HzpManager.Scan( m_pHzpRec );
-                m_HzpManager.HelpScan( m_pHzpRec );
+                bool bSpilled = m_HzpManager.Scan( m_pHzpRec );
+                if ( m_HzpManager.HelpScan( m_pHzpRec ))
+                    bSpilled = true;
+
+                // The orphan list is not drained in the scan that has spilled
+                if ( !bSpilled && m_HzpManager.has_orphans() )
+                    m_HzpManager.reclaim_orphans( m_pHzpRec );
+            }
+
+            /// Reclaims retired pointers from the global orphan list (see \ref hzp_gc_reclaim_orphans "reclaim_orphans")
+            void reclaim_orphans()
+            {
+                m_HzpManager.reclaim_orphans( m_pHzpRec );
             }
 
             void sync()
@@ -746,6 +1085,8 @@ namespace cds {
         inline hp_record::hp_record( const cds::gc::hp::GarbageCollector& HzpMgr )
             : m_hzp( HzpMgr.getHazardPointerCount() )
             , m_arrRetired( HzpMgr )
+            , m_Snapshot( HzpMgr.getHazardPointerCount() * HzpMgr.getMaxThreadCount() )
+            , m_pSpareBatch( nullptr )
             , m_nSync( 0 )
         {}
 
@@ -0,0 +1,270 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#ifndef CDSLIB_GC_DETAILS_THREAD_RECORD_H
+#define CDSLIB_GC_DETAILS_THREAD_RECORD_H
+
+#include <cds/algo/atomic.h>
+#include <cds/os/thread.h>
+
+//@cond
+namespace cds { namespace gc { namespace details {
+
+    /// Node of the list of thread records
+    /**
+        \p Record is the GC-specific data of a thread, for example, \p cds::gc::he::details::he_record.
+        The node links the record into the list of the GC and keeps the owner of the record.
+        \p Record should have a constructor with GC argument.
+    */
+    template <class Record>
+    struct thread_record_node: public Record
+    {
+        thread_record_node *             m_pNextNode; ///< next record in list
+        atomics::atomic<OS::ThreadId>    m_idOwner;   ///< Owner thread id; 0 - the record is free (not owned)
+        atomics::atomic<bool>            m_bFree;     ///< true if record is free (not owned) and has no retired pointers
+
+        template <class GC>
+        explicit thread_record_node( GC& gc )
+            : Record( gc )
+            , m_pNextNode( nullptr )
+            , m_idOwner( OS::c_NullThreadId )
+            , m_bFree( true )
+        {}
+
+        ~thread_record_node()
+        {
+            assert( m_idOwner.load( atomics::memory_order_relaxed ) == OS::c_NullThreadId );
+            assert( m_bFree.load( atomics::memory_order_relaxed ));
+        }
+    };
+
+    /// Lock-free list of thread records
+    /**
+        The list is the common base of the garbage collectors keeping a record per thread
+        (\p cds::gc::he::GarbageCollector, \p cds::gc::ebr::GarbageCollector).
+        The records are never removed from the list while the GC is alive:
+        the record of a detached thread is reused by the next attached thread
+        or adopted by \p HelpScan() of other thread if its owner is terminated.
+    */
+    template <class Record>
+    class thread_record_list
+    {
+    public:
+        typedef thread_record_node<Record> node_type;   ///< Node type
+
+    protected:
+        atomics::atomic<node_type *> m_pListHead;   ///< Head of the list of thread records
+
+    protected:
+        thread_record_list()
+            : m_pListHead( nullptr )
+        {}
+
+        /// Tries to own a record that is not owned by any thread, returns \p nullptr if all records are owned
+        node_type * reuse_record()
+        {
+            const OS::ThreadId nullThreadId = OS::c_NullThreadId;
+            const OS::ThreadId curThreadId  = OS::get_current_thread_id();
+
+            for ( node_type * pNode = m_pListHead.load( atomics::memory_order_acquire ); pNode; pNode = pNode->m_pNextNode ) {
+                OS::ThreadId thId = nullThreadId;
+                if ( !pNode->m_idOwner.compare_exchange_strong( thId, curThreadId, atomics::memory_order_seq_cst, atomics::memory_order_relaxed ))
+                    continue;
+                pNode->m_bFree.store( false, atomics::memory_order_release );
+                return pNode;
+            }
+            return nullptr;
+        }
+
+        /// Owns new record \p pNode by current thread and pushes it to the list
+        void push_record( node_type * pNode )
+        {
+            pNode->m_idOwner.store( OS::get_current_thread_id(), atomics::memory_order_release );
+            pNode->m_bFree.store( false, atomics::memory_order_release );
+
+            node_type * pOldHead = m_pListHead.load( atomics::memory_order_acquire );
+            do {
+                pNode->m_pNextNode = pOldHead;
+            } while ( !m_pListHead.compare_exchange_weak( pOldHead, pNode, atomics::memory_order_release, atomics::memory_order_relaxed ));
+        }
+
+        /// Tries to own the record \p pNode that is free or whose owner is terminated
+        /**
+            On success, \p prevOwner is the previous owner, \p OS::c_NullThreadId if the record was free.
+        */
+        static bool adopt_record( node_type * pNode, OS::ThreadId& prevOwner )
+        {
+            prevOwner = pNode->m_idOwner.load( atomics::memory_order_acquire );
+            if ( prevOwner != OS::c_NullThreadId && OS::is_thread_alive( prevOwner ))
+                return false;
+            return pNode->m_idOwner.compare_exchange_strong( prevOwner, OS::get_current_thread_id(), atomics::memory_order_acquire, atomics::memory_order_relaxed );
+        }
+
+        /// Releases the record \p pNode owned by current thread
+        /**
+            \p bEmpty should be \p true if the record has no retired pointers,
+            then \p HelpScan() of other threads skips it.
+        */
+        static void release_record( node_type * pNode, bool bEmpty )
+        {
+            if ( bEmpty )
+                pNode->m_bFree.store( true, atomics::memory_order_release );
+            pNode->m_idOwner.store( OS::c_NullThreadId, atomics::memory_order_release );
+        }
+
+        /// Calls \p f for each record owned by a thread
+        template <typename Func>
+        void for_each_owned( Func f )
+        {
+            node_type * pNext = nullptr;
+            for ( node_type * pNode = m_pListHead.load( atomics::memory_order_acquire ); pNode; pNode = pNext ) {
+                pNext = pNode->m_pNextNode;
+                if ( pNode->m_idOwner.load( atomics::memory_order_relaxed ) != OS::c_NullThreadId )
+                    f( pNode );
+            }
+        }
+
+        /// Unlinks all records, marks them free and calls \p fnDelete for each. Used in GC destructor
+        template <typename Func>
+        void clear_records( Func fnDelete )
+        {
+            CDS_DEBUG_ONLY( const OS::ThreadId nullThreadId = OS::c_NullThreadId; )
+            CDS_DEBUG_ONLY( const OS::ThreadId mainThreadId = OS::get_current_thread_id(); )
+
+            node_type * pHead = m_pListHead.load( atomics::memory_order_relaxed );
+            m_pListHead.store( nullptr, atomics::memory_order_relaxed );
+
+            node_type * pNext = nullptr;
+            for ( node_type * pNode = pHead; pNode; pNode = pNext ) {
+                assert( pNode->m_idOwner.load( atomics::memory_order_relaxed ) == nullThreadId
+                    || pNode->m_idOwner.load( atomics::memory_order_relaxed ) == mainThreadId
+                    || !OS::is_thread_alive( pNode->m_idOwner.load( atomics::memory_order_relaxed ))
+                );
+                pNext = pNode->m_pNextNode;
+                pNode->m_idOwner.store( OS::c_NullThreadId, atomics::memory_order_relaxed );
+                pNode->m_bFree.store( true, atomics::memory_order_relaxed );
+                fnDelete( pNode );
+            }
+        }
+    };
+
+    /// Thread GC base for the garbage collectors keeping a record per thread
+    /**
+        The class keeps the record of the thread and forwards guard management to it.
+        Template arguments:
+        - \p GC - the garbage collector singleton, it should provide \p instance(), \p alloc_record(), \p free_record(),
+            \p Scan() and \p HelpScan()
+        - \p Record - the thread record of \p GC, it should have \p m_Guards field
+        - \p Guard - the guard type
+    */
+    template <class GC, class Record, class Guard>
+    class thread_gc_base
+    {
+    protected:
+        GC&      m_gc;      ///< GC singleton
+        Record * m_pRec;    ///< Pointer to thread's record
+
+    public:
+        /// Default constructor
+        thread_gc_base()
+            : m_gc( GC::instance() )
+            , m_pRec( nullptr )
+        {}
+
+        /// The object is not copy-constructible
+        thread_gc_base( thread_gc_base const& ) = delete;
+
+        ~thread_gc_base()
+        {
+            fini();
+        }
+
+        /// Checks if thread GC is initialized
+        bool    isInitialized() const   { return m_pRec != nullptr; }
+
+        /// Initialization. Repeat call is available
+        void init()
+        {
+            if ( !m_pRec )
+                m_pRec = m_gc.alloc_record();
+        }
+
+        /// Finalization. Repeat call is available
+        void fini()
+        {
+            if ( m_pRec ) {
+                Record * pRec = m_pRec;
+                m_pRec = nullptr;
+                m_gc.free_record( pRec );
+            }
+        }
+
+        /// Allocates a guard
+        Guard& allocGuard()
+        {
+            assert( m_pRec );
+            return m_pRec->m_Guards.alloc();
+        }
+
+        /// Frees the guard \p g
+        void freeGuard( Guard& g )
+        {
+            assert( m_pRec );
+            m_pRec->m_Guards.free( g );
+        }
+
+        /// Initializes guard array \p arr
+        template <class GuardArray>
+        void allocGuard( GuardArray& arr )
+        {
+            assert( m_pRec );
+            m_pRec->m_Guards.alloc( arr );
+        }
+
+        /// Frees guard array \p arr
+        template <class GuardArray>
+        void freeGuard( GuardArray& arr )
+        {
+            assert( m_pRec );
+            m_pRec->m_Guards.free( arr );
+        }
+
+        /// Run retiring scan cycle
+        void scan()
+        {
+            m_gc.Scan( m_pRec );
+            m_gc.HelpScan( m_pRec );
+        }
+    };
+
+}}} // namespace cds::gc::details
+//@endcond
+
+#endif // #ifndef CDSLIB_GC_DETAILS_THREAD_RECORD_H
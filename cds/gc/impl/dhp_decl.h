@@ -615,14 +615,22 @@ namespace cds { namespace gc {
                 ABA problem for internal data. \p nEpochCount specifies the epoch count,
                 i.e. the count of simultaneously working threads that remove the elements
                 of DHP-based concurrent data structure. Default value is 16.
+            - \p bBackgroundReclaim - if \p true, \p scan() is called by the dedicated reclaimer thread
+                instead of the thread that retires a pointer, like \p cds::urcu::general_threaded does. Default is \p false.
+            - \p nBackpressureThreshold - if the reclaimer thread lags and the count of retired pointers
+                reaches this value, the retiring thread calls \p scan() by itself.
+                Default value 0 means <tt>4 * nLiberateThreshold</tt>. The backpressure threshold grows
+                with the liberate threshold that is doubled by \p scan() when it cannot free anything.
         */
         DHP(
             size_t nLiberateThreshold = 1024
             , size_t nInitialThreadGuardCount = 8
             , size_t nEpochCount = 16
+            , bool bBackgroundReclaim = false
+            , size_t nBackpressureThreshold = 0
         )
         {
-            dhp::GarbageCollector::Construct( nLiberateThreshold, nInitialThreadGuardCount, nEpochCount );
+            dhp::GarbageCollector::Construct( nLiberateThreshold, nInitialThreadGuardCount, nEpochCount, bBackgroundReclaim, nBackpressureThreshold );
         }
 
         /// Destroys %DHP memory manager
@@ -657,12 +665,12 @@ namespace cds { namespace gc {
             The function places pointer \p p to array of pointers ready for removing.
             (so called retired pointer array). The pointer can be safely removed when no guarded pointer points to it.
             Deleting the pointer is the function \p pFunc call.
+
+            If the current thread is attached to %DHP GC, the retired pointer node is allocated
+            from the thread's magazine, otherwise from the global pool.
         */
         template <typename T>
-        static void retire( T * p, void (* pFunc)(T *) )
-        {
-            dhp::GarbageCollector::instance().retirePtr( p, pFunc );
-        }
+        static void retire( T * p, void (* pFunc)(T *) );   // inline in dhp_impl.h
 
         /// Retire pointer \p p with functor of type \p Disposer
         /**
@@ -677,6 +685,17 @@ namespace cds { namespace gc {
             retire( p, cds::details::static_functor<Disposer, T>::call );
         }
 
+        /// Returns reclamation telemetry
+        /**
+            The function is cheap enough to be polled by a monitoring thread,
+            see \ref cds_gc_telemetry "cds::gc::telemetry" for details.
+            The calling thread may not be attached to %DHP GC.
+        */
+        static telemetry::snapshot& get_telemetry( telemetry::snapshot& s )
+        {
+            return dhp::GarbageCollector::instance().get_telemetry( s );
+        }
+
         /// Checks if Dynamic Hazard Pointer GC is constructed and may be used
         static bool isUsed()
         {
@@ -689,6 +708,12 @@ namespace cds { namespace gc {
         */
         static void scan()  ;   // inline in dhp_impl.h
 
+        /// Checks if the background reclaimer thread is enabled
+        static bool isBackgroundReclaim()
+        {
+            return dhp::GarbageCollector::instance().isBackgroundReclaim();
+        }
+
         /// Synonym for \ref scan()
         static void force_dispose()
         {
@@ -86,6 +86,17 @@ namespace cds { namespace gc {
         cds::threading::getGC<DHP>().freeGuard(g);
     }
 
+    template <typename T>
+    inline void DHP::retire( T * p, void (* pFunc)(T *) )
+    {
+        // One TLS read: the attached thread retires into its magazine
+        cds::threading::ThreadData * pData = cds::threading::Manager::attached_thread_data();
+        if ( pData && pData->m_dhpManager )
+            pData->m_dhpManager->retirePtr( p, pFunc );
+        else
+            dhp::GarbageCollector::instance().retirePtr( p, pFunc );
+    }
+
     inline void DHP::scan()
     {
         cds::threading::getGC<DHP>().scan();
@@ -0,0 +1,790 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#ifndef CDSLIB_GC_IMPL_HE_DECL_H
+#define CDSLIB_GC_IMPL_HE_DECL_H
+
+#include <stdexcept>    // overflow_error
+#include <cds/gc/details/he.h>
+#include <cds/details/marked_ptr.h>
+
+namespace cds { namespace gc {
+    /// @defgroup cds_garbage_collector Garbage collectors
+
+    /// Hazard Era garbage collector
+    /**  @ingroup cds_garbage_collector
+        @headerfile cds/gc/he.h
+
+        Implementation of Hazard Eras garbage collector, the interval-based variant of Hazard Pointers.
+
+        Sources:
+            - [2017] Pedro Ramalhete, Andreia Correia "Brief Announcement: Hazard Eras - Non-Blocking Memory Reclamation"
+            - [2018] Haosen Wen et al. "Interval-Based Memory Reclamation"
+
+        The GC maintains a global era clock. Instead of the pointer, a guard publishes the era observed
+        when the pointer has been read. A retired object is stamped with the era of retirement and it is freed
+        when every published era is greater than that stamp. The guard is re-published with a full memory fence
+        only if the global era has changed, so the traversal of a data structure costs a plain load per node
+        in the common case, unlike \p cds::gc::HP where each step needs a store-load fence.
+
+        The object allocation is performed by the containers, so the birth era of an object is unknown to the GC:
+        the lifetime interval of any object is <tt>[0, retire era]</tt>. Therefore a thread stalled
+        inside a guarded region holds back all objects retired since the era it has published,
+        and the arrays of retired objects grow dynamically. A thread which has no active guards never prevents reclamation.
+
+        \p %cds::gc::HE has the same interface as \p cds::gc::HP, so any HP-based container may be instantiated with \p %HE.
+        Hazard Era garbage collector is a singleton. The main user-level part of Hazard Era schema is
+        GC class \p %cds::gc::HE and its nested classes. Before use any HE-related class you must initialize HE garbage collector
+        by contructing \p %cds::gc::HE object in beginning of your \p main().
+        See \ref cds_how_to_use "How to use" section for details how to apply garbage collector.
+    */
+    class HE
+    {
+    public:
+        /// Native guarded pointer type
+        /**
+            @headerfile cds/gc/he.h
+        */
+        typedef void * guarded_pointer;
+
+        /// Atomic reference
+        /**
+            @headerfile cds/gc/he.h
+        */
+        template <typename T> using atomic_ref = atomics::atomic<T *>;
+
+        /// Atomic marked pointer
+        /**
+            @headerfile cds/gc/he.h
+        */
+        template <typename MarkedPtr> using atomic_marked_ptr = atomics::atomic<MarkedPtr>;
+
+        /// Atomic type
+        /**
+            @headerfile cds/gc/he.h
+        */
+        template <typename T> using atomic_type = atomics::atomic<T>;
+
+        /// Thread GC implementation for internal usage
+        /**
+            @headerfile cds/gc/he.h
+        */
+        typedef he::ThreadGC   thread_gc_impl;
+
+        /// Wrapper for he::ThreadGC class
+        /**
+            @headerfile cds/gc/he.h
+            This class performs automatically attaching/detaching Hazard Era GC
+            for the current thread.
+        */
+        class thread_gc: public thread_gc_impl
+        {
+            //@cond
+            bool    m_bPersistent;
+            //@endcond
+        public:
+
+            /// Constructor
+            /**
+                The constructor attaches the current thread to the Hazard Era GC
+                if it is not yet attached.
+                The \p bPersistent parameter specifies attachment persistence:
+                - \p true - the class destructor will not detach the thread from Hazard Era GC.
+                - \p false (default) - the class destructor will detach the thread from Hazard Era GC.
+            */
+            thread_gc(
+                bool    bPersistent = false
+            ) ;     //inline in he_impl.h
+
+            /// Destructor
+            /**
+                If the object has been created in persistent mode, the destructor does nothing.
+                Otherwise it detaches the current thread from Hazard Era GC.
+            */
+            ~thread_gc() ;  // inline in he_impl.h
+
+        public: // for internal use only!!!
+            //@cond
+            static cds::gc::he::details::era_guard& alloc_guard(); // inline in he_impl.h
+            static void free_guard( cds::gc::he::details::era_guard& g ); // inline in he_impl.h
+            //@endcond
+        };
+
+        /// Hazard Era guard
+        /**
+            @headerfile cds/gc/he.h
+
+            A guard is the hazard era slot.
+            Additionally, the \p %Guard class manages allocation and deallocation of the slot
+
+            A \p %Guard object is not copy- and move-constructible
+            and not copy- and move-assignable.
+        */
+        class Guard : public he::guard
+        {
+            //@cond
+            typedef he::guard base_class;
+            //@endcond
+
+        public:
+            /// Default ctor
+            Guard()
+            {}
+
+            //@cond
+            Guard( Guard const& ) = delete;
+            Guard( Guard&& s ) = delete;
+            Guard& operator=(Guard const&) = delete;
+            Guard& operator=(Guard&&) = delete;
+            //@endcond
+
+            /// Protects a pointer of type \p atomic<T*>
+            /**
+                Return the value of \p toGuard
+
+                The function loads \p toGuard and publishes the current era
+                repeatedly until the value of \p toGuard is not changed. The era
+                is re-published only if the global era clock has been incremented.
+            */
+            template <typename T>
+            T protect( atomics::atomic<T> const& toGuard )
+            {
+                T pCur = toGuard.load(atomics::memory_order_acquire);
+                T pRet;
+                do {
+                    pRet = pCur;
+                    m_guard.set_current( pCur );
+                    pCur = toGuard.load(atomics::memory_order_acquire);
+                } while ( pRet != pCur );
+                return pCur;
+            }
+
+            /// Protects a converted pointer of type \p atomic<T*>
+            /**
+                Return the value of \p toGuard
+
+                The function loads \p toGuard, stores result of \p f functor
+                to the guard and publishes the current era repeatedly until the value of \p toGuard is not changed.
+
+                The function is useful for intrusive containers when \p toGuard is a node pointer
+                that should be converted to a pointer to the value before protecting.
+                The parameter \p f of type Func is a functor that makes this conversion:
+                \code
+                    struct functor {
+                        value_type * operator()( T * p );
+                    };
+                \endcode
+                Really, the result of <tt> f( toGuard.load() ) </tt> is stored to the guard.
+            */
+            template <typename T, class Func>
+            T protect( atomics::atomic<T> const& toGuard, Func f )
+            {
+                T pCur = toGuard.load(atomics::memory_order_acquire);
+                T pRet;
+                do {
+                    pRet = pCur;
+                    m_guard.set_current( f( pCur ) );
+                    pCur = toGuard.load(atomics::memory_order_acquire);
+                } while ( pRet != pCur );
+                return pCur;
+            }
+
+            /// Store \p p to the guard
+            /**
+                The function equals to a simple assignment the value \p p to guard, no loop is performed.
+                Can be used for a pointer that cannot be changed concurrently
+                or for a pointer already protected by another guard of current thread:
+                the guard publishes the oldest era of the thread.
+            */
+            template <typename T>
+            T * assign( T * p );    // inline in he_impl.h
+
+            //@cond
+            std::nullptr_t assign( std::nullptr_t )
+            {
+                m_guard.clear();
+                return nullptr;
+            }
+            //@endcond
+
+            /// Copy from \p src guard to \p this guard
+            void copy( Guard const& src )
+            {
+                m_guard.copy( src.m_guard );
+            }
+
+            /// Store marked pointer \p p to the guard
+            /**
+                The function equals to a simple assignment of <tt>p.ptr()</tt>, no loop is performed.
+                Can be used for a marked pointer that cannot be changed concurrently.
+            */
+            template <typename T, int BITMASK>
+            T * assign( cds::details::marked_ptr<T, BITMASK> p )
+            {
+                return assign( p.ptr() );
+            }
+
+            /// Clear value of the guard
+            void clear()
+            {
+                m_guard.clear();
+            }
+
+            /// Get the value currently protected
+            template <typename T>
+            T * get() const
+            {
+                return reinterpret_cast<T *>( get_native() );
+            }
+
+            /// Get native guarded pointer stored
+            guarded_pointer get_native() const
+            {
+                return base_class::get();
+            }
+        };
+
+        /// Array of Hazard Era guards
+        /**
+            @headerfile cds/gc/he.h
+            The class is intended for allocating an array of hazard era guards.
+            Template parameter \p Count defines the size of the array.
+
+            A \p %GuardArray object is not copy- and move-constructible
+            and not copy- and move-assignable.
+        */
+        template <size_t Count>
+        class GuardArray : public he::array<Count>
+        {
+            //@cond
+            typedef he::array<Count> base_class;
+            //@endcond
+        public:
+            /// Rebind array for other size \p Count2
+            template <size_t Count2>
+            struct rebind {
+                typedef GuardArray<Count2>  other   ;   ///< rebinding result
+            };
+
+        public:
+            /// Default ctor
+            GuardArray()
+            {}
+
+            //@cond
+            GuardArray( GuardArray const& ) = delete;
+            GuardArray( GuardArray&& ) = delete;
+            GuardArray& operator=(GuardArray const&) = delete;
+            GuardArray& operator=(GuardArray&&) = delete;
+            //@endcond
+
+            /// Protects a pointer of type \p atomic<T*>
+            /**
+                Return the value of \p toGuard
+
+                The function loads \p toGuard and publishes the current era in the slot \p nIndex
+                repeatedly until the value of \p toGuard is not changed
+            */
+            template <typename T>
+            T protect( size_t nIndex, atomics::atomic<T> const& toGuard )
+            {
+                T pRet;
+                do {
+                    base_class::operator[]( nIndex ).set_current( pRet = toGuard.load(atomics::memory_order_acquire) );
+                } while ( pRet != toGuard.load(atomics::memory_order_acquire));
+
+                return pRet;
+            }
+
+            /// Protects a pointer of type \p atomic<T*>
+            /**
+                Return the value of \p toGuard
+
+                The function loads \p toGuard and publishes the current era in the slot \p nIndex
+                repeatedly until the value of \p toGuard is not changed
+
+                The function is useful for intrusive containers when \p toGuard is a node pointer
+                that should be converted to a pointer to the value type before guarding.
+                The parameter \p f of type Func is a functor that makes this conversion:
+                \code
+                    struct functor {
+                        value_type * operator()( T * p );
+                    };
+                \endcode
+                Really, the result of <tt> f( toGuard.load() ) </tt> is stored to the slot.
+            */
+            template <typename T, class Func>
+            T protect( size_t nIndex, atomics::atomic<T> const& toGuard, Func f )
+            {
+                T pRet;
+                do {
+                    base_class::operator[]( nIndex ).set_current( f( pRet = toGuard.load(atomics::memory_order_acquire) ));
+                } while ( pRet != toGuard.load(atomics::memory_order_acquire));
+
+                return pRet;
+            }
+
+            /// Store \p to the slot \p nIndex
+            /**
+                The function equals to a simple assignment, no loop is performed.
+            */
+            template <typename T>
+            T * assign( size_t nIndex, T * p ); // inline in he_impl.h
+
+            /// Store marked pointer \p p to the guard
+            /**
+                The function equals to a simple assignment of <tt>p.ptr()</tt>, no loop is performed.
+                Can be used for a marked pointer that cannot be changed concurrently.
+            */
+            template <typename T, int BITMASK>
+            T * assign( size_t nIndex, cds::details::marked_ptr<T, BITMASK> p )
+            {
+                return assign( nIndex, p.ptr() );
+            }
+
+            /// Copy guarded value from \p src guard to slot at index \p nIndex
+            void copy( size_t nIndex, Guard const& src )
+            {
+                base_class::operator[]( nIndex ).copy( src.native_guard() );
+            }
+
+            /// Copy guarded value from slot \p nSrcIndex to slot at index \p nDestIndex
+            void copy( size_t nDestIndex, size_t nSrcIndex )
+            {
+                base_class::operator[]( nDestIndex ).copy( base_class::operator[]( nSrcIndex ));
+            }
+
+            /// Clear value of the slot \p nIndex
+            void clear( size_t nIndex )
+            {
+                base_class::clear( nIndex );
+            }
+
+            /// Get current value of slot \p nIndex
+            template <typename T>
+            T * get( size_t nIndex ) const
+            {
+                return reinterpret_cast<T *>( get_native( nIndex ) );
+            }
+
+            /// Get native guarded pointer stored
+            guarded_pointer get_native( size_t nIndex ) const
+            {
+                return base_class::operator[](nIndex).get();
+            }
+
+            /// Capacity of the guard array
+            static CDS_CONSTEXPR size_t capacity()
+            {
+                return Count;
+            }
+        };
+
+        /// Guarded pointer
+        /**
+            A guarded pointer is a pair of a pointer and GC's guard.
+            Usually, it is used for returning a pointer to the item from an lock-free container.
+            The guard prevents the pointer to be early disposed (freed) by GC.
+            After destructing \p %guarded_ptr object the pointer can be disposed (freed) automatically at any time.
+
+            Template arguments:
+            - \p GuardedType - a type which the guard stores
+            - \p ValueType - a value type
+            - \p Cast - a functor for converting <tt>GuardedType*</tt> to <tt>ValueType*</tt>. Default is \p void (no casting).
+
+            For intrusive containers, \p GuardedType is the same as \p ValueType and no casting is needed.
+            In such case the \p %guarded_ptr is:
+            @code
+            typedef cds::gc::HE::guarded_ptr< foo > intrusive_guarded_ptr;
+            @endcode
+
+            For standard (non-intrusive) containers \p GuardedType is not the same as \p ValueType and casting is needed.
+            For example:
+            @code
+            struct foo {
+                int const   key;
+                std::string value;
+            };
+
+            struct value_accessor {
+                std::string* operator()( foo* pFoo ) const
+                {
+                    return &(pFoo->value);
+                }
+            };
+
+            // Guarded ptr
+            typedef cds::gc::HE::guarded_ptr< Foo, std::string, value_accessor > nonintrusive_guarded_ptr;
+            @endcode
+
+            You don't need use this class directly.
+            All set/map container classes from \p libcds declare the typedef for \p %guarded_ptr with appropriate casting functor.
+        */
+        template <typename GuardedType, typename ValueType=GuardedType, typename Cast=void >
+        class guarded_ptr
+        {
+            //@cond
+            struct trivial_cast {
+                ValueType * operator()( GuardedType * p ) const
+                {
+                    return p;
+                }
+            };
+            //@endcond
+
+        public:
+            typedef GuardedType guarded_type; ///< Guarded type
+            typedef ValueType   value_type;   ///< Value type
+
+            /// Functor for casting \p guarded_type to \p value_type
+            typedef typename std::conditional< std::is_same<Cast, void>::value, trivial_cast, Cast >::type value_cast;
+
+            //@cond
+            typedef cds::gc::he::details::era_guard native_guard;
+            //@endcond
+
+        private:
+            //@cond
+            native_guard *  m_pGuard;
+            //@endcond
+
+        public:
+            /// Creates empty guarded pointer
+            guarded_ptr() CDS_NOEXCEPT
+                : m_pGuard(nullptr)
+            {
+                alloc_guard();
+            }
+
+            //@cond
+            /// Initializes guarded pointer with \p p
+            explicit guarded_ptr( guarded_type * p ) CDS_NOEXCEPT
+                : m_pGuard( nullptr )
+            {
+                reset(p);
+            }
+            explicit guarded_ptr( std::nullptr_t ) CDS_NOEXCEPT
+                : m_pGuard( nullptr )
+            {}
+            //@endcond
+
+            /// Move ctor
+            guarded_ptr( guarded_ptr&& gp ) CDS_NOEXCEPT
+                : m_pGuard( gp.m_pGuard )
+            {
+                gp.m_pGuard = nullptr;
+            }
+
+            /// The guarded pointer is not copy-constructible
+            guarded_ptr( guarded_ptr const& gp ) = delete;
+
+            /// Clears the guarded pointer
+            /**
+                \ref release is called if guarded pointer is not \ref empty
+            */
+            ~guarded_ptr() CDS_NOEXCEPT
+            {
+                free_guard();
+            }
+
+            /// Move-assignment operator
+            guarded_ptr& operator=( guarded_ptr&& gp ) CDS_NOEXCEPT
+            {
+                // Guard array is organized as a stack
+                if ( m_pGuard && m_pGuard > gp.m_pGuard ) {
+                    m_pGuard->copy( *gp.m_pGuard );
+                    gp.free_guard();
+                }
+                else {
+                    free_guard();
+                    m_pGuard = gp.m_pGuard;
+                    gp.m_pGuard = nullptr;
+                }
+                return *this;
+            }
+
+            /// The guarded pointer is not copy-assignable
+            guarded_ptr& operator=(guarded_ptr const& gp) = delete;
+
+            /// Returns a pointer to guarded value
+            value_type * operator ->() const CDS_NOEXCEPT
+            {
+                assert( !empty() );
+                return value_cast()( reinterpret_cast<guarded_type *>(m_pGuard->get()));
+            }
+
+            /// Returns a reference to guarded value
+            value_type& operator *() CDS_NOEXCEPT
+            {
+                assert( !empty());
+                return *value_cast()(reinterpret_cast<guarded_type *>(m_pGuard->get()));
+            }
+
+            /// Returns const reference to guarded value
+            value_type const& operator *() const CDS_NOEXCEPT
+            {
+                assert( !empty() );
+                return *value_cast()(reinterpret_cast<guarded_type *>(m_pGuard->get()));
+            }
+
+            /// Checks if the guarded pointer is \p nullptr
+            bool empty() const CDS_NOEXCEPT
+            {
+                return !m_pGuard || m_pGuard->get( atomics::memory_order_relaxed ) == nullptr;
+            }
+
+            /// \p bool operator returns <tt>!empty()</tt>
+            explicit operator bool() const CDS_NOEXCEPT
+            {
+                return !empty();
+            }
+
+            /// Clears guarded pointer
+            /**
+                If the guarded pointer has been released, the pointer can be disposed (freed) at any time.
+                Dereferncing the guarded pointer after \p release() is dangerous.
+            */
+            void release() CDS_NOEXCEPT
+            {
+                free_guard();
+            }
+
+            //@cond
+            // For internal use only!!!
+            native_guard& guard() CDS_NOEXCEPT
+            {
+                alloc_guard();
+                assert( m_pGuard );
+                return *m_pGuard;
+            }
+
+            void reset(guarded_type * p) CDS_NOEXCEPT
+            {
+                alloc_guard();
+                assert( m_pGuard );
+                m_pGuard->set(p);
+            }
+            //@endcond
+
+        private:
+            //@cond
+            void alloc_guard()
+            {
+                if ( !m_pGuard )
+                    m_pGuard = &thread_gc::alloc_guard();
+            }
+
+            void free_guard()
+            {
+                if ( m_pGuard ) {
+                    thread_gc::free_guard( *m_pGuard );
+                    m_pGuard = nullptr;
+                }
+            }
+            //@endcond
+        };
+
+    public:
+        /// Initializes %HE singleton
+        /**
+            The constructor initializes GC singleton with passed parameters.
+            If GC instance is not exist then the function creates the instance.
+            Otherwise it does nothing.
+
+            The %HE reclamation schema depends of four parameters:
+            - \p nHazardEraCount - guard count per thread. Usually it is small number (up to 10) depending from
+                the data structure algorithms. By default, if \p nHazardEraCount = 0, the function
+                uses maximum of the guard count for CDS library.
+            - \p nMaxThreadCount - max count of thread with using Hazard Era GC in your application. Default is 100.
+            - \p nInitRetiredPtrCount - initial capacity of array of retired pointers for each thread.
+                Default is <tt>2 * nHazardEraCount * nMaxThreadCount </tt>. The array grows when needed.
+            - \p nEraAdvanceFreq - the global era is incremented after the thread retires \p nEraAdvanceFreq objects.
+                Default is 64. The less value, the more often guards are re-published on traversal,
+                the greater value, the more objects are held back by a stalled thread.
+        */
+        HE(
+            size_t nHazardEraCount = 0,     ///< Hazard era guard count per thread
+            size_t nMaxThreadCount = 0,     ///< Max count of simultaneous working thread in your application
+            size_t nInitRetiredPtrCount = 0,///< Initial capacity of the array of retired objects for the thread
+            size_t nEraAdvanceFreq = 0      ///< Count of retired objects between era increments
+        )
+        {
+            he::GarbageCollector::Construct(
+                nHazardEraCount,
+                nMaxThreadCount,
+                nInitRetiredPtrCount,
+                nEraAdvanceFreq
+            );
+        }
+
+        /// Terminates GC singleton
+        /**
+            The destructor destroys %HE global object. After calling of this function you may \b NOT
+            use CDS data structures based on \p %cds::gc::HE.
+            Usually, %HE object is destroyed at the end of your \p main().
+        */
+        ~HE()
+        {
+            he::GarbageCollector::Destruct( true );
+        }
+
+        /// Checks if count of hazard era guards is no less than \p nCountNeeded
+        /**
+            If \p bRaiseException is \p true (that is the default), the function raises
+            an \p std::overflow_error exception "Too few hazard eras"
+            if \p nCountNeeded is more than the count of guards per thread.
+        */
+        static bool check_available_guards( size_t nCountNeeded, bool bRaiseException = true )
+        {
+            if ( he::GarbageCollector::instance().getHazardEraCount() < nCountNeeded ) {
+                if ( bRaiseException )
+                    throw std::overflow_error( "Too few hazard eras" );
+                return false;
+            }
+            return true;
+        }
+
+        /// Returns max count of hazard era guards per thread
+        static size_t max_hazard_count()
+        {
+            return he::GarbageCollector::instance().getHazardEraCount();
+        }
+
+        /// Returns max count of thread
+        static size_t max_thread_count()
+        {
+            return he::GarbageCollector::instance().getMaxThreadCount();
+        }
+
+        /// Returns initial capacity of retired pointer array
+        static size_t retired_array_capacity()
+        {
+            return he::GarbageCollector::instance().getInitRetiredPtrCount();
+        }
+
+        /// Returns current global era
+        static he::era_type current_era()
+        {
+            return he::GarbageCollector::instance().current_era();
+        }
+
+        /// Retire pointer \p p with function \p pFunc
+        /**
+            The function places pointer \p p to array of pointers ready for removing.
+            (so called retired pointer array). The pointer can be safely removed when no guard protects it.
+            Deleting the pointer is the function \p pFunc call.
+        */
+        template <typename T>
+        static void retire( T * p, void (* pFunc)(T *) );   // inline in he_impl.h
+
+        /// Retire pointer \p p with functor of type \p Disposer
+        /**
+            The function places pointer \p p to array of pointers ready for removing.
+            (so called retired pointer array). The pointer can be safely removed when no guard protects it.
+
+            Deleting the pointer is an invocation of some object of type \p Disposer; the interface of \p Disposer is:
+            \code
+            template <typename T>
+            struct disposer {
+                void operator()( T * p )    ;   // disposing operator
+            };
+            \endcode
+            Since the functor call can happen at any time after \p retire call, additional restrictions are imposed to \p Disposer type:
+            - it should be stateless functor
+            - it should be default-constructible
+            - the result of functor call with argument \p p should not depend on where the functor will be called.
+
+            \par Examples:
+            Operator \p delete functor:
+            \code
+            template <typename T>
+            struct disposer {
+                void operator ()( T * p ) {
+                    delete p;
+                }
+            };
+
+            // How to call GC::retire method
+            int * p = new int;
+
+            // ... use p in lock-free manner
+
+            cds::gc::HE::retire<disposer>( p ) ;   // place p to retired pointer array of HE GC
+            \endcode
+
+            Functor based on \p std::allocator :
+            \code
+            template <typename ALLOC = std::allocator<int> >
+            struct disposer {
+                template <typename T>
+                void operator()( T * p ) {
+                    typedef typename ALLOC::templare rebind<T>::other   alloc_t;
+                    alloc_t a;
+                    a.destroy( p );
+                    a.deallocate( p, 1 );
+                }
+            };
+            \endcode
+        */
+        template <class Disposer, typename T>
+        static void retire( T * p );   // inline in he_impl.h
+
+        /// Checks if Hazard Era GC is constructed and may be used
+        static bool isUsed()
+        {
+            return he::GarbageCollector::isUsed();
+        }
+
+        /// Returns reclamation telemetry
+        /**
+            The function is cheap enough to be polled by a monitoring thread,
+            see \ref cds_gc_telemetry "cds::gc::telemetry" for details.
+            The calling thread may not be attached to %HE GC.
+        */
+        static telemetry::snapshot& get_telemetry( telemetry::snapshot& s )
+        {
+            return he::GarbageCollector::instance().get_telemetry( s );
+        }
+
+        /// Forced GC cycle call for current thread
+        /**
+            Usually, this function should not be called directly.
+        */
+        static void scan()  ;   // inline in he_impl.h
+
+        /// Synonym for \ref scan()
+        static void force_dispose()
+        {
+            scan();
+        }
+    };
+}}  // namespace cds::gc
+
+#endif  // #ifndef CDSLIB_GC_IMPL_HE_DECL_H
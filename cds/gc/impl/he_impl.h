@@ -0,0 +1,123 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#ifndef CDSLIB_GC_IMPL_HE_IMPL_H
+#define CDSLIB_GC_IMPL_HE_IMPL_H
+
+#include <cds/threading/model.h>
+#include <cds/details/static_functor.h>
+
+//@cond
+namespace cds { namespace gc {
+
+    namespace he {
+        inline guard::guard()
+            : m_guard( cds::threading::getGC<HE>().allocGuard() )
+        {}
+
+        inline guard::~guard()
+        {
+            cds::threading::getGC<HE>().freeGuard( m_guard );
+        }
+
+        template <size_t Count>
+        inline array<Count>::array()
+        {
+            cds::threading::getGC<HE>().allocGuard( *this );
+        }
+
+        template <size_t Count>
+        inline array<Count>::~array()
+        {
+            cds::threading::getGC<HE>().freeGuard( *this );
+        }
+    } // namespace he
+
+    inline HE::thread_gc::thread_gc(
+        bool    bPersistent
+        )
+        : m_bPersistent( bPersistent )
+    {
+        if ( !threading::Manager::isThreadAttached() )
+            threading::Manager::attachThread();
+    }
+
+    inline HE::thread_gc::~thread_gc()
+    {
+        if ( !m_bPersistent )
+            cds::threading::Manager::detachThread();
+    }
+
+    inline /*static*/ cds::gc::he::details::era_guard& HE::thread_gc::alloc_guard()
+    {
+        return cds::threading::getGC<HE>().allocGuard();
+    }
+
+    inline /*static*/ void HE::thread_gc::free_guard( cds::gc::he::details::era_guard& g )
+    {
+        cds::threading::getGC<HE>().freeGuard( g );
+    }
+
+    template <typename T>
+    inline T * HE::Guard::assign( T * p )
+    {
+        m_guard.set( p );
+        return p;
+    }
+
+    template <size_t Count>
+    template <typename T>
+    inline T * HE::GuardArray<Count>::assign( size_t nIndex, T * p )
+    {
+        base_class::operator[]( nIndex ).set( p );
+        return p;
+    }
+
+    template <typename T>
+    inline void HE::retire( T * p, void (* pFunc)(T *) )
+    {
+        cds::threading::getGC<HE>().retirePtr( p, pFunc );
+    }
+
+    template <class Disposer, typename T>
+    inline void HE::retire( T * p )
+    {
+        cds::threading::getGC<HE>().retirePtr( p, cds::details::static_functor<Disposer, T>::call );
+    }
+
+    inline void HE::scan()
+    {
+        cds::threading::getGC<HE>().scan();
+    }
+
+}} // namespace cds::gc
+//@endcond
+
+#endif // #ifndef CDSLIB_GC_IMPL_HE_IMPL_H
@@ -598,8 +598,9 @@ namespace cds { namespace gc {
     public:
         /// \p scan() type
         enum class scan_type {
-            classic = hp::classic,    ///< classic scan as described in Michael's papers
-            inplace = hp::inplace     ///< inplace scan without allocation
+            classic = hp::classic,    ///< classic scan as described in Michael's papers: sorted snapshot of hazard pointers
+            inplace = hp::inplace,    ///< inplace scan: sorted array of retired pointers
+            hashed  = hp::hashed      ///< hash set of hazard pointers, recommended for large thread count
         };
         /// Initializes %HP singleton
         /**
@@ -750,6 +751,42 @@ namespace cds { namespace gc {
             hp::GarbageCollector::instance().setScanType( static_cast<hp::scan_type>(nScanType) );
         }
 
+        /// Get current spill threshold
+        static size_t getSpillThreshold()
+        {
+            return hp::GarbageCollector::instance().getSpillThreshold();
+        }
+
+        /// Set spill threshold
+        /**
+            If \p nThreshold > 0 the overflow mode of retired pointer arrays is enabled: when the thread's
+            array of retired pointers still contains more than \p nThreshold pointers after the scan,
+            the pointers are moved to the global lock-free orphan list instead of repeated scanning.
+            This bounds the latency of \p retire() under bursty deletes.
+            The orphan list is drained cooperatively by \p scan() of each thread that has spilled nothing in this scan,
+            or by \p reclaim_orphans().
+            See \ref hzp_gc_setSpillThreshold "hp::GarbageCollector::setSpillThreshold" for details.
+
+            By default, spilling is disabled (\p nThreshold = 0).
+        */
+        static void setSpillThreshold(
+            size_t nThreshold   ///< new spill threshold, 0 - disable spilling
+        )
+        {
+            hp::GarbageCollector::instance().setSpillThreshold( nThreshold );
+        }
+
+        /// Returns reclamation telemetry
+        /**
+            The function is cheap enough to be polled by a monitoring thread,
+            see \ref cds_gc_telemetry "cds::gc::telemetry" for details.
+            The calling thread may not be attached to %HP GC.
+        */
+        static telemetry::snapshot& get_telemetry( telemetry::snapshot& s )
+        {
+            return hp::GarbageCollector::instance().get_telemetry( s );
+        }
+
         /// Checks if Hazard Pointer GC is constructed and may be used
         static bool isUsed()
         {
@@ -767,6 +804,14 @@ namespace cds { namespace gc {
         {
             scan();
         }
+
+        /// Reclaims retired pointers spilled to the global orphan list
+        /**
+            The function may be called periodically by a dedicated thread attached to %HP GC
+            to drain the orphan list (see \p setSpillThreshold()). It is called automatically by \p scan()
+            if the scan has spilled nothing.
+        */
+        static void reclaim_orphans();   // inline in hp_impl.h
     };
 }}  // namespace cds::gc
 
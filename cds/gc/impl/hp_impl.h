@@ -129,6 +129,11 @@ namespace cds { namespace gc {
         cds::threading::getGC<HP>().scan();
     }
 
+    inline void HP::reclaim_orphans()
+    {
+        cds::threading::getGC<HP>().reclaim_orphans();
+    }
+
 }} // namespace cds::gc
 //@endcond
 
@@ -0,0 +1,319 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#ifndef CDSLIB_GC_TELEMETRY_H
+#define CDSLIB_GC_TELEMETRY_H
+
+#include <chrono>
+#include <vector>
+#include <cds/algo/atomic.h>
+#include <cds/os/thread.h>
+
+namespace cds { namespace gc {
+
+    /// Memory reclamation telemetry
+    /** @anchor cds_gc_telemetry
+        Each garbage collector (\p cds::gc::HP, \p cds::gc::DHP, \ref cds_urcu_gc "RCU" flavors)
+        (\p cds::gc::HE, \p cds::gc::EBR) collects the reclamation telemetry: retired-but-unfreed backlog,
+        reclamation pass (scan) duration, grace period latency and so on.
+        The telemetry is updated once per reclamation pass, not per retired pointer.
+
+        The telemetry collector of the garbage collectors is \p telemetry::gc_collector.
+        Like \p empty_stat of the containers, the collector can be replaced with \p telemetry::empty_collector
+        that does nothing and does not read the clock: define \p CDS_DISABLE_GC_TELEMETRY macro
+        both for libcds build and for your application. In this case \p get_telemetry() returns
+        zero counters and histograms; the retired backlog and per-thread state are still reported.
+
+        The telemetry is exported by \p get_telemetry() static function of the GC:
+        \code
+        // Monitoring thread
+        cds::gc::telemetry::snapshot st;
+        for ( ;; ) {
+            cds::gc::HP::get_telemetry( st );
+            if ( st.nRetiredBacklog > nAlarmThreshold )
+                report( st );
+            sleep( 1 );
+        }
+        \endcode
+        The snapshot object can be reused: after the first call \p get_telemetry() does not allocate memory
+        if the thread count is not increased.
+        The snapshot is not atomic: the counters are read one by one while the GC is running.
+    */
+    namespace telemetry {
+
+        /// Count of histogram buckets
+        static CDS_CONSTEXPR size_t const c_nHistogramSize = 40;
+
+        /// Latency histogram
+        /**
+            The bucket \p i contains the count of events with duration, in nanoseconds,
+            in range <tt>[2**i, 2**(i+1))</tt>. The bucket 0 contains also zero durations,
+            the last bucket contains all longer durations.
+        */
+        struct histogram {
+            size_t  m_arrBucket[c_nHistogramSize];   ///< Event count by bucket
+
+            //@cond
+            histogram()
+            {
+                clear();
+            }
+            //@endcond
+
+            /// Resets the histogram
+            void clear()
+            {
+                for ( size_t i = 0; i < c_nHistogramSize; ++i )
+                    m_arrBucket[i] = 0;
+            }
+
+            /// Returns total event count
+            size_t count() const
+            {
+                size_t nCount = 0;
+                for ( size_t i = 0; i < c_nHistogramSize; ++i )
+                    nCount += m_arrBucket[i];
+                return nCount;
+            }
+
+            /// Returns the upper bound of \p fPercent percentile, in nanoseconds
+            /**
+                For example, <tt>percentile( 99.0 )</tt> returns the upper bound of the bucket containing 99th percentile.
+                If the histogram is empty the function returns 0.
+            */
+            uint64_t percentile( double fPercent ) const
+            {
+                size_t const nCount = count();
+                if ( nCount == 0 )
+                    return 0;
+
+                size_t nRank = static_cast<size_t>( nCount * fPercent / 100.0 );
+                if ( nRank >= nCount )
+                    nRank = nCount - 1;
+
+                size_t nSum = 0;
+                for ( size_t i = 0; i < c_nHistogramSize; ++i ) {
+                    nSum += m_arrBucket[i];
+                    if ( nSum > nRank )
+                        return ( static_cast<uint64_t>(2) << i ) - 1;
+                }
+                return ( static_cast<uint64_t>(2) << ( c_nHistogramSize - 1 )) - 1;
+            }
+        };
+
+        /// Per-thread reclamation state
+        struct thread_stat {
+            cds::OS::ThreadId   idOwner;        ///< Owner thread id
+            size_t              nRetiredCount;  ///< Count of retired pointers the thread's retired array contains
+        };
+
+        /// Telemetry snapshot
+        struct snapshot {
+            size_t      nRetiredBacklog;    ///< Current count of retired but not freed pointers
+            size_t      nFreedCount;        ///< Total count of freed retired pointers
+
+            size_t      nScanCount;         ///< Count of reclamation passes (\p Scan() for HP, DHP, HE, EBR)
+            histogram   scanDuration;       ///< Histogram of reclamation pass duration
+            size_t      nHelpScanCount;     ///< Count of \p HelpScan() calls (HP, HE, EBR)
+            size_t      nHelpScanAdopted;   ///< Count of retired pointers adopted by \p HelpScan() from dead threads (HP, HE)
+
+            size_t      nGracePeriodCount;  ///< Count of grace periods (RCU only)
+            histogram   gracePeriodLatency; ///< Histogram of grace period (\p synchronize()) latency (RCU only)
+
+            std::vector< thread_stat > threads; ///< Per-thread retired pointer count (HP, HE, EBR)
+
+            //@cond
+            snapshot()
+            {
+                clear();
+            }
+            //@endcond
+
+            /// Resets the snapshot, \p threads capacity is kept
+            void clear()
+            {
+                nRetiredBacklog =
+                    nFreedCount =
+                    nScanCount =
+                    nHelpScanCount =
+                    nHelpScanAdopted =
+                    nGracePeriodCount = 0;
+                scanDuration.clear();
+                gracePeriodLatency.clear();
+                threads.clear();
+            }
+        };
+
+        //@cond
+        // Duration measurement
+        class steady_stopwatch
+        {
+            typedef std::chrono::steady_clock clock_type;
+            clock_type::time_point  m_Start;
+
+        public:
+            steady_stopwatch()
+                : m_Start( clock_type::now())
+            {}
+
+            uint64_t elapsed() const
+            {
+                return static_cast<uint64_t>( std::chrono::duration_cast< std::chrono::nanoseconds >( clock_type::now() - m_Start ).count());
+            }
+        };
+
+        // Concurrent histogram accumulator
+        class recorder
+        {
+            atomics::atomic<size_t> m_arrBucket[c_nHistogramSize];
+
+        public:
+            recorder()
+            {
+                for ( size_t i = 0; i < c_nHistogramSize; ++i )
+                    m_arrBucket[i].store( 0, atomics::memory_order_relaxed );
+            }
+
+            void add( uint64_t nDuration )
+            {
+                size_t nBucket = 0;
+                while ( nDuration > 1 && nBucket < c_nHistogramSize - 1 ) {
+                    nDuration >>= 1;
+                    ++nBucket;
+                }
+                m_arrBucket[nBucket].fetch_add( 1, atomics::memory_order_relaxed );
+            }
+
+            void get( histogram& h ) const
+            {
+                for ( size_t i = 0; i < c_nHistogramSize; ++i )
+                    h.m_arrBucket[i] = m_arrBucket[i].load( atomics::memory_order_relaxed );
+            }
+        };
+
+        // Empty duration measurement, does not read the clock
+        struct empty_stopwatch
+        {
+            uint64_t elapsed() const
+            {
+                return 0;
+            }
+        };
+        //@endcond
+
+        /// Telemetry counters of a garbage collector
+        struct collector
+        {
+            //@cond
+            typedef steady_stopwatch stopwatch;
+            static CDS_CONSTEXPR bool const c_bEnabled = true;
+
+            atomics::atomic<size_t> m_nFreed;
+            atomics::atomic<size_t> m_nScan;
+            atomics::atomic<size_t> m_nHelpScan;
+            atomics::atomic<size_t> m_nHelpScanAdopted;
+            atomics::atomic<size_t> m_nGracePeriod;
+            recorder                m_ScanDuration;
+            recorder                m_GracePeriodLatency;
+
+            collector()
+                : m_nFreed( 0 )
+                , m_nScan( 0 )
+                , m_nHelpScan( 0 )
+                , m_nHelpScanAdopted( 0 )
+                , m_nGracePeriod( 0 )
+            {}
+
+            void on_scan( uint64_t nDuration, size_t nFreed )
+            {
+                m_nScan.fetch_add( 1, atomics::memory_order_relaxed );
+                m_ScanDuration.add( nDuration );
+                on_free( nFreed );
+            }
+
+            void on_free( size_t nFreed )
+            {
+                if ( nFreed )
+                    m_nFreed.fetch_add( nFreed, atomics::memory_order_relaxed );
+            }
+
+            void on_help_scan( size_t nAdopted )
+            {
+                m_nHelpScan.fetch_add( 1, atomics::memory_order_relaxed );
+                if ( nAdopted )
+                    m_nHelpScanAdopted.fetch_add( nAdopted, atomics::memory_order_relaxed );
+            }
+
+            void on_grace_period( uint64_t nDuration )
+            {
+                m_nGracePeriod.fetch_add( 1, atomics::memory_order_relaxed );
+                m_GracePeriodLatency.add( nDuration );
+            }
+
+            // Fills all fields of the snapshot except nRetiredBacklog and threads
+            void get( snapshot& s ) const
+            {
+                s.nFreedCount = m_nFreed.load( atomics::memory_order_relaxed );
+                s.nScanCount = m_nScan.load( atomics::memory_order_relaxed );
+                m_ScanDuration.get( s.scanDuration );
+                s.nHelpScanCount = m_nHelpScan.load( atomics::memory_order_relaxed );
+                s.nHelpScanAdopted = m_nHelpScanAdopted.load( atomics::memory_order_relaxed );
+                s.nGracePeriodCount = m_nGracePeriod.load( atomics::memory_order_relaxed );
+                m_GracePeriodLatency.get( s.gracePeriodLatency );
+            }
+            //@endcond
+        };
+
+        /// Empty telemetry collector, see \p CDS_DISABLE_GC_TELEMETRY
+        struct empty_collector
+        {
+            //@cond
+            typedef empty_stopwatch stopwatch;
+            static CDS_CONSTEXPR bool const c_bEnabled = false;
+
+            void on_scan( uint64_t, size_t ) {}
+            void on_free( size_t ) {}
+            void on_help_scan( size_t ) {}
+            void on_grace_period( uint64_t ) {}
+            void get( snapshot& ) const {}
+            //@endcond
+        };
+
+        /// Telemetry collector used by the garbage collectors
+#ifdef CDS_DISABLE_GC_TELEMETRY
+        typedef empty_collector gc_collector;
+#else
+        typedef collector gc_collector;
+#endif
+
+    } // namespace telemetry
+}} // namespace cds::gc
+
+#endif // #ifndef CDSLIB_GC_TELEMETRY_H
@@ -32,6 +32,7 @@
 #define CDSLIB_INTRUSIVE_CUCKOO_SET_H
 
 #include <memory>
+#include <algorithm>  // std::for_each, std::fill
 #include <type_traits>
 #include <mutex>
 #include <functional>   // ref
@@ -40,6 +41,7 @@
 #include <cds/opt/hash.h>
 #include <cds/sync/lock_array.h>
 #include <cds/os/thread.h>
+#include <cds/details/aligned_allocator.h>
 #include <cds/sync/spinlock.h>
 
 
@@ -56,6 +58,11 @@ namespace cds { namespace intrusive {
             - \p cds::intrusive::cuckoo::vector<Capacity> - the probeset is a vector
                 with constant-size \p Capacity where \p Capacity is an <tt>unsigned int</tt> constant.
                 The node does not contain any auxiliary data.
+            - \p cds::intrusive::cuckoo::bucketized<Capacity> - the probeset is a fixed-size bucket
+                of \p Capacity slots (default 4) that keeps a one-byte hash fingerprint per slot
+                inline with the node pointers. When all candidate buckets are full the set
+                searches a short displacement path (BFS) instead of resizing immediately.
+                The node does not contain any auxiliary data.
         */
         template <typename Type>
         struct probeset_type
@@ -100,6 +107,7 @@ namespace cds { namespace intrusive {
         // Probeset type placeholders
         struct list_probeset_class;
         struct vector_probeset_class;
+        struct bucketized_probeset_class;
         //@endcond
 
         //@cond
@@ -115,11 +123,37 @@ namespace cds { namespace intrusive {
             static unsigned int const c_nCapacity = Capacity;
         };
 
+        /// Bucketized probeset type
+        /**
+            The probeset is a bucket of \p Capacity slots. Each slot contains the node pointer
+            and an 8-bit fingerprint of the item's hash, so the search in a bucket compares
+            the fingerprints first and touches the nodes only when the fingerprint matches.
+            Each bucket is filled up to \p Capacity items; when all buckets of an item are full,
+            \p CuckooSet looks for the shortest chain of moves (breadth-first search over
+            alternative buckets) that frees a slot, locking only the buckets along the chain.
+            The set is resized only if no such chain is found.
+
+            The bucket is aligned to the cache line and its size is a multiple of the cache line size,
+            so the bucket tables are allocated by \p CDS_DEFAULT_ALIGNED_ALLOCATOR instead of
+            \p cuckoo::traits::allocator. The bucket of default capacity 4 occupies exactly one 64-byte cache line,
+            hence the lookup reads at most one cache line per table besides the nodes with matching fingerprint.
+            \p Capacity should be small: with 8 slots the bucket occupies two cache lines.
+
+            The bucketized probeset supports incremental resizing and, with \p cuckoo::optimistic_striping
+            mutex policy, the lookups without locking, see \p CuckooSet.
+        */
+        template <unsigned int Capacity = 4>
+        struct bucketized
+        {
+            /// Bucket capacity
+            static unsigned int const c_nCapacity = Capacity;
+        };
+
         /// CuckooSet node
         /**
             Template arguments:
-            - \p ProbesetType - type of probeset. Can be \p cds::intrusive::cuckoo::list
-                or \p cds::intrusive::cuckoo::vector<Capacity>.
+            - \p ProbesetType - type of probeset. Can be \p cds::intrusive::cuckoo::list,
+                \p cds::intrusive::cuckoo::vector<Capacity> or \p cds::intrusive::cuckoo::bucketized<Capacity>.
             - \p StoreHashCount - constant that defines whether to store node hash values.
                 See cuckoo::store_hash option for explanation
             - \p Tag - a \ref cds_intrusive_hook_tag "tag"
@@ -256,6 +290,62 @@ namespace cds { namespace intrusive {
             void clear()
             {}
         };
+
+        template <unsigned int Capacity, typename Tag>
+        struct node< cuckoo::bucketized<Capacity>, 0, Tag>
+        {
+            typedef bucketized_probeset_class       probeset_class;
+            typedef cuckoo::bucketized<Capacity>    probeset_type;
+            typedef Tag                             tag;
+            static unsigned int const hash_array_size = 0;
+            static unsigned int const probeset_size = probeset_type::c_nCapacity;
+
+            node() CDS_NOEXCEPT
+            {}
+
+            void store_hash( size_t * )
+            {}
+
+            size_t * get_hash() const
+            {
+                // This node type does not store hash values!!!
+                assert(false);
+                return nullptr;
+            }
+
+            void clear()
+            {}
+        };
+
+        template <unsigned int Capacity, unsigned int StoreHashCount, typename Tag>
+        struct node< cuckoo::bucketized<Capacity>, StoreHashCount, Tag>
+        {
+            typedef bucketized_probeset_class       probeset_class;
+            typedef cuckoo::bucketized<Capacity>    probeset_type;
+            typedef Tag                             tag;
+            static unsigned int const hash_array_size = StoreHashCount;
+            static unsigned int const probeset_size = probeset_type::c_nCapacity;
+
+            size_t  m_arrHash[ hash_array_size ];
+
+            node() CDS_NOEXCEPT
+            {
+                memset( m_arrHash, 0, sizeof(m_arrHash));
+            }
+
+            void store_hash( size_t * pHashes )
+            {
+                memcpy( m_arrHash, pHashes, sizeof(m_arrHash));
+            }
+
+            size_t * get_hash() const
+            {
+                return const_cast<size_t *>( m_arrHash );
+            }
+
+            void clear()
+            {}
+        };
         //@endcond
 
 
@@ -978,6 +1068,114 @@ namespace cds { namespace intrusive {
             }
         };
 
+        /// Lock striping concurrent access policy with optimistic lookups
+        /**
+            This is one of available opt::mutex_policy option type for CuckooSet
+
+            The policy is the same lock striping as \p cuckoo::striping, but the lookup functions
+            of \p CuckooSet (\p find(), \p contains() and so on) do not acquire the locks.
+            Only <tt>cuckoo::bucketized</tt> probeset supports the policy, it is checked at compile time.
+
+            Each bucket of bucketized probeset contains a version counter that is odd while the bucket
+            is being changed. The lookup reads the versions of all buckets of the key, searches the buckets
+            and then checks that no version has been changed. If a change is detected, the lookup is repeated;
+            after \p ReadAttempts unsuccessful attempts the lookup acquires the cell lock.
+            So the readers do not write to shared memory and scale with the number of reading threads.
+
+            Since the buckets are read concurrently with writers, the memory that the reader can access
+            must not be freed while the reader is in progress. The policy uses \p RCU for that:
+            - the optimistic lookup is performed in RCU read-side critical section;
+            - the old bucket tables are retired via \p RCU when the set is resized;
+            - \p CuckooSet::clear() waits for RCU grace period before disposing the items;
+            - the item unlinked by \p CuckooSet::erase() or \p CuckooSet::unlink() can still be accessed by
+              the optimistic reader, so it must be freed after RCU grace period, for example,
+              via <tt>RCU::retire_ptr()</tt>. \p cds::container::CuckooSet and \p cds::container::CuckooMap
+              do it automatically.
+
+            The optimistic lookup is enough for \p CuckooSet::contains(). \p CuckooSet::find() acquires the cell lock
+            if the optimistic lookup has found the item, so the functor passed is always called under the lock.
+
+            The modifying operations call \p RCU::synchronize() or \p RCU::retire_ptr(),
+            so they must not be called inside RCU read-side critical section.
+
+            Template arguments:
+            - \p RCU - one of \ref cds_urcu_gc "RCU type"
+            - \p RecursiveLock - the type of recursive mutex. The default is \p std::recursive_mutex.
+            - \p Arity - unsigned int constant that specifies an arity. Default value is 2.
+            - \p ReadAttempts - count of optimistic read attempts before the lock is acquired, default is 4.
+            - \p Alloc - allocator type used for lock array memory allocation. Default is \p CDS_DEFAULT_ALLOCATOR.
+            - \p Stat - internal statistics type. Note that this template argument is automatically selected by \ref CuckooSet
+                class according to its \p opt::stat option.
+        */
+        template <
+            class RCU,
+            class RecursiveLock = std::recursive_mutex,
+            unsigned int Arity = 2,
+            unsigned int ReadAttempts = 4,
+            class Alloc = CDS_DEFAULT_ALLOCATOR,
+            class Stat = empty_striping_stat
+        >
+        class optimistic_striping: public striping< RecursiveLock, Arity, Alloc, Stat >
+        {
+            //@cond
+            typedef striping< RecursiveLock, Arity, Alloc, Stat > base_class;
+            //@endcond
+        public:
+            typedef RCU     rcu ;   ///< RCU type
+            typedef typename rcu::scoped_lock read_lock ;   ///< RCU lock for optimistic reading
+
+            static CDS_CONSTEXPR const unsigned int c_nReadAttempts = ReadAttempts; ///< Count of optimistic read attempts
+            static_assert( c_nReadAttempts > 0, "ReadAttempts must be positive" );
+
+            //@cond
+            template <typename Stat2>
+            struct rebind_statistics {
+                typedef optimistic_striping< rcu, RecursiveLock, Arity, c_nReadAttempts, Alloc, Stat2 > other;
+            };
+            //@endcond
+
+        public:
+            /// Constructor
+            optimistic_striping(
+                size_t nLockCount          ///< The size of lock array. Must be power of two.
+            )
+                : base_class( nLockCount )
+            {}
+
+            /// Retires \p p via \p RCU, the functor \p pFunc is called when no optimistic reader can access \p p
+            template <typename T>
+            static void retire( T * p, void (* pFunc)( T * ))
+            {
+                rcu::retire_ptr( p, pFunc );
+            }
+
+            /// Retires \p p via \p RCU, <tt>Disposer()( p )</tt> is called when no optimistic reader can access \p p
+            template <typename Disposer, typename T>
+            static void retire( T * p )
+            {
+                rcu::template retire_ptr<Disposer>( p );
+            }
+
+            /// Waits until all optimistic readers started before the call are finished
+            static void synchronize()
+            {
+                rcu::synchronize();
+            }
+        };
+
+        //@cond
+        namespace details {
+            // Checks if the mutex policy supports optimistic lookups
+            template <typename Policy>
+            struct optimistic_read: public std::false_type
+            {};
+
+            template <class RCU, class RecursiveLock, unsigned int Arity, unsigned int ReadAttempts, class Alloc, class Stat>
+            struct optimistic_read< optimistic_striping< RCU, RecursiveLock, Arity, ReadAttempts, Alloc, Stat >>: public std::true_type
+            {};
+        } // namespace details
+        //@endcond
+
         /// CuckooSet internal statistics
         struct stat {
             typedef cds::atomicity::event_counter   counter_type ;  ///< Counter type
@@ -993,6 +1191,13 @@ namespace cds { namespace intrusive {
             counter_type    m_nFalseResizeCount     ;   ///< Count of false \p resize function call (when other thread has been resized the set)
             counter_type    m_nResizeSuccessNodeMove;   ///< Count of successfull node moving when resizing
             counter_type    m_nResizeRelocateCall   ;   ///< Count of \p relocate function call from \p resize function
+            counter_type    m_nResizeLazyMigrate    ;   ///< Count of old buckets migrated by the operations touching them while the set is being resized (\p cuckoo::bucketized only)
+
+            counter_type    m_nDisplacementCall     ;   ///< Count of displacement path searches (\p cuckoo::bucketized probeset only)
+            counter_type    m_nDisplacementPathFound;   ///< Count of displacement paths found and applied
+            counter_type    m_nDisplacementPathFailed;  ///< Count of displacement searches that found no path (resize is required)
+            counter_type    m_nDisplacementPathAborted; ///< Count of displacement paths aborted because the buckets have been changed by other thread
+            counter_type    m_nDisplacementMove     ;   ///< Count of items moved along displacement paths
 
             counter_type    m_nInsertSuccess        ;   ///< Count of successfull \p insert function call
             counter_type    m_nInsertFailed         ;   ///< Count of failed \p insert function call
@@ -1021,6 +1226,9 @@ namespace cds { namespace intrusive {
             counter_type    m_nFindWithSuccess         ;   ///< Count of success \p find_with function call
             counter_type    m_nFindWithFailed          ;   ///< Count of failed \p find_with function call
 
+            counter_type    m_nFindOptimisticRetry     ;   ///< Count of failed validations of optimistic lookup (\p cuckoo::optimistic_striping only)
+            counter_type    m_nFindOptimisticLocked    ;   ///< Count of lookups that acquired the lock after all optimistic attempts failed (\p cuckoo::optimistic_striping only)
+
             //@cond
             void    onRelocateCall()        { ++m_nRelocateCallCount; }
             void    onRelocateRound()       { ++m_nRelocateRoundCount; }
@@ -1033,6 +1241,13 @@ namespace cds { namespace intrusive {
             void    onFalseResizeCall()     { ++m_nFalseResizeCount; }
             void    onResizeSuccessMove()   { ++m_nResizeSuccessNodeMove; }
             void    onResizeRelocateCall()  { ++m_nResizeRelocateCall; }
+            void    onResizeLazyMigrate()   { ++m_nResizeLazyMigrate; }
+
+            void    onDisplacementCall()    { ++m_nDisplacementCall; }
+            void    onDisplacementPathFound()   { ++m_nDisplacementPathFound; }
+            void    onDisplacementPathFailed()  { ++m_nDisplacementPathFailed; }
+            void    onDisplacementPathAborted() { ++m_nDisplacementPathAborted; }
+            void    onDisplacementMove()    { ++m_nDisplacementMove; }
 
             void    onInsertSuccess()       { ++m_nInsertSuccess; }
             void    onInsertFailed()        { ++m_nInsertFailed; }
@@ -1057,6 +1272,9 @@ namespace cds { namespace intrusive {
 
             void    onFindWithSuccess()     { ++m_nFindWithSuccess; }
             void    onFindWithFailed()      { ++m_nFindWithFailed; }
+
+            void    onFindOptimisticRetry() { ++m_nFindOptimisticRetry; }
+            void    onFindOptimisticLocked(){ ++m_nFindOptimisticLocked; }
             //@endcond
         };
 
@@ -1074,6 +1292,13 @@ namespace cds { namespace intrusive {
             void    onFalseResizeCall()     const {}
             void    onResizeSuccessMove()   const {}
             void    onResizeRelocateCall()  const {}
+            void    onResizeLazyMigrate()   const {}
+
+            void    onDisplacementCall()    const {}
+            void    onDisplacementPathFound()   const {}
+            void    onDisplacementPathFailed()  const {}
+            void    onDisplacementPathAborted() const {}
+            void    onDisplacementMove()    const {}
 
             void    onInsertSuccess()       const {}
             void    onInsertFailed()        const {}
@@ -1098,6 +1323,9 @@ namespace cds { namespace intrusive {
 
             void    onFindWithSuccess()     const {}
             void    onFindWithFailed()      const {}
+
+            void    onFindOptimisticRetry() const {}
+            void    onFindOptimisticLocked()const {}
             //@endcond
         };
 
@@ -1134,6 +1362,7 @@ namespace cds { namespace intrusive {
                 Available opt::mutex_policy types:
                 - \p cuckoo::striping - simple, but the lock array is not resizable
                 - \p cuckoo::refinable - resizable lock array, but more complex access to set data.
+                - \p cuckoo::optimistic_striping - lock striping with lookups without locking, \p cuckoo::bucketized probeset only.
 
                 Default is \p cuckoo::striping.
             */
@@ -1169,6 +1398,7 @@ namespace cds { namespace intrusive {
             /// Allocator type
             /**
                 The allocator type for allocating bucket tables.
+                The bucket tables of \p cuckoo::bucketized probeset are allocated by \p CDS_DEFAULT_ALIGNED_ALLOCATOR.
             */
             typedef CDS_DEFAULT_ALLOCATOR       allocator;
 
@@ -1194,7 +1424,7 @@ namespace cds { namespace intrusive {
                 The hash functors are passed as <tt> std::tuple< H1, H2, ... Hn > </tt>. The number of hash functors specifies
                 the number \p k - the count of hash tables in cuckoo hashing.
             - \p opt::mutex_policy - concurrent access policy.
-                Available policies: \p cuckoo::striping, \p cuckoo::refinable.
+                Available policies: \p cuckoo::striping, \p cuckoo::refinable, \p cuckoo::optimistic_striping.
                 Default is \p %cuckoo::striping.
             - \p opt::equal_to - key equality functor like \p std::equal_to.
                 If this functor is defined then the probe-set will be unordered.
@@ -1331,6 +1561,11 @@ namespace cds { namespace intrusive {
                     ++nSize;
                 }
 
+                void insert_after( iterator it, node_type * p, size_t /*nHash*/ )
+                {
+                    insert_after( it, p );
+                }
+
                 void remove( iterator itPrev, iterator itWhat )
                 {
                     node_type * pPrev = itPrev.pNode;
@@ -1491,6 +1726,11 @@ namespace cds { namespace intrusive {
                     ++m_nSize;
                 }
 
+                void insert_after( iterator it, node_type * p, size_t /*nHash*/ )
+                {
+                    insert_after( it, p );
+                }
+
                 void remove( iterator /*itPrev*/, iterator itWhat )
                 {
                     itWhat->clear();
@@ -1518,6 +1758,217 @@ namespace cds { namespace intrusive {
                 }
             };
 
+            template <typename Node, unsigned int Capacity>
+            class bucket_entry<Node, cuckoo::bucketized<Capacity>>
+            {
+            public:
+                typedef Node                                node_type;
+                typedef cuckoo::bucketized_probeset_class   probeset_class;
+                typedef cuckoo::bucketized<Capacity>        probeset_type;
+
+                static unsigned int const c_nCapacity = probeset_type::c_nCapacity;
+
+            protected:
+                // The bucket is changed under the cell lock only, but it can be read concurrently
+                // by optimistic lookup (see cuckoo::optimistic_striping).
+                // So the fields are atomic and the version is odd while the bucket is being changed
+                CDS_DATA_ALIGNMENT( cds::c_nCacheLineSize ) atomics::atomic<uint32_t> m_nVersion;
+                atomics::atomic<uint32_t>       m_nSize;
+                atomics::atomic<uint8_t>        m_arrTag[c_nCapacity];  // hash fingerprints of m_arrNode items
+                atomics::atomic<node_type *>    m_arrNode[c_nCapacity];
+
+            public:
+                class iterator
+                {
+                    atomics::atomic<node_type *> * pArr;
+                    friend class bucket_entry;
+
+                public:
+                    iterator()
+                        : pArr( nullptr )
+                    {}
+                    iterator( atomics::atomic<node_type *> * p )
+                        : pArr(p)
+                    {}
+                    iterator( iterator const& it)
+                        : pArr( it.pArr )
+                    {}
+
+                    iterator& operator=( iterator const& it )
+                    {
+                        pArr = it.pArr;
+                        return *this;
+                    }
+
+                    node_type * operator->()
+                    {
+                        assert( pArr != nullptr );
+                        return pArr->load( atomics::memory_order_relaxed );
+                    }
+                    node_type& operator*()
+                    {
+                        assert( pArr != nullptr );
+                        assert( pArr->load( atomics::memory_order_relaxed ) != nullptr );
+                        return *pArr->load( atomics::memory_order_relaxed );
+                    }
+
+                    // preinc
+                    iterator& operator ++()
+                    {
+                        ++pArr;
+                        return *this;
+                    }
+
+                    bool operator==(iterator const& it ) const
+                    {
+                        return pArr == it.pArr;
+                    }
+                    bool operator!=(iterator const& it ) const
+                    {
+                        return !( *this == it );
+                    }
+                };
+
+            public:
+                bucket_entry()
+                    : m_nVersion( 0 )
+                    , m_nSize( 0 )
+                {
+                    for ( unsigned int i = 0; i < c_nCapacity; ++i ) {
+                        m_arrTag[i].store( 0, atomics::memory_order_relaxed );
+                        m_arrNode[i].store( nullptr, atomics::memory_order_relaxed );
+                    }
+                    static_assert(( std::is_same<typename node_type::probeset_type, probeset_type>::value ), "Incompatible node type" );
+                }
+
+                /// Folds the hash value to 8-bit fingerprint
+                static uint8_t make_tag( size_t nHash )
+                {
+                    nHash ^= ( nHash >> 16 ) >> 16;
+                    nHash ^= nHash >> 16;
+                    nHash ^= nHash >> 8;
+                    return static_cast<uint8_t>( nHash );
+                }
+
+                iterator begin()
+                {
+                    return iterator(m_arrNode);
+                }
+                iterator end()
+                {
+                    return iterator(m_arrNode + size());
+                }
+
+                uint8_t tag( iterator it ) const
+                {
+                    assert( m_arrNode <= it.pArr && it.pArr < m_arrNode + size() );
+                    return m_arrTag[ it.pArr - m_arrNode ].load( atomics::memory_order_relaxed );
+                }
+
+                node_type * node( unsigned int nIndex ) const
+                {
+                    assert( nIndex < size() );
+                    return m_arrNode[nIndex].load( atomics::memory_order_relaxed );
+                }
+
+                // The bucket is unordered: the item is always appended, \p it is ignored
+                void insert_after( iterator /*it*/, node_type * p, size_t nHash )
+                {
+                    unsigned int const nSize = size();
+                    assert( nSize < c_nCapacity );
+
+                    write_begin();
+                    m_arrNode[nSize].store( p, atomics::memory_order_relaxed );
+                    m_arrTag[nSize].store( make_tag( nHash ), atomics::memory_order_relaxed );
+                    m_nSize.store( nSize + 1, atomics::memory_order_relaxed );
+                    write_end();
+                }
+
+                void remove( iterator /*itPrev*/, iterator itWhat )
+                {
+                    unsigned int nSize = size();
+                    assert( m_arrNode <= itWhat.pArr && itWhat.pArr < m_arrNode + nSize );
+                    itWhat->clear();
+
+                    // the last item fills the hole
+                    unsigned int const nIdx = static_cast<unsigned int>( itWhat.pArr - m_arrNode );
+                    --nSize;
+                    write_begin();
+                    m_arrNode[nIdx].store( m_arrNode[nSize].load( atomics::memory_order_relaxed ), atomics::memory_order_relaxed );
+                    m_arrTag[nIdx].store( m_arrTag[nSize].load( atomics::memory_order_relaxed ), atomics::memory_order_relaxed );
+                    m_arrNode[nSize].store( nullptr, atomics::memory_order_relaxed );
+                    m_nSize.store( nSize, atomics::memory_order_relaxed );
+                    write_end();
+                }
+
+                void clear()
+                {
+                    write_begin();
+                    for ( unsigned int i = 0; i < c_nCapacity; ++i )
+                        m_arrNode[i].store( nullptr, atomics::memory_order_relaxed );
+                    m_nSize.store( 0, atomics::memory_order_relaxed );
+                    write_end();
+                }
+
+                // The version is not changed: the caller must exclude optimistic readers, see CuckooSet::clear_and_dispose()
+                template <typename Disposer>
+                void clear( Disposer disp )
+                {
+                    unsigned int const nSize = size();
+                    m_nSize.store( 0, atomics::memory_order_relaxed );
+                    for ( unsigned int i = 0; i < nSize; ++i ) {
+                        node_type * p = m_arrNode[i].load( atomics::memory_order_relaxed );
+                        m_arrNode[i].store( nullptr, atomics::memory_order_relaxed );
+                        disp( p );
+                    }
+                }
+
+                unsigned int size() const
+                {
+                    return m_nSize.load( atomics::memory_order_relaxed );
+                }
+
+                // Write side of the bucket version, must be called under the cell lock
+                void write_begin()
+                {
+                    m_nVersion.store( m_nVersion.load( atomics::memory_order_relaxed ) + 1, atomics::memory_order_relaxed );
+                    atomics::atomic_thread_fence( atomics::memory_order_release );
+                }
+
+                void write_end()
+                {
+                    m_nVersion.store( m_nVersion.load( atomics::memory_order_relaxed ) + 1, atomics::memory_order_release );
+                }
+
+                // Read side of the bucket version: an odd version means that the bucket is being changed
+                uint32_t read_begin() const
+                {
+                    return m_nVersion.load( atomics::memory_order_acquire );
+                }
+
+                bool read_validate( uint32_t nVersion ) const
+                {
+                    atomics::atomic_thread_fence( atomics::memory_order_acquire );
+                    return m_nVersion.load( atomics::memory_order_relaxed ) == nVersion;
+                }
+
+                // Searches the bucket without the lock; the result is valid only if read_validate() succeeds.
+                // The node found can be already unlinked, its memory must be protected by the caller
+                template <typename Equal>
+                node_type * optimistic_find( uint8_t nTag, Equal eq ) const
+                {
+                    unsigned int const nSize = size();
+                    for ( unsigned int i = 0; i < nSize && i < c_nCapacity; ++i ) {
+                        if ( m_arrTag[i].load( atomics::memory_order_relaxed ) == nTag ) {
+                            node_type * p = m_arrNode[i].load( atomics::memory_order_relaxed );
+                            if ( p && eq( *p ))
+                                return p;
+                        }
+                    }
+                    return nullptr;
+                }
+            };
+
             template <typename Node, unsigned int ArraySize>
             struct hash_ops {
                 static void store( Node * pNode, size_t * pHashes )
@@ -1598,13 +2049,83 @@ namespace cds { namespace intrusive {
                 }
             };
 
-        }   // namespace details
-        //@endcond
+            // Search in bucketized probeset: the fingerprint is checked first,
+            // the node is accessed only if the fingerprint matches
+            template <typename NodeTraits, bool Ordered>
+            struct contains_bucketized
+            {
+                template <typename Compare, typename T, typename Q>
+                static bool is_equal( Compare& cmp, T const& v, Q const& val, std::true_type )
+                {
+                    return cmp( v, val ) == 0;
+                }
+                template <typename EqualTo, typename T, typename Q>
+                static bool is_equal( EqualTo& eq, T const& v, Q const& val, std::false_type )
+                {
+                    return eq( v, val );
+                }
 
-    } // namespace cuckoo
+                template <typename BucketEntry, typename Position, typename Q, typename Predicate>
+                static bool find( BucketEntry& probeset, Position& pos, unsigned int nTable, size_t nHash, Q const& val, Predicate pred )
+                {
+                    typedef typename BucketEntry::iterator  bucket_iterator;
+                    typedef typename BucketEntry::node_type node_type;
 
-    /// Cuckoo hash set
-    /** @ingroup cds_intrusive_map
+                    uint8_t const nTag = BucketEntry::make_tag( nHash );
+                    for ( bucket_iterator it = probeset.begin(), itEnd = probeset.end(); it != itEnd; ++it ) {
+                        if ( probeset.tag( it ) == nTag
+                            && hash_ops<node_type, node_type::hash_array_size>::equal_to( *it, nTable, nHash )
+                            && is_equal( pred, *NodeTraits::to_value_ptr(*it), val, std::integral_constant<bool, Ordered>()))
+                        {
+                            pos.itFound = it;
+                            pos.itPrev = bucket_iterator();
+                            return true;
+                        }
+                    }
+
+                    pos.itPrev = bucket_iterator();
+                    pos.itFound = probeset.end();
+                    return false;
+                }
+
+                template <typename Node, typename Q, typename Predicate>
+                struct optimistic_equal
+                {
+                    unsigned int    nTable;
+                    size_t          nHash;
+                    Q const&        val;
+                    Predicate&      pred;
+
+                    optimistic_equal( unsigned int t, size_t h, Q const& v, Predicate& p )
+                        : nTable( t )
+                        , nHash( h )
+                        , val( v )
+                        , pred( p )
+                    {}
+
+                    bool operator()( Node& node ) const
+                    {
+                        return hash_ops<Node, Node::hash_array_size>::equal_to( node, nTable, nHash )
+                            && is_equal( pred, *NodeTraits::to_value_ptr( node ), val, std::integral_constant<bool, Ordered>());
+                    }
+                };
+
+                // Lock-free search, the result must be validated by the bucket version
+                template <typename BucketEntry, typename Q, typename Predicate>
+                static typename BucketEntry::node_type * optimistic_find( BucketEntry const& probeset, unsigned int nTable, size_t nHash, Q const& val, Predicate& pred )
+                {
+                    typedef typename BucketEntry::node_type node_type;
+                    return probeset.optimistic_find( BucketEntry::make_tag( nHash ), optimistic_equal<node_type, Q, Predicate>( nTable, nHash, val, pred ));
+                }
+            };
+
+        }   // namespace details
+        //@endcond
+
+    } // namespace cuckoo
+
+    /// Cuckoo hash set
+    /** @ingroup cds_intrusive_map
 
         Source
             - [2007] M.Herlihy, N.Shavit, M.Tzafrir "Concurrent Cuckoo Hashing. Technical report"
@@ -1640,7 +2161,13 @@ namespace cds { namespace intrusive {
             set may temporarily hold more than \p THRESHOLD but never more than \p PROBE_SET items.
 
             In current implementation, a probe set can be defined either as a (single-linked) list
-            or as a fixed-sized vector, optionally ordered.
+            or as a fixed-sized vector, optionally ordered, or as a cache-aligned bucket of fingerprinted slots
+            (\p cuckoo::bucketized). For the bucketized probe set the free slot is searched by BFS
+            over displacement paths, and the set is resized incrementally: the doubled tables are published
+            under short full lock, then the old buckets are migrated one by one under the cell locks,
+            concurrent operations are not blocked and migrate the buckets they touch by themselves.
+            With \p cuckoo::optimistic_striping mutex policy \p contains() does not lock the buckets,
+            \p find() locks them only to call the functor for the item found.
 
             In description above two-table cuckoo hashing (<tt>k = 2</tt>) has been considered.
             We can generalize this approach for <tt>k >= 2</tt> when we have \p k hash functions
@@ -1902,6 +2429,10 @@ namespace cds { namespace intrusive {
         typedef typename node_type::probeset_class  probeset_class;
         typedef typename node_type::probeset_type   probeset_type;
         static unsigned int const c_nNodeHashArraySize = node_type::hash_array_size;
+        static bool const c_isBucketized = std::is_same< probeset_class, cuckoo::bucketized_probeset_class >::value;
+
+        typedef std::integral_constant< bool, cuckoo::details::optimistic_read< mutex_policy >::value > optimistic_read;
+        static_assert( !optimistic_read::value || c_isBucketized, "cuckoo::optimistic_striping requires cuckoo::bucketized probeset" );
 
         typedef typename mutex_policy::scoped_cell_lock     scoped_cell_lock;
         typedef typename mutex_policy::scoped_cell_trylock  scoped_cell_trylock;
@@ -1911,6 +2442,7 @@ namespace cds { namespace intrusive {
         typedef cuckoo::details::bucket_entry< node_type, probeset_type >   bucket_entry;
         typedef typename bucket_entry::iterator                     bucket_iterator;
         typedef cds::details::Allocator< bucket_entry, allocator >  bucket_table_allocator;
+        typedef cds::details::AlignedAllocator< bucket_entry >      aligned_bucket_table_allocator;
 
         typedef size_t  hash_array[c_nArity]    ;   ///< hash array
 
@@ -1919,7 +2451,10 @@ namespace cds { namespace intrusive {
             bucket_iterator     itFound;
         };
 
-        typedef cuckoo::details::contains< node_traits, c_isSorted > contains_action;
+        typedef typename std::conditional< c_isBucketized,
+            cuckoo::details::contains_bucketized< node_traits, c_isSorted >,
+            cuckoo::details::contains< node_traits, c_isSorted >
+        >::type contains_action;
 
         template <typename Predicate>
         struct predicate_wrapper {
@@ -1933,11 +2468,18 @@ namespace cds { namespace intrusive {
         static unsigned int const   c_nDefaultProbesetSize = 4;   ///< default probeset size
         static size_t const         c_nDefaultInitialSize = 16;   ///< default initial size
         static unsigned int const   c_nRelocateLimit = c_nArity * 2 - 1; ///< Count of attempts to relocate before giving up
+        static unsigned int const   c_nDisplacementQueueSize = 256; ///< Max count of buckets visited by displacement path search (\p cuckoo::bucketized only)
+        static unsigned int const   c_nDisplacementDepth = 5;       ///< Max length of displacement path (\p cuckoo::bucketized only)
 
     protected:
-        bucket_entry *      m_BucketTable[ c_nArity ] ; ///< Bucket tables
+        atomics::atomic<bucket_entry *> m_BucketTable[ c_nArity ] ; ///< Bucket tables
+
+        atomics::atomic<size_t> m_nBucketMask       ;   ///< Hash bitmask; bucket table size minus 1.
 
-        size_t              m_nBucketMask           ;   ///< Hash bitmask; bucket table size minus 1.
+        atomics::atomic<bucket_entry *> m_OldBucketTable[ c_nArity ];   ///< Bucket tables being migrated by incremental resizing, \p nullptr if no resizing (\p cuckoo::bucketized only)
+        atomics::atomic<size_t> m_nOldBucketMask    ;   ///< Hash bitmask of \p m_OldBucketTable
+        atomics::atomic<bool>   m_bResizing         ;   ///< \p true if the set is being resized (\p cuckoo::bucketized only)
+        atomics::atomic<size_t> m_nTableVersion     ;   ///< Bucket table version, odd while the tables are being swapped (\p cuckoo::optimistic_striping only)
         unsigned int const  m_nProbesetSize         ;   ///< Probe set size
         unsigned int const  m_nProbesetThreshold    ;   ///< Probe set threshold
 
@@ -1955,7 +2497,8 @@ namespace cds { namespace intrusive {
 
         void check_probeset_properties() const
         {
-            assert( m_nProbesetThreshold < m_nProbesetSize );
+            // bucketized probeset is filled up to its capacity, there is no threshold
+            assert( m_nProbesetThreshold < m_nProbesetSize || ( c_isBucketized && m_nProbesetThreshold == m_nProbesetSize ));
 
             // if probe set type is cuckoo::vector<N> then m_nProbesetSize == N
             assert( node_type::probeset_size == 0 || node_type::probeset_size == m_nProbesetSize );
@@ -1975,10 +2518,66 @@ namespace cds { namespace intrusive {
                 hashing( pHashes, v );
         }
 
+        // The tables are changed under the full lock only, so the relaxed loads are enough for lock-based operations
+        bucket_entry * bucket_table( unsigned int nTable ) const
+        {
+            return m_BucketTable[nTable].load( atomics::memory_order_relaxed );
+        }
+
+        size_t bucket_mask() const
+        {
+            return m_nBucketMask.load( atomics::memory_order_relaxed );
+        }
+
+        bucket_entry * old_bucket_table( unsigned int nTable ) const
+        {
+            return m_OldBucketTable[nTable].load( atomics::memory_order_relaxed );
+        }
+
         bucket_entry& bucket( unsigned int nTable, size_t nHash )
         {
             assert( nTable < c_nArity );
-            return m_BucketTable[nTable][nHash & m_nBucketMask];
+            migrate_bucket( nTable, nHash, std::integral_constant<bool, c_isBucketized>());
+            return bucket_table( nTable )[nHash & bucket_mask()];
+        }
+
+        void migrate_bucket( unsigned int /*nTable*/, size_t /*nHash*/, std::false_type ) CDS_NOEXCEPT
+        {}
+
+        void migrate_bucket( unsigned int nTable, size_t nHash, std::true_type )
+        {
+            // m_OldBucketTable is changed under full lock only
+            if ( old_bucket_table( nTable ) && migrate_bucket( nTable, nHash & m_nOldBucketMask.load( atomics::memory_order_relaxed )))
+                m_Stat.onResizeLazyMigrate();
+        }
+
+        bool migrate_bucket( unsigned int nTable, size_t nOldBucket )
+        {
+            // Moves the items of the old bucket to the current table nTable.
+            // The old bucket is split into two new buckets, so the new buckets cannot overflow.
+            // The cell lock of the old bucket must be held, it covers the both new buckets since
+            // the lock array is not greater than the old table.
+            // Returns false if the old bucket is empty (already migrated)
+            bucket_entry& refOld = old_bucket_table( nTable )[nOldBucket];
+            unsigned int const nCount = refOld.size();
+            if ( nCount == 0 )
+                return false;
+
+            hash_array arrHash;
+            for ( unsigned int i = 0; i < nCount; ++i ) {
+                node_type * pNode = refOld.node( i );
+                copy_hash( arrHash, *node_traits::to_value_ptr( pNode ));
+                assert( ( arrHash[nTable] & m_nOldBucketMask.load( atomics::memory_order_relaxed )) == nOldBucket );
+
+                // the item is inserted into new bucket before it is removed from the old one,
+                // so an optimistic reader cannot miss it
+                bucket_entry& refNew = bucket_table( nTable )[arrHash[nTable] & bucket_mask()];
+                assert( refNew.size() < m_nProbesetSize );
+                refNew.insert_after( bucket_iterator(), pNode, arrHash[nTable] );
+                m_Stat.onResizeSuccessMove();
+            }
+            refOld.clear();
+            return true;
         }
 
         static void store_hash( node_type * pNode, size_t * pHashes )
@@ -1991,32 +2590,69 @@ namespace cds { namespace intrusive {
             return cuckoo::details::hash_ops< node_type, c_nNodeHashArraySize >::equal_to( node, nTable, nHash );
         }
 
-        void allocate_bucket_tables( size_t nSize )
+        static bucket_entry * alloc_bucket_table( size_t nSize, std::false_type )
+        {
+            return bucket_table_allocator().NewArray( nSize );
+        }
+
+        static bucket_entry * alloc_bucket_table( size_t nSize, std::true_type )
+        {
+            // each bucket of bucketized probeset occupies whole cache lines
+            static_assert( sizeof( bucket_entry ) % cds::c_nCacheLineSize == 0, "The bucket size must be a multiple of cache line size" );
+            return aligned_bucket_table_allocator().NewArray( cds::c_nCacheLineSize, nSize );
+        }
+
+        static void free_bucket_table( bucket_entry * pTable, size_t nSize, std::false_type )
+        {
+            bucket_table_allocator().Delete( pTable, nSize );
+        }
+
+        static void free_bucket_table( bucket_entry * pTable, size_t nSize, std::true_type )
+        {
+            aligned_bucket_table_allocator().Delete( pTable, nSize );
+        }
+
+        static void allocate_bucket_tables( bucket_entry ** pTable, size_t nSize )
         {
             assert( cds::beans::is_power2( nSize ) );
 
-            m_nBucketMask = nSize - 1;
-            bucket_table_allocator alloc;
             for ( unsigned int i = 0; i < c_nArity; ++i )
-                m_BucketTable[i] = alloc.NewArray( nSize );
+                pTable[i] = alloc_bucket_table( nSize, std::integral_constant<bool, c_isBucketized>());
+        }
+
+        void allocate_bucket_tables( size_t nSize )
+        {
+            bucket_entry * pTable[ c_nArity ];
+            allocate_bucket_tables( pTable, nSize );
+
+            for ( unsigned int i = 0; i < c_nArity; ++i ) {
+                m_BucketTable[i].store( pTable[i], atomics::memory_order_relaxed );
+                m_OldBucketTable[i].store( nullptr, atomics::memory_order_relaxed );
+            }
+            m_nBucketMask.store( nSize - 1, atomics::memory_order_relaxed );
+            m_nOldBucketMask.store( 0, atomics::memory_order_relaxed );
         }
 
         static void free_bucket_tables( bucket_entry ** pTable, size_t nCapacity )
         {
-            bucket_table_allocator alloc;
             for ( unsigned int i = 0; i < c_nArity; ++i ) {
-                alloc.Delete( pTable[i], nCapacity );
+                free_bucket_table( pTable[i], nCapacity, std::integral_constant<bool, c_isBucketized>());
                 pTable[i] = nullptr;
             }
         }
         void free_bucket_tables()
         {
-            free_bucket_tables( m_BucketTable, m_nBucketMask + 1 );
+            bucket_entry * pTable[ c_nArity ];
+            for ( unsigned int i = 0; i < c_nArity; ++i ) {
+                pTable[i] = bucket_table( i );
+                m_BucketTable[i].store( nullptr, atomics::memory_order_relaxed );
+            }
+            free_bucket_tables( pTable, bucket_count());
         }
 
         static CDS_CONSTEXPR unsigned int const c_nUndefTable = (unsigned int) -1;
         template <typename Q, typename Predicate >
-        unsigned int contains( position * arrPos, size_t * arrHash, Q const& val, Predicate pred )
+        unsigned int contains( position * arrPos, size_t const * arrHash, Q const& val, Predicate pred )
         {
             // Buckets must be locked
 
@@ -2057,8 +2693,14 @@ namespace cds { namespace intrusive {
         bool find_( Q& val, Predicate pred, Func f )
         {
             hash_array arrHash;
-            position arrPos[ c_nArity ];
             hashing( arrHash, val );
+            return find_( val, arrHash, pred, f, optimistic_read());
+        }
+
+        template <typename Q, typename Predicate, typename Func>
+        bool find_( Q& val, size_t const * arrHash, Predicate pred, Func f, std::false_type )
+        {
+            position arrPos[ c_nArity ];
             scoped_cell_lock sl( m_MutexPolicy, arrHash );
 
             unsigned int nTable = contains( arrPos, arrHash, val, pred );
@@ -2072,6 +2714,129 @@ namespace cds { namespace intrusive {
             return false;
         }
 
+        template <typename Q, typename Predicate, typename Func>
+        bool find_( Q& val, size_t const * arrHash, Predicate pred, Func f, std::true_type )
+        {
+            // The optimistic lookup proves the absence of val without locking.
+            // If val is found, f is called under the cell lock since it may change the item
+            if ( optimistic_lookup( val, arrHash, pred ) == 0 ) {
+                m_Stat.onFindFailed();
+                return false;
+            }
+            return find_( val, arrHash, pred, f, std::false_type());
+        }
+
+        template <typename Q, typename Predicate>
+        bool contains_( Q const& val, Predicate pred )
+        {
+            hash_array arrHash;
+            hashing( arrHash, val );
+            return contains_( val, arrHash, pred, optimistic_read());
+        }
+
+        template <typename Q, typename Predicate>
+        bool contains_( Q const& val, size_t const * arrHash, Predicate pred, std::false_type )
+        {
+            return find_( val, arrHash, pred, []( value_type&, Q const& ) {}, std::false_type());
+        }
+
+        template <typename Q, typename Predicate>
+        bool contains_( Q const& val, size_t const * arrHash, Predicate pred, std::true_type )
+        {
+            int nResult = optimistic_lookup( val, arrHash, pred );
+            if ( nResult > 0 ) {
+                m_Stat.onFindSuccess();
+                return true;
+            }
+            if ( nResult == 0 ) {
+                m_Stat.onFindFailed();
+                return false;
+            }
+            return contains_( val, arrHash, pred, std::false_type());
+        }
+
+        template <typename Q, typename Predicate>
+        int optimistic_lookup( Q const& val, size_t const * arrHash, Predicate& pred )
+        {
+            // Optimistic lookup: the buckets are searched without locking and the result is validated
+            // by the bucket versions. While the set is being resized, both the new and the old buckets are searched.
+            // The nodes and the old tables are protected by RCU.
+            // Returns 1 if val is found, 0 if it is not found, -1 if c_nReadAttempts attempts have failed
+            for ( unsigned int nAttempt = 0; nAttempt < mutex_policy::c_nReadAttempts; ++nAttempt ) {
+                typename mutex_policy::read_lock rl;
+
+                int nResult = optimistic_find( val, arrHash, pred );
+                if ( nResult >= 0 )
+                    return nResult;
+                m_Stat.onFindOptimisticRetry();
+            }
+
+            // The caller acquires the lock. The lock must not be acquired inside RCU read-side critical section,
+            // since clear() waits for RCU grace period under the full lock
+            m_Stat.onFindOptimisticLocked();
+            return -1;
+        }
+
+        template <typename Q, typename Predicate>
+        int optimistic_find( Q const& val, size_t const * arrHash, Predicate& pred )
+        {
+            // Returns 1 if val is found, 0 if it is not found, -1 if the set has been changed while searching.
+            // Must be called in RCU read-side critical section
+            static unsigned int const c_nMaxBuckets = c_nArity * 2;
+
+            size_t const nTableVersion = m_nTableVersion.load( atomics::memory_order_acquire );
+            if ( nTableVersion & 1 )
+                return -1;
+
+            bucket_entry *  arrBucket[ c_nMaxBuckets ];
+            unsigned int    arrTable[ c_nMaxBuckets ];
+            size_t          arrHashes[ c_nMaxBuckets ];
+            uint32_t        arrVersion[ c_nMaxBuckets ];
+            unsigned int    nCount = 0;
+
+            size_t const nMask = bucket_mask();
+            size_t const nOldMask = m_nOldBucketMask.load( atomics::memory_order_relaxed );
+            for ( unsigned int i = 0; i < c_nArity; ++i ) {
+                arrTable[nCount] = i;
+                arrHashes[nCount] = arrHash[i];
+                arrBucket[nCount++] = bucket_table( i ) + ( arrHash[i] & nMask );
+
+                bucket_entry * pOld = old_bucket_table( i );
+                if ( pOld ) {
+                    arrTable[nCount] = i;
+                    arrHashes[nCount] = arrHash[i];
+                    arrBucket[nCount++] = pOld + ( arrHash[i] & nOldMask );
+                }
+            }
+
+            // The tables and the masks read are consistent
+            atomics::atomic_thread_fence( atomics::memory_order_acquire );
+            if ( m_nTableVersion.load( atomics::memory_order_relaxed ) != nTableVersion )
+                return -1;
+
+            for ( unsigned int i = 0; i < nCount; ++i ) {
+                arrVersion[i] = arrBucket[i]->read_begin();
+                if ( arrVersion[i] & 1 )
+                    return -1;
+            }
+
+            // The buckets collected are still the current ones
+            atomics::atomic_thread_fence( atomics::memory_order_acquire );
+            if ( m_nTableVersion.load( atomics::memory_order_relaxed ) != nTableVersion )
+                return -1;
+
+            node_type * pFound = nullptr;
+            for ( unsigned int i = 0; i < nCount && !pFound; ++i )
+                pFound = contains_action::optimistic_find( *arrBucket[i], arrTable[i], arrHashes[i], val, pred );
+
+            for ( unsigned int i = 0; i < nCount; ++i ) {
+                if ( !arrBucket[i]->read_validate( arrVersion[i] ))
+                    return -1;
+            }
+
+            return pFound ? 1 : 0;
+        }
+
         bool relocate( unsigned int nTable, size_t * arrGoalHash )
         {
             // arrGoalHash contains hash values for relocating element
@@ -2111,7 +2876,7 @@ namespace cds { namespace intrusive {
                         if ( bkt.size() < m_nProbesetThreshold ) {
                             position pos;
                             contains_action::find( bkt, pos, i, arrHash[i], *pVal, key_predicate() ) ; // must return false!
-                            bkt.insert_after( pos.itPrev, node_traits::to_node_ptr( pVal ));
+                            bkt.insert_after( pos.itPrev, node_traits::to_node_ptr( pVal ), arrHash[i] );
                             m_Stat.onSuccessRelocateRound();
                             return true;
                         }
@@ -2125,7 +2890,7 @@ namespace cds { namespace intrusive {
                         if ( bkt.size() < m_nProbesetSize ) {
                             position pos;
                             contains_action::find( bkt, pos, i, arrHash[i], *pVal, key_predicate() ) ; // must return false!
-                            bkt.insert_after( pos.itPrev, node_traits::to_node_ptr( pVal ));
+                            bkt.insert_after( pos.itPrev, node_traits::to_node_ptr( pVal ), arrHash[i] );
                             nTable = i;
                             memcpy( arrGoalHash, arrHash, sizeof(arrHash));
                             m_Stat.onRelocateAboveThresholdRound();
@@ -2135,7 +2900,7 @@ namespace cds { namespace intrusive {
                     }
 
                     // all probeset is full, relocating fault
-                    refBucket.insert_after( typename bucket_entry::iterator(), node_traits::to_node_ptr( pVal ));
+                    refBucket.insert_after( typename bucket_entry::iterator(), node_traits::to_node_ptr( pVal ), arrGoalHash[nTable] );
                     m_Stat.onFailedRelocate();
                     return false;
                 }
@@ -2145,7 +2910,160 @@ namespace cds { namespace intrusive {
             return false;
         }
 
+        // Step of displacement path for bucketized probeset
+        struct displacement_step {
+            unsigned int    nTable;     // table of the bucket
+            size_t          nBucket;    // bucket index
+            unsigned int    nParent;    // index of parent step in BFS queue, c_nNoParent for root
+            unsigned int    nDepth;     // count of moves from the root
+            node_type *     pNode;      // the item to be moved from parent bucket to this one
+        };
+        static CDS_CONSTEXPR unsigned int const c_nNoParent = (unsigned int) -1;
+
+        bool make_room( size_t const * arrGoalHash )
+        {
+            return make_room( arrGoalHash, std::integral_constant<bool, c_isBucketized>());
+        }
+
+        bool make_room( size_t const * /*arrGoalHash*/, std::false_type )
+        {
+            return false;
+        }
+
+        bool make_room( size_t const * arrGoalHash, std::true_type )
+        {
+            // Breadth-first search of the shortest chain of moves that frees a slot
+            // in one of the buckets of arrGoalHash. Only one bucket is locked at a time while searching.
+            // Returns true if a slot has been freed or the buckets have been changed by other thread
+            // (the caller should retry), false if no path is found (the set should be resized)
+
+            m_Stat.onDisplacementCall();
+
+            size_t const nMask = bucket_mask();
+            displacement_step queue[ c_nDisplacementQueueSize ];
+            unsigned int nTail = 0;
+            for ( unsigned int i = 0; i < c_nArity; ++i ) {
+                displacement_step& root = queue[nTail++];
+                root.nTable = i;
+                root.nBucket = arrGoalHash[i] & nMask;
+                root.nParent = c_nNoParent;
+                root.nDepth = 0;
+                root.pNode = nullptr;
+            }
+
+            node_type * arrNode[ bucket_entry::c_nCapacity ];
+            hash_array arrNodeHash[ bucket_entry::c_nCapacity ];
+
+            for ( unsigned int nHead = 0; nHead < nTail; ++nHead ) {
+                displacement_step const& cur = queue[nHead];
+                unsigned int nCount;
+                {
+                    hash_array arrLockHash;
+                    std::fill( arrLockHash, arrLockHash + c_nArity, cur.nBucket );
+                    scoped_cell_lock guard( m_MutexPolicy, arrLockHash );
+
+                    if ( nMask != bucket_mask() ) {
+                        // the set has been resized
+                        m_Stat.onDisplacementPathAborted();
+                        return true;
+                    }
+
+                    bucket_entry& refBucket = bucket( cur.nTable, cur.nBucket );
+                    nCount = refBucket.size();
+                    for ( unsigned int i = 0; i < nCount; ++i ) {
+                        arrNode[i] = refBucket.node( i );
+                        copy_hash( arrNodeHash[i], *node_traits::to_value_ptr( arrNode[i] ));
+                    }
+                }
+
+                if ( nCount < m_nProbesetSize )
+                    return apply_displacement_path( queue, nHead, nMask );
+
+                if ( cur.nDepth >= c_nDisplacementDepth )
+                    continue;
+
+                for ( unsigned int i = 0; i < nCount; ++i ) {
+                    for ( unsigned int nTable = 0; nTable < c_nArity; ++nTable ) {
+                        if ( nTable == cur.nTable )
+                            continue;
+                        size_t const nBucket = arrNodeHash[i][nTable] & nMask;
+                        if ( cur.nParent != c_nNoParent && queue[cur.nParent].nTable == nTable && queue[cur.nParent].nBucket == nBucket )
+                            continue;   // do not move the item back to the bucket we came from
+                        if ( nTail == c_nDisplacementQueueSize )
+                            break;
+
+                        displacement_step& step = queue[nTail++];
+                        step.nTable = nTable;
+                        step.nBucket = nBucket;
+                        step.nParent = nHead;
+                        step.nDepth = cur.nDepth + 1;
+                        step.pNode = arrNode[i];
+                    }
+                }
+            }
+
+            m_Stat.onDisplacementPathFailed();
+            return false;
+        }
+
+        bool apply_displacement_path( displacement_step const * queue, unsigned int nStep, size_t nMask )
+        {
+            // The items are moved from the end of the path (the bucket with free slot) to the root.
+            // Each move locks the source and the target buckets and checks that
+            // the path is still valid; otherwise, the path is abandoned
+            for ( ; queue[nStep].nParent != c_nNoParent; nStep = queue[nStep].nParent ) {
+                displacement_step const& to = queue[nStep];
+                displacement_step const& from = queue[to.nParent];
+
+                hash_array arrLockHash;
+                std::fill( arrLockHash, arrLockHash + c_nArity, from.nBucket );
+                arrLockHash[to.nTable] = to.nBucket;
+                scoped_cell_lock guard( m_MutexPolicy, arrLockHash );
+
+                if ( nMask != bucket_mask() ) {
+                    m_Stat.onDisplacementPathAborted();
+                    return true;
+                }
+
+                bucket_entry& refFrom = bucket( from.nTable, from.nBucket );
+                bucket_entry& refTo = bucket( to.nTable, to.nBucket );
+                if ( refTo.size() >= m_nProbesetSize ) {
+                    m_Stat.onDisplacementPathAborted();
+                    return true;
+                }
+
+                bucket_iterator it = refFrom.begin();
+                for ( bucket_iterator itEnd = refFrom.end(); it != itEnd && &*it != to.pNode; ++it );
+                if ( it == refFrom.end() ) {
+                    m_Stat.onDisplacementPathAborted();
+                    return true;
+                }
+
+                // the node may be reinserted with other key while we have been searching the path
+                hash_array arrHash;
+                copy_hash( arrHash, *node_traits::to_value_ptr( to.pNode ));
+                if ( ( arrHash[to.nTable] & nMask ) != to.nBucket ) {
+                    m_Stat.onDisplacementPathAborted();
+                    return true;
+                }
+
+                // the item is inserted into the target before it is removed from the source,
+                // so an optimistic reader cannot miss it
+                refTo.insert_after( bucket_iterator(), to.pNode, arrHash[to.nTable] );
+                refFrom.remove( bucket_iterator(), it );
+                m_Stat.onDisplacementMove();
+            }
+
+            m_Stat.onDisplacementPathFound();
+            return true;
+        }
+
         void resize()
+        {
+            resize( std::integral_constant<bool, c_isBucketized>());
+        }
+
+        void resize( std::false_type )
         {
             m_Stat.onResizeCall();
 
@@ -2162,7 +3080,8 @@ namespace cds { namespace intrusive {
                 size_t nCapacity = nOldCapacity * 2;
 
                 m_MutexPolicy.resize( nCapacity );
-                memcpy( pOldTable, m_BucketTable, sizeof(pOldTable));
+                for ( unsigned int i = 0; i < c_nArity; ++i )
+                    pOldTable[i] = bucket_table( i );
                 allocate_bucket_tables( nCapacity );
 
                 typedef typename bucket_entry::iterator bucket_iterator;
@@ -2184,7 +3103,7 @@ namespace cds { namespace intrusive {
                             for ( unsigned int i = 0; i < c_nArity; ++i ) {
                                 bucket_entry& refBucket = bucket( i, arrHash[i] );
                                 if ( refBucket.size() < m_nProbesetThreshold ) {
-                                    refBucket.insert_after( arrPos[i].itPrev, &*it );
+                                    refBucket.insert_after( arrPos[i].itPrev, &*it, arrHash[i] );
                                     m_Stat.onResizeSuccessMove();
                                     goto do_next;
                                 }
@@ -2193,7 +3112,7 @@ namespace cds { namespace intrusive {
                             for ( unsigned int i = 0; i < c_nArity; ++i ) {
                                 bucket_entry& refBucket = bucket( i, arrHash[i] );
                                 if ( refBucket.size() < m_nProbesetSize ) {
-                                    refBucket.insert_after( arrPos[i].itPrev, &*it );
+                                    refBucket.insert_after( arrPos[i].itPrev, &*it, arrHash[i] );
                                     assert( refBucket.size() > 1 );
                                     copy_hash( arrHash, *node_traits::to_value_ptr( *refBucket.begin()) );
                                     m_Stat.onResizeRelocateCall();
@@ -2209,14 +3128,191 @@ namespace cds { namespace intrusive {
             free_bucket_tables( pOldTable, nOldCapacity );
         }
 
+        void resize( std::true_type )
+        {
+            // Incremental resizing of bucketized probeset.
+            // The doubled tables are published under short full lock, the old tables are kept for migration.
+            // The old bucket j of table i is split into new buckets j and j + nOldCapacity of the same table,
+            // so the migration cannot fail. The resizing thread migrates the old buckets one by one
+            // under the cell lock, the other threads are not blocked and migrate the buckets they touch
+            // by themselves, see bucket().
+            m_Stat.onResizeCall();
+
+            size_t const nOldCapacity = bucket_count();
+            bool bResizing = false;
+            if ( !m_bResizing.compare_exchange_strong( bResizing, true, atomics::memory_order_acquire, atomics::memory_order_relaxed )) {
+                // other thread is resizing the set
+                m_Stat.onFalseResizeCall();
+                cds::OS::backoff();
+                return;
+            }
+
+            if ( nOldCapacity != bucket_count() ) {
+                m_bResizing.store( false, atomics::memory_order_release );
+                m_Stat.onFalseResizeCall();
+                return;
+            }
+
+            size_t const nCapacity = nOldCapacity * 2;
+            bucket_entry * pTable[ c_nArity ];
+            allocate_bucket_tables( pTable, nCapacity );
+
+            {
+                scoped_resize_lock guard( m_MutexPolicy );
+
+                // The lock array must not be greater than the old table:
+                // the cell lock of an old bucket covers the both new buckets
+                if ( m_MutexPolicy.lock_count() < nOldCapacity )
+                    m_MutexPolicy.resize( nOldCapacity );
+
+                begin_table_update();
+                for ( unsigned int i = 0; i < c_nArity; ++i ) {
+                    m_OldBucketTable[i].store( bucket_table( i ), atomics::memory_order_relaxed );
+                    m_BucketTable[i].store( pTable[i], atomics::memory_order_relaxed );
+                }
+                m_nOldBucketMask.store( nOldCapacity - 1, atomics::memory_order_relaxed );
+                m_nBucketMask.store( nCapacity - 1, atomics::memory_order_relaxed );
+                end_table_update();
+            }
+
+            for ( size_t nBucket = 0; nBucket < nOldCapacity; ++nBucket ) {
+                hash_array arrLockHash;
+                std::fill( arrLockHash, arrLockHash + c_nArity, nBucket );
+                scoped_cell_lock guard( m_MutexPolicy, arrLockHash );
+
+                for ( unsigned int i = 0; i < c_nArity; ++i )
+                    migrate_bucket( i, nBucket );
+            }
+
+            {
+                scoped_full_lock guard( m_MutexPolicy );
+
+                begin_table_update();
+                for ( unsigned int i = 0; i < c_nArity; ++i ) {
+                    pTable[i] = old_bucket_table( i );
+                    m_OldBucketTable[i].store( nullptr, atomics::memory_order_relaxed );
+                }
+                end_table_update();
+            }
+
+            free_old_bucket_tables( pTable, nOldCapacity, optimistic_read());
+            m_bResizing.store( false, atomics::memory_order_release );
+        }
+
+        // Write side of the table version, must be called under the full lock
+        void begin_table_update()
+        {
+            m_nTableVersion.store( m_nTableVersion.load( atomics::memory_order_relaxed ) + 1, atomics::memory_order_relaxed );
+            atomics::atomic_thread_fence( atomics::memory_order_release );
+        }
+
+        void end_table_update()
+        {
+            m_nTableVersion.store( m_nTableVersion.load( atomics::memory_order_relaxed ) + 1, atomics::memory_order_release );
+        }
+
+        struct retired_bucket_tables {
+            bucket_entry *  pTable[ c_nArity ];
+            size_t          nCapacity;
+        };
+        typedef cds::details::Allocator< retired_bucket_tables, allocator > retired_tables_allocator;
+
+        static void free_retired_bucket_tables( retired_bucket_tables * p )
+        {
+            free_bucket_tables( p->pTable, p->nCapacity );
+            retired_tables_allocator().Delete( p );
+        }
+
+        void free_old_bucket_tables( bucket_entry ** pTable, size_t nCapacity, std::false_type )
+        {
+            free_bucket_tables( pTable, nCapacity );
+        }
+
+        void free_old_bucket_tables( bucket_entry ** pTable, size_t nCapacity, std::true_type )
+        {
+            // The old tables are empty, but an optimistic reader can still access them
+            retired_bucket_tables * p = retired_tables_allocator().New();
+            memcpy( p->pTable, pTable, sizeof( p->pTable ));
+            p->nCapacity = nCapacity;
+            m_MutexPolicy.retire( p, free_retired_bucket_tables );
+        }
+
+        template <typename Disposer>
+        static void clear_table( bucket_entry * pEntry, size_t nCapacity, Disposer& oDisposer )
+        {
+            if ( pEntry ) {
+                for ( bucket_entry * pEnd = pEntry + nCapacity; pEntry != pEnd ; ++pEntry ) {
+                    pEntry->clear( [&oDisposer]( node_type * pNode ){ oDisposer( node_traits::to_value_ptr( pNode )) ; } );
+                }
+            }
+        }
+
+        template <typename Func>
+        void for_each_bucket( Func f )
+        {
+            for ( unsigned int i = 0; i < c_nArity; ++i ) {
+                bucket_entry * pTable = bucket_table( i );
+                std::for_each( pTable, pTable + bucket_count(), f );
+                if ( old_bucket_table( i ) ) {
+                    pTable = old_bucket_table( i );
+                    std::for_each( pTable, pTable + m_nOldBucketMask.load( atomics::memory_order_relaxed ) + 1, f );
+                }
+            }
+        }
+
+        void clear_tables( std::false_type )
+        {}
+        void end_clear_tables( std::false_type )
+        {}
+
+        void clear_tables( std::true_type )
+        {
+            // The full lock is held. Optimistic readers are excluded by odd bucket versions,
+            // then RCU grace period is waited for the readers that have found an item before
+            for_each_bucket( []( bucket_entry& b ) { b.write_begin(); } );
+            m_MutexPolicy.synchronize();
+        }
+
+        void end_clear_tables( std::true_type )
+        {
+            for_each_bucket( []( bucket_entry& b ) { b.write_end(); } );
+        }
+
+        // Disposes the item erased; with cuckoo::optimistic_striping the item is retired
+        // since an optimistic reader can still access it
+        template <typename Disposer>
+        void dispose_erased( value_type * pVal )
+        {
+            dispose_erased<Disposer>( pVal, optimistic_read());
+        }
+
+        template <typename Disposer>
+        void dispose_erased( value_type * pVal, std::false_type )
+        {
+            Disposer()( pVal );
+        }
+
+        template <typename Disposer>
+        void dispose_erased( value_type * pVal, std::true_type )
+        {
+            m_MutexPolicy.template retire<Disposer>( pVal );
+        }
+
         CDS_CONSTEXPR static unsigned int calc_probeset_size( unsigned int nProbesetSize ) CDS_NOEXCEPT
         {
-            return std::is_same< probeset_class, cuckoo::vector_probeset_class >::value
+            return ( std::is_same< probeset_class, cuckoo::vector_probeset_class >::value || c_isBucketized )
                 ? node_type::probeset_size
                 : (nProbesetSize
                     ? nProbesetSize
                     : ( node_type::probeset_size ? node_type::probeset_size : c_nDefaultProbesetSize ));
         }
+
+        CDS_CONSTEXPR static unsigned int calc_probeset_threshold( unsigned int nProbesetSize, unsigned int nProbesetThreshold ) CDS_NOEXCEPT
+        {
+            return c_isBucketized
+                ? nProbesetSize
+                : ( nProbesetThreshold ? nProbesetThreshold : nProbesetSize - 1 );
+        }
         //@endcond
 
     public:
@@ -2226,13 +3322,16 @@ namespace cds { namespace intrusive {
 
             Probe set size:
             - \p c_nDefaultProbesetSize if \p probeset_type is \p cuckoo::list
-            - \p Capacity if \p probeset_type is <tt> cuckoo::vector<Capacity> </tt>
+            - \p Capacity if \p probeset_type is <tt> cuckoo::vector<Capacity> </tt> or <tt> cuckoo::bucketized<Capacity> </tt>
 
-            Probe set threshold = probe set size - 1
+            Probe set threshold = probe set size - 1; for <tt> cuckoo::bucketized<Capacity> </tt>
+            the threshold is equal to \p Capacity
         */
         CuckooSet()
-            : m_nProbesetSize( calc_probeset_size(0) )
-            , m_nProbesetThreshold( m_nProbesetSize - 1 )
+            : m_bResizing( false )
+            , m_nTableVersion( 0 )
+            , m_nProbesetSize( calc_probeset_size(0) )
+            , m_nProbesetThreshold( calc_probeset_threshold( m_nProbesetSize, 0 ))
             , m_MutexPolicy( c_nDefaultInitialSize )
         {
             check_common_constraints();
@@ -2245,14 +3344,18 @@ namespace cds { namespace intrusive {
         /**
             If probe set type is <tt> cuckoo::vector<Capacity> </tt> vector
             then \p nProbesetSize is ignored since it should be equal to vector's \p Capacity.
+            For <tt> cuckoo::bucketized<Capacity> </tt> both \p nProbesetSize and \p nProbesetThreshold are ignored.
         */
         CuckooSet(
             size_t nInitialSize                 ///< Initial set size; if 0 - use default initial size \ref c_nDefaultInitialSize
             , unsigned int nProbesetSize        ///< probe set size
             , unsigned int nProbesetThreshold = 0   ///< probe set threshold, <tt>nProbesetThreshold < nProbesetSize</tt>. If 0, nProbesetThreshold = nProbesetSize - 1
         )
-            : m_nProbesetSize( calc_probeset_size(nProbesetSize) )
-            , m_nProbesetThreshold( nProbesetThreshold ? nProbesetThreshold : m_nProbesetSize - 1 )
+
+            : m_bResizing( false )
+            , m_nTableVersion( 0 )
+            , m_nProbesetSize( calc_probeset_size(nProbesetSize) )
+            , m_nProbesetThreshold( calc_probeset_threshold( m_nProbesetSize, nProbesetThreshold ))
             , m_MutexPolicy( cds::beans::ceil2(nInitialSize ? nInitialSize : c_nDefaultInitialSize ))
         {
             check_common_constraints();
@@ -2268,8 +3371,11 @@ namespace cds { namespace intrusive {
         CuckooSet(
             hash_tuple_type const& h    ///< hash functor tuple of type <tt>std::tuple<H1, H2, ... Hn></tt> where <tt> n == \ref c_nArity </tt>
         )
-            : m_nProbesetSize( calc_probeset_size(0) )
-            , m_nProbesetThreshold( m_nProbesetSize -1 )
+
+            : m_bResizing( false )
+            , m_nTableVersion( 0 )
+            , m_nProbesetSize( calc_probeset_size(0) )
+            , m_nProbesetThreshold( calc_probeset_threshold( m_nProbesetSize, 0 ))
             , m_Hash( h )
             , m_MutexPolicy( c_nDefaultInitialSize )
         {
@@ -2290,8 +3396,11 @@ namespace cds { namespace intrusive {
             , unsigned int nProbesetThreshold   ///< probe set threshold, <tt>nProbesetThreshold < nProbesetSize</tt>. If 0, nProbesetThreshold = nProbesetSize - 1
             , hash_tuple_type const& h    ///< hash functor tuple of type <tt>std::tuple<H1, H2, ... Hn></tt> where <tt> n == \ref c_nArity </tt>
         )
-            : m_nProbesetSize( calc_probeset_size(nProbesetSize) )
-            , m_nProbesetThreshold( nProbesetThreshold ? nProbesetThreshold : m_nProbesetSize - 1)
+
+            : m_bResizing( false )
+            , m_nTableVersion( 0 )
+            , m_nProbesetSize( calc_probeset_size(nProbesetSize) )
+            , m_nProbesetThreshold( calc_probeset_threshold( m_nProbesetSize, nProbesetThreshold ))
             , m_Hash( h )
             , m_MutexPolicy( cds::beans::ceil2(nInitialSize ? nInitialSize : c_nDefaultInitialSize ))
         {
@@ -2308,8 +3417,11 @@ namespace cds { namespace intrusive {
         CuckooSet(
             hash_tuple_type&& h     ///< hash functor tuple of type <tt>std::tuple<H1, H2, ... Hn></tt> where <tt> n == \ref c_nArity </tt>
         )
-            : m_nProbesetSize( calc_probeset_size(0) )
-            , m_nProbesetThreshold( m_nProbesetSize / 2 )
+
+            : m_bResizing( false )
+            , m_nTableVersion( 0 )
+            , m_nProbesetSize( calc_probeset_size(0) )
+            , m_nProbesetThreshold( calc_probeset_threshold( m_nProbesetSize, m_nProbesetSize / 2 ))
             , m_Hash( std::forward<hash_tuple_type>(h) )
             , m_MutexPolicy( c_nDefaultInitialSize )
         {
@@ -2330,8 +3442,11 @@ namespace cds { namespace intrusive {
             , unsigned int nProbesetThreshold   ///< probe set threshold, <tt>nProbesetThreshold < nProbesetSize</tt>. If 0, nProbesetThreshold = nProbesetSize - 1
             , hash_tuple_type&& h    ///< hash functor tuple of type <tt>std::tuple<H1, H2, ... Hn></tt> where <tt> n == \ref c_nArity </tt>
         )
-            : m_nProbesetSize( calc_probeset_size(nProbesetSize) )
-            , m_nProbesetThreshold( nProbesetThreshold ? nProbesetThreshold : m_nProbesetSize - 1)
+
+            : m_bResizing( false )
+            , m_nTableVersion( 0 )
+            , m_nProbesetSize( calc_probeset_size(nProbesetSize) )
+            , m_nProbesetThreshold( calc_probeset_threshold( m_nProbesetSize, nProbesetThreshold ))
             , m_Hash( std::forward<hash_tuple_type>(h) )
             , m_MutexPolicy( cds::beans::ceil2(nInitialSize ? nInitialSize : c_nDefaultInitialSize ))
         {
@@ -2398,7 +3513,7 @@ namespace cds { namespace intrusive {
                     for ( unsigned int i = 0; i < c_nArity; ++i ) {
                         bucket_entry& refBucket = bucket( i, arrHash[i] );
                         if ( refBucket.size() < m_nProbesetThreshold ) {
-                            refBucket.insert_after( arrPos[i].itPrev, pNode );
+                            refBucket.insert_after( arrPos[i].itPrev, pNode, arrHash[i] );
                             f( val );
                             ++m_ItemCounter;
                             m_Stat.onInsertSuccess();
@@ -2409,7 +3524,7 @@ namespace cds { namespace intrusive {
                     for ( unsigned int i = 0; i < c_nArity; ++i ) {
                         bucket_entry& refBucket = bucket( i, arrHash[i] );
                         if ( refBucket.size() < m_nProbesetSize ) {
-                            refBucket.insert_after( arrPos[i].itPrev, pNode );
+                            refBucket.insert_after( arrPos[i].itPrev, pNode, arrHash[i] );
                             f( val );
                             ++m_ItemCounter;
                             nGoalTable = i;
@@ -2420,6 +3535,9 @@ namespace cds { namespace intrusive {
                     }
                 }
 
+                if ( c_isBucketized && make_room( arrHash ))
+                    continue;
+
                 m_Stat.onInsertResize();
                 resize();
             }
@@ -2492,7 +3610,7 @@ namespace cds { namespace intrusive {
                     for ( unsigned int i = 0; i < c_nArity; ++i ) {
                         bucket_entry& refBucket = bucket( i, arrHash[i] );
                         if ( refBucket.size() < m_nProbesetThreshold ) {
-                            refBucket.insert_after( arrPos[i].itPrev, pNode );
+                            refBucket.insert_after( arrPos[i].itPrev, pNode, arrHash[i] );
                             func( true, val, val );
                             ++m_ItemCounter;
                             m_Stat.onUpdateSuccess();
@@ -2503,7 +3621,7 @@ namespace cds { namespace intrusive {
                     for ( unsigned int i = 0; i < c_nArity; ++i ) {
                         bucket_entry& refBucket = bucket( i, arrHash[i] );
                         if ( refBucket.size() < m_nProbesetSize ) {
-                            refBucket.insert_after( arrPos[i].itPrev, pNode );
+                            refBucket.insert_after( arrPos[i].itPrev, pNode, arrHash[i] );
                             func( true, val, val );
                             ++m_ItemCounter;
                             nGoalTable = i;
@@ -2514,6 +3632,9 @@ namespace cds { namespace intrusive {
                     }
                 }
 
+                if ( c_isBucketized && make_room( arrHash ))
+                    continue;
+
                 m_Stat.onUpdateResize();
                 resize();
             }
@@ -2546,6 +3667,9 @@ namespace cds { namespace intrusive {
             unlink is successful iif <tt>&val == &item</tt>)
 
             The function returns \p true if success and \p false otherwise.
+
+            With \p cuckoo::optimistic_striping the item unlinked can still be accessed by concurrent \p find(),
+            so it can be freed or reused only after RCU grace period, for example, via \p RCU::retire_ptr().
         */
         bool unlink( value_type& val )
         {
@@ -2577,6 +3701,9 @@ namespace cds { namespace intrusive {
             If the item with key equal to \p val is not found the function return \p nullptr.
 
             Note the hash functor should accept a parameter of type \p Q that can be not the same as \p value_type.
+
+            With \p cuckoo::optimistic_striping the item erased can be freed or reused only after RCU grace period,
+            see \p unlink().
         */
         template <typename Q>
         value_type * erase( Q const& val )
@@ -2701,7 +3828,7 @@ namespace cds { namespace intrusive {
         template <typename Q>
         bool contains( Q const& key )
         {
-            return find( key, [](value_type&, Q const& ) {} );
+            return contains_( key, key_predicate());
         }
         //@cond
         template <typename Q>
@@ -2722,7 +3849,7 @@ namespace cds { namespace intrusive {
         bool contains( Q const& key, Predicate pred )
         {
             CDS_UNUSED( pred );
-            return find_with( key, typename predicate_wrapper<Predicate>::type(), [](value_type& , Q const& ) {} );
+            return contains_( key, typename predicate_wrapper<Predicate>::type());
         }
         //@cond
         template <typename Q, typename Predicate>
@@ -2761,13 +3888,12 @@ namespace cds { namespace intrusive {
             // locks entire array
             scoped_full_lock sl( m_MutexPolicy );
 
+            clear_tables( optimistic_read());
             for ( unsigned int i = 0; i < c_nArity; ++i ) {
-                bucket_entry * pEntry = m_BucketTable[i];
-                bucket_entry * pEnd = pEntry + m_nBucketMask + 1;
-                for ( ; pEntry != pEnd ; ++pEntry ) {
-                    pEntry->clear( [&oDisposer]( node_type * pNode ){ oDisposer( node_traits::to_value_ptr( pNode )) ; } );
-                }
+                clear_table( bucket_table( i ), bucket_count(), oDisposer );
+                clear_table( old_bucket_table( i ), m_nOldBucketMask.load( atomics::memory_order_relaxed ) + 1, oDisposer );
             }
+            end_clear_tables( optimistic_read());
             m_ItemCounter.reset();
         }
 
@@ -2792,7 +3918,7 @@ namespace cds { namespace intrusive {
         */
         size_t bucket_count() const
         {
-            return m_nBucketMask + 1;
+            return bucket_mask() + 1;
         }
 
         /// Returns lock array size
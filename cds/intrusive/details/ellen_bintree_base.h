@@ -389,6 +389,8 @@ namespace cds { namespace intrusive {
             event_counter   m_nExtractMaxFailed     ; ///< Count of failed call of \p extract_max
             event_counter   m_nExtractMaxRetries    ; ///< Count of unsuccessful retries inside \p extract_max
             event_counter   m_nSearchRetry          ; ///< How many times the deleting node was encountered while searching
+            event_counter   m_nRangeScan            ; ///< Count of \p for_each() and \p for_each_in_range() calls (RCU-based tree only)
+            event_counter   m_nRangeReseek          ; ///< How many times the range scan has re-searched its position from the root
 
             event_counter   m_nHelpInsert           ; ///< The number of insert help from the other thread
             event_counter   m_nHelpDelete           ; ///< The number of delete help from the other thread
@@ -419,6 +421,8 @@ namespace cds { namespace intrusive {
             void    onFindSuccess()                 { ++m_nFindSuccess          ; }
             void    onFindFailed()                  { ++m_nFindFailed           ; }
             void    onSearchRetry()                 { ++m_nSearchRetry          ; }
+            void    onRangeScan()                   { ++m_nRangeScan            ; }
+            void    onRangeReseek()                 { ++m_nRangeReseek          ; }
             void    onHelpInsert()                  { ++m_nHelpInsert           ; }
             void    onHelpDelete()                  { ++m_nHelpDelete           ; }
             void    onHelpMark()                    { ++m_nHelpMark             ; }
@@ -452,6 +456,8 @@ namespace cds { namespace intrusive {
             void    onFindSuccess()                 const {}
             void    onFindFailed()                  const {}
             void    onSearchRetry()                 const {}
+            void    onRangeScan()                   const {}
+            void    onRangeReseek()                 const {}
             void    onHelpInsert()                  const {}
             void    onHelpDelete()                  const {}
             void    onHelpMark()                    const {}
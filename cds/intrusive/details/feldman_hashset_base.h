@@ -38,6 +38,7 @@
 #include <cds/opt/compare.h>
 #include <cds/algo/atomic.h>
 #include <cds/algo/split_bitstring.h>
+#include <cds/algo/bitop.h>
 #include <cds/details/marked_ptr.h>
 #include <cds/urcu/options.h>
 
@@ -61,6 +62,59 @@ namespace cds { namespace intrusive {
             //@endcond
         };
 
+        /// Dense array node layout (the default)
+        /**
+            Each array node contains all <tt>2**array_bits</tt> cells, a cell is accessed directly by the index.
+        */
+        struct dense_layout {};
+
+        /// Compressed array node layout
+        /**
+            An array node below the head node (HAMT-like) contains only occupied cells:
+            the cell block consists of the bitmap of present cells and of the packed cell array,
+            the position of the cell in the array is the count of bits below the cell index in the bitmap.
+            When a cell is inserted into the absent position the new cell block is built by copy-on-write
+            and installed by CAS. The head node is always dense.
+
+            The layout saves the memory for sparse trees when most of array nodes contain two or three items,
+            that is typical for huge sets. The cost is one more indirection and the copying when a new cell is added.
+            The obsolete cell block is retired through the garbage collector of the set, so a thread accessing a cell
+            protects the cell block by one more guard (the set based on HP-like GC) or by RCU lock.
+            To bound the copying the cell block is switched to the full size when the half of cells is occupied.
+
+            The layout requires <tt>array_bits <= 6</tt> (64-bit bitmap), \p array_bits passed to the set constructor is
+            reduced if needed.
+        */
+        struct compressed_layout {};
+
+        /// Array node layout option
+        /**
+            @copydetails traits::node_layout
+        */
+        template <typename Layout>
+        struct node_layout {
+            //@cond
+            template <typename Base> struct pack: public Base
+            {
+                typedef Layout node_layout;
+            };
+            //@endcond
+        };
+
+        /// [value-option] Head node growth option
+        /**
+            @copydetails traits::head_growth
+        */
+        template <bool Enable>
+        struct head_growth {
+            //@cond
+            template <typename Base> struct pack: public Base
+            {
+                enum { head_growth = Enable };
+            };
+            //@endcond
+        };
+
         /// \p FeldmanHashSet internal statistics
         template <typename EventCounter = cds::atomicity::event_counter>
         struct stat {
@@ -83,6 +137,11 @@ namespace cds { namespace intrusive {
             event_counter   m_nExpandNodeFailed;  ///< Number of failed attempts converting data node to array node
             event_counter   m_nSlotChanged;     ///< Number of array node slot changing by other thread during an operation
             event_counter   m_nSlotConverting;  ///< Number of events when we encounter a slot while it is converting to array node
+            event_counter   m_nSlotMoved;       ///< Number of events when we encounter a slot moved to the expanded head node
+            event_counter   m_nHeadExpanded;    ///< Number of head node expansions
+            event_counter   m_nHeadRetired;     ///< Number of obsolete head nodes retired through GC
+            event_counter   m_nCellBlockGrown;  ///< Number of cell block growing of \p compressed_layout array node
+            event_counter   m_nCellBlockGrowFailed; ///< Number of failed attempts to grow the cell block of \p compressed_layout array node
 
             event_counter   m_nArrayNodeCount;  ///< Number of array nodes
             event_counter   m_nHeight;          ///< Current height of the tree
@@ -105,6 +164,11 @@ namespace cds { namespace intrusive {
             void onExpandNodeFailed()           { ++m_nExpandNodeFailed;    }
             void onSlotChanged()                { ++m_nSlotChanged;         }
             void onSlotConverting()             { ++m_nSlotConverting;      }
+            void onSlotMoved()                  { ++m_nSlotMoved;           }
+            void onHeadExpanded()               { ++m_nHeadExpanded;        }
+            void onHeadRetired()                { ++m_nHeadRetired;         }
+            void onCellBlockGrown()             { ++m_nCellBlockGrown;      }
+            void onCellBlockGrowFailed()        { ++m_nCellBlockGrowFailed; }
             void onArrayNodeCreated()           { ++m_nArrayNodeCount;      }
             void height( size_t h )             { if (m_nHeight < h ) m_nHeight = h; }
             //@endcond
@@ -130,6 +194,11 @@ namespace cds { namespace intrusive {
             void onExpandNodeFailed()           const {}
             void onSlotChanged()                const {}
             void onSlotConverting()             const {}
+            void onSlotMoved()                  const {}
+            void onHeadExpanded()               const {}
+            void onHeadRetired()                const {}
+            void onCellBlockGrown()             const {}
+            void onCellBlockGrowFailed()        const {}
             void onArrayNodeCreated()           const {}
             void height(size_t)                 const {}
             //@endcond
@@ -197,6 +266,25 @@ namespace cds { namespace intrusive {
             */
             typedef CDS_DEFAULT_ALLOCATOR node_allocator;
 
+            /// Array node layout
+            /**
+                Can be \p feldman_hashset::dense_layout (the default) or \p feldman_hashset::compressed_layout
+                that allocates only occupied cells of array nodes.
+            */
+            typedef dense_layout node_layout;
+
+            /// Enables online growth of the head node
+            /**
+                If \p true, the head node grows up to <tt>2**max_head_bits</tt> cells where \p max_head_bits
+                is the argument of the set constructor. The growth costs each operation the guard of the current head,
+                the check for obsolete heads and three more hazard pointers for the HP-based set
+                (see \p FeldmanHashSet::c_nHazardPtrCount).
+                If \p false, \p max_head_bits is ignored, the head node is fixed and it is not guarded.
+
+                Default is \p false.
+            */
+            static const bool head_growth = false;
+
             /// C++ memory ordering model
             /**
                 Can be \p opt::v::relaxed_ordering (relaxed memory model, the default)
@@ -228,6 +316,10 @@ namespace cds { namespace intrusive {
                 @copydetails traits::hash_accessor
             - \p opt::node_allocator - array node allocator.
                 @copydetails traits::node_allocator
+            - \p feldman_hashset::node_layout - array node layout, \p feldman_hashset::dense_layout (the default)
+                or \p feldman_hashset::compressed_layout.
+            - \p feldman_hashset::head_growth - enables online growth of the head node, default is \p false.
+                @copydetails traits::head_growth
             - \p opt::compare - hash comparison functor. No default functor is provided.
                 If the option is not specified, the \p opt::less is used.
             - \p opt::less - specifies binary predicate used for hash comparison.
@@ -288,12 +380,15 @@ namespace cds { namespace intrusive {
             size_t array_cell_count;    ///< The number of array cells in all array node at this level
             size_t empty_cell_count;    ///< The number of empty cells in all array node at this level
 
+            size_t allocated_cell_count; ///< The number of allocated cells at this level, less than <tt>array_node_count * node_capacity</tt> for \p compressed_layout
+
             //@cond
             level_statistics()
                 : array_node_count(0)
                 , data_cell_count(0)
                 , array_cell_count(0)
                 , empty_cell_count(0)
+                , allocated_cell_count(0)
             {}
             //@endcond
         };
@@ -308,8 +403,9 @@ namespace cds { namespace intrusive {
                 size_t  head_node_size_log; // log2( head_node_size )
                 size_t  array_node_size;    // power-of-two
                 size_t  array_node_size_log;// log2( array_node_size )
+                size_t  max_head_node_size_log; // log2 of max size of head node, the head grows by array_node_size_log
 
-                static metrics make(size_t head_bits, size_t array_bits, size_t hash_size )
+                static metrics make(size_t head_bits, size_t array_bits, size_t hash_size, size_t max_head_bits = 0 )
                 {
                     size_t const hash_bits = hash_size * 8;
 
@@ -324,20 +420,130 @@ namespace cds { namespace intrusive {
 
                     assert((hash_bits - head_bits) % array_bits == 0);
 
+                    if ( max_head_bits > hash_bits )
+                        max_head_bits = hash_bits;
+                    if ( max_head_bits < head_bits )
+                        max_head_bits = head_bits;
+                    else
+                        max_head_bits -= (max_head_bits - head_bits) % array_bits;
+
                     metrics m;
                     m.head_node_size_log = head_bits;
                     m.head_node_size = size_t(1) << head_bits;
                     m.array_node_size_log = array_bits;
                     m.array_node_size = size_t(1) << array_bits;
+                    m.max_head_node_size_log = max_head_bits;
                     return m;
                 }
             };
 
+            // Cell block guard of compressed array node for the set based on HP-like GC:
+            // the cell block is protected by the guard, the obsolete block is retired through GC.
+            // The head node is protected and retired in the same way
+            template <class GC>
+            struct guarded_cell_block
+            {
+                typename GC::Guard guard;
+
+                template <typename BlockPtr, typename Func>
+                BlockPtr protect( atomics::atomic<BlockPtr> const& block, Func f )
+                {
+                    return guard.protect( block, f );
+                }
+
+                // The caller must check that p is not retired after the assignment
+                template <typename T>
+                T * assign( T * p )
+                {
+                    return guard.assign( p );
+                }
+
+                void copy( guarded_cell_block const& src )
+                {
+                    guard.copy( src.guard );
+                }
+
+                static CDS_CONSTEXPR bool can_retire()
+                {
+                    return true;
+                }
+
+                template <typename Block>
+                static void retire( Block * p, void (* pFunc)( Block * ))
+                {
+                    GC::retire( p, pFunc );
+                }
+            };
+
+            // Cell block guard of compressed array node for the set based on RCU:
+            // the cell block is accessed under RCU lock, the obsolete block is retired outside of RCU lock.
+            // The head node is accessed and retired in the same way
+            template <class RCU>
+            struct rcu_cell_block
+            {
+                template <typename BlockPtr, typename Func>
+                BlockPtr protect( atomics::atomic<BlockPtr> const& block, Func )
+                {
+                    return block.load( atomics::memory_order_acquire );
+                }
+
+                template <typename T>
+                T * assign( T * p )
+                {
+                    return p;
+                }
+
+                static bool can_retire()
+                {
+                    return !RCU::is_locked();
+                }
+
+                template <typename Block>
+                static void retire( Block * p, void (* pFunc)( Block * ))
+                {
+                    RCU::retire_ptr( p, pFunc );
+                }
+            };
+
+            // Dense array node has no cell block
+            struct no_cell_block
+            {};
+
+            // The head node of the set without head growth is never changed, so it is not guarded
+            struct unguarded_head
+            {
+                template <typename T, typename Func>
+                T protect( atomics::atomic<T> const& p, Func )
+                {
+                    return p.load( atomics::memory_order_acquire );
+                }
+
+                template <typename T>
+                T * assign( T * p )
+                {
+                    return p;
+                }
+
+                void copy( unguarded_head const& )
+                {}
+
+                static CDS_CONSTEXPR bool can_retire()
+                {
+                    return false;
+                }
+
+                template <typename T>
+                static void retire( T * /*p*/, void (*)( T * ))
+                {
+                    assert( false );
+                }
+            };
+
         } // namespace details
         //@endcond
 
         //@cond
-        template <typename T, typename Traits>
+        template <typename T, typename Traits, typename BlockGuard>
         class multilevel_array
         {
         public:
@@ -347,6 +553,19 @@ namespace cds { namespace intrusive {
             typedef typename traits::memory_model   memory_model;
             typedef typename traits::back_off       back_off;       ///< Backoff strategy
             typedef typename traits::stat           stat;           ///< Internal statistics type
+            typedef typename traits::node_layout    node_layout;    ///< Array node layout
+
+            static CDS_CONSTEXPR bool const c_bCompressed = std::is_same< node_layout, feldman_hashset::compressed_layout >::value;
+            static_assert( c_bCompressed || std::is_same< node_layout, feldman_hashset::dense_layout >::value, "node_layout must be dense_layout or compressed_layout" );
+
+            // The guard of the cell block of compressed array node, see feldman_hashset::details::guarded_cell_block
+            typedef typename std::conditional< c_bCompressed, BlockGuard, feldman_hashset::details::no_cell_block >::type block_guard;
+
+            static CDS_CONSTEXPR bool const c_bHeadGrowth = traits::head_growth; ///< the head node grows online
+
+            // The guard of the head node, the head is retired through the same GC as the cell block.
+            // The fixed head is not guarded
+            typedef typename std::conditional< c_bHeadGrowth, BlockGuard, feldman_hashset::details::unguarded_head >::type head_guard;
 
             typedef typename traits::hash_accessor hash_accessor;
             static_assert(!std::is_same< hash_accessor, cds::opt::none >::value, "hash_accessor functor must be specified");
@@ -370,7 +589,8 @@ namespace cds { namespace intrusive {
 
             enum node_flags {
                 flag_array_converting = 1,   ///< the cell is converting from data node to an array node
-                flag_array_node = 2          ///< the cell is a pointer to an array node
+                flag_array_node = 2,         ///< the cell is a pointer to an array node
+                flag_array_moved = 3         ///< the cell has been moved to the expanded head node, or the cell of the expanded head is not migrated yet
             };
 
         protected:
@@ -378,10 +598,52 @@ namespace cds { namespace intrusive {
             typedef cds::details::marked_ptr< value_type, 3 > node_ptr;
             typedef atomics::atomic< node_ptr > atomic_node_ptr;
 
-            struct array_node {
-                array_node * const  pParent;    ///< parent array node
-                size_t const        idxParent;  ///< index in parent array node
-                atomic_node_ptr     nodes[1];   ///< node array
+            // Cell block of compressed array node.
+            // The layout of the block is never changed, the new cell is added by creating new block,
+            // the obsolete block is retired through GC
+            struct cell_block {
+                uint64_t const      bitmap; ///< present cells
+                atomic_node_ptr     cells[1];
+
+                explicit cell_block( uint64_t bits )
+                    : bitmap( bits )
+                {}
+
+                size_t capacity() const
+                {
+                    return static_cast<size_t>( cds::bitop::SBC( bitmap ));
+                }
+
+                // Returns nullptr if the cell is absent
+                atomic_node_ptr * cell( size_t idx )
+                {
+                    uint64_t const bit = uint64_t(1) << idx;
+                    if ( bitmap & bit )
+                        return cells + cds::bitop::SBC( bitmap & ( bit - 1 ));
+                    return nullptr;
+                }
+            };
+
+            // The cell block marked by 1 is frozen: the array node is absorbed by the expanded head node
+            typedef cds::details::marked_ptr< cell_block, 1 > block_ptr;
+
+            struct dense_node_base
+            {};
+
+            struct compressed_node_base
+            {
+                atomics::atomic< block_ptr > pBlock;  ///< cell block, nullptr for the head node that is always dense
+
+                compressed_node_base()
+                    : pBlock( block_ptr())
+                {}
+            };
+
+            struct array_node: public std::conditional< c_bCompressed, compressed_node_base, dense_node_base >::type
+            {
+                atomics::atomic<array_node *>   pParent;    ///< parent array node
+                atomics::atomic<size_t>         idxParent;  ///< index in parent array node
+                atomic_node_ptr                 nodes[1];   ///< node array, not used for compressed array node
 
                 array_node(array_node * parent, size_t idx)
                     : pParent(parent)
@@ -391,53 +653,193 @@ namespace cds { namespace intrusive {
                 array_node() = delete;
                 array_node(array_node const&) = delete;
                 array_node(array_node&&) = delete;
+
+                // The parent is changed when the head node is expanded and the array node moves up to level 1.
+                // The index is stored before the parent, so the index read after the new parent is consistent with it
+                array_node * parent() const
+                {
+                    return pParent.load( memory_model::memory_order_acquire );
+                }
+
+                size_t parent_index() const
+                {
+                    return idxParent.load( memory_model::memory_order_relaxed );
+                }
             };
 
             typedef cds::details::Allocator< array_node, node_allocator > cxx_array_node_allocator;
+            typedef cds::details::Allocator< cell_block, node_allocator > cxx_cell_block_allocator;
+
+            // Head node descriptor.
+            // When the head is expanded the new head with array_bits more bits is created,
+            // the cells of the previous head are migrated into it lazily.
+            // Cell k of the previous head corresponds to the cells k | (i << prev_bits), i = 0 .. array_node_size - 1,
+            // of the new head.
+            //
+            // When all cells are migrated the previous head becomes obsolete. It is retired through GC
+            // together with its array and level 1 array nodes absorbed by this head, see retire_heads().
+            // pPrev may be dereferenced only under the guard while this head is not migrated.
+            struct head_node {
+                enum prev_state {
+                    prev_alive,     ///< the previous head is not freed yet
+                    prev_freed,     ///< the previous head is freed
+                    head_orphaned   ///< the set is destroyed while the previous head is waiting for reclamation
+                };
+
+                array_node *            pArr;       ///< head array
+                size_t const            nBits;      ///< log2( head array size )
+                head_node * const       pPrev;      ///< previous head which is migrated to this one
+                array_node * const      pPrevArr;   ///< array of \p pPrev, it marks the cells that are not migrated yet
+                size_t const            nPrevSize;  ///< size of \p pPrevArr
+                atomics::atomic<size_t> nMigrated;  ///< count of migrated cells
+                atomics::atomic<size_t> nHelpIdx;   ///< next cell of \p pPrev to be migrated by helping threads
+                atomics::atomic<size_t> nExpanded;  ///< approximate count of array nodes at level 1
+                atomics::atomic<head_node *> pNext; ///< next head, set when the head is expanded
+                atomics::atomic<int>    nPrevState; ///< \p prev_state
+
+                head_node( array_node * arr, size_t bits, head_node * prev )
+                    : pArr( arr )
+                    , nBits( bits )
+                    , pPrev( prev )
+                    , pPrevArr( prev ? prev->pArr : nullptr )
+                    , nPrevSize( prev ? prev->size() : 0 )
+                    , nMigrated( prev ? 0 : size_t(1) << bits )
+                    , nHelpIdx( 0 )
+                    , nExpanded( 0 )
+                    , pNext( nullptr )
+                    , nPrevState( prev ? prev_alive : prev_freed )
+                {}
+
+                size_t size() const
+                {
+                    return size_t(1) << nBits;
+                }
+
+                bool is_migrated() const
+                {
+                    return nMigrated.load( memory_model::memory_order_acquire ) == size();
+                }
+            };
+
+            typedef cds::details::Allocator< head_node, node_allocator > cxx_head_node_allocator;
 
+            // The cell block of compressed array node pArr is protected by guard, the head pHead is protected by headGuard.
+            // The traversing starts from the current head on the first traverse() call.
+            // The block replaced by insert_slot() and the obsolete heads are retired when traverse_data is destroyed,
+            // so the RCU-based set must destroy it outside of RCU lock
             struct traverse_data {
                 hash_splitter splitter;
+                multilevel_array& owner;
+                head_node * pHead;
                 array_node * pArr;
                 size_t nSlot;
                 size_t nHeight;
+                head_guard headGuard;
+                block_guard guard;
+                cell_block * pObsolete;
 
                 traverse_data( hash_type const& hash, multilevel_array& arr )
                     : splitter( hash )
+                    , owner( arr )
+                    , pHead( nullptr )
+                    , pArr( nullptr )
+                    , nSlot( 0 )
+                    , nHeight( 1 )
+                    , pObsolete( nullptr )
+                {}
+
+                ~traverse_data()
                 {
-                    reset( arr );
+                    if ( pObsolete )
+                        retire_cell_block( pObsolete, node_layout());
+                    if ( c_bHeadGrowth )
+                        owner.retire_heads();
                 }
 
+                // pHead is set only if the head grows, the fixed head is traversed from end_node() directly
                 void reset( multilevel_array& arr )
                 {
                     splitter.reset();
-                    pArr = arr.head();
-                    nSlot = splitter.cut( arr.metrics().head_node_size_log );
+                    if ( c_bHeadGrowth ) {
+                        pHead = arr.current_head( headGuard );
+                        pArr = pHead->pArr;
+                        nSlot = splitter.cut( pHead->nBits );
+                    }
+                    else {
+                        pArr = arr.end_node();
+                        nSlot = splitter.cut( arr.metrics().head_node_size_log );
+                    }
                     nHeight = 1;
                 }
             };
 
+            // The obsolete heads are not retired while the tree is walked outside of RCU lock
+            struct tree_walk {
+                multilevel_array& arr;
+
+                explicit tree_walk( multilevel_array& a )
+                    : arr( a )
+                {
+                    arr.m_nTreeWalkers.fetch_add( 1, atomics::memory_order_seq_cst );
+                }
+
+                ~tree_walk()
+                {
+                    arr.m_nTreeWalkers.fetch_sub( 1, atomics::memory_order_release );
+                }
+            };
+
+            // Slot protector for the case when the data nodes cannot be reclaimed while the set is accessed
+            // (RCU lock is held or the set is being destroyed)
+            struct slot_loader {
+                node_ptr operator()( atomic_node_ptr& slot ) const
+                {
+                    return slot.load( memory_model::memory_order_acquire );
+                }
+            };
+
         protected:
             feldman_hashset::details::metrics const m_Metrics;
-            array_node *      m_Head;
-            mutable stat      m_Stat;
+            atomics::atomic<head_node *>    m_pHead;        ///< current head
+            array_node * const              m_pEndNode;     ///< array of the initial head, it is the anchor of end iterators
+            atomics::atomic<head_node *>    m_pOldestHead;  ///< the oldest head that is not retired
+            atomics::atomic<bool>           m_bRetiringHead; ///< a thread is checking the oldest head for retirement
+            atomics::atomic<size_t>         m_nTreeWalkers; ///< see tree_walk
+            mutable atomic_node_ptr         m_EmptySlot;    ///< always empty slot, it stands for the absent cell of compressed array node
+            mutable stat                    m_Stat;
 
         public:
-            multilevel_array(size_t head_bits, size_t array_bits )
-                : m_Metrics(feldman_hashset::details::metrics::make(head_bits, array_bits, sizeof(hash_type)))
-                , m_Head( alloc_head_node())
+            multilevel_array(size_t head_bits, size_t array_bits, size_t max_head_bits = 0 )
+                : m_Metrics(feldman_hashset::details::metrics::make(head_bits, c_bCompressed && array_bits > 6 ? 6 : array_bits, sizeof(hash_type), c_bHeadGrowth ? max_head_bits : 0 ))
+                , m_pHead( alloc_head_node( m_Metrics.head_node_size_log, nullptr ))
+                , m_pEndNode( m_pHead.load( atomics::memory_order_relaxed )->pArr )
+                , m_pOldestHead( m_pHead.load( atomics::memory_order_relaxed ))
+                , m_bRetiringHead( false )
+                , m_nTreeWalkers( 0 )
             {}
 
             ~multilevel_array()
             {
                 destroy_tree();
-                free_array_node(m_Head);
             }
 
-            node_ptr traverse(traverse_data& pos)
+            /// Finds the data slot for \p pos
+            /**
+                \p protect is a functor <tt>node_ptr protect( atomic_node_ptr& slot )</tt> that loads \p slot
+                and protects the data node from reclamation. It is used when the head node is expanded
+                and the traversing thread helps to migrate a data node of the previous head.
+            */
+            template <typename Protector>
+            node_ptr traverse( traverse_data& pos, Protector protect )
             {
                 back_off bkoff;
+                if ( !pos.pArr )
+                    pos.reset( *this );
+                if ( c_bHeadGrowth && pos.nHeight == 1 )
+                    help_migrate( pos.pHead, protect );
+
                 while (true) {
-                    node_ptr slot = pos.pArr->nodes[pos.nSlot].load(memory_model::memory_order_acquire);
+                    node_ptr slot = load_slot( pos.pArr, pos.nSlot, pos.guard );
                     if (slot.bits() == flag_array_node) {
                         // array node, go down the tree
                         assert(slot.ptr() != nullptr);
@@ -452,6 +854,13 @@ namespace cds { namespace intrusive {
                         bkoff();
                         stats().onSlotConverting();
                     }
+                    else if ( slot.bits() == flag_array_moved ) {
+                        if ( !help_moved_slot( pos.pArr, pos.nSlot, protect )) {
+                            // the slot has been moved to the expanded head node - restart from the current head
+                            stats().onSlotMoved();
+                            pos.reset( *this );
+                        }
+                    }
                     else {
                         // data node
                         assert(slot.bits() == 0);
@@ -462,7 +871,8 @@ namespace cds { namespace intrusive {
 
             size_t head_size() const
             {
-                return m_Metrics.head_node_size;
+                head_guard guard;
+                return current_head( guard )->size();
             }
 
             size_t array_node_size() const
@@ -473,13 +883,84 @@ namespace cds { namespace intrusive {
             void get_level_statistics(std::vector< feldman_hashset::level_statistics>& stat) const
             {
                 stat.clear();
-                gather_level_statistics(stat, 0, m_Head, head_size());
+                head_guard hg;
+                head_node * pHead = current_head( hg );
+                block_guard guard;
+                gather_level_statistics(stat, 0, pHead->pArr, pHead->size(), guard);
             }
 
         protected:
+            head_node * current_head() const
+            {
+                return m_pHead.load( memory_model::memory_order_acquire );
+            }
+
+            // The head and all newer heads are not reclaimed while the head is protected by guard
+            head_node * current_head( head_guard& guard ) const
+            {
+                return guard.protect( m_pHead, []( head_node * p ) { return p; });
+            }
+
             array_node * head() const
             {
-                return m_Head;
+                return current_head()->pArr;
+            }
+
+            // Returns the cell idx of array node pArr, or nullptr if the cell is absent in compressed array node.
+            // The cell block of compressed array node is protected by guard until the guard is reused
+            atomic_node_ptr * slot_ptr( array_node * pArr, size_t idx, block_guard& guard ) const
+            {
+                return slot_ptr( pArr, idx, guard, node_layout());
+            }
+
+            // Returns the cell idx of array node pArr, the absent cell of compressed array node is substituted by always empty slot.
+            // The returned slot may be used for data protection and for CAS from non-empty value only
+            atomic_node_ptr& slot( array_node * pArr, size_t idx, block_guard& guard ) const
+            {
+                atomic_node_ptr * pSlot = slot_ptr( pArr, idx, guard );
+                return pSlot ? *pSlot : m_EmptySlot;
+            }
+
+            atomic_node_ptr& slot( traverse_data& pos ) const
+            {
+                return slot( pos.pArr, pos.nSlot, pos.guard );
+            }
+
+            // Loads the cell idx of array node pArr.
+            // The absent cell of compressed array node is empty, or it is moved if the node is absorbed by the expanded head node
+            node_ptr load_slot( array_node * pArr, size_t idx, block_guard& guard ) const
+            {
+                atomic_node_ptr * pSlot = slot_ptr( pArr, idx, guard );
+                if ( pSlot )
+                    return pSlot->load( memory_model::memory_order_acquire );
+                return is_absorbed( pArr, node_layout()) ? node_ptr( nullptr, flag_array_moved ) : node_ptr();
+            }
+
+            // Inserts pVal into the empty slot of pos.
+            // The absent cell of compressed array node is added by growing the cell block
+            bool insert_slot( traverse_data& pos, value_type * pVal )
+            {
+                return insert_slot( pos, pVal, node_layout());
+            }
+
+            // The array of the initial head is freed only in the destructor, it is used as the anchor of end() and rend() iterators
+            array_node * end_node() const
+            {
+                return m_pEndNode;
+            }
+
+            size_t end_node_size() const
+            {
+                return node_size( m_pEndNode );
+            }
+
+            // Returns the size of array node \p pArr: head nodes of different generations have different sizes.
+            // The head array has no parent, its parent index is the size of the array
+            size_t node_size( array_node const * pArr ) const
+            {
+                if ( pArr->parent())
+                    return array_node_size();
+                return pArr->parent_index();
             }
 
             stat& stats() const
@@ -492,16 +973,155 @@ namespace cds { namespace intrusive {
                 return m_Metrics;
             }
 
+            // Prefetches the slot of \p hash at level \p nLevel (0 is the head node).
+            // The array nodes are not freed while the head is protected, so they are traversed without protection.
+            // The cell block of compressed array node may be reclaimed, so the array node itself is prefetched instead.
+            // If a data node is met on upper level the data node is prefetched instead
+            void prefetch_slot( hash_type const& hash, size_t nLevel ) const
+            {
+                hash_splitter splitter( hash );
+                head_guard guard;
+                head_node * pHead = current_head( guard );
+                array_node * pArr = pHead->pArr;
+                size_t nSlot = splitter.cut( pHead->nBits );
+                for ( ;; ) {
+                    if ( c_bCompressed && pArr->parent()) {
+                        CDS_PREFETCH( pArr );
+                        return;
+                    }
+                    if ( nLevel == 0 )
+                        break;
+                    --nLevel;
+
+                    node_ptr slot = slot_ptr( pArr, nSlot )->load( memory_model::memory_order_acquire );
+                    if ( slot.bits() != flag_array_node ) {
+                        if ( slot.bits() == 0 && slot.ptr())
+                            CDS_PREFETCH( slot.ptr());
+                        return;
+                    }
+                    pArr = to_array( slot.ptr());
+                    nSlot = splitter.cut( metrics().array_node_size_log );
+                }
+                CDS_PREFETCH( slot_ptr( pArr, nSlot ));
+            }
+
+            // Handles the slot marked with flag_array_moved.
+            // Returns true if the slot is the cell of the current head that has been migrated just now,
+            // false if the slot belongs to an obsolete node and the traversing should be restarted from the current head
+            template <typename Protector>
+            bool help_moved_slot( array_node * pArr, size_t nSlot, Protector& protect )
+            {
+                head_guard guard;
+                head_node * pHead = current_head( guard );
+                if ( pArr != pHead->pArr || !pHead->pPrev ) {
+                    if ( is_cell_block_growing( pArr, node_layout())) {
+                        // the cell of compressed array node is being copied to the new cell block
+                        back_off()();
+                        return true;
+                    }
+                    return false;
+                }
+
+                migrate_slot( pHead, nSlot & ( pHead->nPrevSize - 1 ), protect );
+                return true;
+            }
+
+            // Retires the oldest head when the next head is migrated.
+            // A thread protecting a head can move to the nodes of newer heads: an array node below the head
+            // moves up to level 1 of the next head and can be absorbed by the head after it.
+            // So the head is retired only after the previous head has been freed,
+            // and the heads are not retired while the tree is walked outside of RCU lock
+            void retire_heads()
+            {
+                if ( !c_bHeadGrowth || m_pOldestHead.load( memory_model::memory_order_relaxed ) == current_head() || !head_guard::can_retire())
+                    return;
+
+                bool bExpected = false;
+                if ( !m_bRetiringHead.compare_exchange_strong( bExpected, true, memory_model::memory_order_acquire, atomics::memory_order_relaxed ))
+                    return;
+
+                // Only this thread can retire the oldest head now
+                head_node * pHead = m_pOldestHead.load( memory_model::memory_order_relaxed );
+                head_node * pNext = pHead->pNext.load( memory_model::memory_order_acquire );
+                bool bRetire = pNext && pNext->is_migrated()
+                    && pHead->nPrevState.load( memory_model::memory_order_acquire ) == head_node::prev_freed;
+                if ( bRetire ) {
+                    atomics::atomic_thread_fence( memory_model::memory_order_seq_cst );
+                    bRetire = m_nTreeWalkers.load( memory_model::memory_order_relaxed ) == 0;
+                }
+                if ( bRetire )
+                    m_pOldestHead.store( pNext, memory_model::memory_order_release );
+                m_bRetiringHead.store( false, memory_model::memory_order_release );
+
+                if ( bRetire ) {
+                    stats().onHeadRetired();
+                    head_guard::retire( pHead, dispose_head );
+                }
+            }
+
             void destroy_tree()
             {
                 // The function is not thread-safe. For use in dtor only
+                head_node * pHead = current_head();
+                if ( !pHead->is_migrated()) {
+                    slot_loader loader;
+                    for ( size_t i = 0, nSize = pHead->nPrevSize; i < nSize; ++i )
+                        migrate_slot( pHead, i, loader );
+                }
+
                 // Destroy all array nodes
-                destroy_array_nodes(m_Head, head_size());
+                destroy_array_nodes( pHead->pArr, pHead->size());
+
+                // Destroy the head nodes that are not retired, from the oldest one.
+                // The previous head of the oldest head may be still waiting for reclamation,
+                // in that case its disposer frees the oldest head descriptor
+                head_node * pOldest = m_pOldestHead.load( memory_model::memory_order_relaxed );
+                for ( head_node * p = pOldest; p; ) {
+                    head_node * pNext = p->pNext.load( memory_model::memory_order_relaxed );
+                    if ( p != pHead )
+                        free_head_arrays( p );
+                    else if ( p->pPrev ) {
+                        // the array nodes of the current head have been destroyed above
+                        free_array_node( p->pArr );
+                    }
+                    if ( p != pOldest || p->nPrevState.exchange( head_node::head_orphaned, memory_model::memory_order_acq_rel ) == head_node::prev_freed )
+                        free_head_node( p );
+                    p = pNext;
+                }
+                free_array_node( m_pEndNode );
+            }
+
+            // Frees the head array and level 1 array nodes absorbed by the next head, their children live in the current tree.
+            // The array of the initial head is the anchor of end iterators, it is freed in the destructor
+            static void free_head_arrays( head_node * pHead )
+            {
+                for ( atomic_node_ptr * p = pHead->pArr->nodes, *pLast = p + pHead->size(); p != pLast; ++p ) {
+                    node_ptr slot = p->load( memory_model::memory_order_relaxed );
+                    if ( slot.bits() == flag_array_node )
+                        free_array_node( to_array( slot.ptr()));
+                }
+                if ( pHead->pPrev )
+                    free_array_node( pHead->pArr );
+            }
+
+            // Disposer of the obsolete head. The next head is not retired until this head is freed
+            static void dispose_head( head_node * pHead )
+            {
+                head_node * pNext = pHead->pNext.load( memory_model::memory_order_relaxed );
+                free_head_arrays( pHead );
+                free_head_node( pHead );
+                if ( pNext->nPrevState.exchange( head_node::prev_freed, memory_model::memory_order_acq_rel ) == head_node::head_orphaned ) {
+                    // the set has been destroyed
+                    free_head_node( pNext );
+                }
             }
 
             void destroy_array_nodes(array_node * pArr, size_t nSize)
             {
-                for (atomic_node_ptr * p = pArr->nodes, *pLast = p + nSize; p != pLast; ++p) {
+                for ( size_t i = 0; i < nSize; ++i ) {
+                    atomic_node_ptr * p = slot_ptr( pArr, i );
+                    if ( !p )
+                        continue;
                     node_ptr slot = p->load(memory_model::memory_order_relaxed);
                     if (slot.bits() == flag_array_node) {
                         destroy_array_nodes(to_array(slot.ptr()), array_node_size());
@@ -518,21 +1138,87 @@ namespace cds { namespace intrusive {
                 return pNode;
             }
 
-            array_node * alloc_head_node() const
+            static head_node * alloc_head_node( size_t nBits, head_node * pPrev )
+            {
+                size_t const nSize = size_t(1) << nBits;
+                // The parent index of the head array is its size, see node_size()
+                array_node * pArr = alloc_array_node( nSize, nullptr, nSize );
+                if ( pPrev ) {
+                    // all cells of the expanded head are not migrated yet
+                    node_ptr const marker = unmigrated_marker( pPrev->pArr );
+                    for ( size_t i = 0; i < nSize; ++i )
+                        pArr->nodes[i].store( marker, memory_model::memory_order_relaxed );
+                }
+                return cxx_head_node_allocator().New( pArr, nBits, pPrev );
+            }
+
+            static void free_head_node( head_node * pHead )
+            {
+                cxx_head_node_allocator().Delete( pHead );
+            }
+
+            // Allocates the array node below the head node, bitmap is the set of cells reserved in compressed array node
+            array_node * alloc_array_node( array_node * pParent, size_t idxParent, uint64_t bitmap ) const
             {
-                return alloc_array_node(head_size(), nullptr, 0);
+                return alloc_array_node( pParent, idxParent, bitmap, node_layout());
             }
 
-            array_node * alloc_array_node(array_node * pParent, size_t idxParent) const
+            array_node * alloc_array_node( array_node * pParent, size_t idxParent, uint64_t /*bitmap*/, feldman_hashset::dense_layout ) const
             {
                 return alloc_array_node(array_node_size(), pParent, idxParent);
             }
 
+            static array_node * alloc_array_node( array_node * pParent, size_t idxParent, uint64_t bitmap, feldman_hashset::compressed_layout )
+            {
+                array_node * pArr = alloc_array_node( 1, pParent, idxParent );
+                pArr->pBlock.store( block_ptr( alloc_cell_block( bitmap )), memory_model::memory_order_relaxed );
+                return pArr;
+            }
+
             static void free_array_node(array_node * parr)
             {
+                free_cell_block( parr, node_layout());
                 cxx_array_node_allocator().Delete(parr);
             }
 
+            static cell_block * alloc_cell_block( uint64_t bitmap )
+            {
+                size_t const nSize = static_cast<size_t>( cds::bitop::SBC( bitmap ));
+                assert( nSize > 0 );
+                cell_block * pBlock = cxx_cell_block_allocator().NewBlock( sizeof(cell_block) + sizeof(atomic_node_ptr) * (nSize - 1), bitmap );
+                new ( pBlock->cells ) atomic_node_ptr[nSize];
+                return pBlock;
+            }
+
+            static void free_cell_block( cell_block * pBlock )
+            {
+                cxx_cell_block_allocator().Delete( pBlock );
+            }
+
+            static void free_cell_block( array_node * /*pArr*/, feldman_hashset::dense_layout )
+            {}
+
+            // The obsolete blocks of the array node have been retired already, only the current block is freed
+            static void free_cell_block( array_node * pArr, feldman_hashset::compressed_layout )
+            {
+                cell_block * pBlock = pArr->pBlock.load( memory_model::memory_order_relaxed ).ptr();
+                if ( pBlock )
+                    free_cell_block( pBlock );
+            }
+
+            static void retire_cell_block( cell_block * /*pBlock*/, feldman_hashset::dense_layout )
+            {}
+
+            static void retire_cell_block( cell_block * pBlock, feldman_hashset::compressed_layout )
+            {
+                block_guard::retire( pBlock, free_cell_block );
+            }
+
+            uint64_t full_bitmap() const
+            {
+                return array_node_size() == 64 ? ~uint64_t(0) : ( uint64_t(1) << array_node_size()) - 1;
+            }
+
             union converter {
                 value_type * pData;
                 array_node * pArr;
@@ -555,7 +1241,7 @@ namespace cds { namespace intrusive {
                 return converter(p).pData;
             }
 
-            void gather_level_statistics(std::vector<feldman_hashset::level_statistics>& stat, size_t nLevel, array_node * pArr, size_t nSize) const
+            void gather_level_statistics(std::vector<feldman_hashset::level_statistics>& stat, size_t nLevel, array_node * pArr, size_t nSize, block_guard& guard) const
             {
                 if (stat.size() <= nLevel) {
                     stat.resize(nLevel + 1);
@@ -563,12 +1249,17 @@ namespace cds { namespace intrusive {
                 }
 
                 ++stat[nLevel].array_node_count;
-                for (atomic_node_ptr * p = pArr->nodes, *pLast = p + nSize; p != pLast; ++p) {
-                    node_ptr slot = p->load(memory_model::memory_order_relaxed);
-                    if (slot.bits()) {
+                cell_block_statistics( stat[nLevel], pArr, nSize, guard, node_layout());
+                for ( size_t i = 0; i < nSize; ++i ) {
+                    node_ptr slot = load_slot( pArr, i, guard );
+                    if ( slot.bits() == flag_array_moved ) {
+                        // not migrated yet
+                        ++stat[nLevel].empty_cell_count;
+                    }
+                    else if (slot.bits()) {
                         ++stat[nLevel].array_cell_count;
                         if (slot.bits() == flag_array_node)
-                            gather_level_statistics(stat, nLevel + 1, to_array(slot.ptr()), array_node_size());
+                            gather_level_statistics(stat, nLevel + 1, to_array(slot.ptr()), array_node_size(), guard);
                     }
                     else if (slot.ptr())
                         ++stat[nLevel].data_cell_count;
@@ -579,19 +1270,36 @@ namespace cds { namespace intrusive {
 
             bool expand_slot( traverse_data& pos, node_ptr current)
             {
-                return expand_slot( pos.pArr, pos.nSlot, current, pos.splitter.bit_offset());
+                // The cell of the item being inserted is reserved in new compressed array node
+                size_t const idxNew = hash_splitter( pos.splitter ).cut( metrics().array_node_size_log );
+                if ( !expand_slot( pos.pArr, pos.nSlot, pos.guard, current, pos.splitter.bit_offset(), idxNew ))
+                    return false;
+
+                if ( c_bHeadGrowth && pos.nHeight == 1 && pos.pHead->nBits < metrics().max_head_node_size_log ) {
+                    // The head node is expanded when a half of its cells is converted to array nodes
+                    if ( pos.pHead->nExpanded.fetch_add( 1, memory_model::memory_order_relaxed ) + 1 > pos.pHead->size() / 2 )
+                        expand_head( pos.pHead );
+                }
+                return true;
             }
 
         private:
-            bool expand_slot(array_node * pParent, size_t idxParent, node_ptr current, size_t nOffset)
+            bool expand_slot(array_node * pParent, size_t idxParent, block_guard& guard, node_ptr current, size_t nOffset, size_t idxNew)
             {
                 assert(current.bits() == 0);
                 assert(current.ptr());
 
-                array_node * pArr = alloc_array_node(pParent, idxParent);
+                atomic_node_ptr * pSlot = slot_ptr( pParent, idxParent, guard );
+                if ( !pSlot ) {
+                    stats().onExpandNodeFailed();
+                    return false;
+                }
+
+                size_t idx = hash_splitter( hash_accessor()(*current.ptr()), nOffset ).cut( m_Metrics.array_node_size_log );
+                array_node * pArr = alloc_array_node( pParent, idxParent, ( uint64_t(1) << idx ) | ( uint64_t(1) << idxNew ));
 
                 node_ptr cur(current.ptr());
-                atomic_node_ptr& slot = pParent->nodes[idxParent];
+                atomic_node_ptr& slot = *pSlot;
                 if (!slot.compare_exchange_strong(cur, cur | flag_array_converting, memory_model::memory_order_release, atomics::memory_order_relaxed))
                 {
                     stats().onExpandNodeFailed();
@@ -599,8 +1307,7 @@ namespace cds { namespace intrusive {
                     return false;
                 }
 
-                size_t idx = hash_splitter( hash_accessor()(*current.ptr()), nOffset ).cut( m_Metrics.array_node_size_log );
-                pArr->nodes[idx].store(current, memory_model::memory_order_release);
+                slot_ptr( pArr, idx )->store(current, memory_model::memory_order_release);
 
                 cur = cur | flag_array_converting;
                 CDS_VERIFY(
@@ -611,6 +1318,298 @@ namespace cds { namespace intrusive {
                 stats().onArrayNodeCreated();
                 return true;
             }
+
+            void expand_head( head_node * pHead )
+            {
+                // The next expansion is allowed only when the previous one is completed
+                if ( current_head() != pHead || !pHead->is_migrated())
+                    return;
+
+                head_node * pNew = alloc_head_node( pHead->nBits + metrics().array_node_size_log, pHead );
+                if ( m_pHead.compare_exchange_strong( pHead, pNew, memory_model::memory_order_release, atomics::memory_order_relaxed )) {
+                    pHead->pNext.store( pNew, memory_model::memory_order_release );
+                    stats().onHeadExpanded();
+                }
+                else {
+                    free_array_node( pNew->pArr );
+                    free_head_node( pNew );
+                }
+            }
+
+            // The cell of expanded head that is not migrated yet is marked by the pointer to the previous head array.
+            // Unlike the frozen cell of an obsolete node it cannot contain a pointer to data node,
+            // so a late helper cannot confuse it with the cell frozen by the next expansion
+            static node_ptr unmigrated_marker( array_node * pPrevArr )
+            {
+                return node_ptr( to_node( pPrevArr ), flag_array_moved );
+            }
+
+            // Helps to migrate the previous head when an operation starts at the expanded head
+            template <typename Protector>
+            void help_migrate( head_node * pHead, Protector& protect )
+            {
+                size_t const nPrevSize = pHead->nPrevSize;
+                if ( nPrevSize && pHead->nHelpIdx.load( memory_model::memory_order_relaxed ) < nPrevSize ) {
+                    size_t const idx = pHead->nHelpIdx.fetch_add( 1, memory_model::memory_order_relaxed );
+                    if ( idx < nPrevSize )
+                        migrate_slot( pHead, idx, protect );
+                }
+            }
+
+            // Freezes the cell of an obsolete node: data and empty cells are marked with flag_array_moved,
+            // array node cells are never changed so they are left as is
+            node_ptr freeze_slot( atomic_node_ptr& slot )
+            {
+                back_off bkoff;
+                while ( true ) {
+                    node_ptr cur = slot.load( memory_model::memory_order_acquire );
+                    if ( cur.bits() == flag_array_converting ) {
+                        bkoff();
+                        stats().onSlotConverting();
+                    }
+                    else if ( cur.bits() != 0 )
+                        return cur;
+                    else if ( slot.compare_exchange_weak( cur, node_ptr( cur.ptr(), flag_array_moved ), memory_model::memory_order_acq_rel, atomics::memory_order_relaxed ))
+                        return node_ptr( cur.ptr(), flag_array_moved );
+                }
+            }
+
+            bool set_migrated( head_node * pHead, size_t idx, node_ptr val )
+            {
+                node_ptr marker = unmigrated_marker( pHead->pPrevArr );
+                if ( pHead->pArr->nodes[idx].compare_exchange_strong( marker, val, memory_model::memory_order_release, atomics::memory_order_relaxed )) {
+                    pHead->nMigrated.fetch_add( 1, memory_model::memory_order_release );
+                    return true;
+                }
+                return false;
+            }
+
+            // Migrates the cell nOldSlot of the previous head to pHead.
+            // When the function returns all corresponding cells of pHead are migrated
+            template <typename Protector>
+            void migrate_slot( head_node * pHead, size_t nOldSlot, Protector& protect )
+            {
+                // The previous head is retired when all cells of pHead are migrated
+                head_guard prevGuard;
+                head_node * pPrev = prevGuard.assign( pHead->pPrev );
+                assert( pPrev );
+                atomics::atomic_thread_fence( memory_model::memory_order_seq_cst );
+                if ( pHead->is_migrated())
+                    return;
+
+                size_t const nOldBits = pPrev->nBits;
+                size_t const nCount = array_node_size();
+                atomic_node_ptr& oldSlot = pPrev->pArr->nodes[nOldSlot];
+
+                node_ptr slot = freeze_slot( oldSlot );
+                if ( slot.bits() == flag_array_node ) {
+                    // The array node of level 1 is absorbed by the new head:
+                    // its cells are moved to the new head, its child array nodes move up to level 1
+                    array_node * pArr = to_array( slot.ptr());
+                    freeze_cell_block( pArr, node_layout());
+                    for ( size_t i = 0; i < nCount; ++i ) {
+                        // the absent cell of compressed array node is empty
+                        atomic_node_ptr * pCell = slot_ptr( pArr, i );
+                        node_ptr cell = pCell ? freeze_slot( *pCell ) : node_ptr();
+                        size_t const idx = nOldSlot | ( i << nOldBits );
+                        if ( cell.bits() == flag_array_node ) {
+                            array_node * pChild = to_array( cell.ptr());
+                            pChild->idxParent.store( idx, memory_model::memory_order_relaxed );
+                            pChild->pParent.store( pHead->pArr, memory_model::memory_order_release );
+                            if ( set_migrated( pHead, idx, cell ))
+                                pHead->nExpanded.fetch_add( 1, memory_model::memory_order_relaxed );
+                        }
+                        else
+                            set_migrated( pHead, idx, node_ptr( cell.ptr()));
+                    }
+                }
+                else {
+                    assert( slot.bits() == flag_array_moved );
+                    if ( slot.ptr()) {
+                        // The data node goes to the cell chosen by the next array_bits of its hash.
+                        // Each helper sets that cell first, so if any cell is migrated the data node is already placed.
+                        // The data node is not reachable from the new head until it is placed, so it cannot be reclaimed
+                        // while it is protected by the helper
+                        if ( !is_any_migrated( pHead, nOldSlot )) {
+                            CDS_VERIFY( protect( oldSlot ) == slot );
+                            atomics::atomic_thread_fence( memory_model::memory_order_seq_cst );
+                            if ( !is_any_migrated( pHead, nOldSlot )) {
+                                size_t const i = hash_splitter( hash_accessor()( *slot.ptr()), nOldBits ).cut( metrics().array_node_size_log );
+                                set_migrated( pHead, nOldSlot | ( i << nOldBits ), node_ptr( slot.ptr()));
+                            }
+                        }
+                    }
+
+                    // other cells are empty
+                    for ( size_t i = 0; i < nCount; ++i )
+                        set_migrated( pHead, nOldSlot | ( i << nOldBits ), node_ptr());
+                }
+            }
+
+            bool is_any_migrated( head_node * pHead, size_t nOldSlot ) const
+            {
+                node_ptr const marker = unmigrated_marker( pHead->pPrevArr );
+                size_t const nOldBits = pHead->nBits - metrics().array_node_size_log;
+                for ( size_t i = 0, nCount = array_node_size(); i < nCount; ++i ) {
+                    if ( pHead->pArr->nodes[nOldSlot | ( i << nOldBits )].load( memory_model::memory_order_acquire ) != marker )
+                        return true;
+                }
+                return false;
+            }
+
+            // Returns the cell idx of array node pArr without the protection of the cell block.
+            // It is safe for the head node, for the node absorbed by the expanded head (its cell block is frozen),
+            // for the node that is not linked into the tree yet, and when the set is being destroyed
+            atomic_node_ptr * slot_ptr( array_node * pArr, size_t idx ) const
+            {
+                return slot_ptr( pArr, idx, node_layout());
+            }
+
+            static atomic_node_ptr * slot_ptr( array_node * pArr, size_t idx, feldman_hashset::dense_layout )
+            {
+                return pArr->nodes + idx;
+            }
+
+            static atomic_node_ptr * slot_ptr( array_node * pArr, size_t idx, feldman_hashset::compressed_layout )
+            {
+                cell_block * pBlock = pArr->pBlock.load( memory_model::memory_order_acquire ).ptr();
+                if ( !pBlock ) {
+                    // head node
+                    return pArr->nodes + idx;
+                }
+                return pBlock->cell( idx );
+            }
+
+            static atomic_node_ptr * slot_ptr( array_node * pArr, size_t idx, block_guard& /*guard*/, feldman_hashset::dense_layout )
+            {
+                return pArr->nodes + idx;
+            }
+
+            static atomic_node_ptr * slot_ptr( array_node * pArr, size_t idx, block_guard& guard, feldman_hashset::compressed_layout )
+            {
+                if ( !pArr->pBlock.load( memory_model::memory_order_relaxed ).ptr()) {
+                    // head node, its block is always nullptr
+                    return pArr->nodes + idx;
+                }
+                return protect_cell_block( pArr, guard ).ptr()->cell( idx );
+            }
+
+            static block_ptr protect_cell_block( array_node * pArr, block_guard& guard )
+            {
+                return guard.protect( pArr->pBlock, []( block_ptr p ) -> cell_block * { return p.ptr(); });
+            }
+
+            static bool is_absorbed( array_node * /*pArr*/, feldman_hashset::dense_layout )
+            {
+                return false;
+            }
+
+            static bool is_absorbed( array_node * pArr, feldman_hashset::compressed_layout )
+            {
+                return pArr->pBlock.load( memory_model::memory_order_acquire ).bits() != 0;
+            }
+
+            static bool is_cell_block_growing( array_node * /*pArr*/, feldman_hashset::dense_layout )
+            {
+                return false;
+            }
+
+            // The frozen cell of compressed array node that is not absorbed by the expanded head
+            // is being copied to the new cell block
+            static bool is_cell_block_growing( array_node * pArr, feldman_hashset::compressed_layout )
+            {
+                block_ptr pBlock = pArr->pBlock.load( memory_model::memory_order_acquire );
+                return pBlock.ptr() && pBlock.bits() == 0;
+            }
+
+            static void freeze_cell_block( array_node * /*pArr*/, feldman_hashset::dense_layout )
+            {}
+
+            // Marks the cell block of the array node absorbed by the expanded head, after that the block cannot grow
+            static void freeze_cell_block( array_node * pArr, feldman_hashset::compressed_layout )
+            {
+                block_ptr cur = pArr->pBlock.load( memory_model::memory_order_acquire );
+                while ( cur.bits() == 0
+                    && !pArr->pBlock.compare_exchange_weak( cur, cur | 1, memory_model::memory_order_acq_rel, atomics::memory_order_acquire ))
+                {}
+            }
+
+            bool insert_slot( traverse_data& pos, value_type * pVal, feldman_hashset::dense_layout )
+            {
+                node_ptr pNull;
+                return pos.pArr->nodes[pos.nSlot].compare_exchange_strong( pNull, node_ptr( pVal ), memory_model::memory_order_release, atomics::memory_order_relaxed );
+            }
+
+            bool insert_slot( traverse_data& pos, value_type * pVal, feldman_hashset::compressed_layout )
+            {
+                atomic_node_ptr * pSlot = slot_ptr( pos.pArr, pos.nSlot, pos.guard );
+                if ( pSlot ) {
+                    node_ptr pNull;
+                    return pSlot->compare_exchange_strong( pNull, node_ptr( pVal ), memory_model::memory_order_release, atomics::memory_order_relaxed );
+                }
+                return grow_cell_block( pos, node_ptr( pVal ));
+            }
+
+            // Adds the cell pos.nSlot with value val to the compressed array node pos.pArr.
+            // The cells of current block are frozen and copied to new block, then the new block is installed by CAS.
+            // The replaced block is retired when pos is destroyed
+            bool grow_cell_block( traverse_data& pos, node_ptr val )
+            {
+                array_node * pArr = pos.pArr;
+                size_t const idx = pos.nSlot;
+                block_ptr pOld = protect_cell_block( pArr, pos.guard );
+                assert( pOld.ptr());
+                if ( pOld.bits() || pOld->cell( idx )) {
+                    // the node is absorbed by the expanded head node, or the cell has been added by another thread
+                    stats().onCellBlockGrowFailed();
+                    return false;
+                }
+
+                uint64_t bitmap = pOld->bitmap | ( uint64_t(1) << idx );
+                if ( static_cast<size_t>( cds::bitop::SBC( bitmap )) > array_node_size() / 2 ) {
+                    // the node is dense enough, the next growing is not needed
+                    bitmap = full_bitmap();
+                }
+
+                cell_block * pNew = alloc_cell_block( bitmap );
+                for ( size_t i = 0, nSize = array_node_size(); i < nSize; ++i ) {
+                    atomic_node_ptr * pCell = pOld->cell( i );
+                    if ( pCell ) {
+                        node_ptr cell = freeze_slot( *pCell );
+                        if ( cell.bits() == flag_array_moved )
+                            cell = node_ptr( cell.ptr());
+                        pNew->cell( i )->store( cell, memory_model::memory_order_relaxed );
+                    }
+                }
+                pNew->cell( idx )->store( val, memory_model::memory_order_relaxed );
+
+                if ( pArr->pBlock.compare_exchange_strong( pOld, block_ptr( pNew ), memory_model::memory_order_release, atomics::memory_order_relaxed )) {
+                    assert( !pos.pObsolete );
+                    pos.pObsolete = pOld.ptr();
+                    stats().onCellBlockGrown();
+                    return true;
+                }
+
+                // the node has been grown by another thread or absorbed by the expanded head node
+                free_cell_block( pNew );
+                stats().onCellBlockGrowFailed();
+                return false;
+            }
+
+            static void cell_block_statistics( feldman_hashset::level_statistics& stat, array_node * /*pArr*/, size_t nSize, block_guard& /*guard*/, feldman_hashset::dense_layout )
+            {
+                stat.allocated_cell_count += nSize;
+            }
+
+            static void cell_block_statistics( feldman_hashset::level_statistics& stat, array_node * pArr, size_t nSize, block_guard& guard, feldman_hashset::compressed_layout )
+            {
+                if ( !pArr->pBlock.load( memory_model::memory_order_relaxed ).ptr()) {
+                    // head node
+                    stat.allocated_cell_count += nSize;
+                    return;
+                }
+                stat.allocated_cell_count += protect_cell_block( pArr, guard ).ptr()->capacity();
+            }
         };
         //@endcond
     } // namespace feldman_hashset
@@ -34,6 +34,7 @@
 #include <cds/intrusive/details/base.h>
 #include <cds/details/marked_ptr.h>
 #include <cds/algo/bitop.h>
+#include <cds/algo/backoff_strategy.h>
 #include <cds/os/timer.h>
 #include <cds/urcu/options.h>
 
@@ -380,6 +381,276 @@ namespace cds { namespace intrusive {
             }
         };
 
+        /// Version counter for consistent range snapshots
+        /**
+            The counter is used by \p SkipListSet::snapshot_range() to get a linearizable view of a key range.
+            The counter consists of \p c_nStripeCount cache-line padded stripes; a modifying operation
+            is registered in the stripe selected by the address of the node being inserted or deleted,
+            so concurrent writers seldom touch the same cache line.
+            Each stripe packs into one 64-bit word the number of modifying operations in progress (low 24 bits)
+            and the stripe version (high bits). Each insertion and deletion registers itself
+            before its linearization point and atomically moves the registration into the version after it.
+
+            A scan is optimistic: it is consistent if no modification is in progress in any stripe
+            when the scan starts and all stripes are unchanged when the scan ends.
+            If the optimistic scan fails \p c_nOptimisticAttempts times in a row, the reader switches
+            to exclusive mode: it blocks new modifications, waits until modifications in progress are completed
+            and scans the range without validation. Thus, \p snapshot_range() does not starve under heavy
+            update load; the price is that the writers wait while an exclusive scan is in progress.
+
+            A modifying operation makes one sequentially consistent RMW on its stripe and one load of
+            the exclusive flag before the linearization point, and one release RMW on its stripe after it.
+            Enable the counter only if you need \p SkipListSet::snapshot_range().
+            See \p skip_list::snapshot_counter option setter.
+        */
+        class version_counter
+        {
+        public:
+            typedef uint64_t    version_type;   ///< Version value type
+
+            static CDS_CONSTEXPR unsigned int const c_nStripeCount = 16;        ///< Stripe count, power of 2
+            static CDS_CONSTEXPR unsigned int const c_nOptimisticAttempts = 8;  ///< Optimistic scan attempts before exclusive scan
+
+            /// Reader's state: the stripe values read before the scan
+            struct read_state {
+                version_type    nStripe[c_nStripeCount];    ///< Stripe values
+            };
+
+            //@cond
+            static CDS_CONSTEXPR bool const c_bEnabled = true;
+            //@endcond
+
+        protected:
+            //@cond
+            static CDS_CONSTEXPR version_type const c_nActiveMask = (version_type(1) << 24) - 1;
+            static CDS_CONSTEXPR version_type const c_nVersionInc = version_type(1) << 24;
+
+            static_assert( (c_nStripeCount & (c_nStripeCount - 1)) == 0, "c_nStripeCount must be power of 2" );
+
+            struct stripe {
+                atomics::atomic<version_type>   nState;
+                char pad_[cds::c_nCacheLineSize - sizeof( atomics::atomic<version_type> )];
+
+                stripe()
+                    : nState( 0 )
+                {}
+            };
+
+            stripe                          m_Stripes[c_nStripeCount];
+            atomics::atomic<unsigned int>   m_nExclusive;   // count of exclusive readers
+            //@endcond
+
+        protected:
+            //@cond
+            static unsigned int stripe_index( void const* p )
+            {
+                uintptr_t n = reinterpret_cast<uintptr_t>( p ) >> 4;
+                return static_cast<unsigned int>( n ^ ( n >> 7 ) ^ ( n >> 13 )) & ( c_nStripeCount - 1 );
+            }
+
+            bool is_quiescent() const
+            {
+                for ( unsigned int i = 0; i < c_nStripeCount; ++i ) {
+                    if ( m_Stripes[i].nState.load( atomics::memory_order_seq_cst ) & c_nActiveMask )
+                        return false;
+                }
+                return true;
+            }
+            //@endcond
+
+        public:
+            /// Initializes the counter
+            version_counter()
+                : m_nExclusive( 0 )
+            {}
+
+            /// Registers a modification of node \p p, should be called before its linearization point
+            /**
+                If an exclusive scan is in progress the function waits until it is completed.
+                Returns the stripe index that should be passed to \p end_update().
+            */
+            unsigned int begin_update( void const* p )
+            {
+                unsigned int const nStripe = stripe_index( p );
+                atomics::atomic<version_type>& state = m_Stripes[nStripe].nState;
+                cds::backoff::Default bkoff;
+                for (;;) {
+                    state.fetch_add( 1, atomics::memory_order_seq_cst );
+                    if ( m_nExclusive.load( atomics::memory_order_seq_cst ) == 0 )
+                        return nStripe;
+
+                    // An exclusive scan is in progress - cancel the registration and wait
+                    state.fetch_sub( 1, atomics::memory_order_seq_cst );
+                    while ( m_nExclusive.load( atomics::memory_order_acquire ) != 0 )
+                        bkoff();
+                }
+            }
+
+            /// Completes a modifying operation: increments the version of stripe \p nStripe
+            void end_update( unsigned int nStripe )
+            {
+                assert( nStripe < c_nStripeCount );
+                m_Stripes[nStripe].nState.fetch_add( c_nVersionInc - 1, atomics::memory_order_release );
+            }
+
+            /// Reads current state before an optimistic scan
+            /**
+                Returns \p true if no modifying operation is in progress.
+            */
+            bool begin_read( read_state& st ) const
+            {
+                bool bStable = true;
+                for ( unsigned int i = 0; i < c_nStripeCount; ++i ) {
+                    st.nStripe[i] = m_Stripes[i].nState.load( atomics::memory_order_seq_cst );
+                    if ( st.nStripe[i] & c_nActiveMask )
+                        bStable = false;
+                }
+                return bStable;
+            }
+
+            /// Checks that no modifying operation has started since \p st has been read
+            bool validate( read_state const& st ) const
+            {
+                atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+                for ( unsigned int i = 0; i < c_nStripeCount; ++i ) {
+                    if ( m_Stripes[i].nState.load( atomics::memory_order_relaxed ) != st.nStripe[i] )
+                        return false;
+                }
+                return true;
+            }
+
+            /// Starts exclusive scan: blocks new modifications and waits until modifications in progress are completed
+            void begin_exclusive()
+            {
+                m_nExclusive.fetch_add( 1, atomics::memory_order_seq_cst );
+                cds::backoff::Default bkoff;
+                while ( !is_quiescent())
+                    bkoff();
+            }
+
+            /// Completes exclusive scan
+            void end_exclusive()
+            {
+                m_nExclusive.fetch_sub( 1, atomics::memory_order_release );
+            }
+
+            /// Returns the count of completed modifying operations
+            version_type version() const
+            {
+                version_type nVersion = 0;
+                for ( unsigned int i = 0; i < c_nStripeCount; ++i )
+                    nVersion += m_Stripes[i].nState.load( atomics::memory_order_relaxed ) >> 24;
+                return nVersion;
+            }
+        };
+
+        /// Empty version counter (default), \p SkipListSet::snapshot_range() is unavailable
+        class empty_version_counter
+        {
+        public:
+            typedef uint64_t    version_type;   ///< Version value type
+
+            //@cond
+            static CDS_CONSTEXPR unsigned int const c_nOptimisticAttempts = 0;
+            struct read_state {};
+
+            static CDS_CONSTEXPR bool const c_bEnabled = false;
+
+            unsigned int begin_update( void const* /*p*/ ) const { return 0; }
+            void end_update( unsigned int /*nStripe*/ ) const {}
+            bool begin_read( read_state& /*st*/ ) const { return true; }
+            bool validate( read_state const& /*st*/ ) const { return true; }
+            void begin_exclusive() const {}
+            void end_exclusive() const {}
+            version_type version() const { return 0; }
+            //@endcond
+        };
+
+        /// Option specifying version counter for \p SkipListSet::snapshot_range()
+        /**
+            Possible \p Type values are \p skip_list::version_counter and \p skip_list::empty_version_counter (the default).
+        */
+        template <typename Type>
+        struct snapshot_counter {
+            //@cond
+            template <typename Base>
+            struct pack: public Base
+            {
+                typedef Type snapshot_counter;
+            };
+            //@endcond
+        };
+
+        //@cond
+        namespace details {
+            // Registers a modifying operation in version counter for the scope lifetime
+            template <typename VersionCounter>
+            class update_scope
+            {
+                VersionCounter&     m_Counter;
+                unsigned int const  m_nStripe;
+            public:
+                update_scope( VersionCounter& c, void const* pNode )
+                    : m_Counter( c )
+                    , m_nStripe( c.begin_update( pNode ))
+                {}
+                ~update_scope()
+                {
+                    m_Counter.end_update( m_nStripe );
+                }
+            };
+
+            // Blocks modifying operations for the scope lifetime.
+            // The scan running in the scope calls user-provided functors that can throw
+            template <typename VersionCounter>
+            class exclusive_scope
+            {
+                VersionCounter&     m_Counter;
+            public:
+                explicit exclusive_scope( VersionCounter& c )
+                    : m_Counter( c )
+                {
+                    m_Counter.begin_exclusive();
+                }
+                ~exclusive_scope()
+                {
+                    m_Counter.end_exclusive();
+                }
+            };
+
+            // Snapshot scan of the range: optimistic attempts are followed by the exclusive scan
+            template <typename VersionCounter, typename Stat, typename Scan>
+            void snapshot_scan( VersionCounter& counter, Stat& st, Scan scan )
+            {
+                typename VersionCounter::read_state rs;
+                for ( unsigned int nAttempt = 0; nAttempt < VersionCounter::c_nOptimisticAttempts; ++nAttempt ) {
+                    if ( counter.begin_read( rs )) {
+                        scan();
+                        if ( counter.validate( rs ))
+                            return;
+                    }
+                    st.onSnapshotRetry();
+                }
+
+                st.onSnapshotExclusive();
+                exclusive_scope<VersionCounter> es( counter );
+                scan();
+            }
+
+            // Transforms the comparator so that items equal to the key are treated as less than the key.
+            // Searching a position with such comparator finds the first item greater than the key.
+            template <typename Compare>
+            struct upper_bound_compare: public Compare
+            {
+                template <typename T, typename Q>
+                int operator()( T const& v, Q const& key ) const
+                {
+                    return Compare::operator()( v, key ) <= 0 ? -1 : 1;
+                }
+            };
+        } // namespace details
+        //@endcond
+
         /// \p SkipListSet internal statistics
         template <typename EventCounter = cds::atomicity::event_counter>
         struct stat {
@@ -419,6 +690,10 @@ namespace cds { namespace intrusive {
             event_counter   m_nExtractMaxRetries    ; ///< Count of retries of \p extract_max call
             event_counter   m_nEraseWhileFind       ; ///< Count of erased item while searching
             event_counter   m_nExtractWhileFind     ; ///< Count of extracted item while searching (RCU only)
+            event_counter   m_nRangeScan            ; ///< Count of \p for_each_in_range() and \p snapshot_range() scans
+            event_counter   m_nRangeReseek          ; ///< Count of range scan restarts from upper levels due to concurrent deletion
+            event_counter   m_nSnapshotRetries      ; ///< Count of \p snapshot_range() retries due to concurrent modification
+            event_counter   m_nSnapshotExclusive    ; ///< Count of \p snapshot_range() calls completed by exclusive scan
 
             //@cond
             void onAddNode( unsigned int nHeight )
@@ -464,6 +739,10 @@ namespace cds { namespace intrusive {
             void onExtractMaxSuccess()      { ++m_nExtractMaxSuccess; }
             void onExtractMaxFailed()       { ++m_nExtractMaxFailed;  }
             void onExtractMaxRetry()        { ++m_nExtractMaxRetries; }
+            void onRangeScan()              { ++m_nRangeScan;         }
+            void onRangeReseek()            { ++m_nRangeReseek;       }
+            void onSnapshotRetry()          { ++m_nSnapshotRetries;   }
+            void onSnapshotExclusive()      { ++m_nSnapshotExclusive; }
 
             //@endcond
         };
@@ -505,6 +784,10 @@ namespace cds { namespace intrusive {
             void onExtractMaxSuccess()      const {}
             void onExtractMaxFailed()       const {}
             void onExtractMaxRetry()        const {}
+            void onRangeScan()              const {}
+            void onRangeReseek()            const {}
+            void onSnapshotRetry()          const {}
+            void onSnapshotExclusive()      const {}
 
             //@endcond
         };
@@ -596,6 +879,14 @@ namespace cds { namespace intrusive {
             */
             typedef empty_stat                      stat;
 
+            /// Version counter for \p SkipListSet::snapshot_range()
+            /**
+                By default, the counter is disabled (\p skip_list::empty_version_counter)
+                and \p snapshot_range() cannot be used.
+                To enable it use \p skip_list::version_counter.
+            */
+            typedef empty_version_counter           snapshot_counter;
+
             /// RCU deadlock checking policy (only for \ref cds_intrusive_SkipListSet_rcu "RCU-based SkipListSet")
             /**
                 List of available options see \p opt::rcu_check_deadlock
@@ -632,6 +923,9 @@ namespace cds { namespace intrusive {
             - \p opt::back_off - back-off strategy, default is \p cds::backoff::Default.
             - \p opt::stat - internal statistics. By default, it is disabled (\p skip_list::empty_stat).
                 To enable it use \p skip_list::stat
+            - \p skip_list::snapshot_counter - version counter required by \p snapshot_range().
+                By default, it is disabled (\p skip_list::empty_version_counter).
+                To enable it use \p skip_list::version_counter
         */
         template <typename... Options>
         struct make_traits {
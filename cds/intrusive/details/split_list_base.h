@@ -108,6 +108,9 @@ namespace cds { namespace intrusive {
             counter_type    m_nInitBucketRecursive;  ///< Count of recursive bucket initialization
             counter_type    m_nInitBucketContention; ///< Count of bucket init contention encountered
             counter_type    m_nBusyWaitBucketInit;   ///< Count of busy wait cycle while a bucket is initialized
+            counter_type    m_nBucketTableShrink;    ///< Count of bucket table shrinking
+            counter_type    m_nHeadNodeUnlinked;     ///< Count of head nodes unlinked by shrinking
+            counter_type    m_nSegmentFreed;         ///< Count of bucket table segments freed by shrinking
 
             //@cond
             void onInsertSuccess()       { ++m_nInsertSuccess; }
@@ -134,6 +137,9 @@ namespace cds { namespace intrusive {
             void onRecursiveInitBucket() { ++m_nInitBucketRecursive; }
             void onBucketInitContenton() { ++m_nInitBucketContention; }
             void onBusyWaitBucketInit()  { ++m_nBusyWaitBucketInit; }
+            void onBucketTableShrink()   { ++m_nBucketTableShrink; }
+            void onHeadNodeUnlinked()    { ++m_nHeadNodeUnlinked; }
+            void onSegmentFreed( size_t nCount ) { m_nSegmentFreed += nCount; }
             //@endcond
         };
 
@@ -157,6 +163,9 @@ namespace cds { namespace intrusive {
             void onRecursiveInitBucket() const {}
             void onBucketInitContenton() const {}
             void onBusyWaitBucketInit()  const {}
+            void onBucketTableShrink()   const {}
+            void onHeadNodeUnlinked()    const {}
+            void onSegmentFreed( size_t ) const {}
             //@endcond
         };
 
@@ -214,6 +223,22 @@ namespace cds { namespace intrusive {
             */
             static const bool dynamic_bucket_table = true;
 
+            /// Can the bucket table shrink
+            /**
+                If \p true, the split-list halves its logical bucket count when the item count
+                drops below a quarter of the current capacity (<tt>bucket_count * load_factor / 4</tt>).
+                The head (dummy) nodes of abandoned buckets are unlinked from the list and retired via GC,
+                the segments of \p split_list::expandable_bucket_table that become empty are freed.
+                Each operation holds an additional guard during the bucket access, and the thread
+                performing the shrinking waits until the operations started before it are completed.
+
+                Shrinking is supported only by \p SplitListSet based on \p gc::HP and \p gc::DHP,
+                other split-list implementations ignore the option.
+
+                Default is \p false.
+            */
+            static const bool shrinkable_bucket_table = false;
+
             /// Back-off strategy
             typedef cds::backoff::Default back_off;
         };
@@ -236,6 +261,24 @@ namespace cds { namespace intrusive {
             //@endcond
         };
 
+        /// [value-option] Split-list shrinkable bucket table option
+        /**
+            The option enables shrinking of the bucket table, see \p traits::shrinkable_bucket_table.
+            Possible values of \p Value are:
+            - \p true - the bucket table shrinks when the item count drops
+            - \p false - the bucket table only grows (the default)
+        */
+        template <bool Value>
+        struct shrinkable_bucket_table
+        {
+            //@cond
+            template <typename Base> struct pack: public Base
+            {
+                enum { shrinkable_bucket_table = Value };
+            };
+            //@endcond
+        };
+
         /// Metafunction converting option list to \p split_list::traits
         /**
             Available \p Options:
@@ -248,6 +291,7 @@ namespace cds { namespace intrusive {
             - \p opt::allocator - optional, bucket table allocator. Default is \ref CDS_DEFAULT_ALLOCATOR.
             - \p split_list::dynamic_bucket_table - use dynamic or static bucket table implementation.
                 Dynamic bucket table expands its size up to maximum bucket count when necessary
+            - \p split_list::shrinkable_bucket_table - enable shrinking of the bucket table, see \p traits::shrinkable_bucket_table.
             - \p opt::back_off - back-off strategy used for spinning, defult is \p cds::backoff::Default.
             - \p opt::stat - internal statistics, default is \p split_list::empty_stat (disabled).
                 To enable internal statistics use \p split_list::stat.
@@ -347,6 +391,13 @@ namespace cds { namespace intrusive {
                 return m_Table[ nBucket ].load(memory_model::memory_order_acquire);
             }
 
+            /// Prefetches the entry of bucket \p nBucket
+            void prefetch( size_t nBucket ) const
+            {
+                assert( nBucket < capacity() );
+                CDS_PREFETCH( m_Table + nBucket );
+            }
+
             /// Set \p pNode as a head of bucket \p nBucket
             void bucket( size_t nBucket, node_type * pNode )
             {
@@ -356,6 +407,23 @@ namespace cds { namespace intrusive {
                 m_Table[ nBucket ].store( pNode, memory_model::memory_order_release );
             }
 
+            /// Clears the head of bucket \p nBucket and returns the previous head
+            node_type * release_bucket( size_t nBucket )
+            {
+                assert( nBucket < capacity() );
+                return m_Table[ nBucket ].exchange( nullptr, memory_model::memory_order_acquire );
+            }
+
+            /// Frees the table segments beyond \p nBucketCount buckets
+            /**
+                The static table has no segments, the function does nothing and returns 0.
+            */
+            size_t release_segments( size_t nBucketCount )
+            {
+                CDS_UNUSED( nBucketCount );
+                return 0;
+            }
+
             /// Returns the capacity of the bucket table
             size_t capacity() const
             {
@@ -545,6 +613,17 @@ namespace cds { namespace intrusive {
                 return pSegment[ nBucket & (m_metrics.nSegmentSize - 1) ].load(memory_model::memory_order_acquire);
             }
 
+            /// Prefetches the entry of bucket \p nBucket
+            void prefetch( size_t nBucket ) const
+            {
+                size_t nSegment = nBucket >> m_metrics.nSegmentSizeLog2;
+                assert( nSegment < m_metrics.nSegmentCount );
+
+                table_entry * pSegment = m_Segments[ nSegment ].load(memory_model::memory_order_relaxed);
+                if ( pSegment != nullptr )
+                    CDS_PREFETCH( pSegment + ( nBucket & (m_metrics.nSegmentSize - 1) ));
+            }
+
             /// Set \p pNode as a head of bucket \p nBucket
             void bucket( size_t nBucket, node_type * pNode )
             {
@@ -562,6 +641,39 @@ namespace cds { namespace intrusive {
                 segment.load(memory_model::memory_order_acquire)[ nBucket & (m_metrics.nSegmentSize - 1) ].store( pNode, memory_model::memory_order_release );
             }
 
+            /// Clears the head of bucket \p nBucket and returns the previous head
+            node_type * release_bucket( size_t nBucket )
+            {
+                size_t nSegment = nBucket >> m_metrics.nSegmentSizeLog2;
+                assert( nSegment < m_metrics.nSegmentCount );
+
+                table_entry * pSegment = m_Segments[ nSegment ].load(memory_model::memory_order_acquire);
+                if ( pSegment == nullptr )
+                    return nullptr;
+                return pSegment[ nBucket & (m_metrics.nSegmentSize - 1) ].exchange( nullptr, memory_model::memory_order_acquire );
+            }
+
+            /// Frees the segments that contain only the buckets beyond \p nBucketCount
+            /**
+                The caller must guarantee that nobody accesses the buckets starting from \p nBucketCount
+                and that all of them are released.
+                The segment will be allocated again when one of its buckets is initialized.
+
+                Returns the number of freed segments.
+            */
+            size_t release_segments( size_t nBucketCount )
+            {
+                size_t nFreed = 0;
+                for ( size_t nSegment = ( nBucketCount + m_metrics.nSegmentSize - 1 ) >> m_metrics.nSegmentSizeLog2; nSegment < m_metrics.nSegmentCount; ++nSegment ) {
+                    table_entry * pSegment = m_Segments[ nSegment ].exchange( nullptr, memory_model::memory_order_acquire );
+                    if ( pSegment != nullptr ) {
+                        destroy_segment( pSegment );
+                        ++nFreed;
+                    }
+                }
+                return nFreed;
+            }
+
             /// Returns the capacity of the bucket table
             size_t capacity() const
             {
@@ -657,6 +769,93 @@ namespace cds { namespace intrusive {
                 typedef static_bucket_table<GC, Node, Options...>    type;
             };
 
+            /// Quiescence barrier for bucket table shrinking
+            /**
+                Each operation accessing a bucket holds a GC guard on the current epoch token.
+                \p synchronize() replaces the token and retires the old one, the GC disposes it
+                only when no operation started in the old epoch is running.
+            */
+            template <typename GC, bool Shrinkable>
+            class bucket_epoch
+            {
+                struct token {
+                    atomics::atomic<bool> * m_pDisposed;
+                };
+                typedef cds::details::Allocator< token > token_allocator;
+
+                struct token_disposer {
+                    void operator()( token * p )
+                    {
+                        atomics::atomic<bool> * pDisposed = p->m_pDisposed;
+                        token_allocator().Delete( p );
+                        pDisposed->store( true, atomics::memory_order_release );
+                    }
+                };
+
+                atomics::atomic<token *> m_pToken;
+                atomics::atomic<bool>    m_bDisposed;
+
+                token * alloc_token()
+                {
+                    token * p = token_allocator().New();
+                    p->m_pDisposed = &m_bDisposed;
+                    return p;
+                }
+
+            public:
+                class guard
+                {
+                    typename GC::Guard m_Guard;
+                public:
+                    explicit guard( bucket_epoch& epoch )
+                    {
+                        m_Guard.protect( epoch.m_pToken );
+                    }
+                };
+
+                bucket_epoch()
+                    : m_pToken( alloc_token())
+                    , m_bDisposed( false )
+                {}
+
+                ~bucket_epoch()
+                {
+                    token_allocator().Delete( m_pToken.load( atomics::memory_order_relaxed ));
+                }
+
+                // Waits until all operations started before the call are completed.
+                // Only one thread may call the function at a time; the caller must not hold a guard.
+                template <typename BackOff>
+                void synchronize()
+                {
+                    m_bDisposed.store( false, atomics::memory_order_relaxed );
+                    token * pOld = m_pToken.exchange( alloc_token(), atomics::memory_order_seq_cst );
+                    GC::template retire<token_disposer>( pOld );
+
+                    BackOff bkoff;
+                    while ( !m_bDisposed.load( atomics::memory_order_acquire )) {
+                        GC::scan();
+                        bkoff();
+                    }
+                }
+            };
+
+            template <typename GC>
+            class bucket_epoch< GC, false >
+            {
+            public:
+                class guard
+                {
+                public:
+                    explicit guard( bucket_epoch& )
+                    {}
+                };
+
+                template <typename BackOff>
+                void synchronize()
+                {}
+            };
+
             template <typename GC, class Alloc >
             struct dummy_node_disposer {
                 template <typename Node>
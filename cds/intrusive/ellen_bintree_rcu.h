@@ -32,6 +32,7 @@
 #define CDSLIB_INTRUSIVE_ELLEN_BINTREE_RCU_H
 
 #include <memory>
+#include <vector>
 #include <cds/intrusive/details/ellen_bintree_base.h>
 #include <cds/opt/compare.h>
 #include <cds/details/binary_functor_wrapper.h>
@@ -509,6 +510,7 @@ namespace cds { namespace intrusive {
         typedef typename traits::update_desc_allocator update_desc_allocator; ///< Update descriptor allocator
 
         typedef typename gc::scoped_lock    rcu_lock;   ///< RCU scoped lock
+        typedef typename gc::batch_lock     rcu_batch_lock; ///< RCU batch lock for a sequence of lookups
 
         static CDS_CONSTEXPR const bool c_bExtractLockExternal = false; ///< Group of \p extract_xxx functions do not require external locking
 
@@ -1106,6 +1108,19 @@ namespace cds { namespace intrusive {
         }
         //@endcond
 
+        /// Checks whether the set contains \p key, batch version
+        /**
+            The function is an analog of \p contains(Q const&) but it does not lock RCU:
+            the caller holds the batch lock \p bl that covers a sequence of lookups.
+            Before searching the function calls <tt>bl.step()</tt> that can leave RCU critical section
+            for a moment if some thread is waiting in \p synchronize().
+        */
+        template <typename Q>
+        bool contains( rcu_batch_lock& bl, Q const& key ) const
+        {
+            return find_batch_( bl, key, []( value_type&, Q const& ) {} );
+        }
+
         /// Checks whether the set contains \p key using \p pred predicate for searching
         /**
             The function is similar to <tt>contains( key )</tt> but \p pred is used for key comparing.
@@ -1176,6 +1191,24 @@ namespace cds { namespace intrusive {
         }
         //@endcond
 
+        /// Finds the key \p key, batch version
+        /**
+            The function is an analog of \ref cds_intrusive_EllenBinTree_rcu_find_func "find(Q&, Func)"
+            but it does not lock RCU, see \p contains( rcu_batch_lock&, Q const& ).
+        */
+        template <typename Q, typename Func>
+        bool find( rcu_batch_lock& bl, Q& key, Func f ) const
+        {
+            return find_batch_( bl, key, f );
+        }
+        //@cond
+        template <typename Q, typename Func>
+        bool find( rcu_batch_lock& bl, Q const& key, Func f ) const
+        {
+            return find_batch_( bl, key, f );
+        }
+        //@endcond
+
         /// Finds the key \p key with comparing functor \p pred
         /**
             The function is an analog of \ref cds_intrusive_EllenBinTree_rcu_find_func "find(Q&, Func)"
@@ -1234,6 +1267,50 @@ namespace cds { namespace intrusive {
             return get_( key, compare_functor());
         }
 
+        /// Calls \p f for each item with key in range <tt>[lo, hi)</tt> in ascending key order
+        /** @anchor cds_intrusive_EllenBinTree_rcu_for_each_in_range
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( value_type& item );
+            };
+            \endcode
+
+            The whole scan is performed inside a single RCU read-side critical section,
+            so the leaves visited cannot be freed while the scan is in progress.
+            The scan walks the leaves in-order keeping a stack of the internal nodes
+            where the path from the root turns left. If the next internal node popped from the stack
+            has been marked as removed by a concurrent \p erase(), the scan re-searches its position from the root
+            by the last key visited. Each key is visited at most once and the keys are visited
+            in strictly ascending order. The items that are present in the tree during the whole scan
+            are visited; the items inserted or removed concurrently may be visited or not.
+
+            The functor must not modify the tree.
+
+            The function applies RCU lock internally.
+        */
+        template <typename Q, typename Func>
+        void for_each_in_range( Q const& lo, Q const& hi, Func f ) const
+        {
+            node_compare cmp;
+            rcu_lock l;
+            scan_( &lo, cmp, [&hi, &cmp]( value_type const& v ) -> bool { return cmp( v, hi ) < 0; }, f );
+        }
+
+        /// Calls \p f for each item of the tree in ascending key order
+        /**
+            The function is an analog of \ref cds_intrusive_EllenBinTree_rcu_for_each_in_range "for_each_in_range()"
+            that visits the whole tree.
+
+            The function applies RCU lock internally.
+        */
+        template <typename Func>
+        void for_each( Func f ) const
+        {
+            rcu_lock l;
+            scan_( static_cast<value_type const *>( nullptr ), node_compare(), []( value_type const& ) -> bool { return true; }, f );
+        }
+
         /// Checks if the tree is empty
         bool empty() const
         {
@@ -1517,6 +1594,79 @@ namespace cds { namespace intrusive {
             return nCmp == 0;
         }
 
+        // Descends to the leaf for \p key pushing onto \p stack the internal nodes where the path turns left
+        template <typename Q, typename Compare>
+        leaf_node * scan_seek_( std::vector< internal_node * >& stack, Q const& key, Compare cmp ) const
+        {
+            stack.clear();
+            tree_node * pNode = const_cast<internal_node *>( &m_Root );
+            while ( pNode->is_internal()) {
+                internal_node * pParent = static_cast<internal_node *>( pNode );
+                bool bRight = cmp( key, *pParent ) >= 0;
+                if ( !bRight )
+                    stack.push_back( pParent );
+                pNode = pParent->get_child( bRight, memory_model::memory_order_acquire );
+            }
+            return static_cast<leaf_node *>( pNode );
+        }
+
+        // Descends to the leftmost leaf of \p pNode subtree
+        leaf_node * scan_leftmost_( std::vector< internal_node * >& stack, tree_node * pNode ) const
+        {
+            while ( pNode->is_internal()) {
+                internal_node * pParent = static_cast<internal_node *>( pNode );
+                stack.push_back( pParent );
+                pNode = pParent->m_pLeft.load( memory_model::memory_order_acquire );
+            }
+            return static_cast<leaf_node *>( pNode );
+        }
+
+        template <typename Q, typename Compare, typename InRange, typename Func>
+        void scan_( Q const * pLo, Compare cmp, InRange in_range, Func f ) const
+        {
+            assert( gc::is_locked());
+
+            std::vector< internal_node * > stack;
+            leaf_node * pLeaf = pLo ? scan_seek_( stack, *pLo, cmp ) : scan_leftmost_( stack, const_cast<internal_node *>( &m_Root ));
+            leaf_node * pLast = nullptr;
+
+            // The leaves with infinite keys are the greatest ones
+            while ( !pLeaf->infinite_key()) {
+                value_type& val = *node_traits::to_value_ptr( pLeaf );
+                if ( !in_range( val ))
+                    break;
+
+                if ( pLast ? cmp( *pLast, *pLeaf ) < 0 : ( !pLo || cmp( *pLo, *pLeaf ) <= 0 )) {
+                    f( val );
+                    pLast = pLeaf;
+                }
+
+                pLeaf = nullptr;
+                while ( !pLeaf && !stack.empty()) {
+                    internal_node * pParent = stack.back();
+                    stack.pop_back();
+
+                    if ( pParent->m_pUpdate.load( memory_model::memory_order_acquire ).bits() == update_desc::Mark ) {
+                        // pParent has been removed from the tree by concurrent erase
+                        m_Stat.onRangeReseek();
+                        if ( pLast )
+                            pLeaf = scan_seek_( stack, *node_traits::to_value_ptr( pLast ), cmp );
+                        else if ( pLo )
+                            pLeaf = scan_seek_( stack, *pLo, cmp );
+                        else {
+                            stack.clear();
+                            pLeaf = scan_leftmost_( stack, const_cast<internal_node *>( &m_Root ));
+                        }
+                    }
+                    else
+                        pLeaf = scan_leftmost_( stack, pParent->m_pRight.load( memory_model::memory_order_acquire ));
+                }
+                if ( !pLeaf )
+                    break;
+            }
+            m_Stat.onRangeScan();
+        }
+
         bool search_min( search_result& res ) const
         {
             assert( gc::is_locked());
@@ -1908,6 +2058,22 @@ namespace cds { namespace intrusive {
         bool find_( Q& key, Func f ) const
         {
             rcu_lock l;
+            return find_locked_( key, f );
+        }
+
+        template <typename Q, typename Func>
+        bool find_batch_( rcu_batch_lock& bl, Q& key, Func f ) const
+        {
+            // RCU is locked by the batch lock
+            bl.step();
+            return find_locked_( key, f );
+        }
+
+        template <typename Q, typename Func>
+        bool find_locked_( Q& key, Func f ) const
+        {
+            assert( gc::is_locked());
+
             search_result    res;
             if ( search( res, key, node_compare())) {
                 assert( res.pLeaf );
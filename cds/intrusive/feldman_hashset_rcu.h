@@ -37,6 +37,7 @@
 
 #include <cds/intrusive/details/feldman_hashset_base.h>
 #include <cds/details/allocator.h>
+#include <cds/algo/prefetch.h>
 #include <cds/urcu/details/check_deadlock.h>
 #include <cds/urcu/exempt_ptr.h>
 #include <cds/intrusive/details/raw_ptr_disposer.h>
@@ -86,10 +87,10 @@ namespace cds { namespace intrusive {
         class Traits
 #endif
     >
-    class FeldmanHashSet< cds::urcu::gc< RCU >, T, Traits >: protected feldman_hashset::multilevel_array<T, Traits>
+    class FeldmanHashSet< cds::urcu::gc< RCU >, T, Traits >: protected feldman_hashset::multilevel_array<T, Traits, feldman_hashset::details::rcu_cell_block< cds::urcu::gc< RCU > > >
     {
         //@cond
-        typedef feldman_hashset::multilevel_array<T, Traits> base_class;
+        typedef feldman_hashset::multilevel_array<T, Traits, feldman_hashset::details::rcu_cell_block< cds::urcu::gc< RCU > > > base_class;
         //@endcond
 
     public:
@@ -119,12 +120,16 @@ namespace cds { namespace intrusive {
         typedef typename base_class::atomic_node_ptr atomic_node_ptr;
         typedef typename base_class::array_node array_node;
         typedef typename base_class::traverse_data traverse_data;
+        typedef typename base_class::block_guard block_guard;
 
         using base_class::to_array;
         using base_class::to_node;
         using base_class::stats;
         using base_class::head;
+        using base_class::end_node;
+        using base_class::end_node_size;
         using base_class::metrics;
+        using base_class::help_moved_slot;
 
         typedef cds::urcu::details::check_deadlock_policy< gc, rcu_check_deadlock> check_deadlock_policy;
         //@endcond
@@ -139,6 +144,8 @@ namespace cds { namespace intrusive {
         /**
             @param head_bits: 2<sup>head_bits</sup> specifies the size of head array, minimum is 4.
             @param array_bits: 2<sup>array_bits</sup> specifies the size of array node, minimum is 2.
+            @param max_head_bits: 2<sup>max_head_bits</sup> specifies the max size of head array,
+                see \ref cds_intrusive_FeldmanHashSet_hp_ctor "FeldmanHashSet( head_bits, array_bits, max_head_bits )".
 
             Equation for \p head_bits and \p array_bits:
             \code
@@ -146,8 +153,8 @@ namespace cds { namespace intrusive {
             \endcode
             where \p N is multi-level array depth.
         */
-        FeldmanHashSet(size_t head_bits = 8, size_t array_bits = 4)
-            : base_class(head_bits, array_bits)
+        FeldmanHashSet(size_t head_bits = 8, size_t array_bits = 4, size_t max_head_bits = 0)
+            : base_class(head_bits, array_bits, max_head_bits)
         {}
 
         /// Destructs the set and frees all data
@@ -187,23 +194,29 @@ namespace cds { namespace intrusive {
 
             The user-defined functor is called only if the inserting is success.
 
-            The function locks RCU internally.
+            The function locks RCU internally. For \p feldman_hashset::compressed_layout RCU should not be locked
+            because the obsolete cell block is retired.
             @warning See \ref cds_intrusive_item_creating "insert item troubleshooting".
         */
         template <typename Func>
         bool insert( value_type& val, Func f )
         {
+            if ( base_class::c_bCompressed )
+                check_deadlock_policy::check();
+
             hash_type const& hash = hash_accessor()( val );
             traverse_data pos( hash, *this );
             hash_comparator cmp;
 
             while (true) {
                 rcu_lock rcuLock;
+                // the array nodes visited under the previous RCU lock may be reclaimed, restart from the current head
+                pos.reset( *this );
 
-                node_ptr slot = base_class::traverse( pos );
+                node_ptr slot = base_class::traverse( pos, typename base_class::slot_loader());
                 assert(slot.bits() == 0);
 
-                if ( pos.pArr->nodes[pos.nSlot].load(memory_model::memory_order_acquire) == slot) {
+                if ( base_class::slot( pos ).load(memory_model::memory_order_acquire) == slot) {
                     if (slot.ptr()) {
                         if ( cmp( hash, hash_accessor()(*slot.ptr())) == 0 ) {
                             // the item with that hash value already exists
@@ -216,8 +229,7 @@ namespace cds { namespace intrusive {
                     }
                     else {
                         // the slot is empty, try to insert data node
-                        node_ptr pNull;
-                        if ( pos.pArr->nodes[pos.nSlot].compare_exchange_strong(pNull, node_ptr(&val), memory_model::memory_order_release, atomics::memory_order_relaxed))
+                        if ( base_class::insert_slot( pos, &val ))
                         {
                             // the new data node has been inserted
                             f(val);
@@ -422,6 +434,45 @@ namespace cds { namespace intrusive {
             return find( hash, [](value_type&) {} );
         }
 
+        /// Finds a batch of hashes
+        /**
+            The function searches each hash from the range <tt>[itFirst, itLast)</tt> and calls the functor \p f
+            for each item found, the functor interface is the same as for \p find().
+            \p Iterator is a forward iterator with \p hash_type value type.
+
+            The first- and then the second-level slots for next hashes are prefetched
+            while the current hash is being searched,
+            see \ref cds_intrusive_FeldmanHashSet_hp_find_batch "FeldmanHashSet::find_batch()".
+            The whole batch is performed under one RCU \p batch_lock
+            that yields periodically if some thread is waiting for grace period.
+            The function should not be called under RCU lock.
+
+            The function returns the number of hashes found.
+        */
+        template <typename Iterator, typename Func>
+        size_t find_batch( Iterator itFirst, Iterator itLast, Func f )
+        {
+            typename gc::batch_lock bl;
+            return cds::algo::prefetch_pipeline< cds::algo::c_nPrefetchDistance, hash_type const * >( itFirst, itLast,
+                [this]( hash_type const& hash ) -> hash_type const * {
+                    base_class::prefetch_slot( hash, 1 );
+                    return &hash;
+                },
+                [this]( hash_type const * pHash ) {
+                    base_class::prefetch_slot( *pHash, 2 );
+                },
+                [this, &f, &bl]( hash_type const& hash, hash_type const * ) -> bool {
+                    bl.step();
+                    value_type * p = search( hash );
+                    if ( p ) {
+                        f( *p );
+                        return true;
+                    }
+                    return false;
+                }
+            );
+        }
+
         /// Finds an item by it's \p hash and returns the item found
         /**
             The function searches the item by its \p hash
@@ -464,7 +515,17 @@ namespace cds { namespace intrusive {
         */
         void clear()
         {
-            clear_array( head(), head_size());
+            {
+                // clear_array() holds the array nodes between RCU locks, so the obsolete heads are not retired until it is done
+                typename base_class::tree_walk walk( *this );
+                typename base_class::head_node * pHead;
+                {
+                    rcu_lock rcuLock;
+                    pHead = base_class::current_head();
+                }
+                clear_array( pHead->pArr, pHead->size());
+            }
+            base_class::retire_heads();
         }
 
         /// Checks if the set is empty
@@ -490,7 +551,12 @@ namespace cds { namespace intrusive {
         }
 
         /// Returns the size of head node
-        using base_class::head_size;
+        size_t head_size() const
+        {
+            // the head may be reclaimed by RCU when it is expanded
+            rcu_lock rcuLock;
+            return base_class::head_size();
+        }
 
         /// Returns the size of the array node
         using base_class::array_node_size;
@@ -500,6 +566,8 @@ namespace cds { namespace intrusive {
         */
         void get_level_statistics(std::vector<feldman_hashset::level_statistics>& stat) const
         {
+            // the cell blocks of compressed array nodes are reclaimed by RCU
+            rcu_lock rcuLock;
             base_class::get_level_statistics(stat);
         }
 
@@ -591,14 +659,22 @@ namespace cds { namespace intrusive {
                 assert(m_pNode != nullptr);
 
                 size_t const arrayNodeSize = m_set->array_node_size();
-                size_t const headSize = m_set->head_size();
                 array_node * pNode = m_pNode;
                 size_t idx = m_idx + 1;
-                size_t nodeSize = m_pNode->pParent ? arrayNodeSize : headSize;
+                size_t nodeSize;
+                if (m_idx == size_t(0) - 1) {
+                    // begin of iteration - start from the current head
+                    typename base_class::head_node * pHead = m_set->current_head();
+                    pNode = pHead->pArr;
+                    nodeSize = pHead->size();
+                }
+                else
+                    nodeSize = m_set->node_size(pNode);
 
+                block_guard bg;
                 for (;;) {
                     if (idx < nodeSize) {
-                        node_ptr slot = pNode->nodes[idx].load(memory_model::memory_order_acquire);
+                        node_ptr slot = m_set->load_slot( pNode, idx, bg );
                         if (slot.bits() == base_class::flag_array_node ) {
                             // array node, go down the tree
                             assert(slot.ptr() != nullptr);
@@ -610,6 +686,11 @@ namespace cds { namespace intrusive {
                             // the slot is converting to array node right now - skip the node
                             ++idx;
                         }
+                        else if (slot.bits() == base_class::flag_array_moved ) {
+                            // the cell of the expanded head is migrated on demand, the cell of obsolete node is skipped
+                            if (!help_moved_slot(pNode, idx))
+                                ++idx;
+                        }
                         else {
                             if (slot.ptr()) {
                                 // data node
@@ -623,17 +704,16 @@ namespace cds { namespace intrusive {
                     }
                     else {
                         // up to parent node
-                        if (pNode->pParent) {
-                            idx = pNode->idxParent + 1;
-                            pNode = pNode->pParent;
-                            nodeSize = pNode->pParent ? arrayNodeSize : headSize;
+                        array_node * pParent = pNode->parent();
+                        if (pParent) {
+                            idx = pNode->parent_index() + 1;
+                            pNode = pParent;
+                            nodeSize = m_set->node_size(pNode);
                         }
                         else {
                             // end()
-                            assert(pNode == m_set->head());
-                            assert(idx == headSize);
-                            m_pNode = pNode;
-                            m_idx = idx;
+                            m_pNode = m_set->end_node();
+                            m_idx = m_set->end_node_size();
                             m_pValue = nullptr;
                             return;
                         }
@@ -648,16 +728,23 @@ namespace cds { namespace intrusive {
                 assert(m_pNode != nullptr);
 
                 size_t const arrayNodeSize = m_set->array_node_size();
-                size_t const headSize = m_set->head_size();
                 size_t const endIdx = size_t(0) - 1;
 
                 array_node * pNode = m_pNode;
                 size_t idx = m_idx - 1;
-                size_t nodeSize = m_pNode->pParent ? arrayNodeSize : headSize;
+                size_t nodeSize = m_set->node_size(pNode);
+                if (!pNode->parent() && m_idx >= nodeSize) {
+                    // begin of reverse iteration - start from the current head
+                    typename base_class::head_node * pHead = m_set->current_head();
+                    pNode = pHead->pArr;
+                    nodeSize = pHead->size();
+                    idx = nodeSize - 1;
+                }
 
+                block_guard bg;
                 for (;;) {
-                    if (idx != endIdx) {
-                        node_ptr slot = pNode->nodes[idx].load(memory_model::memory_order_acquire);
+                    if (idx < nodeSize) {
+                        node_ptr slot = m_set->load_slot( pNode, idx, bg );
                         if (slot.bits() == base_class::flag_array_node ) {
                             // array node, go down the tree
                             assert(slot.ptr() != nullptr);
@@ -669,6 +756,11 @@ namespace cds { namespace intrusive {
                             // the slot is converting to array node right now - skip the node
                             --idx;
                         }
+                        else if (slot.bits() == base_class::flag_array_moved ) {
+                            // the cell of the expanded head is migrated on demand, the cell of obsolete node is skipped
+                            if (!help_moved_slot(pNode, idx))
+                                --idx;
+                        }
                         else {
                             if (slot.ptr()) {
                                 // data node
@@ -682,47 +774,52 @@ namespace cds { namespace intrusive {
                     }
                     else {
                         // up to parent node
-                        if (pNode->pParent) {
-                            idx = pNode->idxParent - 1;
-                            pNode = pNode->pParent;
-                            nodeSize = pNode->pParent ? arrayNodeSize : headSize;
+                        array_node * pParent = pNode->parent();
+                        if (pParent) {
+                            idx = pNode->parent_index() - 1;
+                            pNode = pParent;
+                            nodeSize = m_set->node_size(pNode);
                         }
                         else {
                             // rend()
-                            assert(pNode == m_set->head());
-                            assert(idx == endIdx);
-                            m_pNode = pNode;
-                            m_idx = idx;
+                            m_pNode = m_set->end_node();
+                            m_idx = endIdx;
                             m_pValue = nullptr;
                             return;
                         }
                     }
                 }
             }
+
+            bool help_moved_slot(array_node * pNode, size_t idx)
+            {
+                typename base_class::slot_loader loader;
+                return const_cast<FeldmanHashSet *>(m_set)->help_moved_slot(pNode, idx, loader);
+            }
         };
 
         template <class Iterator>
         Iterator init_begin() const
         {
-            return Iterator(*this, head(), size_t(0) - 1);
+            return Iterator(*this, end_node(), size_t(0) - 1);
         }
 
         template <class Iterator>
         Iterator init_end() const
         {
-            return Iterator(*this, head(), head_size(), false);
+            return Iterator(*this, end_node(), end_node_size(), false);
         }
 
         template <class Iterator>
         Iterator init_rbegin() const
         {
-            return Iterator(*this, head(), head_size());
+            return Iterator(*this, end_node(), end_node_size());
         }
 
         template <class Iterator>
         Iterator init_rend() const
         {
-            return Iterator(*this, head(), size_t(0) - 1, false);
+            return Iterator(*this, end_node(), size_t(0) - 1, false);
         }
 
         /// Bidirectional iterator class
@@ -950,55 +1047,55 @@ namespace cds { namespace intrusive {
         /// Returns an iterator to the beginning of the set
         iterator begin()
         {
-            return iterator(*this, head(), size_t(0) - 1);
+            return iterator(*this, end_node(), size_t(0) - 1);
         }
 
         /// Returns an const iterator to the beginning of the set
         const_iterator begin() const
         {
-            return const_iterator(*this, head(), size_t(0) - 1);
+            return const_iterator(*this, end_node(), size_t(0) - 1);
         }
 
         /// Returns an const iterator to the beginning of the set
         const_iterator cbegin()
         {
-            return const_iterator(*this, head(), size_t(0) - 1);
+            return const_iterator(*this, end_node(), size_t(0) - 1);
         }
 
         /// Returns an iterator to the element following the last element of the set. This element acts as a placeholder; attempting to access it results in undefined behavior.
         iterator end()
         {
-            return iterator(*this, head(), head_size(), false);
+            return iterator(*this, end_node(), end_node_size(), false);
         }
 
         /// Returns a const iterator to the element following the last element of the set. This element acts as a placeholder; attempting to access it results in undefined behavior.
         const_iterator end() const
         {
-            return const_iterator(*this, head(), head_size(), false);
+            return const_iterator(*this, end_node(), end_node_size(), false);
         }
 
         /// Returns a const iterator to the element following the last element of the set. This element acts as a placeholder; attempting to access it results in undefined behavior.
         const_iterator cend()
         {
-            return const_iterator(*this, head(), head_size(), false);
+            return const_iterator(*this, end_node(), end_node_size(), false);
         }
 
         /// Returns a reverse iterator to the first element of the reversed set
         reverse_iterator rbegin()
         {
-            return reverse_iterator(*this, head(), head_size());
+            return reverse_iterator(*this, end_node(), end_node_size());
         }
 
         /// Returns a const reverse iterator to the first element of the reversed set
         const_reverse_iterator rbegin() const
         {
-            return const_reverse_iterator(*this, head(), head_size());
+            return const_reverse_iterator(*this, end_node(), end_node_size());
         }
 
         /// Returns a const reverse iterator to the first element of the reversed set
         const_reverse_iterator crbegin()
         {
-            return const_reverse_iterator(*this, head(), head_size());
+            return const_reverse_iterator(*this, end_node(), end_node_size());
         }
 
         /// Returns a reverse iterator to the element following the last element of the reversed set
@@ -1008,7 +1105,7 @@ namespace cds { namespace intrusive {
         */
         reverse_iterator rend()
         {
-            return reverse_iterator(*this, head(), size_t(0) - 1, false);
+            return reverse_iterator(*this, end_node(), size_t(0) - 1, false);
         }
 
         /// Returns a const reverse iterator to the element following the last element of the reversed set
@@ -1018,7 +1115,7 @@ namespace cds { namespace intrusive {
         */
         const_reverse_iterator rend() const
         {
-            return const_reverse_iterator(*this, head(), size_t(0) - 1, false);
+            return const_reverse_iterator(*this, end_node(), size_t(0) - 1, false);
         }
 
         /// Returns a const reverse iterator to the element following the last element of the reversed set
@@ -1028,7 +1125,7 @@ namespace cds { namespace intrusive {
         */
         const_reverse_iterator crend()
         {
-            return const_reverse_iterator(*this, head(), size_t(0) - 1, false);
+            return const_reverse_iterator(*this, end_node(), size_t(0) - 1, false);
         }
         ///@}
 
@@ -1037,6 +1134,9 @@ namespace cds { namespace intrusive {
         template <typename Func>
         std::pair<bool, bool> do_update(value_type& val, Func f, bool bInsert = true)
         {
+            if ( base_class::c_bCompressed && bInsert )
+                check_deadlock_policy::check();
+
             hash_type const& hash = hash_accessor()(val);
             traverse_data pos( hash, *this );
             hash_comparator cmp;
@@ -1044,12 +1144,14 @@ namespace cds { namespace intrusive {
 
             while ( true ) {
                 rcu_lock rcuLock;
+                // the array nodes visited under the previous RCU lock may be reclaimed, restart from the current head
+                pos.reset( *this );
 
-                node_ptr slot = base_class::traverse( pos );
+                node_ptr slot = base_class::traverse( pos, typename base_class::slot_loader());
                 assert(slot.bits() == 0);
 
                 pOld = nullptr;
-                if ( pos.pArr->nodes[pos.nSlot].load(memory_model::memory_order_acquire) == slot) {
+                if ( base_class::slot( pos ).load(memory_model::memory_order_acquire) == slot) {
                     if ( slot.ptr()) {
                         if ( cmp( hash, hash_accessor()(*slot.ptr())) == 0 ) {
                             // the item with that hash value already exists
@@ -1059,7 +1161,7 @@ namespace cds { namespace intrusive {
                                 return std::make_pair(true, false);
                             }
 
-                            if ( pos.pArr->nodes[pos.nSlot].compare_exchange_strong(slot, node_ptr(&val), memory_model::memory_order_release, atomics::memory_order_relaxed)) {
+                            if ( base_class::slot( pos ).compare_exchange_strong(slot, node_ptr(&val), memory_model::memory_order_release, atomics::memory_order_relaxed)) {
                                 // slot can be disposed
                                 f( val, slot.ptr());
                                 pOld = slot.ptr();
@@ -1083,8 +1185,7 @@ namespace cds { namespace intrusive {
                     else {
                         // the slot is empty, try to insert data node
                         if (bInsert) {
-                            node_ptr pNull;
-                            if ( pos.pArr->nodes[pos.nSlot].compare_exchange_strong(pNull, node_ptr(&val), memory_model::memory_order_release, atomics::memory_order_relaxed))
+                            if ( base_class::insert_slot( pos, &val ))
                             {
                                 // the new data node has been inserted
                                 f(val, nullptr);
@@ -1124,14 +1225,14 @@ namespace cds { namespace intrusive {
             hash_comparator cmp;
 
             while ( true ) {
-                node_ptr slot = base_class::traverse( pos );
+                node_ptr slot = base_class::traverse( pos, typename base_class::slot_loader());
                 assert( slot.bits() == 0 );
 
-                if ( pos.pArr->nodes[pos.nSlot].load( memory_model::memory_order_acquire ) == slot ) {
+                if ( base_class::slot( pos ).load( memory_model::memory_order_acquire ) == slot ) {
                     if ( slot.ptr()) {
                         if ( cmp( hash, hash_accessor()(*slot.ptr())) == 0 && pred( *slot.ptr())) {
                             // item found - replace it with nullptr
-                            if ( pos.pArr->nodes[pos.nSlot].compare_exchange_strong( slot, node_ptr( nullptr ), memory_model::memory_order_acquire, atomics::memory_order_relaxed )) {
+                            if ( base_class::slot( pos ).compare_exchange_strong( slot, node_ptr( nullptr ), memory_model::memory_order_acquire, atomics::memory_order_relaxed )) {
                                 --m_ItemCounter;
                                 stats().onEraseSuccess();
 
@@ -1161,10 +1262,10 @@ namespace cds { namespace intrusive {
             hash_comparator cmp;
 
             while ( true ) {
-                node_ptr slot = base_class::traverse( pos );
+                node_ptr slot = base_class::traverse( pos, typename base_class::slot_loader());
                 assert( slot.bits() == 0 );
 
-                if ( pos.pArr->nodes[pos.nSlot].load( memory_model::memory_order_acquire ) != slot ) {
+                if ( base_class::slot( pos ).load( memory_model::memory_order_acquire ) != slot ) {
                     // slot value has been changed - retry
                     stats().onSlotChanged();
                     continue;
@@ -1187,40 +1288,58 @@ namespace cds { namespace intrusive {
         {
             back_off bkoff;
 
-
-            for (atomic_node_ptr * pArr = pArrNode->nodes, *pLast = pArr + nSize; pArr != pLast; ++pArr) {
+            for (size_t idx = 0; idx < nSize; ++idx) {
                 while (true) {
-                    node_ptr slot = pArr->load(memory_model::memory_order_acquire);
-                    if (slot.bits() == base_class::flag_array_node ) {
-                        // array node, go down the tree
-                        assert(slot.ptr() != nullptr);
-                        clear_array(to_array(slot.ptr()), array_node_size());
-                        break;
-                    }
-                    else if (slot.bits() == base_class::flag_array_converting ) {
-                        // the slot is converting to array node right now
-                        while ((slot = pArr->load(memory_model::memory_order_acquire)).bits() == base_class::flag_array_converting ) {
-                            bkoff();
-                            stats().onSlotConverting();
+                    node_ptr slot;
+                    bool bUnlinked = false;
+                    {
+                        // the cell block of compressed array node may be reclaimed, so it is accessed under RCU lock
+                        rcu_lock rcuLock;
+                        block_guard bg;
+                        atomic_node_ptr * pArr = base_class::slot_ptr(pArrNode, idx, bg);
+                        if (!pArr) {
+                            // absent cell of compressed array node
+                            break;
                         }
-                        bkoff.reset();
+                        slot = pArr->load(memory_model::memory_order_acquire);
+                        if (slot.bits() == base_class::flag_array_converting ) {
+                            // the slot is converting to array node right now
+                            while ((slot = pArr->load(memory_model::memory_order_acquire)).bits() == base_class::flag_array_converting ) {
+                                bkoff();
+                                stats().onSlotConverting();
+                            }
+                            bkoff.reset();
 
+                            assert(slot.ptr() != nullptr);
+                            assert(slot.bits() == base_class::flag_array_node );
+                        }
+                        else if (slot.bits() == base_class::flag_array_moved ) {
+                            // the cell of the expanded head is not migrated yet, or the node is obsolete
+                            typename base_class::slot_loader loader;
+                            if (help_moved_slot(pArrNode, idx, loader))
+                                continue;
+                            break;
+                        }
+                        else if (slot.bits() == 0) {
+                            // data node
+                            bUnlinked = pArr->compare_exchange_strong(slot, node_ptr(), memory_model::memory_order_acquire, atomics::memory_order_relaxed);
+                            if (!bUnlinked)
+                                continue;
+                        }
+                    }
+
+                    if (slot.bits() == base_class::flag_array_node ) {
+                        // array node, go down the tree
                         assert(slot.ptr() != nullptr);
-                        assert(slot.bits() == base_class::flag_array_node );
                         clear_array(to_array(slot.ptr()), array_node_size());
-                        break;
                     }
-                    else {
-                        // data node
-                        if (pArr->compare_exchange_strong(slot, node_ptr(), memory_model::memory_order_acquire, atomics::memory_order_relaxed)) {
-                            if (slot.ptr()) {
-                                gc::template retire_ptr<disposer>(slot.ptr());
-                                --m_ItemCounter;
-                                stats().onEraseSuccess();
-                            }
-                            break;
-                        }
+                    else if (bUnlinked && slot.ptr()) {
+                        // retire_ptr must be called only outside of RCU lock
+                        gc::template retire_ptr<disposer>(slot.ptr());
+                        --m_ItemCounter;
+                        stats().onEraseSuccess();
                     }
+                    break;
                 }
             }
         }
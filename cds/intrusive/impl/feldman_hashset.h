@@ -37,6 +37,7 @@
 
 #include <cds/intrusive/details/feldman_hashset_base.h>
 #include <cds/details/allocator.h>
+#include <cds/algo/prefetch.h>
 
 namespace cds { namespace intrusive {
     /// Intrusive hash set based on multi-level array
@@ -118,10 +119,10 @@ namespace cds { namespace intrusive {
        ,typename Traits
 #endif
     >
-    class FeldmanHashSet: protected feldman_hashset::multilevel_array<T, Traits>
+    class FeldmanHashSet: protected feldman_hashset::multilevel_array<T, Traits, feldman_hashset::details::guarded_cell_block< GC > >
     {
         //@cond
-        typedef feldman_hashset::multilevel_array<T, Traits> base_class;
+        typedef feldman_hashset::multilevel_array<T, Traits, feldman_hashset::details::guarded_cell_block< GC > > base_class;
         //@endcond
 
     public:
@@ -143,7 +144,13 @@ namespace cds { namespace intrusive {
         typedef typename gc::template guarded_ptr< value_type > guarded_ptr; ///< Guarded pointer
 
         /// Count of hazard pointers required
-        static CDS_CONSTEXPR size_t const c_nHazardPtrCount = 2;
+        /**
+            \p feldman_hashset::compressed_layout requires one more hazard pointer for the cell block.
+            If \p feldman_hashset::traits::head_growth is enabled three more hazard pointers protect the head nodes:
+            the head of the operation, the head that is met when the slot is moved to the expanded head,
+            and the previous head that is being migrated.
+        */
+        static CDS_CONSTEXPR size_t const c_nHazardPtrCount = 2 + ( base_class::c_bCompressed ? 1 : 0 ) + ( base_class::c_bHeadGrowth ? 3 : 0 );
 
     protected:
         //@cond
@@ -151,12 +158,37 @@ namespace cds { namespace intrusive {
         typedef typename base_class::atomic_node_ptr atomic_node_ptr;
         typedef typename base_class::array_node array_node;
         typedef typename base_class::traverse_data traverse_data;
+        typedef typename base_class::block_guard block_guard;
+        typedef typename base_class::head_guard head_guard;
 
         using base_class::to_array;
         using base_class::to_node;
         using base_class::stats;
         using base_class::head;
+        using base_class::end_node;
+        using base_class::end_node_size;
         using base_class::metrics;
+        using base_class::help_moved_slot;
+
+        // Protects the data node of a slot by hazard pointer when the thread helps to migrate the expanded head node
+        struct guard_protector {
+            typename gc::Guard& guard;
+
+            node_ptr operator()( atomic_node_ptr& slot ) const
+            {
+                return guard.protect( slot, []( node_ptr p ) -> value_type * { return p.ptr(); });
+            }
+        };
+
+        template <size_t Count>
+        struct guard_array_protector {
+            typename gc::template GuardArray<Count>& guards;
+
+            node_ptr operator()( atomic_node_ptr& slot ) const
+            {
+                return guards.protect( 0, slot, []( node_ptr p ) -> value_type * { return p.ptr(); });
+            }
+        };
         //@endcond
 
     protected:
@@ -169,6 +201,7 @@ namespace cds { namespace intrusive {
             array_node *        m_pNode;    ///< current array node
             size_t              m_idx;      ///< current position in m_pNode
             typename gc::Guard  m_guard;    ///< HP guard
+            head_guard          m_headGuard; ///< guard of the head the iteration is started from
             FeldmanHashSet const*  m_set;    ///< Hash set
 
         public:
@@ -184,6 +217,7 @@ namespace cds { namespace intrusive {
                 , m_set( rhs.m_set )
             {
                 m_guard.copy( rhs.m_guard );
+                m_headGuard.copy( rhs.m_headGuard );
             }
 
             iterator_base& operator=(iterator_base const& rhs) CDS_NOEXCEPT
@@ -192,6 +226,7 @@ namespace cds { namespace intrusive {
                 m_idx = rhs.m_idx;
                 m_set = rhs.m_set;
                 m_guard.copy( rhs.m_guard );
+                m_headGuard.copy( rhs.m_headGuard );
                 return *this;
             }
 
@@ -248,14 +283,22 @@ namespace cds { namespace intrusive {
                 assert( m_pNode != nullptr );
 
                 size_t const arrayNodeSize = m_set->array_node_size();
-                size_t const headSize = m_set->head_size();
                 array_node * pNode = m_pNode;
                 size_t idx = m_idx + 1;
-                size_t nodeSize = m_pNode->pParent? arrayNodeSize : headSize;
+                size_t nodeSize;
+                if ( m_idx == size_t(0) - 1 ) {
+                    // begin of iteration - start from the current head
+                    typename base_class::head_node * pHead = m_set->current_head( m_headGuard );
+                    pNode = pHead->pArr;
+                    nodeSize = pHead->size();
+                }
+                else
+                    nodeSize = m_set->node_size( pNode );
 
+                block_guard bg;
                 for ( ;; ) {
                     if ( idx < nodeSize ) {
-                        node_ptr slot = pNode->nodes[idx].load( memory_model::memory_order_acquire );
+                        node_ptr slot = m_set->load_slot( pNode, idx, bg );
                         if ( slot.bits() == base_class::flag_array_node ) {
                             // array node, go down the tree
                             assert( slot.ptr() != nullptr );
@@ -267,10 +310,15 @@ namespace cds { namespace intrusive {
                             // the slot is converting to array node right now - skip the node
                             ++idx;
                         }
+                        else if ( slot.bits() == base_class::flag_array_moved ) {
+                            // the cell of the expanded head is migrated on demand, the cell of obsolete node is skipped
+                            if ( !help_moved_slot( pNode, idx ))
+                                ++idx;
+                        }
                         else {
                             if ( slot.ptr()) {
                                 // data node
-                                if ( m_guard.protect( pNode->nodes[idx], [](node_ptr p) -> value_type * { return p.ptr(); }) == slot ) {
+                                if ( m_guard.protect( m_set->slot( pNode, idx, bg ), [](node_ptr p) -> value_type * { return p.ptr(); }) == slot ) {
                                     m_pNode = pNode;
                                     m_idx = idx;
                                     return;
@@ -281,17 +329,16 @@ namespace cds { namespace intrusive {
                     }
                     else {
                         // up to parent node
-                        if ( pNode->pParent ) {
-                            idx = pNode->idxParent + 1;
-                            pNode = pNode->pParent;
-                            nodeSize = pNode->pParent ? arrayNodeSize : headSize;
+                        array_node * pParent = pNode->parent();
+                        if ( pParent ) {
+                            idx = pNode->parent_index() + 1;
+                            pNode = pParent;
+                            nodeSize = m_set->node_size( pNode );
                         }
                         else {
                             // end()
-                            assert( pNode == m_set->head());
-                            assert( idx == headSize );
-                            m_pNode = pNode;
-                            m_idx = idx;
+                            m_pNode = m_set->end_node();
+                            m_idx = m_set->end_node_size();
                             return;
                         }
                     }
@@ -304,16 +351,23 @@ namespace cds { namespace intrusive {
                 assert( m_pNode != nullptr );
 
                 size_t const arrayNodeSize = m_set->array_node_size();
-                size_t const headSize = m_set->head_size();
                 size_t const endIdx = size_t(0) - 1;
 
                 array_node * pNode = m_pNode;
                 size_t idx = m_idx - 1;
-                size_t nodeSize = m_pNode->pParent? arrayNodeSize : headSize;
+                size_t nodeSize = m_set->node_size( pNode );
+                if ( !pNode->parent() && m_idx >= nodeSize ) {
+                    // begin of reverse iteration - start from the current head
+                    typename base_class::head_node * pHead = m_set->current_head( m_headGuard );
+                    pNode = pHead->pArr;
+                    nodeSize = pHead->size();
+                    idx = nodeSize - 1;
+                }
 
+                block_guard bg;
                 for ( ;; ) {
-                    if ( idx != endIdx ) {
-                        node_ptr slot = pNode->nodes[idx].load( memory_model::memory_order_acquire );
+                    if ( idx < nodeSize ) {
+                        node_ptr slot = m_set->load_slot( pNode, idx, bg );
                         if ( slot.bits() == base_class::flag_array_node ) {
                             // array node, go down the tree
                             assert( slot.ptr() != nullptr );
@@ -325,10 +379,15 @@ namespace cds { namespace intrusive {
                             // the slot is converting to array node right now - skip the node
                             --idx;
                         }
+                        else if ( slot.bits() == base_class::flag_array_moved ) {
+                            // the cell of the expanded head is migrated on demand, the cell of obsolete node is skipped
+                            if ( !help_moved_slot( pNode, idx ))
+                                --idx;
+                        }
                         else {
                             if ( slot.ptr()) {
                                 // data node
-                                if ( m_guard.protect( pNode->nodes[idx], [](node_ptr p) -> value_type * { return p.ptr(); }) == slot ) {
+                                if ( m_guard.protect( m_set->slot( pNode, idx, bg ), [](node_ptr p) -> value_type * { return p.ptr(); }) == slot ) {
                                     m_pNode = pNode;
                                     m_idx = idx;
                                     return;
@@ -339,46 +398,51 @@ namespace cds { namespace intrusive {
                     }
                     else {
                         // up to parent node
-                        if ( pNode->pParent ) {
-                            idx = pNode->idxParent - 1;
-                            pNode = pNode->pParent;
-                            nodeSize = pNode->pParent ? arrayNodeSize : headSize;
+                        array_node * pParent = pNode->parent();
+                        if ( pParent ) {
+                            idx = pNode->parent_index() - 1;
+                            pNode = pParent;
+                            nodeSize = m_set->node_size( pNode );
                         }
                         else {
                             // rend()
-                            assert( pNode == m_set->head());
-                            assert( idx == endIdx );
-                            m_pNode = pNode;
-                            m_idx = idx;
+                            m_pNode = m_set->end_node();
+                            m_idx = endIdx;
                             return;
                         }
                     }
                 }
             }
+
+            bool help_moved_slot( array_node * pNode, size_t idx )
+            {
+                guard_protector protect{ m_guard };
+                return const_cast<FeldmanHashSet *>( m_set )->help_moved_slot( pNode, idx, protect );
+            }
         };
 
         template <class Iterator>
         Iterator init_begin() const
         {
-            return Iterator( *this, head(), size_t(0) - 1 );
+            return Iterator( *this, end_node(), size_t(0) - 1 );
         }
 
         template <class Iterator>
         Iterator init_end() const
         {
-            return Iterator( *this, head(), head_size(), false );
+            return Iterator( *this, end_node(), end_node_size(), false );
         }
 
         template <class Iterator>
         Iterator init_rbegin() const
         {
-            return Iterator( *this, head(), head_size());
+            return Iterator( *this, end_node(), end_node_size());
         }
 
         template <class Iterator>
         Iterator init_rend() const
         {
-            return Iterator( *this, head(), size_t(0) - 1, false );
+            return Iterator( *this, end_node(), size_t(0) - 1, false );
         }
 
         /// Bidirectional iterator class
@@ -558,18 +622,30 @@ namespace cds { namespace intrusive {
 
     public:
         /// Creates empty set
-        /**
+        /** @anchor cds_intrusive_FeldmanHashSet_hp_ctor
             @param head_bits: 2<sup>head_bits</sup> specifies the size of head array, minimum is 4.
             @param array_bits: 2<sup>array_bits</sup> specifies the size of array node, minimum is 2.
+            @param max_head_bits: 2<sup>max_head_bits</sup> specifies the max size of head array, see below.
 
             Equation for \p head_bits and \p array_bits:
             \code
             sizeof(hash_type) * 8 == head_bits + N * array_bits
             \endcode
             where \p N is multi-level array depth.
+
+            If \p feldman_hashset::traits::head_growth is enabled and \p max_head_bits is greater than \p head_bits
+            the head array grows online:
+            when a half of head cells is converted to array nodes, the new head with \p array_bits more bits is allocated
+            and the cells of the previous head are migrated to it lazily by the threads visiting them.
+            Each level 1 array node is absorbed by the new head, so the depth of the tree decreases by one.
+            The head is expanded by \p array_bits steps until its size reaches 2<sup>max_head_bits</sup>.
+            By default \p max_head_bits is 0, i.e. the head array is not expanded.
+            If \p head_growth is disabled (the default) \p max_head_bits is ignored.
+            When all cells are migrated the previous head and its absorbed level 1 array nodes are retired through \p GC.
+            The iterators can skip some items if the head is expanded during the iteration.
         */
-        FeldmanHashSet( size_t head_bits = 8, size_t array_bits = 4 )
-            : base_class( head_bits, array_bits )
+        FeldmanHashSet( size_t head_bits = 8, size_t array_bits = 4, size_t max_head_bits = 0 )
+            : base_class( head_bits, array_bits, max_head_bits )
         {}
 
         /// Destructs the set and frees all data
@@ -616,14 +692,15 @@ namespace cds { namespace intrusive {
             traverse_data pos( hash, *this );
             hash_comparator cmp;
             typename gc::template GuardArray<2> guards;
+            guard_array_protector<2> protect{ guards };
 
             guards.assign( 1, &val );
             while ( true ) {
-                node_ptr slot = base_class::traverse( pos );
+                node_ptr slot = base_class::traverse( pos, protect );
                 assert( slot.bits() == 0 );
 
                 // protect data node by hazard pointer
-                if (guards.protect( 0, pos.pArr->nodes[pos.nSlot], [](node_ptr p) -> value_type * { return p.ptr(); }) != slot ) {
+                if (guards.protect( 0, base_class::slot( pos ), [](node_ptr p) -> value_type * { return p.ptr(); }) != slot ) {
                     // slot value has been changed - retry
                     stats().onSlotChanged();
                 }
@@ -640,8 +717,7 @@ namespace cds { namespace intrusive {
                 }
                 else {
                     // the slot is empty, try to insert data node
-                    node_ptr pNull;
-                    if ( pos.pArr->nodes[pos.nSlot].compare_exchange_strong( pNull, node_ptr(&val), memory_model::memory_order_release, atomics::memory_order_relaxed ))
+                    if ( base_class::insert_slot( pos, &val ))
                     {
                         // the new data node has been inserted
                         f(val);
@@ -834,6 +910,42 @@ namespace cds { namespace intrusive {
             return find( hash, [](value_type&) {} );
         }
 
+        /// Finds a batch of hashes
+        /** \anchor cds_intrusive_FeldmanHashSet_hp_find_batch
+            The function searches each hash from the range <tt>[itFirst, itLast)</tt> and calls the functor \p f
+            for each item found, the functor interface is the same as for \p find().
+            \p Iterator is a forward iterator with \p hash_type value type.
+
+            Unlike the sequence of \p find() calls, the function prefetches the first-level array node slots
+            (the head node is usually hot in cache) for \p cds::algo::c_nPrefetchDistance next hashes
+            and then the slots of the second level (or the data nodes) while the current hash is being searched,
+            so the cache misses for several hashes overlap, see \p cds::algo::prefetch_pipeline(). One guard is used for the whole batch.
+
+            The function returns the number of hashes found.
+        */
+        template <typename Iterator, typename Func>
+        size_t find_batch( Iterator itFirst, Iterator itLast, Func f )
+        {
+            typename gc::Guard guard;
+            return cds::algo::prefetch_pipeline< cds::algo::c_nPrefetchDistance, hash_type const * >( itFirst, itLast,
+                [this]( hash_type const& hash ) -> hash_type const * {
+                    base_class::prefetch_slot( hash, 1 );
+                    return &hash;
+                },
+                [this]( hash_type const * pHash ) {
+                    base_class::prefetch_slot( *pHash, 2 );
+                },
+                [this, &f, &guard]( hash_type const& hash, hash_type const * ) -> bool {
+                    value_type * p = search( hash, guard );
+                    if ( p ) {
+                        f( *p );
+                        return true;
+                    }
+                    return false;
+                }
+            );
+        }
+
         /// Finds an item by it's \p hash and returns the item found
         /**
             The function searches the item by its \p hash
@@ -877,7 +989,10 @@ namespace cds { namespace intrusive {
         */
         void clear()
         {
-            clear_array( head(), head_size());
+            head_guard hg;
+            typename base_class::head_node * pHead = base_class::current_head( hg );
+            block_guard bg;
+            clear_array( pHead->pArr, pHead->size(), bg );
         }
 
         /// Checks if the set is empty
@@ -959,55 +1074,55 @@ namespace cds { namespace intrusive {
         /// Returns an iterator to the beginning of the set
         iterator begin()
         {
-            return iterator( *this, head(), size_t(0) - 1 );
+            return iterator( *this, end_node(), size_t(0) - 1 );
         }
 
         /// Returns an const iterator to the beginning of the set
         const_iterator begin() const
         {
-            return const_iterator( *this, head(), size_t(0) - 1 );
+            return const_iterator( *this, end_node(), size_t(0) - 1 );
         }
 
         /// Returns an const iterator to the beginning of the set
         const_iterator cbegin()
         {
-            return const_iterator( *this, head(), size_t(0) - 1 );
+            return const_iterator( *this, end_node(), size_t(0) - 1 );
         }
 
         /// Returns an iterator to the element following the last element of the set. This element acts as a placeholder; attempting to access it results in undefined behavior.
         iterator end()
         {
-            return iterator( *this, head(), head_size(), false );
+            return iterator( *this, end_node(), end_node_size(), false );
         }
 
         /// Returns a const iterator to the element following the last element of the set. This element acts as a placeholder; attempting to access it results in undefined behavior.
         const_iterator end() const
         {
-            return const_iterator( *this, head(), head_size(), false );
+            return const_iterator( *this, end_node(), end_node_size(), false );
         }
 
         /// Returns a const iterator to the element following the last element of the set. This element acts as a placeholder; attempting to access it results in undefined behavior.
         const_iterator cend()
         {
-            return const_iterator( *this, head(), head_size(), false );
+            return const_iterator( *this, end_node(), end_node_size(), false );
         }
 
         /// Returns a reverse iterator to the first element of the reversed set
         reverse_iterator rbegin()
         {
-            return reverse_iterator( *this, head(), head_size());
+            return reverse_iterator( *this, end_node(), end_node_size());
         }
 
         /// Returns a const reverse iterator to the first element of the reversed set
         const_reverse_iterator rbegin() const
         {
-            return const_reverse_iterator( *this, head(), head_size());
+            return const_reverse_iterator( *this, end_node(), end_node_size());
         }
 
         /// Returns a const reverse iterator to the first element of the reversed set
         const_reverse_iterator crbegin()
         {
-            return const_reverse_iterator( *this, head(), head_size());
+            return const_reverse_iterator( *this, end_node(), end_node_size());
         }
 
         /// Returns a reverse iterator to the element following the last element of the reversed set
@@ -1017,7 +1132,7 @@ namespace cds { namespace intrusive {
         */
         reverse_iterator rend()
         {
-            return reverse_iterator( *this, head(), size_t(0) - 1, false );
+            return reverse_iterator( *this, end_node(), size_t(0) - 1, false );
         }
 
         /// Returns a const reverse iterator to the element following the last element of the reversed set
@@ -1027,7 +1142,7 @@ namespace cds { namespace intrusive {
         */
         const_reverse_iterator rend() const
         {
-            return const_reverse_iterator( *this, head(), size_t(0) - 1, false );
+            return const_reverse_iterator( *this, end_node(), size_t(0) - 1, false );
         }
 
         /// Returns a const reverse iterator to the element following the last element of the reversed set
@@ -1037,23 +1152,29 @@ namespace cds { namespace intrusive {
         */
         const_reverse_iterator crend()
         {
-            return const_reverse_iterator( *this, head(), size_t(0) - 1, false );
+            return const_reverse_iterator( *this, end_node(), size_t(0) - 1, false );
         }
     ///@}
 
     private:
         //@cond
-        void clear_array( array_node * pArrNode, size_t nSize )
+        // The cell block of pArrNode is protected by bg again after the child node is cleared
+        void clear_array( array_node * pArrNode, size_t nSize, block_guard& bg )
         {
             back_off bkoff;
 
-            for ( atomic_node_ptr * pArr = pArrNode->nodes, *pLast = pArr + nSize; pArr != pLast; ++pArr ) {
+            for ( size_t idx = 0; idx < nSize; ++idx ) {
                 while ( true ) {
+                    atomic_node_ptr * pArr = base_class::slot_ptr( pArrNode, idx, bg );
+                    if ( !pArr ) {
+                        // absent cell of compressed array node
+                        break;
+                    }
                     node_ptr slot = pArr->load( memory_model::memory_order_acquire );
                     if ( slot.bits() == base_class::flag_array_node ) {
                         // array node, go down the tree
                         assert( slot.ptr() != nullptr );
-                        clear_array( to_array( slot.ptr()), array_node_size());
+                        clear_array( to_array( slot.ptr()), array_node_size(), bg );
                         break;
                     }
                     else if ( slot.bits() == base_class::flag_array_converting ) {
@@ -1066,9 +1187,16 @@ namespace cds { namespace intrusive {
 
                         assert( slot.ptr() != nullptr );
                         assert( slot.bits() == base_class::flag_array_node );
-                        clear_array( to_array( slot.ptr()), array_node_size());
+                        clear_array( to_array( slot.ptr()), array_node_size(), bg );
                         break;
                     }
+                    else if ( slot.bits() == base_class::flag_array_moved ) {
+                        // the cell of the expanded head is not migrated yet, or the node is obsolete
+                        typename gc::Guard guard;
+                        guard_protector protect{ guard };
+                        if ( !help_moved_slot( pArrNode, idx, protect ))
+                            break;
+                    }
                     else {
                         // data node
                         if ( pArr->compare_exchange_strong( slot, node_ptr(), memory_model::memory_order_acquire, atomics::memory_order_relaxed )) {
@@ -1091,13 +1219,14 @@ namespace cds { namespace intrusive {
         {
             traverse_data pos( hash, *this );
             hash_comparator cmp;
+            guard_protector protect{ guard };
 
             while (true) {
-                node_ptr slot = base_class::traverse( pos );
+                node_ptr slot = base_class::traverse( pos, protect );
                 assert(slot.bits() == 0);
 
                 // protect data node by hazard pointer
-                if (guard.protect( pos.pArr->nodes[pos.nSlot], [](node_ptr p) -> value_type * { return p.ptr(); }) != slot) {
+                if (guard.protect( base_class::slot( pos ), [](node_ptr p) -> value_type * { return p.ptr(); }) != slot) {
                     // slot value has been changed - retry
                     stats().onSlotChanged();
                     continue;
@@ -1117,19 +1246,20 @@ namespace cds { namespace intrusive {
         {
             traverse_data pos( hash, *this );
             hash_comparator cmp;
+            guard_protector protect{ guard };
             while (true) {
-                node_ptr slot = base_class::traverse( pos );
+                node_ptr slot = base_class::traverse( pos, protect );
                 assert(slot.bits() == 0);
 
                 // protect data node by hazard pointer
-                if (guard.protect( pos.pArr->nodes[pos.nSlot], [](node_ptr p) -> value_type * { return p.ptr(); }) != slot) {
+                if (guard.protect( base_class::slot( pos ), [](node_ptr p) -> value_type * { return p.ptr(); }) != slot) {
                     // slot value has been changed - retry
                     stats().onSlotChanged();
                 }
                 else if (slot.ptr()) {
                     if ( cmp(hash, hash_accessor()(*slot.ptr())) == 0 && pred(*slot.ptr())) {
                         // item found - replace it with nullptr
-                        if ( pos.pArr->nodes[pos.nSlot].compare_exchange_strong(slot, node_ptr(nullptr), memory_model::memory_order_acquire, atomics::memory_order_relaxed)) {
+                        if ( base_class::slot( pos ).compare_exchange_strong(slot, node_ptr(nullptr), memory_model::memory_order_acquire, atomics::memory_order_relaxed)) {
                             // slot is guarded by HP
                             gc::template retire<disposer>(slot.ptr());
                             --m_ItemCounter;
@@ -1155,15 +1285,15 @@ namespace cds { namespace intrusive {
         {
             if ( iter.m_set != this )
                 return false;
-            if ( iter.m_pNode == head() && iter.m_idx >= head_size())
-                return false;
-            if ( iter.m_idx >= array_node_size())
+            if ( iter.m_idx >= base_class::node_size( iter.m_pNode ))
                 return false;
 
+            block_guard bg;
             for (;;) {
-                node_ptr slot = iter.m_pNode->nodes[iter.m_idx].load( memory_model::memory_order_acquire );
+                atomic_node_ptr& cell = base_class::slot( iter.m_pNode, iter.m_idx, bg );
+                node_ptr slot = cell.load( memory_model::memory_order_acquire );
                 if ( slot.bits() == 0 && slot.ptr() == iter.pointer()) {
-                    if ( iter.m_pNode->nodes[iter.m_idx].compare_exchange_strong(slot, node_ptr(nullptr), memory_model::memory_order_acquire, atomics::memory_order_relaxed)) {
+                    if ( cell.compare_exchange_strong(slot, node_ptr(nullptr), memory_model::memory_order_acquire, atomics::memory_order_relaxed)) {
                         // the item is guarded by iterator, so we may retire it safely
                         gc::template retire<disposer>( slot.ptr());
                         --m_ItemCounter;
@@ -1183,14 +1313,15 @@ namespace cds { namespace intrusive {
             traverse_data pos( hash, *this );
             hash_comparator cmp;
             typename gc::template GuardArray<2> guards;
+            guard_array_protector<2> protect{ guards };
 
             guards.assign( 1, &val );
             while (true) {
-                node_ptr slot = base_class::traverse( pos );
+                node_ptr slot = base_class::traverse( pos, protect );
                 assert(slot.bits() == 0);
 
                 // protect data node by hazard pointer
-                if ( guards.protect( 0, pos.pArr->nodes[pos.nSlot], [](node_ptr p) -> value_type * { return p.ptr(); }) != slot ) {
+                if ( guards.protect( 0, base_class::slot( pos ), [](node_ptr p) -> value_type * { return p.ptr(); }) != slot ) {
                     // slot value has been changed - retry
                     stats().onSlotChanged();
                 }
@@ -1203,7 +1334,7 @@ namespace cds { namespace intrusive {
                             return std::make_pair(true, false);
                         }
 
-                        if ( pos.pArr->nodes[pos.nSlot].compare_exchange_strong(slot, node_ptr(&val), memory_model::memory_order_release, atomics::memory_order_relaxed)) {
+                        if ( base_class::slot( pos ).compare_exchange_strong(slot, node_ptr(&val), memory_model::memory_order_release, atomics::memory_order_relaxed)) {
                             // slot can be disposed
                             f( val, slot.ptr());
                             gc::template retire<disposer>( slot.ptr());
@@ -1227,8 +1358,7 @@ namespace cds { namespace intrusive {
                 else {
                     // the slot is empty, try to insert data node
                     if ( bInsert ) {
-                        node_ptr pNull;
-                        if ( pos.pArr->nodes[pos.nSlot].compare_exchange_strong(pNull, node_ptr(&val), memory_model::memory_order_release, atomics::memory_order_relaxed))
+                        if ( base_class::insert_slot( pos, &val ))
                         {
                             // the new data node has been inserted
                             f(val, nullptr);
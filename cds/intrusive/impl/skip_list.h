@@ -125,6 +125,14 @@ namespace cds { namespace intrusive {
                 }
             }
 
+            // Positions the iterator to pNode; pNode must be guarded by the caller
+            explicit iterator( node_type * pNode )
+                : m_pNode( pNode )
+            {
+                if ( pNode )
+                    m_guard.assign( node_traits::to_value_ptr( pNode ));
+            }
+
         public:
             iterator()
                 : m_pNode( nullptr )
@@ -234,7 +242,9 @@ namespace cds { namespace intrusive {
         @warning Due to concurrent nature of skip-list set it is not guarantee that you can iterate
         all elements in the set: any concurrent deletion can exclude the element
         pointed by the iterator from the set, and your iteration can be terminated
-        before end of the set. Therefore, such iteration is more suitable for debugging purpose only
+        before end of the set. Therefore, such iteration is more suitable for debugging purpose only.
+        For ordered scans of a key range use \p lower_bound(), \p upper_bound(), \ref cds_intrusive_SkipListSet_hp_for_each_in_range "for_each_in_range()"
+        and \p snapshot_range().
 
         Remember, each iterator object requires 2 additional hazard pointers, that may be
         a limited resource for \p GC like as \p gc::HP (for \p gc::DHP the count of
@@ -372,6 +382,7 @@ namespace cds { namespace intrusive {
         typedef typename traits::allocator     allocator_type;   ///< allocator for maintaining array of next pointers of the node
         typedef typename traits::back_off      back_off;   ///< Back-off strategy
         typedef typename traits::stat          stat;       ///< internal statistics type
+        typedef typename traits::snapshot_counter snapshot_counter; ///< Version counter for \p snapshot_range()
 
     public:
         typedef typename gc::template guarded_ptr< value_type > guarded_ptr; ///< Guarded pointer
@@ -427,6 +438,7 @@ namespace cds { namespace intrusive {
         random_level_generator      m_RandomLevelGen; ///< random level generator instance
         atomics::atomic<unsigned int> m_nHeight;      ///< estimated high level
         mutable stat                m_Stat;           ///< internal statistics
+        snapshot_counter            m_SnapshotCounter; ///< version counter for \p snapshot_range()
 
     protected:
         //@cond
@@ -655,6 +667,7 @@ namespace cds { namespace intrusive {
 
             // Insert at level 0
             {
+                skip_list::details::update_scope< snapshot_counter > us( m_SnapshotCounter, pNode );
                 marked_node_ptr p( pos.pSucc[0] );
                 pNode->next( 0 ).store( p, memory_model::memory_order_release );
                 if ( !pos.pPrev[0]->next(0).compare_exchange_strong( p, marked_node_ptr(pNode), memory_model::memory_order_release, atomics::memory_order_relaxed ))
@@ -712,10 +725,15 @@ namespace cds { namespace intrusive {
 
             while ( true ) {
                 marked_node_ptr p( pDel->next(0).load(memory_model::memory_order_relaxed).ptr() );
-                if ( pDel->next(0).compare_exchange_strong( p, p | 1, memory_model::memory_order_release, atomics::memory_order_relaxed ))
+                bool bMarked;
                 {
-                    f( *node_traits::to_value_ptr( pDel ));
+                    skip_list::details::update_scope< snapshot_counter > us( m_SnapshotCounter, pDel );
+                    bMarked = pDel->next(0).compare_exchange_strong( p, p | 1, memory_model::memory_order_release, atomics::memory_order_relaxed );
+                    if ( bMarked )
+                        f( *node_traits::to_value_ptr( pDel ));
+                }
 
+                if ( bMarked ) {
                     // Physical deletion
                     // try fast erase
                     p = pDel;
@@ -847,6 +865,122 @@ namespace cds { namespace intrusive {
             return find_with_( val, cmp, [&guard](value_type& found, Q const& ) { guard.set(&found); } );
         }
 
+        template <typename Q, typename Compare>
+        bool seek_fastpath( typename gc::Guard& guard, Q const& val, Compare cmp, node_type *& pFound )
+        {
+            node_type * pPred;
+            typename gc::template GuardArray<2>  guards;
+            marked_node_ptr pCur;
+            marked_node_ptr pNull;
+
+            back_off bkoff;
+
+            pPred = m_Head.head();
+            for ( int nLevel = static_cast<int>( m_nHeight.load(memory_model::memory_order_relaxed) - 1 ); nLevel >= 0; --nLevel ) {
+                pCur = guards.protect( 1, pPred->next(nLevel), gc_protect );
+
+                while ( pCur != pNull ) {
+                    if ( pCur.bits() ) {
+                        unsigned int nAttempt = 0;
+                        while ( pCur.bits() && nAttempt++ < 16 ) {
+                            bkoff();
+                            pCur = guards.protect( 1, pPred->next(nLevel), gc_protect );
+                        }
+                        bkoff.reset();
+
+                        if ( pCur.bits() ) {
+                            // Maybe, we are on deleted node sequence
+                            // Abort searching, try slow-path
+                            return false;
+                        }
+                    }
+
+                    if ( pCur.ptr() ) {
+                        if ( cmp( *node_traits::to_value_ptr( pCur.ptr() ), val ) < 0 ) {
+                            guards.copy( 0, 1 );
+                            pPred = pCur.ptr();
+                            pCur = guards.protect( 1, pCur->next(nLevel), gc_protect );
+                        }
+                        else // pCur >= val - go down
+                            break;
+                    }
+                }
+            }
+
+            // pCur is the first item not less than val at level 0
+            if ( pCur.ptr() ) {
+                if ( pCur->next( 0 ).load( memory_model::memory_order_acquire ).bits() ) {
+                    // The item found is logically deleted, the slow-path unlinks it
+                    return false;
+                }
+                guard.assign( node_traits::to_value_ptr( pCur.ptr() ));
+            }
+            else
+                guard.clear();
+
+            pFound = pCur.ptr();
+            return true;
+        }
+
+        // Finds the first item for which cmp( item, val ) >= 0 using upper levels of the list.
+        // The item returned is guarded by guard and it is not logically deleted at the moment of searching
+        template <typename Q, typename Compare>
+        node_type * seek_( typename gc::Guard& guard, Q const& val, Compare cmp )
+        {
+            node_type * pNode;
+            if ( seek_fastpath( guard, val, cmp, pNode ))
+                return pNode;
+
+            position pos;
+            find_position( val, pos, cmp, false );
+            pNode = pos.pSucc[0];
+            if ( pNode )
+                guard.assign( node_traits::to_value_ptr( pNode ));
+            else
+                guard.clear();
+            return pNode;
+        }
+
+        template <typename Q>
+        node_type * lower_bound_( typename gc::Guard& guard, Q const& val )
+        {
+            return seek_( guard, val, key_comparator() );
+        }
+
+        template <typename Q>
+        node_type * upper_bound_( typename gc::Guard& guard, Q const& val )
+        {
+            return seek_( guard, val, skip_list::details::upper_bound_compare< key_comparator >() );
+        }
+
+        template <typename Q, typename Func>
+        void for_each_in_range_( Q const& lo, Q const& hi, Func f )
+        {
+            key_comparator cmp;
+            typename gc::Guard gCur;
+            typename gc::Guard gSucc;
+
+            m_Stat.onRangeScan();
+
+            node_type * pCur = lower_bound_( gCur, lo );
+            while ( pCur && cmp( *node_traits::to_value_ptr( pCur ), hi ) < 0 ) {
+                marked_node_ptr pSucc = gSucc.protect( pCur->next( 0 ), gc_protect );
+                if ( pSucc.bits() ) {
+                    // pCur has been deleted, its next pointer may refer to a reclaimed node.
+                    // Find the successor of pCur from the upper levels
+                    m_Stat.onRangeReseek();
+                    pCur = upper_bound_( gSucc, *node_traits::to_value_ptr( pCur ));
+                    gCur.copy( gSucc );
+                    continue;
+                }
+
+                f( *node_traits::to_value_ptr( pCur ));
+
+                pCur = pSucc.ptr();
+                gCur.copy( gSucc );
+            }
+        }
+
         template <typename Q, typename Compare, typename Func>
         bool erase_( Q const& val, Compare cmp, Func f )
         {
@@ -1584,6 +1718,101 @@ namespace cds { namespace intrusive {
             return gp;
         }
 
+        /// Returns an iterator addressing the first item which key is not less than \p key
+        /**
+            The function descends from the upper levels of the skip-list to the first item
+            which key is equal to or greater than \p key, so the cost is logarithmic
+            as for \p find(). If no such item exists the function returns \p end().
+
+            The iterator returned has the same properties as one returned by \p begin():
+            in particular, the iteration is terminated if the current item is concurrently deleted.
+            To scan a key range in presence of concurrent deletions use \p for_each_in_range().
+
+            Note the compare functor specified for class \p Traits template parameter
+            should accept a parameter of type \p Q that can be not the same as \p value_type.
+        */
+        template <typename Q>
+        iterator lower_bound( Q const& key )
+        {
+            typename gc::Guard guard;
+            return iterator( lower_bound_( guard, key ));
+        }
+
+        /// Returns an iterator addressing the first item which key is greater than \p key
+        /**
+            The function is similar to \p lower_bound() but it skips the items with key equal to \p key.
+        */
+        template <typename Q>
+        iterator upper_bound( Q const& key )
+        {
+            typename gc::Guard guard;
+            return iterator( upper_bound_( guard, key ));
+        }
+
+        /// Calls \p f for each item which key is in range <tt>[lo, hi)</tt>
+        /** \anchor cds_intrusive_SkipListSet_hp_for_each_in_range
+            The function finds the first item with key not less than \p lo using the upper levels
+            of the skip-list and then walks on the bottom level until it reaches an item with key
+            not less than \p hi. The items are visited in ascending key order.
+
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( value_type& item );
+            };
+            \endcode
+            The functor can change non-key fields of \p item. The functor is only guarantee
+            that \p item cannot be disposed during functor is executing.
+
+            Unlike the iterator, the scan is not terminated when the current item is deleted
+            by a concurrent thread: the scan continues from the successor of the item deleted that is
+            found again from the upper levels. Each item that is in the set during whole scan
+            is visited exactly once; an item inserted or deleted concurrently may or may not be visited.
+            The scan uses only two guards regardless of the range length.
+            If you need a consistent view of the range use \p snapshot_range().
+
+            Note the compare functor specified for class \p Traits template parameter
+            should accept a parameter of type \p Q that can be not the same as \p value_type.
+        */
+        template <typename Q, typename Func>
+        void for_each_in_range( Q const& lo, Q const& hi, Func f )
+        {
+            for_each_in_range_( lo, hi, f );
+        }
+
+        /// Copies the items of range <tt>[lo, hi)</tt> to \p dest as a linearizable snapshot
+        /**
+            The function is available only if \p Traits::snapshot_counter is \p skip_list::version_counter,
+            see \p skip_list::snapshot_counter option.
+
+            The function clears \p dest and calls <tt>dest.push_back( copy( item ))</tt>
+            for each item of the range in ascending key order. The result is a consistent view of the range:
+            there is a point of time during the call when the set contains exactly the items copied
+            in the range <tt>[lo, hi)</tt>. The scan is optimistic: if an insertion or a deletion
+            is linearized while the range is being scanned, the scan is repeated
+            (see \p skip_list::stat::m_nSnapshotRetries). After \p skip_list::version_counter::c_nOptimisticAttempts
+            failed attempts the range is scanned in exclusive mode that blocks insertions and deletions
+            until the scan is completed (see \p skip_list::stat::m_nSnapshotExclusive). Changing non-key fields of an item in place
+            (for example, by \p find() functor) is not a modification for the version counter.
+
+            \p Copy is a functor with the signature
+            \code
+                typename Container::value_type operator()( value_type const& item );
+            \endcode
+            If \p copy or <tt>dest.push_back()</tt> throws, the exception is propagated and the exclusive mode,
+            if any, is left; \p dest contains a part of the range.
+        */
+        template <typename Q, typename Container, typename Copy>
+        void snapshot_range( Q const& lo, Q const& hi, Container& dest, Copy copy )
+        {
+            static_assert( snapshot_counter::c_bEnabled, "snapshot_range() requires skip_list::version_counter as Traits::snapshot_counter" );
+
+            skip_list::details::snapshot_scan( m_SnapshotCounter, m_Stat, [this, &lo, &hi, &dest, &copy]() {
+                dest.clear();
+                for_each_in_range_( lo, hi, [&dest, &copy]( value_type& item ) { dest.push_back( copy( item )); } );
+            });
+        }
+
         /// Returns item count in the set
         /**
             The value returned depends on item counter type provided by \p Traits template parameter.
@@ -151,6 +151,7 @@ namespace cds { namespace intrusive {
         typedef typename traits::rcu_check_deadlock    rcu_check_deadlock; ///< Deadlock checking policy
 
         typedef typename gc::scoped_lock    rcu_lock ; ///< RCU scoped lock
+        typedef typename gc::batch_lock     rcu_batch_lock; ///< RCU batch lock for a sequence of lookups
         static CDS_CONSTEXPR const bool c_bExtractLockExternal = true; ///< Group of \p extract_xxx functions require external locking
 
         //@cond
@@ -1084,6 +1085,25 @@ namespace cds { namespace intrusive {
             return false;
         }
 
+        template <typename Q, typename Compare, typename Func>
+        bool find_at( rcu_batch_lock& /*bl*/, node_type * pHead, Q& val, Compare cmp, Func f ) const
+        {
+            // RCU is locked by the batch lock; the search does not unlink nodes
+            assert( gc::is_locked() );
+
+            position pos;
+            search( pHead, val, pos, cmp );
+            if ( pos.pCur != &m_Tail ) {
+                std::unique_lock< typename node_type::lock_type> al( pos.pCur->m_Lock );
+                if ( cmp( *node_traits::to_value_ptr( *pos.pCur ), val ) == 0 )
+                {
+                    f( *node_traits::to_value_ptr( *pos.pCur ), val );
+                    return true;
+                }
+            }
+            return false;
+        }
+
         template <typename Q, typename Compare>
         bool find_at( node_type * pHead, Q& val, Compare cmp ) const
         {
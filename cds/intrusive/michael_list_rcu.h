@@ -125,6 +125,7 @@ namespace cds { namespace intrusive {
         typedef typename traits::rcu_check_deadlock    rcu_check_deadlock; ///< Deadlock checking policy
 
         typedef typename gc::scoped_lock    rcu_lock ;  ///< RCU scoped lock
+        typedef typename gc::batch_lock     rcu_batch_lock; ///< RCU batch lock for a sequence of lookups
         static CDS_CONSTEXPR const bool c_bExtractLockExternal = false; ///< Group of \p extract_xxx functions do not require external locking
 
         //@cond
@@ -197,6 +198,11 @@ namespace cds { namespace intrusive {
             }
         }
 
+        static void dispose_deferred_chain( void * pChain )
+        {
+            dispose_chain( static_cast<node_type *>( pChain ));
+        }
+
         /// Position pointer for item search
         struct position {
             atomic_node_ptr * pPrev ;   ///< Previous node
@@ -1063,6 +1069,26 @@ namespace cds { namespace intrusive {
             }
         }
 
+        template <typename Q, typename Compare, typename Func>
+        bool find_at( rcu_batch_lock& bl, atomic_node_ptr& refHead, Q& val, Compare cmp, Func f )
+        {
+            // RCU is locked by the batch lock
+            assert( gc::is_locked() );
+
+            position pos( refHead );
+            bool bRet = false;
+            if ( search( refHead, val, pos, cmp ) ) {
+                assert( pos.pCur != nullptr );
+                f( *node_traits::to_value_ptr( *pos.pCur ), val );
+                bRet = true;
+            }
+
+            // pos cannot dispose the chain under the batch lock
+            bl.defer( pos.pDelChain, &dispose_deferred_chain );
+            pos.pDelChain = nullptr;
+            return bRet;
+        }
+
         template <typename Q, typename Compare>
         bool find_at( atomic_node_ptr& refHead, Q const& val, Compare cmp )
         {
@@ -376,6 +376,7 @@ namespace cds { namespace intrusive {
         typedef typename traits::allocator     allocator_type;   ///< allocator for maintaining array of next pointers of the node
         typedef typename traits::back_off      back_off;   ///< Back-off strategy
         typedef typename traits::stat          stat;       ///< internal statistics type
+        typedef typename traits::snapshot_counter snapshot_counter; ///< Version counter for \p snapshot_range()
         typedef typename traits::disposer      disposer;   ///< disposer
 
         /// Max node height. The actual node height should be in range <tt>[0 .. c_nMaxHeight)</tt>
@@ -449,6 +450,7 @@ namespace cds { namespace intrusive {
         random_level_generator      m_RandomLevelGen; ///< random level generator instance
         atomics::atomic<unsigned int>    m_nHeight;   ///< estimated high level
         mutable stat                m_Stat;           ///< internal statistics
+        snapshot_counter            m_SnapshotCounter; ///< version counter for \p snapshot_range()
 
     protected:
         //@cond
@@ -534,6 +536,7 @@ namespace cds { namespace intrusive {
                 pNode->next( nLevel ).store( nullptr, memory_model::memory_order_relaxed );
 
             {
+                skip_list::details::update_scope< snapshot_counter > us( m_SnapshotCounter, pNode );
                 node_type * p = pos.pSucc[0];
                 pNode->next( 0 ).store( pos.pSucc[ 0 ], memory_model::memory_order_release );
                 if ( !pos.pPrev[0]->next(0).compare_exchange_strong( p, pNode, memory_model::memory_order_release, memory_model::memory_order_relaxed ) ) {
@@ -578,6 +581,23 @@ namespace cds { namespace intrusive {
             }
         }
 
+        template <typename Q, typename Func>
+        void for_each_in_range_( Q const& lo, Q const& hi, Func f ) const
+        {
+            key_comparator cmp;
+            position pos;
+
+            m_Stat.onRangeScan();
+
+            find_position( lo, pos, cmp, false, false );
+            for ( node_type * pCur = pos.pSucc[0];
+                  pCur && cmp( *node_traits::to_value_ptr( pCur ), hi ) < 0;
+                  pCur = pCur->next( 0 ).load( memory_model::memory_order_acquire ))
+            {
+                f( *node_traits::to_value_ptr( pCur ));
+            }
+        }
+
         void increase_height( unsigned int nHeight )
         {
             unsigned int nCur = m_nHeight.load( memory_model::memory_order_relaxed );
@@ -929,6 +949,60 @@ namespace cds { namespace intrusive {
             return pPred && pPred != m_Head.head() ? node_traits::to_value_ptr( pPred ) : nullptr;
         }
 
+        /// Calls \p f for each item which key is in range <tt>[lo, hi)</tt>
+        /**
+            The function finds the first item with key not less than \p lo using the upper levels
+            of the skip-list and then walks on the bottom level until it reaches an item with key
+            not less than \p hi. The items are visited in ascending key order.
+
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( value_type& item );
+            };
+            \endcode
+            The functor can change non-key fields of \p item.
+            An item inserted concurrently may or may not be visited.
+            If you need a consistent view of the range use \p snapshot_range().
+        */
+        template <typename Q, typename Func>
+        void for_each_in_range( Q const& lo, Q const& hi, Func f ) const
+        {
+            for_each_in_range_( lo, hi, f );
+        }
+
+        /// Copies the items of range <tt>[lo, hi)</tt> to \p dest as a linearizable snapshot
+        /**
+            The function is available only if \p Traits::snapshot_counter is \p skip_list::version_counter,
+            see \p skip_list::snapshot_counter option.
+
+            The function clears \p dest and calls <tt>dest.push_back( copy( item ))</tt>
+            for each item of the range in ascending key order. The result is a consistent view of the range:
+            there is a point of time during the call when the set contains exactly the items copied
+            in the range <tt>[lo, hi)</tt>. If an insertion is linearized while the range is being scanned,
+            the scan is repeated (see \p skip_list::stat::m_nSnapshotRetries).
+            After \p skip_list::version_counter::c_nOptimisticAttempts failed attempts the range is scanned
+            in exclusive mode that blocks insertions until the scan is completed
+            (see \p skip_list::stat::m_nSnapshotExclusive).
+
+            \p Copy is a functor with the signature
+            \code
+                typename Container::value_type operator()( value_type const& item );
+            \endcode
+            If \p copy or <tt>dest.push_back()</tt> throws, the exception is propagated and the exclusive mode,
+            if any, is left; \p dest contains a part of the range.
+        */
+        template <typename Q, typename Container, typename Copy>
+        void snapshot_range( Q const& lo, Q const& hi, Container& dest, Copy copy )
+        {
+            static_assert( snapshot_counter::c_bEnabled, "snapshot_range() requires skip_list::version_counter as Traits::snapshot_counter" );
+
+            skip_list::details::snapshot_scan( m_SnapshotCounter, m_Stat, [this, &lo, &hi, &dest, &copy]() {
+                dest.clear();
+                for_each_in_range_( lo, hi, [&dest, &copy]( value_type& item ) { dest.push_back( copy( item )); } );
+            });
+        }
+
         /// Clears the set (non-atomic)
         /**
             The function is not atomic.
@@ -559,8 +559,10 @@ namespace cds { namespace intrusive {
         typedef typename traits::allocator     allocator_type; ///< allocator for maintaining array of next pointers of the node
         typedef typename traits::back_off      back_off;       ///< Back-off strategy
         typedef typename traits::stat          stat;           ///< internal statistics type
+        typedef typename traits::snapshot_counter snapshot_counter; ///< Version counter for \p snapshot_range()
         typedef typename traits::rcu_check_deadlock rcu_check_deadlock; ///< Deadlock checking policy
         typedef typename gc::scoped_lock       rcu_lock;      ///< RCU scoped lock
+        typedef typename gc::batch_lock        rcu_batch_lock; ///< RCU batch lock for a sequence of lookups
         static CDS_CONSTEXPR const bool c_bExtractLockExternal = false; ///< Group of \p extract_xxx functions does not require external locking
 
 
@@ -628,6 +630,11 @@ namespace cds { namespace intrusive {
             }
         }
 
+        static void dispose_deferred_chain( void * pChain )
+        {
+            dispose_chain( static_cast<node_type *>( pChain ));
+        }
+
         struct position {
             node_type *   pPrev[ c_nMaxHeight ];
             node_type *   pSucc[ c_nMaxHeight ];
@@ -666,6 +673,7 @@ namespace cds { namespace intrusive {
         atomics::atomic<unsigned int>    m_nHeight;     ///< estimated high level
         atomics::atomic<node_type *>     m_pDeferredDelChain ;   ///< Deferred deleted node chain
         mutable stat                m_Stat;             ///< internal statistics
+        snapshot_counter            m_SnapshotCounter;  ///< version counter for \p snapshot_range()
 
     protected:
         //@cond
@@ -929,6 +937,7 @@ namespace cds { namespace intrusive {
             pNode->clear_tower();
 
             {
+                skip_list::details::update_scope< snapshot_counter > us( m_SnapshotCounter, pNode );
                 marked_node_ptr p( pos.pSucc[0] );
                 pNode->next( 0 ).store( p, memory_model::memory_order_release );
                 if ( !pos.pPrev[0]->next(0).compare_exchange_strong( p, marked_node_ptr(pNode), memory_model::memory_order_release, atomics::memory_order_relaxed )) {
@@ -993,10 +1002,15 @@ namespace cds { namespace intrusive {
                     return false;
 
                 int const nMask = bExtract ? 3 : 1;
-                if ( pDel->next(0).compare_exchange_strong( pSucc, pSucc | nMask, memory_model::memory_order_acquire, atomics::memory_order_relaxed ))
+                bool bMarked;
                 {
-                    f( *node_traits::to_value_ptr( pDel ));
+                    skip_list::details::update_scope< snapshot_counter > us( m_SnapshotCounter, pDel );
+                    bMarked = pDel->next(0).compare_exchange_strong( pSucc, pSucc | nMask, memory_model::memory_order_acquire, atomics::memory_order_relaxed );
+                    if ( bMarked )
+                        f( *node_traits::to_value_ptr( pDel ));
+                }
 
+                if ( bMarked ) {
                     // physical deletion
                     // try fast erase
                     pSucc = pDel;
@@ -1116,32 +1130,74 @@ namespace cds { namespace intrusive {
         template <typename Q, typename Compare, typename Func>
         bool do_find_with( Q& val, Compare cmp, Func f, position& pos )
         {
-            bool bRet;
+            rcu_lock l;
+            return do_find_locked( val, cmp, f, pos );
+        }
 
-            {
-                rcu_lock l;
+        template <typename Q, typename Compare, typename Func>
+        bool do_find_batch( rcu_batch_lock& bl, Q& val, Compare cmp, Func f )
+        {
+            // RCU is locked by the batch lock
+            bl.step();
+            assert( gc::is_locked() );
 
-                switch ( find_fastpath( val, cmp, f )) {
-                case find_fastpath_found:
-                    m_Stat.onFindFastSuccess();
-                    return true;
-                case find_fastpath_not_found:
-                    m_Stat.onFindFastFailed();
-                    return false;
-                default:
-                    break;
-                }
+            position pos;
+            bool const bRet = do_find_locked( val, cmp, f, pos );
 
-                if ( find_slowpath( val, cmp, f, pos )) {
-                    m_Stat.onFindSlowSuccess();
-                    bRet = true;
-                }
-                else {
-                    m_Stat.onFindSlowFailed();
-                    bRet = false;
+            // pos cannot dispose the chain under the batch lock
+            bl.defer( pos.pDelChain, &dispose_deferred_chain );
+            pos.pDelChain = nullptr;
+            return bRet;
+        }
+
+        template <typename Q, typename Compare, typename Func>
+        bool do_find_locked( Q& val, Compare cmp, Func f, position& pos )
+        {
+            switch ( find_fastpath( val, cmp, f )) {
+            case find_fastpath_found:
+                m_Stat.onFindFastSuccess();
+                return true;
+            case find_fastpath_not_found:
+                m_Stat.onFindFastFailed();
+                return false;
+            default:
+                break;
+            }
+
+            if ( find_slowpath( val, cmp, f, pos )) {
+                m_Stat.onFindSlowSuccess();
+                return true;
+            }
+            m_Stat.onFindSlowFailed();
+            return false;
+        }
+
+        // The nodes unlinked while scanning are linked to pos.pDelChain and disposed by the caller
+        // when RCU is unlocked
+        template <typename Q, typename Func>
+        void do_for_each_in_range( Q const& lo, Q const& hi, Func f, position& pos )
+        {
+            key_comparator cmp;
+            rcu_lock l;
+
+            m_Stat.onRangeScan();
+
+            find_position( lo, pos, cmp, false );
+            node_type * pCur = pos.pSucc[0];
+            while ( pCur && cmp( *node_traits::to_value_ptr( pCur ), hi ) < 0 ) {
+                marked_node_ptr pSucc = pCur->next( 0 ).load( memory_model::memory_order_acquire );
+                if ( pSucc.bits() ) {
+                    // pCur has been deleted, new items may be inserted after its predecessor.
+                    // Find the successor of pCur from the upper levels
+                    m_Stat.onRangeReseek();
+                    find_position( *node_traits::to_value_ptr( pCur ), pos, skip_list::details::upper_bound_compare< key_comparator >(), false );
+                    pCur = pos.pSucc[0];
+                    continue;
                 }
+
+                f( *node_traits::to_value_ptr( pCur ));
+                pCur = pSucc.ptr();
             }
-            return bRet;
         }
 
         template <typename Q, typename Compare, typename Func>
@@ -1871,6 +1927,37 @@ namespace cds { namespace intrusive {
         {
             return do_find_with( key, key_comparator(), [](value_type& , Q const& ) {} );
         }
+
+        /// Checks whether the set contains \p key, batch version
+        /**
+            The function is an analog of \p contains(Q const&) but it does not lock RCU:
+            the caller holds the batch lock \p bl that covers a sequence of lookups.
+            Before searching the function calls <tt>bl.step()</tt> that can leave RCU critical section
+            for a moment if some thread is waiting in \p synchronize().
+        */
+        template <typename Q>
+        bool contains( rcu_batch_lock& bl, Q const& key )
+        {
+            return do_find_batch( bl, key, key_comparator(), [](value_type& , Q const& ) {} );
+        }
+
+        /// Finds \p key and applies \p f to the item found, batch version
+        /**
+            The function is an analog of \ref cds_intrusive_SkipListSet_rcu_find_func "find(Q&, Func)"
+            but it does not lock RCU, see \p contains( rcu_batch_lock&, Q const& ).
+        */
+        template <typename Q, typename Func>
+        bool find( rcu_batch_lock& bl, Q& key, Func f )
+        {
+            return do_find_batch( bl, key, key_comparator(), f );
+        }
+        //@cond
+        template <typename Q, typename Func>
+        bool find( rcu_batch_lock& bl, Q const& key, Func f )
+        {
+            return do_find_batch( bl, key, key_comparator(), f );
+        }
+        //@endcond
         //@cond
         template <typename Q>
         CDS_DEPRECATED("deprecated, use contains()")
@@ -1966,6 +2053,71 @@ namespace cds { namespace intrusive {
             return raw_ptr( raw_ptr_disposer( pos ));
         }
 
+        /// Calls \p f for each item which key is in range <tt>[lo, hi)</tt>
+        /**
+            The function finds the first item with key not less than \p lo using the upper levels
+            of the skip-list and then walks on the bottom level until it reaches an item with key
+            not less than \p hi. The items are visited in ascending key order.
+
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( value_type& item );
+            };
+            \endcode
+            The functor can change non-key fields of \p item.
+
+            The function locks RCU internally, so RCU should not be locked by the caller.
+            When the current item is deleted by a concurrent thread the scan continues from the successor
+            of the item deleted that is found again from the upper levels. Each item that is in the set during whole scan
+            is visited exactly once; an item inserted or deleted concurrently may or may not be visited.
+            If you need a consistent view of the range use \p snapshot_range().
+        */
+        template <typename Q, typename Func>
+        void for_each_in_range( Q const& lo, Q const& hi, Func f )
+        {
+            check_deadlock_policy::check();
+
+            position pos;
+            do_for_each_in_range( lo, hi, f, pos );
+        }
+
+        /// Copies the items of range <tt>[lo, hi)</tt> to \p dest as a linearizable snapshot
+        /**
+            The function is available only if \p Traits::snapshot_counter is \p skip_list::version_counter,
+            see \p skip_list::snapshot_counter option. RCU should not be locked by the caller.
+
+            The function clears \p dest and calls <tt>dest.push_back( copy( item ))</tt>
+            for each item of the range in ascending key order. The result is a consistent view of the range:
+            there is a point of time during the call when the set contains exactly the items copied
+            in the range <tt>[lo, hi)</tt>. The scan is optimistic: if an insertion or a deletion
+            is linearized while the range is being scanned, the scan is repeated
+            (see \p skip_list::stat::m_nSnapshotRetries). After \p skip_list::version_counter::c_nOptimisticAttempts
+            failed attempts the range is scanned in exclusive mode that blocks insertions and deletions
+            until the scan is completed (see \p skip_list::stat::m_nSnapshotExclusive).
+
+            \p Copy is a functor with the signature
+            \code
+                typename Container::value_type operator()( value_type const& item );
+            \endcode
+            If \p copy or <tt>dest.push_back()</tt> throws, the exception is propagated and the exclusive mode,
+            if any, is left; \p dest contains a part of the range.
+        */
+        template <typename Q, typename Container, typename Copy>
+        void snapshot_range( Q const& lo, Q const& hi, Container& dest, Copy copy )
+        {
+            static_assert( snapshot_counter::c_bEnabled, "snapshot_range() requires skip_list::version_counter as Traits::snapshot_counter" );
+            check_deadlock_policy::check();
+
+            // The nodes unlinked by the scans are disposed when the exclusive scan is over
+            // since the writers blocked by the exclusive scan can hold RCU lock
+            position pos;
+            skip_list::details::snapshot_scan( m_SnapshotCounter, m_Stat, [this, &lo, &hi, &dest, &copy, &pos]() {
+                dest.clear();
+                do_for_each_in_range( lo, hi, [&dest, &copy]( value_type& item ) { dest.push_back( copy( item )); }, pos );
+            });
+        }
+
         /// Returns item count in the set
         /**
             The value returned depends on item counter type provided by \p Traits template parameter.
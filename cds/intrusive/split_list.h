@@ -33,6 +33,7 @@
 
 #include <limits>
 #include <cds/intrusive/details/split_list_base.h>
+#include <cds/algo/prefetch.h>
 
 namespace cds { namespace intrusive {
 
@@ -103,6 +104,16 @@ namespace cds { namespace intrusive {
         - for cds::gc::nogc include <tt><cds/intrusive/split_list_nogc.h></tt> - see
             \ref cds_intrusive_SplitListSet_nogc "persistent SplitListSet".
 
+        <b>Shrinking</b>
+
+        The original algorithm only grows: the bucket count is doubled when the load factor is exceeded,
+        and head (dummy) nodes are never removed. If \p split_list::shrinkable_bucket_table option is \p true,
+        the set halves the bucket count when the item count drops below a quarter of the current capacity.
+        The shrinking thread waits until the operations that could see the old bucket count are completed,
+        then it unlinks the head nodes of abandoned buckets (they are retired via \p GC like regular items)
+        and frees the bucket table segments that become unused. The growth is suspended while shrinking is in progress.
+        The other threads are not blocked, but the erasing thread that performs the shrinking is.
+
         \anchor cds_SplitList_hash_functor
         <b>Hash functor</b>
 
@@ -269,6 +280,10 @@ namespace cds { namespace intrusive {
             , opt::allocator< typename traits::allocator >
             , opt::memory_model< memory_model >
         >::type bucket_table;
+
+        /// Quiescence barrier for bucket table shrinking
+        typedef split_list::details::bucket_epoch< gc, traits::shrinkable_bucket_table > bucket_epoch;
+        typedef typename bucket_epoch::guard bucket_guard;
         //@endcond
 
     protected:
@@ -367,17 +382,31 @@ namespace cds { namespace intrusive {
                 bucket_head_type h(pHead);
                 return base_class::insert_aux_node( h, pNode );
             }
+            bool unlink_aux_node( dummy_node_type * pHead, dummy_node_type * pNode )
+            {
+                assert( pHead != nullptr );
+                bucket_head_type h(pHead);
+                return base_class::unlink_at( h, *base_class::node_traits::to_value_ptr( pNode ));
+            }
         };
         //@endcond
 
     protected:
         ordered_list_wrapper    m_List;             ///< Ordered list containing split-list items
         bucket_table            m_Buckets;          ///< bucket table
-        atomics::atomic<size_t> m_nBucketCountLog2; ///< log2( current bucket count )
+        atomics::atomic<size_t> m_nBucketCountLog2; ///< log2( current bucket count ) with \p c_nShrinkingBit
         atomics::atomic<size_t> m_nMaxItemCount;    ///< number of items container can hold, before we have to resize
         item_counter            m_ItemCounter;      ///< Item counter
         hash                    m_HashFunctor;      ///< Hash functor
         stat                    m_Stat;             ///< Internal statistics
+        bucket_epoch            m_Epoch;            ///< Quiescence barrier for bucket table shrinking
+
+        //@cond
+        // The bit of m_nBucketCountLog2 is set while the bucket table is shrinking.
+        // The growth and the shrinking change the same atomic word, so the growth cannot
+        // restore the bucket count decremented by shrink() before the head nodes are unlinked
+        static CDS_CONSTEXPR const size_t c_nShrinkingBit = static_cast<size_t>(1) << ( sizeof( size_t ) * 8 - 1 );
+        //@endcond
 
     protected:
         //@cond
@@ -403,7 +432,12 @@ namespace cds { namespace intrusive {
 
         size_t bucket_no( size_t nHash ) const
         {
-            return nHash & ( (1 << m_nBucketCountLog2.load(memory_model::memory_order_relaxed)) - 1 );
+            return nHash & ( (1 << bucket_count_log2()) - 1 );
+        }
+
+        size_t bucket_count_log2() const
+        {
+            return m_nBucketCountLog2.load( memory_model::memory_order_relaxed ) & ~c_nShrinkingBit;
         }
 
         static size_t parent_bucket( size_t nBucket )
@@ -495,6 +529,9 @@ namespace cds { namespace intrusive {
                 return;
 
             size_t sz = m_nBucketCountLog2.load(memory_model::memory_order_relaxed);
+            if ( traits::shrinkable_bucket_table && ( sz & c_nShrinkingBit ))
+                return; // the bucket table is shrinking now, the next insertion will grow it
+
             const size_t nBucketCount = static_cast<size_t>(1) << sz;
             if ( nBucketCount < m_Buckets.capacity()) {
                 // we may grow the bucket table
@@ -504,17 +541,70 @@ namespace cds { namespace intrusive {
 
                 m_nMaxItemCount.compare_exchange_strong( nMaxCount, max_item_count( nBucketCount << 1, nLoadFactor ),
                                                          memory_model::memory_order_relaxed, atomics::memory_order_relaxed );
+                // fails if shrink() has changed the bucket count or set c_nShrinkingBit since sz was loaded
                 m_nBucketCountLog2.compare_exchange_strong( sz, sz + 1, memory_model::memory_order_relaxed, atomics::memory_order_relaxed );
             }
             else
                 m_nMaxItemCount.store( std::numeric_limits<size_t>::max(), memory_model::memory_order_relaxed );
         }
 
+        // Must be called outside of bucket guard scope
+        void dec_item_count()
+        {
+            --m_ItemCounter;
+            const size_t nCount = m_ItemCounter;
+            if ( traits::shrinkable_bucket_table
+                && nCount * 4 < max_item_count( static_cast<size_t>(1) << bucket_count_log2(), m_Buckets.load_factor()))
+            {
+                shrink();
+            }
+        }
+
+        void shrink()
+        {
+            size_t sz = m_nBucketCountLog2.load( atomics::memory_order_seq_cst );
+            if ( sz & c_nShrinkingBit )
+                return; // another thread is shrinking the table
+
+            const size_t nLoadFactor = m_Buckets.load_factor();
+            if ( sz > 1 && static_cast<size_t>( m_ItemCounter ) * 4 < max_item_count( static_cast<size_t>(1) << sz, nLoadFactor )
+                && m_nBucketCountLog2.compare_exchange_strong( sz, ( sz - 1 ) | c_nShrinkingBit, atomics::memory_order_seq_cst, atomics::memory_order_relaxed ))
+            {
+                // While c_nShrinkingBit is set nobody else can change m_nBucketCountLog2:
+                // the growth CAS and other shrinkers expect the value without the bit
+                const size_t nBucketCount = static_cast<size_t>(1) << ( sz - 1 );
+                m_nMaxItemCount.store( max_item_count( nBucketCount, nLoadFactor ), memory_model::memory_order_relaxed );
+                m_Stat.onBucketTableShrink();
+
+                // Wait while the operations that may use old bucket count are completed.
+                // Since the growth is disabled, nobody can access the buckets beyond nBucketCount after that
+                m_Epoch.template synchronize<back_off>();
+
+                for ( size_t nBucket = nBucketCount; nBucket < nBucketCount * 2; ++nBucket ) {
+                    dummy_node_type * pHead = m_Buckets.release_bucket( nBucket );
+                    if ( pHead != nullptr ) {
+                        // the parent bucket precedes pHead in the list and cannot be released
+                        dummy_node_type * pParent = m_Buckets.bucket( parent_bucket( nBucket ));
+                        assert( pParent != nullptr );
+
+                        // The dummy node is retired by the list
+                        CDS_VERIFY( m_List.unlink_aux_node( pParent, pHead ));
+                        m_Stat.onHeadNodeUnlinked();
+                    }
+                }
+                m_Stat.onSegmentFreed( m_Buckets.release_segments( nBucketCount ));
+
+                // enable the growth
+                m_nBucketCountLog2.store( sz - 1, atomics::memory_order_seq_cst );
+            }
+        }
+
         template <typename Q, typename Compare, typename Func>
         bool find_( Q& val, Compare cmp, Func f )
         {
             size_t nHash = hash_value( val );
             split_list::details::search_value_type<Q>  sv( val, split_list::regular_hash( nHash ));
+            bucket_guard bg( m_Epoch );
             dummy_node_type * pHead = get_bucket( nHash );
             assert( pHead != nullptr );
 
@@ -524,11 +614,40 @@ namespace cds { namespace intrusive {
             );
         }
 
+        template <typename Iterator, typename Compare, typename Func>
+        size_t find_batch_( Iterator itFirst, Iterator itLast, Compare cmp, Func& f )
+        {
+            typedef typename std::iterator_traits<Iterator>::value_type key_arg;
+            typedef split_list::details::search_value_type<key_arg const> search_value;
+
+            bucket_guard bg( m_Epoch );
+            return cds::algo::prefetch_pipeline< cds::algo::c_nPrefetchDistance, size_t >( itFirst, itLast,
+                [this]( key_arg const& key ) -> size_t {
+                    size_t nHash = hash_value( key );
+                    m_Buckets.prefetch( bucket_no( nHash ));
+                    return nHash;
+                },
+                [this]( size_t nHash ) {
+                    dummy_node_type * pHead = m_Buckets.bucket( bucket_no( nHash ));
+                    if ( pHead )
+                        CDS_PREFETCH( pHead );
+                },
+                [this, &cmp, &f]( key_arg const& key, size_t nHash ) -> bool {
+                    search_value sv( key, split_list::regular_hash( nHash ));
+                    dummy_node_type * pHead = get_bucket( nHash );
+                    assert( pHead != nullptr );
+                    return m_Stat.onFind( m_List.find_at( pHead, sv, cmp,
+                        [&f]( value_type& item, search_value& val ) { f( item, val.val ); } ));
+                }
+            );
+        }
+
         template <typename Q, typename Compare>
         bool find_( Q const& val, Compare cmp )
         {
             size_t nHash = hash_value( val );
             split_list::details::search_value_type<Q const>  sv( val, split_list::regular_hash( nHash ));
+            bucket_guard bg( m_Epoch );
             dummy_node_type * pHead = get_bucket( nHash );
             assert( pHead != nullptr );
 
@@ -540,6 +659,7 @@ namespace cds { namespace intrusive {
         {
             size_t nHash = hash_value( val );
             split_list::details::search_value_type<Q const>  sv( val, split_list::regular_hash( nHash ));
+            bucket_guard bg( m_Epoch );
             dummy_node_type * pHead = get_bucket( nHash );
             assert( pHead != nullptr );
 
@@ -563,11 +683,16 @@ namespace cds { namespace intrusive {
         {
             size_t nHash = hash_value( val );
             split_list::details::search_value_type<Q const>  sv( val, split_list::regular_hash( nHash ));
-            dummy_node_type * pHead = get_bucket( nHash );
-            assert( pHead != nullptr );
+            bool bResult;
+            {
+                bucket_guard bg( m_Epoch );
+                dummy_node_type * pHead = get_bucket( nHash );
+                assert( pHead != nullptr );
+                bResult = m_List.erase_at( pHead, sv, cmp, f );
+            }
 
-            if ( m_List.erase_at( pHead, sv, cmp, f )) {
-                --m_ItemCounter;
+            if ( bResult ) {
+                dec_item_count();
                 m_Stat.onEraseSuccess();
                 return true;
             }
@@ -580,11 +705,16 @@ namespace cds { namespace intrusive {
         {
             size_t nHash = hash_value( val );
             split_list::details::search_value_type<Q const>  sv( val, split_list::regular_hash( nHash ));
-            dummy_node_type * pHead = get_bucket( nHash );
-            assert( pHead != nullptr );
+            bool bResult;
+            {
+                bucket_guard bg( m_Epoch );
+                dummy_node_type * pHead = get_bucket( nHash );
+                assert( pHead != nullptr );
+                bResult = m_List.erase_at( pHead, sv, cmp );
+            }
 
-            if ( m_List.erase_at( pHead, sv, cmp )) {
-                --m_ItemCounter;
+            if ( bResult ) {
+                dec_item_count();
                 m_Stat.onEraseSuccess();
                 return true;
             }
@@ -597,11 +727,16 @@ namespace cds { namespace intrusive {
         {
             size_t nHash = hash_value( val );
             split_list::details::search_value_type<Q const> sv( val, split_list::regular_hash( nHash ));
-            dummy_node_type * pHead = get_bucket( nHash );
-            assert( pHead != nullptr );
+            bool bResult;
+            {
+                bucket_guard bg( m_Epoch );
+                dummy_node_type * pHead = get_bucket( nHash );
+                assert( pHead != nullptr );
+                bResult = m_List.extract_at( pHead, guard, sv, cmp );
+            }
 
-            if ( m_List.extract_at( pHead, guard, sv, cmp )) {
-                --m_ItemCounter;
+            if ( bResult ) {
+                dec_item_count();
                 m_Stat.onExtractSuccess();
                 return true;
             }
@@ -659,6 +794,7 @@ namespace cds { namespace intrusive {
         bool insert( value_type& val )
         {
             size_t nHash = hash_value( val );
+            bucket_guard bg( m_Epoch );
             dummy_node_type * pHead = get_bucket( nHash );
             assert( pHead != nullptr );
 
@@ -697,6 +833,7 @@ namespace cds { namespace intrusive {
         bool insert( value_type& val, Func f )
         {
             size_t nHash = hash_value( val );
+            bucket_guard bg( m_Epoch );
             dummy_node_type * pHead = get_bucket( nHash );
             assert( pHead != nullptr );
 
@@ -743,6 +880,7 @@ namespace cds { namespace intrusive {
         std::pair<bool, bool> update( value_type& val, Func func, bool bAllowInsert = true )
         {
             size_t nHash = hash_value( val );
+            bucket_guard bg( m_Epoch );
             dummy_node_type * pHead = get_bucket( nHash );
             assert( pHead != nullptr );
 
@@ -781,11 +919,16 @@ namespace cds { namespace intrusive {
         bool unlink( value_type& val )
         {
             size_t nHash = hash_value( val );
-            dummy_node_type * pHead = get_bucket( nHash );
-            assert( pHead != nullptr );
+            bool bResult;
+            {
+                bucket_guard bg( m_Epoch );
+                dummy_node_type * pHead = get_bucket( nHash );
+                assert( pHead != nullptr );
+                bResult = m_List.unlink_at( pHead, val );
+            }
 
-            if ( m_List.unlink_at( pHead, val )) {
-                --m_ItemCounter;
+            if ( bResult ) {
+                dec_item_count();
                 m_Stat.onEraseSuccess();
                 return true;
             }
@@ -1017,6 +1160,29 @@ namespace cds { namespace intrusive {
         }
         //@endcond
 
+        /// Finds a batch of keys
+        /** \anchor cds_intrusive_SplitListSet_hp_find_batch
+            The function searches each key from the range <tt>[itFirst, itLast)</tt> and calls the functor \p f
+            for each item found:
+            \code
+            struct functor {
+                void operator()( value_type& item, Q const& key );
+            };
+            \endcode
+            where \p Q is the value type of \p Iterator. \p Iterator is a forward iterator.
+
+            Unlike the sequence of \p find() calls, the function computes the hashes, prefetches the bucket table entries
+            and then the bucket heads for \p cds::algo::c_nPrefetchDistance next keys while the current key is being searched,
+            so the cache misses for several keys overlap, see \p cds::algo::prefetch_pipeline().
+
+            The function returns the number of keys found.
+        */
+        template <typename Iterator, typename Func>
+        size_t find_batch( Iterator itFirst, Iterator itLast, Func f )
+        {
+            return find_batch_( itFirst, itLast, key_comparator(), f );
+        }
+
         /// Finds the key \p key and return the item found
         /** \anchor cds_intrusive_SplitListSet_hp_get
             The function searches the item with key equal to \p key
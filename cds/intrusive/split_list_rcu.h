@@ -35,6 +35,7 @@
 
 #include <cds/intrusive/details/split_list_base.h>
 #include <cds/details/binary_functor_wrapper.h>
+#include <cds/algo/prefetch.h>
 
 namespace cds { namespace intrusive {
 
@@ -218,6 +219,14 @@ namespace cds { namespace intrusive {
                 return base_class::find_at( h, val, cmp, f );
             }
 
+            template <typename Q, typename Compare, typename Func>
+            bool find_at( typename base_class::rcu_batch_lock& bl, dummy_node_type * pHead, split_list::details::search_value_type<Q>& val, Compare cmp, Func f )
+            {
+                assert( pHead != nullptr );
+                bucket_head_type h(pHead);
+                return base_class::find_at( bl, h, val, cmp, f );
+            }
+
             template <typename Q, typename Compare>
             bool find_at( dummy_node_type * pHead, split_list::details::search_value_type<Q> const & val, Compare cmp )
             {
@@ -417,6 +426,35 @@ namespace cds { namespace intrusive {
                 [&f](value_type& item, split_list::details::search_value_type<Q>& val){ f(item, val.val ); }));
         }
 
+        template <typename Iterator, typename Compare, typename Func>
+        size_t find_batch_( Iterator itFirst, Iterator itLast, Compare cmp, Func& f )
+        {
+            typedef typename std::iterator_traits<Iterator>::value_type key_arg;
+            typedef split_list::details::search_value_type<key_arg const> search_value;
+
+            typename gc::batch_lock bl;
+            return cds::algo::prefetch_pipeline< cds::algo::c_nPrefetchDistance, size_t >( itFirst, itLast,
+                [this]( key_arg const& key ) -> size_t {
+                    size_t nHash = hash_value( key );
+                    m_Buckets.prefetch( bucket_no( nHash ));
+                    return nHash;
+                },
+                [this]( size_t nHash ) {
+                    dummy_node_type * pHead = m_Buckets.bucket( bucket_no( nHash ));
+                    if ( pHead )
+                        CDS_PREFETCH( pHead );
+                },
+                [this, &cmp, &f, &bl]( key_arg const& key, size_t nHash ) -> bool {
+                    bl.step();
+                    search_value sv( key, split_list::regular_hash( nHash ));
+                    dummy_node_type * pHead = get_bucket( nHash );
+                    assert( pHead != nullptr );
+                    return m_Stat.onFind( m_List.find_at( bl, pHead, sv, cmp,
+                        [&f]( value_type& item, search_value& val ) { f( item, val.val ); } ));
+                }
+            );
+        }
+
         template <typename Q, typename Compare>
         bool find_value( Q const& val, Compare cmp )
         {
@@ -915,6 +953,24 @@ namespace cds { namespace intrusive {
         }
         //@endcond
 
+        /// Finds a batch of keys
+        /**
+            The function searches each key from the range <tt>[itFirst, itLast)</tt> and calls the functor \p f
+            for each item found, see \ref cds_intrusive_SplitListSet_hp_find_batch "SplitListSet::find_batch()"
+            for the functor interface and prefetching details.
+
+            The whole batch is performed under one RCU \p batch_lock
+            that yields periodically if some thread is waiting for grace period.
+            The function should not be called under RCU lock.
+
+            The function returns the number of keys found.
+        */
+        template <typename Iterator, typename Func>
+        size_t find_batch( Iterator itFirst, Iterator itLast, Func f )
+        {
+            return find_batch_( itFirst, itLast, key_comparator(), f );
+        }
+
         /// Finds the key \p key and return the item found
         /** \anchor cds_intrusive_SplitListSet_rcu_get
             The function searches the item with key equal to \p key and returns the pointer to item found.
@@ -73,8 +73,12 @@ namespace cds { namespace intrusive {
 
         The \p Options are:
         - \p opt::mutex_policy - concurrent access policy.
-            Available policies: \p striped_set::striping, \p striped_set::refinable.
+            Available policies: \p striped_set::striping, \p striped_set::refinable, \p striped_set::incremental_refinable,
+            \p striped_set::seqlock_striping.
             Default is \p %striped_set::striping.
+            With \p %striped_set::seqlock_striping policy \p contains() searches the bucket without locking,
+            \p find() locks the stripe only to call the functor for the item found,
+            see the policy description for the requirements to the bucket container.
         - \p cds::opt::hash - hash functor. Default option value see <tt>opt::v::hash_selector <opt::none></tt>
             which selects default hash functor for your compiler.
         - \p cds::opt::compare - key comparison functor. No default functor is provided.
@@ -325,21 +329,36 @@ namespace cds { namespace intrusive {
         typedef cds::details::Allocator< bucket_type, allocator_type > bucket_allocator;  ///< bucket allocator type based on allocator_type
 
     protected:
-        bucket_type *   m_Buckets       ;   ///< Bucket table
-        size_t          m_nBucketMask   ;   ///< Bucket table size - 1. m_nBucketMask + 1 should be power of two.
+        atomics::atomic<bucket_type *>  m_Buckets       ;   ///< Bucket table
+        atomics::atomic<size_t>         m_nBucketMask   ;   ///< Bucket table size - 1. m_nBucketMask + 1 should be power of two.
         item_counter    m_ItemCounter   ;   ///< Item counter
         hash            m_Hash          ;   ///< Hash functor
 
         mutex_policy    m_MutexPolicy   ;   ///< Mutex policy
         resizing_policy m_ResizingPolicy;   ///< Resizing policy
 
+        bucket_type *   m_pOldBuckets   ;   ///< Old bucket table being migrated by incremental resizing, \p nullptr if no resizing is in progress
+        size_t          m_nOldCapacity  ;   ///< Capacity of \p m_pOldBuckets
+        atomics::atomic<size_t> m_nMigrateCursor; ///< Next old bucket to be migrated by incremental resizing
+        atomics::atomic<bool> m_bResizing;  ///< Incremental resizing is in progress
+
         static const size_t c_nMinimalCapacity = 16 ;   ///< Minimal capacity
+        static const size_t c_nMigrationStep = 4    ;   ///< Max number of old buckets migrated by an operation while incremental resizing
 
     protected:
         //@cond
         typedef typename mutex_policy::scoped_cell_lock     scoped_cell_lock;
         typedef typename mutex_policy::scoped_full_lock     scoped_full_lock;
         typedef typename mutex_policy::scoped_resize_lock   scoped_resize_lock;
+
+        typedef std::integral_constant< bool, striped_set::details::optimistic_read< mutex_policy >::value > optimistic_read;
+        typedef std::integral_constant< bool, striped_set::details::incremental_resize< mutex_policy >::value > incremental_resize;
+
+        static_assert( !optimistic_read::value || striped_set::details::has_optimistic_find< bucket_type >::value,
+            "seqlock_striping requires the bucket container with contiguous item array: "
+            "std::vector, boost::container::vector, boost::container::flat_set or boost::container::flat_map" );
+        static_assert( !optimistic_read::value || std::is_trivially_destructible< value_type >::value,
+            "seqlock_striping requires trivially destructible value type" );
         //@endcond
 
     protected:
@@ -353,8 +372,12 @@ namespace cds { namespace intrusive {
         void alloc_bucket_table( size_t nSize )
         {
             assert( cds::beans::is_power2( nSize ));
-            m_nBucketMask = nSize - 1;
-            m_Buckets = bucket_allocator().NewArray( nSize );
+            bucket_type * pBuckets = bucket_allocator().NewArray( nSize );
+
+            // An optimistic reader loads the mask before the table.
+            // The table only grows, so the reader never indexes the table out of its bounds
+            m_Buckets.store( pBuckets, atomics::memory_order_release );
+            m_nBucketMask.store( nSize - 1, atomics::memory_order_release );
         }
 
         static void free_bucket_table( bucket_type * pBuckets, size_t nSize )
@@ -362,32 +385,214 @@ namespace cds { namespace intrusive {
             bucket_allocator().Delete( pBuckets, nSize );
         }
 
+        struct retired_bucket_table {
+            bucket_type *   pBuckets;
+            size_t          nSize;
+        };
+        typedef cds::details::Allocator< retired_bucket_table, allocator_type > retired_table_allocator;
+
+        static void free_retired_bucket_table( retired_bucket_table * p )
+        {
+            bucket_allocator().deallocate( p->pBuckets, p->nSize );
+            retired_table_allocator().Delete( p );
+        }
+
+        void free_old_bucket_table( bucket_type * pBuckets, size_t nSize, std::false_type )
+        {
+            free_bucket_table( pBuckets, nSize );
+        }
+
+        void free_old_bucket_table( bucket_type * pBuckets, size_t nSize, std::true_type )
+        {
+            // The buckets are empty, so they are destroyed at once.
+            // The memory of the table is retired since an optimistic reader can still access it
+            for ( size_t i = 0; i < nSize; ++i )
+                pBuckets[i].~bucket_type();
+            retired_bucket_table * p = retired_table_allocator().New();
+            p->pBuckets = pBuckets;
+            p->nSize = nSize;
+            m_MutexPolicy.retire( p, free_retired_bucket_table );
+        }
+
         template <typename Q>
         size_t hashing( Q const& v ) const
         {
             return m_Hash( v );
         }
 
-        bucket_type * bucket( size_t nHash ) const CDS_NOEXCEPT
+        // The bucket for nHash, the cell lock for nHash must be held
+        bucket_type * bucket( size_t nHash )
         {
-            return m_Buckets + (nHash & m_nBucketMask);
+            migrate_bucket( nHash, incremental_resize());
+            return m_Buckets.load( atomics::memory_order_relaxed ) + (nHash & m_nBucketMask.load( atomics::memory_order_relaxed ));
+        }
+
+        void migrate_bucket( size_t /*nHash*/, std::false_type ) CDS_NOEXCEPT
+        {}
+
+        void migrate_bucket( size_t nHash, std::true_type )
+        {
+            // m_pOldBuckets is changed under full lock only
+            if ( m_pOldBuckets ) {
+                // The old bucket is empty if it has been migrated already
+                bucket_type * pOld = m_pOldBuckets + ( nHash & ( m_nOldCapacity - 1 ));
+                move_bucket_items( pOld );
+            }
+        }
+
+        void move_bucket_items( bucket_type * pFrom )
+        {
+            typedef typename bucket_type::iterator bucket_iterator;
+
+            bucket_type * pBuckets = m_Buckets.load( atomics::memory_order_relaxed );
+            size_t const nMask = m_nBucketMask.load( atomics::memory_order_relaxed );
+
+            bucket_iterator itEnd = pFrom->end();
+            bucket_iterator itNext;
+            for ( bucket_iterator it = pFrom->begin(); it != itEnd; it = itNext ) {
+                itNext = it;
+                ++itNext;
+                pBuckets[ m_Hash( *it ) & nMask ].move_item( *pFrom, it );
+            }
+            pFrom->clear();
+        }
+
+        // The bucket for optimistic reading without the lock
+        bucket_type * optimistic_bucket( size_t nHash ) const CDS_NOEXCEPT
+        {
+            size_t nMask = m_nBucketMask.load( atomics::memory_order_acquire );
+            return m_Buckets.load( atomics::memory_order_acquire ) + (nHash & nMask);
+        }
+
+        template <typename Find>
+        bool find_in_bucket( size_t nHash, Find find )
+        {
+            scoped_cell_lock sl( m_MutexPolicy, nHash );
+            return find( bucket( nHash ));
+        }
+
+        // Returns 1 if the key is found, 0 if it is not found, -1 if c_nReadAttempts attempts have failed.
+        // The optimistic search only tells whether the key is in the bucket:
+        // the item found can be changed by a concurrent writer, so the user functor must be called under the lock
+        template <typename OptimisticFind>
+        int optimistic_find_in_bucket( size_t nHash, OptimisticFind optimistic_find )
+        {
+            for ( unsigned int nAttempt = 0; nAttempt < mutex_policy::c_nReadAttempts; ++nAttempt ) {
+                typename mutex_policy::read_lock rl;
+                size_t nSeq = m_MutexPolicy.read_begin( nHash );
+                if ( nSeq & 1 ) {
+                    // a writer owns the stripe
+                    continue;
+                }
+
+                // The bounds of the item array must be consistent before the search:
+                // torn begin/end pair can span the memory that does not belong to the bucket
+                typename bucket_type::item_range range = optimistic_bucket( nHash )->optimistic_range();
+                if ( !m_MutexPolicy.read_validate( nHash, nSeq ))
+                    continue;
+
+                bool bFound = optimistic_find( range );
+                if ( m_MutexPolicy.read_validate( nHash, nSeq ))
+                    return bFound ? 1 : 0;
+            }
+
+            // Too many concurrent writes, the lock is required
+            return -1;
         }
 
         template <typename Q, typename Func>
         bool find_( Q& val, Func f )
+        {
+            return find_( val, f, optimistic_read());
+        }
+
+        template <typename Q, typename Func>
+        bool find_( Q& val, Func f, std::false_type )
         {
             size_t nHash = hashing( val );
+            return find_in_bucket( nHash, [&val, &f]( bucket_type * pBucket ) { return pBucket->find( val, f ); } );
+        }
 
-            scoped_cell_lock sl( m_MutexPolicy, nHash );
-            return bucket( nHash )->find( val, f );
+        template <typename Q, typename Func>
+        bool find_( Q& val, Func f, std::true_type )
+        {
+            typedef typename bucket_type::item_range item_range;
+            size_t nHash = hashing( val );
+
+            // The optimistic search proves the absence of val without the lock.
+            // If val is found, f is called under the lock since it may change the item
+            if ( optimistic_find_in_bucket( nHash, [&val]( item_range r ) { return bucket_type::optimistic_find( r, val ); } ) == 0 )
+                return false;
+            return find_( val, f, std::false_type());
+        }
+
+        template <typename Q>
+        bool contains_( Q const& key )
+        {
+            return contains_( key, optimistic_read());
+        }
+
+        template <typename Q>
+        bool contains_( Q const& key, std::false_type )
+        {
+            return find_( key, [](value_type&, Q const& ) {}, std::false_type());
+        }
+
+        template <typename Q>
+        bool contains_( Q const& key, std::true_type )
+        {
+            typedef typename bucket_type::item_range item_range;
+            int nResult = optimistic_find_in_bucket( hashing( key ), [&key]( item_range r ) { return bucket_type::optimistic_find( r, key ); } );
+            if ( nResult >= 0 )
+                return nResult > 0;
+            return contains_( key, std::false_type());
         }
 
         template <typename Q, typename Less, typename Func>
         bool find_with_( Q& val, Less pred, Func f )
+        {
+            return find_with_( val, pred, f, optimistic_read());
+        }
+
+        template <typename Q, typename Less, typename Func>
+        bool find_with_( Q& val, Less pred, Func f, std::false_type )
         {
             size_t nHash = hashing( val );
-            scoped_cell_lock sl( m_MutexPolicy, nHash );
-            return bucket( nHash )->find( val, pred, f );
+            return find_in_bucket( nHash, [&val, pred, &f]( bucket_type * pBucket ) { return pBucket->find( val, pred, f ); } );
+        }
+
+        template <typename Q, typename Less, typename Func>
+        bool find_with_( Q& val, Less pred, Func f, std::true_type )
+        {
+            typedef typename bucket_type::item_range item_range;
+            size_t nHash = hashing( val );
+
+            // See find_()
+            if ( optimistic_find_in_bucket( nHash, [&val, pred]( item_range r ) { return bucket_type::optimistic_find( r, val, pred ); } ) == 0 )
+                return false;
+            return find_with_( val, pred, f, std::false_type());
+        }
+
+        template <typename Q, typename Less>
+        bool contains_with_( Q const& key, Less pred )
+        {
+            return contains_with_( key, pred, optimistic_read());
+        }
+
+        template <typename Q, typename Less>
+        bool contains_with_( Q const& key, Less pred, std::false_type )
+        {
+            return find_with_( key, pred, [](value_type&, Q const& ) {}, std::false_type());
+        }
+
+        template <typename Q, typename Less>
+        bool contains_with_( Q const& key, Less pred, std::true_type )
+        {
+            typedef typename bucket_type::item_range item_range;
+            int nResult = optimistic_find_in_bucket( hashing( key ), [&key, pred]( item_range r ) { return bucket_type::optimistic_find( r, key, pred ); } );
+            if ( nResult >= 0 )
+                return nResult > 0;
+            return contains_with_( key, pred, std::false_type());
         }
 
         void internal_resize( size_t nNewCapacity )
@@ -396,36 +601,111 @@ namespace cds { namespace intrusive {
             m_MutexPolicy.resize( nNewCapacity );
 
             size_t nOldCapacity = bucket_count();
-            bucket_type * pOldBuckets = m_Buckets;
+            bucket_type * pOldBuckets = m_Buckets.load( atomics::memory_order_relaxed );
 
             alloc_bucket_table( nNewCapacity );
 
-            typedef typename bucket_type::iterator bucket_iterator;
             bucket_type * pEnd = pOldBuckets + nOldCapacity;
-            for ( bucket_type * pCur = pOldBuckets; pCur != pEnd; ++pCur ) {
-                bucket_iterator itEnd = pCur->end();
-                bucket_iterator itNext;
-                for ( bucket_iterator it = pCur->begin(); it != itEnd; it = itNext ) {
-                    itNext = it;
-                    ++itNext;
-                    bucket( m_Hash( *it ) )->move_item( *pCur, it );
+            for ( bucket_type * pCur = pOldBuckets; pCur != pEnd; ++pCur )
+                move_bucket_items( pCur );
+
+            free_old_bucket_table( pOldBuckets, nOldCapacity, optimistic_read());
+
+            m_ResizingPolicy.reset();
+        }
+
+        void resize()
+        {
+            resize( incremental_resize());
+        }
+
+        void resize( std::true_type )
+        {
+            bool bResizing = false;
+            if ( !m_bResizing.compare_exchange_strong( bResizing, true, atomics::memory_order_acquire, atomics::memory_order_relaxed ))
+                return;
+
+            // Only this thread can change the bucket table and the lock array until m_bResizing is reset,
+            // the old buckets are migrated by subsequent operations, see help_resize()
+            size_t const nOldCapacity = bucket_count();
+            size_t const nNewCapacity = nOldCapacity * 2;
+
+            // Old bucket i is split into new buckets i and i + nOldCapacity,
+            // all of them must be protected by the same lock
+            if ( m_MutexPolicy.lock_count() < nOldCapacity )
+                m_MutexPolicy.resize( nOldCapacity );
+
+            bucket_type * pOldBuckets = m_Buckets.load( atomics::memory_order_relaxed );
+            bucket_type * pNewBuckets = bucket_allocator().NewArray( nNewCapacity );
+            {
+                scoped_full_lock al( m_MutexPolicy );
+                m_pOldBuckets = pOldBuckets;
+                m_nOldCapacity = nOldCapacity;
+                m_nMigrateCursor.store( 0, atomics::memory_order_relaxed );
+                m_Buckets.store( pNewBuckets, atomics::memory_order_release );
+                m_nBucketMask.store( nNewCapacity - 1, atomics::memory_order_release );
+            }
+        }
+
+        // Migrates up to c_nMigrationStep old buckets if incremental resizing is in progress.
+        // Must be called without any cell lock held
+        void help_resize()
+        {
+            help_resize( incremental_resize());
+        }
+
+        void help_resize( std::false_type ) CDS_NOEXCEPT
+        {}
+
+        void help_resize( std::true_type )
+        {
+            if ( !m_bResizing.load( atomics::memory_order_acquire ))
+                return;
+
+            bool bLast = false;
+            for ( size_t nStep = 0; nStep < c_nMigrationStep && !bLast; ++nStep ) {
+                size_t nCursor = m_nMigrateCursor.load( atomics::memory_order_relaxed );
+
+                // The old bucket i and the cursor are protected by the lock of stripe i;
+                // m_pOldBuckets, m_nOldCapacity and the cursor reset are changed under full lock only
+                scoped_cell_lock sl( m_MutexPolicy, nCursor );
+                if ( !m_pOldBuckets || nCursor >= m_nOldCapacity )
+                    return;
+                if ( m_nMigrateCursor.compare_exchange_strong( nCursor, nCursor + 1, atomics::memory_order_relaxed, atomics::memory_order_relaxed )) {
+                    move_bucket_items( m_pOldBuckets + nCursor );
+                    bLast = nCursor + 1 == m_nOldCapacity;
                 }
-                pCur->clear();
             }
 
+            if ( bLast )
+                finish_resize();
+        }
+
+        void finish_resize()
+        {
+            bucket_type * pOldBuckets;
+            size_t nOldCapacity;
+            {
+                // Waits for the threads that can still access the old table
+                scoped_full_lock al( m_MutexPolicy );
+                pOldBuckets = m_pOldBuckets;
+                nOldCapacity = m_nOldCapacity;
+                m_pOldBuckets = nullptr;
+                m_nOldCapacity = 0;
+                m_ResizingPolicy.reset();
+            }
             free_bucket_table( pOldBuckets, nOldCapacity );
 
-            m_ResizingPolicy.reset();
+            m_bResizing.store( false, atomics::memory_order_release );
         }
 
-        void resize()
+        void resize( std::false_type )
         {
             size_t nOldCapacity = bucket_count();
-            size_t volatile& refBucketMask = m_nBucketMask;
 
             scoped_resize_lock al( m_MutexPolicy );
             if ( al.success() ) {
-                if ( nOldCapacity != refBucketMask + 1 ) {
+                if ( nOldCapacity != bucket_count() ) {
                     // someone resized already
                     return;
                 }
@@ -442,8 +722,12 @@ namespace cds { namespace intrusive {
             : m_Buckets( nullptr )
         , m_nBucketMask( c_nMinimalCapacity - 1 )
         , m_MutexPolicy( c_nMinimalCapacity )
+        , m_pOldBuckets( nullptr )
+        , m_nOldCapacity( 0 )
+        , m_nMigrateCursor( 0 )
+        , m_bResizing( false )
         {
-            alloc_bucket_table( m_nBucketMask + 1 );
+            alloc_bucket_table( bucket_count() );
         }
 
         /// Ctor with initial capacity specified
@@ -452,9 +736,13 @@ namespace cds { namespace intrusive {
         )
         : m_Buckets( nullptr )
         , m_nBucketMask( calc_init_capacity(nCapacity) - 1 )
-        , m_MutexPolicy( m_nBucketMask + 1 )
+        , m_MutexPolicy( bucket_count() )
+        , m_pOldBuckets( nullptr )
+        , m_nOldCapacity( 0 )
+        , m_nMigrateCursor( 0 )
+        , m_bResizing( false )
         {
-            alloc_bucket_table( m_nBucketMask + 1 );
+            alloc_bucket_table( bucket_count() );
         }
 
         /// Ctor with resizing policy (copy semantics)
@@ -467,10 +755,14 @@ namespace cds { namespace intrusive {
         )
         : m_Buckets( nullptr )
         , m_nBucketMask( ( nCapacity ? calc_init_capacity(nCapacity) : c_nMinimalCapacity ) - 1 )
-        , m_MutexPolicy( m_nBucketMask + 1 )
+        , m_MutexPolicy( bucket_count() )
         , m_ResizingPolicy( resizingPolicy )
+        , m_pOldBuckets( nullptr )
+        , m_nOldCapacity( 0 )
+        , m_nMigrateCursor( 0 )
+        , m_bResizing( false )
         {
-            alloc_bucket_table( m_nBucketMask + 1 );
+            alloc_bucket_table( bucket_count() );
         }
 
         /// Ctor with resizing policy (move semantics)
@@ -484,16 +776,22 @@ namespace cds { namespace intrusive {
         )
         : m_Buckets( nullptr )
         , m_nBucketMask( ( nCapacity ? calc_init_capacity(nCapacity) : c_nMinimalCapacity ) - 1 )
-        , m_MutexPolicy( m_nBucketMask + 1 )
+        , m_MutexPolicy( bucket_count() )
         , m_ResizingPolicy( std::forward<resizing_policy>( resizingPolicy ) )
+        , m_pOldBuckets( nullptr )
+        , m_nOldCapacity( 0 )
+        , m_nMigrateCursor( 0 )
+        , m_bResizing( false )
         {
-            alloc_bucket_table( m_nBucketMask + 1 );
+            alloc_bucket_table( bucket_count() );
         }
 
         /// Destructor destroys internal data
         ~StripedSet()
         {
-            free_bucket_table( m_Buckets, m_nBucketMask + 1 );
+            free_bucket_table( m_Buckets.load( atomics::memory_order_relaxed ), bucket_count() );
+            if ( m_pOldBuckets )
+                free_bucket_table( m_pOldBuckets, m_nOldCapacity );
         }
 
     public:
@@ -538,6 +836,7 @@ namespace cds { namespace intrusive {
 
             if ( bResize )
                 resize();
+            help_resize();
             return bOk;
         }
 
@@ -582,6 +881,7 @@ namespace cds { namespace intrusive {
 
             if ( bResize )
                 resize();
+            help_resize();
             return result;
         }
         //@cond
@@ -612,6 +912,7 @@ namespace cds { namespace intrusive {
 
             if ( bOk )
                 --m_ItemCounter;
+            help_resize();
             return bOk;
         }
 
@@ -672,6 +973,7 @@ namespace cds { namespace intrusive {
 
             if ( pVal )
                 --m_ItemCounter;
+            help_resize();
             return pVal;
         }
 
@@ -694,6 +996,7 @@ namespace cds { namespace intrusive {
 
             if ( pVal )
                 --m_ItemCounter;
+            help_resize();
             return pVal;
         }
 
@@ -786,7 +1089,7 @@ namespace cds { namespace intrusive {
         template <typename Q>
         bool contains( Q const& key )
         {
-            return find( key, [](value_type&, Q const& ) {} );
+            return contains_( key );
         }
         //@cond
         template <typename Q>
@@ -806,7 +1109,7 @@ namespace cds { namespace intrusive {
         template <typename Q, typename Less>
         bool contains( Q const& key, Less pred )
         {
-            return find_with( key, pred, [](value_type& , Q const& ) {} );
+            return contains_with_( key, pred );
         }
         //@cond
         template <typename Q, typename Less>
@@ -827,9 +1130,14 @@ namespace cds { namespace intrusive {
             scoped_full_lock sl( m_MutexPolicy );
 
             size_t nBucketCount = bucket_count();
-            bucket_type * pBucket = m_Buckets;
+            bucket_type * pBucket = m_Buckets.load( atomics::memory_order_relaxed );
             for ( size_t i = 0; i < nBucketCount; ++i, ++pBucket )
                 pBucket->clear();
+
+            // The buckets not migrated yet by incremental resizing
+            pBucket = m_pOldBuckets;
+            for ( size_t i = 0; i < m_nOldCapacity; ++i, ++pBucket )
+                pBucket->clear();
             m_ItemCounter.reset();
         }
 
@@ -850,9 +1158,14 @@ namespace cds { namespace intrusive {
             scoped_full_lock sl( m_MutexPolicy );
 
             size_t nBucketCount = bucket_count();
-            bucket_type * pBucket = m_Buckets;
+            bucket_type * pBucket = m_Buckets.load( atomics::memory_order_relaxed );
             for ( size_t i = 0; i < nBucketCount; ++i, ++pBucket )
                 pBucket->clear( disposer );
+
+            // The buckets not migrated yet by incremental resizing
+            pBucket = m_pOldBuckets;
+            for ( size_t i = 0; i < m_nOldCapacity; ++i, ++pBucket )
+                pBucket->clear( disposer );
             m_ItemCounter.reset();
         }
 
@@ -877,7 +1190,7 @@ namespace cds { namespace intrusive {
         */
         size_t bucket_count() const
         {
-            return m_nBucketMask + 1;
+            return m_nBucketMask.load( atomics::memory_order_relaxed ) + 1;
         }
 
         /// Returns lock array size
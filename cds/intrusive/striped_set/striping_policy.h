@@ -33,7 +33,9 @@
 
 #include <memory>
 #include <mutex>
+#include <type_traits>
 #include <cds/sync/lock_array.h>
+#include <cds/details/type_padding.h>
 #include <cds/os/thread.h>
 #include <cds/sync/spinlock.h>
 
@@ -127,6 +129,360 @@ namespace cds { namespace intrusive { namespace striped_set {
     };
 
 
+    /// Lock striping policy with optimistic reads
+    /**
+        This is one of available opt::mutex_policy option type for StripedSet
+
+        The policy is the same lock striping as \p striped_set::striping,
+        but each lock of the lock array is paired with a sequence counter.
+        A writer increments the counter of the stripe after it acquires the lock and before it releases the lock,
+        so the counter is odd while the stripe is being changed.
+
+        The read-only operations of \p StripedSet (\p find(), \p contains() and so on) do not acquire the lock.
+        Such an operation reads the counter, searches the bucket and then checks that the counter has not changed.
+        If a write is detected, the search is repeated; after \p ReadAttempts unsuccessful attempts
+        the operation acquires the stripe lock. So the readers do not write to shared memory
+        and scale with the number of reading threads.
+
+        Since the bucket is read concurrently with a writer, the memory of the bucket must not be freed
+        while a reader can access it. The policy uses \p RCU for that:
+        - the optimistic search is performed in RCU read-side critical section;
+        - the old bucket table is retired via \p RCU when the set is resized;
+        - the bucket container must allocate its memory with \p striped_set::rcu_retired_allocator,
+          for example, <tt>std::vector< T, rcu_retired_allocator< RCU, T > ></tt>, that retires
+          the deallocated memory via \p RCU too.
+
+        Only the containers that keep their items in contiguous array can be the bucket:
+        \p std::vector, \p boost::container::vector, \p boost::container::flat_set for \p StripedSet
+        and \p boost::container::flat_map for \p StripedMap. The reader takes the bounds of the array
+        and validates them before the search, so it never follows a pointer stored inside the container.
+        Node-based containers (\p std::list, \p std::set, \p std::map, intrusive containers and so on)
+        are rejected at compile time.
+
+        The optimistic reader can observe the item being changed, therefore it only decides whether the key
+        is in the set: \p StripedSet::contains() needs no lock, \p StripedSet::find() acquires the stripe lock
+        if the key is found and calls its functor under the lock. Besides:
+        - the item (the key and the value for the map) must be trivially destructible, because
+          the array of the container is destroyed at once when it is reallocated, only its memory is retired.
+          It is checked at compile time.
+
+        The modifying operations call \p RCU::retire_ptr(), so they must not be called
+        inside RCU read-side critical section.
+
+        Template arguments:
+        - \p RCU - one of \ref cds_urcu_gc "RCU type"
+        - \p Lock - the type of mutex. The default is \p std::mutex. The mutex type should be default-constructible.
+        - \p ReadAttempts - count of optimistic read attempts before the stripe lock is acquired, default is 4.
+        - \p Alloc - allocator type used for lock array memory allocation. Default is \p CDS_DEFAULT_ALLOCATOR.
+    */
+    template <class RCU, class Lock = std::mutex, unsigned int ReadAttempts = 4, class Alloc = CDS_DEFAULT_ALLOCATOR >
+    class seqlock_striping
+    {
+    public:
+        typedef RCU     rcu             ;   ///< RCU type
+        typedef Lock    lock_type       ;   ///< lock type
+        typedef Alloc   allocator_type  ;   ///< allocator type
+
+        static CDS_CONSTEXPR const unsigned int c_nReadAttempts = ReadAttempts; ///< Count of optimistic read attempts
+        static_assert( c_nReadAttempts > 0, "ReadAttempts must be positive" );
+
+        typedef typename rcu::scoped_lock   read_lock   ;   ///< RCU lock for optimistic reading
+
+    protected:
+        //@cond
+        struct stripe_data {
+            lock_type               m_Lock;
+            atomics::atomic<size_t> m_nSeq;  // odd if the stripe is being changed
+
+            stripe_data()
+                : m_nSeq( 0 )
+            {}
+        };
+        // Each stripe occupies its own cache line
+        typedef typename cds::details::type_padding< stripe_data, cds::c_nCacheLineSize >::type stripe;
+        typedef cds::details::Allocator< stripe, allocator_type > stripe_allocator;
+
+        stripe *        m_arrStripes;
+        size_t const    m_nStripeMask;
+        //@endcond
+
+    protected:
+        //@cond
+        stripe& at( size_t nHash ) const
+        {
+            return m_arrStripes[ nHash & m_nStripeMask ];
+        }
+
+        static void lock( stripe& s )
+        {
+            s.m_Lock.lock();
+            s.m_nSeq.store( s.m_nSeq.load( atomics::memory_order_relaxed ) + 1, atomics::memory_order_relaxed );
+            atomics::atomic_thread_fence( atomics::memory_order_release );
+        }
+
+        static void unlock( stripe& s )
+        {
+            s.m_nSeq.store( s.m_nSeq.load( atomics::memory_order_relaxed ) + 1, atomics::memory_order_release );
+            s.m_Lock.unlock();
+        }
+
+        void lock_all()
+        {
+            for ( size_t i = 0; i <= m_nStripeMask; ++i )
+                lock( m_arrStripes[i] );
+        }
+
+        void unlock_all()
+        {
+            for ( size_t i = m_nStripeMask + 1; i > 0; --i )
+                unlock( m_arrStripes[i - 1] );
+        }
+        //@endcond
+
+    public:
+        //@cond
+        class scoped_cell_lock {
+            stripe& m_Stripe;
+
+        public:
+            scoped_cell_lock( seqlock_striping& policy, size_t nHash )
+                : m_Stripe( policy.at( nHash ))
+            {
+                lock( m_Stripe );
+            }
+
+            ~scoped_cell_lock()
+            {
+                unlock( m_Stripe );
+            }
+        };
+
+        class scoped_full_lock {
+            seqlock_striping& m_Policy;
+        public:
+            scoped_full_lock( seqlock_striping& policy )
+                : m_Policy( policy )
+            {
+                policy.lock_all();
+            }
+
+            ~scoped_full_lock()
+            {
+                m_Policy.unlock_all();
+            }
+        };
+
+        class scoped_resize_lock: public scoped_full_lock {
+        public:
+            scoped_resize_lock( seqlock_striping& policy )
+                : scoped_full_lock( policy )
+            {}
+
+            bool success() const
+            {
+                return true;
+            }
+        };
+        //@endcond
+
+    public:
+        /// Constructor
+        seqlock_striping(
+            size_t nLockCount   ///< The size of lock array. Must be power of two.
+        )
+            : m_arrStripes( stripe_allocator().NewArray( nLockCount ))
+            , m_nStripeMask( nLockCount - 1 )
+        {
+            assert( cds::beans::is_power2( nLockCount ));
+        }
+
+        /// Destructor
+        ~seqlock_striping()
+        {
+            stripe_allocator().Delete( m_arrStripes, m_nStripeMask + 1 );
+        }
+
+        /// Returns lock array size
+        /**
+            Lock array size is unchanged during \p seqlock_striping object lifetime
+        */
+        size_t lock_count() const
+        {
+            return m_nStripeMask + 1;
+        }
+
+        /// Starts optimistic reading of the stripe for \p nHash, returns the sequence number of the stripe
+        /**
+            The odd sequence number means that the stripe is being changed now.
+            Optimistic reading must be performed inside \p read_lock.
+        */
+        size_t read_begin( size_t nHash ) const
+        {
+            return at( nHash ).m_nSeq.load( atomics::memory_order_acquire );
+        }
+
+        /// Checks that the stripe for \p nHash has not been changed since \p read_begin() has returned \p nSeq
+        bool read_validate( size_t nHash, size_t nSeq ) const
+        {
+            atomics::atomic_thread_fence( atomics::memory_order_acquire );
+            return at( nHash ).m_nSeq.load( atomics::memory_order_relaxed ) == nSeq;
+        }
+
+        /// Retires \p p via \p RCU, the functor \p pFunc is called when no optimistic reader can access \p p
+        template <typename T>
+        static void retire( T * p, void (* pFunc)( T * ))
+        {
+            rcu::retire_ptr( p, pFunc );
+        }
+
+        //@cond
+        void resize( size_t /*nNewCapacity*/ )
+        {}
+        //@endcond
+    };
+
+    /// Allocator for the bucket container of \p StripedSet with \p seqlock_striping policy
+    /**
+        The allocator allocates memory via \p Alloc, but the memory deallocated is not freed at once:
+        it is retired via \p RCU and freed after the grace period. So an optimistic reader
+        of \p seqlock_striping policy never accesses freed memory.
+
+        Template arguments:
+        - \p RCU - one of \ref cds_urcu_gc "RCU type", the same as for \p seqlock_striping
+        - \p T - value type
+        - \p Alloc - the underlying allocator. Default is \p CDS_DEFAULT_ALLOCATOR.
+    */
+    template <class RCU, typename T, class Alloc = CDS_DEFAULT_ALLOCATOR >
+    class rcu_retired_allocator
+    {
+    public:
+        typedef RCU                 rcu;                ///< RCU type
+        typedef T                   value_type;         ///< Value type
+        typedef T *                 pointer;            ///< Pointer to \p T
+        typedef T const *           const_pointer;      ///< Pointer to const \p T
+        typedef T&                  reference;          ///< Reference to \p T
+        typedef T const&            const_reference;    ///< Reference to const \p T
+        typedef size_t              size_type;          ///< Size type
+        typedef std::ptrdiff_t      difference_type;    ///< Difference type
+
+        /// Rebinds the allocator to type \p U
+        template <typename U>
+        struct rebind {
+            typedef rcu_retired_allocator< RCU, U, Alloc > other; ///< Rebinding result
+        };
+
+    protected:
+        //@cond
+        // The header keeps the size of the block to free it after the grace period
+        union header {
+            size_t          nSize;
+            long double     align1_;
+            void *          align2_;
+        };
+        static_assert( std::alignment_of< T >::value <= std::alignment_of< header >::value, "Too large alignment of T" );
+
+        typedef typename Alloc::template rebind< char >::other char_allocator;
+
+        static void free_block( header * p )
+        {
+            size_t const nSize = p->nSize;
+            char_allocator().deallocate( reinterpret_cast<char *>( p ), nSize );
+        }
+        //@endcond
+
+    public:
+        //@cond
+        rcu_retired_allocator() CDS_NOEXCEPT
+        {}
+
+        template <typename U>
+        rcu_retired_allocator( rcu_retired_allocator< RCU, U, Alloc > const& ) CDS_NOEXCEPT
+        {}
+        //@endcond
+
+        /// Allocates memory for \p n objects of type \p T
+        pointer allocate( size_type n, void const * /*hint*/ = nullptr )
+        {
+            size_t const nSize = sizeof( header ) + n * sizeof( T );
+            header * p = reinterpret_cast<header *>( char_allocator().allocate( nSize ));
+            p->nSize = nSize;
+            return reinterpret_cast<pointer>( p + 1 );
+        }
+
+        /// Retires memory \p p via \p RCU
+        void deallocate( pointer p, size_type /*n*/ )
+        {
+            rcu::retire_ptr( reinterpret_cast<header *>( p ) - 1, free_block );
+        }
+
+        //@cond
+        size_type max_size() const CDS_NOEXCEPT
+        {
+            return ( static_cast<size_type>( -1 ) - sizeof( header )) / sizeof( T );
+        }
+
+        pointer address( reference x ) const CDS_NOEXCEPT
+        {
+            return std::addressof( x );
+        }
+
+        const_pointer address( const_reference x ) const CDS_NOEXCEPT
+        {
+            return std::addressof( x );
+        }
+
+        template <typename U, typename... Args>
+        void construct( U * p, Args&&... args )
+        {
+            new( p ) U( std::forward<Args>( args )... );
+        }
+
+        template <typename U>
+        void destroy( U * p )
+        {
+            p->~U();
+        }
+
+        template <typename U>
+        bool operator ==( rcu_retired_allocator< RCU, U, Alloc > const& ) const CDS_NOEXCEPT
+        {
+            return true;
+        }
+
+        template <typename U>
+        bool operator !=( rcu_retired_allocator< RCU, U, Alloc > const& ) const CDS_NOEXCEPT
+        {
+            return false;
+        }
+        //@endcond
+    };
+
+    //@cond
+    namespace details {
+        // Checks if the mutex policy supports optimistic reading
+        template <typename Policy>
+        struct optimistic_read: public std::false_type
+        {};
+
+        template <class RCU, class Lock, unsigned int ReadAttempts, class Alloc>
+        struct optimistic_read< seqlock_striping< RCU, Lock, ReadAttempts, Alloc >>: public std::true_type
+        {};
+
+        // Checks if the bucket container can be searched without the lock.
+        // Only the adapters of the containers with contiguous item array (std::vector, boost::container::vector,
+        // boost::container::flat_set, boost::container::flat_map) support it: a node-based container
+        // can free its node while an optimistic reader is still traversing it
+        template <typename Bucket>
+        struct has_optimistic_find
+        {
+            template <typename T> static std::true_type test( typename T::item_range * );
+            template <typename T> static std::false_type test( ... );
+
+            static bool const value = decltype( test<Bucket>( nullptr ))::value;
+        };
+    } // namespace details
+    //@endcond
+
     /// Refinable concurrent access policy
     /**
         This is one of available opt::mutex_policy option type for StripedSet
@@ -379,6 +735,84 @@ namespace cds { namespace intrusive { namespace striped_set {
         }
     };
 
+    /// Refinable concurrent access policy with incremental resizing
+    /**
+        This is one of available opt::mutex_policy option type for StripedSet
+
+        The policy is like \p striped_set::refinable but the set is resized without stopping all operations.
+        When \p StripedSet with \p refinable policy is resized, the policy blocks the entire lock array
+        until all buckets are rehashed, that can take a long time for the large set.
+        With \p incremental_refinable policy \p StripedSet keeps the old and the new bucket tables side by side:
+        - the new bucket table is allocated and published under short full lock
+          that does not rehash any item;
+        - an operation migrates the old bucket it touches to the new table;
+        - besides, each insert or erase operation migrates a few (at most \p StripedSet::c_nMigrationStep)
+          next old buckets locking only the stripe of the bucket being migrated;
+        - the operation that migrates the last old bucket unlinks the old table under short full lock and frees it.
+
+        Since the old bucket \p i is split into the new buckets \p i and <tt>i + N</tt>, where \p N is the old
+        table capacity, all three buckets are protected by one lock while the lock array size is not greater than \p N.
+        So the lock array is grown up to \p N when the next resizing is started, not immediately.
+        A new resizing cannot be started until previous one is completed.
+
+        Template arguments are the same as for \p striped_set::refinable.
+    */
+    template <
+        class RecursiveLock = std::recursive_mutex,
+        typename BackOff = cds::backoff::yield,
+        class Alloc = CDS_DEFAULT_ALLOCATOR>
+    class incremental_refinable: public refinable< RecursiveLock, BackOff, Alloc >
+    {
+        //@cond
+        typedef refinable< RecursiveLock, BackOff, Alloc > base_class;
+        typedef typename base_class::lock_array_ptr        lock_array_ptr;
+        typedef typename base_class::lock_array_allocator  lock_array_allocator;
+        typedef typename base_class::lock_array_disposer   lock_array_disposer;
+        typedef typename base_class::scoped_spinlock       scoped_spinlock;
+        //@endcond
+
+    public:
+        /// Constructor
+        incremental_refinable(
+            size_t nLockCount   ///< Initial size of lock array. Must be power of two.
+        )
+        : base_class( nLockCount )
+        {}
+
+        /// Resize for new capacity
+        /**
+            Unlike \p refinable::resize() the function must not be called under \p scoped_resize_lock.
+            The new lock array is allocated without locking, then the function
+            acquires all locks of the current array only to swap the arrays.
+        */
+        void resize( size_t nNewCapacity )
+        {
+            lock_array_ptr pNewArr( lock_array_allocator().New( nNewCapacity ), lock_array_disposer() );
+
+            // The thread waiting for old lock rechecks the lock array after locking
+            lock_array_ptr pOldArr = base_class::acquire_all();
+            {
+                scoped_spinlock sl( base_class::m_access );
+                base_class::m_arrLocks.swap( pNewArr );
+            }
+            base_class::m_nCapacity.store( nNewCapacity, atomics::memory_order_relaxed );
+            base_class::release_all( pOldArr );
+        }
+    };
+
+    //@cond
+    namespace details {
+        // Checks if the mutex policy supports incremental resizing
+        template <typename Policy>
+        struct incremental_resize: public std::false_type
+        {};
+
+        template <class RecursiveLock, typename BackOff, class Alloc>
+        struct incremental_resize< incremental_refinable< RecursiveLock, BackOff, Alloc >>: public std::true_type
+        {};
+    } // namespace details
+    //@endcond
+
 }}} // namespace cds::intrusive::striped_set
 
 #endif
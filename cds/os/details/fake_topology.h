@@ -60,6 +60,67 @@ namespace cds { namespace OS { namespace details {
         {
             return current_processor();
         }
+
+        /// NUMA node count for the system. Always returns 1
+        static unsigned int numa_node_count()
+        {
+            return 1;
+        }
+
+        /// Returns NUMA node of processor \p nProcessor. Always returns 0
+        static unsigned int numa_node( unsigned int /*nProcessor*/ )
+        {
+            return 0;
+        }
+
+        /// Returns NUMA node of the current processor. Always returns 0
+        static unsigned int current_numa_node()
+        {
+            return 0;
+        }
+
+        /// Returns the core id of processor \p nProcessor. Each processor is considered as a separate core
+        static unsigned int core_id( unsigned int nProcessor )
+        {
+            return nProcessor;
+        }
+
+        /// Returns physical package id of processor \p nProcessor. Always returns 0
+        static unsigned int package_id( unsigned int /*nProcessor*/ )
+        {
+            return 0;
+        }
+
+        /// Online NUMA node count. Always returns 1
+        static unsigned int numa_online_node_count()
+        {
+            return 1;
+        }
+
+        /// Returns the id of \p nIndex-th online NUMA node. Always returns 0
+        static unsigned int numa_online_node( unsigned int /*nIndex*/ )
+        {
+            return 0;
+        }
+
+        /// Makes \p nNode the preferred node for the memory allocated by the current thread. Not supported, returns \p false
+        static bool set_numa_preferred_node( unsigned int /*nNode*/ )
+        {
+            return false;
+        }
+
+        /// Memory policy of a thread, see \p get_numa_memory_policy(). Not supported
+        struct numa_memory_policy {};
+
+        /// Saves the memory policy of the current thread to \p policy. Not supported, returns \p false
+        static bool get_numa_memory_policy( numa_memory_policy& /*policy*/ )
+        {
+            return false;
+        }
+
+        /// Restores the memory policy saved by \p get_numa_memory_policy(). Does nothing
+        static void set_numa_memory_policy( numa_memory_policy const& /*policy*/ )
+        {}
     };
 }}}  // namespace cds::OS::details
 //@endcond
@@ -0,0 +1,102 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#ifndef CDSLIB_OS_LINUX_MEMBARRIER_H
+#define CDSLIB_OS_LINUX_MEMBARRIER_H
+
+#ifndef CDSLIB_OS_MEMBARRIER_H
+#   error "<cds/os/membarrier.h> must be included instead"
+#endif
+
+#include <cds/algo/atomic.h>
+
+#include <unistd.h>
+#include <sys/syscall.h>
+
+namespace cds { namespace OS {
+    CDS_CXX11_INLINE_NAMESPACE namespace Linux {
+
+        /// Process-wide memory barrier
+        /**
+            The wrapper around Linux \p membarrier(2) system call (kernel 4.14+).
+            \p barrier() issues a full memory barrier on each running thread of the process,
+            so the threads that are frequently executed may replace their full fences with compiler barriers
+            (so called asymmetric fences). If the system call is not supported,
+            \p init() returns \p false and the caller should use ordinary fences.
+        */
+        struct membarrier {
+            //@cond
+            enum {
+                cmd_query = 0,
+                cmd_private_expedited = 1 << 3,
+                cmd_register_private_expedited = 1 << 4
+            };
+            //@endcond
+
+            /// Registers the process for expedited barriers
+            /**
+                Returns \p true if \p barrier() is supported by the system
+            */
+            static bool init()
+            {
+#           ifdef __NR_membarrier
+                long nMask = syscall( __NR_membarrier, cmd_query, 0 );
+                if ( nMask < 0 || !( nMask & cmd_private_expedited ))
+                    return false;
+                return syscall( __NR_membarrier, cmd_register_private_expedited, 0 ) == 0;
+#           else
+                return false;
+#           endif
+            }
+
+            /// Issues full memory barrier on all running threads of the process
+            /**
+                Should be called only if \p init() returns \p true.
+                If the system call fails, the function issues full memory barrier for current thread only
+                and returns \p false; the caller should not rely on \p barrier() anymore.
+            */
+            static bool barrier()
+            {
+#           ifdef __NR_membarrier
+                if ( syscall( __NR_membarrier, cmd_private_expedited, 0 ) == 0 )
+                    return true;
+#           endif
+                atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+                return false;
+            }
+        };
+    }   // namespace Linux
+
+#ifndef CDS_CXX11_INLINE_NAMESPACE_SUPPORT
+    using Linux::membarrier;
+#endif
+}}  // namespace cds::OS
+
+#endif  // #ifndef CDSLIB_OS_LINUX_MEMBARRIER_H
@@ -49,11 +49,28 @@ namespace cds { namespace OS {
         /**
             The implementation assumes that processor IDs are in numerical order
             from 0 to N - 1, where N - count of processor in the system
+
+            NUMA node and core layout is read from \p /sys/devices/system when \p cds::Initialize() is called.
+            If \p /sys is not available, the system is considered as one NUMA node
+            where each processor is a separate core.
         */
         struct topology {
         private:
             //@cond
+            struct processor_map {
+                unsigned int    nNode;      // NUMA node
+                unsigned int    nCore;      // core id in the package
+                unsigned int    nPackage;   // physical package (socket) id
+            };
+
             static unsigned int     s_nProcessorCount;
+            static unsigned int     s_nNumaNodeCount;
+            static processor_map *  s_procMap;
+            static size_t           s_nProcMapSize;
+            static unsigned int *   s_arrOnlineNodes;       // ids of online NUMA nodes in ascending order
+            static unsigned int     s_nOnlineNodeCount;
+
+            static void make_processor_map();
             //@endcond
         public:
 
@@ -105,6 +122,93 @@ namespace cds { namespace OS {
                 return current_processor();
             }
 
+            /// NUMA node count for the system
+            /**
+                The nodes are numbered from 0 to <tt>numa_node_count() - 1</tt>.
+                The system without NUMA has one node.
+                The node ids can be sparse, so some ids in this range may not be online,
+                use \p numa_online_node() to enumerate the nodes available.
+            */
+            static unsigned int numa_node_count()
+            {
+                return s_nNumaNodeCount;
+            }
+
+            /// Returns NUMA node of processor \p nProcessor
+            static unsigned int numa_node( unsigned int nProcessor )
+            {
+                return nProcessor < s_nProcMapSize ? s_procMap[ nProcessor ].nNode : 0;
+            }
+
+            /// Returns NUMA node of the current processor
+            static unsigned int current_numa_node()
+            {
+                return numa_node( current_processor());
+            }
+
+            /// Returns the core id of processor \p nProcessor in its physical package
+            /**
+                The hyper-threads of one core have the same core id and package id.
+            */
+            static unsigned int core_id( unsigned int nProcessor )
+            {
+                return nProcessor < s_nProcMapSize ? s_procMap[ nProcessor ].nCore : nProcessor;
+            }
+
+            /// Returns physical package (socket) id of processor \p nProcessor
+            static unsigned int package_id( unsigned int nProcessor )
+            {
+                return nProcessor < s_nProcMapSize ? s_procMap[ nProcessor ].nPackage : 0;
+            }
+
+            /// Online NUMA node count
+            static unsigned int numa_online_node_count()
+            {
+                return s_nOnlineNodeCount;
+            }
+
+            /// Returns the id of \p nIndex-th online NUMA node, <tt>nIndex < numa_online_node_count()</tt>
+            /**
+                The ids are returned in ascending order.
+            */
+            static unsigned int numa_online_node( unsigned int nIndex )
+            {
+                return s_arrOnlineNodes && nIndex < s_nOnlineNodeCount ? s_arrOnlineNodes[ nIndex ] : 0;
+            }
+
+            /// Makes \p nNode the preferred node for the memory allocated by the current thread
+            /**
+                The function sets \p MPOL_PREFERRED memory policy of the current thread by \p set_mempolicy() system call,
+                so the pages touched first by the thread are allocated on \p nNode while it has free memory.
+                Note that the memory already owned by the process heap is reused regardless of the policy.
+                Returns \p false if the policy cannot be set, for example, the kernel is built without NUMA support.
+                Save the current policy by \p get_numa_memory_policy() before and restore it
+                by \p set_numa_memory_policy() after.
+            */
+            static bool set_numa_preferred_node( unsigned int nNode );
+
+            /// Max NUMA node id + 1 supported by the memory policy functions
+            static CDS_CONSTEXPR const unsigned int c_nMaxNumaNodeCount = 1024;
+
+            /// Memory policy of a thread, see \p get_numa_memory_policy()
+            struct numa_memory_policy {
+                //@cond
+                int             nMode;  // policy mode with mode flags
+                unsigned long   arrNodeMask[ c_nMaxNumaNodeCount / ( sizeof( unsigned long ) * 8 ) ];
+                //@endcond
+            };
+
+            /// Saves the memory policy of the current thread to \p policy
+            /**
+                The function calls \p get_mempolicy() system call, so the policy set by the application
+                or by \p numactl is saved as is.
+                Returns \p false if the policy cannot be read, for example, the kernel is built without NUMA support.
+            */
+            static bool get_numa_memory_policy( numa_memory_policy& policy );
+
+            /// Restores the memory policy of the current thread saved by \p get_numa_memory_policy()
+            static void set_numa_memory_policy( numa_memory_policy const& policy );
+
             //@cond
             static void init();
             static void fini();
@@ -0,0 +1,71 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#ifndef CDSLIB_OS_POSIX_FAKE_MEMBARRIER_H
+#define CDSLIB_OS_POSIX_FAKE_MEMBARRIER_H
+
+#ifndef CDSLIB_OS_MEMBARRIER_H
+#   error "<cds/os/membarrier.h> must be included instead"
+#endif
+
+#include <cds/algo/atomic.h>
+
+namespace cds { namespace OS {
+    CDS_CXX11_INLINE_NAMESPACE namespace posix {
+
+        /// Fake process-wide memory barrier
+        /**
+            Process-wide barrier is not supported: \p init() always returns \p false
+        */
+        struct membarrier {
+            /// Always returns \p false
+            static bool init()
+            {
+                return false;
+            }
+
+            /// Issues full memory barrier for current thread only
+            /**
+                Always returns \p false
+            */
+            static bool barrier()
+            {
+                atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+                return false;
+            }
+        };
+    }   // namespace posix
+
+#ifndef CDS_CXX11_INLINE_NAMESPACE_SUPPORT
+    using posix::membarrier;
+#endif
+}}  // namespace cds::OS
+
+#endif  // #ifndef CDSLIB_OS_POSIX_FAKE_MEMBARRIER_H
@@ -80,6 +80,93 @@ namespace cds { namespace OS {
                 return current_processor();
             }
 
+            /// NUMA node count for the system
+            static unsigned int numa_node_count()
+            {
+                ULONG nHighestNode;
+                if ( ::GetNumaHighestNodeNumber( &nHighestNode ))
+                    return static_cast<unsigned int>( nHighestNode ) + 1;
+                return 1;
+            }
+
+            /// Returns NUMA node of processor \p nProcessor
+            static unsigned int numa_node( unsigned int nProcessor )
+            {
+                UCHAR nNode;
+                if ( nProcessor < 256 && ::GetNumaProcessorNode( static_cast<UCHAR>( nProcessor ), &nNode ) && nNode != 0xFF )
+                    return nNode;
+                return 0;
+            }
+
+            /// Returns NUMA node of the current processor
+            static unsigned int current_numa_node()
+            {
+                return numa_node( current_processor());
+            }
+
+            /// Returns the core id of processor \p nProcessor. Each processor is considered as a separate core
+            static unsigned int core_id( unsigned int nProcessor )
+            {
+                return nProcessor;
+            }
+
+            /// Returns physical package id of processor \p nProcessor. Always returns 0
+            static unsigned int package_id( unsigned int /*nProcessor*/ )
+            {
+                return 0;
+            }
+
+            /// Online NUMA node count, i.e. the count of the nodes having processors
+            static unsigned int numa_online_node_count()
+            {
+                unsigned int nCount = 0;
+                for ( unsigned int nNode = 0; nNode < numa_node_count(); ++nNode ) {
+                    if ( is_online_node( nNode ))
+                        ++nCount;
+                }
+                return nCount ? nCount : 1;
+            }
+
+            /// Returns the id of \p nIndex-th online NUMA node, <tt>nIndex < numa_online_node_count()</tt>
+            static unsigned int numa_online_node( unsigned int nIndex )
+            {
+                for ( unsigned int nNode = 0; nNode < numa_node_count(); ++nNode ) {
+                    if ( is_online_node( nNode ) && nIndex-- == 0 )
+                        return nNode;
+                }
+                return 0;
+            }
+
+            /// Makes \p nNode the preferred node for the memory allocated by the current thread
+            /**
+                Windows has no per-thread memory policy, the function returns \p false.
+            */
+            static bool set_numa_preferred_node( unsigned int /*nNode*/ )
+            {
+                return false;
+            }
+
+            /// Memory policy of a thread, see \p get_numa_memory_policy(). Not supported
+            struct numa_memory_policy {};
+
+            /// Saves the memory policy of the current thread to \p policy. Not supported, returns \p false
+            static bool get_numa_memory_policy( numa_memory_policy& /*policy*/ )
+            {
+                return false;
+            }
+
+            /// Restores the memory policy saved by \p get_numa_memory_policy(). Does nothing
+            static void set_numa_memory_policy( numa_memory_policy const& /*policy*/ )
+            {}
+
+            //@cond
+            static bool is_online_node( unsigned int nNode )
+            {
+                ULONGLONG nMask;
+                return nNode < 256 && ::GetNumaNodeProcessorMask( static_cast<UCHAR>( nNode ), &nMask ) && nMask != 0;
+            }
+            //@endcond
+
             //@cond
             static void init()
             {}
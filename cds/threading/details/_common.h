@@ -33,6 +33,8 @@
 
 #include <cds/gc/impl/hp_decl.h>
 #include <cds/gc/impl/dhp_decl.h>
+#include <cds/gc/impl/he_decl.h>
+#include <cds/gc/impl/ebr_decl.h>
 
 #include <cds/urcu/details/gp_decl.h>
 #include <cds/urcu/details/sh_decl.h>
@@ -91,6 +93,9 @@ namespace cds {
             // Checks whether current thread is attached to \p libcds feature or not.
             static bool isThreadAttached();
 
+            // Returns ThreadData pointer for the current thread or \p nullptr if the thread is not attached
+            static ThreadData * attached_thread_data();
+
             // This method must be called in beginning of thread execution
             // (called by ctor of GC thread object, for example, by ctor of cds::gc::HP::thread_gc)
             static void attachThread();
@@ -104,6 +109,12 @@ namespace cds {
 
             // Get cds::gc::DHP thread GC implementation for current thread;
             static gc::DHP::thread_gc_impl&   getDHPGC();
+
+            // Get cds::gc::HE thread GC implementation for current thread;
+            static gc::HE::thread_gc_impl&   getHEGC();
+
+            // Get cds::gc::EBR thread GC implementation for current thread;
+            static gc::EBR::thread_gc_impl&   getEBRGC();
         };
         \endcode
 
@@ -139,6 +150,8 @@ namespace cds {
             //@cond
             char CDS_DATA_ALIGNMENT(8) m_hpManagerPlaceholder[sizeof(cds::gc::HP::thread_gc_impl)];   ///< Michael's Hazard Pointer GC placeholder
             char CDS_DATA_ALIGNMENT(8) m_dhpManagerPlaceholder[sizeof(cds::gc::DHP::thread_gc_impl)]; ///< Dynamic Hazard Pointer GC placeholder
+            char CDS_DATA_ALIGNMENT(8) m_heManagerPlaceholder[sizeof(cds::gc::HE::thread_gc_impl)];   ///< Hazard Eras GC placeholder
+            char CDS_DATA_ALIGNMENT(8) m_ebrManagerPlaceholder[sizeof(cds::gc::EBR::thread_gc_impl)]; ///< Epoch-based GC placeholder
 
             cds::urcu::details::thread_data< cds::urcu::general_instant_tag > *     m_pGPIRCU;
             cds::urcu::details::thread_data< cds::urcu::general_buffered_tag > *    m_pGPBRCU;
@@ -152,6 +165,8 @@ namespace cds {
 
             cds::gc::HP::thread_gc_impl  * m_hpManager     ;   ///< Michael's Hazard Pointer GC thread-specific data
             cds::gc::DHP::thread_gc_impl * m_dhpManager    ;   ///< Dynamic Hazard Pointer GC thread-specific data
+            cds::gc::HE::thread_gc_impl  * m_heManager     ;   ///< Hazard Eras GC thread-specific data
+            cds::gc::EBR::thread_gc_impl * m_ebrManager    ;   ///< Epoch-based GC thread-specific data
 
             size_t  m_nFakeProcessorNumber  ;   ///< fake "current processor" number
 
@@ -188,6 +203,16 @@ namespace cds {
                     m_dhpManager = new (m_dhpManagerPlaceholder) cds::gc::DHP::thread_gc_impl;
                 else
                     m_dhpManager = nullptr;
+
+                if ( cds::gc::HE::isUsed() )
+                    m_heManager = new (m_heManagerPlaceholder) cds::gc::HE::thread_gc_impl;
+                else
+                    m_heManager = nullptr;
+
+                if ( cds::gc::EBR::isUsed() )
+                    m_ebrManager = new (m_ebrManagerPlaceholder) cds::gc::EBR::thread_gc_impl;
+                else
+                    m_ebrManager = nullptr;
             }
 
             ~ThreadData()
@@ -204,6 +229,18 @@ namespace cds {
                     m_dhpManager = nullptr;
                 }
 
+                if ( m_heManager ) {
+                    typedef cds::gc::HE::thread_gc_impl he_thread_gc_impl;
+                    m_heManager->~he_thread_gc_impl();
+                    m_heManager = nullptr;
+                }
+
+                if ( m_ebrManager ) {
+                    typedef cds::gc::EBR::thread_gc_impl ebr_thread_gc_impl;
+                    m_ebrManager->~ebr_thread_gc_impl();
+                    m_ebrManager = nullptr;
+                }
+
                 assert( m_pGPIRCU == nullptr );
                 assert( m_pGPBRCU == nullptr );
                 assert( m_pGPTRCU == nullptr );
@@ -220,6 +257,10 @@ namespace cds {
                         m_hpManager->init();
                     if ( cds::gc::DHP::isUsed() )
                         m_dhpManager->init();
+                    if ( cds::gc::HE::isUsed() )
+                        m_heManager->init();
+                    if ( cds::gc::EBR::isUsed() )
+                        m_ebrManager->init();
 
                     if ( cds::urcu::details::singleton<cds::urcu::general_instant_tag>::isUsed() )
                         m_pGPIRCU = cds::urcu::details::singleton<cds::urcu::general_instant_tag>::attach_thread();
@@ -239,6 +280,10 @@ namespace cds {
             bool fini()
             {
                 if ( --m_nAttachCount == 0 ) {
+                    if ( cds::gc::EBR::isUsed() )
+                        m_ebrManager->fini();
+                    if ( cds::gc::HE::isUsed() )
+                        m_heManager->fini();
                     if ( cds::gc::DHP::isUsed() )
                         m_dhpManager->fini();
                     if ( cds::gc::HP::isUsed() )
@@ -115,6 +115,15 @@ namespace cds { namespace threading {
                     destroy_thread_data();
             }
 
+            /// Returns ThreadData pointer for the current thread or \p nullptr if the thread is not attached
+            /**
+                Unlike \p isThreadAttached() followed by \p thread_data(), the function reads TLS once.
+            */
+            static ThreadData * attached_thread_data()
+            {
+                return _threadData();
+            }
+
             /// Returns ThreadData pointer for the current thread
             static ThreadData * thread_data()
             {
@@ -147,6 +156,30 @@ namespace cds { namespace threading {
                 return *(_threadData()->m_dhpManager);
             }
 
+            /// Get gc::HE thread GC implementation for current thread
+            /**
+                The object returned may be uninitialized if you did not call attachThread in the beginning of thread execution
+                or if you did not use gc::HE.
+                To initialize gc::HE GC you must constuct cds::gc::HE object in the beginning of your application
+            */
+            static gc::HE::thread_gc_impl&   getHEGC()
+            {
+                assert( _threadData()->m_heManager != nullptr );
+                return *(_threadData()->m_heManager);
+            }
+
+            /// Get gc::EBR thread GC implementation for current thread
+            /**
+                The object returned may be uninitialized if you did not call attachThread in the beginning of thread execution
+                or if you did not use gc::EBR.
+                To initialize gc::EBR GC you must constuct cds::gc::EBR object in the beginning of your application
+            */
+            static gc::EBR::thread_gc_impl&   getEBRGC()
+            {
+                assert( _threadData()->m_ebrManager != nullptr );
+                return *(_threadData()->m_ebrManager);
+            }
+
             //@cond
             static size_t fake_current_processor()
             {
@@ -0,0 +1,352 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#ifndef CDSLIB_URCU_CALL_RCU_H
+#define CDSLIB_URCU_CALL_RCU_H
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <cds/urcu/details/base.h>
+#include <cds/algo/atomic.h>
+#include <cds/details/allocator.h>
+#include <cds/os/topology.h>
+#include <cds/threading/model.h>
+
+namespace cds { namespace urcu {
+
+    /// Asynchronous RCU callbacks
+    /**
+        @headerfile cds/urcu/call_rcu.h
+
+        The class implements \p call_rcu() facility: the writer places the retired object
+        with its disposer into the callback queue and returns immediately, without waiting for the grace period.
+        A dedicated worker thread collects the callbacks from all queues, waits for one grace period
+        for the whole batch by \p RCU::synchronize() and then invokes the callbacks.
+
+        The callback queues are per-CPU: the writer pushes its callback into the queue of the processor
+        it is running on (see \p cds::OS::topology::current_processor()). Each queue is a lock-free
+        stack aligned to the cache line, so the writers on different processors do not contend.
+        The worker takes each queue entirely by one atomic exchange.
+
+        Unlike the internal buffer of \p general_buffered, the callback queues are unbounded:
+        no writer is ever stalled by the grace period.
+
+        The worker wakes up when the number of pending callbacks in any queue reaches
+        <tt>nBatchSize / processor_count</tt> or when \p nPeriod milliseconds are elapsed.
+        The worker thread attaches itself to libcds infrastructure, so \p cds::Initialize()
+        must be called before the object of \p %call_rcu is created.
+
+        On construction the object attaches itself to the RCU singleton, so the RCU object must be created
+        before \p %call_rcu. While attached, the \p retire_ptr() of the RCU (and so the retiring
+        of every RCU-based container) places the retired pointer into the callback queue instead of
+        the internal buffer or the inline \p synchronize() call. Only one \p %call_rcu object can be attached
+        to the RCU at a time, see \p is_attached().
+
+        The object of \p %call_rcu must be destroyed before the RCU singleton.
+        The destructor detaches the object from RCU, stops the worker and invokes all pending callbacks,
+        so it must not be called inside RCU read-side critical section.
+
+        Template arguments:
+        - \p RCU - one of \ref cds_urcu_gc "RCU type": <tt>cds::urcu::gc< cds::urcu::general_buffered<> ></tt> and so on
+        - \p Allocator - allocator for internal callback nodes, default is \ref CDS_DEFAULT_ALLOCATOR
+
+        Example:
+        \code
+        typedef cds::urcu::gc< cds::urcu::general_buffered<> > rcu_type;
+
+        rcu_type theRCU;
+        cds::urcu::call_rcu< rcu_type > callRCU;
+
+        // ...
+        // foo has been excluded from all shared data structures
+        callRCU.call( foo, []( Foo * p ) { delete p; } );
+        \endcode
+    */
+    template <class RCU, class Allocator = CDS_DEFAULT_ALLOCATOR >
+    class call_rcu: protected details::deferred_reclaimer
+    {
+    public:
+        typedef RCU         gc;         ///< RCU type
+        typedef Allocator   allocator;  ///< Allocator type
+
+        static CDS_CONSTEXPR const size_t       c_nDefaultBatchSize = 256;  ///< Default batch size
+        static CDS_CONSTEXPR const unsigned int c_nDefaultPeriod = 10;      ///< Default worker period, milliseconds
+
+    private:
+        //@cond
+        struct callback_node
+        {
+            callback_node * m_pNext;
+            retired_ptr     m_rp;
+        };
+        typedef cds::details::Allocator< callback_node, allocator > node_allocator;
+
+        struct callback_queue
+        {
+            char                                pad1_[cds::c_nCacheLineSize];
+            atomics::atomic<callback_node *>    m_pHead;
+            atomics::atomic<size_t>             m_nSize;
+            char                                pad2_[cds::c_nCacheLineSize - sizeof( atomics::atomic<callback_node *> ) - sizeof( atomics::atomic<size_t> )];
+
+            callback_queue()
+                : m_pHead( nullptr )
+                , m_nSize( 0 )
+            {}
+        };
+        typedef cds::details::Allocator< callback_queue, allocator > queue_allocator;
+        //@endcond
+
+    private:
+        //@cond
+        size_t const                m_nQueueCount;
+        callback_queue * const      m_arrQueue;
+        size_t const                m_nQueueThreshold;
+        std::chrono::milliseconds   m_Period;
+
+        std::mutex                  m_Mutex;        // protects m_bWorkReady, m_bQuit
+        std::condition_variable     m_cvWork;
+        bool                        m_bWorkReady;
+        bool                        m_bQuit;
+
+        std::mutex                  m_ProcessLock;  // serializes batch processing between the worker and barrier()
+
+        atomics::atomic<size_t>     m_nGracePeriodCount;
+        atomics::atomic<size_t>     m_nInvokedCount;
+
+        std::thread                 m_Worker;
+        bool const                  m_bAttached;
+        //@endcond
+
+    public:
+        /// Creates the callback queues and starts the worker thread
+        /**
+            \p nBatchSize - total count of pending callbacks that wakes the worker up.
+            \p nPeriod - the worker period in milliseconds: the pending callbacks are invoked
+            not later than after \p nPeriod ms plus the grace period.
+        */
+        call_rcu( size_t nBatchSize = c_nDefaultBatchSize, unsigned int nPeriod = c_nDefaultPeriod )
+            : m_nQueueCount( cds::OS::topology::processor_count() ? cds::OS::topology::processor_count() : 1 )
+            , m_arrQueue( queue_allocator().NewArray( m_nQueueCount ))
+            , m_nQueueThreshold( nBatchSize / m_nQueueCount ? nBatchSize / m_nQueueCount : 1 )
+            , m_Period( nPeriod ? nPeriod : 1 )
+            , m_bWorkReady( false )
+            , m_bQuit( false )
+            , m_nGracePeriodCount( 0 )
+            , m_nInvokedCount( 0 )
+            , m_bAttached( gc::rcu_implementation::instance()->attach_reclaimer( this ))
+        {
+            m_Worker = std::thread( [this] { execute(); } );
+        }
+
+        /// Stops the worker thread and invokes all pending callbacks
+        ~call_rcu()
+        {
+            if ( m_bAttached ) {
+                assert( !gc::is_locked());
+                gc::rcu_implementation::instance()->detach_reclaimer( this );
+                // retire_ptr() uses the object inside read-side critical section
+                gc::synchronize();
+            }
+
+            {
+                std::unique_lock<std::mutex> lock( m_Mutex );
+                m_bQuit = true;
+            }
+            m_cvWork.notify_one();
+            m_Worker.join();
+
+            process();
+            queue_allocator().Delete( m_arrQueue, m_nQueueCount );
+        }
+
+        //@cond
+        call_rcu( call_rcu const& ) = delete;
+        call_rcu& operator=( call_rcu const& ) = delete;
+        //@endcond
+
+    public:
+        /// Places retired pointer \p p into the callback queue of current processor
+        /**
+            The function never waits for the grace period.
+            The disposer of \p p is called by the worker thread after the grace period is elapsed.
+        */
+        virtual void call( retired_ptr const& p )
+        {
+            if ( !p.m_p )
+                return;
+
+            callback_node * pNode = node_allocator().New();
+            pNode->m_rp = p;
+
+            callback_queue& q = m_arrQueue[ cds::OS::topology::current_processor() % m_nQueueCount ];
+            callback_node * pHead = q.m_pHead.load( atomics::memory_order_relaxed );
+            do {
+                pNode->m_pNext = pHead;
+            } while ( !q.m_pHead.compare_exchange_weak( pHead, pNode, atomics::memory_order_release, atomics::memory_order_relaxed ));
+
+            // m_nSize changes by one step, so exactly one callback reaches the threshold
+            // and wakes the worker up; the callbacks above it do not take m_Mutex.
+            // The worker may drain pNode before the increment, then m_nSize wraps around
+            // for a moment and the increment restores it
+            if ( q.m_nSize.fetch_add( 1, atomics::memory_order_relaxed ) + 1 == m_nQueueThreshold )
+                wake_worker();
+        }
+
+        /// Places pointer \p p with disposer \p pFunc into the callback queue
+        template <typename T>
+        void call( T * p, void (* pFunc)(T *) )
+        {
+            retired_ptr rp( reinterpret_cast<void *>( p ), reinterpret_cast<free_retired_ptr_func>( pFunc ));
+            call( rp );
+        }
+
+        /// Places pointer \p p with \p Disposer into the callback queue
+        template <typename Disposer, typename T>
+        void call( T * p )
+        {
+            call( p, cds::details::static_functor<Disposer, T>::call );
+        }
+
+        /// Invokes all callbacks queued before the call
+        /**
+            The function waits for the grace period in the caller thread,
+            so it must not be called inside RCU read-side critical section.
+            The caller thread must be attached to libcds infrastructure.
+        */
+        void barrier()
+        {
+            assert( !gc::is_locked());
+            process();
+        }
+
+        /// Checks if the object is attached to the RCU and receives all pointers retired by \p RCU::retire_ptr()
+        bool is_attached() const
+        {
+            return m_bAttached;
+        }
+
+        /// Returns the number of callback queues (processor count)
+        size_t queue_count() const
+        {
+            return m_nQueueCount;
+        }
+
+        /// Returns the number of grace periods waited by the object
+        size_t grace_period_count() const
+        {
+            return m_nGracePeriodCount.load( atomics::memory_order_relaxed );
+        }
+
+        /// Returns the number of callbacks invoked
+        size_t invoked_count() const
+        {
+            return m_nInvokedCount.load( atomics::memory_order_relaxed );
+        }
+
+    private:
+        //@cond
+        void wake_worker()
+        {
+            {
+                std::unique_lock<std::mutex> lock( m_Mutex );
+                m_bWorkReady = true;
+            }
+            m_cvWork.notify_one();
+        }
+
+        void execute()
+        {
+            // The worker waits for grace periods, so it must be attached to libcds infrastructure
+            cds::threading::Manager::attachThread();
+            {
+                std::unique_lock<std::mutex> lock( m_Mutex );
+                while ( !m_bQuit ) {
+                    m_cvWork.wait_for( lock, m_Period, [this] { return m_bWorkReady || m_bQuit; } );
+                    m_bWorkReady = false;
+
+                    lock.unlock();
+                    process();
+                    lock.lock();
+                }
+            }
+            cds::threading::Manager::detachThread();
+        }
+
+        void process()
+        {
+            std::unique_lock<std::mutex> pl( m_ProcessLock );
+
+            // Collect the callbacks from all queues
+            callback_node * pBatch = nullptr;
+            for ( size_t i = 0; i < m_nQueueCount; ++i ) {
+                callback_queue& q = m_arrQueue[i];
+                if ( !q.m_pHead.load( atomics::memory_order_relaxed ))
+                    continue;
+
+                callback_node * p = q.m_pHead.exchange( nullptr, atomics::memory_order_acquire );
+                size_t nDrained = 0;
+                while ( p ) {
+                    callback_node * pNext = p->m_pNext;
+                    p->m_pNext = pBatch;
+                    pBatch = p;
+                    p = pNext;
+                    ++nDrained;
+                }
+
+                // The callbacks pushed after the exchange stay counted
+                q.m_nSize.fetch_sub( nDrained, atomics::memory_order_relaxed );
+            }
+
+            if ( !pBatch )
+                return;
+
+            // One grace period for the whole batch
+            gc::synchronize();
+            m_nGracePeriodCount.fetch_add( 1, atomics::memory_order_relaxed );
+
+            size_t nCount = 0;
+            node_allocator al;
+            while ( pBatch ) {
+                callback_node * pNext = pBatch->m_pNext;
+                pBatch->m_rp.free();
+                al.Delete( pBatch );
+                pBatch = pNext;
+                ++nCount;
+            }
+            m_nInvokedCount.fetch_add( nCount, atomics::memory_order_relaxed );
+        }
+        //@endcond
+    };
+
+}} // namespace cds::urcu
+
+#endif // #ifndef CDSLIB_URCU_CALL_RCU_H
@@ -302,12 +302,56 @@ namespace cds {
             class singleton;
 
             //@cond
+            // Asynchronous reclaimer (cds::urcu::call_rcu) that takes over retire_ptr() of the RCU singleton
+            class deferred_reclaimer {
+            protected:
+                virtual ~deferred_reclaimer()
+                {}
+            public:
+                virtual void call( retired_ptr const& p ) = 0;
+            };
+
             class singleton_vtbl {
             protected:
+                atomics::atomic<deferred_reclaimer *> m_pReclaimer;
+
+                singleton_vtbl()
+                    : m_pReclaimer( nullptr )
+                {}
                 virtual ~singleton_vtbl()
                 {}
+
+                // Passes p to the attached reclaimer; returns false if no reclaimer is attached.
+                // The reclaimer is used inside read-side critical section,
+                // so detach_reclaimer() followed by synchronize() waits for all its users
+                template <class ThreadGC>
+                bool defer_retire( retired_ptr& p )
+                {
+                    if ( !m_pReclaimer.load( atomics::memory_order_relaxed ))
+                        return false;
+
+                    typename ThreadGC::scoped_lock sl;
+                    deferred_reclaimer * pReclaimer = m_pReclaimer.load( atomics::memory_order_acquire );
+                    if ( !pReclaimer )
+                        return false;
+                    pReclaimer->call( p );
+                    return true;
+                }
+
             public:
                 virtual void retire_ptr( retired_ptr& p ) = 0;
+
+                // Only one reclaimer can be attached at a time
+                bool attach_reclaimer( deferred_reclaimer * pReclaimer )
+                {
+                    deferred_reclaimer * pExpected = nullptr;
+                    return m_pReclaimer.compare_exchange_strong( pExpected, pReclaimer, atomics::memory_order_release, atomics::memory_order_relaxed );
+                }
+
+                void detach_reclaimer( deferred_reclaimer * pReclaimer )
+                {
+                    m_pReclaimer.compare_exchange_strong( pReclaimer, nullptr, atomics::memory_order_release, atomics::memory_order_relaxed );
+                }
             };
 
             class gc_common
@@ -446,6 +490,177 @@ namespace cds {
                 }
             };
             //@endcond
+
+            /// Batch read-side lock
+            /**
+                The batch lock enters RCU read-side critical section once and keeps it
+                for a sequence of lookups. The RCU-based containers have the lookup functions
+                accepting \p %batch_lock; such functions do not lock RCU on each call.
+                Thus, a scan of 1M lookups costs one lock/unlock pair instead of 1M.
+
+                Holding the read-side lock for a long time blocks the writers waiting
+                in \p synchronize(). To prevent it, the container calls \p step()
+                before each lookup; every \p nYieldPeriod steps the batch lock checks
+                whether a grace period is pending and, if so, leaves the critical section
+                for a moment to let \p synchronize() go on.
+                So, a pointer obtained inside the batch is valid only until the next lookup
+                through the same batch lock.
+
+                A lookup may unlink logically deleted nodes on its way; such nodes cannot be
+                retired inside the read-side critical section. The container passes them
+                to \p defer(), and the batch lock disposes them after leaving the critical section:
+                on \p yield(), in the destructor, or when the deferred buffer is full.
+
+                The yield is effective only if the batch lock is the outermost RCU lock of the thread.
+
+                Example:
+                \code
+                typedef cds::urcu::gc< cds::urcu::signal_buffered<> > rcu;
+                typedef cds::container::SkipListSet< rcu, int > set_type;
+                set_type theSet;
+                // ...
+                size_t nFound = 0;
+                {
+                    set_type::rcu_batch_lock bl;
+                    for ( int key : keys ) {
+                        if ( theSet.contains( bl, key ))
+                            ++nFound;
+                    }
+                }
+                \endcode
+            */
+            template <class ThreadGC>
+            class batch_lock {
+            public:
+                typedef ThreadGC                    thread_gc;  ///< Thread-side RCU part
+                typedef typename thread_gc::rcu_tag rcu_tag;    ///< RCU tag
+
+                static CDS_CONSTEXPR const size_t c_nDefaultYieldPeriod = 64; ///< Default yield period
+                static CDS_CONSTEXPR const size_t c_nDeferredCapacity = 16;    ///< Max number of deferred chains
+
+                /// Disposer of deferred chain, called outside of RCU critical section
+                typedef void (* deferred_disposer)( void * pChain );
+
+            private:
+                //@cond
+                struct deferred_chain {
+                    void *              pChain;
+                    deferred_disposer   func;
+                };
+
+                size_t const    m_nYieldPeriod;
+                size_t          m_nCounter;
+                size_t          m_nDeferred;
+                deferred_chain  m_arrDeferred[c_nDeferredCapacity];
+                //@endcond
+
+            public:
+                /// Enters RCU read-side critical section
+                /**
+                    \p nYieldPeriod - how many \p step() calls are between the checks for pending grace period.
+                */
+                explicit batch_lock( size_t nYieldPeriod = c_nDefaultYieldPeriod )
+                    : m_nYieldPeriod( nYieldPeriod ? nYieldPeriod : 1 )
+                    , m_nCounter( 0 )
+                    , m_nDeferred( 0 )
+                {
+                    thread_gc::access_lock();
+                }
+
+                /// Leaves RCU read-side critical section and disposes deferred chains
+                ~batch_lock()
+                {
+                    thread_gc::access_unlock();
+                    dispose_deferred();
+                }
+
+                //@cond
+                batch_lock( batch_lock const& ) = delete;
+                batch_lock& operator=( batch_lock const& ) = delete;
+                //@endcond
+
+                /// Counts an operation inside the batch
+                /**
+                    Every \p nYieldPeriod calls the function checks for pending grace period
+                    and yields if needed. Returns \p true if the critical section has been reentered,
+                    i.e. all pointers obtained before are invalid.
+                */
+                bool step()
+                {
+                    if ( ++m_nCounter < m_nYieldPeriod )
+                        return false;
+                    m_nCounter = 0;
+                    return yield_if_pending();
+                }
+
+                /// Yields if a grace period is pending
+                /**
+                    Returns \p true if the critical section has been reentered.
+                */
+                bool yield_if_pending()
+                {
+                    if ( thread_gc::is_grace_period_pending() ) {
+                        yield();
+                        return true;
+                    }
+                    return false;
+                }
+
+                /// Leaves and reenters RCU read-side critical section unconditionally
+                /**
+                    The deferred chains are disposed while the critical section is left.
+                */
+                void yield()
+                {
+                    thread_gc::access_unlock();
+                    dispose_deferred();
+                    thread_gc::access_lock();
+                }
+
+                /// Defers disposing of \p pChain until the critical section is left
+                /**
+                    \p func is called for \p pChain outside of RCU read-side critical section.
+                    If the deferred buffer is full, the function yields, see \p yield().
+                    Returns \p true if the critical section has been reentered.
+                */
+                bool defer( void * pChain, deferred_disposer func )
+                {
+                    assert( func != nullptr );
+                    if ( !pChain )
+                        return false;
+
+                    if ( m_nDeferred < c_nDeferredCapacity ) {
+                        m_arrDeferred[m_nDeferred].pChain = pChain;
+                        m_arrDeferred[m_nDeferred].func = func;
+                        ++m_nDeferred;
+                        return false;
+                    }
+
+                    thread_gc::access_unlock();
+                    dispose_deferred();
+                    func( pChain );
+                    thread_gc::access_lock();
+                    return true;
+                }
+
+                /// Returns the yield period
+                size_t yield_period() const
+                {
+                    return m_nYieldPeriod;
+                }
+
+            private:
+                //@cond
+                void dispose_deferred()
+                {
+                    // A disposer may not reenter this batch lock, so the buffer is emptied first
+                    size_t const nCount = m_nDeferred;
+                    m_nDeferred = 0;
+                    for ( size_t i = 0; i < nCount; ++i )
+                        m_arrDeferred[i].func( m_arrDeferred[i].pChain );
+                }
+                //@endcond
+            };
         } // namespace details
         //@endcond
 
@@ -67,13 +67,21 @@ namespace cds { namespace urcu { namespace details {
 
         uint32_t tmp = pRec->m_nAccessControl.load( atomics::memory_order_relaxed );
         if ( (tmp & rcu_class::c_nNestMask) == 0 ) {
-            pRec->m_nAccessControl.store( gp_singleton<RCUtag>::instance()->global_control_word(atomics::memory_order_relaxed),
-                atomics::memory_order_release );
-            atomics::atomic_thread_fence( atomics::memory_order_acquire );
-            CDS_COMPILER_RW_BARRIER;
+            gp_singleton<RCUtag> * pRCU = gp_singleton<RCUtag>::instance();
+            if ( pRCU->asymmetric_fence() ) {
+                // Expedited mode: the writer issues membarrier() instead of our fence
+                pRec->m_nAccessControl.store( pRCU->global_control_word( atomics::memory_order_relaxed ), atomics::memory_order_relaxed );
+                CDS_COMPILER_RW_BARRIER;
+            }
+            else {
+                pRec->m_nAccessControl.store( pRCU->global_control_word( atomics::memory_order_relaxed ), atomics::memory_order_release );
+                atomics::atomic_thread_fence( atomics::memory_order_acquire );
+                CDS_COMPILER_RW_BARRIER;
+            }
         }
         else {
-            pRec->m_nAccessControl.fetch_add( 1, atomics::memory_order_relaxed );
+            // Only the owner thread changes m_nAccessControl
+            pRec->m_nAccessControl.store( tmp + 1, atomics::memory_order_relaxed );
         }
     }
 
@@ -84,7 +92,7 @@ namespace cds { namespace urcu { namespace details {
         assert( pRec != nullptr );
 
         CDS_COMPILER_RW_BARRIER;
-        pRec->m_nAccessControl.fetch_sub( 1, atomics::memory_order_release );
+        pRec->m_nAccessControl.store( pRec->m_nAccessControl.load( atomics::memory_order_relaxed ) - 1, atomics::memory_order_release );
     }
 
     template <typename RCUtag>
@@ -96,6 +104,18 @@ namespace cds { namespace urcu { namespace details {
         return (pRec->m_nAccessControl.load( atomics::memory_order_relaxed ) & rcu_class::c_nNestMask) != 0;
     }
 
+    template <typename RCUtag>
+    inline bool gp_thread_gc<RCUtag>::is_grace_period_pending()
+    {
+        thread_record * pRec = get_thread_record();
+        assert( pRec != nullptr );
+
+        // The writer waits for us if we are inside the critical section entered in the previous phase
+        uint32_t const v = pRec->m_nAccessControl.load( atomics::memory_order_relaxed );
+        return (v & rcu_class::c_nNestMask)
+            && ((v ^ gp_singleton<RCUtag>::instance()->global_control_word( atomics::memory_order_relaxed )) & ~rcu_class::c_nNestMask );
+    }
+
 
     // gp_singleton
     template <typename RCUtag>
@@ -106,6 +126,22 @@ namespace cds { namespace urcu { namespace details {
             && (( v ^ m_nGlobalControl.load( atomics::memory_order_relaxed )) & ~general_purpose_rcu::c_nNestMask );
     }
 
+    template <typename RCUtag>
+    template <class Backoff>
+    inline void gp_singleton<RCUtag>::wait_for_readers( Backoff& bkoff )
+    {
+        // The grace period covers only the readers that are fenced either by membarrier() or by themselves.
+        // If membarrier() fails, the readers are switched to full fences and the grace period is restarted
+        for (;;) {
+            if ( master_fence()) {
+                flip_and_wait( bkoff );
+                flip_and_wait( bkoff );
+                if ( master_fence())
+                    return;
+            }
+        }
+    }
+
     template <typename RCUtag>
     template <class Backoff>
     inline void gp_singleton<RCUtag>::flip_and_wait( Backoff& bkoff )
@@ -34,6 +34,8 @@
 #include <cds/urcu/details/base.h>
 #include <cds/details/static_functor.h>
 #include <cds/details/lib.h>
+#include <cds/os/membarrier.h>
+#include <cds/gc/telemetry.h>
 
 //@cond
 namespace cds { namespace urcu { namespace details {
@@ -74,6 +76,7 @@ namespace cds { namespace urcu { namespace details {
         typedef typename rcu_tag::rcu_class rcu_class;
         typedef thread_data< rcu_tag >      thread_record;
         typedef cds::urcu::details::scoped_lock< gp_thread_gc > scoped_lock;
+        typedef cds::urcu::details::batch_lock< gp_thread_gc > batch_lock;
 
     protected:
         static thread_record * get_thread_record();
@@ -85,6 +88,7 @@ namespace cds { namespace urcu { namespace details {
         static void access_lock();
         static void access_unlock();
         static bool is_locked();
+        static bool is_grace_period_pending();
 
         /// Retire pointer \p by the disposer \p Disposer
         template <typename Disposer, typename T>
@@ -130,11 +134,15 @@ namespace cds { namespace urcu { namespace details {
 
     protected:
         atomics::atomic<uint32_t>    m_nGlobalControl;
+        atomics::atomic<bool>        m_bAsymmetricFence; // readers use compiler barrier, the writer uses membarrier
         thread_list< rcu_tag >          m_ThreadList;
+        cds::gc::telemetry::gc_collector m_Telemetry;
 
     protected:
-        gp_singleton()
+        gp_singleton( bool bExpedited = false )
             : m_nGlobalControl(1)
+            // membarrier() is probed before any reader can use the asymmetric path
+            , m_bAsymmetricFence( bExpedited && cds::OS::membarrier::init() && cds::OS::membarrier::barrier())
         {}
 
         ~gp_singleton()
@@ -170,9 +178,31 @@ namespace cds { namespace urcu { namespace details {
             return m_nGlobalControl.load( mo );
         }
 
+        bool asymmetric_fence() const
+        {
+            return m_bAsymmetricFence.load( atomics::memory_order_acquire );
+        }
+
     protected:
         bool check_grace_period( thread_record * pRec ) const;
 
+        // In expedited mode forces full memory barrier on all reader threads.
+        // If membarrier() fails, the readers are switched back to full fences and false is returned:
+        // the readers that have entered the read-side section without a fence are not fenced,
+        // so the caller must restart the grace period
+        bool master_fence()
+        {
+            if ( m_bAsymmetricFence.load( atomics::memory_order_relaxed ) && !cds::OS::membarrier::barrier() ) {
+                m_bAsymmetricFence.store( false, atomics::memory_order_seq_cst );
+                atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+                return false;
+            }
+            return true;
+        }
+
+        template <class Backoff>
+        void wait_for_readers( Backoff& bkoff );
+
         template <class Backoff>
         void flip_and_wait( Backoff& bkoff );
     };
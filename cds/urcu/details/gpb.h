@@ -85,6 +85,7 @@ namespace cds { namespace urcu {
 
         typedef base_class::thread_gc thread_gc ;   ///< Thread-side RCU part
         typedef typename thread_gc::scoped_lock scoped_lock ; ///< Access lock class
+        typedef typename thread_gc::batch_lock  batch_lock ;  ///< Batch access lock class
 
         static bool const c_bBuffered = true ; ///< This RCU buffers disposed elements
 
@@ -115,8 +116,9 @@ namespace cds { namespace urcu {
 
     protected:
         //@cond
-        general_buffered( size_t nBufferCapacity )
-            : m_Buffer( nBufferCapacity )
+        general_buffered( size_t nBufferCapacity, bool bExpedited )
+            : base_class( bExpedited )
+            , m_Buffer( nBufferCapacity )
             , m_nCurEpoch(0)
             , m_nCapacity( nBufferCapacity )
         {}
@@ -126,24 +128,27 @@ namespace cds { namespace urcu {
             clear_buffer( std::numeric_limits< uint64_t >::max());
         }
 
-        void flip_and_wait()
+        void wait_for_readers()
         {
             back_off bkoff;
-            base_class::flip_and_wait( bkoff );
+            base_class::wait_for_readers( bkoff );
         }
 
         void clear_buffer( uint64_t nEpoch )
         {
             epoch_retired_ptr p;
+            size_t nCount = 0;
             while ( m_Buffer.pop( p )) {
                 if ( p.m_nEpoch <= nEpoch ) {
                     p.free();
+                    ++nCount;
                 }
                 else {
                     push_buffer( std::move(p) );
                     break;
                 }
             }
+            base_class::m_Telemetry.on_free( nCount );
         }
 
         // Return: true - synchronize has been called, false - otherwise
@@ -154,6 +159,7 @@ namespace cds { namespace urcu {
                 synchronize();
                 if ( !bPushed ) {
                     ep.free();
+                    base_class::m_Telemetry.on_free( 1 );
                 }
                 return true;
             }
@@ -165,11 +171,15 @@ namespace cds { namespace urcu {
         /// Creates singleton object
         /**
             The \p nBufferCapacity parameter defines RCU threshold.
+
+            If \p bExpedited is \p true and the system supports process-wide memory barrier
+            (\p membarrier(2) on Linux, \p FlushProcessWriteBuffers() on Windows), the RCU works in expedited mode:
+            the readers do not issue memory fences, instead \p synchronize() forces the barrier on all reader threads.
         */
-        static void Construct( size_t nBufferCapacity = 256 )
+        static void Construct( size_t nBufferCapacity = 256, bool bExpedited = false )
         {
             if ( !singleton_ptr::s_pRCU )
-                singleton_ptr::s_pRCU = new general_buffered( nBufferCapacity );
+                singleton_ptr::s_pRCU = new general_buffered( nBufferCapacity, bExpedited );
         }
 
         /// Destroys singleton object
@@ -190,10 +200,12 @@ namespace cds { namespace urcu {
             The method pushes \p p pointer to internal buffer.
             When the buffer becomes full \ref synchronize function is called
             to wait for the end of grace period and then to free all pointers from the buffer.
+
+            If \p call_rcu object is attached to the RCU, \p p is passed to its callback queue instead.
         */
         virtual void retire_ptr( retired_ptr& p )
         {
-            if ( p.m_p )
+            if ( p.m_p && !base_class::template defer_retire< thread_gc >( p ))
                 push_buffer( epoch_retired_ptr( p, m_nCurEpoch.load( atomics::memory_order_relaxed )));
         }
 
@@ -234,12 +246,13 @@ namespace cds { namespace urcu {
             uint64_t nEpoch;
             atomics::atomic_thread_fence( atomics::memory_order_acquire );
             {
+                cds::gc::telemetry::gc_collector::stopwatch sw;
                 std::unique_lock<lock_type> sl( m_Lock );
                 if ( ep.m_p && m_Buffer.push( ep ) )
                     return false;
                 nEpoch = m_nCurEpoch.fetch_add( 1, atomics::memory_order_relaxed );
-                flip_and_wait();
-                flip_and_wait();
+                wait_for_readers();
+                base_class::m_Telemetry.on_grace_period( sw.elapsed());
             }
             clear_buffer( nEpoch );
             atomics::atomic_thread_fence( atomics::memory_order_release );
@@ -252,6 +265,21 @@ namespace cds { namespace urcu {
         {
             return m_nCapacity;
         }
+
+        /// Checks if the RCU works in expedited mode
+        bool is_expedited() const
+        {
+            return base_class::asymmetric_fence();
+        }
+
+        /// Returns reclamation telemetry, see \ref cds_gc_telemetry "cds::gc::telemetry"
+        cds::gc::telemetry::snapshot& get_telemetry( cds::gc::telemetry::snapshot& s ) const
+        {
+            s.clear();
+            base_class::m_Telemetry.get( s );
+            s.nRetiredBacklog = m_Buffer.size();
+            return s;
+        }
     };
 
 }} // namespace cds::urcu
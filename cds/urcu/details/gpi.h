@@ -71,6 +71,7 @@ namespace cds { namespace urcu {
 
         typedef typename base_class::thread_gc  thread_gc ;   ///< Thread-side RCU part
         typedef typename thread_gc::scoped_lock scoped_lock ; ///< Access lock class
+        typedef typename thread_gc::batch_lock  batch_lock ;  ///< Batch access lock class
 
         static bool const c_bBuffered = false ; ///< This RCU does not buffer disposed elements
 
@@ -99,24 +100,30 @@ namespace cds { namespace urcu {
 
     protected:
         //@cond
-        general_instant()
+        general_instant( bool bExpedited )
+            : base_class( bExpedited )
         {}
         ~general_instant()
         {}
 
-        void flip_and_wait()
+        void wait_for_readers()
         {
             back_off bkoff;
-            base_class::flip_and_wait( bkoff );
+            base_class::wait_for_readers( bkoff );
         }
         //@endcond
 
     public:
         /// Creates singleton object
-        static void Construct()
+        /**
+            If \p bExpedited is \p true and the system supports process-wide memory barrier
+            (\p membarrier(2) on Linux, \p FlushProcessWriteBuffers() on Windows), the RCU works in expedited mode:
+            the readers do not issue memory fences, instead \p synchronize() forces the barrier on all reader threads.
+        */
+        static void Construct( bool bExpedited = false )
         {
             if ( !singleton_ptr::s_pRCU )
-                singleton_ptr::s_pRCU = new general_instant();
+                singleton_ptr::s_pRCU = new general_instant( bExpedited );
         }
 
         /// Destroys singleton object
@@ -135,12 +142,19 @@ namespace cds { namespace urcu {
         /**
             The method calls \p synchronize() to wait for the end of grace period
             and calls \p p disposer.
+
+            If \p call_rcu object is attached to the RCU, \p p is passed to its callback queue instead.
         */
         virtual void retire_ptr( retired_ptr& p )
         {
+            if ( p.m_p && base_class::template defer_retire< thread_gc >( p ))
+                return;
+
             synchronize();
-            if ( p.m_p )
+            if ( p.m_p ) {
                 p.free();
+                base_class::m_Telemetry.on_free( 1 );
+            }
         }
 
         /// Retires the pointer chain [\p itFirst, \p itLast)
@@ -149,12 +163,16 @@ namespace cds { namespace urcu {
         {
             if ( itFirst != itLast ) {
                 synchronize();
+                size_t nCount = 0;
                 while ( itFirst != itLast ) {
                     retired_ptr p( *itFirst );
                     ++itFirst;
-                    if ( p.m_p )
+                    if ( p.m_p ) {
                         p.free();
+                        ++nCount;
+                    }
                 }
+                base_class::m_Telemetry.on_free( nCount );
             }
         }
 
@@ -165,11 +183,14 @@ namespace cds { namespace urcu {
             retired_ptr p{ e() };
             if ( p.m_p ) {
                 synchronize();
+                size_t nCount = 0;
                 while ( p.m_p ) {
                     retired_ptr pr( p );
                     p = e();
                     pr.free();
+                    ++nCount;
                 }
+                base_class::m_Telemetry.on_free( nCount );
             }
         }
 
@@ -177,9 +198,24 @@ namespace cds { namespace urcu {
         void synchronize()
         {
             assert( !thread_gc::is_locked());
+            cds::gc::telemetry::gc_collector::stopwatch sw;
             std::unique_lock<lock_type> sl( m_Lock );
-            flip_and_wait();
-            flip_and_wait();
+            wait_for_readers();
+            base_class::m_Telemetry.on_grace_period( sw.elapsed());
+        }
+
+        /// Checks if the RCU works in expedited mode
+        bool is_expedited() const
+        {
+            return base_class::asymmetric_fence();
+        }
+
+        /// Returns reclamation telemetry, see \ref cds_gc_telemetry "cds::gc::telemetry"
+        cds::gc::telemetry::snapshot& get_telemetry( cds::gc::telemetry::snapshot& s ) const
+        {
+            s.clear();
+            base_class::m_Telemetry.get( s );
+            return s;
         }
 
         //@cond
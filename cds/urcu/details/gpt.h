@@ -98,6 +98,7 @@ namespace cds { namespace urcu {
         typedef general_threaded_tag    rcu_tag ;       ///< Thread-side RCU part
         typedef base_class::thread_gc   thread_gc ;     ///< Access lock class
         typedef typename thread_gc::scoped_lock scoped_lock ; ///< Access lock class
+        typedef typename thread_gc::batch_lock  batch_lock ;  ///< Batch access lock class
 
         static bool const c_bBuffered = true ; ///< This RCU buffers disposed elements
 
@@ -136,16 +137,17 @@ namespace cds { namespace urcu {
 
     protected:
         //@cond
-        general_threaded( size_t nBufferCapacity )
-            : m_Buffer( nBufferCapacity )
+        general_threaded( size_t nBufferCapacity, bool bExpedited )
+            : base_class( bExpedited )
+            , m_Buffer( nBufferCapacity )
             , m_nCurEpoch( 1 )
             , m_nCapacity( nBufferCapacity )
         {}
 
-        void flip_and_wait()
+        void wait_for_readers()
         {
             back_off bkoff;
-            base_class::flip_and_wait( bkoff );
+            base_class::wait_for_readers( bkoff );
         }
 
         // Return: true - synchronize has been called, false - otherwise
@@ -154,8 +156,10 @@ namespace cds { namespace urcu {
             bool bPushed = m_Buffer.push( p );
             if ( !bPushed || m_Buffer.size() >= capacity() ) {
                 synchronize();
-                if ( !bPushed )
+                if ( !bPushed ) {
                     p.free();
+                    base_class::m_Telemetry.on_free( 1 );
+                }
                 return true;
             }
             return false;
@@ -172,11 +176,15 @@ namespace cds { namespace urcu {
         /// Creates singleton object and starts reclamation thread
         /**
             The \p nBufferCapacity parameter defines RCU threshold.
+
+            If \p bExpedited is \p true and the system supports process-wide memory barrier
+            (\p membarrier(2) on Linux, \p FlushProcessWriteBuffers() on Windows), the RCU works in expedited mode:
+            the readers do not issue memory fences, instead \p synchronize() forces the barrier on all reader threads.
         */
-        static void Construct( size_t nBufferCapacity = 256 )
+        static void Construct( size_t nBufferCapacity = 256, bool bExpedited = false )
         {
             if ( !singleton_ptr::s_pRCU ) {
-                std::unique_ptr< general_threaded, scoped_disposer > pRCU( new general_threaded( nBufferCapacity ) );
+                std::unique_ptr< general_threaded, scoped_disposer > pRCU( new general_threaded( nBufferCapacity, bExpedited ) );
                 pRCU->m_DisposerThread.start();
 
                 singleton_ptr::s_pRCU = pRCU.release();
@@ -205,10 +213,12 @@ namespace cds { namespace urcu {
             When the buffer becomes full \ref synchronize function is called
             to wait for the end of grace period and then
             a message is sent to the reclamation thread.
+
+            If \p call_rcu object is attached to the RCU, \p p is passed to its callback queue instead.
         */
         virtual void retire_ptr( retired_ptr& p )
         {
-            if ( p.m_p )
+            if ( p.m_p && !base_class::template defer_retire< thread_gc >( p ))
                 push_buffer( epoch_retired_ptr( p, m_nCurEpoch.load( atomics::memory_order_acquire )));
         }
 
@@ -247,9 +257,10 @@ namespace cds { namespace urcu {
         {
             uint64_t nPrevEpoch = m_nCurEpoch.fetch_add( 1, atomics::memory_order_release );
             {
+                cds::gc::telemetry::gc_collector::stopwatch sw;
                 std::unique_lock<lock_type> sl( m_Lock );
-                flip_and_wait();
-                flip_and_wait();
+                wait_for_readers();
+                base_class::m_Telemetry.on_grace_period( sw.elapsed());
             }
             m_DisposerThread.dispose( m_Buffer, nPrevEpoch, bSync );
         }
@@ -264,6 +275,22 @@ namespace cds { namespace urcu {
         {
             return m_nCapacity;
         }
+
+        /// Checks if the RCU works in expedited mode
+        bool is_expedited() const
+        {
+            return base_class::asymmetric_fence();
+        }
+
+        /// Returns reclamation telemetry, see \ref cds_gc_telemetry "cds::gc::telemetry"
+        cds::gc::telemetry::snapshot& get_telemetry( cds::gc::telemetry::snapshot& s ) const
+        {
+            s.clear();
+            base_class::m_Telemetry.get( s );
+            s.nRetiredBacklog = m_Buffer.size();
+            s.nFreedCount += m_DisposerThread.disposed_count();
+            return s;
+        }
     };
 }} // namespace cds::urcu
 
@@ -76,7 +76,8 @@ namespace cds { namespace urcu { namespace details {
             );
         }
         else {
-            pRec->m_nAccessControl.fetch_add( 1, atomics::memory_order_release );
+            // Only the owner thread changes m_nAccessControl, so no RMW is needed for nested lock
+            pRec->m_nAccessControl.store( tmp + 1, atomics::memory_order_relaxed );
         }
         CDS_COMPILER_RW_BARRIER;
     }
@@ -88,7 +89,7 @@ namespace cds { namespace urcu { namespace details {
         assert( pRec != nullptr);
 
         CDS_COMPILER_RW_BARRIER;
-        pRec->m_nAccessControl.fetch_sub( 1, atomics::memory_order_release );
+        pRec->m_nAccessControl.store( pRec->m_nAccessControl.load( atomics::memory_order_relaxed ) - 1, atomics::memory_order_release );
     }
 
     template <typename RCUtag>
@@ -100,6 +101,18 @@ namespace cds { namespace urcu { namespace details {
         return (pRec->m_nAccessControl.load( atomics::memory_order_relaxed ) & rcu_class::c_nNestMask) != 0;
     }
 
+    template <typename RCUtag>
+    inline bool sh_thread_gc<RCUtag>::is_grace_period_pending()
+    {
+        thread_record * pRec = get_thread_record();
+        assert( pRec != nullptr);
+
+        // The writer waits for us if we are inside the critical section entered in the previous phase
+        uint32_t const v = pRec->m_nAccessControl.load( atomics::memory_order_relaxed );
+        return (v & rcu_class::c_nNestMask)
+            && ((v ^ sh_singleton<RCUtag>::instance()->global_control_word( atomics::memory_order_relaxed )) & ~rcu_class::c_nNestMask );
+    }
+
 
     // sh_singleton
     template <typename RCUtag>
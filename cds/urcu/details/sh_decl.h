@@ -36,6 +36,7 @@
 #ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
 #include <cds/details/static_functor.h>
 #include <cds/details/lib.h>
+#include <cds/gc/telemetry.h>
 
 #include <signal.h>
 
@@ -77,6 +78,7 @@ namespace cds { namespace urcu { namespace details {
         typedef typename rcu_tag::rcu_class rcu_class;
         typedef thread_data< rcu_tag >      thread_record;
         typedef cds::urcu::details::scoped_lock< sh_thread_gc > scoped_lock;
+        typedef cds::urcu::details::batch_lock< sh_thread_gc > batch_lock;
 
     protected:
         static thread_record * get_thread_record();
@@ -88,6 +90,7 @@ namespace cds { namespace urcu { namespace details {
         static void access_lock();
         static void access_unlock();
         static bool is_locked();
+        static bool is_grace_period_pending();
 
         /// Retire pointer \p by the disposer \p Disposer
         template <typename Disposer, typename T>
@@ -134,6 +137,7 @@ namespace cds { namespace urcu { namespace details {
         atomics::atomic<uint32_t>    m_nGlobalControl;
         thread_list< rcu_tag >          m_ThreadList;
         int const                       m_nSigNo;
+        cds::gc::telemetry::gc_collector m_Telemetry;
 
     protected:
         sh_singleton( int nSignal )
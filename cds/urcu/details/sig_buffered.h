@@ -87,6 +87,7 @@ namespace cds { namespace urcu {
 
         typedef base_class::thread_gc thread_gc ;   ///< Thread-side RCU part
         typedef typename thread_gc::scoped_lock scoped_lock ; ///< Access lock class
+        typedef typename thread_gc::batch_lock  batch_lock ;  ///< Batch access lock class
 
         static bool const c_bBuffered = true ; ///< This RCU buffers disposed elements
 
@@ -132,15 +133,18 @@ namespace cds { namespace urcu {
         void clear_buffer( uint64_t nEpoch )
         {
             epoch_retired_ptr p;
+            size_t nCount = 0;
             while ( m_Buffer.pop( p )) {
                 if ( p.m_nEpoch <= nEpoch ) {
                     p.free();
+                    ++nCount;
                 }
                 else {
                     push_buffer( std::move(p) );
                     break;
                 }
             }
+            base_class::m_Telemetry.on_free( nCount );
         }
 
         bool push_buffer( epoch_retired_ptr&& ep )
@@ -150,6 +154,7 @@ namespace cds { namespace urcu {
                 synchronize();
                 if ( !bPushed ) {
                     ep.free();
+                    base_class::m_Telemetry.on_free( 1 );
                 }
                 return true;
             }
@@ -188,10 +193,12 @@ namespace cds { namespace urcu {
             The method pushes \p p pointer to internal buffer.
             When the buffer becomes full \ref synchronize function is called
             to wait for the end of grace period and then to free all pointers from the buffer.
+
+            If \p call_rcu object is attached to the RCU, \p p is passed to its callback queue instead.
         */
         virtual void retire_ptr( retired_ptr& p )
         {
-            if ( p.m_p )
+            if ( p.m_p && !base_class::template defer_retire< thread_gc >( p ))
                 push_buffer( epoch_retired_ptr( p, m_nCurEpoch.load( atomics::memory_order_relaxed )));
         }
 
@@ -233,6 +240,7 @@ namespace cds { namespace urcu {
             atomics::atomic_thread_fence( atomics::memory_order_acquire );
             {
                 std::unique_lock<lock_type> sl( m_Lock );
+                cds::gc::telemetry::gc_collector::stopwatch sw;
                 if ( ep.m_p && m_Buffer.push( ep ) && m_Buffer.size() < capacity())
                     return false;
                 nEpoch = m_nCurEpoch.fetch_add( 1, atomics::memory_order_relaxed );
@@ -246,6 +254,7 @@ namespace cds { namespace urcu {
                 bkOff.reset();
                 base_class::wait_for_quiescent_state( bkOff );
                 base_class::force_membar_all_threads( bkOff );
+                base_class::m_Telemetry.on_grace_period( sw.elapsed());
             }
 
             clear_buffer( nEpoch );
@@ -264,6 +273,15 @@ namespace cds { namespace urcu {
         {
             return base_class::signal_no();
         }
+
+        /// Returns reclamation telemetry, see \ref cds_gc_telemetry "cds::gc::telemetry"
+        cds::gc::telemetry::snapshot& get_telemetry( cds::gc::telemetry::snapshot& s ) const
+        {
+            s.clear();
+            base_class::m_Telemetry.get( s );
+            s.nRetiredBacklog = m_Buffer.size();
+            return s;
+        }
     };
 
 }} // namespace cds::urcu
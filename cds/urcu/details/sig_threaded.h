@@ -88,6 +88,7 @@ namespace cds { namespace urcu {
         typedef signal_threaded_tag     rcu_tag ;       ///< Thread-side RCU part
         typedef base_class::thread_gc   thread_gc ;     ///< Access lock class
         typedef typename thread_gc::scoped_lock scoped_lock ; ///< Access lock class
+        typedef typename thread_gc::batch_lock  batch_lock ;  ///< Batch access lock class
 
         static bool const c_bBuffered = true ; ///< This RCU buffers disposed elements
 
@@ -141,6 +142,7 @@ namespace cds { namespace urcu {
                 synchronize();
                 if ( !bPushed ) {
                     p.free();
+                    base_class::m_Telemetry.on_free( 1 );
                 }
                 return true;
             }
@@ -193,10 +195,12 @@ namespace cds { namespace urcu {
             When the buffer becomes full \ref synchronize function is called
             to wait for the end of grace period and then
             a message is sent to the reclamation thread.
+
+            If \p call_rcu object is attached to the RCU, \p p is passed to its callback queue instead.
         */
         virtual void retire_ptr( retired_ptr& p )
         {
-            if ( p.m_p )
+            if ( p.m_p && !base_class::template defer_retire< thread_gc >( p ))
                 push_buffer( epoch_retired_ptr( p, m_nCurEpoch.load( atomics::memory_order_acquire )));
         }
 
@@ -237,6 +241,7 @@ namespace cds { namespace urcu {
             uint64_t nPrevEpoch = m_nCurEpoch.fetch_add( 1, atomics::memory_order_release );
 
             {
+                cds::gc::telemetry::gc_collector::stopwatch sw;
                 std::unique_lock<lock_type> sl( m_Lock );
 
                 back_off bkOff;
@@ -248,6 +253,7 @@ namespace cds { namespace urcu {
                 bkOff.reset();
                 base_class::wait_for_quiescent_state( bkOff );
                 base_class::force_membar_all_threads( bkOff );
+                base_class::m_Telemetry.on_grace_period( sw.elapsed());
 
                 m_DisposerThread.dispose( m_Buffer, nPrevEpoch, bSync );
             }
@@ -269,6 +275,16 @@ namespace cds { namespace urcu {
         {
             return base_class::signal_no();
         }
+
+        /// Returns reclamation telemetry, see \ref cds_gc_telemetry "cds::gc::telemetry"
+        cds::gc::telemetry::snapshot& get_telemetry( cds::gc::telemetry::snapshot& s ) const
+        {
+            s.clear();
+            base_class::m_Telemetry.get( s );
+            s.nRetiredBacklog = m_Buffer.size();
+            s.nFreedCount += m_DisposerThread.disposed_count();
+            return s;
+        }
     };
 }} // namespace cds::urcu
 
@@ -91,6 +91,9 @@ namespace cds { namespace urcu {
         // disposing pass sync
         condvar_type           m_cvReady;
         atomics::atomic<bool>  m_bReady;
+
+        // Count of freed objects, for telemetry
+        atomics::atomic<size_t> m_nDisposedCount;
         //@endcond
 
     private: // methods called from disposing thread
@@ -133,14 +136,17 @@ namespace cds { namespace urcu {
         void dispose_buffer( buffer_type * pBuf, uint64_t nCurEpoch )
         {
             epoch_retired_ptr * p;
+            size_t nCount = 0;
             while ( ( p = pBuf->front()) != nullptr ) {
                 if ( p->m_nEpoch <= nCurEpoch ) {
                     p->free();
                     CDS_VERIFY( pBuf->pop_front() );
+                    ++nCount;
                 }
                 else
                     break;
             }
+            m_nDisposedCount.fetch_add( nCount, atomics::memory_order_relaxed );
         }
         //@endcond
 
@@ -151,6 +157,7 @@ namespace cds { namespace urcu {
             , m_nCurEpoch(0)
             , m_bQuit( false )
             , m_bReady( false )
+            , m_nDisposedCount( 0 )
         {}
         //@endcond
 
@@ -224,6 +231,12 @@ namespace cds { namespace urcu {
                     m_cvReady.wait( lock );
             }
         }
+
+        /// Returns the count of objects freed by the reclamation thread
+        size_t disposed_count() const
+        {
+            return m_nDisposedCount.load( atomics::memory_order_relaxed );
+        }
     };
 }} // namespace cds::urcu
 
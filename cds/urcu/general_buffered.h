@@ -65,14 +65,22 @@ namespace cds { namespace urcu {
         typedef typename rcu_implementation::rcu_tag     rcu_tag     ;   ///< URCU tag
         typedef typename rcu_implementation::thread_gc   thread_gc   ;   ///< Thread-side RCU part
         typedef typename rcu_implementation::scoped_lock scoped_lock ;   ///< Access lock class
+        typedef typename rcu_implementation::batch_lock  batch_lock ;    ///< Batch access lock class for a sequence of lookups
 
         using details::gc_common::atomic_marked_ptr;
 
     public:
         /// Creates URCU \p %general_buffered singleton.
-        gc( size_t nBufferCapacity = 256 )
+        /**
+            The \p nBufferCapacity parameter defines RCU threshold.
+
+            If \p bExpedited is \p true, the RCU works in expedited mode when the system supports it:
+            the readers use compiler barriers only and \p synchronize() issues process-wide memory barrier,
+            see \p is_expedited().
+        */
+        gc( size_t nBufferCapacity = 256, bool bExpedited = false )
         {
-            rcu_implementation::Construct( nBufferCapacity );
+            rcu_implementation::Construct( nBufferCapacity, bExpedited );
         }
 
         /// Destroys URCU \p %general_instant singleton
@@ -82,6 +90,15 @@ namespace cds { namespace urcu {
         }
 
     public:
+        /// Checks if the RCU works in expedited mode
+        /**
+            The RCU leaves expedited mode if the process-wide memory barrier fails at run time.
+        */
+        static bool is_expedited()
+        {
+            return rcu_implementation::instance()->is_expedited();
+        }
+
         /// Waits to finish a grace period and clears the buffer
         /**
             After grace period finished the function frees all retired pointer
@@ -136,7 +153,17 @@ namespace cds { namespace urcu {
             rcu_implementation::instance()->batch_retire( e );
         }
 
-         /// Acquires access lock (so called RCU reader-side lock)
+         /// Returns reclamation telemetry
+        /**
+            The snapshot contains grace period latency histogram and the backlog of retired pointers,
+            see \ref cds_gc_telemetry "cds::gc::telemetry" for details.
+        */
+        static cds::gc::telemetry::snapshot& get_telemetry( cds::gc::telemetry::snapshot& s )
+        {
+            return rcu_implementation::instance()->get_telemetry( s );
+        }
+
+        /// Acquires access lock (so called RCU reader-side lock)
         /**
             For safety reasons, it is better to use \ref scoped_lock class for locking/unlocking
         */
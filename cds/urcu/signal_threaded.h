@@ -72,6 +72,7 @@ namespace cds { namespace urcu {
         typedef typename rcu_implementation::rcu_tag     rcu_tag     ;   ///< URCU tag
         typedef typename rcu_implementation::thread_gc   thread_gc   ;   ///< Thread-side RCU part
         typedef typename rcu_implementation::scoped_lock scoped_lock ;   ///< Access lock class
+        typedef typename rcu_implementation::batch_lock  batch_lock ;    ///< Batch access lock class for a sequence of lookups
 
         using details::gc_common::atomic_marked_ptr;
 
@@ -149,7 +150,17 @@ namespace cds { namespace urcu {
             rcu_implementation::instance()->batch_retire( e );
         }
 
-         /// Acquires access lock (so called RCU reader-side lock)
+         /// Returns reclamation telemetry
+        /**
+            The snapshot contains grace period latency histogram and the backlog of retired pointers,
+            see \ref cds_gc_telemetry "cds::gc::telemetry" for details.
+        */
+        static cds::gc::telemetry::snapshot& get_telemetry( cds::gc::telemetry::snapshot& s )
+        {
+            return rcu_implementation::instance()->get_telemetry( s );
+        }
+
+        /// Acquires access lock (so called RCU reader-side lock)
         /**
             For safety reasons, it is better to use \ref scoped_lock class for locking/unlocking
         */
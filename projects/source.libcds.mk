@@ -2,6 +2,8 @@ CDS_SOURCES= \
          src/hp_gc.cpp \
          src/init.cpp \
          src/dhp_gc.cpp \
+         src/he_gc.cpp \
+         src/ebr_gc.cpp \
          src/urcu_gp.cpp \
          src/urcu_sh.cpp \
          src/michael_heap.cpp \
@@ -7,6 +7,8 @@ CDS_TESTHDR_MAP := \
     tests/test-hdr/map/hdr_michael_map_rcu_shb.cpp \
     tests/test-hdr/map/hdr_michael_map_rcu_sht.cpp \
     tests/test-hdr/map/hdr_michael_map_nogc.cpp \
+    tests/test-hdr/map/hdr_michael_map_resizable.cpp \
+    tests/test-hdr/map/hdr_flat_hashmap.cpp \
     tests/test-hdr/map/hdr_michael_map_lazy_hp.cpp \
     tests/test-hdr/map/hdr_michael_map_lazy_dhp.cpp \
     tests/test-hdr/map/hdr_michael_map_lazy_rcu_gpi.cpp \
@@ -31,6 +33,9 @@ CDS_TESTHDR_MAP := \
     tests/test-hdr/map/hdr_refinable_hashmap_boost_unordered_map.cpp \
     tests/test-hdr/map/hdr_refinable_hashmap_slist.cpp \
     tests/test-hdr/map/hdr_skiplist_map_hp.cpp \
+    tests/test-hdr/map/hdr_unrolled_skiplist_map.cpp \
+    tests/test-hdr/map/hdr_block_splitlist_map.cpp \
+    tests/test-hdr/map/hdr_sharded_map.cpp \
     tests/test-hdr/map/hdr_skiplist_map_dhp.cpp \
     tests/test-hdr/map/hdr_skiplist_map_rcu_gpi.cpp \
     tests/test-hdr/map/hdr_skiplist_map_rcu_gpb.cpp \
@@ -87,6 +92,8 @@ CDS_TESTHDR_LIST := \
     tests/test-hdr/list/hdr_lazy_kv_rcu_shb.cpp \
     tests/test-hdr/list/hdr_lazy_kv_rcu_sht.cpp \
     tests/test-hdr/list/hdr_michael_dhp.cpp \
+    tests/test-hdr/list/hdr_michael_ebr.cpp \
+    tests/test-hdr/list/hdr_michael_he.cpp \
     tests/test-hdr/list/hdr_michael_hp.cpp \
     tests/test-hdr/list/hdr_michael_nogc.cpp \
     tests/test-hdr/list/hdr_michael_rcu_gpi.cpp \
@@ -176,6 +183,7 @@ CDS_TESTHDR_SET := \
     tests/test-hdr/set/hdr_michael_set_rcu_shb.cpp \
     tests/test-hdr/set/hdr_michael_set_rcu_sht.cpp \
     tests/test-hdr/set/hdr_michael_set_nogc.cpp \
+    tests/test-hdr/set/hdr_michael_set_resizable.cpp \
     tests/test-hdr/set/hdr_michael_set_lazy_hp.cpp \
     tests/test-hdr/set/hdr_michael_set_lazy_dhp.cpp \
     tests/test-hdr/set/hdr_michael_set_lazy_rcu_gpi.cpp \
@@ -203,6 +211,7 @@ CDS_TESTHDR_SET := \
     tests/test-hdr/set/hdr_refinable_hashset_slist.cpp \
     tests/test-hdr/set/hdr_refinable_hashset_vector.cpp \
     tests/test-hdr/set/hdr_skiplist_set_hp.cpp \
+    tests/test-hdr/set/hdr_unrolled_skiplist_set.cpp \
     tests/test-hdr/set/hdr_skiplist_set_dhp.cpp \
     tests/test-hdr/set/hdr_skiplist_set_rcu_gpi.cpp \
     tests/test-hdr/set/hdr_skiplist_set_rcu_gpb.cpp \
@@ -279,6 +288,11 @@ CDS_TESTHDR_TREE := \
     tests/test-hdr/tree/hdr_bronson_avltree_map_rcu_shb_pool_monitor.cpp \
     tests/test-hdr/tree/hdr_bronson_avltree_map_rcu_sht.cpp \
     tests/test-hdr/tree/hdr_bronson_avltree_map_rcu_sht_pool_monitor.cpp \
+    tests/test-hdr/tree/hdr_bplus_tree_map_rcu_gpb.cpp \
+    tests/test-hdr/tree/hdr_bplus_tree_map_rcu_gpi.cpp \
+    tests/test-hdr/tree/hdr_bplus_tree_map_rcu_gpt.cpp \
+    tests/test-hdr/tree/hdr_bplus_tree_map_rcu_shb.cpp \
+    tests/test-hdr/tree/hdr_bplus_tree_map_rcu_sht.cpp \
     
 
 CDS_TESTHDR_MISC := \
@@ -59,6 +59,8 @@ CDS_TESTHDR_OFFSETOF_LIST := \
     tests/test-hdr/list/hdr_intrusive_lazy_rcu_shb.cpp \
     tests/test-hdr/list/hdr_intrusive_lazy_rcu_sht.cpp \
     tests/test-hdr/list/hdr_intrusive_michael_dhp.cpp \
+    tests/test-hdr/list/hdr_intrusive_michael_ebr.cpp \
+    tests/test-hdr/list/hdr_intrusive_michael_he.cpp \
     tests/test-hdr/list/hdr_intrusive_michael_hp.cpp \
     tests/test-hdr/list/hdr_intrusive_michael_nogc.cpp \
     tests/test-hdr/list/hdr_intrusive_michael_list_rcu_gpb.cpp \
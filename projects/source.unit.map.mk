@@ -6,10 +6,18 @@ CDSUNIT_MAP_SOURCES := \
     tests/unit/map2/map_find_int_ellentree.cpp \
     tests/unit/map2/map_find_int_michael.cpp \
     tests/unit/map2/map_find_int_feldmanhashmap.cpp \
+    tests/unit/map2/map_find_int_flathashmap.cpp \
+    tests/unit/map2/map_find_int_unrolledskiplist.cpp \
+    tests/unit/map2/map_find_int_blocksplitlist.cpp \
+    tests/unit/map2/map_find_int_bplustree.cpp \
     tests/unit/map2/map_find_int_skip.cpp \
     tests/unit/map2/map_find_int_split.cpp \
     tests/unit/map2/map_find_int_striped.cpp \
     tests/unit/map2/map_find_int_std.cpp \
+    tests/unit/map2/map_find_batch.cpp \
+    tests/unit/map2/map_find_batch_michael.cpp \
+    tests/unit/map2/map_find_batch_split.cpp \
+    tests/unit/map2/map_find_batch_feldmanhashmap.cpp \
     tests/unit/map2/map_find_string.cpp \
     tests/unit/map2/map_find_string_bronsonavltree.cpp \
     tests/unit/map2/map_find_string_cuckoo.cpp \
@@ -26,6 +34,10 @@ CDSUNIT_MAP_SOURCES := \
     tests/unit/map2/map_insfind_int_ellentree.cpp \
     tests/unit/map2/map_insfind_int_michael.cpp \
     tests/unit/map2/map_insfind_int_feldmanhashmap.cpp \
+    tests/unit/map2/map_insfind_int_flathashmap.cpp \
+    tests/unit/map2/map_insfind_int_unrolledskiplist.cpp \
+    tests/unit/map2/map_insfind_int_blocksplitlist.cpp \
+    tests/unit/map2/map_insfind_int_bplustree.cpp \
     tests/unit/map2/map_insfind_int_skip.cpp \
     tests/unit/map2/map_insfind_int_split.cpp \
     tests/unit/map2/map_insfind_int_striped.cpp \
@@ -44,7 +56,12 @@ CDSUNIT_MAP_SOURCES := \
     tests/unit/map2/map_insdel_int_cuckoo.cpp \
     tests/unit/map2/map_insdel_int_ellentree.cpp \
     tests/unit/map2/map_insdel_int_michael.cpp \
+    tests/unit/map2/map_insdel_int_michael_resizable.cpp \
     tests/unit/map2/map_insdel_int_feldmanhashmap.cpp \
+    tests/unit/map2/map_insdel_int_flathashmap.cpp \
+    tests/unit/map2/map_insdel_int_unrolledskiplist.cpp \
+    tests/unit/map2/map_insdel_int_blocksplitlist.cpp \
+    tests/unit/map2/map_insdel_int_bplustree.cpp \
     tests/unit/map2/map_insdel_int_skip.cpp \
     tests/unit/map2/map_insdel_int_split.cpp \
     tests/unit/map2/map_insdel_int_striped.cpp \
@@ -83,6 +100,7 @@ CDSUNIT_MAP_SOURCES := \
     tests/unit/map2/map_insdelfind_ellentree.cpp \
     tests/unit/map2/map_insdelfind_michael.cpp \
     tests/unit/map2/map_insdelfind_feldmanhashmap.cpp \
+    tests/unit/map2/map_insdelfind_blocksplitlist.cpp \
     tests/unit/map2/map_insdelfind_skip.cpp \
     tests/unit/map2/map_insdelfind_split.cpp \
     tests/unit/map2/map_insdelfind_striped.cpp \
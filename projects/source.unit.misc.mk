@@ -5,4 +5,9 @@ CDSUNIT_MISC_SOURCES := \
     tests/unit/alloc/linux_scale.cpp \
     tests/unit/alloc/michael_allocator.cpp \
     tests/unit/alloc/random.cpp \
+    tests/unit/gc/hp_scan.cpp \
+    tests/unit/gc/dhp_reclaim.cpp \
+    tests/unit/gc/rcu_sync.cpp \
+    tests/unit/gc/call_rcu.cpp \
+    tests/unit/gc/gc_telemetry.cpp \
     tests/unit/lock/spinlock.cpp
@@ -6,6 +6,7 @@ CDSUNIT_SET_SOURCES := \
 	tests/unit/set2/set_insdel_func_michael.cpp \
     tests/unit/set2/set_insdel_func_feldmanhashset.cpp \
 	tests/unit/set2/set_insdel_func_skip.cpp \
+	tests/unit/set2/set_insdel_func_unrolledskiplist.cpp \
 	tests/unit/set2/set_insdel_func_split.cpp \
 	tests/unit/set2/set_insdel_func_striped.cpp \
 	tests/unit/set2/set_insdel_string.cpp \
@@ -23,6 +24,7 @@ CDSUNIT_SET_SOURCES := \
     tests/unit/set2/set_insdelfind_michael.cpp \
     tests/unit/set2/set_insdelfind_feldmanhashset.cpp \
 	tests/unit/set2/set_insdelfind_skip.cpp \
+	tests/unit/set2/set_insdelfind_unrolledskiplist.cpp \
 	tests/unit/set2/set_insdelfind_split.cpp \
 	tests/unit/set2/set_insdelfind_striped.cpp \
     tests/unit/set2/set_insdelfind_std.cpp \
@@ -33,3 +35,5 @@ CDSUNIT_SET_SOURCES := \
 	tests/unit/set2/set_delodd_feldmanhashset.cpp \
 	tests/unit/set2/set_delodd_skip.cpp \
 	tests/unit/set2/set_delodd_split.cpp \
+	tests/unit/set2/set_grow_shrink.cpp \
+	tests/unit/set2/set_grow_shrink_split.cpp \
@@ -32,6 +32,9 @@
 
 #include <algorithm>   // std::fill
 #include <functional>  // std::hash
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 #include <cds/gc/details/dhp.h>
 #include <cds/algo/int_algo.h>
@@ -161,18 +164,91 @@ namespace cds { namespace gc { namespace dhp {
                 return ret;
             }
         };
+
+        // Background reclaimer thread: calls GarbageCollector::scan() on request of retiring threads.
+        // The thread is not attached to libcds: scan() does not need the thread record,
+        // and attaching from the constructor of GarbageCollector would race with GarbageCollector::instance()
+        class reclaimer_thread {
+            typedef std::unique_lock< std::mutex > unique_lock;
+
+            GarbageCollector&       m_gc;
+            std::mutex              m_Mutex;
+            std::condition_variable m_cvRequest;
+            bool                    m_bQuit;
+            std::thread             m_Thread;   // should be the last member since it is started in the ctor
+
+            void execute()
+            {
+                for (;;) {
+                    {
+                        unique_lock lock( m_Mutex );
+                        while ( !m_bQuit && !m_gc.m_bReclaimRequested.load( atomics::memory_order_acquire ))
+                            m_cvRequest.wait( lock );
+                        if ( m_bQuit )
+                            return;
+                    }
+
+                    // Reset the request before scan() so the retiring threads can wake us up again
+                    // if the buffer is refilled during the scan
+                    m_gc.m_bReclaimRequested.store( false, atomics::memory_order_release );
+                    if ( m_gc.m_bStatEnabled )
+                        m_gc.m_stat.m_nBackgroundScanCount.fetch_add( 1, atomics::memory_order_relaxed );
+                    m_gc.scan();
+                }
+            }
+
+        public:
+            explicit reclaimer_thread( GarbageCollector& gc )
+                : m_gc( gc )
+                , m_bQuit( false )
+                , m_Thread( &reclaimer_thread::execute, this )
+            {}
+
+            ~reclaimer_thread()
+            {
+                {
+                    unique_lock lock( m_Mutex );
+                    m_bQuit = true;
+                }
+                m_cvRequest.notify_one();
+                m_Thread.join();
+            }
+
+            void wake()
+            {
+                // Lock the mutex to prevent lost wake-up: the request flag is checked under the mutex
+                {
+                    unique_lock lock( m_Mutex );
+                }
+                m_cvRequest.notify_one();
+            }
+        };
     }
 
     GarbageCollector * GarbageCollector::m_pManager = nullptr;
 
+    namespace {
+        // The backpressure threshold is a multiple of the current liberate threshold
+        // since scan() may double the latter
+        size_t backpressure_ratio( size_t nLiberateThreshold, size_t nBackpressureThreshold )
+        {
+            if ( nBackpressureThreshold == 0 )
+                return 4;
+            size_t const nRatio = ( nBackpressureThreshold + nLiberateThreshold - 1 ) / nLiberateThreshold;
+            return nRatio < 2 ? 2 : nRatio;
+        }
+    }
+
     void CDS_STDCALL GarbageCollector::Construct(
         size_t nLiberateThreshold
         , size_t nInitialThreadGuardCount
         , size_t nEpochCount
+        , bool bBackgroundReclaim
+        , size_t nBackpressureThreshold
     )
     {
         if ( !m_pManager ) {
-            m_pManager = new GarbageCollector( nLiberateThreshold, nInitialThreadGuardCount, nEpochCount );
+            m_pManager = new GarbageCollector( nLiberateThreshold, nInitialThreadGuardCount, nEpochCount, bBackgroundReclaim, nBackpressureThreshold );
         }
     }
 
@@ -182,22 +258,39 @@ namespace cds { namespace gc { namespace dhp {
         m_pManager = nullptr;
     }
 
-    GarbageCollector::GarbageCollector( size_t nLiberateThreshold, size_t nInitialThreadGuardCount, size_t nEpochCount )
+    GarbageCollector::GarbageCollector( size_t nLiberateThreshold, size_t nInitialThreadGuardCount, size_t nEpochCount, bool bBackgroundReclaim, size_t nBackpressureThreshold )
         : m_nLiberateThreshold( nLiberateThreshold ? nLiberateThreshold : 1024 )
         , m_nInitialThreadGuardCount( nInitialThreadGuardCount ? nInitialThreadGuardCount : 8 )
         , m_RetiredAllocator( static_cast<unsigned int>( nEpochCount ? nEpochCount : 16 ))
+        , m_pReclaimer( nullptr )
+        , m_nBackpressureRatio( backpressure_ratio( m_nLiberateThreshold.load( atomics::memory_order_relaxed ), nBackpressureThreshold ))
+        , m_bReclaimRequested( false )
         , m_bStatEnabled( false )
-    {}
+    {
+        if ( bBackgroundReclaim )
+            m_pReclaimer = new details::reclaimer_thread( *this );
+    }
 
     GarbageCollector::~GarbageCollector()
     {
+        // Stop the reclaimer thread, the rest of retired pointers is freed by the final scan()
+        delete m_pReclaimer;
+        m_pReclaimer = nullptr;
+
         scan();
     }
 
+    void GarbageCollector::wake_reclaimer()
+    {
+        assert( m_pReclaimer != nullptr );
+        m_pReclaimer->wake();
+    }
+
     void GarbageCollector::scan()
     {
         details::retired_ptr_buffer::privatize_result retiredList = m_RetiredBuffer.privatize();
         if ( retiredList.first ) {
+            telemetry::gc_collector::stopwatch sw;
 
             size_t nLiberateThreshold = m_nLiberateThreshold.load(atomics::memory_order_relaxed);
             details::liberate_set set( beans::ceil2( retiredList.second > nLiberateThreshold ? retiredList.second : nLiberateThreshold ));
@@ -242,6 +335,7 @@ namespace cds { namespace gc { namespace dhp {
                             pBusyLast->m_pNext.store( p, atomics::memory_order_relaxed );
                             pBusyLast = p;
                             ++nBusyCount;
+                            p = p->m_pNextFree.load(atomics::memory_order_relaxed);
                         }
                     }
                 }
@@ -264,6 +358,8 @@ namespace cds { namespace gc { namespace dhp {
                 // scan() cycle did not free any retired pointer - double scan() threshold
                 m_nLiberateThreshold.compare_exchange_strong( nLiberateThreshold, nLiberateThreshold * 2, atomics::memory_order_release, atomics::memory_order_relaxed );
             }
+
+            m_Telemetry.on_scan( sw.elapsed(), nRetiredCount - nBusyCount );
         }
     }
 }}} // namespace cds::gc::dhp
@@ -0,0 +1,320 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+/*
+    File: ebr_gc.cpp
+
+    Epoch-based memory reclamation strategy implementation
+*/
+
+#include <cds/gc/details/ebr.h>
+
+#include "hp_const.h"
+
+#define    CDS_EBR_STATISTIC( _x )    if ( m_bStatEnabled ) { _x; }
+
+namespace cds { namespace gc {
+    namespace ebr {
+
+        /// Default initial capacity of limbo bag
+        static const size_t c_nInitRetireNodeCount = c_nEpochAdvanceFreq * 2;
+
+        GarbageCollector *    GarbageCollector::m_pEBRManager = nullptr;
+
+        void CDS_STDCALL GarbageCollector::Construct( size_t nGuardCount, size_t nMaxThreadCount, size_t nInitRetiredPtrCount, size_t nEpochAdvanceFreq )
+        {
+            if ( !m_pEBRManager ) {
+                m_pEBRManager = new GarbageCollector( nGuardCount, nMaxThreadCount, nInitRetiredPtrCount, nEpochAdvanceFreq );
+            }
+        }
+
+        void CDS_STDCALL GarbageCollector::Destruct( bool bDetachAll )
+        {
+            if ( m_pEBRManager ) {
+                if ( bDetachAll )
+                    m_pEBRManager->detachAllThread();
+
+                delete m_pEBRManager;
+                m_pEBRManager = nullptr;
+            }
+        }
+
+        GarbageCollector::GarbageCollector(
+            size_t nGuardCount,
+            size_t nMaxThreadCount,
+            size_t nInitRetiredPtrCount,
+            size_t nEpochAdvanceFreq
+        )
+            : m_nGlobalEpoch( 1 )
+            ,m_bStatEnabled( false )
+            ,m_nGuardCount( nGuardCount == 0 ? c_nGuardPerThread : nGuardCount )
+            ,m_nMaxThreadCount( nMaxThreadCount == 0 ? c_nMaxThreadCount : nMaxThreadCount )
+            ,m_nInitRetiredPtrCount( nInitRetiredPtrCount == 0 ? c_nInitRetireNodeCount : nInitRetiredPtrCount )
+            ,m_nEpochAdvanceFreq( nEpochAdvanceFreq == 0 ? c_nEpochAdvanceFreq : nEpochAdvanceFreq )
+        {}
+
+        GarbageCollector::~GarbageCollector()
+        {
+            clear_records( [this]( ebrlist_node * ebrrec ) {
+                ebrrec->m_Pending.free_all();
+                for ( size_t i = 0; i < details::ebr_record::c_nLimboCount; ++i )
+                    ebrrec->m_Limbo[i].free_all();
+                DeleteEBRRec( ebrrec );
+            });
+        }
+
+        inline GarbageCollector::ebrlist_node * GarbageCollector::NewEBRRec()
+        {
+            CDS_EBR_STATISTIC( ++m_Stat.m_AllocNewEBRRec )
+            return new ebrlist_node( *this );
+        }
+
+        inline void GarbageCollector::DeleteEBRRec( ebrlist_node * pNode )
+        {
+            CDS_EBR_STATISTIC( ++m_Stat.m_DeleteEBRRec )
+            assert( pNode->retired_count() == 0 );
+            delete pNode;
+        }
+
+        details::ebr_record * GarbageCollector::alloc_record()
+        {
+            CDS_EBR_STATISTIC( ++m_Stat.m_AllocEBRRec )
+
+            // First try to reuse a retired (non-active) EBR record
+            ebrlist_node * ebrrec = reuse_record();
+            if ( !ebrrec ) {
+                // No EBR records available for reuse
+                // Allocate and push a new EBR record
+                ebrrec = NewEBRRec();
+                push_record( ebrrec );
+            }
+            return ebrrec;
+        }
+
+        void GarbageCollector::free_record( details::ebr_record * pRec )
+        {
+            assert( pRec != nullptr );
+            CDS_EBR_STATISTIC( ++m_Stat.m_RetireEBRRec )
+
+            pRec->clear();
+            Scan( pRec );
+            HelpScan( pRec );
+
+            // The limbo bags that are not expired yet are kept in the record.
+            // They will be freed by HelpScan() of other thread or by the next owner of the record
+            release_record( static_cast<ebrlist_node *>( pRec ), pRec->retired_count() == 0 );
+        }
+
+        void GarbageCollector::detachAllThread()
+        {
+            for_each_owned( [this]( ebrlist_node * ebrrec ) { free_record( ebrrec ); } );
+        }
+
+        size_t GarbageCollector::seal( details::ebr_record * pRec )
+        {
+            if ( pRec->m_Pending.empty() )
+                return 0;
+
+            // The retired pointers have been unlinked before the epoch is read:
+            // a thread that can refer to them has announced this epoch or older one
+            atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+            const epoch_type nEpoch = m_nGlobalEpoch.load( atomics::memory_order_acquire );
+
+            details::retired_bag& bag = pRec->m_Limbo[ nEpoch % details::ebr_record::c_nLimboCount ];
+            size_t nFreed = 0;
+            if ( bag.epoch() != nEpoch ) {
+                // The bag is at least three epochs old
+                assert( bag.empty() || bag.epoch() + 2 <= nEpoch );
+                nFreed = bag.free_all();
+                CDS_EBR_STATISTIC( m_Stat.m_DeletedNode += nFreed )
+                bag.epoch( nEpoch );
+            }
+            bag.splice( pRec->m_Pending );
+            return nFreed;
+        }
+
+        bool GarbageCollector::try_advance( epoch_type& nEpoch )
+        {
+            atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+            for ( ebrlist_node * pNode = m_pListHead.load( atomics::memory_order_acquire ); pNode; pNode = pNode->m_pNextNode ) {
+                epoch_type const nAnnounced = pNode->m_Guards.announced();
+                if ( nAnnounced != c_nQuiescent && ( nAnnounced >> 1 ) < nEpoch ) {
+                    // The thread is inside of critical section entered in previous epoch
+                    CDS_EBR_STATISTIC( ++m_Stat.m_EpochBlocked )
+                    return false;
+                }
+            }
+
+            // If CAS fails, the epoch has been advanced by other thread
+            if ( m_nGlobalEpoch.compare_exchange_strong( nEpoch, nEpoch + 1, atomics::memory_order_acq_rel, atomics::memory_order_acquire )) {
+                ++nEpoch;
+                CDS_EBR_STATISTIC( ++m_Stat.m_EpochAdvance )
+            }
+            return true;
+        }
+
+        size_t GarbageCollector::collect( details::ebr_record * pRec, epoch_type nEpoch )
+        {
+            size_t nFreed = 0;
+            for ( size_t i = 0; i < details::ebr_record::c_nLimboCount; ++i ) {
+                details::retired_bag& bag = pRec->m_Limbo[i];
+                if ( !bag.empty() && bag.epoch() + 2 <= nEpoch )
+                    nFreed += bag.free_all();
+            }
+            CDS_EBR_STATISTIC( m_Stat.m_DeletedNode += nFreed )
+            return nFreed;
+        }
+
+        void GarbageCollector::Scan( details::ebr_record * pRec )
+        {
+            CDS_EBR_STATISTIC( ++m_Stat.m_ScanCallCount )
+            telemetry::gc_collector::stopwatch sw;
+
+            // Stage 1: stamp the pending bag by the global epoch and move it to the limbo
+            size_t nFreed = seal( pRec );
+
+            // Stage 2: try to advance the global epoch twice.
+            // If no thread is inside of critical section, all bags of pRec will be expired.
+            // The current thread does not block the advance if it holds only empty guards
+            epoch_type nEpoch = m_nGlobalEpoch.load( atomics::memory_order_acquire );
+            for ( int i = 0; i < 2; ++i ) {
+                pRec->m_Guards.refresh();
+                if ( !try_advance( nEpoch ))
+                    break;
+            }
+
+            // Stage 3: free the limbo bags that are two epochs old
+            nFreed += collect( pRec, nEpoch );
+            m_Telemetry.on_scan( sw.elapsed(), nFreed );
+        }
+
+        void GarbageCollector::HelpScan( details::ebr_record * pThis )
+        {
+            CDS_EBR_STATISTIC( ++m_Stat.m_HelpScanCallCount )
+
+            assert( static_cast<ebrlist_node *>(pThis)->m_idOwner.load(atomics::memory_order_relaxed) == cds::OS::get_current_thread_id() );
+
+            for ( ebrlist_node * ebrrec = m_pListHead.load(atomics::memory_order_acquire); ebrrec; ebrrec = ebrrec->m_pNextNode ) {
+
+                // If m_bFree == true then the record has no retired pointers - we don't need to see it
+                if ( ebrrec == pThis || ebrrec->m_bFree.load(atomics::memory_order_acquire) )
+                    continue;
+
+                // Owns ebrrec if it is free or if its owner thread is terminated.
+                // Several threads may work concurrently so we use atomic technique only.
+                cds::OS::ThreadId prevOwner;
+                if ( !adopt_record( ebrrec, prevOwner ))
+                    continue;
+                if ( prevOwner != cds::OS::c_NullThreadId ) {
+                    // The owner is terminated without detaching: it cannot be inside of critical section
+                    ebrrec->clear();
+                }
+
+                // We own the record successfully. The retired pointers are kept in the record,
+                // only the expired limbo bags are freed
+                size_t nFreed = seal( ebrrec );
+                nFreed += collect( ebrrec, m_nGlobalEpoch.load( atomics::memory_order_acquire ));
+                m_Telemetry.on_free( nFreed );
+
+                release_record( ebrrec, ebrrec->retired_count() == 0 );
+            }
+            // The retired pointers of dead threads are not moved, so nothing is adopted
+            m_Telemetry.on_help_scan( 0 );
+        }
+
+        GarbageCollector::InternalState& GarbageCollector::getInternalState( GarbageCollector::InternalState& stat) const
+        {
+            stat.nGuardCount             = m_nGuardCount;
+            stat.nMaxThreadCount         = m_nMaxThreadCount;
+            stat.nInitRetiredPtrCount    = m_nInitRetiredPtrCount;
+            stat.nEpochAdvanceFreq       = m_nEpochAdvanceFreq;
+            stat.nCurrentEpoch           = m_nGlobalEpoch.load( atomics::memory_order_relaxed );
+
+            stat.nEBRRecAllocated        =
+                stat.nEBRRecUsed             =
+                stat.nTotalRetiredPtrCount   =
+                stat.nRetiredPtrInFreeEBRRecs = 0;
+
+            for ( ebrlist_node * ebrrec = m_pListHead.load(atomics::memory_order_acquire); ebrrec; ebrrec = ebrrec->m_pNextNode ) {
+                ++stat.nEBRRecAllocated;
+                size_t const nRetired = ebrrec->retired_count();
+                stat.nTotalRetiredPtrCount += nRetired;
+
+                if ( ebrrec->m_idOwner.load(atomics::memory_order_relaxed) == cds::OS::c_NullThreadId ) {
+                    // Free EBR record
+                    stat.nRetiredPtrInFreeEBRRecs += nRetired;
+                }
+                else {
+                    // Used EBR record
+                    ++stat.nEBRRecUsed;
+                }
+            }
+
+            // Events
+            stat.evcAllocEBRRec   = m_Stat.m_AllocEBRRec;
+            stat.evcRetireEBRRec  = m_Stat.m_RetireEBRRec;
+            stat.evcAllocNewEBRRec= m_Stat.m_AllocNewEBRRec;
+            stat.evcDeleteEBRRec  = m_Stat.m_DeleteEBRRec;
+
+            stat.evcScanCall      = m_Stat.m_ScanCallCount;
+            stat.evcHelpScanCall  = m_Stat.m_HelpScanCallCount;
+            stat.evcEpochAdvance  = m_Stat.m_EpochAdvance;
+            stat.evcEpochBlocked  = m_Stat.m_EpochBlocked;
+            stat.evcBagGrow       = m_Stat.m_BagGrow;
+
+            stat.evcDeletedNode   = m_Stat.m_DeletedNode;
+
+            return stat;
+        }
+
+        telemetry::snapshot& GarbageCollector::get_telemetry( telemetry::snapshot& s ) const
+        {
+            s.clear();
+            m_Telemetry.get( s );
+
+            for ( ebrlist_node * ebrrec = m_pListHead.load( atomics::memory_order_acquire ); ebrrec; ebrrec = ebrrec->m_pNextNode ) {
+                // TSan: the bags of other thread are read without synchronization,
+                // the telemetry snapshot is not atomic by design
+                CDS_TSAN_ANNOTATE_IGNORE_READS_BEGIN;
+                size_t const nRetired = ebrrec->retired_count();
+                CDS_TSAN_ANNOTATE_IGNORE_READS_END;
+                s.nRetiredBacklog += nRetired;
+                if ( ebrrec->m_idOwner.load( atomics::memory_order_relaxed ) != cds::OS::c_NullThreadId ) {
+                    telemetry::thread_stat ts;
+                    ts.idOwner = ebrrec->m_idOwner.load( atomics::memory_order_relaxed );
+                    ts.nRetiredCount = nRetired;
+                    s.threads.push_back( ts );
+                }
+            }
+            return s;
+        }
+
+    } //namespace ebr
+}} // namespace cds::gc
@@ -0,0 +1,324 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+/*
+    File: he_gc.cpp
+
+    Hazard Eras memory reclamation strategy implementation
+*/
+
+#include <cds/gc/details/he.h>
+
+#include <limits>       // std::numeric_limits
+#include "hp_const.h"
+
+#define    CDS_HAZARDERA_STATISTIC( _x )    if ( m_bStatEnabled ) { _x; }
+
+namespace cds { namespace gc {
+    namespace he {
+
+        /// Default initial array size of retired pointers
+        static const size_t c_nInitRetireNodeCount = c_nHazardEraPerThread * c_nMaxThreadCount * 2;
+
+        GarbageCollector *    GarbageCollector::m_pHEManager = nullptr;
+
+        void CDS_STDCALL GarbageCollector::Construct( size_t nHazardEraCount, size_t nMaxThreadCount, size_t nInitRetiredPtrCount, size_t nEraAdvanceFreq )
+        {
+            if ( !m_pHEManager ) {
+                m_pHEManager = new GarbageCollector( nHazardEraCount, nMaxThreadCount, nInitRetiredPtrCount, nEraAdvanceFreq );
+            }
+        }
+
+        void CDS_STDCALL GarbageCollector::Destruct( bool bDetachAll )
+        {
+            if ( m_pHEManager ) {
+                if ( bDetachAll )
+                    m_pHEManager->detachAllThread();
+
+                delete m_pHEManager;
+                m_pHEManager = nullptr;
+            }
+        }
+
+        GarbageCollector::GarbageCollector(
+            size_t nHazardEraCount,
+            size_t nMaxThreadCount,
+            size_t nInitRetiredPtrCount,
+            size_t nEraAdvanceFreq
+        )
+            : m_nEraClock( c_nNoEra + 1 )
+            ,m_bStatEnabled( false )
+            ,m_nHazardEraCount( nHazardEraCount == 0 ? c_nHazardEraPerThread : nHazardEraCount )
+            ,m_nMaxThreadCount( nMaxThreadCount == 0 ? c_nMaxThreadCount : nMaxThreadCount )
+            ,m_nInitRetiredPtrCount( nInitRetiredPtrCount == 0 ? c_nInitRetireNodeCount : nInitRetiredPtrCount )
+            ,m_nEraAdvanceFreq( nEraAdvanceFreq == 0 ? c_nEraAdvanceFreq : nEraAdvanceFreq )
+        {}
+
+        GarbageCollector::~GarbageCollector()
+        {
+            clear_records( [this]( helist_node * herec ) {
+                details::retired_vector& vect = herec->m_arrRetired;
+                for ( details::retired_vector::iterator it = vect.begin(), itEnd = vect.end(); it != itEnd; ++it )
+                    it->free();
+                vect.clear();
+                DeleteHERec( herec );
+            });
+        }
+
+        inline GarbageCollector::helist_node * GarbageCollector::NewHERec()
+        {
+            CDS_HAZARDERA_STATISTIC( ++m_Stat.m_AllocNewHERec )
+            return new helist_node( *this );
+        }
+
+        inline void GarbageCollector::DeleteHERec( helist_node * pNode )
+        {
+            CDS_HAZARDERA_STATISTIC( ++m_Stat.m_DeleteHERec )
+            assert( pNode->m_arrRetired.size() == 0 );
+            delete pNode;
+        }
+
+        details::he_record * GarbageCollector::alloc_record()
+        {
+            CDS_HAZARDERA_STATISTIC( ++m_Stat.m_AllocHERec )
+
+            // First try to reuse a retired (non-active) HE record
+            helist_node * herec = reuse_record();
+            if ( !herec ) {
+                // No HE records available for reuse
+                // Allocate and push a new HE record
+                herec = NewHERec();
+                push_record( herec );
+            }
+            return herec;
+        }
+
+        void GarbageCollector::free_record( details::he_record * pRec )
+        {
+            assert( pRec != nullptr );
+            CDS_HAZARDERA_STATISTIC( ++m_Stat.m_RetireHERec )
+
+            pRec->clear();
+            Scan( pRec );
+            HelpScan( pRec );
+            release_record( static_cast<helist_node *>( pRec ), false );
+        }
+
+        void GarbageCollector::detachAllThread()
+        {
+            for_each_owned( [this]( helist_node * herec ) { free_record( herec ); } );
+        }
+
+        era_type GarbageCollector::min_published_era() const
+        {
+            era_type nMinEra = std::numeric_limits<era_type>::max();
+
+            for ( helist_node * pNode = m_pListHead.load( atomics::memory_order_acquire ); pNode; pNode = pNode->m_pNextNode ) {
+                for ( size_t i = 0; i < m_nHazardEraCount; ++i ) {
+                    era_type nEra = pNode->m_Guards[i].era();
+                    if ( nEra != c_nNoEra && nEra < nMinEra )
+                        nMinEra = nEra;
+                }
+            }
+            return nMinEra;
+        }
+
+        void GarbageCollector::Scan( details::he_record * pRec )
+        {
+            CDS_HAZARDERA_STATISTIC( ++m_Stat.m_ScanCallCount )
+            telemetry::gc_collector::stopwatch sw;
+
+            // Stage 1: advance the era. Any guard published after this point
+            // has an era greater than the era of every retired pointer of pRec
+            m_nEraClock.fetch_add( 1, atomics::memory_order_seq_cst );
+            atomics::atomic_thread_fence( atomics::memory_order_seq_cst );
+
+            // Stage 2: get the oldest era published by all threads
+            const era_type nMinEra = min_published_era();
+
+            // Stage 3: free the retired pointers that have been retired before the oldest published era.
+            // The array is compacted in-place, no allocation and no sorting is needed
+            details::retired_vector& arrRetired = pRec->m_arrRetired;
+            details::retired_vector::iterator itRetired     = arrRetired.begin();
+            details::retired_vector::iterator itRetiredEnd  = arrRetired.end();
+            details::retired_vector::iterator itInsert      = itRetired;
+            for ( details::retired_vector::iterator it = itRetired; it != itRetiredEnd; ++it ) {
+                if ( it->m_nRetireEra < nMinEra ) {
+                    // No guard can protect the pointer
+                    it->free();
+                }
+                else {
+                    if ( itInsert != it )
+                        *itInsert = *it;
+                    ++itInsert;
+                }
+            }
+            const size_t nDeferred = itInsert - itRetired;
+            arrRetired.size( nDeferred );
+            CDS_HAZARDERA_STATISTIC( m_Stat.m_DeferredNode += nDeferred )
+            CDS_HAZARDERA_STATISTIC( m_Stat.m_DeletedNode += (itRetiredEnd - itRetired) - nDeferred )
+            m_Telemetry.on_scan( sw.elapsed(), (itRetiredEnd - itRetired) - nDeferred );
+
+            // Stage 4: a stalled thread holds back the retired pointers, so the array grows when needed
+            if ( arrRetired.isFull() ) {
+                CDS_HAZARDERA_STATISTIC( ++m_Stat.m_RetiredGrow )
+                arrRetired.grow();
+            }
+        }
+
+        void GarbageCollector::push_retired( details::he_record * pRec, details::retired_era_ptr const& p )
+        {
+            pRec->m_arrRetired.push( p );
+            if ( pRec->m_arrRetired.isFull() ) {
+                CDS_HAZARDERA_STATISTIC( ++m_Stat.m_CallScanFromHelpScan )
+                Scan( pRec );
+            }
+        }
+
+        void GarbageCollector::HelpScan( details::he_record * pThis )
+        {
+            CDS_HAZARDERA_STATISTIC( ++m_Stat.m_HelpScanCallCount )
+
+            assert( static_cast<helist_node *>(pThis)->m_idOwner.load(atomics::memory_order_relaxed) == cds::OS::get_current_thread_id() );
+
+            size_t nAdopted = 0;
+            for ( helist_node * herec = m_pListHead.load(atomics::memory_order_acquire); herec; herec = herec->m_pNextNode ) {
+
+                // If m_bFree == true then herec->m_arrRetired is empty - we don't need to see it
+                if ( herec == pThis || herec->m_bFree.load(atomics::memory_order_acquire) )
+                    continue;
+
+                // Owns herec if it is free or if its owner thread is terminated.
+                // Several threads may work concurrently so we use atomic technique only.
+                cds::OS::ThreadId prevOwner;
+                if ( !adopt_record( herec, prevOwner ))
+                    continue;
+                if ( prevOwner != cds::OS::c_NullThreadId ) {
+                    // The owner is terminated without detaching: its eras do not protect anything
+                    herec->clear();
+                }
+
+                // We own the thread successfully. Now, we can see whether he_record has retired pointers.
+                // If it has ones then we move to pThis that is private for current thread.
+                // The eras of the retired pointers are kept unchanged.
+                details::retired_vector& src = herec->m_arrRetired;
+
+                // TSan can issue a warning here:
+                //  read src.m_nSize in src.end()
+                //  write src.m_nSize in src.clear()
+                // This is false positive since we own herec
+                CDS_TSAN_ANNOTATE_IGNORE_READS_BEGIN;
+                details::retired_vector::iterator itRetiredEnd = src.end();
+                CDS_TSAN_ANNOTATE_IGNORE_READS_END;
+
+                for ( details::retired_vector::iterator it = src.begin(); it != itRetiredEnd; ++it )
+                    push_retired( pThis, *it );
+                nAdopted += itRetiredEnd - src.begin();
+
+                // TSan: write src.m_nSize, see a comment above
+                CDS_TSAN_ANNOTATE_IGNORE_WRITES_BEGIN;
+                src.clear();
+                CDS_TSAN_ANNOTATE_IGNORE_WRITES_END;
+
+                release_record( herec, true );
+
+                Scan( pThis );
+            }
+            m_Telemetry.on_help_scan( nAdopted );
+        }
+
+        GarbageCollector::InternalState& GarbageCollector::getInternalState( GarbageCollector::InternalState& stat) const
+        {
+            stat.nHECount                = m_nHazardEraCount;
+            stat.nMaxThreadCount         = m_nMaxThreadCount;
+            stat.nInitRetiredPtrCount    = m_nInitRetiredPtrCount;
+            stat.nEraAdvanceFreq         = m_nEraAdvanceFreq;
+            stat.nCurrentEra             = m_nEraClock.load( atomics::memory_order_relaxed );
+
+            stat.nHERecAllocated         =
+                stat.nHERecUsed              =
+                stat.nTotalRetiredPtrCount   =
+                stat.nRetiredPtrInFreeHERecs = 0;
+
+            for ( helist_node * herec = m_pListHead.load(atomics::memory_order_acquire); herec; herec = herec->m_pNextNode ) {
+                ++stat.nHERecAllocated;
+                stat.nTotalRetiredPtrCount += herec->m_arrRetired.size();
+
+                if ( herec->m_bFree.load(atomics::memory_order_relaxed) ) {
+                    // Free HE record
+                    stat.nRetiredPtrInFreeHERecs += herec->m_arrRetired.size();
+                }
+                else {
+                    // Used HE record
+                    ++stat.nHERecUsed;
+                }
+            }
+
+            // Events
+            stat.evcAllocHERec   = m_Stat.m_AllocHERec;
+            stat.evcRetireHERec  = m_Stat.m_RetireHERec;
+            stat.evcAllocNewHERec= m_Stat.m_AllocNewHERec;
+            stat.evcDeleteHERec  = m_Stat.m_DeleteHERec;
+
+            stat.evcScanCall     = m_Stat.m_ScanCallCount;
+            stat.evcHelpScanCall = m_Stat.m_HelpScanCallCount;
+            stat.evcScanFromHelpScan= m_Stat.m_CallScanFromHelpScan;
+            stat.evcRetiredGrow  = m_Stat.m_RetiredGrow;
+
+            stat.evcDeletedNode  = m_Stat.m_DeletedNode;
+            stat.evcDeferredNode = m_Stat.m_DeferredNode;
+
+            return stat;
+        }
+
+        telemetry::snapshot& GarbageCollector::get_telemetry( telemetry::snapshot& s ) const
+        {
+            s.clear();
+            m_Telemetry.get( s );
+
+            for ( helist_node * herec = m_pListHead.load( atomics::memory_order_acquire ); herec; herec = herec->m_pNextNode ) {
+                // TSan: the retired array of other thread is read without synchronization,
+                // the telemetry snapshot is not atomic by design
+                CDS_TSAN_ANNOTATE_IGNORE_READS_BEGIN;
+                size_t const nRetired = herec->m_arrRetired.size();
+                CDS_TSAN_ANNOTATE_IGNORE_READS_END;
+                s.nRetiredBacklog += nRetired;
+                if ( !herec->m_bFree.load( atomics::memory_order_relaxed )) {
+                    telemetry::thread_stat ts;
+                    ts.idOwner = herec->m_idOwner.load( atomics::memory_order_relaxed );
+                    ts.nRetiredCount = nRetired;
+                    s.threads.push_back( ts );
+                }
+            }
+            return s;
+        }
+
+    } //namespace he
+}} // namespace cds::gc
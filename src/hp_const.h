@@ -53,6 +53,32 @@ namespace cds { namespace gc {
         static const size_t c_nHazardPointerPerThread = 8;
     } // namespace hp
 
+    //---------------------------------------------------------------
+    // Hazard Eras reclamation schema constants
+    namespace he {
+        // Max number of threads expected
+        static const size_t c_nMaxThreadCount     = 100;
+
+        // Number of hazard era guards per thread
+        static const size_t c_nHazardEraPerThread = 8;
+
+        // Count of retired pointers per thread between global era increments
+        static const size_t c_nEraAdvanceFreq     = 64;
+    } // namespace he
+
+    //---------------------------------------------------------------
+    // Epoch-based reclamation schema constants
+    namespace ebr {
+        // Max number of threads expected
+        static const size_t c_nMaxThreadCount     = 100;
+
+        // Number of epoch guards per thread
+        static const size_t c_nGuardPerThread     = 16;
+
+        // Count of retired pointers per thread between global epoch advance attempts
+        static const size_t c_nEpochAdvanceFreq   = 64;
+    } // namespace ebr
+
 } /* namespace gc */ }    /* namespace cds */
 
 #endif    // #ifndef CDSIMPL_HP_CONST_H
@@ -40,6 +40,7 @@
 #include <cds/gc/details/hp.h>
 
 #include <algorithm>    // std::sort
+#include <cds/algo/int_algo.h>
 #include "hp_const.h"
 
 #define    CDS_HAZARDPTR_STATISTIC( _x )    if ( m_bStatEnabled ) { _x; }
@@ -50,6 +51,52 @@ namespace cds { namespace gc {
         /// Max array size of retired pointers
         static const size_t c_nMaxRetireNodeCount = c_nHazardPointerPerThread * c_nMaxThreadCount * 2;
 
+        namespace details {
+
+            void hp_snapshot::grow()
+            {
+                // HP record count exceeds max thread count
+                size_t const nNewCapacity = m_nCapacity * 2;
+                void ** pNew = allocator_impl().NewArray( nNewCapacity );
+                std::copy( m_arr, m_arr + m_nSize, pNew );
+                allocator_impl().Delete( m_arr, m_nCapacity );
+                m_arr = pNew;
+                m_nCapacity = nNewCapacity;
+            }
+
+            void hp_snapshot::sort()
+            {
+                std::sort( begin(), end() );
+            }
+
+            bool hp_snapshot::binary_search( void * p ) const
+            {
+                return std::binary_search( m_arr, m_arr + m_nSize, p );
+            }
+
+            void hp_snapshot::build_hash()
+            {
+                // Load factor is no more than 0.5
+                size_t const nHashSize = cds::beans::ceil2( m_nSize * 2 < 16 ? 16 : m_nSize * 2 );
+                if ( nHashSize > m_nHashCapacity ) {
+                    if ( m_pHash )
+                        allocator_impl().Delete( m_pHash, m_nHashCapacity );
+                    size_t const nCapacity = cds::beans::ceil2( m_nCapacity * 2 ) > nHashSize ? cds::beans::ceil2( m_nCapacity * 2 ) : nHashSize;
+                    m_pHash = allocator_impl().NewArray( nCapacity );
+                    m_nHashCapacity = nCapacity;
+                }
+                m_nHashMask = nHashSize - 1;
+                std::fill( m_pHash, m_pHash + nHashSize, nullptr );
+
+                for ( iterator it = begin(), itEnd = end(); it != itEnd; ++it ) {
+                    size_t i = hash( *it ) & m_nHashMask;
+                    while ( m_pHash[i] != nullptr && m_pHash[i] != *it )
+                        i = ( i + 1 ) & m_nHashMask;
+                    m_pHash[i] = *it;
+                }
+            }
+        } // namespace details
+
         GarbageCollector *    GarbageCollector::m_pHZPManager = nullptr;
 
         void CDS_STDCALL GarbageCollector::Construct( size_t nHazardPtrCount, size_t nMaxThreadCount, size_t nMaxRetiredPtrCount, scan_type nScanType )
@@ -77,11 +124,14 @@ namespace cds { namespace gc {
             scan_type nScanType
         )
             : m_pListHead( nullptr )
+            ,m_pOrphanList( nullptr )
+            ,m_nOrphanCount( 0 )
             ,m_bStatEnabled( false )
             ,m_nHazardPointerCount( nHazardPtrCount == 0 ? c_nHazardPointerPerThread : nHazardPtrCount )
             ,m_nMaxThreadCount( nMaxThreadCount == 0 ? c_nMaxThreadCount : nMaxThreadCount )
             ,m_nMaxRetiredPtrCount( nMaxRetiredPtrCount > c_nMaxRetireNodeCount ? nMaxRetiredPtrCount : c_nMaxRetireNodeCount )
             ,m_nScanType( nScanType )
+            ,m_nSpillThreshold( 0 )
         {}
 
         GarbageCollector::~GarbageCollector()
@@ -110,6 +160,17 @@ namespace cds { namespace gc {
                 hprec->m_bFree.store( true, atomics::memory_order_relaxed );
                 DeleteHPRec( hprec );
             }
+
+            // Free orphaned retired pointers
+            details::retired_batch * pBatch = m_pOrphanList.exchange( nullptr, atomics::memory_order_acquire );
+            while ( pBatch ) {
+                for ( details::retired_batch::iterator it = pBatch->begin(), itEnd = pBatch->end(); it != itEnd; ++it )
+                    it->free();
+                details::retired_batch * pNextBatch = pBatch->m_pNext;
+                delete pBatch;
+                pBatch = pNextBatch;
+            }
+            m_nOrphanCount.store( 0, atomics::memory_order_relaxed );
         }
 
         inline GarbageCollector::hplist_node * GarbageCollector::NewHPRec()
@@ -139,6 +200,7 @@ namespace cds { namespace gc {
                 if ( !hprec->m_idOwner.compare_exchange_strong( thId, curThreadId, atomics::memory_order_seq_cst, atomics::memory_order_relaxed ) )
                     continue;
                 hprec->m_bFree.store( false, atomics::memory_order_release );
+                prealloc_batch( hprec );
                 return hprec;
             }
 
@@ -147,6 +209,7 @@ namespace cds { namespace gc {
             hprec = NewHPRec();
             hprec->m_idOwner.store( curThreadId, atomics::memory_order_release );
             hprec->m_bFree.store( false, atomics::memory_order_release );
+            prealloc_batch( hprec );
 
             hplist_node * pOldHead = m_pListHead.load( atomics::memory_order_acquire );
             do {
@@ -180,56 +243,202 @@ namespace cds { namespace gc {
             }
         }
 
-        void GarbageCollector::classic_scan( details::hp_record * pRec )
+        void GarbageCollector::make_snapshot( details::hp_record * pRec )
         {
-            CDS_HAZARDPTR_STATISTIC( ++m_Stat.m_ScanCallCount )
-
-            std::vector< void * >   plist;
-            plist.reserve( m_nMaxThreadCount * m_nHazardPointerCount );
-            assert( plist.size() == 0 );
-
-            // Stage 1: Scan HP list and insert non-null values in plist
+            // Scan HP list and insert non-null values in the thread's snapshot
+            details::hp_snapshot& snapshot = pRec->m_Snapshot;
+            snapshot.clear();
 
-            hplist_node * pNode = m_pListHead.load(atomics::memory_order_acquire);
-
-            while ( pNode ) {
+            for ( hplist_node * pNode = m_pListHead.load(atomics::memory_order_acquire); pNode; pNode = pNode->m_pNextNode ) {
                 for ( size_t i = 0; i < m_nHazardPointerCount; ++i ) {
                     pRec->sync();
                     void * hptr = pNode->m_hzp[i];
                     if ( hptr )
-                        plist.push_back( hptr );
+                        snapshot.push( hptr );
+                }
+            }
+        }
+
+        void GarbageCollector::push_orphans( details::retired_batch * pFirst, details::retired_batch * pLast, size_t nCount )
+        {
+            assert( pFirst != nullptr );
+            assert( pLast != nullptr );
+
+            m_nOrphanCount.fetch_add( nCount, atomics::memory_order_relaxed );
+
+            // The orphan list is popped only entirely by exchange() so ABA problem is impossible
+            details::retired_batch * pHead = m_pOrphanList.load( atomics::memory_order_relaxed );
+            do {
+                pLast->m_pNext = pHead;
+            } while ( !m_pOrphanList.compare_exchange_weak( pHead, pFirst, atomics::memory_order_release, atomics::memory_order_relaxed ));
+        }
+
+        void GarbageCollector::prealloc_batch( details::hp_record * pRec )
+        {
+            // The spare batch is allocated here, out of retire() hot path
+            if ( m_nSpillThreshold.load( atomics::memory_order_relaxed ) && !pRec->m_pSpareBatch )
+                pRec->m_pSpareBatch = new details::retired_batch( m_nMaxRetiredPtrCount );
+        }
+
+        bool GarbageCollector::spill( details::hp_record * pRec )
+        {
+            details::retired_vector& arrRetired = pRec->m_arrRetired;
+            size_t const nCount = arrRetired.size();
+            if ( nCount == 0 )
+                return false;
+
+            // Use the spare batch of pRec; the allocation is needed only if the spare batch is in the orphan list yet
+            details::retired_batch * pBatch = pRec->m_pSpareBatch;
+            if ( pBatch )
+                pRec->m_pSpareBatch = nullptr;
+            else
+                pBatch = new details::retired_batch( m_nMaxRetiredPtrCount );
+            pBatch->assign( arrRetired );
+            push_orphans( pBatch, pBatch, nCount );
+
+            CDS_HAZARDPTR_STATISTIC( ++m_Stat.m_SpilledBatch )
+            CDS_HAZARDPTR_STATISTIC( m_Stat.m_SpilledNode += nCount )
+            return true;
+        }
+
+        void GarbageCollector::reclaim_orphans( details::hp_record * pRec )
+        {
+            if ( m_pOrphanList.load( atomics::memory_order_relaxed ) == nullptr )
+                return;
+
+            // Take the whole list; concurrent reclaimers see an empty list and return
+            details::retired_batch * pList = m_pOrphanList.exchange( nullptr, atomics::memory_order_acquire );
+            if ( !pList )
+                return;
+
+            CDS_HAZARDPTR_STATISTIC( ++m_Stat.m_ReclaimOrphanCall )
+
+            make_snapshot( pRec );
+            details::hp_snapshot& snapshot = pRec->m_Snapshot;
+            snapshot.sort();
+
+            // Batches that should be returned to the orphan list
+            details::retired_batch * pKeepFirst = nullptr;
+            details::retired_batch * pKeepLast = nullptr;
+            size_t nChecked = 0;
+
+            while ( pList && nChecked < m_nMaxRetiredPtrCount ) {
+                details::retired_batch * pBatch = pList;
+                pList = pList->m_pNext;
+
+                details::retired_batch::iterator itRetired    = pBatch->begin();
+                details::retired_batch::iterator itRetiredEnd = pBatch->end();
+                details::retired_batch::iterator itInsert     = itRetired;
+                for ( details::retired_batch::iterator it = itRetired; it != itRetiredEnd; ++it ) {
+                    if ( snapshot.binary_search( it->m_p )) {
+                        if ( itInsert != it )
+                            *itInsert = *it;
+                        ++itInsert;
+                    }
+                    else
+                        it->free();
+                }
+
+                size_t const nCount = itRetiredEnd - itRetired;
+                size_t const nDeferred = itInsert - itRetired;
+                nChecked += nCount;
+                m_nOrphanCount.fetch_sub( nCount - nDeferred, atomics::memory_order_relaxed );
+                m_Telemetry.on_free( nCount - nDeferred );
+                CDS_HAZARDPTR_STATISTIC( m_Stat.m_DeferredNode += nDeferred )
+                CDS_HAZARDPTR_STATISTIC( m_Stat.m_DeletedNode += nCount - nDeferred )
+
+                if ( nDeferred ) {
+                    pBatch->size( nDeferred );
+                    pBatch->m_pNext = pKeepFirst;
+                    if ( !pKeepFirst )
+                        pKeepLast = pBatch;
+                    pKeepFirst = pBatch;
+                }
+                else if ( !pRec->m_pSpareBatch ) {
+                    // Keep the empty batch for the next spill of pRec
+                    pBatch->size( 0 );
+                    pRec->m_pSpareBatch = pBatch;
                 }
-                pNode = pNode->m_pNextNode;
+                else
+                    delete pBatch;
+            }
+
+            // Return unchecked batches to the orphan list
+            if ( pList ) {
+                if ( pKeepLast )
+                    pKeepLast->m_pNext = pList;
+                else
+                    pKeepFirst = pList;
+                pKeepLast = pList;
+                while ( pKeepLast->m_pNext )
+                    pKeepLast = pKeepLast->m_pNext;
+            }
+            if ( pKeepFirst ) {
+                // The pointers returned are already counted in m_nOrphanCount
+                push_orphans( pKeepFirst, pKeepLast, 0 );
             }
+        }
 
-            // Sort plist to simplify search in
-            std::sort( plist.begin(), plist.end() );
+        void GarbageCollector::classic_scan( details::hp_record * pRec )
+        {
+            CDS_HAZARDPTR_STATISTIC( ++m_Stat.m_ScanCallCount )
 
-            // Stage 2: Search plist
+            // Stage 1: make the snapshot of hazard pointers
+            make_snapshot( pRec );
+
+            // Sort the snapshot to simplify search in
+            details::hp_snapshot& snapshot = pRec->m_Snapshot;
+            snapshot.sort();
+
+            // Stage 2: Search the snapshot
             details::retired_vector& arrRetired = pRec->m_arrRetired;
 
             details::retired_vector::iterator itRetired     = arrRetired.begin();
             details::retired_vector::iterator itRetiredEnd  = arrRetired.end();
-            // arrRetired is not a std::vector!
-            // clear() is just set up item counter to 0, the items is not destroyed
-            arrRetired.clear();
+            details::retired_vector::iterator itInsert      = itRetired;
+            for ( details::retired_vector::iterator it = itRetired; it != itRetiredEnd; ++it ) {
+                if ( snapshot.binary_search( it->m_p ) ) {
+                    if ( itInsert != it )
+                        *itInsert = *it;
+                    ++itInsert;
+                }
+                else
+                    it->free();
+            }
+            const size_t nDeferred = itInsert - itRetired;
+            arrRetired.size( nDeferred );
+            CDS_HAZARDPTR_STATISTIC( m_Stat.m_DeferredNode += nDeferred )
+            CDS_HAZARDPTR_STATISTIC( m_Stat.m_DeletedNode += (itRetiredEnd - itRetired) - nDeferred )
+        }
 
-            {
-                std::vector< void * >::iterator itBegin = plist.begin();
-                std::vector< void * >::iterator itEnd = plist.end();
-                size_t nDeferredCount = 0;
-                while ( itRetired != itRetiredEnd ) {
-                    if ( std::binary_search( itBegin, itEnd, itRetired->m_p ) ) {
-                        arrRetired.push( *itRetired );
-                        ++nDeferredCount;
-                    }
-                    else
-                        itRetired->free();
-                    ++itRetired;
+        void GarbageCollector::hashed_scan( details::hp_record * pRec )
+        {
+            CDS_HAZARDPTR_STATISTIC( ++m_Stat.m_ScanCallCount )
+
+            // Stage 1: make the snapshot of hazard pointers and build the hash set over it
+            make_snapshot( pRec );
+            details::hp_snapshot& snapshot = pRec->m_Snapshot;
+            snapshot.build_hash();
+
+            // Stage 2: check each retired pointer in the hash set
+            details::retired_vector& arrRetired = pRec->m_arrRetired;
+
+            details::retired_vector::iterator itRetired     = arrRetired.begin();
+            details::retired_vector::iterator itRetiredEnd  = arrRetired.end();
+            details::retired_vector::iterator itInsert      = itRetired;
+            for ( details::retired_vector::iterator it = itRetired; it != itRetiredEnd; ++it ) {
+                if ( snapshot.hash_contains( it->m_p ) ) {
+                    if ( itInsert != it )
+                        *itInsert = *it;
+                    ++itInsert;
                 }
-                CDS_HAZARDPTR_STATISTIC( m_Stat.m_DeferredNode += nDeferredCount )
-                CDS_HAZARDPTR_STATISTIC( m_Stat.m_DeletedNode += (itRetiredEnd - arrRetired.begin()) - nDeferredCount )
+                else
+                    it->free();
             }
+            const size_t nDeferred = itInsert - itRetired;
+            arrRetired.size( nDeferred );
+            CDS_HAZARDPTR_STATISTIC( m_Stat.m_DeferredNode += nDeferred )
+            CDS_HAZARDPTR_STATISTIC( m_Stat.m_DeletedNode += (itRetiredEnd - itRetired) - nDeferred )
         }
 
         void GarbageCollector::inplace_scan( details::hp_record * pRec )
@@ -314,7 +523,7 @@ namespace cds { namespace gc {
             }
         }
 
-        void GarbageCollector::HelpScan( details::hp_record * pThis )
+        bool GarbageCollector::HelpScan( details::hp_record * pThis )
         {
             CDS_HAZARDPTR_STATISTIC( ++m_Stat.m_HelpScanCallCount )
 
@@ -322,6 +531,9 @@ namespace cds { namespace gc {
 
             const cds::OS::ThreadId nullThreadId = cds::OS::c_NullThreadId;
             const cds::OS::ThreadId curThreadId = cds::OS::get_current_thread_id();
+            size_t const nSpillThreshold = m_nSpillThreshold.load( atomics::memory_order_relaxed );
+            size_t nAdopted = 0;
+            bool bSpilled = false;
             for ( hplist_node * hprec = m_pListHead.load(atomics::memory_order_acquire); hprec; hprec = hprec->m_pNextNode ) {
 
                 // If m_bFree == true then hprec->m_arrRetired is empty - we don't need to see it
@@ -348,6 +560,20 @@ namespace cds { namespace gc {
                 details::retired_vector& src = hprec->m_arrRetired;
                 details::retired_vector& dest = pThis->m_arrRetired;
                 assert( !dest.isFull());
+
+                if ( nSpillThreshold ) {
+                    // Overflow mode: spill retired pointers of hprec to the orphan list instead of scanning them
+                    CDS_TSAN_ANNOTATE_IGNORE_RW_BEGIN;
+                    nAdopted += src.size();
+                    if ( spill( hprec ))
+                        bSpilled = true;
+                    CDS_TSAN_ANNOTATE_IGNORE_RW_END;
+
+                    hprec->m_bFree.store( true, atomics::memory_order_release );
+                    hprec->m_idOwner.store( nullThreadId, atomics::memory_order_release );
+                    continue;
+                }
+
                 details::retired_vector::iterator itRetired = src.begin();
 
                 // TSan can issue a warning here:
@@ -357,12 +583,14 @@ namespace cds { namespace gc {
                 CDS_TSAN_ANNOTATE_IGNORE_READS_BEGIN;
                 details::retired_vector::iterator itRetiredEnd = src.end();
                 CDS_TSAN_ANNOTATE_IGNORE_READS_END;
+                nAdopted += itRetiredEnd - itRetired;
 
                 while ( itRetired != itRetiredEnd ) {
                     dest.push( *itRetired );
                     if ( dest.isFull()) {
                         CDS_HAZARDPTR_STATISTIC( ++m_Stat.m_CallScanFromHelpScan )
-                        Scan( pThis );
+                        if ( Scan( pThis ))
+                            bSpilled = true;
                     }
                     ++itRetired;
                 }
@@ -375,8 +603,12 @@ namespace cds { namespace gc {
                 hprec->m_bFree.store(true, atomics::memory_order_release);
                 hprec->m_idOwner.store( nullThreadId, atomics::memory_order_release );
 
-                Scan( pThis );
+                if ( Scan( pThis ))
+                    bSpilled = true;
             }
+
+            m_Telemetry.on_help_scan( nAdopted );
+            return bSpilled;
         }
 
         GarbageCollector::InternalState& GarbageCollector::getInternalState( GarbageCollector::InternalState& stat) const
@@ -419,9 +651,37 @@ namespace cds { namespace gc {
             stat.evcDeletedNode  = m_Stat.m_DeletedNode;
             stat.evcDeferredNode = m_Stat.m_DeferredNode;
 
+            stat.nOrphanRetiredCount  = m_nOrphanCount.load( atomics::memory_order_relaxed );
+            stat.evcSpilledBatch      = m_Stat.m_SpilledBatch;
+            stat.evcSpilledNode       = m_Stat.m_SpilledNode;
+            stat.evcReclaimOrphanCall = m_Stat.m_ReclaimOrphanCall;
+
             return stat;
         }
 
+        telemetry::snapshot& GarbageCollector::get_telemetry( telemetry::snapshot& s ) const
+        {
+            s.clear();
+            m_Telemetry.get( s );
+
+            s.nRetiredBacklog = m_nOrphanCount.load( atomics::memory_order_relaxed );
+            for ( hplist_node * hprec = m_pListHead.load( atomics::memory_order_acquire ); hprec; hprec = hprec->m_pNextNode ) {
+                // TSan: the retired array of other thread is read without synchronization,
+                // the telemetry snapshot is not atomic by design
+                CDS_TSAN_ANNOTATE_IGNORE_READS_BEGIN;
+                size_t const nRetired = hprec->m_arrRetired.size();
+                CDS_TSAN_ANNOTATE_IGNORE_READS_END;
+                s.nRetiredBacklog += nRetired;
+                if ( !hprec->m_bFree.load( atomics::memory_order_relaxed )) {
+                    telemetry::thread_stat ts;
+                    ts.idOwner = hprec->m_idOwner.load( atomics::memory_order_relaxed );
+                    ts.nRetiredCount = nRetired;
+                    s.threads.push_back( ts );
+                }
+            }
+            return s;
+        }
+
 
     } //namespace hp
 }} // namespace cds::gc
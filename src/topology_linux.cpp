@@ -33,11 +33,185 @@
 #if CDS_OS_TYPE == CDS_OS_LINUX
 
 #include <unistd.h>
+#include <sys/syscall.h>
 #include <fstream>
+#include <cstdio>
+#include <cstdlib>
 
 namespace cds { namespace OS { CDS_CXX11_INLINE_NAMESPACE namespace Linux {
 
     unsigned int topology::s_nProcessorCount = 0;
+    unsigned int topology::s_nNumaNodeCount = 1;
+    size_t topology::s_nProcMapSize = 0;
+    topology::processor_map * topology::s_procMap = nullptr;
+    unsigned int * topology::s_arrOnlineNodes = nullptr;
+    unsigned int topology::s_nOnlineNodeCount = 1;
+
+    namespace {
+        // Reads first line of sysfs file
+        bool read_sys_file( char const * pszPath, char * pBuf, size_t nSize )
+        {
+            FILE * f = ::fopen( pszPath, "r" );
+            if ( !f )
+                return false;
+            bool bOk = ::fgets( pBuf, static_cast<int>( nSize ), f ) != nullptr;
+            ::fclose( f );
+            return bOk;
+        }
+
+        bool read_sys_uint( char const * pszPath, unsigned int& nValue )
+        {
+            char buf[32];
+            if ( !read_sys_file( pszPath, buf, sizeof( buf )))
+                return false;
+            char * pEnd;
+            long n = ::strtol( buf, &pEnd, 10 );
+            if ( pEnd == buf || n < 0 )
+                return false;
+            nValue = static_cast<unsigned int>( n );
+            return true;
+        }
+
+        // Parses sysfs list like "0-3,8-11" and calls f( id ) for each id in the list
+        template <typename Func>
+        bool parse_sys_list( char const * pszPath, Func f )
+        {
+            char buf[4096];
+            if ( !read_sys_file( pszPath, buf, sizeof( buf )))
+                return false;
+
+            char const * p = buf;
+            while ( *p >= '0' && *p <= '9' ) {
+                char * pEnd;
+                unsigned long nFirst = ::strtoul( p, &pEnd, 10 );
+                unsigned long nLast = nFirst;
+                p = pEnd;
+                if ( *p == '-' ) {
+                    nLast = ::strtoul( p + 1, &pEnd, 10 );
+                    p = pEnd;
+                }
+                for ( unsigned long i = nFirst; i <= nLast; ++i )
+                    f( static_cast<unsigned int>( i ));
+                if ( *p == ',' )
+                    ++p;
+            }
+            return true;
+        }
+    } // namespace
+
+    void topology::make_processor_map()
+    {
+        // Processor map covers all possible processors, not only online
+        unsigned int nMaxProcNo = s_nProcessorCount ? s_nProcessorCount - 1 : 0;
+        parse_sys_list( "/sys/devices/system/cpu/possible", [&nMaxProcNo]( unsigned int nProc ) {
+            if ( nMaxProcNo < nProc )
+                nMaxProcNo = nProc;
+        });
+
+        // We cannot use operator new or std::allocator in this code
+        // since the initialization phase may be called from
+        // our overloaded operator new that based on cds::michael::Heap
+        size_t const nMapSize = nMaxProcNo + 1;
+        processor_map * pMap = reinterpret_cast<processor_map *>( ::malloc( sizeof( pMap[0] ) * nMapSize ));
+        if ( !pMap )
+            return;
+
+        char szPath[128];
+        for ( unsigned int i = 0; i < nMapSize; ++i ) {
+            processor_map& proc = pMap[i];
+            proc.nNode = 0;
+
+            ::snprintf( szPath, sizeof( szPath ), "/sys/devices/system/cpu/cpu%u/topology/core_id", i );
+            if ( !read_sys_uint( szPath, proc.nCore ))
+                proc.nCore = i;
+
+            ::snprintf( szPath, sizeof( szPath ), "/sys/devices/system/cpu/cpu%u/topology/physical_package_id", i );
+            if ( !read_sys_uint( szPath, proc.nPackage ))
+                proc.nPackage = 0;
+        }
+
+        // NUMA nodes may be sparse, the node count is max node id + 1
+        unsigned int nNodeCount = 1;
+        unsigned int nOnlineCount = 0;
+        parse_sys_list( "/sys/devices/system/node/online", [&]( unsigned int nNode ) {
+            if ( nNodeCount <= nNode )
+                nNodeCount = nNode + 1;
+            ++nOnlineCount;
+
+            char szNodePath[128];
+            ::snprintf( szNodePath, sizeof( szNodePath ), "/sys/devices/system/node/node%u/cpulist", nNode );
+            parse_sys_list( szNodePath, [pMap, nMapSize, nNode]( unsigned int nProc ) {
+                if ( nProc < nMapSize )
+                    pMap[ nProc ].nNode = nNode;
+            });
+        });
+
+        s_nNumaNodeCount = nNodeCount;
+        s_nProcMapSize = nMapSize;
+        s_procMap = pMap;
+
+        // The list of online nodes, the ids are in ascending order in sysfs
+        if ( nOnlineCount ) {
+            unsigned int * pNodes = reinterpret_cast<unsigned int *>( ::malloc( sizeof( pNodes[0] ) * nOnlineCount ));
+            if ( pNodes ) {
+                unsigned int nIdx = 0;
+                parse_sys_list( "/sys/devices/system/node/online", [pNodes, nOnlineCount, &nIdx]( unsigned int nNode ) {
+                    if ( nIdx < nOnlineCount )
+                        pNodes[ nIdx++ ] = nNode;
+                });
+                if ( nIdx ) {
+                    s_arrOnlineNodes = pNodes;
+                    s_nOnlineNodeCount = nIdx;
+                }
+                else
+                    ::free( pNodes );
+            }
+        }
+    }
+
+    namespace {
+        // Memory policy mode from <linux/mempolicy.h>, libnuma is not required
+        static int const c_nMPolPreferred = 1;
+    }
+
+    bool topology::set_numa_preferred_node( unsigned int nNode )
+    {
+#   ifdef SYS_set_mempolicy
+        unsigned long arrMask[ c_nMaxNumaNodeCount / ( sizeof( unsigned long ) * 8 ) ] = { 0 };
+        unsigned int const nBits = sizeof( arrMask[0] ) * 8;
+        if ( nNode >= c_nMaxNumaNodeCount )
+            return false;
+        arrMask[ nNode / nBits ] = 1UL << ( nNode % nBits );
+
+        // The kernel decrements maxnode, so the mask size + 1 is passed
+        return ::syscall( SYS_set_mempolicy, c_nMPolPreferred, arrMask, static_cast<unsigned long>( c_nMaxNumaNodeCount + 1 )) == 0;
+#   else
+        CDS_UNUSED( nNode );
+        return false;
+#   endif
+    }
+
+    bool topology::get_numa_memory_policy( numa_memory_policy& policy )
+    {
+#   ifdef SYS_get_mempolicy
+        // The mode returned includes the mode flags (MPOL_F_STATIC_NODES, MPOL_F_RELATIVE_NODES),
+        // the node mask is the mask passed by the owner of the policy, so set_mempolicy() accepts them back
+        return ::syscall( SYS_get_mempolicy, &policy.nMode, policy.arrNodeMask,
+            static_cast<unsigned long>( c_nMaxNumaNodeCount ), nullptr, 0UL ) == 0;
+#   else
+        CDS_UNUSED( policy );
+        return false;
+#   endif
+    }
+
+    void topology::set_numa_memory_policy( numa_memory_policy const& policy )
+    {
+#   ifdef SYS_set_mempolicy
+        ::syscall( SYS_set_mempolicy, policy.nMode, policy.arrNodeMask, static_cast<unsigned long>( c_nMaxNumaNodeCount + 1 ));
+#   else
+        CDS_UNUSED( policy );
+#   endif
+    }
 
     void topology::init()
     {
@@ -64,10 +238,25 @@ namespace cds { namespace OS { CDS_CXX11_INLINE_NAMESPACE namespace Linux {
                 s_nProcessorCount = 1;
             }
          }
+
+         assert( s_procMap == nullptr );
+         make_processor_map();
     }
 
     void topology::fini()
-    {}
+    {
+        if ( s_procMap ) {
+            ::free( s_procMap );
+            s_procMap = nullptr;
+        }
+        s_nProcMapSize = 0;
+        s_nNumaNodeCount = 1;
+        if ( s_arrOnlineNodes ) {
+            ::free( s_arrOnlineNodes );
+            s_arrOnlineNodes = nullptr;
+        }
+        s_nOnlineNodeCount = 1;
+    }
 }}} // namespace cds::OS::Linux
 
 #endif  // #if CDS_OS_TYPE == CDS_OS_LINUX
@@ -57,6 +57,8 @@
 #include <cds/init.h>
 #include <cds/gc/hp.h>
 #include <cds/gc/dhp.h>
+#include <cds/gc/he.h>
+#include <cds/gc/ebr.h>
 #include <cds/urcu/general_instant.h>
 #include <cds/urcu/general_buffered.h>
 #include <cds/urcu/general_threaded.h>
@@ -96,6 +98,10 @@ std::ostream& operator << (std::ostream& s, const cds::gc::hp::GarbageCollector:
         << "\n\t       Scan calls from HelpScan=" << stat.evcScanFromHelpScan
         << "\n\t       retired object deleting=" << stat.evcDeletedNode
         << "\n\t        guarded object on Scan=" << stat.evcDeferredNode
+        << "\n\t     retired ptr in orphan list=" << stat.nOrphanRetiredCount
+        << "\n\t          spilled retired batch=" << stat.evcSpilledBatch
+        << "\n\t            spilled retired ptr=" << stat.evcSpilledNode
+        << "\n\t           reclaim orphan calls=" << stat.evcReclaimOrphanCall
         << std::endl;
 
     return s;
@@ -411,6 +417,8 @@ int main(int argc, char** argv)
       size_t dhp_liberateThreshold;
       size_t dhp_initialThreadGuardCount;
       size_t dhp_epochCount;
+      bool   dhp_backgroundReclaim;
+      size_t dhp_backpressureThreshold;
       {
         CppUnitMini::TestCfg& cfg = CppUnitMini::TestCase::m_Cfg.get( "General" );
         nHazardPtrCount = cfg.getULong( "hazard_pointer_count", 0 );
@@ -418,11 +426,15 @@ int main(int argc, char** argv)
         dhp_liberateThreshold = cfg.getSizeT( "dhp_liberate_threshold", 1024 );
         dhp_initialThreadGuardCount = cfg.getSizeT( "dhp_init_guard_count", 8 );
         dhp_epochCount = cfg.getSizeT( "dhp_epoch_count", 16 );
+        dhp_backgroundReclaim = cfg.getBool( "dhp_background_reclaim", false );
+        dhp_backpressureThreshold = cfg.getSizeT( "dhp_backpressure_threshold", 0 );
       }
 
       // Safe reclamation schemes
       cds::gc::HP hzpGC( nHazardPtrCount );
-      cds::gc::DHP dhpGC( dhp_liberateThreshold, dhp_initialThreadGuardCount, dhp_epochCount );
+      cds::gc::DHP dhpGC( dhp_liberateThreshold, dhp_initialThreadGuardCount, dhp_epochCount, dhp_backgroundReclaim, dhp_backpressureThreshold );
+      cds::gc::HE heGC( nHazardPtrCount );
+      cds::gc::EBR ebrGC( nHazardPtrCount );
 
       // RCU varieties
       typedef cds::urcu::gc< cds::urcu::general_instant<> >    rcu_gpi;
@@ -457,6 +469,8 @@ int main(int argc, char** argv)
             hzpGC.setScanType( cds::gc::HP::scan_type::inplace );
         else if ( strHZPScanStrategy == "classic" )
             hzpGC.setScanType( cds::gc::HP::scan_type::classic );
+        else if ( strHZPScanStrategy == "hashed" )
+            hzpGC.setScanType( cds::gc::HP::scan_type::hashed );
         else {
             std::cout << "Error value of HZP_scan_strategy in General section of test config\n";
         }
@@ -468,14 +482,20 @@ int main(int argc, char** argv)
         case cds::gc::HP::scan_type::classic:
             std::cout << "Use classic scan strategy for Hazard Pointer memory reclamation algorithm\n";
             break;
+        case cds::gc::HP::scan_type::hashed:
+            std::cout << "Use hashed scan strategy for Hazard Pointer memory reclamation algorithm\n";
+            break;
         default:
             std::cout << "ERROR: use unknown scan strategy for Hazard Pointer memory reclamation algorithm\n";
             break;
         }
 
+        hzpGC.setSpillThreshold( cfg.getSizeT( "HZP_spill_threshold", 0 ));
+
         std::cout << "     Hazard Pointer count: " << hzpGC.max_hazard_count() << "\n"
                   << "  Max thread count for HP: " << hzpGC.max_thread_count() << "\n"
-                  << "Retired HP array capacity: " << hzpGC.retired_array_capacity() << "\n";
+                  << "Retired HP array capacity: " << hzpGC.retired_array_capacity() << "\n"
+                  << "       HP spill threshold: " << hzpGC.getSpillThreshold() << "\n";
       }
 
       if ( CppUnitMini::TestCase::m_bPrintGCState ) {
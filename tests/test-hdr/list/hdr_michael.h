@@ -775,6 +775,16 @@ namespace ordlist {
         void DHP_cmpmix();
         void DHP_ic();
 
+        void HE_cmp();
+        void HE_less();
+        void HE_cmpmix();
+        void HE_ic();
+
+        void EBR_cmp();
+        void EBR_less();
+        void EBR_cmpmix();
+        void EBR_ic();
+
         void RCU_GPI_cmp();
         void RCU_GPI_less();
         void RCU_GPI_cmpmix();
@@ -816,6 +826,16 @@ namespace ordlist {
             CPPUNIT_TEST(DHP_cmpmix)
             CPPUNIT_TEST(DHP_ic)
 
+            CPPUNIT_TEST(HE_cmp)
+            CPPUNIT_TEST(HE_less)
+            CPPUNIT_TEST(HE_cmpmix)
+            CPPUNIT_TEST(HE_ic)
+
+            CPPUNIT_TEST(EBR_cmp)
+            CPPUNIT_TEST(EBR_less)
+            CPPUNIT_TEST(EBR_cmpmix)
+            CPPUNIT_TEST(EBR_ic)
+
             CPPUNIT_TEST(RCU_GPI_cmp)
             CPPUNIT_TEST(RCU_GPI_less)
             CPPUNIT_TEST(RCU_GPI_cmpmix)
@@ -0,0 +1,80 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#include "map/hdr_map.h"
+#include <cds/gc/hp.h>
+#include <cds/gc/dhp.h>
+#include <cds/container/block_split_list_map.h>
+
+namespace map {
+
+    namespace {
+        struct map_traits: public cc::block_split_list::traits
+        {
+            typedef HashMapHdrTest::hash_int            hash;
+            typedef HashMapHdrTest::less                less;
+        };
+
+        // Small blocks: the nodes are split and merged often
+        typedef cc::block_split_list::make_traits<
+            co::hash< HashMapHdrTest::hash_int >
+            ,co::compare< HashMapHdrTest::cmp >
+            ,co::item_counter< HashMapHdrTest::simple_item_counter >
+            ,co::stat< cc::block_split_list::stat<> >
+            ,cc::block_split_list::block_capacity< 4 >
+            ,cc::block_split_list::dynamic_bucket_table< false >
+        >::type map_stat_traits;
+    }
+
+    void HashMapHdrTest::BlockSplitList_HP_less()
+    {
+        typedef cc::BlockSplitListMap< cds::gc::HP, key_type, value_type, map_traits > map;
+        test_int_block_split< map >();
+    }
+
+    void HashMapHdrTest::BlockSplitList_HP_cmp_stat()
+    {
+        typedef cc::BlockSplitListMap< cds::gc::HP, key_type, value_type, map_stat_traits > map;
+        test_int_block_split< map >();
+    }
+
+    void HashMapHdrTest::BlockSplitList_DHP_less()
+    {
+        typedef cc::BlockSplitListMap< cds::gc::DHP, key_type, value_type, map_traits > map;
+        test_int_block_split< map >();
+    }
+
+    void HashMapHdrTest::BlockSplitList_DHP_cmp_stat()
+    {
+        typedef cc::BlockSplitListMap< cds::gc::DHP, key_type, value_type, map_stat_traits > map;
+        test_int_block_split< map >();
+    }
+
+} // namespace map
@@ -30,6 +30,7 @@
 
 #include "map/hdr_cuckoo_map.h"
 #include <cds/container/cuckoo_map.h>
+#include <cds/urcu/general_buffered.h>
 
 namespace map {
 
@@ -677,6 +678,104 @@ namespace map {
         }
     }
 
+    void CuckooMapHdrTest::Cuckoo_striped_bucketized()
+    {
+        CPPUNIT_MESSAGE( "equal");
+        {
+            typedef cc::CuckooMap< CuckooMapHdrTest::key_type, CuckooMapHdrTest::value_type,
+                cc::cuckoo::make_traits<
+                    co::mutex_policy< cc::cuckoo::striping<> >
+                    ,co::equal_to< std::equal_to<int> >
+                    ,co::hash< std::tuple< hash1, hash2 > >
+                    ,cc::cuckoo::probeset_type< cc::cuckoo::bucketized<4> >
+                >::type
+            > map_t;
+
+            test_cuckoo<map_t>();
+        }
+
+        CPPUNIT_MESSAGE( "cmp, store hash");
+        {
+            typedef cc::CuckooMap< CuckooMapHdrTest::key_type, CuckooMapHdrTest::value_type,
+                cc::cuckoo::make_traits<
+                    co::mutex_policy< cc::cuckoo::striping<> >
+                    ,co::compare< CuckooMapHdrTest::cmp >
+                    ,cc::cuckoo::store_hash< true >
+                    ,cc::cuckoo::probeset_type< cc::cuckoo::bucketized<> >
+                    ,co::hash< std::tuple< hash1, hash2 > >
+                >::type
+            > map_t;
+
+            test_cuckoo<map_t>();
+        }
+    }
+
+    void CuckooMapHdrTest::Cuckoo_refinable_bucketized()
+    {
+        CPPUNIT_MESSAGE( "equal");
+        {
+            typedef cc::CuckooMap< CuckooMapHdrTest::key_type, CuckooMapHdrTest::value_type,
+                cc::cuckoo::make_traits<
+                    co::mutex_policy< cc::cuckoo::refinable<> >
+                    ,co::equal_to< std::equal_to<int> >
+                    ,co::hash< std::tuple< hash1, hash2 > >
+                    ,cc::cuckoo::probeset_type< cc::cuckoo::bucketized<4> >
+                >::type
+            > map_t;
+
+            test_cuckoo<map_t>();
+        }
+
+        CPPUNIT_MESSAGE( "cmp, store hash");
+        {
+            typedef cc::CuckooMap< CuckooMapHdrTest::key_type, CuckooMapHdrTest::value_type,
+                cc::cuckoo::make_traits<
+                    co::mutex_policy< cc::cuckoo::refinable<> >
+                    ,co::compare< CuckooMapHdrTest::cmp >
+                    ,cc::cuckoo::store_hash< true >
+                    ,cc::cuckoo::probeset_type< cc::cuckoo::bucketized<> >
+                    ,co::hash< std::tuple< hash1, hash2 > >
+                >::type
+            > map_t;
+
+            test_cuckoo<map_t>();
+        }
+    }
+
+    void CuckooMapHdrTest::Cuckoo_optimistic_bucketized()
+    {
+        typedef cds::urcu::gc< cds::urcu::general_buffered<> > rcu_gpb;
+
+        CPPUNIT_MESSAGE( "equal");
+        {
+            typedef cc::CuckooMap< CuckooMapHdrTest::key_type, CuckooMapHdrTest::value_type,
+                cc::cuckoo::make_traits<
+                    co::mutex_policy< cc::cuckoo::optimistic_striping< rcu_gpb > >
+                    ,co::equal_to< std::equal_to<int> >
+                    ,co::hash< std::tuple< hash1, hash2 > >
+                    ,cc::cuckoo::probeset_type< cc::cuckoo::bucketized<4> >
+                >::type
+            > map_t;
+
+            test_cuckoo<map_t>();
+        }
+
+        CPPUNIT_MESSAGE( "cmp, store hash");
+        {
+            typedef cc::CuckooMap< CuckooMapHdrTest::key_type, CuckooMapHdrTest::value_type,
+                cc::cuckoo::make_traits<
+                    co::mutex_policy< cc::cuckoo::optimistic_striping< rcu_gpb, cds::sync::reentrant_spin, 2, 1 > >
+                    ,co::compare< CuckooMapHdrTest::cmp >
+                    ,cc::cuckoo::store_hash< true >
+                    ,cc::cuckoo::probeset_type< cc::cuckoo::bucketized<> >
+                    ,co::hash< std::tuple< hash1, hash2 > >
+                >::type
+            > map_t;
+
+            test_cuckoo<map_t>();
+        }
+    }
+
 }   // namespace map
 
 CPPUNIT_TEST_SUITE_REGISTRATION(map::CuckooMapHdrTest);
@@ -405,14 +405,20 @@ namespace map {
 
         void Cuckoo_striped_list();
         void Cuckoo_striped_vector();
+        void Cuckoo_striped_bucketized();
         void Cuckoo_refinable_list();
         void Cuckoo_refinable_vector();
+        void Cuckoo_refinable_bucketized();
+        void Cuckoo_optimistic_bucketized();
 
         CPPUNIT_TEST_SUITE(CuckooMapHdrTest)
             CPPUNIT_TEST(Cuckoo_striped_list)
             CPPUNIT_TEST(Cuckoo_striped_vector)
+            CPPUNIT_TEST(Cuckoo_striped_bucketized)
             CPPUNIT_TEST(Cuckoo_refinable_list)
             CPPUNIT_TEST(Cuckoo_refinable_vector)
+            CPPUNIT_TEST(Cuckoo_refinable_bucketized)
+            CPPUNIT_TEST(Cuckoo_optimistic_bucketized)
         CPPUNIT_TEST_SUITE_END()
 
     };
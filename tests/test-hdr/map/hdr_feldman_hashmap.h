@@ -32,6 +32,7 @@
 #define CDSTEST_HDR_FELDMAN_HASHMAP_H
 
 #include "cppunit/cppunit_proxy.h"
+#include <vector>
 
 // forward declaration
 namespace cds {
@@ -160,6 +161,21 @@ namespace map {
             CPPUNIT_ASSERT(!m.empty());
             CPPUNIT_ASSERT(m.size() == capacity);
 
+            // find_batch()
+            {
+                std::vector<size_t> arrKeys;
+                for ( size_t i = 0; i < capacity * 2; ++i )
+                    arrKeys.push_back( i * 57 );
+                size_t nFound = 0;
+                CPPUNIT_ASSERT( m.find_batch( arrKeys.begin(), arrKeys.end(), [&nFound]( value_type& v ) {
+                    CPPUNIT_ASSERT_CURRENT( v.first % 57 == 0 );
+                    CPPUNIT_ASSERT_CURRENT( v.first / 57 < capacity );
+                    ++nFound;
+                }) == capacity );
+                CPPUNIT_ASSERT( nFound == capacity );
+                CPPUNIT_ASSERT( m.find_batch( arrKeys.begin(), arrKeys.begin(), []( value_type& ) {} ) == 0 );
+            }
+
             // iterator test
             size_t nCount = 0;
             for ( auto it = m.begin(), itEnd = m.end(); it != itEnd; ++it ) {
@@ -436,6 +452,21 @@ namespace map {
             CPPUNIT_ASSERT(!m.empty());
             CPPUNIT_ASSERT(m.size() == capacity);
 
+            // find_batch()
+            {
+                std::vector<size_t> arrKeys;
+                for ( size_t i = 0; i < capacity * 2; ++i )
+                    arrKeys.push_back( i * 57 );
+                size_t nFound = 0;
+                CPPUNIT_ASSERT( m.find_batch( arrKeys.begin(), arrKeys.end(), [&nFound]( value_type& v ) {
+                    CPPUNIT_ASSERT_CURRENT( v.first % 57 == 0 );
+                    CPPUNIT_ASSERT_CURRENT( v.first / 57 < capacity );
+                    ++nFound;
+                }) == capacity );
+                CPPUNIT_ASSERT( nFound == capacity );
+                CPPUNIT_ASSERT( m.find_batch( arrKeys.begin(), arrKeys.begin(), []( value_type& ) {} ) == 0 );
+            }
+
             // iterator test
             size_t nCount = 0;
             {
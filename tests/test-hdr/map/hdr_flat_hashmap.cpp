@@ -0,0 +1,128 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#include "map/hdr_map.h"
+#include <cds/gc/hp.h>
+#include <cds/gc/dhp.h>
+#include <cds/urcu/general_instant.h>
+#include <cds/urcu/general_buffered.h>
+#include <cds/urcu/signal_buffered.h>
+#include <cds/container/flat_hashmap.h>
+
+namespace map {
+    namespace {
+        struct map_traits: public cc::flat_hashmap::traits
+        {
+            typedef HashMapHdrTest::hash_int    hash;
+            typedef cc::flat_hashmap::stat<>    stat;
+        };
+
+        struct hash_const
+        {
+            size_t operator()( int ) const
+            {
+                return 42;
+            }
+        };
+
+        struct collision_traits: public map_traits
+        {
+            typedef hash_const hash;
+        };
+    }
+
+    void HashMapHdrTest::FlatHashMap_HP()
+    {
+        // traits-based version
+        typedef cc::FlatHashMap< cds::gc::HP, int, int, map_traits > map;
+        test_int_flat< map >();
+
+        // option-based version
+        typedef cc::FlatHashMap< cds::gc::HP, int, int,
+            cc::flat_hashmap::make_traits<
+                cc::opt::hash< hash_int >
+                ,cc::opt::item_counter< cds::atomicity::item_counter >
+            >::type
+        > opt_map;
+        test_int_flat< opt_map >();
+
+        // default std::hash
+        typedef cc::FlatHashMap< cds::gc::HP, int, int > def_map;
+        test_int_flat< def_map >();
+
+        // The table grows even if the items are not counted
+        typedef cc::FlatHashMap< cds::gc::HP, int, int,
+            cc::flat_hashmap::make_traits<
+                cc::opt::hash< hash_int >
+                ,cc::opt::item_counter< cds::atomicity::empty_item_counter >
+            >::type
+        > uncounted_map;
+        test_int_flat< uncounted_map >();
+
+        typedef cc::FlatHashMap< cds::gc::HP, int, int, collision_traits > collision_map;
+        test_int_flat_collision< collision_map >();
+    }
+
+    void HashMapHdrTest::FlatHashMap_DHP()
+    {
+        typedef cc::FlatHashMap< cds::gc::DHP, int, int, map_traits > map;
+        test_int_flat< map >();
+
+        typedef cc::FlatHashMap< cds::gc::DHP, int, int, collision_traits > collision_map;
+        test_int_flat_collision< collision_map >();
+    }
+
+    void HashMapHdrTest::FlatHashMap_RCU_GPI()
+    {
+        typedef cds::urcu::gc< cds::urcu::general_instant<> > rcu_type;
+        typedef cc::FlatHashMap< rcu_type, int, int, map_traits > map;
+        test_int_flat< map >();
+    }
+
+    void HashMapHdrTest::FlatHashMap_RCU_GPB()
+    {
+        typedef cds::urcu::gc< cds::urcu::general_buffered<> > rcu_type;
+        typedef cc::FlatHashMap< rcu_type, int, int, map_traits > map;
+        test_int_flat< map >();
+
+        typedef cc::FlatHashMap< rcu_type, int, int, collision_traits > collision_map;
+        test_int_flat_collision< collision_map >();
+    }
+
+    void HashMapHdrTest::FlatHashMap_RCU_SHB()
+    {
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+        typedef cds::urcu::gc< cds::urcu::signal_buffered<> > rcu_type;
+        typedef cc::FlatHashMap< rcu_type, int, int, map_traits > map;
+        test_int_flat< map >();
+#endif
+    }
+
+} // namespace map
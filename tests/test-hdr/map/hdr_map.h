@@ -34,8 +34,11 @@
 
 #include "cppunit/cppunit_proxy.h"
 #include <cds/os/timer.h>
+#include <cds/os/topology.h>
 #include <cds/opt/hash.h>
 #include <functional>   // ref
+#include <vector>
+#include <algorithm>  // count_if
 
 namespace cds { namespace container {}}
 
@@ -215,76 +218,113 @@ namespace map {
 
 
         template <class Map>
-        void test_int()
+        void test_find_batch( Map& m )
         {
-            Map m( 100, 4 );
-
-            test_int_with(m);
-
-            // extract/get test
             CPPUNIT_ASSERT( m.empty() );
-            {
-                const int nLimit = 100;
-                typename Map::guarded_ptr gp;
-                int arrRandom[nLimit];
-                for ( int i = 0; i < nLimit; ++i )
-                    arrRandom[i] = i;
-                shuffle( arrRandom, arrRandom + nLimit );
-
-                for ( int i = 0; i < nLimit; ++i )
-                    CPPUNIT_ASSERT( m.insert( arrRandom[i], arrRandom[i] ));
-
-                for ( int i = 0; i < nLimit; ++i ) {
-                    int nKey = arrRandom[i];
-                    gp = m.get( nKey );
-                    CPPUNIT_ASSERT( gp );
-                    CPPUNIT_ASSERT( !gp.empty());
-                    CPPUNIT_CHECK( gp->first == nKey );
-                    CPPUNIT_CHECK( gp->second.m_val == nKey );
-                    gp.release();
 
-                    gp = m.extract( nKey );
-                    CPPUNIT_ASSERT( gp );
-                    CPPUNIT_ASSERT( !gp.empty());
-                    CPPUNIT_CHECK( gp->first == nKey );
-                    CPPUNIT_CHECK( gp->second.m_val == nKey );
-                    gp.release();
+            const int nLimit = 100;
+            for ( int i = 0; i < nLimit; i += 2 )
+                CPPUNIT_ASSERT( m.insert( i, i * 3 ));
 
-                    gp = m.get( nKey );
-                    CPPUNIT_CHECK( !gp );
+            std::vector<int> arrKeys;
+            for ( int i = 0; i < nLimit; ++i )
+                arrKeys.push_back( i );
+            shuffle( arrKeys.begin(), arrKeys.end() );
 
-                    CPPUNIT_CHECK( !m.extract(nKey));
-                    CPPUNIT_CHECK( gp.empty());
-                }
-                CPPUNIT_ASSERT( m.empty() );
+            size_t nFound = 0;
+            CPPUNIT_ASSERT( m.find_batch( arrKeys.begin(), arrKeys.end(), [&nFound]( typename Map::value_type& item ) {
+                CPPUNIT_ASSERT_CURRENT( item.first % 2 == 0 );
+                CPPUNIT_ASSERT_CURRENT( item.second.m_val == item.first * 3 );
+                ++nFound;
+            }) == size_t( nLimit / 2 ));
+            CPPUNIT_ASSERT( nFound == size_t( nLimit / 2 ));
 
-                for ( int i = 0; i < nLimit; ++i )
-                    CPPUNIT_ASSERT( m.insert( arrRandom[i], arrRandom[i] ));
+            // the batch shorter than prefetch distance
+            CPPUNIT_ASSERT( m.find_batch( arrKeys.begin(), arrKeys.begin() + 3, []( typename Map::value_type& ) {} )
+                == size_t( std::count_if( arrKeys.begin(), arrKeys.begin() + 3, []( int n ) { return n % 2 == 0; } )));
+            CPPUNIT_ASSERT( m.find_batch( arrKeys.begin(), arrKeys.begin(), []( typename Map::value_type& ) {} ) == 0 );
 
-                for ( int i = 0; i < nLimit; ++i ) {
-                    int nKey = arrRandom[i];
-                    gp = m.get_with( other_item( nKey ), other_less() );
-                    CPPUNIT_ASSERT( gp );
-                    CPPUNIT_ASSERT( !gp.empty());
-                    CPPUNIT_CHECK( gp->first == nKey );
-                    CPPUNIT_CHECK( gp->second.m_val == nKey );
-                    gp.release();
+            m.clear();
+            CPPUNIT_ASSERT( m.empty() );
+        }
 
-                    gp = m.extract_with( other_item( nKey ), other_less() );
-                    CPPUNIT_ASSERT( gp );
-                    CPPUNIT_ASSERT( !gp.empty());
-                    CPPUNIT_CHECK( gp->first == nKey );
-                    CPPUNIT_CHECK( gp->second.m_val == nKey );
-                    gp.release();
+        template <class Map>
+        void test_get_extract( Map& m )
+        {
+            CPPUNIT_ASSERT( m.empty() );
 
-                    gp = m.get_with( other_item( nKey ), other_less() );
-                    CPPUNIT_CHECK( !gp );
+            const int nLimit = 100;
+            typename Map::guarded_ptr gp;
+            int arrRandom[nLimit];
+            for ( int i = 0; i < nLimit; ++i )
+                arrRandom[i] = i;
+            shuffle( arrRandom, arrRandom + nLimit );
+
+            for ( int i = 0; i < nLimit; ++i )
+                CPPUNIT_ASSERT( m.insert( arrRandom[i], arrRandom[i] ));
+
+            for ( int i = 0; i < nLimit; ++i ) {
+                int nKey = arrRandom[i];
+                gp = m.get( nKey );
+                CPPUNIT_ASSERT( gp );
+                CPPUNIT_ASSERT( !gp.empty());
+                CPPUNIT_CHECK( gp->first == nKey );
+                CPPUNIT_CHECK( gp->second.m_val == nKey );
+                gp.release();
+
+                gp = m.extract( nKey );
+                CPPUNIT_ASSERT( gp );
+                CPPUNIT_ASSERT( !gp.empty());
+                CPPUNIT_CHECK( gp->first == nKey );
+                CPPUNIT_CHECK( gp->second.m_val == nKey );
+                gp.release();
+
+                gp = m.get( nKey );
+                CPPUNIT_CHECK( !gp );
+
+                CPPUNIT_CHECK( !m.extract(nKey));
+                CPPUNIT_CHECK( gp.empty());
+            }
+            CPPUNIT_ASSERT( m.empty() );
 
-                    CPPUNIT_CHECK( !m.extract_with(other_item(nKey), other_less() ));
-                    CPPUNIT_CHECK( gp.empty());
-                }
-                CPPUNIT_ASSERT( m.empty() );
+            for ( int i = 0; i < nLimit; ++i )
+                CPPUNIT_ASSERT( m.insert( arrRandom[i], arrRandom[i] ));
+
+            for ( int i = 0; i < nLimit; ++i ) {
+                int nKey = arrRandom[i];
+                gp = m.get_with( other_item( nKey ), other_less() );
+                CPPUNIT_ASSERT( gp );
+                CPPUNIT_ASSERT( !gp.empty());
+                CPPUNIT_CHECK( gp->first == nKey );
+                CPPUNIT_CHECK( gp->second.m_val == nKey );
+                gp.release();
+
+                gp = m.extract_with( other_item( nKey ), other_less() );
+                CPPUNIT_ASSERT( gp );
+                CPPUNIT_ASSERT( !gp.empty());
+                CPPUNIT_CHECK( gp->first == nKey );
+                CPPUNIT_CHECK( gp->second.m_val == nKey );
+                gp.release();
+
+                gp = m.get_with( other_item( nKey ), other_less() );
+                CPPUNIT_CHECK( !gp );
+
+                CPPUNIT_CHECK( !m.extract_with(other_item(nKey), other_less() ));
+                CPPUNIT_CHECK( gp.empty());
             }
+            CPPUNIT_ASSERT( m.empty() );
+        }
+
+        template <class Map>
+        void test_int()
+        {
+            Map m( 100, 4 );
+
+            test_int_with(m);
+            test_find_batch(m);
+
+            // extract/get test
+            test_get_extract( m );
 
             // iterator test
             test_iter<Map>();
@@ -296,6 +336,7 @@ namespace map {
             Map m( 52, 4 );
 
             test_int_with(m);
+            test_find_batch(m);
 
             // extract/get test
             {
@@ -378,6 +419,7 @@ namespace map {
             Map m( 52, 4 );
 
             test_int_with(m);
+            test_find_batch(m);
 
             // extract/get test
             {
@@ -975,6 +1017,415 @@ namespace map {
         }
 
 
+        template <class Map>
+        void test_int_resizable()
+        {
+            typedef typename Map::value_type map_pair;
+
+            // Small initial table: the map must grow several times
+            Map m( 16, 2 );
+            size_t const nInitBucketCount = m.bucket_count();
+            CPPUNIT_ASSERT( m.empty() );
+
+            const int nCount = 4000;
+            for ( int i = 0; i < nCount; ++i ) {
+                switch ( i % 4 ) {
+                case 0:
+                    CPPUNIT_ASSERT( m.insert( i, i * 3 ));
+                    break;
+                case 1:
+                    CPPUNIT_ASSERT( m.insert_with( i, insert_functor<Map>() ));
+                    break;
+                case 2:
+                    CPPUNIT_ASSERT( m.emplace( i, i * 3 ));
+                    break;
+                default:
+                    CPPUNIT_ASSERT( m.insert( i ));
+                    CPPUNIT_ASSERT( m.find( i, []( map_pair& item ) { item.second.m_val = item.first * 3; } ));
+                }
+                CPPUNIT_ASSERT( !m.insert( i ));
+
+                // All items must be reachable while the buckets are being moved
+                if ( i % 256 == 0 ) {
+                    for ( int k = 0; k <= i; ++k )
+                        CPPUNIT_ASSERT( m.contains( k ));
+                }
+            }
+            CPPUNIT_ASSERT( check_size( m, nCount ));
+            CPPUNIT_ASSERT( m.resize_count() > 0 );
+            CPPUNIT_ASSERT( m.bucket_count() > nInitBucketCount );
+
+            // The values are preserved by migration
+            for ( int i = 0; i < nCount; ++i ) {
+                CPPUNIT_ASSERT( m.find( i, check_value( i * 3 )));
+                CPPUNIT_ASSERT( m.contains( other_item( i ), other_less() ));
+            }
+            CPPUNIT_ASSERT( !m.contains( nCount ));
+
+            for ( int i = 0; i < nCount * 2; ++i ) {
+                std::pair<bool, bool> ret = m.update( i, insert_functor<Map>() );
+                CPPUNIT_ASSERT( ret.first );
+                CPPUNIT_ASSERT( ret.second == ( i >= nCount ));
+            }
+            CPPUNIT_ASSERT( check_size( m, nCount * 2 ));
+            for ( int i = 0; i < nCount * 2; ++i )
+                CPPUNIT_ASSERT( m.find_with( other_item( i ), other_less(), check_value( i < nCount ? i * 5 : i * 2 )));
+
+            for ( int i = 0; i < nCount * 2; i += 2 ) {
+                CPPUNIT_ASSERT( m.erase( i ));
+                CPPUNIT_ASSERT( !m.erase( i ));
+            }
+            for ( int i = 1; i < nCount * 2; i += 4 ) {
+                int nVal = -1;
+                extract_functor f = { &nVal };
+                CPPUNIT_ASSERT( m.erase_with( other_item( i ), other_less(), f ));
+                CPPUNIT_ASSERT( nVal == ( i < nCount ? i * 5 : i * 2 ));
+            }
+            CPPUNIT_ASSERT( check_size( m, nCount / 2 ));
+            for ( int i = 0; i < nCount * 2; ++i )
+                CPPUNIT_ASSERT( m.contains( i ) == ( i % 4 == 3 ));
+
+            m.clear();
+            CPPUNIT_ASSERT( m.empty() );
+            CPPUNIT_ASSERT( check_size( m, 0 ));
+            CPPUNIT_ASSERT( !m.is_resizing() );
+        }
+
+        // FlatHashMap stores trivially copyable int -> int pairs
+        template <class Map>
+        void test_int_flat()
+        {
+            typedef typename Map::value_type map_pair;
+
+            // Small initial table: the map must grow several times
+            Map m( 16 );
+            size_t const nInitCapacity = m.capacity();
+            CPPUNIT_ASSERT( m.empty() );
+
+            const int nCount = 4000;
+            for ( int i = 0; i < nCount; ++i ) {
+                switch ( i % 3 ) {
+                case 0:
+                    CPPUNIT_ASSERT( m.insert( i, i * 3 ));
+                    break;
+                case 1:
+                    CPPUNIT_ASSERT( m.insert_with( i, []( map_pair& item ) { item.second = item.first * 3; } ));
+                    break;
+                default:
+                    CPPUNIT_ASSERT( m.insert( i ));
+                    CPPUNIT_ASSERT( m.update( i, []( bool bNew, map_pair& item ) { if ( !bNew ) item.second = item.first * 3; }, false ).first );
+                }
+                CPPUNIT_ASSERT( !m.insert( i ));
+            }
+            CPPUNIT_ASSERT( check_size( m, nCount ));
+            CPPUNIT_ASSERT( m.capacity() > nInitCapacity );
+            CPPUNIT_ASSERT( m.capacity() >= static_cast<size_t>( nCount ));
+
+            // The values are preserved by resizing
+            for ( int i = 0; i < nCount; ++i ) {
+                int nVal = -1;
+                CPPUNIT_ASSERT( m.find( i, [&nVal]( map_pair const& item ) { nVal = item.second; } ));
+                CPPUNIT_ASSERT( nVal == i * 3 );
+            }
+            CPPUNIT_ASSERT( !m.contains( nCount ));
+            CPPUNIT_ASSERT( !m.update( nCount, []( bool, map_pair& ) {}, false ).first );
+
+            for ( int i = 0; i < nCount * 2; ++i ) {
+                std::pair<bool, bool> ret = m.update( i, []( bool bNew, map_pair& item ) { item.second = bNew ? item.first * 2 : item.first * 5; } );
+                CPPUNIT_ASSERT( ret.first );
+                CPPUNIT_ASSERT( ret.second == ( i >= nCount ));
+            }
+            CPPUNIT_ASSERT( check_size( m, nCount * 2 ));
+
+            for ( int i = 0; i < nCount * 2; i += 2 ) {
+                CPPUNIT_ASSERT( m.erase( i ));
+                CPPUNIT_ASSERT( !m.erase( i ));
+            }
+            for ( int i = 1; i < nCount * 2; i += 4 ) {
+                int nVal = -1;
+                CPPUNIT_ASSERT( m.erase( i, [&nVal]( map_pair const& item ) { nVal = item.second; } ));
+                CPPUNIT_ASSERT( nVal == ( i < nCount ? i * 5 : i * 2 ));
+            }
+            CPPUNIT_ASSERT( check_size( m, nCount / 2 ));
+            for ( int i = 0; i < nCount * 2; ++i )
+                CPPUNIT_ASSERT( m.contains( i ) == ( i % 4 == 3 ));
+
+            // Erased slots are reused
+            for ( int i = 0; i < nCount * 2; i += 4 )
+                CPPUNIT_ASSERT( m.insert( i, i ));
+            CPPUNIT_ASSERT( check_size( m, nCount ));
+
+            m.clear();
+            CPPUNIT_ASSERT( m.empty() );
+            CPPUNIT_ASSERT( check_size( m, 0 ));
+            for ( int i = 0; i < nCount * 2; ++i )
+                CPPUNIT_ASSERT( !m.contains( i ));
+        }
+
+        // FlatHashMap with the same hash value for all keys: the items overflow to the stash
+        template <class Map>
+        void test_int_flat_collision()
+        {
+            typedef typename Map::value_type map_pair;
+
+            Map m( 16 );
+            const int nCount = 500;
+            for ( int i = 0; i < nCount; ++i ) {
+                CPPUNIT_ASSERT( m.insert( i, i * 3 ));
+                CPPUNIT_ASSERT( !m.insert( i ));
+            }
+            CPPUNIT_ASSERT( check_size( m, nCount ));
+
+            // The table grows with the item count, not until the colliding keys are separated
+            CPPUNIT_CHECK_EX( m.capacity() <= static_cast<size_t>( nCount * 4 ), "capacity=" << m.capacity() );
+            CPPUNIT_CHECK( m.statistics().m_nStashInsert.get() > 0 );
+
+            for ( int i = 0; i < nCount; ++i ) {
+                int nVal = -1;
+                CPPUNIT_ASSERT( m.find( i, [&nVal]( map_pair const& item ) { nVal = item.second; } ));
+                CPPUNIT_ASSERT( nVal == i * 3 );
+                CPPUNIT_ASSERT( m.update( i, []( bool bNew, map_pair& item ) { if ( !bNew ) item.second = item.first * 5; }, false ).first );
+            }
+            CPPUNIT_ASSERT( !m.contains( nCount ));
+
+            for ( int i = 0; i < nCount; i += 2 ) {
+                int nVal = -1;
+                CPPUNIT_ASSERT( m.erase( i, [&nVal]( map_pair const& item ) { nVal = item.second; } ));
+                CPPUNIT_ASSERT( nVal == i * 5 );
+                CPPUNIT_ASSERT( !m.erase( i ));
+            }
+            CPPUNIT_ASSERT( check_size( m, nCount / 2 ));
+            for ( int i = 0; i < nCount; ++i )
+                CPPUNIT_ASSERT( m.contains( i ) == ( i % 2 == 1 ));
+
+            // Erased stash slots are reused
+            for ( int i = 0; i < nCount; i += 2 )
+                CPPUNIT_ASSERT( m.insert( i, i ));
+            CPPUNIT_ASSERT( check_size( m, nCount ));
+
+            m.clear();
+            CPPUNIT_ASSERT( m.empty() );
+            for ( int i = 0; i < nCount; ++i )
+                CPPUNIT_ASSERT( !m.contains( i ));
+        }
+
+        // UnrolledSkipListMap: chunks are split and merged
+        template <class Map>
+        void test_int_unrolled()
+        {
+            typedef typename Map::value_type map_pair;
+
+            {
+                Map m;
+                test_int_with( m );
+            }
+
+            Map m;
+            CPPUNIT_ASSERT( m.empty() );
+
+            // The keys are inserted in pseudo-random order to split the chunks at various positions
+            const int nCount = 4000;
+            for ( int i = 0; i < nCount; ++i ) {
+                int const nKey = ( i * 7919 ) % nCount;
+                switch ( i % 3 ) {
+                case 0:
+                    CPPUNIT_ASSERT( m.insert( nKey, nKey * 3 ));
+                    break;
+                case 1:
+                    CPPUNIT_ASSERT( m.insert_with( nKey, []( map_pair& item ) { item.second.m_val = item.first * 3; } ));
+                    break;
+                default:
+                    CPPUNIT_ASSERT( m.emplace( nKey, nKey * 3 ));
+                }
+                CPPUNIT_ASSERT( !m.insert( nKey ));
+            }
+            CPPUNIT_ASSERT( !m.empty() );
+            CPPUNIT_ASSERT( check_size( m, nCount ));
+
+            int nPrev = -1;
+            size_t nOrderError = 0;
+            m.for_each( [&nPrev, &nOrderError]( map_pair& item ) {
+                if ( item.first != nPrev + 1 || item.second.m_val != item.first * 3 )
+                    ++nOrderError;
+                nPrev = item.first;
+            });
+            CPPUNIT_ASSERT( nOrderError == 0 );
+            CPPUNIT_ASSERT( nPrev == nCount - 1 );
+
+            for ( int i = 0; i < nCount * 2; ++i ) {
+                std::pair<bool, bool> ret = m.update( i, []( bool bNew, map_pair& item ) { item.second.m_val = bNew ? item.first * 2 : item.first * 5; } );
+                CPPUNIT_ASSERT( ret.first );
+                CPPUNIT_ASSERT( ret.second == ( i >= nCount ));
+            }
+            CPPUNIT_ASSERT( check_size( m, nCount * 2 ));
+            CPPUNIT_ASSERT( !m.update( nCount * 2, []( bool, map_pair& ) {}, false ).first );
+
+            // Erasing three quarters of the items causes the chunks to be merged
+            for ( int i = 0; i < nCount * 2; i += 2 ) {
+                CPPUNIT_ASSERT( m.erase( i ));
+                CPPUNIT_ASSERT( !m.erase( i ));
+            }
+            for ( int i = 1; i < nCount * 2; i += 4 ) {
+                int nVal = -1;
+                CPPUNIT_ASSERT( m.erase_with( i, less(), [&nVal]( map_pair& item ) { nVal = item.second.m_val; } ));
+                CPPUNIT_ASSERT( nVal == ( i < nCount ? i * 5 : i * 2 ));
+            }
+            CPPUNIT_ASSERT( check_size( m, nCount / 2 ));
+            for ( int i = 0; i < nCount * 2; ++i ) {
+                CPPUNIT_ASSERT( m.contains( i ) == ( i % 4 == 3 ));
+                CPPUNIT_ASSERT( m.contains( i, less() ) == ( i % 4 == 3 ));
+            }
+
+            nPrev = -1;
+            m.for_each( [&nPrev, &nOrderError]( map_pair& item ) {
+                if ( item.first != nPrev + 4 )
+                    ++nOrderError;
+                nPrev = item.first;
+            });
+            CPPUNIT_ASSERT( nOrderError == 0 );
+            CPPUNIT_ASSERT( nPrev == nCount * 2 - 1 );
+
+            m.clear();
+            CPPUNIT_ASSERT( m.empty() );
+            CPPUNIT_ASSERT( check_size( m, 0 ));
+            for ( int i = 0; i < nCount * 2; ++i )
+                CPPUNIT_ASSERT( !m.contains( i ));
+        }
+
+        // BlockSplitListMap: blocks are split and merged, the bucket table grows
+        template <class Map>
+        void test_int_block_split()
+        {
+            typedef typename Map::value_type map_pair;
+
+            {
+                Map m( 100, 4 );
+                test_int_with( m );
+                test_get_extract( m );
+            }
+
+            Map m( 100, 4 );
+            CPPUNIT_ASSERT( m.empty() );
+
+            const int nCount = 4000;
+            for ( int i = 0; i < nCount; ++i ) {
+                int const nKey = ( i * 7919 ) % nCount;
+                switch ( i % 3 ) {
+                case 0:
+                    CPPUNIT_ASSERT( m.insert( nKey, nKey * 3 ));
+                    break;
+                case 1:
+                    CPPUNIT_ASSERT( m.insert_with( nKey, []( map_pair& item ) { item.second.m_val = item.first * 3; } ));
+                    break;
+                default:
+                    CPPUNIT_ASSERT( m.emplace( nKey, nKey * 3 ));
+                }
+                CPPUNIT_ASSERT( !m.insert( nKey ));
+            }
+            CPPUNIT_ASSERT( !m.empty() );
+            CPPUNIT_ASSERT( check_size( m, nCount ));
+            for ( int i = 0; i < nCount; ++i )
+                CPPUNIT_ASSERT( m.find( i, check_value( i * 3 )));
+
+            for ( int i = 0; i < nCount * 2; ++i ) {
+                std::pair<bool, bool> ret = m.update( i, []( bool bNew, map_pair& item ) { item.second.m_val = bNew ? item.first * 2 : item.first * 5; } );
+                CPPUNIT_ASSERT( ret.first );
+                CPPUNIT_ASSERT( ret.second == ( i >= nCount ));
+            }
+            CPPUNIT_ASSERT( check_size( m, nCount * 2 ));
+            CPPUNIT_ASSERT( !m.update( nCount * 2, []( bool, map_pair& ) {}, false ).first );
+
+            // Erasing three quarters of the items causes the nodes to be merged
+            for ( int i = 0; i < nCount * 2; i += 2 ) {
+                CPPUNIT_ASSERT( m.erase( i ));
+                CPPUNIT_ASSERT( !m.erase( i ));
+            }
+            for ( int i = 1; i < nCount * 2; i += 4 ) {
+                int nVal = -1;
+                CPPUNIT_ASSERT( m.erase_with( other_item( i ), other_less(), [&nVal]( map_pair& item ) { nVal = item.second.m_val; } ));
+                CPPUNIT_ASSERT( nVal == ( i < nCount ? i * 5 : i * 2 ));
+            }
+            CPPUNIT_ASSERT( check_size( m, nCount / 2 ));
+            for ( int i = 0; i < nCount * 2; ++i ) {
+                CPPUNIT_ASSERT( m.contains( i ) == ( i % 4 == 3 ));
+                CPPUNIT_ASSERT( m.contains( other_item( i ), other_less() ) == ( i % 4 == 3 ));
+            }
+            for ( int i = 3; i < nCount * 2; i += 4 )
+                CPPUNIT_ASSERT( m.find_with( other_item( i ), other_less(), check_value( i < nCount ? i * 5 : i * 2 )));
+
+            m.clear();
+            CPPUNIT_ASSERT( m.empty() );
+            CPPUNIT_ASSERT( check_size( m, 0 ));
+            for ( int i = 0; i < nCount * 2; ++i )
+                CPPUNIT_ASSERT( !m.contains( i ));
+
+            // The map is usable after clear()
+            for ( int i = 0; i < nCount; ++i )
+                CPPUNIT_ASSERT( m.insert( i, i ));
+            CPPUNIT_ASSERT( check_size( m, nCount ));
+        }
+
+        static bool is_online_numa_node( unsigned int nNode )
+        {
+            for ( unsigned int i = 0; i < cds::OS::topology::numa_online_node_count(); ++i ) {
+                if ( cds::OS::topology::numa_online_node( i ) == nNode )
+                    return true;
+            }
+            return false;
+        }
+
+        // ShardedMap: the operations are forwarded to the shard selected by hash
+        template <class Map>
+        void test_int_sharded()
+        {
+            Map m( 100, 4 );
+            test_int_with( m );
+
+            const int nCount = 1000;
+            for ( int i = 0; i < nCount; ++i )
+                CPPUNIT_ASSERT( m.insert( i, i ));
+
+            size_t nTotal = 0;
+            size_t nNonEmpty = 0;
+            for ( size_t i = 0; i < m.shard_count(); ++i ) {
+                CPPUNIT_ASSERT( m.home_node( i ) < cds::OS::topology::numa_node_count() );
+                CPPUNIT_ASSERT( is_online_numa_node( m.home_node( i )));
+                CPPUNIT_ASSERT( i == 0 || m.home_node( i - 1 ) <= m.home_node( i ));
+                nTotal += m.shard( i ).size();
+                if ( !m.shard( i ).empty())
+                    ++nNonEmpty;
+            }
+            CPPUNIT_ASSERT( nTotal == static_cast<size_t>( nCount ));
+            CPPUNIT_ASSERT( check_size( m, nCount ));
+            CPPUNIT_CHECK( nNonEmpty == m.shard_count() );
+
+            for ( int i = 0; i < nCount; ++i ) {
+                size_t nShard = m.shard_index( i );
+                CPPUNIT_ASSERT( nShard < m.shard_count() );
+                CPPUNIT_ASSERT( m.shard_index( other_item( i )) == nShard );
+                CPPUNIT_ASSERT( m.shard( nShard ).contains( i ));
+                CPPUNIT_ASSERT( m.is_local( i ) == ( m.home_node( nShard ) == cds::OS::topology::current_numa_node() ));
+            }
+
+            // get/extract
+            for ( int i = 0; i < nCount; i += 2 ) {
+                auto gp = m.get( i );
+                CPPUNIT_ASSERT( gp );
+                CPPUNIT_CHECK( gp->second.m_val == i );
+                gp = m.extract_with( other_item( i ), other_less() );
+                CPPUNIT_ASSERT( gp );
+                CPPUNIT_CHECK( gp->first == i );
+                gp.release();
+                CPPUNIT_ASSERT( !m.get_with( other_item( i ), other_less() ));
+                CPPUNIT_ASSERT( !m.extract( i ));
+            }
+            CPPUNIT_ASSERT( check_size( m, nCount / 2 ));
+
+            m.clear();
+            CPPUNIT_ASSERT( m.empty() );
+            CPPUNIT_ASSERT( check_size( m, 0 ));
+        }
+
         void Michael_HP_cmp();
         void Michael_HP_less();
         void Michael_HP_cmpmix();
@@ -1007,6 +1458,31 @@ namespace map {
         void Michael_nogc_less();
         void Michael_nogc_cmpmix();
 
+        void Michael_Resizable_HP();
+        void Michael_Resizable_DHP();
+        void Michael_Resizable_RCU_GPB();
+        void Michael_Resizable_RCU_SHB();
+        void Lazy_Resizable_HP();
+
+        void FlatHashMap_HP();
+        void FlatHashMap_DHP();
+        void FlatHashMap_RCU_GPI();
+        void FlatHashMap_RCU_GPB();
+        void FlatHashMap_RCU_SHB();
+
+        void UnrolledSkipList_HP_less();
+        void UnrolledSkipList_HP_cmp_stat();
+        void UnrolledSkipList_DHP_less();
+        void UnrolledSkipList_DHP_cmp_stat();
+
+        void BlockSplitList_HP_less();
+        void BlockSplitList_HP_cmp_stat();
+        void BlockSplitList_DHP_less();
+        void BlockSplitList_DHP_cmp_stat();
+
+        void Sharded_Michael_HP();
+        void Sharded_SplitList_DHP();
+
         void Lazy_HP_cmp();
         void Lazy_HP_less();
         void Lazy_HP_cmpmix();
@@ -1153,6 +1629,31 @@ namespace map {
             CPPUNIT_TEST(Michael_nogc_less)
             CPPUNIT_TEST(Michael_nogc_cmpmix)
 
+            CPPUNIT_TEST(Michael_Resizable_HP)
+            CPPUNIT_TEST(Michael_Resizable_DHP)
+            CPPUNIT_TEST(Michael_Resizable_RCU_GPB)
+            CPPUNIT_TEST(Michael_Resizable_RCU_SHB)
+            CPPUNIT_TEST(Lazy_Resizable_HP)
+
+            CPPUNIT_TEST(FlatHashMap_HP)
+            CPPUNIT_TEST(FlatHashMap_DHP)
+            CPPUNIT_TEST(FlatHashMap_RCU_GPI)
+            CPPUNIT_TEST(FlatHashMap_RCU_GPB)
+            CPPUNIT_TEST(FlatHashMap_RCU_SHB)
+
+            CPPUNIT_TEST(UnrolledSkipList_HP_less)
+            CPPUNIT_TEST(UnrolledSkipList_HP_cmp_stat)
+            CPPUNIT_TEST(UnrolledSkipList_DHP_less)
+            CPPUNIT_TEST(UnrolledSkipList_DHP_cmp_stat)
+
+            CPPUNIT_TEST(BlockSplitList_HP_less)
+            CPPUNIT_TEST(BlockSplitList_HP_cmp_stat)
+            CPPUNIT_TEST(BlockSplitList_DHP_less)
+            CPPUNIT_TEST(BlockSplitList_DHP_cmp_stat)
+
+            CPPUNIT_TEST(Sharded_Michael_HP)
+            CPPUNIT_TEST(Sharded_SplitList_DHP)
+
             CPPUNIT_TEST(Lazy_HP_cmp)
             CPPUNIT_TEST(Lazy_HP_less)
             CPPUNIT_TEST(Lazy_HP_cmpmix)
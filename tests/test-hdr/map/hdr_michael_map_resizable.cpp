@@ -0,0 +1,107 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#include "map/hdr_map.h"
+#include <cds/container/michael_kvlist_hp.h>
+#include <cds/container/michael_kvlist_dhp.h>
+#include <cds/container/michael_kvlist_rcu.h>
+#include <cds/container/lazy_kvlist_hp.h>
+#include <cds/urcu/general_buffered.h>
+#include <cds/urcu/signal_buffered.h>
+#include <cds/container/michael_map_resizable.h>
+
+namespace map {
+    namespace {
+        struct map_traits: public cc::michael_map::traits
+        {
+            typedef HashMapHdrTest::hash_int    hash;
+        };
+
+        struct michael_list_traits: public cc::michael_list::traits
+        {
+            typedef HashMapHdrTest::cmp   compare;
+        };
+
+        struct lazy_list_traits: public cc::lazy_list::traits
+        {
+            typedef HashMapHdrTest::less  less;
+        };
+    }
+
+    void HashMapHdrTest::Michael_Resizable_HP()
+    {
+        typedef cc::MichaelKVList< cds::gc::HP, int, HashMapHdrTest::value_type, michael_list_traits > list;
+
+        // traits-based version
+        typedef cc::ResizableMichaelHashMap< cds::gc::HP, list, map_traits > map;
+        test_int_resizable< map >();
+
+        // option-based version
+        typedef cc::ResizableMichaelHashMap< cds::gc::HP, list,
+            cc::michael_map::make_traits<
+                cc::opt::hash< hash_int >
+            >::type
+        > opt_map;
+        test_int_resizable< opt_map >();
+    }
+
+    void HashMapHdrTest::Michael_Resizable_DHP()
+    {
+        typedef cc::MichaelKVList< cds::gc::DHP, int, HashMapHdrTest::value_type, michael_list_traits > list;
+        typedef cc::ResizableMichaelHashMap< cds::gc::DHP, list, map_traits > map;
+        test_int_resizable< map >();
+    }
+
+    void HashMapHdrTest::Michael_Resizable_RCU_GPB()
+    {
+        typedef cds::urcu::gc< cds::urcu::general_buffered<> > rcu_type;
+        typedef cc::MichaelKVList< rcu_type, int, HashMapHdrTest::value_type, michael_list_traits > list;
+        typedef cc::ResizableMichaelHashMap< rcu_type, list, map_traits > map;
+        test_int_resizable< map >();
+    }
+
+    void HashMapHdrTest::Michael_Resizable_RCU_SHB()
+    {
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+        typedef cds::urcu::gc< cds::urcu::signal_buffered<> > rcu_type;
+        typedef cc::MichaelKVList< rcu_type, int, HashMapHdrTest::value_type, michael_list_traits > list;
+        typedef cc::ResizableMichaelHashMap< rcu_type, list, map_traits > map;
+        test_int_resizable< map >();
+#endif
+    }
+
+    void HashMapHdrTest::Lazy_Resizable_HP()
+    {
+        typedef cc::LazyKVList< cds::gc::HP, int, HashMapHdrTest::value_type, lazy_list_traits > list;
+        typedef cc::ResizableMichaelHashMap< cds::gc::HP, list, map_traits > map;
+        test_int_resizable< map >();
+    }
+
+} // namespace map
@@ -84,6 +84,27 @@ namespace map {
         >   map_spin;
         test_striped2< map_spin >();
 
+        // Incremental resizing
+        CPPUNIT_MESSAGE( "incremental_refinable");
+        typedef cc::StripedMap< sequence_t
+            , co::mutex_policy< cc::striped_set::incremental_refinable<> >
+            , co::hash< hash_int >
+            , co::less< less >
+        >   map_incremental;
+        test_striped2< map_incremental >();
+
+        CPPUNIT_MESSAGE( "incremental_refinable, load_factor_resizing<0>(8)");
+        {
+            typedef cc::StripedMap< sequence_t
+                , co::mutex_policy< cc::striped_set::incremental_refinable<cds::sync::reentrant_spin> >
+                , co::hash< hash_int >
+                , co::compare< cmp >
+                , co::resizing_policy< cc::striped_set::load_factor_resizing<0> >
+            >   map_incremental_resizing_lf;
+            map_incremental_resizing_lf m( 30, cc::striped_set::load_factor_resizing<0>(8) );
+            test_striped_with( m );
+        }
+
         // Resizing policy
         CPPUNIT_MESSAGE( "load_factor_resizing<0>(8)");
         {
@@ -0,0 +1,135 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#include "map/hdr_map.h"
+#include <cds/container/michael_kvlist_hp.h>
+#include <cds/container/michael_map.h>
+#include <cds/container/michael_list_dhp.h>
+#include <cds/container/split_list_map.h>
+#include <cds/container/sharded_map.h>
+#include <stdexcept>
+
+namespace map {
+
+    namespace {
+        struct michael_map_traits: public cc::michael_map::traits
+        {
+            typedef HashMapHdrTest::hash_int            hash;
+            typedef HashMapHdrTest::simple_item_counter item_counter;
+        };
+
+        struct michael_list_traits: public cc::michael_list::traits
+        {
+            typedef HashMapHdrTest::less  less;
+        };
+
+        struct split_list_traits: public cc::split_list::traits
+        {
+            typedef cc::michael_list_tag                ordered_list;
+            typedef HashMapHdrTest::hash_int            hash;
+            typedef HashMapHdrTest::simple_item_counter item_counter;
+
+            struct ordered_list_traits: public cc::michael_list::traits
+            {
+                typedef HashMapHdrTest::cmp   compare;
+            };
+        };
+
+        struct sharded_map_traits: public cc::sharded_map::traits
+        {
+            typedef HashMapHdrTest::hash_int    hash;
+        };
+
+        // The constructor of the shard throws when s_nThrowAt shards are alive
+        template <class Base>
+        struct throwing_shard: public Base
+        {
+            static size_t s_nAlive;
+            static size_t s_nThrowAt;
+
+            throwing_shard( size_t nMaxItemCount, size_t nLoadFactor )
+                : Base( nMaxItemCount, nLoadFactor )
+            {
+                if ( s_nAlive == s_nThrowAt )
+                    throw std::runtime_error( "shard construction failed" );
+                ++s_nAlive;
+            }
+
+            ~throwing_shard()
+            {
+                --s_nAlive;
+            }
+        };
+
+        template <class Base> size_t throwing_shard<Base>::s_nAlive = 0;
+        template <class Base> size_t throwing_shard<Base>::s_nThrowAt = 0;
+    }
+
+    void HashMapHdrTest::Sharded_Michael_HP()
+    {
+        typedef cc::MichaelKVList< cds::gc::HP, int, HashMapHdrTest::value_type, michael_list_traits > list;
+        typedef cc::MichaelHashMap< cds::gc::HP, list, michael_map_traits > shard_map;
+
+        // traits-based version
+        typedef cc::ShardedMap< shard_map, 4, sharded_map_traits > map;
+        test_int_sharded< map >();
+
+        // option-based version
+        typedef cc::ShardedMap< shard_map, 7,
+            cc::sharded_map::make_traits<
+                cc::opt::hash< hash_int >
+            >::type
+        > opt_map;
+        test_int_sharded< opt_map >();
+
+        // the shards constructed before the throwing one are destroyed
+        typedef throwing_shard< shard_map > bad_shard;
+        typedef cc::ShardedMap< bad_shard, 4, sharded_map_traits > bad_map;
+        bad_shard::s_nThrowAt = 2;
+        bool bThrown = false;
+        try {
+            bad_map m( 100, 4 );
+        }
+        catch ( std::runtime_error const& ) {
+            bThrown = true;
+        }
+        CPPUNIT_ASSERT( bThrown );
+        CPPUNIT_ASSERT( bad_shard::s_nAlive == 0 );
+    }
+
+    void HashMapHdrTest::Sharded_SplitList_DHP()
+    {
+        typedef cc::SplitListMap< cds::gc::DHP, int, HashMapHdrTest::value_type, split_list_traits > shard_map;
+
+        typedef cc::ShardedMap< shard_map, 16, sharded_map_traits > map;
+        test_int_sharded< map >();
+    }
+
+} // namespace map
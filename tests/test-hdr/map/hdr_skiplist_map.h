@@ -41,6 +41,122 @@ namespace map {
         typedef base_class::other_item  wrapped_item;
         typedef base_class::other_less  wrapped_less;
 
+        // m contains keys [0, nLimit) with value key * 2
+        template <class Map>
+        void test_range( Map& m, int nLimit )
+        {
+            typedef typename Map::iterator  set_iterator;
+            typedef typename Map::value_type map_value_type;
+
+            set_iterator it = m.lower_bound( 100 );
+            CPPUNIT_ASSERT( it != m.end() );
+            CPPUNIT_CHECK( it->first == 100 );
+            it = m.upper_bound( 100 );
+            CPPUNIT_ASSERT( it != m.end() );
+            CPPUNIT_CHECK( it->first == 101 );
+            ++it;
+            CPPUNIT_ASSERT( it != m.end() );
+            CPPUNIT_CHECK( it->first == 102 );
+
+            it = m.lower_bound( -5 );
+            CPPUNIT_ASSERT( it != m.end() );
+            CPPUNIT_CHECK( it->first == 0 );
+            CPPUNIT_CHECK( m.lower_bound( nLimit ) == m.end() );
+            CPPUNIT_CHECK( m.upper_bound( nLimit - 1 ) == m.end() );
+
+            std::vector<int> arrKeys;
+            std::vector<int> arrVals;
+            m.for_each_in_range( 100, 200, [&arrKeys, &arrVals]( map_value_type& item ) {
+                arrKeys.push_back( item.first );
+                arrVals.push_back( item.second.m_val );
+            });
+            CPPUNIT_ASSERT( arrKeys.size() == 100 );
+            for ( size_t i = 0; i < arrKeys.size(); ++i ) {
+                CPPUNIT_CHECK( arrKeys[i] == static_cast<int>( i ) + 100 );
+                CPPUNIT_CHECK( arrVals[i] == arrKeys[i] * 2 );
+            }
+
+            // empty range and range beyond the end
+            arrKeys.clear();
+            m.for_each_in_range( 200, 100, [&arrKeys]( map_value_type& item ) { arrKeys.push_back( item.first ); });
+            CPPUNIT_CHECK( arrKeys.empty() );
+            m.for_each_in_range( nLimit - 10, nLimit + 10, [&arrKeys]( map_value_type& item ) { arrKeys.push_back( item.first ); });
+            CPPUNIT_CHECK( arrKeys.size() == 10 );
+
+            // holes in the range
+            for ( int i = 1000; i < 1100; i += 2 )
+                CPPUNIT_ASSERT( m.erase( i ));
+            it = m.lower_bound( 1000 );
+            CPPUNIT_ASSERT( it != m.end() );
+            CPPUNIT_CHECK( it->first == 1001 );
+            it = m.upper_bound( 1001 );
+            CPPUNIT_ASSERT( it != m.end() );
+            CPPUNIT_CHECK( it->first == 1003 );
+            arrKeys.clear();
+            m.for_each_in_range( 1000, 1100, [&arrKeys]( map_value_type& item ) { arrKeys.push_back( item.first ); });
+            CPPUNIT_ASSERT( arrKeys.size() == 50 );
+            for ( size_t i = 0; i < arrKeys.size(); ++i )
+                CPPUNIT_CHECK( arrKeys[i] == static_cast<int>( i * 2 ) + 1001 );
+            for ( int i = 1000; i < 1100; i += 2 )
+                CPPUNIT_ASSERT( m.insert( i, i * 2 ));
+
+            // the successor of the current item is deleted while scanning:
+            // the scan must continue from the upper levels
+            arrKeys.clear();
+            size_t nEraseFailed = 0;
+            m.for_each_in_range( 2000, 2100, [&m, &arrKeys, &nEraseFailed]( map_value_type& item ) {
+                arrKeys.push_back( item.first );
+                if ( !m.erase( item.first + 1 ))
+                    ++nEraseFailed;
+            });
+            CPPUNIT_CHECK( nEraseFailed == 0 );
+            CPPUNIT_ASSERT( arrKeys.size() == 50 );
+            for ( size_t i = 0; i < arrKeys.size(); ++i )
+                CPPUNIT_CHECK( arrKeys[i] == static_cast<int>( i * 2 ) + 2000 );
+            it = m.upper_bound( 2000 );
+            CPPUNIT_ASSERT( it != m.end() );
+            CPPUNIT_CHECK( it->first == 2002 );
+            for ( int i = 2001; i < 2100; i += 2 )
+                CPPUNIT_ASSERT( m.insert( i, i * 2 ));
+        }
+
+        template <class Map, typename PrintStat >
+        void test_snapshot()
+        {
+            typedef typename Map::value_type map_value_type;
+            static int const nLimit = 1000;
+
+            test< Map, PrintStat >();
+
+            Map m;
+            for ( int i = 0; i < nLimit; ++i )
+                CPPUNIT_ASSERT( m.insert( i, i * 2 ));
+
+            std::vector< map_value_type > arrSnapshot;
+            m.snapshot_range( 100, 200, arrSnapshot );
+            CPPUNIT_ASSERT( arrSnapshot.size() == 100 );
+            for ( size_t i = 0; i < arrSnapshot.size(); ++i ) {
+                CPPUNIT_CHECK( arrSnapshot[i].first == static_cast<int>( i ) + 100 );
+                CPPUNIT_CHECK( arrSnapshot[i].second.m_val == arrSnapshot[i].first * 2 );
+            }
+
+            for ( int i = 100; i < 200; i += 2 )
+                CPPUNIT_ASSERT( m.erase( i ));
+            m.snapshot_range( 100, 200, arrSnapshot );
+            CPPUNIT_ASSERT( arrSnapshot.size() == 50 );
+            for ( size_t i = 0; i < arrSnapshot.size(); ++i )
+                CPPUNIT_CHECK( arrSnapshot[i].first == static_cast<int>( i * 2 ) + 101 );
+
+            m.snapshot_range( nLimit, nLimit + 100, arrSnapshot );
+            CPPUNIT_CHECK( arrSnapshot.empty() );
+
+            m.clear();
+            m.snapshot_range( 0, nLimit, arrSnapshot );
+            CPPUNIT_CHECK( arrSnapshot.empty() );
+
+            CPPUNIT_MSG( PrintStat()(m, "Snapshot test") );
+        }
+
         template <class Map, typename PrintStat >
         void test()
         {
@@ -163,6 +279,8 @@ namespace map {
             }
             CPPUNIT_ASSERT( nCount == nLimit );
 
+            test_range( m, nLimit );
+
             {
                 typename Map::guarded_ptr gp;
                 int arrItem[nLimit];
@@ -409,6 +527,44 @@ namespace map {
             CPPUNIT_MSG( PrintStat()(m, "SkipListMap statistics") );
         }
 
+        template <class Map, typename PrintStat >
+        void test_nogc_snapshot()
+        {
+            typedef typename Map::value_type map_value_type;
+
+            test_nogc< Map, PrintStat >();
+
+            Map m;
+            for ( int i = 0; i < 1000; i += 2 )
+                CPPUNIT_ASSERT( m.insert( i, i * 2 ) != m.end() );
+
+            std::vector< int > arrKeys;
+            m.for_each_in_range( 100, 200, [&arrKeys]( map_value_type& item ) { arrKeys.push_back( item.first ); } );
+            CPPUNIT_ASSERT( arrKeys.size() == 50 );
+            for ( size_t i = 0; i < arrKeys.size(); ++i )
+                CPPUNIT_CHECK( arrKeys[i] == static_cast<int>( i * 2 ) + 100 );
+
+            std::vector< map_value_type > arrSnapshot;
+            m.snapshot_range( 100, 200, arrSnapshot );
+            CPPUNIT_ASSERT( arrSnapshot.size() == 50 );
+            for ( size_t i = 0; i < arrSnapshot.size(); ++i ) {
+                CPPUNIT_CHECK( arrSnapshot[i].first == static_cast<int>( i * 2 ) + 100 );
+                CPPUNIT_CHECK( arrSnapshot[i].second.m_val == arrSnapshot[i].first * 2 );
+            }
+
+            for ( int i = 101; i < 200; i += 2 )
+                CPPUNIT_ASSERT( m.insert( i, i * 2 ) != m.end() );
+            m.snapshot_range( 100, 200, arrSnapshot );
+            CPPUNIT_ASSERT( arrSnapshot.size() == 100 );
+            for ( size_t i = 0; i < arrSnapshot.size(); ++i )
+                CPPUNIT_CHECK( arrSnapshot[i].first == static_cast<int>( i ) + 100 );
+
+            m.snapshot_range( 1000, 1100, arrSnapshot );
+            CPPUNIT_CHECK( arrSnapshot.empty() );
+
+            CPPUNIT_MSG( PrintStat()(m, "Snapshot test") );
+        }
+
     public:
         void SkipList_HP_less();
         void SkipList_HP_cmp();
@@ -434,6 +590,8 @@ namespace map {
         void SkipList_HP_michaelalloc_less_stat();
         void SkipList_HP_michaelalloc_cmp_stat();
         void SkipList_HP_michaelalloc_cmpless_stat();
+        void SkipList_HP_snapshot();
+        void SkipList_HP_snapshot_stat();
 
         void SkipList_DHP_less();
         void SkipList_DHP_cmp();
@@ -459,6 +617,8 @@ namespace map {
         void SkipList_DHP_michaelalloc_less_stat();
         void SkipList_DHP_michaelalloc_cmp_stat();
         void SkipList_DHP_michaelalloc_cmpless_stat();
+        void SkipList_DHP_snapshot();
+        void SkipList_DHP_snapshot_stat();
 
         void SkipList_NOGC_less();
         void SkipList_NOGC_cmp();
@@ -484,6 +644,8 @@ namespace map {
         void SkipList_NOGC_michaelalloc_less_stat();
         void SkipList_NOGC_michaelalloc_cmp_stat();
         void SkipList_NOGC_michaelalloc_cmpless_stat();
+        void SkipList_NOGC_snapshot();
+        void SkipList_NOGC_snapshot_stat();
 
         CPPUNIT_TEST_SUITE(SkipListMapHdrTest)
             CPPUNIT_TEST(SkipList_HP_less)
@@ -510,6 +672,8 @@ namespace map {
             CPPUNIT_TEST(SkipList_HP_michaelalloc_less_stat)
             CPPUNIT_TEST(SkipList_HP_michaelalloc_cmp_stat)
             CPPUNIT_TEST(SkipList_HP_michaelalloc_cmpless_stat)
+            CPPUNIT_TEST(SkipList_HP_snapshot)
+            CPPUNIT_TEST(SkipList_HP_snapshot_stat)
 
             CPPUNIT_TEST(SkipList_DHP_less)
             CPPUNIT_TEST(SkipList_DHP_cmp)
@@ -535,6 +699,8 @@ namespace map {
             CPPUNIT_TEST(SkipList_DHP_michaelalloc_less_stat)
             CPPUNIT_TEST(SkipList_DHP_michaelalloc_cmp_stat)
             CPPUNIT_TEST(SkipList_DHP_michaelalloc_cmpless_stat)
+            CPPUNIT_TEST(SkipList_DHP_snapshot)
+            CPPUNIT_TEST(SkipList_DHP_snapshot_stat)
 
             CPPUNIT_TEST(SkipList_NOGC_less)
             CPPUNIT_TEST(SkipList_NOGC_cmp)
@@ -560,6 +726,8 @@ namespace map {
             CPPUNIT_TEST(SkipList_NOGC_michaelalloc_less_stat)
             CPPUNIT_TEST(SkipList_NOGC_michaelalloc_cmp_stat)
             CPPUNIT_TEST(SkipList_NOGC_michaelalloc_cmpless_stat)
+            CPPUNIT_TEST(SkipList_NOGC_snapshot)
+            CPPUNIT_TEST(SkipList_NOGC_snapshot_stat)
 
         CPPUNIT_TEST_SUITE_END()
 
@@ -336,6 +336,31 @@ namespace map {
         > set;
         test< set, misc::print_skiplist_stat<set::stat> >();
     }
+
+    void SkipListMapHdrTest::SkipList_HP_snapshot()
+    {
+        typedef cc::SkipListMap< cds::gc::HP, key_type, value_type,
+            cc::skip_list::make_traits<
+                co::less< less >
+                ,co::item_counter< simple_item_counter >
+                ,cc::skip_list::snapshot_counter< cc::skip_list::version_counter >
+            >::type
+        > set;
+        test_snapshot< set, misc::print_skiplist_stat<set::stat> >();
+    }
+
+    void SkipListMapHdrTest::SkipList_HP_snapshot_stat()
+    {
+        typedef cc::SkipListMap< cds::gc::HP, key_type, value_type,
+            cc::skip_list::make_traits<
+                co::compare< cmp >
+                ,co::item_counter< simple_item_counter >
+                ,co::stat< cc::skip_list::stat<> >
+                ,cc::skip_list::snapshot_counter< cc::skip_list::version_counter >
+            >::type
+        > set;
+        test_snapshot< set, misc::print_skiplist_stat<set::stat> >();
+    }
 } // namespace map
 
 CPPUNIT_TEST_SUITE_REGISTRATION(map::SkipListMapHdrTest);
@@ -336,4 +336,29 @@ namespace map {
         > set;
         test_nogc< set, misc::print_skiplist_stat<set::stat> >();
     }
+
+    void SkipListMapHdrTest::SkipList_NOGC_snapshot()
+    {
+        typedef cc::SkipListMap< cds::gc::nogc, key_type, value_type,
+            cc::skip_list::make_traits<
+                co::less< less >
+                ,co::item_counter< simple_item_counter >
+                ,cc::skip_list::snapshot_counter< cc::skip_list::version_counter >
+            >::type
+        > set;
+        test_nogc_snapshot< set, misc::print_skiplist_stat<set::stat> >();
+    }
+
+    void SkipListMapHdrTest::SkipList_NOGC_snapshot_stat()
+    {
+        typedef cc::SkipListMap< cds::gc::nogc, key_type, value_type,
+            cc::skip_list::make_traits<
+                co::compare< cmp >
+                ,co::item_counter< simple_item_counter >
+                ,co::stat< cc::skip_list::stat<> >
+                ,cc::skip_list::snapshot_counter< cc::skip_list::version_counter >
+            >::type
+        > set;
+        test_nogc_snapshot< set, misc::print_skiplist_stat<set::stat> >();
+    }
 } // namespace map
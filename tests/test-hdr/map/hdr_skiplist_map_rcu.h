@@ -285,6 +285,53 @@ namespace map {
             CPPUNIT_MSG( PrintStat()(m, nullptr) );
         }
 
+        template <class Map, typename PrintStat >
+        void test_snapshot()
+        {
+            typedef typename Map::value_type map_value_type;
+            static int const nLimit = 1000;
+
+            test< Map, PrintStat >();
+
+            Map m;
+            for ( int i = 0; i < nLimit; ++i )
+                CPPUNIT_ASSERT( m.insert( i, i * 2 ));
+
+            std::vector< int > arrKeys;
+            m.for_each_in_range( 100, 200, [&arrKeys]( map_value_type& item ) { arrKeys.push_back( item.first ); } );
+            CPPUNIT_ASSERT( arrKeys.size() == 100 );
+            for ( size_t i = 0; i < arrKeys.size(); ++i )
+                CPPUNIT_CHECK( arrKeys[i] == static_cast<int>( i ) + 100 );
+
+            std::vector< map_value_type > arrSnapshot;
+            m.snapshot_range( 100, 200, arrSnapshot );
+            CPPUNIT_ASSERT( arrSnapshot.size() == 100 );
+            for ( size_t i = 0; i < arrSnapshot.size(); ++i ) {
+                CPPUNIT_CHECK( arrSnapshot[i].first == static_cast<int>( i ) + 100 );
+                CPPUNIT_CHECK( arrSnapshot[i].second.m_val == arrSnapshot[i].first * 2 );
+            }
+
+            for ( int i = 100; i < 200; i += 2 )
+                CPPUNIT_ASSERT( m.erase( i ));
+            m.snapshot_range( 100, 200, arrSnapshot );
+            CPPUNIT_ASSERT( arrSnapshot.size() == 50 );
+            for ( size_t i = 0; i < arrSnapshot.size(); ++i )
+                CPPUNIT_CHECK( arrSnapshot[i].first == static_cast<int>( i * 2 ) + 101 );
+
+            arrKeys.clear();
+            m.for_each_in_range( 100, 200, [&arrKeys]( map_value_type& item ) { arrKeys.push_back( item.first ); } );
+            CPPUNIT_ASSERT( arrKeys.size() == 50 );
+
+            m.snapshot_range( nLimit, nLimit + 100, arrSnapshot );
+            CPPUNIT_CHECK( arrSnapshot.empty() );
+
+            m.clear();
+            m.snapshot_range( 0, nLimit, arrSnapshot );
+            CPPUNIT_CHECK( arrSnapshot.empty() );
+
+            CPPUNIT_MSG( PrintStat()(m, "Snapshot test") );
+        }
+
     public:
         void SkipList_RCU_GPI_less();
         void SkipList_RCU_GPI_cmp();
@@ -310,6 +357,8 @@ namespace map {
         void SkipList_RCU_GPI_michaelalloc_less_stat();
         void SkipList_RCU_GPI_michaelalloc_cmp_stat();
         void SkipList_RCU_GPI_michaelalloc_cmpless_stat();
+        void SkipList_RCU_GPI_snapshot();
+        void SkipList_RCU_GPI_snapshot_stat();
 
         void SkipList_RCU_GPB_less();
         void SkipList_RCU_GPB_cmp();
@@ -436,6 +485,8 @@ namespace map {
             CPPUNIT_TEST(SkipList_RCU_GPI_michaelalloc_less_stat)
             CPPUNIT_TEST(SkipList_RCU_GPI_michaelalloc_cmp_stat)
             CPPUNIT_TEST(SkipList_RCU_GPI_michaelalloc_cmpless_stat)
+            CPPUNIT_TEST(SkipList_RCU_GPI_snapshot)
+            CPPUNIT_TEST(SkipList_RCU_GPI_snapshot_stat)
 
             CPPUNIT_TEST(SkipList_RCU_GPB_less)
             CPPUNIT_TEST(SkipList_RCU_GPB_cmp)
@@ -342,6 +342,31 @@ namespace map {
         > set;
         test< set, misc::print_skiplist_stat<set::stat> >();
     }
+
+    void SkipListMapRCUHdrTest::SkipList_RCU_GPI_snapshot()
+    {
+        typedef cc::SkipListMap< rcu_type, key_type, value_type,
+            cc::skip_list::make_traits<
+                co::less< less >
+                ,co::item_counter< simple_item_counter >
+                ,cc::skip_list::snapshot_counter< cc::skip_list::version_counter >
+            >::type
+        > set;
+        test_snapshot< set, misc::print_skiplist_stat<set::stat> >();
+    }
+
+    void SkipListMapRCUHdrTest::SkipList_RCU_GPI_snapshot_stat()
+    {
+        typedef cc::SkipListMap< rcu_type, key_type, value_type,
+            cc::skip_list::make_traits<
+                co::compare< cmp >
+                ,co::item_counter< simple_item_counter >
+                ,co::stat< cc::skip_list::stat<> >
+                ,cc::skip_list::snapshot_counter< cc::skip_list::version_counter >
+            >::type
+        > set;
+        test_snapshot< set, misc::print_skiplist_stat<set::stat> >();
+    }
 } // namespace map
 
 CPPUNIT_TEST_SUITE_REGISTRATION(map::SkipListMapRCUHdrTest);
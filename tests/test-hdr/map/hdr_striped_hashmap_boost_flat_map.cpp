@@ -45,12 +45,18 @@ namespace map {
 #include <cds/container/striped_map/boost_flat_map.h>
 #include <cds/container/striped_map.h>
 #include <cds/sync/spinlock.h>
+#include <cds/urcu/general_buffered.h>
 
 namespace map {
 
     namespace {
         typedef boost::container::flat_map<StripedMapHdrTest::key_type, StripedMapHdrTest::value_type, StripedMapHdrTest::less > map_t;
 
+        typedef cds::urcu::gc< cds::urcu::general_buffered<> > rcu_gpb;
+        typedef boost::container::flat_map<StripedMapHdrTest::key_type, StripedMapHdrTest::value_type, StripedMapHdrTest::less,
+            cc::striped_set::rcu_retired_allocator< rcu_gpb, std::pair< StripedMapHdrTest::key_type, StripedMapHdrTest::value_type >>
+        > rcu_map_t;
+
         struct my_copy_policy {
             typedef map_t::iterator iterator;
 
@@ -95,6 +101,27 @@ namespace map {
         >   map_spin;
         test_striped< map_spin >();
 
+        // Optimistic reading
+        CPPUNIT_MESSAGE( "seqlock_striping");
+        {
+            typedef cc::StripedMap< rcu_map_t
+                , co::hash< hash_int >
+                , co::less< less >
+                , co::mutex_policy< cc::striped_set::seqlock_striping< rcu_gpb > >
+            >   map_seqlock;
+            test_striped< map_seqlock >();
+
+            CPPUNIT_MESSAGE( "seqlock_striping, load_factor_resizing<0>(8)");
+            typedef cc::StripedMap< rcu_map_t
+                , co::hash< hash_int >
+                , co::less< less >
+                , co::mutex_policy< cc::striped_set::seqlock_striping< rcu_gpb, cds::sync::spin, 2 > >
+                , co::resizing_policy< cc::striped_set::load_factor_resizing<0> >
+            >   map_seqlock_resizing_lf;
+            map_seqlock_resizing_lf m( 30, cc::striped_set::load_factor_resizing<0>(8) );
+            test_striped_with( m );
+        }
+
         // Resizing policy
         CPPUNIT_MESSAGE( "load_factor_resizing<0>(1024)");
         {
@@ -653,6 +653,64 @@ namespace set {
         test_int<set_t, less<item> >();
     }
 
+    void CuckooSetHdrTest::Cuckoo_Striped_bucketized_unord()
+    {
+        typedef cc::CuckooSet< item,
+             cc::cuckoo::make_traits<
+                co::mutex_policy< cc::cuckoo::striping<> >
+                ,co::equal_to< equal< item > >
+                ,cc::cuckoo::probeset_type< cc::cuckoo::bucketized<4> >
+                ,co::hash< std::tuple< hash1, hash2 > >
+            >::type
+        > set_t;
+
+        test_int<set_t, equal< item > >();
+    }
+
+    void CuckooSetHdrTest::Cuckoo_Striped_bucketized_less_storehash()
+    {
+        typedef cc::CuckooSet< item,
+             cc::cuckoo::make_traits<
+                co::mutex_policy< cc::cuckoo::striping<> >
+                ,co::less< less< item > >
+                ,cc::cuckoo::store_hash< true >
+                ,cc::cuckoo::probeset_type< cc::cuckoo::bucketized<4> >
+                ,co::hash< std::tuple< hash1, hash2 > >
+            >::type
+        > set_t;
+
+        test_int<set_t, less< item > >();
+    }
+
+    void CuckooSetHdrTest::Cuckoo_Refinable_bucketized_unord()
+    {
+        typedef cc::CuckooSet< item,
+             cc::cuckoo::make_traits<
+                co::mutex_policy< cc::cuckoo::refinable<> >
+                ,co::equal_to< equal< item > >
+                ,cc::cuckoo::probeset_type< cc::cuckoo::bucketized<4> >
+                ,co::hash< std::tuple< hash1, hash2 > >
+            >::type
+        > set_t;
+
+        test_int<set_t, equal< item > >();
+    }
+
+    void CuckooSetHdrTest::Cuckoo_Refinable_bucketized_less_storehash()
+    {
+        typedef cc::CuckooSet< item,
+             cc::cuckoo::make_traits<
+                co::mutex_policy< cc::cuckoo::refinable<> >
+                ,co::less< less< item > >
+                ,cc::cuckoo::store_hash< true >
+                ,cc::cuckoo::probeset_type< cc::cuckoo::bucketized<4> >
+                ,co::hash< std::tuple< hash1, hash2 > >
+            >::type
+        > set_t;
+
+        test_int<set_t, less< item > >();
+    }
+
 } // namespace set
 
 CPPUNIT_TEST_SUITE_REGISTRATION(set::CuckooSetHdrTest);
@@ -562,6 +562,9 @@ namespace set {
         void Cuckoo_Striped_vector_less_cmp_eq();
         void Cuckoo_Striped_vector_less_cmp_eq_storehash();
 
+        void Cuckoo_Striped_bucketized_unord();
+        void Cuckoo_Striped_bucketized_less_storehash();
+
         void Cuckoo_Refinable_list_unord();
         void Cuckoo_Refinable_list_unord_storehash();
         void Cuckoo_Refinable_list_cmp();
@@ -584,6 +587,9 @@ namespace set {
         void Cuckoo_Refinable_vector_less_cmp_eq();
         void Cuckoo_Refinable_vector_less_cmp_eq_storehash();
 
+        void Cuckoo_Refinable_bucketized_unord();
+        void Cuckoo_Refinable_bucketized_less_storehash();
+
         CPPUNIT_TEST_SUITE(CuckooSetHdrTest)
             CPPUNIT_TEST( Cuckoo_Striped_list_unord)
             CPPUNIT_TEST( Cuckoo_Striped_list_unord_storehash)
@@ -606,6 +612,8 @@ namespace set {
             CPPUNIT_TEST( Cuckoo_Striped_vector_less_cmp_storehash)
             CPPUNIT_TEST( Cuckoo_Striped_vector_less_cmp_eq)
             CPPUNIT_TEST( Cuckoo_Striped_vector_less_cmp_eq_storehash)
+            CPPUNIT_TEST( Cuckoo_Striped_bucketized_unord)
+            CPPUNIT_TEST( Cuckoo_Striped_bucketized_less_storehash)
 
             CPPUNIT_TEST( Cuckoo_Refinable_list_unord)
             CPPUNIT_TEST( Cuckoo_Refinable_list_unord_storehash)
@@ -628,6 +636,8 @@ namespace set {
             CPPUNIT_TEST( Cuckoo_Refinable_vector_less_cmp_storehash)
             CPPUNIT_TEST( Cuckoo_Refinable_vector_less_cmp_eq)
             CPPUNIT_TEST( Cuckoo_Refinable_vector_less_cmp_eq_storehash)
+            CPPUNIT_TEST( Cuckoo_Refinable_bucketized_unord)
+            CPPUNIT_TEST( Cuckoo_Refinable_bucketized_less_storehash)
         CPPUNIT_TEST_SUITE_END()
     };
 
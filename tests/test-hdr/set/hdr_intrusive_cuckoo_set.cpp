@@ -30,6 +30,7 @@
 
 #include "set/hdr_intrusive_cuckoo_set.h"
 #include <cds/intrusive/cuckoo_set.h>
+#include <cds/urcu/general_buffered.h>
 
 #include "set/intrusive_cuckoo_set_common.h"
 #include "../unit/print_cuckoo_stat.h"
@@ -634,6 +635,110 @@ namespace set {
         test_cuckoo<set_type>();
     }
 
+    // bucketized probeset
+    void IntrusiveCuckooSetHdrTest::Cuckoo_striped_bucketized_basehook_equal()
+    {
+        typedef IntrusiveCuckooSetHdrTest::base_item< ci::cuckoo::node< ci::cuckoo::bucketized<4>, 0 > >  item_type;
+
+        typedef ci::CuckooSet< item_type
+            ,ci::cuckoo::make_traits<
+                ci::opt::hook< ci::cuckoo::base_hook<
+                    ci::cuckoo::probeset_type< item_type::probeset_type >
+                > >
+                ,co::hash< std::tuple< hash1, hash2 > >
+                ,co::equal_to< equal_to<item_type> >
+            >::type
+        > set_type;
+
+        test_cuckoo<set_type>();
+    }
+
+    void IntrusiveCuckooSetHdrTest::Cuckoo_striped_bucketized_basehook_sort_cmpmix_stat()
+    {
+        typedef IntrusiveCuckooSetHdrTest::base_item< ci::cuckoo::node< ci::cuckoo::bucketized<>, 0 > >  item_type;
+
+        typedef ci::CuckooSet< item_type
+            ,ci::cuckoo::make_traits<
+                ci::opt::hook< ci::cuckoo::base_hook<
+                    ci::cuckoo::probeset_type< item_type::probeset_type >
+                > >
+                ,co::hash< std::tuple< hash1, hash2 > >
+                ,co::less< IntrusiveCuckooSetHdrTest::less<item_type> >
+                ,co::compare< IntrusiveCuckooSetHdrTest::cmp<item_type> >
+                ,co::stat< ci::cuckoo::stat >
+            >::type
+        > set_type;
+
+        // the probeset size and threshold are ignored for bucketized probeset
+        set_type s( 16, 0, 0 );
+        test_with( s );
+        CPPUNIT_MSG( s.statistics() << s.mutex_policy_statistics() );
+    }
+
+    void IntrusiveCuckooSetHdrTest::Cuckoo_striped_bucketized_memberhook_equal_storehash()
+    {
+        typedef ci::cuckoo::node< ci::cuckoo::bucketized<8>, 2 > node_type;
+        typedef IntrusiveCuckooSetHdrTest::member_item< node_type >  item_type;
+
+        typedef ci::CuckooSet< item_type
+            ,ci::cuckoo::make_traits<
+                ci::opt::hook< ci::cuckoo::member_hook< offsetof(item_type, hMember),
+                    ci::cuckoo::probeset_type< node_type::probeset_type >
+                    ,ci::cuckoo::store_hash< node_type::hash_array_size >
+                > >
+                ,co::hash< std::tuple< hash1, hash2 > >
+                ,co::equal_to< equal_to<item_type> >
+            >::type
+        > set_type;
+
+        test_cuckoo<set_type>();
+    }
+
+    // bucketized probeset, lookups without locking
+    namespace {
+        typedef cds::urcu::gc< cds::urcu::general_buffered<> > rcu_gpb;
+    }
+
+    void IntrusiveCuckooSetHdrTest::Cuckoo_optimistic_bucketized_basehook_equal()
+    {
+        typedef IntrusiveCuckooSetHdrTest::base_item< ci::cuckoo::node< ci::cuckoo::bucketized<4>, 0 > >  item_type;
+
+        typedef ci::CuckooSet< item_type
+            ,ci::cuckoo::make_traits<
+                ci::opt::hook< ci::cuckoo::base_hook<
+                    ci::cuckoo::probeset_type< item_type::probeset_type >
+                > >
+                ,co::hash< std::tuple< hash1, hash2 > >
+                ,co::equal_to< equal_to<item_type> >
+                ,co::mutex_policy< ci::cuckoo::optimistic_striping< rcu_gpb > >
+            >::type
+        > set_type;
+
+        test_cuckoo<set_type>();
+    }
+
+    void IntrusiveCuckooSetHdrTest::Cuckoo_optimistic_bucketized_basehook_sort_cmpmix_stat()
+    {
+        typedef IntrusiveCuckooSetHdrTest::base_item< ci::cuckoo::node< ci::cuckoo::bucketized<>, 0 > >  item_type;
+
+        typedef ci::CuckooSet< item_type
+            ,ci::cuckoo::make_traits<
+                ci::opt::hook< ci::cuckoo::base_hook<
+                    ci::cuckoo::probeset_type< item_type::probeset_type >
+                > >
+                ,co::hash< std::tuple< hash1, hash2 > >
+                ,co::less< IntrusiveCuckooSetHdrTest::less<item_type> >
+                ,co::compare< IntrusiveCuckooSetHdrTest::cmp<item_type> >
+                ,co::mutex_policy< ci::cuckoo::optimistic_striping< rcu_gpb, std::recursive_mutex, 2, 2 > >
+                ,co::stat< ci::cuckoo::stat >
+            >::type
+        > set_type;
+
+        set_type s( 16, 0, 0 );
+        test_with( s );
+        CPPUNIT_MSG( s.statistics() << s.mutex_policy_statistics() );
+    }
+
 }   // namespace set
 
 CPPUNIT_TEST_SUITE_REGISTRATION(set::IntrusiveCuckooSetHdrTest);
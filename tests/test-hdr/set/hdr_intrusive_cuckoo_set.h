@@ -531,6 +531,9 @@ namespace set {
         void Cuckoo_striped_list_basehook_sort_cmpmix();
         void Cuckoo_striped_vector_basehook_sort_cmpmix();
         void Cuckoo_striped_vector_basehook_sort_cmpmix_stat();
+        void Cuckoo_striped_bucketized_basehook_equal();
+        void Cuckoo_striped_bucketized_basehook_sort_cmpmix_stat();
+        void Cuckoo_striped_bucketized_memberhook_equal_storehash();
 
         void Cuckoo_striped_list_basehook_equal_storehash();
         void Cuckoo_striped_vector_basehook_equal_storehash();
@@ -571,6 +574,12 @@ namespace set {
         void Cuckoo_refinable_list_basehook_sort_cmpmix();
         void Cuckoo_refinable_vector_basehook_sort_cmpmix();
         void Cuckoo_refinable_vector_basehook_sort_cmpmix_stat();
+        void Cuckoo_refinable_bucketized_basehook_equal();
+        void Cuckoo_refinable_bucketized_basehook_sort_cmpmix_stat();
+        void Cuckoo_refinable_bucketized_memberhook_equal_storehash();
+
+        void Cuckoo_optimistic_bucketized_basehook_equal();
+        void Cuckoo_optimistic_bucketized_basehook_sort_cmpmix_stat();
 
         void Cuckoo_refinable_list_basehook_equal_storehash();
         void Cuckoo_refinable_vector_basehook_equal_storehash();
@@ -612,6 +621,9 @@ namespace set {
             CPPUNIT_TEST( Cuckoo_striped_list_basehook_sort_cmpmix)
             CPPUNIT_TEST( Cuckoo_striped_vector_basehook_sort_cmpmix)
             CPPUNIT_TEST( Cuckoo_striped_vector_basehook_sort_cmpmix_stat)
+            CPPUNIT_TEST( Cuckoo_striped_bucketized_basehook_equal)
+            CPPUNIT_TEST( Cuckoo_striped_bucketized_basehook_sort_cmpmix_stat)
+            CPPUNIT_TEST( Cuckoo_striped_bucketized_memberhook_equal_storehash)
 
             CPPUNIT_TEST( Cuckoo_striped_list_basehook_equal_storehash)
             CPPUNIT_TEST( Cuckoo_striped_vector_basehook_equal_storehash)
@@ -652,6 +664,12 @@ namespace set {
             CPPUNIT_TEST( Cuckoo_refinable_list_basehook_sort_cmpmix)
             CPPUNIT_TEST( Cuckoo_refinable_vector_basehook_sort_cmpmix)
             CPPUNIT_TEST( Cuckoo_refinable_vector_basehook_sort_cmpmix_stat)
+            CPPUNIT_TEST( Cuckoo_refinable_bucketized_basehook_equal)
+            CPPUNIT_TEST( Cuckoo_refinable_bucketized_basehook_sort_cmpmix_stat)
+            CPPUNIT_TEST( Cuckoo_refinable_bucketized_memberhook_equal_storehash)
+
+            CPPUNIT_TEST( Cuckoo_optimistic_bucketized_basehook_equal)
+            CPPUNIT_TEST( Cuckoo_optimistic_bucketized_basehook_sort_cmpmix_stat)
 
             CPPUNIT_TEST( Cuckoo_refinable_list_basehook_equal_storehash)
             CPPUNIT_TEST( Cuckoo_refinable_vector_basehook_equal_storehash)
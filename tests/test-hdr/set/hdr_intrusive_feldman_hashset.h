@@ -32,6 +32,7 @@
 #define CDSTEST_HDR_INTRUSIVE_FELDMAN_HASHSET_H
 
 #include "cppunit/cppunit_proxy.h"
+#include <cds/intrusive/details/feldman_hashset_base.h>
 
 // forward declaration
 namespace cds {
@@ -137,8 +138,32 @@ namespace set {
         };
 
 
+        template <typename Set>
+        void check_level_statistics( Set& s )
+        {
+            std::vector< cds::intrusive::feldman_hashset::level_statistics > level_stat;
+            s.get_level_statistics( level_stat );
+            CPPUNIT_ASSERT( !level_stat.empty());
+
+            bool const bCompressed = std::is_same< typename Set::traits::node_layout, cds::intrusive::feldman_hashset::compressed_layout >::value;
+            for ( auto const& ls : level_stat ) {
+                size_t const nCapacity = ls.array_node_count * ls.node_capacity;
+                CPPUNIT_ASSERT( ls.data_cell_count + ls.array_cell_count + ls.empty_cell_count == nCapacity );
+                if ( bCompressed ) {
+                    CPPUNIT_ASSERT( ls.allocated_cell_count <= nCapacity );
+                    CPPUNIT_ASSERT( ls.allocated_cell_count >= ls.data_cell_count + ls.array_cell_count );
+                }
+                else {
+                    CPPUNIT_ASSERT( ls.allocated_cell_count == nCapacity );
+                }
+            }
+
+            // The head node is always dense
+            CPPUNIT_ASSERT( level_stat[0].allocated_cell_count == level_stat[0].node_capacity );
+        }
+
         template <typename Set, typename Hash>
-        void test_hp( size_t nHeadBits, size_t nArrayBits )
+        void test_hp( size_t nHeadBits, size_t nArrayBits, size_t nMaxHeadBits = 0 )
         {
             typedef typename Set::hash_type hash_type;
             typedef typename Set::value_type value_type;
@@ -154,7 +179,7 @@ namespace set {
             }
             CPPUNIT_ASSERT( arrValue.size() == arrCapacity );
 
-            Set s( nHeadBits, nArrayBits );
+            Set s( nHeadBits, nArrayBits, nMaxHeadBits );
             CPPUNIT_MSG("Array size: head=" << s.head_size() << ", array_node=" << s.array_node_size());
             CPPUNIT_ASSERT(s.head_size() >= (size_t(1) << nHeadBits));
             CPPUNIT_ASSERT(s.array_node_size() == (size_t(1) << nArrayBits));
@@ -167,6 +192,16 @@ namespace set {
                 CPPUNIT_ASSERT(s.contains( el.hash ));
             }
             CPPUNIT_ASSERT(s.size() == arrCapacity );
+            if ( nMaxHeadBits > nHeadBits ) {
+                // the head node should be expanded
+                CPPUNIT_ASSERT( s.head_size() > (size_t(1) << nHeadBits));
+                CPPUNIT_ASSERT( s.head_size() <= (size_t(1) << nMaxHeadBits));
+                std::vector< cds::intrusive::feldman_hashset::level_statistics > level_stat;
+                s.get_level_statistics( level_stat );
+                CPPUNIT_ASSERT( !level_stat.empty());
+                CPPUNIT_ASSERT( level_stat[0].node_capacity == s.head_size());
+            }
+            check_level_statistics( s );
             for ( auto& el : arrValue ) {
                 CPPUNIT_ASSERT(s.contains( el.hash ));
                 CPPUNIT_ASSERT( !s.insert( el ) );
@@ -392,7 +427,7 @@ namespace set {
         }
 
         template <typename Set, typename Hash>
-        void test_rcu(size_t nHeadBits, size_t nArrayBits)
+        void test_rcu(size_t nHeadBits, size_t nArrayBits, size_t nMaxHeadBits = 0)
         {
             typedef typename Set::hash_type hash_type;
             typedef typename Set::value_type value_type;
@@ -409,7 +444,7 @@ namespace set {
             }
             CPPUNIT_ASSERT(arrValue.size() == arrCapacity);
 
-            Set s(nHeadBits, nArrayBits);
+            Set s(nHeadBits, nArrayBits, nMaxHeadBits);
             CPPUNIT_MSG("Array size: head=" << s.head_size() << ", array_node=" << s.array_node_size());
             CPPUNIT_ASSERT(s.head_size() >= (size_t(1) << nHeadBits));
             CPPUNIT_ASSERT(s.array_node_size() == (size_t(1) << nArrayBits));
@@ -422,6 +457,16 @@ namespace set {
                 CPPUNIT_ASSERT(s.contains(el.hash));
             }
             CPPUNIT_ASSERT(s.size() == arrCapacity);
+            if (nMaxHeadBits > nHeadBits) {
+                // the head node should be expanded
+                CPPUNIT_ASSERT(s.head_size() > (size_t(1) << nHeadBits));
+                CPPUNIT_ASSERT(s.head_size() <= (size_t(1) << nMaxHeadBits));
+                std::vector< cds::intrusive::feldman_hashset::level_statistics > level_stat;
+                s.get_level_statistics(level_stat);
+                CPPUNIT_ASSERT(!level_stat.empty());
+                CPPUNIT_ASSERT(level_stat[0].node_capacity == s.head_size());
+            }
+            check_level_statistics( s );
             for (auto& el : arrValue) {
                 CPPUNIT_ASSERT(s.contains(el.hash));
                 CPPUNIT_ASSERT(!s.insert(el));
@@ -638,6 +683,8 @@ namespace set {
         void hp_hash128_stat();
         void hp_hash128_4_3();
         void hp_hash128_4_3_stat();
+        void hp_stdhash_grow_stat();
+        void hp_compressed_stat();
 
         void dhp_nohash();
         void dhp_nohash_stat();
@@ -651,6 +698,8 @@ namespace set {
         void dhp_hash128_stat();
         void dhp_hash128_4_3();
         void dhp_hash128_4_3_stat();
+        void dhp_stdhash_grow_stat();
+        void dhp_compressed_stat();
 
         void rcu_gpi_nohash();
         void rcu_gpi_nohash_stat();
@@ -664,6 +713,8 @@ namespace set {
         void rcu_gpi_hash128_stat();
         void rcu_gpi_hash128_4_3();
         void rcu_gpi_hash128_4_3_stat();
+        void rcu_gpi_stdhash_grow_stat();
+        void rcu_gpi_compressed_stat();
 
         void rcu_gpb_nohash();
         void rcu_gpb_nohash_stat();
@@ -677,6 +728,8 @@ namespace set {
         void rcu_gpb_hash128_stat();
         void rcu_gpb_hash128_4_3();
         void rcu_gpb_hash128_4_3_stat();
+        void rcu_gpb_stdhash_grow_stat();
+        void rcu_gpb_compressed_stat();
 
         void rcu_gpt_nohash();
         void rcu_gpt_nohash_stat();
@@ -690,6 +743,8 @@ namespace set {
         void rcu_gpt_hash128_stat();
         void rcu_gpt_hash128_4_3();
         void rcu_gpt_hash128_4_3_stat();
+        void rcu_gpt_stdhash_grow_stat();
+        void rcu_gpt_compressed_stat();
 
         void rcu_shb_nohash();
         void rcu_shb_nohash_stat();
@@ -703,6 +758,8 @@ namespace set {
         void rcu_shb_hash128_stat();
         void rcu_shb_hash128_4_3();
         void rcu_shb_hash128_4_3_stat();
+        void rcu_shb_stdhash_grow_stat();
+        void rcu_shb_compressed_stat();
 
         void rcu_sht_nohash();
         void rcu_sht_nohash_stat();
@@ -716,6 +773,8 @@ namespace set {
         void rcu_sht_hash128_stat();
         void rcu_sht_hash128_4_3();
         void rcu_sht_hash128_4_3_stat();
+        void rcu_sht_stdhash_grow_stat();
+        void rcu_sht_compressed_stat();
 
         CPPUNIT_TEST_SUITE(IntrusiveFeldmanHashSetHdrTest)
             CPPUNIT_TEST(hp_nohash)
@@ -730,6 +789,8 @@ namespace set {
             CPPUNIT_TEST(hp_hash128_stat)
             CPPUNIT_TEST(hp_hash128_4_3)
             CPPUNIT_TEST(hp_hash128_4_3_stat)
+            CPPUNIT_TEST(hp_stdhash_grow_stat)
+            CPPUNIT_TEST(hp_compressed_stat)
 
             CPPUNIT_TEST(dhp_nohash)
             CPPUNIT_TEST(dhp_nohash_stat)
@@ -743,6 +804,8 @@ namespace set {
             CPPUNIT_TEST(dhp_hash128_stat)
             CPPUNIT_TEST(dhp_hash128_4_3)
             CPPUNIT_TEST(dhp_hash128_4_3_stat)
+            CPPUNIT_TEST(dhp_stdhash_grow_stat)
+            CPPUNIT_TEST(dhp_compressed_stat)
 
             CPPUNIT_TEST(rcu_gpi_nohash)
             CPPUNIT_TEST(rcu_gpi_nohash_stat)
@@ -756,6 +819,8 @@ namespace set {
             CPPUNIT_TEST(rcu_gpi_hash128_stat)
             CPPUNIT_TEST(rcu_gpi_hash128_4_3)
             CPPUNIT_TEST(rcu_gpi_hash128_4_3_stat)
+            CPPUNIT_TEST(rcu_gpi_stdhash_grow_stat)
+            CPPUNIT_TEST(rcu_gpi_compressed_stat)
 
             CPPUNIT_TEST(rcu_gpb_nohash)
             CPPUNIT_TEST(rcu_gpb_nohash_stat)
@@ -769,6 +834,8 @@ namespace set {
             CPPUNIT_TEST(rcu_gpb_hash128_stat)
             CPPUNIT_TEST(rcu_gpb_hash128_4_3)
             CPPUNIT_TEST(rcu_gpb_hash128_4_3_stat)
+            CPPUNIT_TEST(rcu_gpb_stdhash_grow_stat)
+            CPPUNIT_TEST(rcu_gpb_compressed_stat)
 
             CPPUNIT_TEST(rcu_gpt_nohash)
             CPPUNIT_TEST(rcu_gpt_nohash_stat)
@@ -782,6 +849,8 @@ namespace set {
             CPPUNIT_TEST(rcu_gpt_hash128_stat)
             CPPUNIT_TEST(rcu_gpt_hash128_4_3)
             CPPUNIT_TEST(rcu_gpt_hash128_4_3_stat)
+            CPPUNIT_TEST(rcu_gpt_stdhash_grow_stat)
+            CPPUNIT_TEST(rcu_gpt_compressed_stat)
 
             CPPUNIT_TEST(rcu_shb_nohash)
             CPPUNIT_TEST(rcu_shb_nohash_stat)
@@ -795,6 +864,8 @@ namespace set {
             CPPUNIT_TEST(rcu_shb_hash128_stat)
             CPPUNIT_TEST(rcu_shb_hash128_4_3)
             CPPUNIT_TEST(rcu_shb_hash128_4_3_stat)
+            CPPUNIT_TEST(rcu_shb_stdhash_grow_stat)
+            CPPUNIT_TEST(rcu_shb_compressed_stat)
 
             CPPUNIT_TEST(rcu_sht_nohash)
             CPPUNIT_TEST(rcu_sht_nohash_stat)
@@ -808,6 +879,8 @@ namespace set {
             CPPUNIT_TEST(rcu_sht_hash128_stat)
             CPPUNIT_TEST(rcu_sht_hash128_4_3)
             CPPUNIT_TEST(rcu_sht_hash128_4_3_stat)
+            CPPUNIT_TEST(rcu_sht_stdhash_grow_stat)
+            CPPUNIT_TEST(rcu_sht_compressed_stat)
 
         CPPUNIT_TEST_SUITE_END()
 
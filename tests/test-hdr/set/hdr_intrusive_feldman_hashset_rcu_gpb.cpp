@@ -348,4 +348,64 @@ namespace set {
         test_rcu<set_type2, hash_type::make>(4, 3);
     }
 
+    void IntrusiveFeldmanHashSetHdrTest::rcu_gpb_stdhash_grow_stat()
+    {
+        typedef size_t hash_type;
+
+        struct traits: public ci::feldman_hashset::traits
+        {
+            typedef get_hash<hash_type> hash_accessor;
+            typedef item_disposer disposer;
+            typedef ci::feldman_hashset::stat<> stat;
+            static const bool head_growth = true;
+        };
+        typedef ci::FeldmanHashSet< rcu_type, Item<hash_type>, traits > set_type;
+        static_assert(std::is_same< typename set_type::hash_type, size_t>::value, "set::hash_type != size_t!!!" );
+        test_rcu<set_type, std::hash<hash_type>>(4, 2, 12);
+        test_rcu<set_type, std::hash<hash_type>>(4, 3, 16);
+    }
+
+    void IntrusiveFeldmanHashSetHdrTest::rcu_gpb_compressed_stat()
+    {
+        {
+            typedef size_t hash_type;
+
+            struct traits: public ci::feldman_hashset::traits
+            {
+                typedef get_hash<hash_type> hash_accessor;
+                typedef item_disposer disposer;
+                typedef ci::feldman_hashset::stat<> stat;
+                typedef ci::feldman_hashset::compressed_layout node_layout;
+            };
+            typedef ci::FeldmanHashSet< rcu_type, Item<hash_type>, traits > set_type;
+            static_assert(std::is_same< typename set_type::hash_type, size_t>::value, "set::hash_type != size_t!!!" );
+            test_rcu<set_type, std::hash<hash_type>>(4, 3);
+            test_rcu<set_type, std::hash<hash_type>>(4, 6);
+            struct grow_traits: public traits
+            {
+                static const bool head_growth = true;
+            };
+            typedef ci::FeldmanHashSet< rcu_type, Item<hash_type>, grow_traits > grow_set_type;
+            test_rcu<grow_set_type, std::hash<hash_type>>(4, 3, 16);
+        }
+        {
+            typedef hash128 hash_type;
+
+            typedef ci::FeldmanHashSet<
+                rcu_type,
+                Item<hash_type>,
+                typename ci::feldman_hashset::make_traits<
+                    ci::feldman_hashset::hash_accessor< get_hash<hash_type>>
+                    , ci::opt::disposer< item_disposer >
+                    , co::stat< ci::feldman_hashset::stat<>>
+                    , co::compare< hash128::cmp >
+                    , ci::feldman_hashset::node_layout< ci::feldman_hashset::compressed_layout >
+                >::type
+            > set_type;
+            static_assert(std::is_same< typename set_type::hash_type, hash_type>::value, "set::hash_type != hash_type!!!" );
+            test_rcu<set_type, hash_type::make>(4, 3);
+            test_rcu<set_type, hash_type::make>(5, 2);
+        }
+    }
+
 } // namespace set
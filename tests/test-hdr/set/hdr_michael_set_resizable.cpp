@@ -0,0 +1,108 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#include "set/hdr_set.h"
+#include <cds/container/michael_list_hp.h>
+#include <cds/container/michael_list_dhp.h>
+#include <cds/container/michael_list_rcu.h>
+#include <cds/container/lazy_list_hp.h>
+#include <cds/urcu/general_buffered.h>
+#include <cds/urcu/signal_buffered.h>
+#include <cds/container/michael_set_resizable.h>
+
+namespace set {
+
+    namespace {
+        struct set_traits: public cc::michael_set::traits
+        {
+            typedef HashSetHdrTest::hash_int    hash;
+        };
+
+        struct michael_list_traits: public cc::michael_list::traits
+        {
+            typedef HashSetHdrTest::cmp<HashSetHdrTest::item>   compare;
+        };
+
+        struct lazy_list_traits: public cc::lazy_list::traits
+        {
+            typedef HashSetHdrTest::less<HashSetHdrTest::item>   less;
+        };
+    }
+
+    void HashSetHdrTest::Michael_Resizable_HP()
+    {
+        typedef cc::MichaelList< cds::gc::HP, item, michael_list_traits > list;
+
+        // traits-based version
+        typedef cc::ResizableMichaelHashSet< cds::gc::HP, list, set_traits > set;
+        test_int_resizable< set >();
+
+        // option-based version
+        typedef cc::ResizableMichaelHashSet< cds::gc::HP, list,
+            cc::michael_set::make_traits<
+                cc::opt::hash< hash_int >
+            >::type
+        > opt_set;
+        test_int_resizable< opt_set >();
+    }
+
+    void HashSetHdrTest::Michael_Resizable_DHP()
+    {
+        typedef cc::MichaelList< cds::gc::DHP, item, michael_list_traits > list;
+        typedef cc::ResizableMichaelHashSet< cds::gc::DHP, list, set_traits > set;
+        test_int_resizable< set >();
+    }
+
+    void HashSetHdrTest::Michael_Resizable_RCU_GPB()
+    {
+        typedef cds::urcu::gc< cds::urcu::general_buffered<> > rcu_type;
+        typedef cc::MichaelList< rcu_type, item, michael_list_traits > list;
+        typedef cc::ResizableMichaelHashSet< rcu_type, list, set_traits > set;
+        test_int_resizable< set >();
+    }
+
+    void HashSetHdrTest::Michael_Resizable_RCU_SHB()
+    {
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+        typedef cds::urcu::gc< cds::urcu::signal_buffered<> > rcu_type;
+        typedef cc::MichaelList< rcu_type, item, michael_list_traits > list;
+        typedef cc::ResizableMichaelHashSet< rcu_type, list, set_traits > set;
+        test_int_resizable< set >();
+#endif
+    }
+
+    void HashSetHdrTest::Lazy_Resizable_HP()
+    {
+        typedef cc::LazyList< cds::gc::HP, item, lazy_list_traits > list;
+        typedef cc::ResizableMichaelHashSet< cds::gc::HP, list, set_traits > set;
+        test_int_resizable< set >();
+    }
+
+} // namespace set
@@ -1131,6 +1131,171 @@ namespace set {
             CPPUNIT_ASSERT( nCount == nMaxCount );
         }
 
+        template <class Set>
+        void test_int_resizable()
+        {
+            typedef typename Set::value_type value_type;
+
+            // Small initial table: the set must grow several times
+            Set s( 16, 2 );
+            size_t const nInitBucketCount = s.bucket_count();
+            CPPUNIT_ASSERT( s.empty() );
+            CPPUNIT_ASSERT( s.resize_count() == 0 );
+
+            const int nCount = 4000;
+            for ( int i = 0; i < nCount; ++i ) {
+                CPPUNIT_ASSERT( s.insert( i ));
+                CPPUNIT_ASSERT( !s.insert( i ));
+
+                // All items must be reachable while the buckets are being moved
+                if ( i % 256 == 0 ) {
+                    for ( int k = 0; k <= i; ++k )
+                        CPPUNIT_ASSERT( s.contains( k ));
+                }
+            }
+            CPPUNIT_ASSERT( check_size( s, nCount ));
+            CPPUNIT_ASSERT( s.resize_count() > 0 );
+            CPPUNIT_ASSERT( s.bucket_count() > nInitBucketCount );
+
+            for ( int i = 0; i < nCount; ++i ) {
+                CPPUNIT_ASSERT( s.contains( i ));
+                CPPUNIT_ASSERT( s.contains( other_item( i ), other_less() ));
+                CPPUNIT_ASSERT( s.find( i, []( value_type& item, int const& key ) { item.nVal = key * 2; } ));
+            }
+            CPPUNIT_ASSERT( !s.contains( nCount ));
+
+            // update() and the values survive migration
+            for ( int i = nCount; i < nCount * 2; ++i ) {
+                std::pair<bool, bool> ret = s.update( i, []( bool, value_type& item, int const& key ) { item.nVal = key * 2; } );
+                CPPUNIT_ASSERT( ret.first && ret.second );
+            }
+            CPPUNIT_ASSERT( check_size( s, nCount * 2 ));
+            for ( int i = 0; i < nCount * 2; ++i ) {
+                int nVal = -1;
+                CPPUNIT_ASSERT( s.find_with( i, less<value_type>(), [&nVal]( value_type& item, int const& ) { nVal = item.nVal; } ));
+                CPPUNIT_ASSERT( nVal == i * 2 );
+            }
+
+            // erase
+            for ( int i = 0; i < nCount * 2; i += 2 ) {
+                CPPUNIT_ASSERT( s.erase( i ));
+                CPPUNIT_ASSERT( !s.erase( i ));
+            }
+            for ( int i = 1; i < nCount * 2; i += 4 ) {
+                int nVal = -1;
+                CPPUNIT_ASSERT( s.erase_with( other_item( i ), other_less(), [&nVal]( value_type const& item ) { nVal = item.nVal; } ));
+                CPPUNIT_ASSERT( nVal == i * 2 );
+            }
+            CPPUNIT_ASSERT( check_size( s, nCount / 2 ));
+            for ( int i = 0; i < nCount * 2; ++i )
+                CPPUNIT_ASSERT( s.contains( i ) == ( i % 4 == 3 ));
+
+            CPPUNIT_ASSERT( s.emplace( -1, 5 ));
+            CPPUNIT_ASSERT( !s.emplace( -1, 6 ));
+            {
+                int nVal = -1;
+                CPPUNIT_ASSERT( s.find( -1, [&nVal]( value_type& item, int const& ) { nVal = item.nVal; } ));
+                CPPUNIT_ASSERT( nVal == 5 );
+            }
+
+            s.clear();
+            CPPUNIT_ASSERT( s.empty() );
+            CPPUNIT_ASSERT( check_size( s, 0 ));
+            CPPUNIT_ASSERT( !s.is_resizing() );
+            for ( int i = 0; i < nCount; ++i )
+                CPPUNIT_ASSERT( !s.contains( i ));
+        }
+
+        // UnrolledSkipListSet: chunks are split and merged
+        template <class Set>
+        void test_int_unrolled()
+        {
+            typedef typename Set::value_type value_type;
+
+            {
+                Set s;
+                test_int_with( s );
+            }
+
+            Set s;
+            CPPUNIT_ASSERT( s.empty() );
+
+            // The keys are inserted in pseudo-random order to split the chunks at various positions
+            const int nCount = 4000;
+            for ( int i = 0; i < nCount; ++i ) {
+                int const nKey = ( i * 7919 ) % nCount;
+                CPPUNIT_ASSERT( s.insert( nKey ));
+                CPPUNIT_ASSERT( !s.insert( nKey ));
+            }
+            CPPUNIT_ASSERT( !s.empty() );
+            CPPUNIT_ASSERT( check_size( s, nCount ));
+
+            int nPrev = -1;
+            size_t nOrderError = 0;
+            s.for_each( [&nPrev, &nOrderError]( value_type& item ) {
+                if ( item.nKey != nPrev + 1 )
+                    ++nOrderError;
+                nPrev = item.nKey;
+            });
+            CPPUNIT_ASSERT( nOrderError == 0 );
+            CPPUNIT_ASSERT( nPrev == nCount - 1 );
+
+            for ( int i = 0; i < nCount; ++i ) {
+                CPPUNIT_ASSERT( s.contains( i ));
+                CPPUNIT_ASSERT( s.contains( other_item( i ), other_less() ));
+                CPPUNIT_ASSERT( s.find( i, []( value_type& item, int const& key ) { item.nVal = key * 2; } ));
+            }
+            CPPUNIT_ASSERT( !s.contains( nCount ));
+            CPPUNIT_ASSERT( !s.contains( -1 ));
+
+            for ( int i = nCount * 2 - 1; i >= nCount; --i ) {
+                std::pair<bool, bool> ret = s.update( i, []( bool, value_type& item, int const& key ) { item.nVal = key * 2; } );
+                CPPUNIT_ASSERT( ret.first && ret.second );
+            }
+            CPPUNIT_ASSERT( check_size( s, nCount * 2 ));
+            for ( int i = 0; i < nCount * 2; ++i ) {
+                int nVal = -1;
+                CPPUNIT_ASSERT( s.find_with( i, less<value_type>(), [&nVal]( value_type& item, int const& ) { nVal = item.nVal; } ));
+                CPPUNIT_ASSERT( nVal == i * 2 );
+            }
+
+            // Erasing three quarters of the items causes the chunks to be merged
+            for ( int i = 0; i < nCount * 2; i += 2 ) {
+                CPPUNIT_ASSERT( s.erase( i ));
+                CPPUNIT_ASSERT( !s.erase( i ));
+            }
+            for ( int i = 1; i < nCount * 2; i += 4 ) {
+                int nVal = -1;
+                CPPUNIT_ASSERT( s.erase_with( other_item( i ), other_less(), [&nVal]( value_type const& item ) { nVal = item.nVal; } ));
+                CPPUNIT_ASSERT( nVal == i * 2 );
+            }
+            CPPUNIT_ASSERT( check_size( s, nCount / 2 ));
+            for ( int i = 0; i < nCount * 2; ++i )
+                CPPUNIT_ASSERT( s.contains( i ) == ( i % 4 == 3 ));
+
+            nPrev = -1;
+            s.for_each( [&nPrev, &nOrderError]( value_type& item ) {
+                if ( item.nKey != nPrev + 4 || item.nVal != item.nKey * 2 )
+                    ++nOrderError;
+                nPrev = item.nKey;
+            });
+            CPPUNIT_ASSERT( nOrderError == 0 );
+            CPPUNIT_ASSERT( nPrev == nCount * 2 - 1 );
+
+            // Refill the merged chunks
+            for ( int i = 0; i < nCount * 2; i += 4 )
+                CPPUNIT_ASSERT( s.emplace( i, i * 2 ));
+            CPPUNIT_ASSERT( check_size( s, nCount ));
+            for ( int i = 0; i < nCount * 2; ++i )
+                CPPUNIT_ASSERT( s.contains( i ) == ( i % 4 == 0 || i % 4 == 3 ));
+
+            s.clear();
+            CPPUNIT_ASSERT( s.empty() );
+            CPPUNIT_ASSERT( check_size( s, 0 ));
+            for ( int i = 0; i < nCount * 2; ++i )
+                CPPUNIT_ASSERT( !s.contains( i ));
+        }
+
         void Michael_HP_cmp();
         void Michael_HP_less();
         void Michael_HP_cmpmix();
@@ -1163,6 +1328,17 @@ namespace set {
         void Michael_nogc_less();
         void Michael_nogc_cmpmix();
 
+        void Michael_Resizable_HP();
+        void Michael_Resizable_DHP();
+        void Michael_Resizable_RCU_GPB();
+        void Michael_Resizable_RCU_SHB();
+        void Lazy_Resizable_HP();
+
+        void UnrolledSkipList_HP_less();
+        void UnrolledSkipList_HP_cmp_stat();
+        void UnrolledSkipList_DHP_less();
+        void UnrolledSkipList_DHP_cmp_stat();
+
         void Lazy_HP_cmp();
         void Lazy_HP_less();
         void Lazy_HP_cmpmix();
@@ -1310,6 +1486,17 @@ namespace set {
             CPPUNIT_TEST(Michael_nogc_less)
             CPPUNIT_TEST(Michael_nogc_cmpmix)
 
+            CPPUNIT_TEST(Michael_Resizable_HP)
+            CPPUNIT_TEST(Michael_Resizable_DHP)
+            CPPUNIT_TEST(Michael_Resizable_RCU_GPB)
+            CPPUNIT_TEST(Michael_Resizable_RCU_SHB)
+            CPPUNIT_TEST(Lazy_Resizable_HP)
+
+            CPPUNIT_TEST(UnrolledSkipList_HP_less)
+            CPPUNIT_TEST(UnrolledSkipList_HP_cmp_stat)
+            CPPUNIT_TEST(UnrolledSkipList_DHP_less)
+            CPPUNIT_TEST(UnrolledSkipList_DHP_cmp_stat)
+
             CPPUNIT_TEST(Lazy_HP_cmp)
             CPPUNIT_TEST(Lazy_HP_less)
             CPPUNIT_TEST(Lazy_HP_cmpmix)
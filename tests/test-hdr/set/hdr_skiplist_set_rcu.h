@@ -42,6 +42,20 @@ namespace set {
         typedef base_class::other_item  wrapped_item;
         typedef base_class::other_less  wrapped_less;
 
+        struct deferred_stat {
+            size_t  nDisposed;
+            size_t  nDisposedLocked;
+        };
+
+        template <class GC>
+        static void dispose_deferred_stat( void * p )
+        {
+            deferred_stat * pStat = static_cast<deferred_stat *>( p );
+            ++pStat->nDisposed;
+            if ( GC::is_locked() )
+                ++pStat->nDisposedLocked;
+        }
+
         template <class Set, typename PrintStat >
         void test()
         {
@@ -101,6 +115,44 @@ namespace set {
             }
             CPPUNIT_ASSERT( nCount == nLimit );
 
+            // Batch lookup
+            nCount = 0;
+            {
+                typename Set::rcu_batch_lock bl( 16 );
+                CPPUNIT_ASSERT( Set::gc::is_locked() );
+                for ( int i = 0; i < nLimit; ++i ) {
+                    if ( s.contains( bl, arrRandom[i] ))
+                        ++nCount;
+                    CPPUNIT_ASSERT( s.find( bl, arrRandom[i], [this]( typename Set::value_type& v, int const& key ) {
+                        CPPUNIT_ASSERT( v.nKey == key );
+                        CPPUNIT_ASSERT( v.nVal == key * 2 );
+                    }));
+                }
+                CPPUNIT_ASSERT( !s.contains( bl, nLimit ));
+                CPPUNIT_ASSERT( Set::gc::is_locked() );
+            }
+            CPPUNIT_ASSERT( nCount == nLimit );
+            CPPUNIT_ASSERT( !Set::gc::is_locked() );
+
+            // Deferred chains are disposed outside of the batch critical section
+            {
+                deferred_stat stat = { 0, 0 };
+                size_t const nDeferred = Set::rcu_batch_lock::c_nDeferredCapacity + 1;
+                {
+                    typename Set::rcu_batch_lock bl;
+                    for ( size_t i = 0; i < nDeferred; ++i ) {
+                        CPPUNIT_ASSERT( bl.defer( &stat, &dispose_deferred_stat<typename Set::gc> ) == ( i + 1 == nDeferred ));
+                        CPPUNIT_ASSERT( Set::gc::is_locked() );
+                    }
+                    CPPUNIT_ASSERT( stat.nDisposed == nDeferred );
+
+                    CPPUNIT_ASSERT( !bl.defer( &stat, &dispose_deferred_stat<typename Set::gc> ));
+                    CPPUNIT_ASSERT( stat.nDisposed == nDeferred );
+                }
+                CPPUNIT_ASSERT( stat.nDisposed == nDeferred + 1 );
+                CPPUNIT_ASSERT( stat.nDisposedLocked == 0 );
+            }
+
             // Test iterator - descending order
             s.clear();
             CPPUNIT_ASSERT( s.empty() );
@@ -32,6 +32,7 @@
 #include <cds/container/striped_set/std_vector.h>
 #include <cds/container/striped_set.h>
 #include <cds/sync/spinlock.h>
+#include <cds/urcu/general_buffered.h>
 
 namespace set {
 
@@ -47,6 +48,11 @@ namespace set {
         };
 
         typedef std::vector<StripedSetHdrTest::item> sequence_t;
+
+        typedef cds::urcu::gc< cds::urcu::general_buffered<> > rcu_gpb;
+        typedef std::vector< StripedSetHdrTest::item,
+            cc::striped_set::rcu_retired_allocator< rcu_gpb, StripedSetHdrTest::item >
+        > rcu_sequence_t;
     }
 
     void StripedSetHdrTest::Striped_vector()
@@ -85,6 +91,27 @@ namespace set {
         >   set_spin;
         test_striped2< set_spin >();
 
+        // Optimistic reading
+        CPPUNIT_MESSAGE( "seqlock_striping");
+        {
+            typedef cc::StripedSet< rcu_sequence_t
+                , co::hash< hash_int >
+                , co::less< less<item> >
+                , co::mutex_policy< cc::striped_set::seqlock_striping< rcu_gpb > >
+            >   set_seqlock;
+            test_striped2< set_seqlock >();
+
+            CPPUNIT_MESSAGE( "seqlock_striping, load_factor_resizing<0>(8)");
+            typedef cc::StripedSet< rcu_sequence_t
+                , co::hash< hash_int >
+                , co::compare< cmp<item> >
+                , co::mutex_policy< cc::striped_set::seqlock_striping< rcu_gpb, cds::sync::spin, 2 > >
+                , co::resizing_policy< cc::striped_set::load_factor_resizing<0> >
+            >   set_seqlock_resizing_lf;
+            set_seqlock_resizing_lf s( 30, cc::striped_set::load_factor_resizing<0>(8));
+            test_striped_with( s );
+        }
+
         // Resizing policy
         CPPUNIT_MESSAGE( "load_factor_resizing<0>(8)");
         {
@@ -0,0 +1,79 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#include "set/hdr_set.h"
+#include <cds/gc/hp.h>
+#include <cds/gc/dhp.h>
+#include <cds/container/unrolled_skip_list_set.h>
+
+namespace set {
+
+    namespace {
+        struct set_traits: public cc::unrolled_skip_list::traits
+        {
+            typedef HashSetHdrTest::less<HashSetHdrTest::item>  less;
+            typedef cds::atomicity::item_counter                item_counter;
+        };
+
+        // Small chunks: the set is split and merged often
+        typedef cc::unrolled_skip_list::make_traits<
+            co::compare< HashSetHdrTest::cmp<HashSetHdrTest::item> >
+            ,co::item_counter< cds::atomicity::item_counter >
+            ,co::stat< cc::unrolled_skip_list::stat<> >
+            ,cc::unrolled_skip_list::node_capacity< 8 >
+            ,cc::unrolled_skip_list::random_level_generator< cc::unrolled_skip_list::xorshift >
+        >::type set_stat_traits;
+    }
+
+    void HashSetHdrTest::UnrolledSkipList_HP_less()
+    {
+        typedef cc::UnrolledSkipListSet< cds::gc::HP, item, set_traits > set;
+        test_int_unrolled< set >();
+    }
+
+    void HashSetHdrTest::UnrolledSkipList_HP_cmp_stat()
+    {
+        typedef cc::UnrolledSkipListSet< cds::gc::HP, item, set_stat_traits > set;
+        test_int_unrolled< set >();
+    }
+
+    void HashSetHdrTest::UnrolledSkipList_DHP_less()
+    {
+        typedef cc::UnrolledSkipListSet< cds::gc::DHP, item, set_traits > set;
+        test_int_unrolled< set >();
+    }
+
+    void HashSetHdrTest::UnrolledSkipList_DHP_cmp_stat()
+    {
+        typedef cc::UnrolledSkipListSet< cds::gc::DHP, item, set_stat_traits > set;
+        test_int_unrolled< set >();
+    }
+
+} // namespace set
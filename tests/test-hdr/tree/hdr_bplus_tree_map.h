@@ -0,0 +1,172 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#ifndef CDSTEST_HDR_BPLUS_TREE_MAP_H
+#define CDSTEST_HDR_BPLUS_TREE_MAP_H
+
+#include "tree/hdr_bronson_avltree_map.h"
+
+namespace tree {
+
+    // BPlusTreeMap has the same interface as BronsonAVLTreeMap
+    class BPlusTreeHdrTest: public BronsonAVLTreeHdrTest
+    {
+    protected:
+        template <class Map>
+        void test_shape( Map& m )
+        {
+            // ascending, descending and interleaved insertion split the nodes in different ways
+            static int const c_nCount = 2000;
+            for ( int i = 0; i < c_nCount; i += 2 )
+                CPPUNIT_ASSERT( m.insert( i, i * 10 ));
+            for ( int i = c_nCount - 1; i > 0; i -= 2 )
+                CPPUNIT_ASSERT( m.insert( i, i * 10 ));
+            CPPUNIT_CHECK( m.check_consistency( check_functor()));
+            CPPUNIT_ASSERT( check_size( m, c_nCount ));
+
+            int nExpected = 0;
+            size_t nWrong = 0;
+            m.for_each( [&nExpected, &nWrong]( key_type const& k, value_type& v ) {
+                if ( k != nExpected || v.nVal != k * 10 )
+                    ++nWrong;
+                ++nExpected;
+            });
+            CPPUNIT_CHECK( nWrong == 0 );
+            CPPUNIT_CHECK( nExpected == c_nCount );
+
+            // erasing every second key leaves the nodes underfull and causes merges
+            for ( int i = 0; i < c_nCount; i += 2 )
+                CPPUNIT_ASSERT( m.erase( i ));
+            CPPUNIT_CHECK( m.check_consistency( check_functor()));
+            for ( int i = 0; i < c_nCount; ++i )
+                CPPUNIT_CHECK_EX( m.contains( i ) == ( (i & 1) != 0 ), "key=" << i );
+
+            // range scan across many leaves
+            nExpected = 101;
+            nWrong = 0;
+            m.for_each_in_range( 100, 1500, [&nExpected, &nWrong]( key_type const& k, value_type& ) {
+                if ( k != nExpected )
+                    ++nWrong;
+                nExpected += 2;
+            });
+            CPPUNIT_CHECK( nWrong == 0 );
+            CPPUNIT_CHECK( nExpected == 1501 );
+
+            // removing the middle of the key range collapses the tree
+            for ( int i = 1; i < c_nCount - 1; i += 2 )
+                CPPUNIT_ASSERT( m.erase( i ));
+            CPPUNIT_CHECK( m.check_consistency( check_functor()));
+            CPPUNIT_ASSERT( check_size( m, 1 ));
+            CPPUNIT_CHECK( m.contains( c_nCount - 1 ));
+
+            m.clear();
+            CPPUNIT_ASSERT( m.empty());
+        }
+
+        template <class Map, class PrintStat>
+        void test()
+        {
+            Map m;
+
+            test_with( m );
+            test_shape( m );
+
+            m.clear();
+            CPPUNIT_ASSERT( m.empty() );
+            CPPUNIT_ASSERT( check_size( m, 0 ) );
+
+            PrintStat()( m );
+        }
+
+        void BPlusTree_rcu_gpi_less();
+        void BPlusTree_rcu_gpi_less_stat();
+        void BPlusTree_rcu_gpi_cmp_ic();
+        void BPlusTree_rcu_gpi_cmp_ic_stat_cap4();
+        void BPlusTree_rcu_gpi_less_stat_cap8_yield();
+
+        void BPlusTree_rcu_gpb_less();
+        void BPlusTree_rcu_gpb_less_stat();
+        void BPlusTree_rcu_gpb_cmp_ic();
+        void BPlusTree_rcu_gpb_cmp_ic_stat_cap4();
+        void BPlusTree_rcu_gpb_less_stat_cap8_yield();
+
+        void BPlusTree_rcu_gpt_less();
+        void BPlusTree_rcu_gpt_less_stat();
+        void BPlusTree_rcu_gpt_cmp_ic();
+        void BPlusTree_rcu_gpt_cmp_ic_stat_cap4();
+        void BPlusTree_rcu_gpt_less_stat_cap8_yield();
+
+        void BPlusTree_rcu_shb_less();
+        void BPlusTree_rcu_shb_less_stat();
+        void BPlusTree_rcu_shb_cmp_ic();
+        void BPlusTree_rcu_shb_cmp_ic_stat_cap4();
+        void BPlusTree_rcu_shb_less_stat_cap8_yield();
+
+        void BPlusTree_rcu_sht_less();
+        void BPlusTree_rcu_sht_less_stat();
+        void BPlusTree_rcu_sht_cmp_ic();
+        void BPlusTree_rcu_sht_cmp_ic_stat_cap4();
+        void BPlusTree_rcu_sht_less_stat_cap8_yield();
+
+        CPPUNIT_TEST_SUITE( BPlusTreeHdrTest )
+            CPPUNIT_TEST( BPlusTree_rcu_gpi_less )
+            CPPUNIT_TEST( BPlusTree_rcu_gpi_less_stat )
+            CPPUNIT_TEST( BPlusTree_rcu_gpi_cmp_ic )
+            CPPUNIT_TEST( BPlusTree_rcu_gpi_cmp_ic_stat_cap4 )
+            CPPUNIT_TEST( BPlusTree_rcu_gpi_less_stat_cap8_yield )
+
+            CPPUNIT_TEST( BPlusTree_rcu_gpb_less )
+            CPPUNIT_TEST( BPlusTree_rcu_gpb_less_stat )
+            CPPUNIT_TEST( BPlusTree_rcu_gpb_cmp_ic )
+            CPPUNIT_TEST( BPlusTree_rcu_gpb_cmp_ic_stat_cap4 )
+            CPPUNIT_TEST( BPlusTree_rcu_gpb_less_stat_cap8_yield )
+
+            CPPUNIT_TEST( BPlusTree_rcu_gpt_less )
+            CPPUNIT_TEST( BPlusTree_rcu_gpt_less_stat )
+            CPPUNIT_TEST( BPlusTree_rcu_gpt_cmp_ic )
+            CPPUNIT_TEST( BPlusTree_rcu_gpt_cmp_ic_stat_cap4 )
+            CPPUNIT_TEST( BPlusTree_rcu_gpt_less_stat_cap8_yield )
+
+            CPPUNIT_TEST( BPlusTree_rcu_shb_less )
+            CPPUNIT_TEST( BPlusTree_rcu_shb_less_stat )
+            CPPUNIT_TEST( BPlusTree_rcu_shb_cmp_ic )
+            CPPUNIT_TEST( BPlusTree_rcu_shb_cmp_ic_stat_cap4 )
+            CPPUNIT_TEST( BPlusTree_rcu_shb_less_stat_cap8_yield )
+
+            CPPUNIT_TEST( BPlusTree_rcu_sht_less )
+            CPPUNIT_TEST( BPlusTree_rcu_sht_less_stat )
+            CPPUNIT_TEST( BPlusTree_rcu_sht_cmp_ic )
+            CPPUNIT_TEST( BPlusTree_rcu_sht_cmp_ic_stat_cap4 )
+            CPPUNIT_TEST( BPlusTree_rcu_sht_less_stat_cap8_yield )
+        CPPUNIT_TEST_SUITE_END()
+    };
+} // namespace tree
+
+#endif // #ifndef CDSTEST_HDR_BPLUS_TREE_MAP_H
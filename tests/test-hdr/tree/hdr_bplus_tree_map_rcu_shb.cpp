@@ -0,0 +1,127 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#include "tree/hdr_bplus_tree_map.h"
+#include <cds/urcu/signal_buffered.h>
+#include <cds/container/bplus_tree_map_rcu.h>
+
+#include "unit/print_bplus_tree_stat.h"
+
+namespace tree {
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+    namespace cc = cds::container;
+    namespace co = cds::opt;
+    namespace {
+        typedef cds::urcu::gc< cds::urcu::signal_buffered<> > rcu_type;
+
+        struct print_stat {
+            template <typename Tree>
+            void operator()( Tree const& t )
+            {
+                std::cout << t.statistics();
+            }
+        };
+    } // namespace
+#endif
+
+    void BPlusTreeHdrTest::BPlusTree_rcu_shb_less()
+    {
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+        struct traits: public
+            cc::bplus_tree::make_traits<
+                co::less< std::less<key_type> >
+            >::type
+        {};
+        typedef cc::BPlusTreeMap< rcu_type, key_type, value_type, traits > map_type;
+        test<map_type, print_stat>();
+#endif
+    }
+
+    void BPlusTreeHdrTest::BPlusTree_rcu_shb_less_stat()
+    {
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+        struct traits: public
+            cc::bplus_tree::make_traits<
+                co::less< std::less<key_type> >
+                ,co::stat< cc::bplus_tree::stat<> >
+            >::type
+        {};
+        typedef cc::BPlusTreeMap< rcu_type, key_type, value_type, traits > map_type;
+        test<map_type, print_stat>();
+#endif
+    }
+
+    void BPlusTreeHdrTest::BPlusTree_rcu_shb_cmp_ic()
+    {
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+        struct traits: public
+            cc::bplus_tree::make_traits<
+                co::compare< compare >
+                ,co::item_counter< cds::atomicity::item_counter >
+            >::type
+        {};
+        typedef cc::BPlusTreeMap< rcu_type, key_type, value_type, traits > map_type;
+        test<map_type, print_stat>();
+#endif
+    }
+
+    void BPlusTreeHdrTest::BPlusTree_rcu_shb_cmp_ic_stat_cap4()
+    {
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+        struct traits: public
+            cc::bplus_tree::make_traits<
+                co::compare< compare >
+                ,co::item_counter< cds::atomicity::item_counter >
+                ,co::stat< cc::bplus_tree::stat<> >
+                ,cc::bplus_tree::node_capacity< 4 >
+            >::type
+        {};
+        typedef cc::BPlusTreeMap< rcu_type, key_type, value_type, traits > map_type;
+        test<map_type, print_stat>();
+#endif
+    }
+
+    void BPlusTreeHdrTest::BPlusTree_rcu_shb_less_stat_cap8_yield()
+    {
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+        struct traits: public
+            cc::bplus_tree::make_traits<
+                co::less< std::less<key_type> >
+                ,co::stat< cc::bplus_tree::stat<> >
+                ,cc::bplus_tree::node_capacity< 8 >
+                ,co::back_off< cds::backoff::yield >
+            >::type
+        {};
+        typedef cc::BPlusTreeMap< rcu_type, key_type, value_type, traits > map_type;
+        test<map_type, print_stat>();
+#endif
+    }
+
+} // namespace tree
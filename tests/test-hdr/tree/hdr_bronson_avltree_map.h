@@ -35,6 +35,7 @@
 #include "size_check.h"
 #include <functional>   // ref
 #include <algorithm>
+#include <vector>
 
 namespace tree {
     using misc::check_size;
@@ -333,6 +334,18 @@ namespace tree {
                 CPPUNIT_ASSERT( f.m_found.nVal == 471 );
             }
 
+            // batch lookup
+            {
+                typename Set::rcu_batch_lock bl( 1 );
+                CPPUNIT_ASSERT( s.contains( bl, 151 ));
+                CPPUNIT_ASSERT( !s.contains( bl, 190 ));
+
+                copy_found<value_type> f;
+                CPPUNIT_ASSERT( s.find( bl, 174, std::ref( f )));
+                CPPUNIT_ASSERT( f.m_found.nVal == 471 );
+                CPPUNIT_ASSERT( !s.find( bl, 190, std::ref( f )));
+            }
+
             s.clear();
             CPPUNIT_ASSERT( s.empty() );
             CPPUNIT_ASSERT( check_size( s, 0 ) );
@@ -500,6 +513,56 @@ namespace tree {
                 CPPUNIT_CHECK_EX( xp->nVal == keys[i] * c_nStep, "Expected value=" << keys[i] * c_nStep << " real=" << xp->nVal );
             }
             CPPUNIT_ASSERT(s.empty());
+
+            // in-order iteration and range scan
+            for ( int i = 0; i < static_cast<int>(sizeof(keys) / sizeof(keys[0])); ++i )
+                CPPUNIT_ASSERT( s.emplace( keys[i], keys[i] * c_nStep ));
+            CPPUNIT_CHECK( s.check_consistency( check_functor() ));
+            {
+                std::vector<key_type> vKeys;
+                size_t nWrongVal = 0;
+                s.for_each( [&vKeys, &nWrongVal]( key_type const& k, value_type& v ) {
+                    vKeys.push_back( k );
+                    if ( v.nVal != k * c_nStep )
+                        ++nWrongVal;
+                });
+                CPPUNIT_CHECK( nWrongVal == 0 );
+                CPPUNIT_ASSERT( vKeys.size() == sizeof(keys) / sizeof(keys[0]));
+                for ( size_t i = 0; i < vKeys.size(); ++i )
+                    CPPUNIT_CHECK_EX( vKeys[i] == static_cast<key_type>(i), "Expected=" << i << " real=" << vKeys[i] );
+
+                vKeys.clear();
+                s.for_each_in_range( 100, 200, [&vKeys]( key_type const& k, value_type& ) { vKeys.push_back( k ); } );
+                CPPUNIT_ASSERT( vKeys.size() == 100 );
+                for ( size_t i = 0; i < vKeys.size(); ++i )
+                    CPPUNIT_CHECK_EX( vKeys[i] == static_cast<key_type>(i + 100), "Expected=" << i + 100 << " real=" << vKeys[i] );
+
+                // empty and out-of-bounds ranges
+                vKeys.clear();
+                s.for_each_in_range( 500, 500, [&vKeys]( key_type const& k, value_type& ) { vKeys.push_back( k ); } );
+                s.for_each_in_range( 2000, 3000, [&vKeys]( key_type const& k, value_type& ) { vKeys.push_back( k ); } );
+                CPPUNIT_CHECK( vKeys.empty() );
+                s.for_each_in_range( -100, 3, [&vKeys]( key_type const& k, value_type& ) { vKeys.push_back( k ); } );
+                s.for_each_in_range( 998, 3000, [&vKeys]( key_type const& k, value_type& ) { vKeys.push_back( k ); } );
+                CPPUNIT_ASSERT( vKeys.size() == 5 );
+                CPPUNIT_CHECK( vKeys[0] == 0 && vKeys[2] == 2 && vKeys[3] == 998 && vKeys[4] == 999 );
+
+                // the removed items (some of them become routing nodes) must be skipped
+                for ( key_type k = 0; k < static_cast<key_type>(sizeof(keys) / sizeof(keys[0])); k += 2 )
+                    CPPUNIT_ASSERT( s.erase( k ));
+                vKeys.clear();
+                s.for_each_in_range( 10, 21, [&vKeys]( key_type const& k, value_type& ) { vKeys.push_back( k ); } );
+                CPPUNIT_ASSERT( vKeys.size() == 5 );
+                for ( size_t i = 0; i < vKeys.size(); ++i )
+                    CPPUNIT_CHECK_EX( vKeys[i] == static_cast<key_type>(i * 2 + 11), "Expected=" << i * 2 + 11 << " real=" << vKeys[i] );
+
+                vKeys.clear();
+                s.for_each( [&vKeys]( key_type const& k, value_type& ) { vKeys.push_back( k ); } );
+                CPPUNIT_CHECK( vKeys.size() == sizeof(keys) / sizeof(keys[0]) / 2 );
+                CPPUNIT_CHECK( std::is_sorted( vKeys.begin(), vKeys.end()));
+            }
+            s.clear();
+            CPPUNIT_ASSERT(s.empty());
         }
 
         template <class Set, class PrintStat>
@@ -35,6 +35,7 @@
 #include "size_check.h"
 #include <functional>   // ref
 #include <algorithm>
+#include <vector>
 
 namespace tree {
     using misc::check_size;
@@ -592,6 +593,49 @@ namespace tree {
                 CPPUNIT_ASSERT( check_size( m, 0 ));
             }
 
+            // in-order iteration and range scan
+            {
+                data_array arr;
+                fill_map( m, arr );
+
+                std::vector<int> vKeys;
+                m.for_each( [&vKeys]( typename map_type::value_type& item ) { vKeys.push_back( item.first ); } );
+                CPPUNIT_ASSERT( vKeys.size() == c_nItemCount );
+                for ( size_t i = 0; i < vKeys.size(); ++i )
+                    CPPUNIT_CHECK_EX( vKeys[i] == static_cast<int>(i), "Expected=" << i << " real=" << vKeys[i] );
+
+                vKeys.clear();
+                m.for_each_in_range( 100, 200, [&vKeys]( typename map_type::value_type& item ) { vKeys.push_back( item.first ); } );
+                CPPUNIT_ASSERT( vKeys.size() == 100 );
+                for ( size_t i = 0; i < vKeys.size(); ++i )
+                    CPPUNIT_CHECK_EX( vKeys[i] == static_cast<int>(i + 100), "Expected=" << i + 100 << " real=" << vKeys[i] );
+
+                // empty and out-of-bounds ranges
+                vKeys.clear();
+                m.for_each_in_range( 500, 500, [&vKeys]( typename map_type::value_type& item ) { vKeys.push_back( item.first ); } );
+                m.for_each_in_range( static_cast<int>(c_nItemCount), static_cast<int>(c_nItemCount) + 100,
+                    [&vKeys]( typename map_type::value_type& item ) { vKeys.push_back( item.first ); } );
+                CPPUNIT_CHECK( vKeys.empty() );
+                m.for_each_in_range( -100, 3, [&vKeys]( typename map_type::value_type& item ) { vKeys.push_back( item.first ); } );
+                m.for_each_in_range( static_cast<int>(c_nItemCount) - 2, static_cast<int>(c_nItemCount) + 100,
+                    [&vKeys]( typename map_type::value_type& item ) { vKeys.push_back( item.first ); } );
+                CPPUNIT_ASSERT( vKeys.size() == 5 );
+                CPPUNIT_CHECK( vKeys[0] == 0 && vKeys[2] == 2 && vKeys[4] == static_cast<int>(c_nItemCount) - 1 );
+
+                for ( int nKey = 0; nKey < static_cast<int>(c_nItemCount); nKey += 2 )
+                    CPPUNIT_ASSERT( m.erase( nKey ));
+                vKeys.clear();
+                m.for_each_in_range( 10, 21, [&vKeys]( typename map_type::value_type& item ) { vKeys.push_back( item.first ); } );
+                CPPUNIT_ASSERT( vKeys.size() == 5 );
+                for ( size_t i = 0; i < vKeys.size(); ++i )
+                    CPPUNIT_CHECK_EX( vKeys[i] == static_cast<int>(i * 2 + 11), "Expected=" << i * 2 + 11 << " real=" << vKeys[i] );
+
+                m.clear();
+                vKeys.clear();
+                m.for_each( [&vKeys]( typename map_type::value_type& item ) { vKeys.push_back( item.first ); } );
+                CPPUNIT_CHECK( vKeys.empty() );
+            }
+
             PrintStat()( m );
         }
 
@@ -605,6 +605,27 @@ namespace tree {
             CPPUNIT_ASSERT( s.empty() );
             CPPUNIT_ASSERT( check_size( s, 0 ));
 
+            // batch lookup
+            {
+                data_array arr;
+                fill_set( s, arr );
+
+                size_t nFound = 0;
+                {
+                    typename set_type::rcu_batch_lock bl( 8 );
+                    for ( size_t i = 0; i < c_nItemCount; ++i ) {
+                        if ( s.contains( bl, arr[i] ))
+                            ++nFound;
+                        CPPUNIT_ASSERT( s.find( bl, arr[i], [this]( value_type& v, int const& key ) { CPPUNIT_CHECK( v.nKey == key ); } ));
+                    }
+                    CPPUNIT_ASSERT( !s.contains( bl, static_cast<int>( c_nItemCount )));
+                }
+                CPPUNIT_CHECK( nFound == c_nItemCount );
+
+                s.clear();
+                CPPUNIT_ASSERT( s.empty() );
+            }
+
             // extract min/max
             {
                 typename set_type::exempt_ptr ep;
@@ -36,6 +36,7 @@
 #include "tree/hdr_ellenbintree_set.h"
 #include "tree/hdr_ellenbintree_map.h"
 #include "tree/hdr_bronson_avltree_map.h"
+#include "tree/hdr_bplus_tree_map.h"
 
 namespace tree {
     namespace ellen_bintree_rcu {
@@ -57,3 +58,4 @@ CPPUNIT_TEST_SUITE_REGISTRATION_(tree::IntrusiveBinTreeHdrTest, s_IntrusiveBinTr
 CPPUNIT_TEST_SUITE_REGISTRATION_(tree::EllenBinTreeSetHdrTest, s_EllenBinTreeSetHdrTest);
 CPPUNIT_TEST_SUITE_REGISTRATION_(tree::EllenBinTreeMapHdrTest, s_EllenBinTreeMapHdrTest);
 CPPUNIT_TEST_SUITE_REGISTRATION_( tree::BronsonAVLTreeHdrTest, s_BronsonAVLTreeHdrTest );
+CPPUNIT_TEST_SUITE_REGISTRATION_( tree::BPlusTreeHdrTest, s_BPlusTreeHdrTest );
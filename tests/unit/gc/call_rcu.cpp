@@ -0,0 +1,179 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#include "cppunit/thread.h"
+
+#include <cds/urcu/general_instant.h>
+#include <cds/urcu/general_buffered.h>
+#include <cds/urcu/general_threaded.h>
+#include <cds/urcu/call_rcu.h>
+#include <thread>
+#include <chrono>
+
+// call_rcu: every callback queued by concurrent writers is invoked
+namespace gc_call_rcu {
+
+#define TEST_CASE( N, RCU )   void N() { test< RCU >( #N ); }
+
+    namespace {
+        static size_t s_nThreadCount = 4;
+        static size_t s_nCallCount = 10000;
+        static size_t s_nBatchSize = 64;
+
+        struct item {
+            size_t  nKey;
+        };
+
+        static atomics::atomic<size_t>  s_nDisposedCount;
+
+        static void dispose_item( item * p )
+        {
+            s_nDisposedCount.fetch_add( 1, atomics::memory_order_relaxed );
+            delete p;
+        }
+
+        typedef cds::urcu::gc< cds::urcu::general_instant<> >   rcu_gpi;
+        typedef cds::urcu::gc< cds::urcu::general_buffered<> >  rcu_gpb;
+        typedef cds::urcu::gc< cds::urcu::general_threaded<> >  rcu_gpt;
+    }
+
+    class Call_RCU: public CppUnitMini::TestCase
+    {
+        template <class RCU>
+        class Writer: public CppUnitMini::TestThread
+        {
+            cds::urcu::call_rcu< RCU >& m_CallRCU;
+
+            virtual TestThread *    clone()
+            {
+                return new Writer( *this );
+            }
+        public:
+            Writer( CppUnitMini::ThreadPool& pool, cds::urcu::call_rcu< RCU >& callRCU )
+                : CppUnitMini::TestThread( pool )
+                , m_CallRCU( callRCU )
+            {}
+            Writer( Writer& src )
+                : CppUnitMini::TestThread( src )
+                , m_CallRCU( src.m_CallRCU )
+            {}
+
+            virtual void init()
+            {
+                cds::threading::Manager::attachThread();
+            }
+            virtual void fini()
+            {
+                cds::threading::Manager::detachThread();
+            }
+
+            virtual void test()
+            {
+                for ( size_t i = 0; i < s_nCallCount; ++i ) {
+                    item * p = new item;
+                    p->nKey = i;
+                    m_CallRCU.call( p, dispose_item );
+                }
+            }
+        };
+
+    protected:
+        void setUpParams( const CppUnitMini::TestCfg& cfg ) {
+            s_nThreadCount = cfg.getSizeT( "ThreadCount", s_nThreadCount );
+            s_nCallCount = cfg.getSizeT( "CallCount", s_nCallCount );
+            s_nBatchSize = cfg.getSizeT( "BatchSize", s_nBatchSize );
+
+            if ( s_nThreadCount == 0 )
+                s_nThreadCount = 1;
+            if ( s_nCallCount == 0 )
+                s_nCallCount = 1;
+        }
+
+        template <class RCU>
+        void test( char const * pszName )
+        {
+            // The pointers retired by RCU::retire_ptr() are routed to the attached call_rcu object
+            size_t const nRetired = s_nBatchSize;
+            size_t const nTotal = s_nThreadCount * s_nCallCount + nRetired;
+            s_nDisposedCount.store( 0, atomics::memory_order_relaxed );
+
+            CPPUNIT_MSG( "   " << pszName
+                << ", thread count=" << s_nThreadCount
+                << ", call count=" << s_nCallCount
+                << ", batch size=" << s_nBatchSize
+                << " ...");
+            {
+                // The period is long enough, so the worker is woken up by the batch threshold only
+                cds::urcu::call_rcu< RCU > callRCU( s_nBatchSize, 60 * 1000 );
+                CPPUNIT_ASSERT( callRCU.is_attached());
+
+                CppUnitMini::ThreadPool pool( *this );
+                pool.add( new Writer< RCU >( pool, callRCU ), s_nThreadCount );
+                pool.run();
+
+                for ( size_t i = 0; i < nRetired; ++i ) {
+                    item * p = new item;
+                    p->nKey = i;
+                    RCU::retire_ptr( p, dispose_item );
+                }
+
+                // Less than one batch per queue may stay pending
+                size_t const nMaxPending = callRCU.queue_count() * s_nBatchSize;
+                if ( nTotal > nMaxPending ) {
+                    for ( size_t i = 0; i < 10000 && callRCU.invoked_count() < nTotal - nMaxPending; ++i )
+                        std::this_thread::sleep_for( std::chrono::milliseconds( 1 ));
+                    CPPUNIT_CHECK_EX( callRCU.invoked_count() >= nTotal - nMaxPending,
+                        "invoked=" << callRCU.invoked_count() << ", expected at least " << nTotal - nMaxPending );
+                    CPPUNIT_CHECK( callRCU.grace_period_count() > 0 );
+                }
+
+                callRCU.barrier();
+                CPPUNIT_CHECK_EX( callRCU.invoked_count() == nTotal, "invoked=" << callRCU.invoked_count() << ", expected=" << nTotal );
+
+                CPPUNIT_MSG( "     grace periods=" << callRCU.grace_period_count() << ", invoked=" << callRCU.invoked_count() );
+            }
+            CPPUNIT_CHECK_EX( s_nDisposedCount.load( atomics::memory_order_relaxed ) == nTotal,
+                "disposed=" << s_nDisposedCount.load( atomics::memory_order_relaxed ) << ", expected=" << nTotal );
+        }
+
+        TEST_CASE( general_instant, rcu_gpi )
+        TEST_CASE( general_buffered, rcu_gpb )
+        TEST_CASE( general_threaded, rcu_gpt )
+
+        CPPUNIT_TEST_SUITE(Call_RCU)
+            CPPUNIT_TEST(general_instant)
+            CPPUNIT_TEST(general_buffered)
+            CPPUNIT_TEST(general_threaded)
+        CPPUNIT_TEST_SUITE_END();
+    };
+
+} // namespace gc_call_rcu
+
+CPPUNIT_TEST_SUITE_REGISTRATION(gc_call_rcu::Call_RCU);
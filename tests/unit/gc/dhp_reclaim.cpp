@@ -0,0 +1,226 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#include "cppunit/cppunit_proxy.h"
+
+#include <cds/gc/dhp.h>
+#include <memory>
+#include <thread>
+#include <chrono>
+
+// DHP background reclaimer: retiring threads hand the retired buffer to the reclaimer thread
+namespace gc_dhp_reclaim {
+
+    namespace {
+        struct item {
+            size_t  nKey;
+        };
+
+        static atomics::atomic<size_t>  s_nDisposedCount;
+
+        struct counting_disposer {
+            void operator()( item * p ) const
+            {
+                s_nDisposedCount.fetch_add( 1, atomics::memory_order_relaxed );
+                delete p;
+            }
+        };
+
+        // Pinned items are not allocated dynamically
+        struct empty_disposer {
+            void operator()( item * ) const
+            {}
+        };
+    }
+
+    class DHP_Reclaim: public CppUnitMini::TestCase
+    {
+        typedef cds::gc::dhp::GarbageCollector  gc_impl;
+
+        static size_t background_scan_count()
+        {
+            gc_impl::InternalState stat;
+            return gc_impl::instance().getInternalState( stat ).m_nBackgroundScanCount;
+        }
+
+        static size_t inline_scan_count()
+        {
+            gc_impl::InternalState stat;
+            return gc_impl::instance().getInternalState( stat ).m_nInlineScanCount;
+        }
+
+        static size_t magazine_count()
+        {
+            gc_impl::InternalState stat;
+            return gc_impl::instance().getInternalState( stat ).m_nRetiredMagazineCount;
+        }
+
+        static void retire_items( size_t nCount )
+        {
+            for ( size_t i = 0; i < nCount; ++i ) {
+                item * p = new item;
+                p->nKey = i;
+                cds::gc::DHP::retire<counting_disposer>( p );
+            }
+        }
+
+        // The reclaimer thread may own a part of retired pointers, so wait for it too
+        static void flush( size_t nRetiredCount )
+        {
+            for ( size_t nAttempt = 0; nAttempt < 1000 && s_nDisposedCount.load( atomics::memory_order_acquire ) != nRetiredCount; ++nAttempt ) {
+                cds::gc::DHP::scan();
+                if ( s_nDisposedCount.load( atomics::memory_order_acquire ) != nRetiredCount )
+                    std::this_thread::sleep_for( std::chrono::milliseconds( 1 ));
+            }
+        }
+
+        void handoff()
+        {
+            if ( !cds::gc::DHP::isBackgroundReclaim() ) {
+                CPPUNIT_MSG( "     DHP background reclaimer is disabled, see dhp_background_reclaim config key" );
+                return;
+            }
+
+            gc_impl& gc = gc_impl::instance();
+            bool const bStatEnabled = gc.enableStatistics( true );
+
+            // Grow the liberate threshold: scan() cannot free the guarded items and doubles the threshold.
+            // The initial backpressure threshold is reached, so the retiring thread must not scan() inline
+            // for each retired pointer after that
+            size_t const nInitialThreshold = gc.getLiberateThreshold();
+            size_t const nInitialBackpressure = gc.getBackpressureThreshold();
+            {
+                // Each pinned item is retired once and guarded until the threshold is grown
+                size_t const nPinnedCount = nInitialBackpressure;
+                std::unique_ptr< item[] > pinned( new item[ nPinnedCount ] );
+                std::unique_ptr< cds::gc::DHP::Guard[] > guards( new cds::gc::DHP::Guard[ nPinnedCount ] );
+                size_t nPinned = 0;
+                while ( nPinned < nPinnedCount && gc.getLiberateThreshold() < nInitialBackpressure ) {
+                    for ( size_t i = 0; i < nInitialThreshold && nPinned < nPinnedCount; ++i, ++nPinned ) {
+                        pinned[nPinned].nKey = nPinned;
+                        guards[nPinned].assign( &pinned[nPinned] );
+                        cds::gc::DHP::retire<empty_disposer>( &pinned[nPinned] );
+                    }
+                    cds::gc::DHP::scan();
+                }
+                for ( size_t i = 0; i < nPinned; ++i )
+                    guards[i].clear();
+                cds::gc::DHP::scan();
+            }
+
+            size_t const nThreshold = gc.getLiberateThreshold();
+            CPPUNIT_MSG( "     liberate threshold: " << nInitialThreshold << " -> " << nThreshold
+                << ", backpressure threshold: " << nInitialBackpressure << " -> " << gc.getBackpressureThreshold() );
+            CPPUNIT_CHECK_EX( nThreshold >= nInitialBackpressure, "threshold=" << nThreshold << ", initial backpressure=" << nInitialBackpressure );
+            CPPUNIT_CHECK( gc.getBackpressureThreshold() > nThreshold );
+
+            // Retire unguarded items: the buffer reaches the grown liberate threshold and the reclaimer is woken up.
+            // The buffer stays below the backpressure threshold, so the retiring thread never calls scan() inline
+            s_nDisposedCount.store( 0, atomics::memory_order_relaxed );
+            size_t const nBackgroundScan = background_scan_count();
+            size_t const nInlineScan = inline_scan_count();
+            size_t const nRetiredCount = nThreshold * 2;
+            retire_items( nRetiredCount );
+
+            CPPUNIT_CHECK_EX( inline_scan_count() == nInlineScan, "inline scan count: " << inline_scan_count() - nInlineScan );
+
+            for ( size_t nAttempt = 0; nAttempt < 1000 && background_scan_count() == nBackgroundScan; ++nAttempt )
+                std::this_thread::sleep_for( std::chrono::milliseconds( 5 ));
+            CPPUNIT_MSG( "     background scan count: " << background_scan_count() - nBackgroundScan );
+            CPPUNIT_CHECK( background_scan_count() > nBackgroundScan );
+
+            // All retired items must be freed
+            flush( nRetiredCount );
+            CPPUNIT_CHECK_EX( s_nDisposedCount.load( atomics::memory_order_acquire ) == nRetiredCount,
+                "disposed=" << s_nDisposedCount.load( atomics::memory_order_acquire ) << ", retired=" << nRetiredCount );
+
+            gc.enableStatistics( bStatEnabled );
+        }
+
+        // A thread refills its magazine of retired pointer nodes by small batches
+        // even if the pool has a long free list
+        void magazine()
+        {
+            typedef cds::gc::dhp::details::retired_ptr_pool<> pool_type;
+            gc_impl& gc = gc_impl::instance();
+            bool const bStatEnabled = gc.enableStatistics( true );
+            size_t const nMagazineSize = pool_type::c_nMagazineSize;
+
+            // Fill the free lists of the pool
+            size_t const nRetiredCount = gc.getLiberateThreshold() * 4;
+            s_nDisposedCount.store( 0, atomics::memory_order_relaxed );
+            retire_items( nRetiredCount );
+            flush( nRetiredCount );
+            CPPUNIT_CHECK( s_nDisposedCount.load( atomics::memory_order_acquire ) == nRetiredCount );
+
+            s_nDisposedCount.store( 0, atomics::memory_order_relaxed );
+            size_t const nMagazineCount = magazine_count();
+            retire_items( nRetiredCount );
+            size_t const nMagazines = magazine_count() - nMagazineCount;
+            CPPUNIT_MSG( "     magazine size=" << nMagazineSize << ", retired=" << nRetiredCount << ", magazines=" << nMagazines );
+            CPPUNIT_CHECK_EX( nMagazines + 1 >= nRetiredCount / nMagazineSize,
+                "magazines=" << nMagazines << ", expected at least " << nRetiredCount / nMagazineSize - 1 );
+
+            flush( nRetiredCount );
+            CPPUNIT_CHECK_EX( s_nDisposedCount.load( atomics::memory_order_acquire ) == nRetiredCount,
+                "disposed=" << s_nDisposedCount.load( atomics::memory_order_acquire ) << ", retired=" << nRetiredCount );
+
+            gc.enableStatistics( bStatEnabled );
+        }
+
+        // A thread that is not attached to libcds retires into the global pool
+        void unattached()
+        {
+            size_t const nRetiredCount = 1000;
+            s_nDisposedCount.store( 0, atomics::memory_order_relaxed );
+
+            bool bAttached = true;
+            std::thread t( [&bAttached, nRetiredCount]() {
+                bAttached = cds::threading::Manager::isThreadAttached();
+                retire_items( nRetiredCount );
+            });
+            t.join();
+            CPPUNIT_CHECK( !bAttached );
+
+            flush( nRetiredCount );
+            CPPUNIT_CHECK_EX( s_nDisposedCount.load( atomics::memory_order_acquire ) == nRetiredCount,
+                "disposed=" << s_nDisposedCount.load( atomics::memory_order_acquire ) << ", retired=" << nRetiredCount );
+        }
+
+        CPPUNIT_TEST_SUITE(DHP_Reclaim)
+            CPPUNIT_TEST(handoff)
+            CPPUNIT_TEST(magazine)
+            CPPUNIT_TEST(unattached)
+        CPPUNIT_TEST_SUITE_END();
+    };
+
+} // namespace gc_dhp_reclaim
+
+CPPUNIT_TEST_SUITE_REGISTRATION(gc_dhp_reclaim::DHP_Reclaim);
@@ -0,0 +1,117 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#include "cppunit/cppunit_proxy.h"
+
+#include <cds/gc/he.h>
+#include <cds/gc/ebr.h>
+
+// Reclamation telemetry of Hazard Eras and EBR
+namespace gc_telemetry {
+
+    namespace {
+        static size_t s_nRetireCount = 10000;
+
+        struct item {
+            size_t  nKey;
+        };
+
+        static atomics::atomic<size_t>  s_nDisposedCount;
+
+        static void dispose_item( item * p )
+        {
+            s_nDisposedCount.fetch_add( 1, atomics::memory_order_relaxed );
+            delete p;
+        }
+    }
+
+    class GC_Telemetry: public CppUnitMini::TestCase
+    {
+    protected:
+        void setUpParams( const CppUnitMini::TestCfg& cfg ) {
+            s_nRetireCount = cfg.getSizeT( "RetireCount", s_nRetireCount );
+        }
+
+        template <class GC>
+        void test()
+        {
+            s_nDisposedCount.store( 0, atomics::memory_order_relaxed );
+
+            cds::gc::telemetry::snapshot tmStart;
+            GC::get_telemetry( tmStart );
+
+            for ( size_t i = 0; i < s_nRetireCount; ++i ) {
+                item * p = new item;
+                p->nKey = i;
+                GC::retire( p, dispose_item );
+            }
+            for ( size_t nAttempt = 0; nAttempt < 1000 && s_nDisposedCount.load( atomics::memory_order_relaxed ) != s_nRetireCount; ++nAttempt )
+                GC::scan();
+            CPPUNIT_CHECK_EX( s_nDisposedCount.load( atomics::memory_order_relaxed ) == s_nRetireCount,
+                "disposed=" << s_nDisposedCount.load( atomics::memory_order_relaxed ) << ", retired=" << s_nRetireCount );
+
+            cds::gc::telemetry::snapshot tm;
+            GC::get_telemetry( tm );
+            CPPUNIT_MSG( "   telemetry: backlog=" << tm.nRetiredBacklog
+                << ", freed=" << tm.nFreedCount - tmStart.nFreedCount
+                << ", scan count=" << tm.nScanCount - tmStart.nScanCount
+                << ", scan p99=" << tm.scanDuration.percentile( 99.0 ) << " nsec" );
+
+            // The backlog and per-thread state are reported even if the telemetry collector is disabled
+            CPPUNIT_CHECK( tm.nRetiredBacklog == 0 );
+            CPPUNIT_CHECK( !tm.threads.empty() );
+
+            if ( cds::gc::telemetry::gc_collector::c_bEnabled ) {
+                CPPUNIT_CHECK_EX( tm.nFreedCount - tmStart.nFreedCount >= s_nRetireCount,
+                    "freed=" << tm.nFreedCount - tmStart.nFreedCount << ", retired=" << s_nRetireCount );
+                CPPUNIT_CHECK( tm.nScanCount > tmStart.nScanCount );
+                CPPUNIT_CHECK( tm.scanDuration.count() > tmStart.scanDuration.count() );
+            }
+        }
+
+        void HE()
+        {
+            test< cds::gc::HE >();
+        }
+
+        void EBR()
+        {
+            test< cds::gc::EBR >();
+        }
+
+        CPPUNIT_TEST_SUITE(GC_Telemetry)
+            CPPUNIT_TEST(HE)
+            CPPUNIT_TEST(EBR)
+        CPPUNIT_TEST_SUITE_END();
+    };
+
+} // namespace gc_telemetry
+
+CPPUNIT_TEST_SUITE_REGISTRATION(gc_telemetry::GC_Telemetry);
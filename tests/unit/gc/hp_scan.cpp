@@ -0,0 +1,541 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#include "cppunit/thread.h"
+
+#include <cds/gc/hp.h>
+#include <memory>
+#include <vector>
+#include <algorithm>
+
+// Hazard Pointer scan latency depending on thread count
+namespace gc_scan {
+
+#define TEST_CASE( N, S )   void N() { test( cds::gc::HP::scan_type::S, #S ); test_protection( cds::gc::HP::scan_type::S, #S ); }
+
+    namespace {
+        static size_t s_nThreadCount = 8;
+        static size_t s_nGuardPerThread = 4;
+        static size_t s_nScanCount = 1000;
+        static size_t s_nRetiredPerScan = 256;
+
+        static atomics::atomic<size_t>  s_nReadyCount;
+        static atomics::atomic<bool>    s_bStop;
+
+        struct item {
+            size_t  nKey;
+        };
+
+        struct disposer {
+            void operator()( item * p ) const
+            {
+                delete p;
+            }
+        };
+
+        static atomics::atomic<size_t>  s_nDisposedCount;
+
+        struct counting_disposer {
+            void operator()( item * p ) const
+            {
+                s_nDisposedCount.fetch_add( 1, atomics::memory_order_relaxed );
+                delete p;
+            }
+        };
+
+        // Protection check: the items guarded by other threads and their "disposed" flags indexed by item key
+        static size_t const c_nUnguardedKey = static_cast<size_t>( 0 ) - 1;
+        static std::unique_ptr< atomics::atomic<item *>[] > s_arrGuarded;
+        static std::unique_ptr< atomics::atomic<bool>[] >   s_arrDisposed;
+        static atomics::atomic<size_t>  s_nGuardedCount;
+        static atomics::atomic<size_t>  s_nReleasedCount;
+
+        struct flagging_disposer {
+            void operator()( item * p ) const
+            {
+                if ( p->nKey != c_nUnguardedKey )
+                    s_arrDisposed[ p->nKey ].store( true, atomics::memory_order_release );
+                delete p;
+            }
+        };
+    }
+
+    class HP_Scan: public CppUnitMini::TestCase
+    {
+        // The thread protects s_nGuardPerThread items until the scanner is done
+        class Holder: public CppUnitMini::TestThread
+        {
+            virtual TestThread *    clone()
+            {
+                return new Holder( *this );
+            }
+        public:
+            Holder( CppUnitMini::ThreadPool& pool )
+                : CppUnitMini::TestThread( pool )
+            {}
+            Holder( Holder& src )
+                : CppUnitMini::TestThread( src )
+            {}
+
+            virtual void init()
+            {
+                cds::threading::Manager::attachThread();
+            }
+            virtual void fini()
+            {
+                cds::threading::Manager::detachThread();
+            }
+
+            virtual void test()
+            {
+                std::unique_ptr< cds::gc::HP::Guard[] > guards( new cds::gc::HP::Guard[ s_nGuardPerThread ] );
+                std::unique_ptr< item[] > items( new item[ s_nGuardPerThread ] );
+                for ( size_t i = 0; i < s_nGuardPerThread; ++i ) {
+                    items[i].nKey = i;
+                    guards[i].assign( &items[i] );
+                }
+
+                s_nReadyCount.fetch_add( 1, atomics::memory_order_release );
+                while ( !s_bStop.load( atomics::memory_order_acquire ))
+                    cds::backoff::yield()();
+
+                for ( size_t i = 0; i < s_nGuardPerThread; ++i )
+                    guards[i].clear();
+            }
+        };
+
+        // The thread retires s_nRetiredPerScan items and measures HP::scan() duration
+        class Scanner: public CppUnitMini::TestThread
+        {
+            virtual TestThread *    clone()
+            {
+                return new Scanner( *this );
+            }
+        public:
+            size_t  m_nHolderCount;
+            double  m_fScanTime;
+
+        public:
+            Scanner( CppUnitMini::ThreadPool& pool, size_t nHolderCount )
+                : CppUnitMini::TestThread( pool )
+                , m_nHolderCount( nHolderCount )
+                , m_fScanTime( 0 )
+            {}
+            Scanner( Scanner& src )
+                : CppUnitMini::TestThread( src )
+                , m_nHolderCount( src.m_nHolderCount )
+                , m_fScanTime( 0 )
+            {}
+
+            virtual void init()
+            {
+                cds::threading::Manager::attachThread();
+            }
+            virtual void fini()
+            {
+                cds::threading::Manager::detachThread();
+            }
+
+            virtual void test()
+            {
+                while ( s_nReadyCount.load( atomics::memory_order_acquire ) < m_nHolderCount )
+                    cds::backoff::yield()();
+
+                cds::OS::Timer timer;
+                m_fScanTime = 0;
+                for ( size_t nPass = 0; nPass < s_nScanCount; ++nPass ) {
+                    for ( size_t i = 0; i < s_nRetiredPerScan; ++i ) {
+                        item * p = new item;
+                        p->nKey = i;
+                        cds::gc::HP::retire<disposer>( p );
+                    }
+
+                    timer.reset();
+                    cds::gc::HP::scan();
+                    m_fScanTime += timer.duration();
+                }
+
+                s_bStop.store( true, atomics::memory_order_release );
+            }
+        };
+
+        // The thread retires items, some of them are guarded, and measures each HP::retire() duration
+        class Spiller: public CppUnitMini::TestThread
+        {
+            virtual TestThread *    clone()
+            {
+                return new Spiller( *this );
+            }
+        public:
+            std::vector<double> m_arrLatency;
+
+        public:
+            Spiller( CppUnitMini::ThreadPool& pool )
+                : CppUnitMini::TestThread( pool )
+            {}
+            Spiller( Spiller& src )
+                : CppUnitMini::TestThread( src )
+            {}
+
+            virtual void init()
+            {
+                cds::threading::Manager::attachThread();
+            }
+            virtual void fini()
+            {
+                cds::threading::Manager::detachThread();
+            }
+
+            virtual void test()
+            {
+                std::unique_ptr< cds::gc::HP::Guard[] > guards( new cds::gc::HP::Guard[ s_nGuardPerThread ] );
+                m_arrLatency.clear();
+                m_arrLatency.reserve( s_nScanCount * s_nRetiredPerScan );
+
+                cds::OS::Timer timer;
+                for ( size_t nPass = 0; nPass < s_nScanCount; ++nPass ) {
+                    for ( size_t i = 0; i < s_nRetiredPerScan; ++i ) {
+                        item * p = new item;
+                        p->nKey = i;
+                        // Guarded items cannot be freed by the scan
+                        if ( i < s_nGuardPerThread )
+                            guards[i].assign( p );
+
+                        timer.reset();
+                        cds::gc::HP::retire<counting_disposer>( p );
+                        m_arrLatency.push_back( timer.duration() );
+                    }
+                }
+
+                for ( size_t i = 0; i < s_nGuardPerThread; ++i )
+                    guards[i].clear();
+            }
+        };
+
+        // The thread guards s_nGuardPerThread heap items that are retired by Retirer,
+        // the guards are cleared when Retirer has checked that the items are not freed
+        class Guardian: public CppUnitMini::TestThread
+        {
+            virtual TestThread *    clone()
+            {
+                return new Guardian( *this );
+            }
+        public:
+            Guardian( CppUnitMini::ThreadPool& pool )
+                : CppUnitMini::TestThread( pool )
+            {}
+            Guardian( Guardian& src )
+                : CppUnitMini::TestThread( src )
+            {}
+
+            virtual void init()
+            {
+                cds::threading::Manager::attachThread();
+            }
+            virtual void fini()
+            {
+                cds::threading::Manager::detachThread();
+            }
+
+            virtual void test()
+            {
+                std::unique_ptr< cds::gc::HP::Guard[] > guards( new cds::gc::HP::Guard[ s_nGuardPerThread ] );
+                for ( size_t i = 0; i < s_nGuardPerThread; ++i ) {
+                    size_t const nKey = s_nGuardedCount.fetch_add( 1, atomics::memory_order_relaxed );
+                    item * p = new item;
+                    p->nKey = nKey;
+                    guards[i].assign( p );
+                    s_arrGuarded[ nKey ].store( p, atomics::memory_order_release );
+                }
+
+                s_nReadyCount.fetch_add( 1, atomics::memory_order_release );
+                while ( !s_bStop.load( atomics::memory_order_acquire ))
+                    cds::backoff::yield()();
+
+                for ( size_t i = 0; i < s_nGuardPerThread; ++i )
+                    guards[i].clear();
+                s_nReleasedCount.fetch_add( 1, atomics::memory_order_release );
+            }
+        };
+
+        // The thread retires the items guarded by Guardian threads among unguarded ones and checks
+        // that HP::scan() frees the guarded items only after their guards have been cleared
+        class Retirer: public CppUnitMini::TestThread
+        {
+            virtual TestThread *    clone()
+            {
+                return new Retirer( *this );
+            }
+        public:
+            size_t  m_nGuardianCount;
+            size_t  m_nFreedGuarded;    // guarded items freed while they were guarded
+            size_t  m_nNotFreed;        // items not freed after the guards have been cleared
+
+        public:
+            Retirer( CppUnitMini::ThreadPool& pool, size_t nGuardianCount )
+                : CppUnitMini::TestThread( pool )
+                , m_nGuardianCount( nGuardianCount )
+                , m_nFreedGuarded( 0 )
+                , m_nNotFreed( 0 )
+            {}
+            Retirer( Retirer& src )
+                : CppUnitMini::TestThread( src )
+                , m_nGuardianCount( src.m_nGuardianCount )
+                , m_nFreedGuarded( 0 )
+                , m_nNotFreed( 0 )
+            {}
+
+            virtual void init()
+            {
+                cds::threading::Manager::attachThread();
+            }
+            virtual void fini()
+            {
+                cds::threading::Manager::detachThread();
+            }
+
+            virtual void test()
+            {
+                while ( s_nReadyCount.load( atomics::memory_order_acquire ) < m_nGuardianCount )
+                    cds::backoff::yield()();
+
+                size_t const nGuarded = m_nGuardianCount * s_nGuardPerThread;
+                for ( size_t i = 0; i < nGuarded; ++i ) {
+                    cds::gc::HP::retire<flagging_disposer>( s_arrGuarded[i].load( atomics::memory_order_acquire ));
+                    for ( size_t k = 0; k < s_nRetiredPerScan / 4; ++k ) {
+                        item * p = new item;
+                        p->nKey = c_nUnguardedKey;
+                        cds::gc::HP::retire<flagging_disposer>( p );
+                    }
+                }
+
+                for ( size_t nPass = 0; nPass < 4; ++nPass )
+                    cds::gc::HP::scan();
+                for ( size_t i = 0; i < nGuarded; ++i ) {
+                    if ( s_arrDisposed[i].load( atomics::memory_order_acquire ))
+                        ++m_nFreedGuarded;
+                }
+
+                s_bStop.store( true, atomics::memory_order_release );
+                while ( s_nReleasedCount.load( atomics::memory_order_acquire ) < m_nGuardianCount )
+                    cds::backoff::yield()();
+
+                // The items spilled to the orphan list may require several scans
+                for ( size_t nAttempt = 0; nAttempt < 100; ++nAttempt ) {
+                    cds::gc::HP::scan();
+                    m_nNotFreed = 0;
+                    for ( size_t i = 0; i < nGuarded; ++i ) {
+                        if ( !s_arrDisposed[i].load( atomics::memory_order_acquire ))
+                            ++m_nNotFreed;
+                    }
+                    if ( m_nNotFreed == 0 )
+                        break;
+                }
+            }
+        };
+
+    protected:
+        void setUpParams( const CppUnitMini::TestCfg& cfg ) {
+            s_nThreadCount = cfg.getSizeT( "ThreadCount", s_nThreadCount );
+            s_nGuardPerThread = cfg.getSizeT( "GuardPerThread", s_nGuardPerThread );
+            s_nScanCount = cfg.getSizeT( "ScanCount", s_nScanCount );
+            s_nRetiredPerScan = cfg.getSizeT( "RetiredPerScan", s_nRetiredPerScan );
+
+            if ( s_nGuardPerThread == 0 )
+                s_nGuardPerThread = 1;
+            if ( s_nRetiredPerScan == 0 )
+                s_nRetiredPerScan = 1;
+        }
+
+        void test( cds::gc::HP::scan_type nScanType, char const * pszScanType )
+        {
+            if ( !cds::gc::HP::check_available_guards( s_nGuardPerThread, false )) {
+                CPPUNIT_MSG( "Too few hazard pointers per thread, GuardPerThread=" << s_nGuardPerThread );
+                return;
+            }
+            if ( s_nRetiredPerScan * 2 > cds::gc::HP::retired_array_capacity() )
+                s_nRetiredPerScan = cds::gc::HP::retired_array_capacity() / 2;
+
+            cds::gc::HP::scan_type const nPrevScanType = cds::gc::HP::getScanType();
+            cds::gc::HP::setScanType( nScanType );
+
+            for ( size_t nThreadCount = 1; nThreadCount <= s_nThreadCount; nThreadCount *= 2 ) {
+                s_nReadyCount.store( 0, atomics::memory_order_release );
+                s_bStop.store( false, atomics::memory_order_release );
+
+                size_t const nHolderCount = nThreadCount - 1;
+                CppUnitMini::ThreadPool pool( *this );
+                if ( nHolderCount )
+                    pool.add( new Holder( pool ), nHolderCount );
+                pool.add( new Scanner( pool, nHolderCount ), 1 );
+
+                CPPUNIT_MSG( "   Scan type=" << pszScanType
+                    << ", thread count=" << nThreadCount
+                    << ", guarded pointers=" << nHolderCount * s_nGuardPerThread
+                    << ", retired per scan=" << s_nRetiredPerScan
+                    << " ...");
+                pool.run();
+
+                for ( CppUnitMini::ThreadPool::iterator it = pool.begin(); it != pool.end(); ++it ) {
+                    Scanner * pScanner = dynamic_cast<Scanner *>( *it );
+                    if ( pScanner ) {
+                        CPPUNIT_MSG( "     Scan latency=" << pScanner->m_fScanTime * 1000000.0 / s_nScanCount << " mcsec" );
+                    }
+                }
+            }
+
+            cds::gc::HP::setScanType( nPrevScanType );
+        }
+
+        // Checks that the scan does not free the retired items guarded by other threads
+        void test_protection( cds::gc::HP::scan_type nScanType, char const * pszScanType )
+        {
+            if ( !cds::gc::HP::check_available_guards( s_nGuardPerThread, false ))
+                return;
+
+            cds::gc::HP::scan_type const nPrevScanType = cds::gc::HP::getScanType();
+            cds::gc::HP::setScanType( nScanType );
+
+            size_t const nGuardianCount = s_nThreadCount > 1 ? s_nThreadCount - 1 : 1;
+            size_t const nGuarded = nGuardianCount * s_nGuardPerThread;
+            s_arrGuarded.reset( new atomics::atomic<item *>[ nGuarded ] );
+            s_arrDisposed.reset( new atomics::atomic<bool>[ nGuarded ] );
+            for ( size_t i = 0; i < nGuarded; ++i ) {
+                s_arrGuarded[i].store( nullptr, atomics::memory_order_relaxed );
+                s_arrDisposed[i].store( false, atomics::memory_order_relaxed );
+            }
+            s_nGuardedCount.store( 0, atomics::memory_order_relaxed );
+            s_nReleasedCount.store( 0, atomics::memory_order_relaxed );
+            s_nReadyCount.store( 0, atomics::memory_order_relaxed );
+            s_bStop.store( false, atomics::memory_order_release );
+
+            CppUnitMini::ThreadPool pool( *this );
+            pool.add( new Guardian( pool ), nGuardianCount );
+            pool.add( new Retirer( pool, nGuardianCount ), 1 );
+
+            CPPUNIT_MSG( "   Protection check: scan type=" << pszScanType
+                << ", guarded pointers=" << nGuarded << " ..." );
+            pool.run();
+
+            for ( CppUnitMini::ThreadPool::iterator it = pool.begin(); it != pool.end(); ++it ) {
+                Retirer * pRetirer = dynamic_cast<Retirer *>( *it );
+                if ( pRetirer ) {
+                    CPPUNIT_CHECK_EX( pRetirer->m_nFreedGuarded == 0, "scan type=" << pszScanType
+                        << ": guarded items freed=" << pRetirer->m_nFreedGuarded );
+                    CPPUNIT_CHECK_EX( pRetirer->m_nNotFreed == 0, "scan type=" << pszScanType
+                        << ": released items not freed=" << pRetirer->m_nNotFreed );
+                }
+            }
+
+            s_arrGuarded.reset();
+            s_arrDisposed.reset();
+            cds::gc::HP::setScanType( nPrevScanType );
+        }
+
+        void test_spill( size_t nSpillThreshold )
+        {
+            size_t const nPrevThreshold = cds::gc::HP::getSpillThreshold();
+            cds::gc::HP::setSpillThreshold( nSpillThreshold );
+            s_nDisposedCount.store( 0, atomics::memory_order_release );
+
+            cds::gc::telemetry::snapshot tmStart;
+            cds::gc::HP::get_telemetry( tmStart );
+
+            CppUnitMini::ThreadPool pool( *this );
+            pool.add( new Spiller( pool ), s_nThreadCount );
+
+            CPPUNIT_MSG( "   Spill threshold=" << cds::gc::HP::getSpillThreshold()
+                << ", thread count=" << s_nThreadCount
+                << ", guarded pointers per thread=" << s_nGuardPerThread
+                << " ...");
+            pool.run();
+
+            std::vector<double> arrLatency;
+            for ( CppUnitMini::ThreadPool::iterator it = pool.begin(); it != pool.end(); ++it ) {
+                Spiller * pSpiller = static_cast<Spiller *>( *it );
+                arrLatency.insert( arrLatency.end(), pSpiller->m_arrLatency.begin(), pSpiller->m_arrLatency.end() );
+            }
+            if ( !arrLatency.empty() ) {
+                std::vector<double>::iterator itP99 = arrLatency.begin() + arrLatency.size() * 99 / 100;
+                std::nth_element( arrLatency.begin(), itP99, arrLatency.end() );
+                CPPUNIT_MSG( "     retire() latency: p99=" << *itP99 * 1000000.0
+                    << " mcsec, max=" << *std::max_element( itP99, arrLatency.end() ) * 1000000.0 << " mcsec" );
+            }
+
+            // All retired items, including the items spilled to the orphan list, must be freed
+            size_t const nRetiredCount = s_nThreadCount * s_nScanCount * s_nRetiredPerScan;
+            for ( size_t nAttempt = 0; nAttempt < 1000 && s_nDisposedCount.load( atomics::memory_order_acquire ) != nRetiredCount; ++nAttempt )
+                cds::gc::HP::scan();
+            CPPUNIT_CHECK_EX( s_nDisposedCount.load( atomics::memory_order_acquire ) == nRetiredCount,
+                "disposed=" << s_nDisposedCount.load( atomics::memory_order_acquire ) << ", retired=" << nRetiredCount );
+
+            // Telemetry: all retired pointers are counted as freed, the backlog is empty
+            cds::gc::telemetry::snapshot tm;
+            cds::gc::HP::get_telemetry( tm );
+            CPPUNIT_MSG( "     telemetry: backlog=" << tm.nRetiredBacklog
+                << ", scan count=" << tm.nScanCount - tmStart.nScanCount
+                << ", scan p99=" << tm.scanDuration.percentile( 99.0 ) << " nsec"
+                << ", HelpScan adopted=" << tm.nHelpScanAdopted - tmStart.nHelpScanAdopted );
+            CPPUNIT_CHECK( tm.nRetiredBacklog == 0 );
+            if ( cds::gc::telemetry::gc_collector::c_bEnabled ) {
+                CPPUNIT_CHECK_EX( tm.nFreedCount - tmStart.nFreedCount >= nRetiredCount,
+                    "freed=" << tm.nFreedCount - tmStart.nFreedCount << ", retired=" << nRetiredCount );
+                CPPUNIT_CHECK( tm.nScanCount > tmStart.nScanCount );
+            }
+
+            cds::gc::HP::setSpillThreshold( nPrevThreshold );
+        }
+
+        void spill()
+        {
+            if ( !cds::gc::HP::check_available_guards( s_nGuardPerThread, false )) {
+                CPPUNIT_MSG( "Too few hazard pointers per thread, GuardPerThread=" << s_nGuardPerThread );
+                return;
+            }
+
+            test_spill( 0 );
+            test_spill( 1 );
+        }
+
+        TEST_CASE( classic, classic )
+        TEST_CASE( inplace, inplace )
+        TEST_CASE( hashed,  hashed )
+
+        CPPUNIT_TEST_SUITE(HP_Scan)
+            CPPUNIT_TEST(classic)
+            CPPUNIT_TEST(inplace)
+            CPPUNIT_TEST(hashed)
+            CPPUNIT_TEST(spill)
+        CPPUNIT_TEST_SUITE_END();
+    };
+
+} // namespace gc_scan
+
+CPPUNIT_TEST_SUITE_REGISTRATION(gc_scan::HP_Scan);
@@ -0,0 +1,289 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#include "cppunit/thread.h"
+
+#include <cds/urcu/general_instant.h>
+#include <cds/urcu/general_buffered.h>
+#include <algorithm>
+
+// RCU reader throughput and synchronize() latency, normal vs. expedited mode
+namespace gc_rcu_sync {
+
+#define TEST_CASE( N, RCU, EXPEDITED )   void N() { test< RCU >( EXPEDITED, #N ); }
+
+    namespace {
+        static size_t s_nReaderThreadCount = 4;
+        static size_t s_nSyncCount = 1000;
+
+        static size_t const c_nPoison = static_cast<size_t>(0) - 1;
+
+        struct item {
+            size_t  nKey;
+        };
+
+        static atomics::atomic<item *>  s_pShared;
+        static atomics::atomic<bool>    s_bStop;
+        static atomics::atomic<size_t>  s_nReadyCount;
+
+        typedef cds::urcu::gc< cds::urcu::general_instant<> >   rcu_gpi;
+        typedef cds::urcu::gc< cds::urcu::general_buffered<> >  rcu_gpb;
+
+        template <class RCU>
+        struct rcu_maker;
+
+        template <>
+        struct rcu_maker< rcu_gpi > {
+            static void make( bool bExpedited ) { rcu_gpi::rcu_implementation::Construct( bExpedited ); }
+        };
+
+        template <>
+        struct rcu_maker< rcu_gpb > {
+            static void make( bool bExpedited ) { rcu_gpb::rcu_implementation::Construct( 256, bExpedited ); }
+        };
+
+        // The RCU singleton is created by the test framework in normal mode.
+        // The object re-creates the singleton in required mode and restores normal mode in destructor.
+        // The main thread is detached from libcds during the test since its RCU record belongs to old singleton.
+        template <class RCU>
+        struct rcu_mode_setter {
+            explicit rcu_mode_setter( bool bExpedited )
+            {
+                cds::threading::Manager::detachThread();
+                RCU::rcu_implementation::Destruct( true );
+                rcu_maker< RCU >::make( bExpedited );
+                cds::threading::Manager::attachThread();
+            }
+
+            ~rcu_mode_setter()
+            {
+                cds::threading::Manager::detachThread();
+                RCU::rcu_implementation::Destruct( true );
+                rcu_maker< RCU >::make( false );
+                cds::threading::Manager::attachThread();
+            }
+        };
+    }
+
+    class RCU_Sync: public CppUnitMini::TestCase
+    {
+        // The reader reads the shared item inside RCU critical section until the writer is done
+        template <class RCU>
+        class Reader: public CppUnitMini::TestThread
+        {
+            virtual TestThread *    clone()
+            {
+                return new Reader( *this );
+            }
+        public:
+            size_t  m_nReadCount;
+            size_t  m_nViolationCount;
+
+        public:
+            Reader( CppUnitMini::ThreadPool& pool )
+                : CppUnitMini::TestThread( pool )
+                , m_nReadCount( 0 )
+                , m_nViolationCount( 0 )
+            {}
+            Reader( Reader& src )
+                : CppUnitMini::TestThread( src )
+                , m_nReadCount( 0 )
+                , m_nViolationCount( 0 )
+            {}
+
+            virtual void init()
+            {
+                cds::threading::Manager::attachThread();
+            }
+            virtual void fini()
+            {
+                cds::threading::Manager::detachThread();
+            }
+
+            virtual void test()
+            {
+                s_nReadyCount.fetch_add( 1, atomics::memory_order_release );
+                while ( !s_bStop.load( atomics::memory_order_acquire )) {
+                    typename RCU::scoped_lock l;
+                    item * p = s_pShared.load( atomics::memory_order_acquire );
+                    if ( p->nKey == c_nPoison )
+                        ++m_nViolationCount;
+                    ++m_nReadCount;
+                }
+            }
+        };
+
+        // The writer replaces the shared item and measures synchronize() latency
+        template <class RCU>
+        class Writer: public CppUnitMini::TestThread
+        {
+            virtual TestThread *    clone()
+            {
+                return new Writer( *this );
+            }
+        public:
+            std::vector<double> m_arrLatency;
+
+        public:
+            Writer( CppUnitMini::ThreadPool& pool )
+                : CppUnitMini::TestThread( pool )
+            {}
+            Writer( Writer& src )
+                : CppUnitMini::TestThread( src )
+            {}
+
+            virtual void init()
+            {
+                cds::threading::Manager::attachThread();
+            }
+            virtual void fini()
+            {
+                cds::threading::Manager::detachThread();
+            }
+
+            virtual void test()
+            {
+                while ( s_nReadyCount.load( atomics::memory_order_acquire ) < s_nReaderThreadCount )
+                    cds::backoff::yield()();
+
+                m_arrLatency.clear();
+                m_arrLatency.reserve( s_nSyncCount );
+
+                cds::OS::Timer timer;
+                for ( size_t nPass = 0; nPass < s_nSyncCount; ++nPass ) {
+                    item * pNew = new item;
+                    pNew->nKey = nPass;
+                    item * pOld = s_pShared.exchange( pNew, atomics::memory_order_acq_rel );
+
+                    timer.reset();
+                    RCU::synchronize();
+                    m_arrLatency.push_back( timer.duration() );
+
+                    // No reader can see the old item after the grace period
+                    pOld->nKey = c_nPoison;
+                    delete pOld;
+                }
+
+                s_bStop.store( true, atomics::memory_order_release );
+            }
+        };
+
+    protected:
+        void setUpParams( const CppUnitMini::TestCfg& cfg ) {
+            s_nReaderThreadCount = cfg.getSizeT( "ReaderThreadCount", s_nReaderThreadCount );
+            s_nSyncCount = cfg.getSizeT( "SyncCount", s_nSyncCount );
+
+            if ( s_nSyncCount == 0 )
+                s_nSyncCount = 1;
+        }
+
+        template <class RCU>
+        void test( bool bExpedited, char const * pszName )
+        {
+            rcu_mode_setter< RCU > mode( bExpedited );
+            if ( bExpedited && !RCU::is_expedited() ) {
+                CPPUNIT_MSG( "   " << pszName << ": process-wide memory barrier is not supported, test skipped" );
+                return;
+            }
+
+            s_nReadyCount.store( 0, atomics::memory_order_release );
+            s_bStop.store( false, atomics::memory_order_release );
+            item * pFirst = new item;
+            pFirst->nKey = 0;
+            s_pShared.store( pFirst, atomics::memory_order_release );
+
+            cds::gc::telemetry::snapshot tmStart;
+            RCU::get_telemetry( tmStart );
+
+            CppUnitMini::ThreadPool pool( *this );
+            pool.add( new Reader< RCU >( pool ), s_nReaderThreadCount );
+            pool.add( new Writer< RCU >( pool ), 1 );
+
+            CPPUNIT_MSG( "   " << pszName
+                << ", reader thread count=" << s_nReaderThreadCount
+                << ", synchronize count=" << s_nSyncCount
+                << " ...");
+            pool.run();
+
+            size_t nReadCount = 0;
+            size_t nViolationCount = 0;
+            std::vector<double> arrLatency;
+            for ( CppUnitMini::ThreadPool::iterator it = pool.begin(); it != pool.end(); ++it ) {
+                Reader< RCU > * pReader = dynamic_cast< Reader< RCU > *>( *it );
+                if ( pReader ) {
+                    nReadCount += pReader->m_nReadCount;
+                    nViolationCount += pReader->m_nViolationCount;
+                }
+                else {
+                    Writer< RCU > * pWriter = static_cast< Writer< RCU > *>( *it );
+                    arrLatency = pWriter->m_arrLatency;
+                }
+            }
+
+            double fDuration = pool.avgDuration();
+            CPPUNIT_MSG( "     Reader throughput=" << ( fDuration > 0 ? nReadCount / fDuration : 0.0 ) << " reads/sec" );
+            if ( !arrLatency.empty() ) {
+                double fTotal = 0;
+                for ( double f : arrLatency )
+                    fTotal += f;
+                std::vector<double>::iterator itP99 = arrLatency.begin() + arrLatency.size() * 99 / 100;
+                std::nth_element( arrLatency.begin(), itP99, arrLatency.end() );
+                CPPUNIT_MSG( "     synchronize() latency: avg=" << fTotal * 1000000.0 / arrLatency.size()
+                    << " mcsec, p99=" << *itP99 * 1000000.0
+                    << " mcsec, max=" << *std::max_element( itP99, arrLatency.end() ) * 1000000.0 << " mcsec" );
+            }
+            CPPUNIT_CHECK_EX( nViolationCount == 0, "grace period violations=" << nViolationCount );
+
+            cds::gc::telemetry::snapshot tm;
+            RCU::get_telemetry( tm );
+            CPPUNIT_MSG( "     telemetry: grace periods=" << tm.nGracePeriodCount - tmStart.nGracePeriodCount
+                << ", p99=" << tm.gracePeriodLatency.percentile( 99.0 ) << " nsec" );
+            if ( cds::gc::telemetry::gc_collector::c_bEnabled )
+                CPPUNIT_CHECK( tm.nGracePeriodCount - tmStart.nGracePeriodCount >= s_nSyncCount );
+
+            delete s_pShared.exchange( nullptr, atomics::memory_order_acq_rel );
+        }
+
+        TEST_CASE( general_instant, rcu_gpi, false )
+        TEST_CASE( general_instant_expedited, rcu_gpi, true )
+        TEST_CASE( general_buffered, rcu_gpb, false )
+        TEST_CASE( general_buffered_expedited, rcu_gpb, true )
+
+        CPPUNIT_TEST_SUITE(RCU_Sync)
+            CPPUNIT_TEST(general_instant)
+            CPPUNIT_TEST(general_instant_expedited)
+            CPPUNIT_TEST(general_buffered)
+            CPPUNIT_TEST(general_buffered_expedited)
+        CPPUNIT_TEST_SUITE_END();
+    };
+
+} // namespace gc_rcu_sync
+
+CPPUNIT_TEST_SUITE_REGISTRATION(gc_rcu_sync::RCU_Sync);
@@ -85,7 +85,11 @@
     TEST_CASE(tag_MichaelHashMap, MichaelMap_HP_cmp_stdAlloc) \
     TEST_CASE(tag_MichaelHashMap, MichaelMap_HP_less_michaelAlloc) \
     TEST_CASE(tag_MichaelHashMap, MichaelMap_DHP_cmp_stdAlloc) \
+    TEST_CASE(tag_MichaelHashMap, MichaelMap_EBR_cmp_stdAlloc) \
+    TEST_CASE(tag_MichaelHashMap, MichaelMap_HE_cmp_stdAlloc) \
     TEST_CASE(tag_MichaelHashMap, MichaelMap_DHP_less_michaelAlloc) \
+    TEST_CASE(tag_MichaelHashMap, MichaelMap_EBR_less_michaelAlloc) \
+    TEST_CASE(tag_MichaelHashMap, MichaelMap_HE_less_michaelAlloc) \
     TEST_CASE(tag_MichaelHashMap, MichaelMap_RCU_GPI_cmp_stdAlloc) \
     TEST_CASE(tag_MichaelHashMap, MichaelMap_RCU_GPI_less_michaelAlloc) \
     TEST_CASE(tag_MichaelHashMap, MichaelMap_RCU_GPB_cmp_stdAlloc) \
@@ -109,7 +113,11 @@
     CPPUNIT_TEST(MichaelMap_HP_cmp_stdAlloc) \
     CPPUNIT_TEST(MichaelMap_HP_less_michaelAlloc) \
     CPPUNIT_TEST(MichaelMap_DHP_cmp_stdAlloc) \
+    CPPUNIT_TEST(MichaelMap_EBR_cmp_stdAlloc) \
+    CPPUNIT_TEST(MichaelMap_HE_cmp_stdAlloc) \
     CPPUNIT_TEST(MichaelMap_DHP_less_michaelAlloc) \
+    CPPUNIT_TEST(MichaelMap_EBR_less_michaelAlloc) \
+    CPPUNIT_TEST(MichaelMap_HE_less_michaelAlloc) \
     CPPUNIT_TEST(MichaelMap_RCU_GPI_cmp_stdAlloc) \
     CPPUNIT_TEST(MichaelMap_RCU_GPI_less_michaelAlloc) \
     CPPUNIT_TEST(MichaelMap_RCU_GPB_cmp_stdAlloc) \
@@ -388,9 +396,13 @@
     TEST_CASE(tag_SkipListMap, SkipListMap_hp_less_xorshift)\
     TEST_CASE(tag_SkipListMap, SkipListMap_hp_cmp_xorshift_stat)\
     TEST_CASE(tag_SkipListMap, SkipListMap_dhp_less_pascal)\
+    TEST_CASE(tag_SkipListMap, SkipListMap_ebr_less_pascal)\
     TEST_CASE(tag_SkipListMap, SkipListMap_dhp_cmp_pascal_stat)\
+    TEST_CASE(tag_SkipListMap, SkipListMap_ebr_cmp_pascal_stat)\
     TEST_CASE(tag_SkipListMap, SkipListMap_dhp_less_xorshift)\
+    TEST_CASE(tag_SkipListMap, SkipListMap_ebr_less_xorshift)\
     TEST_CASE(tag_SkipListMap, SkipListMap_dhp_cmp_xorshift_stat)\
+    TEST_CASE(tag_SkipListMap, SkipListMap_ebr_cmp_xorshift_stat)\
     TEST_CASE(tag_SkipListMap, SkipListMap_rcu_gpi_less_pascal)\
     TEST_CASE(tag_SkipListMap, SkipListMap_rcu_gpi_cmp_pascal_stat)\
     TEST_CASE(tag_SkipListMap, SkipListMap_rcu_gpi_less_xorshift)\
@@ -411,9 +423,13 @@
     CPPUNIT_TEST(SkipListMap_hp_less_xorshift)\
     CPPUNIT_TEST(SkipListMap_hp_cmp_xorshift_stat)\
     CPPUNIT_TEST(SkipListMap_dhp_less_pascal)\
+    CPPUNIT_TEST(SkipListMap_ebr_less_pascal)\
     CPPUNIT_TEST(SkipListMap_dhp_cmp_pascal_stat)\
+    CPPUNIT_TEST(SkipListMap_ebr_cmp_pascal_stat)\
     CPPUNIT_TEST(SkipListMap_dhp_less_xorshift)\
+    CPPUNIT_TEST(SkipListMap_ebr_less_xorshift)\
     CPPUNIT_TEST(SkipListMap_dhp_cmp_xorshift_stat)\
+    CPPUNIT_TEST(SkipListMap_ebr_cmp_xorshift_stat)\
     CPPUNIT_TEST(SkipListMap_rcu_gpi_less_pascal)\
     CPPUNIT_TEST(SkipListMap_rcu_gpi_cmp_pascal_stat)\
     CPPUNIT_TEST(SkipListMap_rcu_gpi_less_xorshift)\
@@ -645,6 +661,19 @@
     CDSUNIT_TEST_StripedMap_boost_container \
     CDSUNIT_TEST_StripedMap_boost_flat_container
 
+// seqlock_striping requires trivially destructible key and value,
+// so it is tested separately for integral keys only
+#if BOOST_VERSION >= 104800
+#   define CDSUNIT_DECLARE_StripedMap_seqlock \
+        TEST_CASE(tag_StripedMap, StripedMap_boost_flat_map_seqlock)
+
+#   define CDSUNIT_TEST_StripedMap_seqlock \
+        CPPUNIT_TEST(StripedMap_boost_flat_map_seqlock)
+#else
+#   define CDSUNIT_DECLARE_StripedMap_seqlock
+#   define CDSUNIT_TEST_StripedMap_seqlock
+#endif
+
 
 // **************************************************************************************
 // RefinableMap
@@ -653,13 +682,17 @@
     TEST_CASE(tag_StripedMap, RefinableMap_list) \
     TEST_CASE(tag_StripedMap, RefinableMap_map) \
     TEST_CASE(tag_StripedMap, RefinableMap_hashmap) \
-    TEST_CASE(tag_StripedMap, RefinableMap_boost_unordered_map)
+    TEST_CASE(tag_StripedMap, RefinableMap_boost_unordered_map) \
+    TEST_CASE(tag_StripedMap, RefinableMap_list_incremental) \
+    TEST_CASE(tag_StripedMap, RefinableMap_hashmap_incremental)
 
 #define CDSUNIT_TEST_RefinableMap_common \
     CPPUNIT_TEST(RefinableMap_list) \
     CPPUNIT_TEST(RefinableMap_map) \
     CPPUNIT_TEST(RefinableMap_hashmap) \
-    CPPUNIT_TEST(RefinableMap_boost_unordered_map)
+    CPPUNIT_TEST(RefinableMap_boost_unordered_map) \
+    CPPUNIT_TEST(RefinableMap_list_incremental) \
+    CPPUNIT_TEST(RefinableMap_hashmap_incremental)
 
 #if BOOST_VERSION >= 104800
 #   define CDSUNIT_DECLARE_RefinableMap_boost_container \
@@ -725,7 +758,13 @@
     TEST_CASE(tag_CuckooMap, CuckooRefinableMap_list_unord_storehash)\
     TEST_CASE(tag_CuckooMap, CuckooRefinableMap_list_ord_storehash)\
     TEST_CASE(tag_CuckooMap, CuckooRefinableMap_vector_unord_storehash)\
-    TEST_CASE(tag_CuckooMap, CuckooRefinableMap_vector_ord_storehash)
+    TEST_CASE(tag_CuckooMap, CuckooRefinableMap_vector_ord_storehash)\
+    TEST_CASE(tag_CuckooMap, CuckooStripedMap_bucketized_unord)\
+    TEST_CASE(tag_CuckooMap, CuckooStripedMap_bucketized_unord_stat)\
+    TEST_CASE(tag_CuckooMap, CuckooRefinableMap_bucketized_unord)\
+    TEST_CASE(tag_CuckooMap, CuckooRefinableMap_bucketized_unord_stat)\
+    TEST_CASE(tag_CuckooMap, CuckooOptimisticMap_bucketized_unord)\
+    TEST_CASE(tag_CuckooMap, CuckooOptimisticMap_bucketized_unord_stat)
 
 #define CDSUNIT_TEST_CuckooMap \
     CPPUNIT_TEST(CuckooStripedMap_list_unord)\
@@ -751,7 +790,13 @@
     CPPUNIT_TEST(CuckooRefinableMap_vector_unord_storehash)\
     CPPUNIT_TEST(CuckooRefinableMap_vector_ord)\
     CPPUNIT_TEST(CuckooRefinableMap_vector_ord_stat)\
-    CPPUNIT_TEST(CuckooRefinableMap_vector_ord_storehash)
+    CPPUNIT_TEST(CuckooRefinableMap_vector_ord_storehash)\
+    CPPUNIT_TEST(CuckooStripedMap_bucketized_unord)\
+    CPPUNIT_TEST(CuckooStripedMap_bucketized_unord_stat)\
+    CPPUNIT_TEST(CuckooRefinableMap_bucketized_unord)\
+    CPPUNIT_TEST(CuckooRefinableMap_bucketized_unord_stat)\
+    CPPUNIT_TEST(CuckooOptimisticMap_bucketized_unord)\
+    CPPUNIT_TEST(CuckooOptimisticMap_bucketized_unord_stat)
 
 
 // **************************************************************************************
@@ -788,7 +833,9 @@
     TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_hp_fixed) \
     TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_hp_fixed_stat) \
     TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_dhp_fixed) \
+    TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_ebr_fixed) \
     TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_dhp_fixed_stat) \
+    TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_ebr_fixed_stat) \
     TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_rcu_gpi_fixed) \
     TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_rcu_gpi_fixed_stat) \
     TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_rcu_gpb_fixed) \
@@ -801,7 +848,9 @@
     CPPUNIT_TEST(FeldmanHashMap_hp_fixed) \
     CPPUNIT_TEST(FeldmanHashMap_hp_fixed_stat) \
     CPPUNIT_TEST(FeldmanHashMap_dhp_fixed) \
+    CPPUNIT_TEST(FeldmanHashMap_ebr_fixed) \
     CPPUNIT_TEST(FeldmanHashMap_dhp_fixed_stat) \
+    CPPUNIT_TEST(FeldmanHashMap_ebr_fixed_stat) \
     CPPUNIT_TEST(FeldmanHashMap_rcu_gpi_fixed) \
     CPPUNIT_TEST(FeldmanHashMap_rcu_gpi_fixed_stat) \
     CPPUNIT_TEST(FeldmanHashMap_rcu_gpb_fixed) \
@@ -840,7 +889,9 @@
     TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_hp_stdhash) \
     TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_hp_stdhash_stat) \
     TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_dhp_stdhash) \
+    TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_ebr_stdhash) \
     TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_dhp_stdhash_stat) \
+    TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_ebr_stdhash_stat) \
     TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_rcu_gpi_stdhash) \
     TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_rcu_gpi_stdhash_stat) \
     TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_rcu_gpb_stdhash) \
@@ -853,7 +904,9 @@
     CPPUNIT_TEST(FeldmanHashMap_hp_stdhash) \
     CPPUNIT_TEST(FeldmanHashMap_hp_stdhash_stat) \
     CPPUNIT_TEST(FeldmanHashMap_dhp_stdhash) \
+    CPPUNIT_TEST(FeldmanHashMap_ebr_stdhash) \
     CPPUNIT_TEST(FeldmanHashMap_dhp_stdhash_stat) \
+    CPPUNIT_TEST(FeldmanHashMap_ebr_stdhash_stat) \
     CPPUNIT_TEST(FeldmanHashMap_rcu_gpi_stdhash) \
     CPPUNIT_TEST(FeldmanHashMap_rcu_gpi_stdhash_stat) \
     CPPUNIT_TEST(FeldmanHashMap_rcu_gpb_stdhash) \
@@ -878,14 +931,18 @@
 #   define CDSUNIT_DECLARE_FeldmanHashMap_city64_RCU_Signal \
         TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_rcu_shb_city64) \
         TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_rcu_shb_city64_stat) \
+        TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_rcu_shb_city64_compressed_stat) \
         TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_rcu_sht_city64) \
         TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_rcu_sht_city64_stat) \
+        TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_rcu_sht_city64_compressed_stat) \
 
 #   define CDSUNIT_TEST_FeldmanHashMap_city64_RCU_Signal \
         CPPUNIT_TEST(FeldmanHashMap_rcu_shb_city64) \
         CPPUNIT_TEST(FeldmanHashMap_rcu_shb_city64_stat) \
+        CPPUNIT_TEST(FeldmanHashMap_rcu_shb_city64_compressed_stat) \
         CPPUNIT_TEST(FeldmanHashMap_rcu_sht_city64) \
         CPPUNIT_TEST(FeldmanHashMap_rcu_sht_city64_stat) \
+        CPPUNIT_TEST(FeldmanHashMap_rcu_sht_city64_compressed_stat) \
 
 #else
 #   define CDSUNIT_DECLARE_FeldmanHashMap_city64_RCU_Signal
@@ -896,27 +953,43 @@
 #define CDSUNIT_DECLARE_FeldmanHashMap_city64 \
     TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_hp_city64) \
     TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_hp_city64_stat) \
+    TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_hp_city64_compressed_stat) \
     TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_dhp_city64) \
+    TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_ebr_city64) \
     TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_dhp_city64_stat) \
+    TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_ebr_city64_stat) \
+    TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_dhp_city64_compressed_stat) \
+    TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_ebr_city64_compressed_stat) \
     TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_rcu_gpi_city64) \
     TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_rcu_gpi_city64_stat) \
+    TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_rcu_gpi_city64_compressed_stat) \
     TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_rcu_gpb_city64) \
     TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_rcu_gpb_city64_stat) \
+    TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_rcu_gpb_city64_compressed_stat) \
     TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_rcu_gpt_city64) \
     TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_rcu_gpt_city64_stat) \
+    TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_rcu_gpt_city64_compressed_stat) \
     CDSUNIT_DECLARE_FeldmanHashMap_city64_RCU_Signal
 
 #define CDSUNIT_TEST_FeldmanHashMap_city64 \
     CPPUNIT_TEST(FeldmanHashMap_hp_city64) \
     CPPUNIT_TEST(FeldmanHashMap_hp_city64_stat) \
+    CPPUNIT_TEST(FeldmanHashMap_hp_city64_compressed_stat) \
     CPPUNIT_TEST(FeldmanHashMap_dhp_city64) \
+    CPPUNIT_TEST(FeldmanHashMap_ebr_city64) \
     CPPUNIT_TEST(FeldmanHashMap_dhp_city64_stat) \
+    CPPUNIT_TEST(FeldmanHashMap_ebr_city64_stat) \
+    CPPUNIT_TEST(FeldmanHashMap_dhp_city64_compressed_stat) \
+    CPPUNIT_TEST(FeldmanHashMap_ebr_city64_compressed_stat) \
     CPPUNIT_TEST(FeldmanHashMap_rcu_gpi_city64) \
     CPPUNIT_TEST(FeldmanHashMap_rcu_gpi_city64_stat) \
+    CPPUNIT_TEST(FeldmanHashMap_rcu_gpi_city64_compressed_stat) \
     CPPUNIT_TEST(FeldmanHashMap_rcu_gpb_city64) \
     CPPUNIT_TEST(FeldmanHashMap_rcu_gpb_city64_stat) \
+    CPPUNIT_TEST(FeldmanHashMap_rcu_gpb_city64_compressed_stat) \
     CPPUNIT_TEST(FeldmanHashMap_rcu_gpt_city64) \
     CPPUNIT_TEST(FeldmanHashMap_rcu_gpt_city64_stat) \
+    CPPUNIT_TEST(FeldmanHashMap_rcu_gpt_city64_compressed_stat) \
     CDSUNIT_TEST_FeldmanHashMap_city64_RCU_Signal
 
 #undef CDSUNIT_DECLARE_FeldmanHashMap_city128
@@ -947,7 +1020,9 @@
     TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_hp_city128) \
     TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_hp_city128_stat) \
     TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_dhp_city128) \
+    TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_ebr_city128) \
     TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_dhp_city128_stat) \
+    TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_ebr_city128_stat) \
     TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_rcu_gpi_city128) \
     TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_rcu_gpi_city128_stat) \
     TEST_CASE(tag_FeldmanHashMap, FeldmanHashMap_rcu_gpb_city128) \
@@ -960,7 +1035,9 @@
     CPPUNIT_TEST(FeldmanHashMap_hp_city128) \
     CPPUNIT_TEST(FeldmanHashMap_hp_city128_stat) \
     CPPUNIT_TEST(FeldmanHashMap_dhp_city128) \
+    CPPUNIT_TEST(FeldmanHashMap_ebr_city128) \
     CPPUNIT_TEST(FeldmanHashMap_dhp_city128_stat) \
+    CPPUNIT_TEST(FeldmanHashMap_ebr_city128_stat) \
     CPPUNIT_TEST(FeldmanHashMap_rcu_gpi_city128) \
     CPPUNIT_TEST(FeldmanHashMap_rcu_gpi_city128_stat) \
     CPPUNIT_TEST(FeldmanHashMap_rcu_gpb_city128) \
@@ -995,3 +1072,175 @@
     CDSUNIT_TEST_FeldmanHashMap_stdhash \
     CDSUNIT_TEST_FeldmanHashMap_city
 
+
+
+// **************************************************************************************
+// FlatHashMap
+
+#undef CDSUNIT_DECLARE_FlatHashMap
+#undef CDSUNIT_DECLARE_FlatHashMap_RCU_Signal
+#undef CDSUNIT_TEST_FlatHashMap
+#undef CDSUNIT_TEST_FlatHashMap_RCU_Signal
+
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+#   define CDSUNIT_DECLARE_FlatHashMap_RCU_Signal \
+        TEST_CASE(tag_FlatHashMap, FlatHashMap_rcu_shb) \
+        TEST_CASE(tag_FlatHashMap, FlatHashMap_rcu_shb_stat) \
+        TEST_CASE(tag_FlatHashMap, FlatHashMap_rcu_sht) \
+        TEST_CASE(tag_FlatHashMap, FlatHashMap_rcu_sht_stat) \
+
+#   define CDSUNIT_TEST_FlatHashMap_RCU_Signal \
+        CPPUNIT_TEST(FlatHashMap_rcu_shb) \
+        CPPUNIT_TEST(FlatHashMap_rcu_shb_stat) \
+        CPPUNIT_TEST(FlatHashMap_rcu_sht) \
+        CPPUNIT_TEST(FlatHashMap_rcu_sht_stat) \
+
+#else
+#   define CDSUNIT_DECLARE_FlatHashMap_RCU_Signal
+#   define CDSUNIT_TEST_FlatHashMap_RCU_Signal
+#endif
+
+
+#define CDSUNIT_DECLARE_FlatHashMap \
+    TEST_CASE(tag_FlatHashMap, FlatHashMap_hp) \
+    TEST_CASE(tag_FlatHashMap, FlatHashMap_hp_stat) \
+    TEST_CASE(tag_FlatHashMap, FlatHashMap_dhp) \
+    TEST_CASE(tag_FlatHashMap, FlatHashMap_dhp_stat) \
+    TEST_CASE(tag_FlatHashMap, FlatHashMap_rcu_gpi) \
+    TEST_CASE(tag_FlatHashMap, FlatHashMap_rcu_gpi_stat) \
+    TEST_CASE(tag_FlatHashMap, FlatHashMap_rcu_gpb) \
+    TEST_CASE(tag_FlatHashMap, FlatHashMap_rcu_gpb_stat) \
+    TEST_CASE(tag_FlatHashMap, FlatHashMap_rcu_gpt) \
+    TEST_CASE(tag_FlatHashMap, FlatHashMap_rcu_gpt_stat) \
+    CDSUNIT_DECLARE_FlatHashMap_RCU_Signal
+
+#define CDSUNIT_TEST_FlatHashMap \
+    CPPUNIT_TEST(FlatHashMap_hp) \
+    CPPUNIT_TEST(FlatHashMap_hp_stat) \
+    CPPUNIT_TEST(FlatHashMap_dhp) \
+    CPPUNIT_TEST(FlatHashMap_dhp_stat) \
+    CPPUNIT_TEST(FlatHashMap_rcu_gpi) \
+    CPPUNIT_TEST(FlatHashMap_rcu_gpi_stat) \
+    CPPUNIT_TEST(FlatHashMap_rcu_gpb) \
+    CPPUNIT_TEST(FlatHashMap_rcu_gpb_stat) \
+    CPPUNIT_TEST(FlatHashMap_rcu_gpt) \
+    CPPUNIT_TEST(FlatHashMap_rcu_gpt_stat) \
+    CDSUNIT_TEST_FlatHashMap_RCU_Signal
+
+
+// **************************************************************************************
+// UnrolledSkipListMap
+
+#undef CDSUNIT_DECLARE_UnrolledSkipListMap
+#undef CDSUNIT_TEST_UnrolledSkipListMap
+
+#define CDSUNIT_DECLARE_UnrolledSkipListMap \
+    TEST_CASE(tag_UnrolledSkipListMap, UnrolledSkipListMap_hp_less) \
+    TEST_CASE(tag_UnrolledSkipListMap, UnrolledSkipListMap_hp_less_16) \
+    TEST_CASE(tag_UnrolledSkipListMap, UnrolledSkipListMap_hp_less_64) \
+    TEST_CASE(tag_UnrolledSkipListMap, UnrolledSkipListMap_hp_cmp_stat) \
+    TEST_CASE(tag_UnrolledSkipListMap, UnrolledSkipListMap_dhp_less) \
+    TEST_CASE(tag_UnrolledSkipListMap, UnrolledSkipListMap_dhp_less_16) \
+    TEST_CASE(tag_UnrolledSkipListMap, UnrolledSkipListMap_dhp_less_64) \
+    TEST_CASE(tag_UnrolledSkipListMap, UnrolledSkipListMap_dhp_cmp_stat)
+
+#define CDSUNIT_TEST_UnrolledSkipListMap \
+    CPPUNIT_TEST(UnrolledSkipListMap_hp_less) \
+    CPPUNIT_TEST(UnrolledSkipListMap_hp_less_16) \
+    CPPUNIT_TEST(UnrolledSkipListMap_hp_less_64) \
+    CPPUNIT_TEST(UnrolledSkipListMap_hp_cmp_stat) \
+    CPPUNIT_TEST(UnrolledSkipListMap_dhp_less) \
+    CPPUNIT_TEST(UnrolledSkipListMap_dhp_less_16) \
+    CPPUNIT_TEST(UnrolledSkipListMap_dhp_less_64) \
+    CPPUNIT_TEST(UnrolledSkipListMap_dhp_cmp_stat)
+
+// **************************************************************************************
+// BPlusTreeMap
+
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+#   define CDSUNIT_DECLARE_BPlusTreeMap_RCU_signal \
+    TEST_CASE(tag_BPlusTreeMap, BPlusTreeMap_rcu_shb_less) \
+    TEST_CASE(tag_BPlusTreeMap, BPlusTreeMap_rcu_sht_less) \
+    TEST_CASE(tag_BPlusTreeMap, BPlusTreeMap_rcu_shb_less_16) \
+    TEST_CASE(tag_BPlusTreeMap, BPlusTreeMap_rcu_sht_less_16) \
+    TEST_CASE(tag_BPlusTreeMap, BPlusTreeMap_rcu_shb_cmp_stat) \
+    TEST_CASE(tag_BPlusTreeMap, BPlusTreeMap_rcu_sht_cmp_stat)
+#   define CDSUNIT_TEST_BPlusTreeMap_RCU_signal \
+    CPPUNIT_TEST(BPlusTreeMap_rcu_shb_less) \
+    CPPUNIT_TEST(BPlusTreeMap_rcu_sht_less) \
+    CPPUNIT_TEST(BPlusTreeMap_rcu_shb_less_16) \
+    CPPUNIT_TEST(BPlusTreeMap_rcu_sht_less_16) \
+    CPPUNIT_TEST(BPlusTreeMap_rcu_shb_cmp_stat) \
+    CPPUNIT_TEST(BPlusTreeMap_rcu_sht_cmp_stat)
+#else
+#   define CDSUNIT_DECLARE_BPlusTreeMap_RCU_signal
+#   define CDSUNIT_TEST_BPlusTreeMap_RCU_signal
+#endif
+
+#undef CDSUNIT_DECLARE_BPlusTreeMap
+#undef CDSUNIT_TEST_BPlusTreeMap
+
+#define CDSUNIT_DECLARE_BPlusTreeMap \
+    TEST_CASE(tag_BPlusTreeMap, BPlusTreeMap_rcu_gpi_less) \
+    TEST_CASE(tag_BPlusTreeMap, BPlusTreeMap_rcu_gpb_less) \
+    TEST_CASE(tag_BPlusTreeMap, BPlusTreeMap_rcu_gpt_less) \
+    TEST_CASE(tag_BPlusTreeMap, BPlusTreeMap_rcu_gpi_less_16) \
+    TEST_CASE(tag_BPlusTreeMap, BPlusTreeMap_rcu_gpb_less_16) \
+    TEST_CASE(tag_BPlusTreeMap, BPlusTreeMap_rcu_gpt_less_16) \
+    TEST_CASE(tag_BPlusTreeMap, BPlusTreeMap_rcu_gpi_cmp_stat) \
+    TEST_CASE(tag_BPlusTreeMap, BPlusTreeMap_rcu_gpb_cmp_stat) \
+    TEST_CASE(tag_BPlusTreeMap, BPlusTreeMap_rcu_gpt_cmp_stat) \
+    CDSUNIT_DECLARE_BPlusTreeMap_RCU_signal
+
+#define CDSUNIT_TEST_BPlusTreeMap \
+    CPPUNIT_TEST(BPlusTreeMap_rcu_gpi_less) \
+    CPPUNIT_TEST(BPlusTreeMap_rcu_gpb_less) \
+    CPPUNIT_TEST(BPlusTreeMap_rcu_gpt_less) \
+    CPPUNIT_TEST(BPlusTreeMap_rcu_gpi_less_16) \
+    CPPUNIT_TEST(BPlusTreeMap_rcu_gpb_less_16) \
+    CPPUNIT_TEST(BPlusTreeMap_rcu_gpt_less_16) \
+    CPPUNIT_TEST(BPlusTreeMap_rcu_gpi_cmp_stat) \
+    CPPUNIT_TEST(BPlusTreeMap_rcu_gpb_cmp_stat) \
+    CPPUNIT_TEST(BPlusTreeMap_rcu_gpt_cmp_stat) \
+    CDSUNIT_TEST_BPlusTreeMap_RCU_signal
+
+
+// **************************************************************************************
+// ResizableMichaelMap
+
+#undef CDSUNIT_DECLARE_ResizableMichaelMap
+#undef CDSUNIT_TEST_ResizableMichaelMap
+
+#define CDSUNIT_DECLARE_ResizableMichaelMap \
+    TEST_CASE(tag_ResizableMichaelHashMap, ResizableMichaelMap_HP_cmp_stdAlloc) \
+    TEST_CASE(tag_ResizableMichaelHashMap, ResizableMichaelMap_DHP_cmp_stdAlloc) \
+    TEST_CASE(tag_ResizableMichaelHashMap, ResizableMichaelMap_RCU_GPB_cmp_stdAlloc) \
+    TEST_CASE(tag_ResizableMichaelHashMap, ResizableMichaelMap_Lazy_HP_cmp_stdAlloc)
+
+#define CDSUNIT_TEST_ResizableMichaelMap \
+    CPPUNIT_TEST(ResizableMichaelMap_HP_cmp_stdAlloc) \
+    CPPUNIT_TEST(ResizableMichaelMap_DHP_cmp_stdAlloc) \
+    CPPUNIT_TEST(ResizableMichaelMap_RCU_GPB_cmp_stdAlloc) \
+    CPPUNIT_TEST(ResizableMichaelMap_Lazy_HP_cmp_stdAlloc)
+
+// **************************************************************************************
+// BlockSplitListMap
+
+#undef CDSUNIT_DECLARE_BlockSplitListMap
+#undef CDSUNIT_TEST_BlockSplitListMap
+
+#define CDSUNIT_DECLARE_BlockSplitListMap \
+    TEST_CASE(tag_BlockSplitListMap, BlockSplitListMap_hp_less) \
+    TEST_CASE(tag_BlockSplitListMap, BlockSplitListMap_hp_less_32) \
+    TEST_CASE(tag_BlockSplitListMap, BlockSplitListMap_hp_cmp_stat) \
+    TEST_CASE(tag_BlockSplitListMap, BlockSplitListMap_dhp_less) \
+    TEST_CASE(tag_BlockSplitListMap, BlockSplitListMap_dhp_less_32) \
+    TEST_CASE(tag_BlockSplitListMap, BlockSplitListMap_dhp_cmp_stat)
+
+#define CDSUNIT_TEST_BlockSplitListMap \
+    CPPUNIT_TEST(BlockSplitListMap_hp_less) \
+    CPPUNIT_TEST(BlockSplitListMap_hp_less_32) \
+    CPPUNIT_TEST(BlockSplitListMap_hp_cmp_stat) \
+    CPPUNIT_TEST(BlockSplitListMap_dhp_less) \
+    CPPUNIT_TEST(BlockSplitListMap_dhp_less_32) \
+    CPPUNIT_TEST(BlockSplitListMap_dhp_cmp_stat)
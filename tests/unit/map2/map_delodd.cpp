@@ -47,6 +47,7 @@ namespace map2 {
 
         c_nFeldmanMap_HeadBits = cfg.getSizeT("FeldmanMapHeadBits", c_nFeldmanMap_HeadBits);
         c_nFeldmanMap_ArrayBits = cfg.getSizeT("FeldmanMapArrayBits", c_nFeldmanMap_ArrayBits);
+        c_nFeldmanMap_MaxHeadBits = cfg.getSizeT("FeldmanMapMaxHeadBits", c_nFeldmanMap_MaxHeadBits);
 
         if ( c_nInsThreadCount == 0 )
             c_nInsThreadCount = cds::OS::topology::processor_count();
@@ -157,6 +157,7 @@ namespace map2 {
 
         size_t c_nFeldmanMap_HeadBits = 10;
         size_t c_nFeldmanMap_ArrayBits = 4;
+        size_t c_nFeldmanMap_MaxHeadBits = 0;
 
         bool    c_bPrintGCState = true;
 
@@ -0,0 +1,220 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#include "map2/map_type.h"
+#include "cppunit/thread.h"
+
+#include <vector>
+
+// batched find int test in map<int> in mutithreaded mode:
+// find_batch() vs. one-by-one find()
+namespace map2 {
+
+#define TEST_CASE(TAG, X)  void X();
+
+    class Map_find_batch: public CppUnitMini::TestCase
+    {
+    public:
+        size_t c_nThreadCount = 8;     // thread count
+        size_t c_nMapSize = 10000000;  // map size (count of searching item)
+        size_t c_nPercentExists = 50;  // percent of existing keys in searching sequence
+        size_t c_nPassCount = 2;
+        size_t c_nBatchSize = 64;      // count of keys passed to find_batch() at once
+        size_t c_nMaxLoadFactor = 8;   // maximum load factor
+        bool   c_bPrintGCState = true;
+
+        size_t c_nFeldmanMap_HeadBits = 10;
+        size_t c_nFeldmanMap_ArrayBits = 4;
+        size_t c_nFeldmanMap_MaxHeadBits = 0;
+
+        size_t  c_nLoadFactor;  // current load factor
+
+    private:
+        typedef size_t   key_type;
+        typedef size_t   value_type;
+
+        std::vector<key_type>   m_arrKeys;
+        size_t                  m_nRealMapSize;
+
+        void generateSequence();
+
+        template <class Map>
+        class TestThread: public CppUnitMini::TestThread
+        {
+            Map&     m_Map;
+
+            virtual TestThread *    clone()
+            {
+                return new TestThread( *this );
+            }
+        public:
+            size_t  m_nFindSuccess;
+            size_t  m_nBatchSuccess;
+            size_t  m_nBatchFunctorCall;
+            double  m_dFindDuration;
+            double  m_dBatchDuration;
+
+        public:
+            TestThread( CppUnitMini::ThreadPool& pool, Map& rMap )
+                : CppUnitMini::TestThread( pool )
+                , m_Map( rMap )
+            {}
+            TestThread( TestThread& src )
+                : CppUnitMini::TestThread( src )
+                , m_Map( src.m_Map )
+            {}
+
+            Map_find_batch&  getTest()
+            {
+                return reinterpret_cast<Map_find_batch&>( m_Pool.m_Test );
+            }
+
+            virtual void init() { cds::threading::Manager::attachThread()   ; }
+            virtual void fini() { cds::threading::Manager::detachThread()   ; }
+
+            virtual void test()
+            {
+                std::vector<key_type> const& arr = getTest().m_arrKeys;
+                size_t const nPassCount = getTest().c_nPassCount;
+                size_t const nBatchSize = getTest().c_nBatchSize;
+
+                m_nFindSuccess =
+                    m_nBatchSuccess =
+                    m_nBatchFunctorCall = 0;
+                m_dFindDuration =
+                    m_dBatchDuration = 0;
+
+                Map& rMap = m_Map;
+                cds::OS::Timer timer;
+                for ( size_t nPass = 0; nPass < nPassCount; ++nPass ) {
+                    // one-by-one
+                    timer.reset();
+                    for ( auto it = arr.begin(), itEnd = arr.end(); it != itEnd; ++it ) {
+                        if ( rMap.find( *it, []( typename Map::value_type& ) {} ))
+                            ++m_nFindSuccess;
+                    }
+                    m_dFindDuration += timer.duration();
+
+                    // batch
+                    timer.reset();
+                    size_t& nFunctorCall = m_nBatchFunctorCall;
+                    for ( auto it = arr.begin(), itEnd = arr.end(); it != itEnd; ) {
+                        auto itLast = static_cast<size_t>( itEnd - it ) > nBatchSize ? it + nBatchSize : itEnd;
+                        m_nBatchSuccess += rMap.find_batch( it, itLast, [&nFunctorCall]( typename Map::value_type& ) { ++nFunctorCall; } );
+                        it = itLast;
+                    }
+                    m_dBatchDuration += timer.duration();
+                }
+            }
+        };
+
+    protected:
+
+        template <class Map>
+        void find_batch_test( Map& testMap )
+        {
+            typedef TestThread<Map>     Thread;
+            cds::OS::Timer    timer;
+
+            // Fill the map
+            CPPUNIT_MSG( "  Fill map with " << m_nRealMapSize << " items...");
+            timer.reset();
+            for ( size_t i = 0; i < m_nRealMapSize; ++i )
+                CPPUNIT_ASSERT( testMap.insert( i * 13, i ));
+            CPPUNIT_MSG( "   Duration=" << timer.duration() );
+
+            CPPUNIT_MSG( "  Searching, batch size=" << c_nBatchSize << "...");
+            CppUnitMini::ThreadPool pool( *this );
+            pool.add( new Thread( pool, testMap ), c_nThreadCount );
+            pool.run();
+            CPPUNIT_MSG( "   Duration=" << pool.avgDuration() );
+
+            double dFindDuration = 0;
+            double dBatchDuration = 0;
+            for ( CppUnitMini::ThreadPool::iterator it = pool.begin(); it != pool.end(); ++it ) {
+                Thread * pThread = static_cast<Thread *>( *it );
+                CPPUNIT_CHECK( pThread->m_nFindSuccess == m_nRealMapSize * c_nPassCount );
+                CPPUNIT_CHECK( pThread->m_nBatchSuccess == m_nRealMapSize * c_nPassCount );
+                CPPUNIT_CHECK( pThread->m_nBatchFunctorCall == m_nRealMapSize * c_nPassCount );
+                dFindDuration += pThread->m_dFindDuration;
+                dBatchDuration += pThread->m_dBatchDuration;
+            }
+
+            double const nKeyCount = double( m_arrKeys.size() * c_nPassCount * c_nThreadCount );
+            CPPUNIT_MSG( "   find():       " << ( dFindDuration > 0 ? nKeyCount / dFindDuration : 0 ) << " keys/sec, thread duration=" << dFindDuration / c_nThreadCount
+                      << "\n   find_batch(): " << ( dBatchDuration > 0 ? nKeyCount / dBatchDuration : 0 ) << " keys/sec, thread duration=" << dBatchDuration / c_nThreadCount );
+
+            check_before_cleanup( testMap );
+
+            testMap.clear();
+            additional_check( testMap );
+            print_stat( testMap );
+            additional_cleanup( testMap );
+        }
+
+        template <class Map>
+        void run_test()
+        {
+            if ( Map::c_bLoadFactorDepended ) {
+                for ( c_nLoadFactor = 1; c_nLoadFactor <= c_nMaxLoadFactor; c_nLoadFactor *= 2 ) {
+                    CPPUNIT_MSG( "Load factor=" << c_nLoadFactor );
+                    Map  testMap( *this );
+                    find_batch_test( testMap );
+                    if ( c_bPrintGCState )
+                        print_gc_state();
+                }
+            }
+            else {
+                Map testMap( *this );
+                find_batch_test( testMap );
+                if ( c_bPrintGCState )
+                    print_gc_state();
+            }
+        }
+
+        void setUpParams( const CppUnitMini::TestCfg& cfg );
+
+    public:
+        Map_find_batch()
+            : c_nLoadFactor(2)
+        {}
+
+#   include "map2/map_defs.h"
+        CDSUNIT_DECLARE_MichaelMap
+        CDSUNIT_DECLARE_SplitList
+        CDSUNIT_DECLARE_FeldmanHashMap
+
+        CPPUNIT_TEST_SUITE(Map_find_batch)
+            CDSUNIT_TEST_MichaelMap
+            CDSUNIT_TEST_SplitList
+            CDSUNIT_TEST_FeldmanHashMap
+        CPPUNIT_TEST_SUITE_END();
+    };
+} // namespace map2
@@ -56,6 +56,7 @@ namespace map2 {
 
         size_t c_nFeldmanMap_HeadBits = 10;
         size_t c_nFeldmanMap_ArrayBits = 4;
+        size_t c_nFeldmanMap_MaxHeadBits = 0;
 
         size_t  c_nLoadFactor;  // current load factor
 
@@ -256,7 +257,12 @@ namespace map2 {
         CDSUNIT_DECLARE_EllenBinTreeMap
         CDSUNIT_DECLARE_BronsonAVLTreeMap
         CDSUNIT_DECLARE_FeldmanHashMap
+        CDSUNIT_DECLARE_FlatHashMap
+        CDSUNIT_DECLARE_UnrolledSkipListMap
+        CDSUNIT_DECLARE_BlockSplitListMap
+        CDSUNIT_DECLARE_BPlusTreeMap
         CDSUNIT_DECLARE_StripedMap
+        CDSUNIT_DECLARE_StripedMap_seqlock
         CDSUNIT_DECLARE_RefinableMap
         CDSUNIT_DECLARE_CuckooMap
         CDSUNIT_DECLARE_StdMap
@@ -272,8 +278,13 @@ namespace map2 {
             CDSUNIT_TEST_EllenBinTreeMap
             CDSUNIT_TEST_BronsonAVLTreeMap
             CDSUNIT_TEST_FeldmanHashMap
+            CDSUNIT_TEST_FlatHashMap
+            CDSUNIT_TEST_UnrolledSkipListMap
+            CDSUNIT_TEST_BlockSplitListMap
+            CDSUNIT_TEST_BPlusTreeMap
             CDSUNIT_TEST_CuckooMap
             CDSUNIT_TEST_StripedMap
+            CDSUNIT_TEST_StripedMap_seqlock
             CDSUNIT_TEST_RefinableMap
             CDSUNIT_TEST_StdMap
             CDSUNIT_TEST_StdMap_NoLock
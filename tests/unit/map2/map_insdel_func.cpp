@@ -49,6 +49,7 @@ namespace map2 {
 
         c_nFeldmanMap_HeadBits = cfg.getULong("FeldmanMapHeadBits", static_cast<unsigned long>(c_nFeldmanMap_HeadBits) );
         c_nFeldmanMap_ArrayBits = cfg.getULong("FeldmanMapArrayBits", static_cast<unsigned long>(c_nFeldmanMap_ArrayBits) );
+        c_nFeldmanMap_MaxHeadBits = cfg.getULong("FeldmanMapMaxHeadBits", static_cast<unsigned long>(c_nFeldmanMap_MaxHeadBits) );
 
     }
 } // namespace map2
@@ -52,6 +52,7 @@ namespace map2 {
 
         size_t c_nFeldmanMap_HeadBits = 10;
         size_t c_nFeldmanMap_ArrayBits = 4;
+        size_t c_nFeldmanMap_MaxHeadBits = 0;
 
         bool   c_bPrintGCState = true;
 
@@ -276,12 +277,17 @@ namespace map2 {
 
 #   include "map2/map_defs.h"
         CDSUNIT_DECLARE_MichaelMap
+        CDSUNIT_DECLARE_ResizableMichaelMap
         CDSUNIT_DECLARE_SplitList
         CDSUNIT_DECLARE_SkipListMap
         CDSUNIT_DECLARE_EllenBinTreeMap
         CDSUNIT_DECLARE_BronsonAVLTreeMap
         CDSUNIT_DECLARE_FeldmanHashMap_fixed
         CDSUNIT_DECLARE_FeldmanHashMap_city
+        CDSUNIT_DECLARE_FlatHashMap
+        CDSUNIT_DECLARE_UnrolledSkipListMap
+        CDSUNIT_DECLARE_BlockSplitListMap
+        CDSUNIT_DECLARE_BPlusTreeMap
         CDSUNIT_DECLARE_StripedMap
         CDSUNIT_DECLARE_RefinableMap
         CDSUNIT_DECLARE_CuckooMap
@@ -289,12 +295,17 @@ namespace map2 {
 
         CPPUNIT_TEST_SUITE(Map_InsDel_int)
             CDSUNIT_TEST_MichaelMap
+            CDSUNIT_TEST_ResizableMichaelMap
             CDSUNIT_TEST_SplitList
             CDSUNIT_TEST_SkipListMap
             CDSUNIT_TEST_EllenBinTreeMap
             CDSUNIT_TEST_BronsonAVLTreeMap
             CDSUNIT_TEST_FeldmanHashMap_fixed
             CDSUNIT_TEST_FeldmanHashMap_city
+            CDSUNIT_TEST_FlatHashMap
+            CDSUNIT_TEST_UnrolledSkipListMap
+            CDSUNIT_TEST_BlockSplitListMap
+            CDSUNIT_TEST_BPlusTreeMap
             CDSUNIT_TEST_CuckooMap
             CDSUNIT_TEST_StripedMap
             CDSUNIT_TEST_RefinableMap
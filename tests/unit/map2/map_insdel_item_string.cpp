@@ -48,6 +48,7 @@ namespace map2 {
 
         c_nFeldmanMap_HeadBits = cfg.getSizeT("FeldmanMapHeadBits", c_nFeldmanMap_HeadBits);
         c_nFeldmanMap_ArrayBits = cfg.getSizeT("FeldmanMapArrayBits", c_nFeldmanMap_ArrayBits);
+        c_nFeldmanMap_MaxHeadBits = cfg.getSizeT("FeldmanMapMaxHeadBits", c_nFeldmanMap_MaxHeadBits);
 
         if ( c_nThreadCount == 0 )
             c_nThreadCount = std::thread::hardware_concurrency() * 2;
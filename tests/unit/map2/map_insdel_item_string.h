@@ -52,6 +52,7 @@ namespace map2 {
 
         size_t c_nFeldmanMap_HeadBits = 10;
         size_t c_nFeldmanMap_ArrayBits = 4;
+        size_t c_nFeldmanMap_MaxHeadBits = 0;
 
         size_t  c_nGoalItem;
         size_t  c_nLoadFactor = 2;  // current load factor
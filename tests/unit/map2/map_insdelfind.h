@@ -53,6 +53,7 @@ namespace map2 {
 
         size_t c_nFeldmanMap_HeadBits = 10;
         size_t c_nFeldmanMap_ArrayBits = 4;
+        size_t c_nFeldmanMap_MaxHeadBits = 0;
 
         size_t  c_nLoadFactor = 2;  // current load factor
 
@@ -120,6 +121,10 @@ namespace map2 {
                 void operator()( bool /*bNew*/, map_value_type& /*cur*/ )
                 {}
 
+                // StripedMap with boost::container::flat_map bucket, its value_type has non-const key
+                void operator()( bool /*bNew*/, std::pair< key_type, value_type >& /*cur*/ )
+                {}
+
                 // BronsonAVLTreeMap
                 void operator()( bool /*bNew*/, key_type /*key*/, value_type& /*val*/ )
                 {}
@@ -285,7 +290,9 @@ namespace map2 {
         CDSUNIT_DECLARE_BronsonAVLTreeMap
         CDSUNIT_DECLARE_FeldmanHashMap_fixed
         CDSUNIT_DECLARE_FeldmanHashMap_city
+        CDSUNIT_DECLARE_BlockSplitListMap
         CDSUNIT_DECLARE_StripedMap
+        CDSUNIT_DECLARE_StripedMap_seqlock
         CDSUNIT_DECLARE_RefinableMap
         CDSUNIT_DECLARE_CuckooMap
         CDSUNIT_DECLARE_StdMap
@@ -298,8 +305,10 @@ namespace map2 {
             CDSUNIT_TEST_BronsonAVLTreeMap
             CDSUNIT_TEST_FeldmanHashMap_fixed
             CDSUNIT_TEST_FeldmanHashMap_city
+            CDSUNIT_TEST_BlockSplitListMap
             CDSUNIT_TEST_CuckooMap
             CDSUNIT_TEST_StripedMap
+            CDSUNIT_TEST_StripedMap_seqlock
             CDSUNIT_TEST_RefinableMap
             CDSUNIT_TEST_StdMap
         CPPUNIT_TEST_SUITE_END();
@@ -37,5 +37,6 @@
 
 namespace map2 {
     CDSUNIT_DECLARE_StripedMap
+    CDSUNIT_DECLARE_StripedMap_seqlock
     CDSUNIT_DECLARE_RefinableMap
 } // namespace map2
@@ -52,6 +52,7 @@ namespace map2 {
 
         size_t c_nFeldmanMap_HeadBits = 10;
         size_t c_nFeldmanMap_ArrayBits = 4;
+        size_t c_nFeldmanMap_MaxHeadBits = 0;
 
         size_t  c_nLoadFactor = 2;  // current load factor
 
@@ -227,6 +228,10 @@ namespace map2 {
         CDSUNIT_DECLARE_BronsonAVLTreeMap
         CDSUNIT_DECLARE_FeldmanHashMap_fixed
         CDSUNIT_DECLARE_FeldmanHashMap_city
+        CDSUNIT_DECLARE_FlatHashMap
+        CDSUNIT_DECLARE_UnrolledSkipListMap
+        CDSUNIT_DECLARE_BlockSplitListMap
+        CDSUNIT_DECLARE_BPlusTreeMap
         CDSUNIT_DECLARE_StripedMap
         CDSUNIT_DECLARE_RefinableMap
         CDSUNIT_DECLARE_CuckooMap
@@ -243,6 +248,10 @@ namespace map2 {
             CDSUNIT_TEST_BronsonAVLTreeMap
             CDSUNIT_TEST_FeldmanHashMap_fixed
             CDSUNIT_TEST_FeldmanHashMap_city
+            CDSUNIT_TEST_FlatHashMap
+            CDSUNIT_TEST_UnrolledSkipListMap
+            CDSUNIT_TEST_BlockSplitListMap
+            CDSUNIT_TEST_BPlusTreeMap
             CDSUNIT_TEST_CuckooMap
             CDSUNIT_TEST_StripedMap
             CDSUNIT_TEST_RefinableMap
@@ -0,0 +1,105 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#ifndef CDSUNIT_MAP_TYPE_BLOCK_SPLIT_LIST_H
+#define CDSUNIT_MAP_TYPE_BLOCK_SPLIT_LIST_H
+
+#include "map2/map_type.h"
+
+#include <cds/gc/hp.h>
+#include <cds/gc/dhp.h>
+#include <cds/container/block_split_list_map.h>
+
+#include "print_block_split_list_stat.h"
+
+namespace map2 {
+
+    template <class GC, typename Key, typename T, typename Traits = cc::block_split_list::traits>
+    class BlockSplitListMap : public cc::BlockSplitListMap< GC, Key, T, Traits >
+    {
+        typedef cc::BlockSplitListMap< GC, Key, T, Traits > base_class;
+    public:
+        template <typename Config>
+        BlockSplitListMap( Config const& cfg )
+            : base_class( cfg.c_nMapSize, cfg.c_nLoadFactor )
+        {}
+
+        // for testing
+        static CDS_CONSTEXPR bool const c_bExtractSupported = true;
+        static CDS_CONSTEXPR bool const c_bLoadFactorDepended = true;
+        static CDS_CONSTEXPR bool const c_bEraseExactKey = false;
+    };
+
+    struct tag_BlockSplitListMap;
+
+    template <typename Key, typename Value>
+    struct map_type< tag_BlockSplitListMap, Key, Value >: public map_type_base< Key, Value >
+    {
+        typedef map_type_base< Key, Value > base_class;
+        typedef typename base_class::compare    compare;
+        typedef typename base_class::less       less;
+        typedef typename base_class::hash       hash;
+
+        class traits_BlockSplitListMap_less: public cc::block_split_list::make_traits <
+                co::hash< hash >
+                ,co::less< less >
+            >::type
+        {};
+        typedef BlockSplitListMap< cds::gc::HP, Key, Value, traits_BlockSplitListMap_less >  BlockSplitListMap_hp_less;
+        typedef BlockSplitListMap< cds::gc::DHP, Key, Value, traits_BlockSplitListMap_less > BlockSplitListMap_dhp_less;
+
+        class traits_BlockSplitListMap_less_32: public cc::block_split_list::make_traits <
+                co::hash< hash >
+                ,co::less< less >
+                ,cc::block_split_list::block_capacity< 32 >
+            >::type
+        {};
+        typedef BlockSplitListMap< cds::gc::HP, Key, Value, traits_BlockSplitListMap_less_32 >  BlockSplitListMap_hp_less_32;
+        typedef BlockSplitListMap< cds::gc::DHP, Key, Value, traits_BlockSplitListMap_less_32 > BlockSplitListMap_dhp_less_32;
+
+        class traits_BlockSplitListMap_cmp_stat: public cc::block_split_list::make_traits <
+                co::hash< hash >
+                ,co::compare< compare >
+                ,co::stat< cc::block_split_list::stat<> >
+            >::type
+        {};
+        typedef BlockSplitListMap< cds::gc::HP, Key, Value, traits_BlockSplitListMap_cmp_stat >  BlockSplitListMap_hp_cmp_stat;
+        typedef BlockSplitListMap< cds::gc::DHP, Key, Value, traits_BlockSplitListMap_cmp_stat > BlockSplitListMap_dhp_cmp_stat;
+    };
+
+    template <typename GC, typename K, typename T, typename Traits >
+    static inline void print_stat( BlockSplitListMap< GC, K, T, Traits > const& m )
+    {
+        CPPUNIT_MSG( m.statistics() );
+    }
+
+}   // namespace map2
+
+#endif // #ifndef CDSUNIT_MAP_TYPE_BLOCK_SPLIT_LIST_H
@@ -0,0 +1,131 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#ifndef CDSUNIT_MAP_TYPE_BPLUS_TREE_H
+#define CDSUNIT_MAP_TYPE_BPLUS_TREE_H
+
+#include "map2/map_type.h"
+
+#include <cds/container/bplus_tree_map_rcu.h>
+
+#include "print_bplus_tree_stat.h"
+
+namespace map2 {
+
+    template <class GC, typename Key, typename T, typename Traits = cc::bplus_tree::traits >
+    class BPlusTreeMap : public cc::BPlusTreeMap< GC, Key, T, Traits >
+    {
+        typedef cc::BPlusTreeMap< GC, Key, T, Traits > base_class;
+    public:
+        template <typename Config>
+        BPlusTreeMap( Config const& /*cfg*/)
+            : base_class()
+        {}
+
+        // for testing
+        static CDS_CONSTEXPR bool const c_bExtractSupported = true;
+        static CDS_CONSTEXPR bool const c_bLoadFactorDepended = false;
+        static CDS_CONSTEXPR bool const c_bEraseExactKey = false;
+    };
+
+    struct tag_BPlusTreeMap;
+
+    template <typename Key, typename Value>
+    struct map_type< tag_BPlusTreeMap, Key, Value >: public map_type_base< Key, Value >
+    {
+        typedef map_type_base< Key, Value > base_class;
+        typedef typename base_class::compare    compare;
+        typedef typename base_class::less       less;
+
+        struct BPlusTreeMap_less: public
+            cc::bplus_tree::make_traits<
+                co::less< less >
+                ,co::item_counter< cds::atomicity::item_counter >
+            >::type
+        {};
+        typedef BPlusTreeMap< rcu_gpi, Key, Value, BPlusTreeMap_less > BPlusTreeMap_rcu_gpi_less;
+        typedef BPlusTreeMap< rcu_gpb, Key, Value, BPlusTreeMap_less > BPlusTreeMap_rcu_gpb_less;
+        typedef BPlusTreeMap< rcu_gpt, Key, Value, BPlusTreeMap_less > BPlusTreeMap_rcu_gpt_less;
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+        typedef BPlusTreeMap< rcu_shb, Key, Value, BPlusTreeMap_less > BPlusTreeMap_rcu_shb_less;
+        typedef BPlusTreeMap< rcu_sht, Key, Value, BPlusTreeMap_less > BPlusTreeMap_rcu_sht_less;
+#endif
+
+        struct BPlusTreeMap_less_16: public
+            cc::bplus_tree::make_traits<
+                co::less< less >
+                ,cc::bplus_tree::node_capacity< 16 >
+                ,co::item_counter< cds::atomicity::item_counter >
+            >::type
+        {};
+        typedef BPlusTreeMap< rcu_gpi, Key, Value, BPlusTreeMap_less_16 > BPlusTreeMap_rcu_gpi_less_16;
+        typedef BPlusTreeMap< rcu_gpb, Key, Value, BPlusTreeMap_less_16 > BPlusTreeMap_rcu_gpb_less_16;
+        typedef BPlusTreeMap< rcu_gpt, Key, Value, BPlusTreeMap_less_16 > BPlusTreeMap_rcu_gpt_less_16;
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+        typedef BPlusTreeMap< rcu_shb, Key, Value, BPlusTreeMap_less_16 > BPlusTreeMap_rcu_shb_less_16;
+        typedef BPlusTreeMap< rcu_sht, Key, Value, BPlusTreeMap_less_16 > BPlusTreeMap_rcu_sht_less_16;
+#endif
+
+        struct BPlusTreeMap_cmp_stat: public
+            cc::bplus_tree::make_traits<
+                co::compare< compare >
+                ,co::item_counter< cds::atomicity::item_counter >
+                ,co::stat< cc::bplus_tree::stat<>>
+            >::type
+        {};
+        typedef BPlusTreeMap< rcu_gpi, Key, Value, BPlusTreeMap_cmp_stat > BPlusTreeMap_rcu_gpi_cmp_stat;
+        typedef BPlusTreeMap< rcu_gpb, Key, Value, BPlusTreeMap_cmp_stat > BPlusTreeMap_rcu_gpb_cmp_stat;
+        typedef BPlusTreeMap< rcu_gpt, Key, Value, BPlusTreeMap_cmp_stat > BPlusTreeMap_rcu_gpt_cmp_stat;
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+        typedef BPlusTreeMap< rcu_shb, Key, Value, BPlusTreeMap_cmp_stat > BPlusTreeMap_rcu_shb_cmp_stat;
+        typedef BPlusTreeMap< rcu_sht, Key, Value, BPlusTreeMap_cmp_stat > BPlusTreeMap_rcu_sht_cmp_stat;
+#endif
+    };
+
+    template <typename GC, typename Key, typename T, typename Traits>
+    static inline void print_stat( BPlusTreeMap<GC, Key, T, Traits> const& m )
+    {
+        CPPUNIT_MSG( m.statistics() );
+    }
+
+    template <typename GC, typename Key, typename T, typename Traits>
+    static inline void check_before_cleanup( BPlusTreeMap<GC, Key, T, Traits>& m )
+    {
+        CPPUNIT_MSG( "  Check internal consistency (single-threaded)..." );
+        bool bOk = m.check_consistency([]( size_t nLevel, size_t hLeft, size_t hRight )
+            {
+                CPPUNIT_MSG( "Tree violation on level=" << nLevel << ": hLeft=" << hLeft << ", hRight=" << hRight )
+            });
+        CPPUNIT_CHECK_CURRENT_EX( bOk, "check_consistency failed");
+    }
+
+}   // namespace map2
+
+#endif // ifndef CDSUNIT_MAP_TYPE_BPLUS_TREE_H
@@ -89,6 +89,11 @@ namespace map2 {
         {
             typedef cc::cuckoo::refinable<> mutex_policy;
         };
+        template <typename Traits>
+        struct traits_CuckooOptimisticMap : public Traits
+        {
+            typedef cc::cuckoo::optimistic_striping< rcu_gpb > mutex_policy;
+        };
 
         struct traits_CuckooMap_list_unord :
             public cc::cuckoo::make_traits <
@@ -186,6 +191,26 @@ namespace map2 {
         typedef CuckooMap< Key, Value, traits_CuckooStripedMap<traits_CuckooMap_vector_ord_storehash>> CuckooStripedMap_vector_ord_storehash;
         typedef CuckooMap< Key, Value, traits_CuckooRefinableMap<traits_CuckooMap_vector_ord_storehash>> CuckooRefinableMap_vector_ord_storehash;
 
+        struct traits_CuckooMap_bucketized_unord :
+            public cc::cuckoo::make_traits <
+                cc::cuckoo::probeset_type< cc::cuckoo::bucketized<4> >
+                , co::equal_to< equal_to >
+                , co::hash< std::tuple< hash, hash2 > >
+            >::type
+        {};
+        typedef CuckooMap< Key, Value, traits_CuckooStripedMap<traits_CuckooMap_bucketized_unord>> CuckooStripedMap_bucketized_unord;
+        typedef CuckooMap< Key, Value, traits_CuckooRefinableMap<traits_CuckooMap_bucketized_unord>> CuckooRefinableMap_bucketized_unord;
+
+        struct traits_CuckooMap_bucketized_unord_stat : public traits_CuckooMap_bucketized_unord
+        {
+            typedef cc::cuckoo::stat stat;
+        };
+        typedef CuckooMap< Key, Value, traits_CuckooStripedMap<traits_CuckooMap_bucketized_unord_stat>> CuckooStripedMap_bucketized_unord_stat;
+        typedef CuckooMap< Key, Value, traits_CuckooRefinableMap<traits_CuckooMap_bucketized_unord_stat>> CuckooRefinableMap_bucketized_unord_stat;
+
+        typedef CuckooMap< Key, Value, traits_CuckooOptimisticMap<traits_CuckooMap_bucketized_unord>> CuckooOptimisticMap_bucketized_unord;
+        typedef CuckooMap< Key, Value, traits_CuckooOptimisticMap<traits_CuckooMap_bucketized_unord_stat>> CuckooOptimisticMap_bucketized_unord_stat;
+
     };
 
     template <typename K, typename T, typename Traits >
@@ -35,6 +35,7 @@
 
 #include <cds/container/feldman_hashmap_hp.h>
 #include <cds/container/feldman_hashmap_dhp.h>
+#include <cds/container/feldman_hashmap_ebr.h>
 #include <cds/container/feldman_hashmap_rcu.h>
 
 #include "print_feldman_hashset_stat.h"
@@ -49,7 +50,7 @@ namespace map2 {
     public:
         template <typename Config>
         FeldmanHashMap( Config const& cfg)
-            : base_class( cfg.c_nFeldmanMap_HeadBits, cfg.c_nFeldmanMap_ArrayBits )
+            : base_class( cfg.c_nFeldmanMap_HeadBits, cfg.c_nFeldmanMap_ArrayBits, cfg.c_nFeldmanMap_MaxHeadBits )
         {}
 
         // for testing
@@ -74,6 +75,7 @@ namespace map2 {
 
         typedef FeldmanHashMap< cds::gc::HP,  Key, Value, traits_FeldmanHashMap_stdhash >    FeldmanHashMap_hp_stdhash;
         typedef FeldmanHashMap< cds::gc::DHP, Key, Value, traits_FeldmanHashMap_stdhash >    FeldmanHashMap_dhp_stdhash;
+        typedef FeldmanHashMap< cds::gc::EBR, Key, Value, traits_FeldmanHashMap_stdhash >    FeldmanHashMap_ebr_stdhash;
         typedef FeldmanHashMap< rcu_gpi, Key, Value, traits_FeldmanHashMap_stdhash >    FeldmanHashMap_rcu_gpi_stdhash;
         typedef FeldmanHashMap< rcu_gpb, Key, Value, traits_FeldmanHashMap_stdhash >    FeldmanHashMap_rcu_gpb_stdhash;
         typedef FeldmanHashMap< rcu_gpt, Key, Value, traits_FeldmanHashMap_stdhash >    FeldmanHashMap_rcu_gpt_stdhash;
@@ -85,10 +87,12 @@ namespace map2 {
         struct traits_FeldmanHashMap_stdhash_stat: traits_FeldmanHashMap_stdhash
         {
             typedef cc::feldman_hashmap::stat<> stat;
+            static const bool head_growth = true;
         };
 
         typedef FeldmanHashMap< cds::gc::HP,  Key, Value, traits_FeldmanHashMap_stdhash_stat >    FeldmanHashMap_hp_stdhash_stat;
         typedef FeldmanHashMap< cds::gc::DHP, Key, Value, traits_FeldmanHashMap_stdhash_stat >    FeldmanHashMap_dhp_stdhash_stat;
+        typedef FeldmanHashMap< cds::gc::EBR, Key, Value, traits_FeldmanHashMap_stdhash_stat >    FeldmanHashMap_ebr_stdhash_stat;
         typedef FeldmanHashMap< rcu_gpi, Key, Value, traits_FeldmanHashMap_stdhash_stat >    FeldmanHashMap_rcu_gpi_stdhash_stat;
         typedef FeldmanHashMap< rcu_gpb, Key, Value, traits_FeldmanHashMap_stdhash_stat >    FeldmanHashMap_rcu_gpb_stdhash_stat;
         typedef FeldmanHashMap< rcu_gpt, Key, Value, traits_FeldmanHashMap_stdhash_stat >    FeldmanHashMap_rcu_gpt_stdhash_stat;
@@ -106,6 +110,7 @@ namespace map2 {
         };
         typedef FeldmanHashMap< cds::gc::HP,  Key, Value, traits_FeldmanHashMap_city64 >    FeldmanHashMap_hp_city64;
         typedef FeldmanHashMap< cds::gc::DHP, Key, Value, traits_FeldmanHashMap_city64 >    FeldmanHashMap_dhp_city64;
+        typedef FeldmanHashMap< cds::gc::EBR, Key, Value, traits_FeldmanHashMap_city64 >    FeldmanHashMap_ebr_city64;
         typedef FeldmanHashMap< rcu_gpi, Key, Value, traits_FeldmanHashMap_city64 >    FeldmanHashMap_rcu_gpi_city64;
         typedef FeldmanHashMap< rcu_gpb, Key, Value, traits_FeldmanHashMap_city64 >    FeldmanHashMap_rcu_gpb_city64;
         typedef FeldmanHashMap< rcu_gpt, Key, Value, traits_FeldmanHashMap_city64 >    FeldmanHashMap_rcu_gpt_city64;
@@ -117,9 +122,11 @@ namespace map2 {
         struct traits_FeldmanHashMap_city64_stat : public traits_FeldmanHashMap_city64
         {
             typedef cc::feldman_hashmap::stat<> stat;
+            static const bool head_growth = true;
         };
         typedef FeldmanHashMap< cds::gc::HP,  Key, Value, traits_FeldmanHashMap_city64_stat >    FeldmanHashMap_hp_city64_stat;
         typedef FeldmanHashMap< cds::gc::DHP, Key, Value, traits_FeldmanHashMap_city64_stat >    FeldmanHashMap_dhp_city64_stat;
+        typedef FeldmanHashMap< cds::gc::EBR, Key, Value, traits_FeldmanHashMap_city64_stat >    FeldmanHashMap_ebr_city64_stat;
         typedef FeldmanHashMap< rcu_gpi, Key, Value, traits_FeldmanHashMap_city64_stat >    FeldmanHashMap_rcu_gpi_city64_stat;
         typedef FeldmanHashMap< rcu_gpb, Key, Value, traits_FeldmanHashMap_city64_stat >    FeldmanHashMap_rcu_gpb_city64_stat;
         typedef FeldmanHashMap< rcu_gpt, Key, Value, traits_FeldmanHashMap_city64_stat >    FeldmanHashMap_rcu_gpt_city64_stat;
@@ -128,6 +135,21 @@ namespace map2 {
         typedef FeldmanHashMap< rcu_sht, Key, Value, traits_FeldmanHashMap_city64_stat >    FeldmanHashMap_rcu_sht_city64_stat;
 #endif
 
+        struct traits_FeldmanHashMap_city64_compressed_stat : public traits_FeldmanHashMap_city64_stat
+        {
+            typedef cc::feldman_hashmap::compressed_layout node_layout;
+        };
+        typedef FeldmanHashMap< cds::gc::HP,  Key, Value, traits_FeldmanHashMap_city64_compressed_stat >    FeldmanHashMap_hp_city64_compressed_stat;
+        typedef FeldmanHashMap< cds::gc::DHP, Key, Value, traits_FeldmanHashMap_city64_compressed_stat >    FeldmanHashMap_dhp_city64_compressed_stat;
+        typedef FeldmanHashMap< cds::gc::EBR, Key, Value, traits_FeldmanHashMap_city64_compressed_stat >    FeldmanHashMap_ebr_city64_compressed_stat;
+        typedef FeldmanHashMap< rcu_gpi, Key, Value, traits_FeldmanHashMap_city64_compressed_stat >    FeldmanHashMap_rcu_gpi_city64_compressed_stat;
+        typedef FeldmanHashMap< rcu_gpb, Key, Value, traits_FeldmanHashMap_city64_compressed_stat >    FeldmanHashMap_rcu_gpb_city64_compressed_stat;
+        typedef FeldmanHashMap< rcu_gpt, Key, Value, traits_FeldmanHashMap_city64_compressed_stat >    FeldmanHashMap_rcu_gpt_city64_compressed_stat;
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+        typedef FeldmanHashMap< rcu_shb, Key, Value, traits_FeldmanHashMap_city64_compressed_stat >    FeldmanHashMap_rcu_shb_city64_compressed_stat;
+        typedef FeldmanHashMap< rcu_sht, Key, Value, traits_FeldmanHashMap_city64_compressed_stat >    FeldmanHashMap_rcu_sht_city64_compressed_stat;
+#endif
+
         struct traits_FeldmanHashMap_city128 : public cc::feldman_hashmap::traits
         {
             typedef ::hashing::city128 hash;
@@ -135,6 +157,7 @@ namespace map2 {
         };
         typedef FeldmanHashMap< cds::gc::HP,  Key, Value, traits_FeldmanHashMap_city128 >    FeldmanHashMap_hp_city128;
         typedef FeldmanHashMap< cds::gc::DHP, Key, Value, traits_FeldmanHashMap_city128 >    FeldmanHashMap_dhp_city128;
+        typedef FeldmanHashMap< cds::gc::EBR, Key, Value, traits_FeldmanHashMap_city128 >    FeldmanHashMap_ebr_city128;
         typedef FeldmanHashMap< rcu_gpi, Key, Value, traits_FeldmanHashMap_city128 >    FeldmanHashMap_rcu_gpi_city128;
         typedef FeldmanHashMap< rcu_gpb, Key, Value, traits_FeldmanHashMap_city128 >    FeldmanHashMap_rcu_gpb_city128;
         typedef FeldmanHashMap< rcu_gpt, Key, Value, traits_FeldmanHashMap_city128 >    FeldmanHashMap_rcu_gpt_city128;
@@ -146,9 +169,11 @@ namespace map2 {
         struct traits_FeldmanHashMap_city128_stat : public traits_FeldmanHashMap_city128
         {
             typedef cc::feldman_hashmap::stat<> stat;
+            static const bool head_growth = true;
         };
         typedef FeldmanHashMap< cds::gc::HP,  Key, Value, traits_FeldmanHashMap_city128_stat >    FeldmanHashMap_hp_city128_stat;
         typedef FeldmanHashMap< cds::gc::DHP, Key, Value, traits_FeldmanHashMap_city128_stat >    FeldmanHashMap_dhp_city128_stat;
+        typedef FeldmanHashMap< cds::gc::EBR, Key, Value, traits_FeldmanHashMap_city128_stat >    FeldmanHashMap_ebr_city128_stat;
         typedef FeldmanHashMap< rcu_gpi, Key, Value, traits_FeldmanHashMap_city128_stat >    FeldmanHashMap_rcu_gpi_city128_stat;
         typedef FeldmanHashMap< rcu_gpb, Key, Value, traits_FeldmanHashMap_city128_stat >    FeldmanHashMap_rcu_gpb_city128_stat;
         typedef FeldmanHashMap< rcu_gpt, Key, Value, traits_FeldmanHashMap_city128_stat >    FeldmanHashMap_rcu_gpt_city128_stat;
@@ -162,6 +187,7 @@ namespace map2 {
         // for fixed-sized keys - no hash functor required
         typedef FeldmanHashMap< cds::gc::HP, Key, Value >    FeldmanHashMap_hp_fixed;
         typedef FeldmanHashMap< cds::gc::DHP, Key, Value >   FeldmanHashMap_dhp_fixed;
+        typedef FeldmanHashMap< cds::gc::EBR, Key, Value >   FeldmanHashMap_ebr_fixed;
         typedef FeldmanHashMap< rcu_gpi, Key, Value >    FeldmanHashMap_rcu_gpi_fixed;
         typedef FeldmanHashMap< rcu_gpb, Key, Value >    FeldmanHashMap_rcu_gpb_fixed;
         typedef FeldmanHashMap< rcu_gpt, Key, Value >    FeldmanHashMap_rcu_gpt_fixed;
@@ -173,9 +199,11 @@ namespace map2 {
         struct traits_FeldmanHashMap_stat : public cc::feldman_hashmap::traits
         {
             typedef cc::feldman_hashmap::stat<> stat;
+            static const bool head_growth = true;
         };
         typedef FeldmanHashMap< cds::gc::HP, Key, Value, traits_FeldmanHashMap_stat >    FeldmanHashMap_hp_fixed_stat;
         typedef FeldmanHashMap< cds::gc::DHP, Key, Value, traits_FeldmanHashMap_stat >   FeldmanHashMap_dhp_fixed_stat;
+        typedef FeldmanHashMap< cds::gc::EBR, Key, Value, traits_FeldmanHashMap_stat >   FeldmanHashMap_ebr_fixed_stat;
         typedef FeldmanHashMap< rcu_gpi, Key, Value, traits_FeldmanHashMap_stat >    FeldmanHashMap_rcu_gpi_fixed_stat;
         typedef FeldmanHashMap< rcu_gpb, Key, Value, traits_FeldmanHashMap_stat >    FeldmanHashMap_rcu_gpb_fixed_stat;
         typedef FeldmanHashMap< rcu_gpt, Key, Value, traits_FeldmanHashMap_stat >    FeldmanHashMap_rcu_gpt_fixed_stat;
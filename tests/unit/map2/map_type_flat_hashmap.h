@@ -0,0 +1,103 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#ifndef CDSUNIT_MAP_TYPE_FLAT_HASHMAP_H
+#define CDSUNIT_MAP_TYPE_FLAT_HASHMAP_H
+
+#include "map2/map_type.h"
+
+#include <cds/gc/hp.h>
+#include <cds/gc/dhp.h>
+#include <cds/container/flat_hashmap.h>
+
+#include "print_flat_hashmap_stat.h"
+
+namespace map2 {
+
+    template <class GC, typename Key, typename T, typename Traits = cc::flat_hashmap::traits>
+    class FlatHashMap : public cc::FlatHashMap< GC, Key, T, Traits >
+    {
+        typedef cc::FlatHashMap< GC, Key, T, Traits > base_class;
+    public:
+        template <typename Config>
+        FlatHashMap( Config const& cfg)
+            : base_class( cfg.c_nMapSize )
+        {}
+
+        // for testing
+        static CDS_CONSTEXPR bool const c_bExtractSupported = false;
+        static CDS_CONSTEXPR bool const c_bLoadFactorDepended = false;
+        static CDS_CONSTEXPR bool const c_bEraseExactKey = true;
+    };
+
+    struct tag_FlatHashMap;
+
+    template <typename Key, typename Value>
+    struct map_type< tag_FlatHashMap, Key, Value >: public map_type_base< Key, Value >
+    {
+        typedef map_type_base< Key, Value > base_class;
+        typedef typename base_class::compare    compare;
+        typedef typename base_class::less       less;
+
+        typedef FlatHashMap< cds::gc::HP, Key, Value >  FlatHashMap_hp;
+        typedef FlatHashMap< cds::gc::DHP, Key, Value > FlatHashMap_dhp;
+        typedef FlatHashMap< rcu_gpi, Key, Value >      FlatHashMap_rcu_gpi;
+        typedef FlatHashMap< rcu_gpb, Key, Value >      FlatHashMap_rcu_gpb;
+        typedef FlatHashMap< rcu_gpt, Key, Value >      FlatHashMap_rcu_gpt;
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+        typedef FlatHashMap< rcu_shb, Key, Value >      FlatHashMap_rcu_shb;
+        typedef FlatHashMap< rcu_sht, Key, Value >      FlatHashMap_rcu_sht;
+#endif
+
+        struct traits_FlatHashMap_stat : public cc::flat_hashmap::traits
+        {
+            typedef cc::flat_hashmap::stat<> stat;
+        };
+        typedef FlatHashMap< cds::gc::HP, Key, Value, traits_FlatHashMap_stat >  FlatHashMap_hp_stat;
+        typedef FlatHashMap< cds::gc::DHP, Key, Value, traits_FlatHashMap_stat > FlatHashMap_dhp_stat;
+        typedef FlatHashMap< rcu_gpi, Key, Value, traits_FlatHashMap_stat >      FlatHashMap_rcu_gpi_stat;
+        typedef FlatHashMap< rcu_gpb, Key, Value, traits_FlatHashMap_stat >      FlatHashMap_rcu_gpb_stat;
+        typedef FlatHashMap< rcu_gpt, Key, Value, traits_FlatHashMap_stat >      FlatHashMap_rcu_gpt_stat;
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+        typedef FlatHashMap< rcu_shb, Key, Value, traits_FlatHashMap_stat >      FlatHashMap_rcu_shb_stat;
+        typedef FlatHashMap< rcu_sht, Key, Value, traits_FlatHashMap_stat >      FlatHashMap_rcu_sht_stat;
+#endif
+    };
+
+    template <typename GC, typename K, typename T, typename Traits >
+    static inline void print_stat( FlatHashMap< GC, K, T, Traits > const& m )
+    {
+        CPPUNIT_MSG( m.statistics() );
+        CPPUNIT_MSG( "Group count=" << m.group_count() << ", capacity=" << m.capacity() );
+    }
+
+}   // namespace map2
+
+#endif // #ifndef CDSUNIT_MAP_TYPE_FLAT_HASHMAP_H
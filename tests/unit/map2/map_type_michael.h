@@ -80,6 +80,8 @@ namespace map2 {
         {};
         typedef MichaelHashMap< cds::gc::HP,  typename ml::MichaelList_HP_cmp_stdAlloc,  traits_MichaelMap_hash > MichaelMap_HP_cmp_stdAlloc;
         typedef MichaelHashMap< cds::gc::DHP, typename ml::MichaelList_DHP_cmp_stdAlloc, traits_MichaelMap_hash > MichaelMap_DHP_cmp_stdAlloc;
+        typedef MichaelHashMap< cds::gc::EBR, typename ml::MichaelList_EBR_cmp_stdAlloc, traits_MichaelMap_hash > MichaelMap_EBR_cmp_stdAlloc;
+        typedef MichaelHashMap< cds::gc::HE,  typename ml::MichaelList_HE_cmp_stdAlloc, traits_MichaelMap_hash > MichaelMap_HE_cmp_stdAlloc;
         typedef MichaelHashMap< cds::gc::nogc, typename ml::MichaelList_NOGC_cmp_stdAlloc, traits_MichaelMap_hash > MichaelMap_NOGC_cmp_stdAlloc;
         typedef MichaelHashMap< rcu_gpi, typename ml::MichaelList_RCU_GPI_cmp_stdAlloc, traits_MichaelMap_hash > MichaelMap_RCU_GPI_cmp_stdAlloc;
         typedef MichaelHashMap< rcu_gpb, typename ml::MichaelList_RCU_GPB_cmp_stdAlloc, traits_MichaelMap_hash > MichaelMap_RCU_GPB_cmp_stdAlloc;
@@ -91,6 +93,8 @@ namespace map2 {
 
         typedef MichaelHashMap< cds::gc::HP, typename ml::MichaelList_HP_less_stdAlloc, traits_MichaelMap_hash > MichaelMap_HP_less_stdAlloc;
         typedef MichaelHashMap< cds::gc::DHP, typename ml::MichaelList_DHP_less_stdAlloc, traits_MichaelMap_hash > MichaelMap_DHP_less_stdAlloc;
+        typedef MichaelHashMap< cds::gc::EBR, typename ml::MichaelList_EBR_less_stdAlloc, traits_MichaelMap_hash > MichaelMap_EBR_less_stdAlloc;
+        typedef MichaelHashMap< cds::gc::HE,  typename ml::MichaelList_HE_less_stdAlloc, traits_MichaelMap_hash > MichaelMap_HE_less_stdAlloc;
         typedef MichaelHashMap< cds::gc::nogc, typename ml::MichaelList_NOGC_less_stdAlloc, traits_MichaelMap_hash > MichaelMap_NOGC_less_stdAlloc;
         typedef MichaelHashMap< rcu_gpi, typename ml::MichaelList_RCU_GPI_less_stdAlloc, traits_MichaelMap_hash > MichaelMap_RCU_GPI_less_stdAlloc;
         typedef MichaelHashMap< rcu_gpb, typename ml::MichaelList_RCU_GPB_less_stdAlloc, traits_MichaelMap_hash > MichaelMap_RCU_GPB_less_stdAlloc;
@@ -102,6 +106,8 @@ namespace map2 {
 
         typedef MichaelHashMap< cds::gc::HP, typename ml::MichaelList_HP_cmp_stdAlloc_seqcst, traits_MichaelMap_hash > MichaelMap_HP_cmp_stdAlloc_seqcst;
         typedef MichaelHashMap< cds::gc::DHP, typename ml::MichaelList_DHP_cmp_stdAlloc_seqcst, traits_MichaelMap_hash > MichaelMap_DHP_cmp_stdAlloc_seqcst;
+        typedef MichaelHashMap< cds::gc::EBR, typename ml::MichaelList_EBR_cmp_stdAlloc_seqcst, traits_MichaelMap_hash > MichaelMap_EBR_cmp_stdAlloc_seqcst;
+        typedef MichaelHashMap< cds::gc::HE,  typename ml::MichaelList_HE_cmp_stdAlloc_seqcst, traits_MichaelMap_hash > MichaelMap_HE_cmp_stdAlloc_seqcst;
         typedef MichaelHashMap< cds::gc::nogc, typename ml::MichaelList_NOGC_cmp_stdAlloc_seqcst, traits_MichaelMap_hash > MichaelMap_NOGC_cmp_stdAlloc_seqcst;
         typedef MichaelHashMap< rcu_gpi, typename ml::MichaelList_RCU_GPI_cmp_stdAlloc_seqcst, traits_MichaelMap_hash > MichaelMap_RCU_GPI_cmp_stdAlloc_seqcst;
         typedef MichaelHashMap< rcu_gpb, typename ml::MichaelList_RCU_GPB_cmp_stdAlloc_seqcst, traits_MichaelMap_hash > MichaelMap_RCU_GPB_cmp_stdAlloc_seqcst;
@@ -113,6 +119,8 @@ namespace map2 {
 
         typedef MichaelHashMap< cds::gc::HP, typename ml::MichaelList_HP_less_stdAlloc_seqcst, traits_MichaelMap_hash > MichaelMap_HP_less_stdAlloc_seqcst;
         typedef MichaelHashMap< cds::gc::DHP, typename ml::MichaelList_DHP_less_stdAlloc_seqcst, traits_MichaelMap_hash > MichaelMap_DHP_less_stdAlloc_seqcst;
+        typedef MichaelHashMap< cds::gc::EBR, typename ml::MichaelList_EBR_less_stdAlloc_seqcst, traits_MichaelMap_hash > MichaelMap_EBR_less_stdAlloc_seqcst;
+        typedef MichaelHashMap< cds::gc::HE,  typename ml::MichaelList_HE_less_stdAlloc_seqcst, traits_MichaelMap_hash > MichaelMap_HE_less_stdAlloc_seqcst;
         typedef MichaelHashMap< cds::gc::nogc, typename ml::MichaelList_NOGC_less_stdAlloc_seqcst, traits_MichaelMap_hash > MichaelMap_NOGC_less_stdAlloc_seqcst;
         typedef MichaelHashMap< rcu_gpi, typename ml::MichaelList_RCU_GPI_less_stdAlloc_seqcst, traits_MichaelMap_hash > MichaelMap_RCU_GPI_less_stdAlloc_seqcst;
         typedef MichaelHashMap< rcu_gpb, typename ml::MichaelList_RCU_GPB_less_stdAlloc_seqcst, traits_MichaelMap_hash > MichaelMap_RCU_GPB_less_stdAlloc_seqcst;
@@ -129,6 +137,8 @@ namespace map2 {
         };
         typedef MichaelHashMap< cds::gc::HP, typename ml::MichaelList_HP_cmp_michaelAlloc, traits_MichaelSet_michaelAlloc > MichaelMap_HP_cmp_michaelAlloc;
         typedef MichaelHashMap< cds::gc::DHP, typename ml::MichaelList_DHP_cmp_michaelAlloc, traits_MichaelSet_michaelAlloc > MichaelMap_DHP_cmp_michaelAlloc;
+        typedef MichaelHashMap< cds::gc::EBR, typename ml::MichaelList_EBR_cmp_michaelAlloc, traits_MichaelSet_michaelAlloc > MichaelMap_EBR_cmp_michaelAlloc;
+        typedef MichaelHashMap< cds::gc::HE,  typename ml::MichaelList_HE_cmp_michaelAlloc, traits_MichaelSet_michaelAlloc > MichaelMap_HE_cmp_michaelAlloc;
         typedef MichaelHashMap< cds::gc::nogc, typename ml::MichaelList_NOGC_cmp_michaelAlloc, traits_MichaelSet_michaelAlloc > MichaelMap_NOGC_cmp_michaelAlloc;
         typedef MichaelHashMap< rcu_gpi, typename ml::MichaelList_RCU_GPI_cmp_michaelAlloc, traits_MichaelSet_michaelAlloc > MichaelMap_RCU_GPI_cmp_michaelAlloc;
         typedef MichaelHashMap< rcu_gpb, typename ml::MichaelList_RCU_GPB_cmp_michaelAlloc, traits_MichaelSet_michaelAlloc > MichaelMap_RCU_GPB_cmp_michaelAlloc;
@@ -139,6 +149,8 @@ namespace map2 {
 #endif
         typedef MichaelHashMap< cds::gc::HP, typename ml::MichaelList_HP_less_michaelAlloc, traits_MichaelSet_michaelAlloc > MichaelMap_HP_less_michaelAlloc;
         typedef MichaelHashMap< cds::gc::DHP, typename ml::MichaelList_DHP_less_michaelAlloc, traits_MichaelSet_michaelAlloc > MichaelMap_DHP_less_michaelAlloc;
+        typedef MichaelHashMap< cds::gc::EBR, typename ml::MichaelList_EBR_less_michaelAlloc, traits_MichaelSet_michaelAlloc > MichaelMap_EBR_less_michaelAlloc;
+        typedef MichaelHashMap< cds::gc::HE,  typename ml::MichaelList_HE_less_michaelAlloc, traits_MichaelSet_michaelAlloc > MichaelMap_HE_less_michaelAlloc;
         typedef MichaelHashMap< cds::gc::nogc, typename ml::MichaelList_NOGC_less_michaelAlloc, traits_MichaelSet_michaelAlloc > MichaelMap_NOGC_less_michaelAlloc;
         typedef MichaelHashMap< rcu_gpi, typename ml::MichaelList_RCU_GPI_less_michaelAlloc, traits_MichaelSet_michaelAlloc > MichaelMap_RCU_GPI_less_michaelAlloc;
         typedef MichaelHashMap< rcu_gpb, typename ml::MichaelList_RCU_GPB_less_michaelAlloc, traits_MichaelSet_michaelAlloc > MichaelMap_RCU_GPB_less_michaelAlloc;
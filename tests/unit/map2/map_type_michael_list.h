@@ -35,6 +35,8 @@
 
 #include <cds/container/michael_kvlist_hp.h>
 #include <cds/container/michael_kvlist_dhp.h>
+#include <cds/container/michael_kvlist_ebr.h>
+#include <cds/container/michael_kvlist_he.h>
 #include <cds/container/michael_kvlist_rcu.h>
 #include <cds/container/michael_kvlist_nogc.h>
 
@@ -55,6 +57,8 @@ namespace map2 {
         {};
         typedef cc::MichaelKVList< cds::gc::HP,  Key, Value, traits_MichaelList_cmp_stdAlloc > MichaelList_HP_cmp_stdAlloc;
         typedef cc::MichaelKVList< cds::gc::DHP, Key, Value, traits_MichaelList_cmp_stdAlloc > MichaelList_DHP_cmp_stdAlloc;
+        typedef cc::MichaelKVList< cds::gc::EBR, Key, Value, traits_MichaelList_cmp_stdAlloc > MichaelList_EBR_cmp_stdAlloc;
+        typedef cc::MichaelKVList< cds::gc::HE,  Key, Value, traits_MichaelList_cmp_stdAlloc > MichaelList_HE_cmp_stdAlloc;
         typedef cc::MichaelKVList< cds::gc::nogc, Key, Value, traits_MichaelList_cmp_stdAlloc > MichaelList_NOGC_cmp_stdAlloc;
         typedef cc::MichaelKVList< rcu_gpi, Key, Value, traits_MichaelList_cmp_stdAlloc > MichaelList_RCU_GPI_cmp_stdAlloc;
         typedef cc::MichaelKVList< rcu_gpb, Key, Value, traits_MichaelList_cmp_stdAlloc > MichaelList_RCU_GPB_cmp_stdAlloc;
@@ -72,6 +76,8 @@ namespace map2 {
         {};
         typedef cc::MichaelKVList< cds::gc::HP,  Key, Value, traits_MichaelList_cmp_stdAlloc_seqcst > MichaelList_HP_cmp_stdAlloc_seqcst;
         typedef cc::MichaelKVList< cds::gc::DHP, Key, Value, traits_MichaelList_cmp_stdAlloc_seqcst > MichaelList_DHP_cmp_stdAlloc_seqcst;
+        typedef cc::MichaelKVList< cds::gc::EBR, Key, Value, traits_MichaelList_cmp_stdAlloc_seqcst > MichaelList_EBR_cmp_stdAlloc_seqcst;
+        typedef cc::MichaelKVList< cds::gc::HE,  Key, Value, traits_MichaelList_cmp_stdAlloc_seqcst > MichaelList_HE_cmp_stdAlloc_seqcst;
         typedef cc::MichaelKVList< cds::gc::nogc, Key, Value, traits_MichaelList_cmp_stdAlloc_seqcst > MichaelList_NOGC_cmp_stdAlloc_seqcst;
         typedef cc::MichaelKVList< rcu_gpi, Key, Value, traits_MichaelList_cmp_stdAlloc_seqcst > MichaelList_RCU_GPI_cmp_stdAlloc_seqcst;
         typedef cc::MichaelKVList< rcu_gpb, Key, Value, traits_MichaelList_cmp_stdAlloc_seqcst > MichaelList_RCU_GPB_cmp_stdAlloc_seqcst;
@@ -89,6 +95,8 @@ namespace map2 {
         {};
         typedef cc::MichaelKVList< cds::gc::HP,  Key, Value, traits_MichaelList_cmp_michaelAlloc > MichaelList_HP_cmp_michaelAlloc;
         typedef cc::MichaelKVList< cds::gc::DHP, Key, Value, traits_MichaelList_cmp_michaelAlloc > MichaelList_DHP_cmp_michaelAlloc;
+        typedef cc::MichaelKVList< cds::gc::EBR, Key, Value, traits_MichaelList_cmp_michaelAlloc > MichaelList_EBR_cmp_michaelAlloc;
+        typedef cc::MichaelKVList< cds::gc::HE,  Key, Value, traits_MichaelList_cmp_michaelAlloc > MichaelList_HE_cmp_michaelAlloc;
         typedef cc::MichaelKVList< cds::gc::nogc, Key, Value, traits_MichaelList_cmp_michaelAlloc > MichaelList_NOGC_cmp_michaelAlloc;
         typedef cc::MichaelKVList< rcu_gpi, Key, Value, traits_MichaelList_cmp_michaelAlloc > MichaelList_RCU_GPI_cmp_michaelAlloc;
         typedef cc::MichaelKVList< rcu_gpb, Key, Value, traits_MichaelList_cmp_michaelAlloc > MichaelList_RCU_GPB_cmp_michaelAlloc;
@@ -105,6 +113,8 @@ namespace map2 {
         {};
         typedef cc::MichaelKVList< cds::gc::HP,  Key, Value, traits_MichaelList_less_stdAlloc > MichaelList_HP_less_stdAlloc;
         typedef cc::MichaelKVList< cds::gc::DHP, Key, Value, traits_MichaelList_less_stdAlloc > MichaelList_DHP_less_stdAlloc;
+        typedef cc::MichaelKVList< cds::gc::EBR, Key, Value, traits_MichaelList_less_stdAlloc > MichaelList_EBR_less_stdAlloc;
+        typedef cc::MichaelKVList< cds::gc::HE,  Key, Value, traits_MichaelList_less_stdAlloc > MichaelList_HE_less_stdAlloc;
         typedef cc::MichaelKVList< cds::gc::nogc, Key, Value, traits_MichaelList_less_stdAlloc > MichaelList_NOGC_less_stdAlloc;
         typedef cc::MichaelKVList< rcu_gpi, Key, Value, traits_MichaelList_less_stdAlloc > MichaelList_RCU_GPI_less_stdAlloc;
         typedef cc::MichaelKVList< rcu_gpb, Key, Value, traits_MichaelList_less_stdAlloc > MichaelList_RCU_GPB_less_stdAlloc;
@@ -122,6 +132,8 @@ namespace map2 {
         {};
         typedef cc::MichaelKVList< cds::gc::HP,  Key, Value, traits_MichaelList_less_stdAlloc_seqcst > MichaelList_HP_less_stdAlloc_seqcst;
         typedef cc::MichaelKVList< cds::gc::DHP, Key, Value, traits_MichaelList_less_stdAlloc_seqcst > MichaelList_DHP_less_stdAlloc_seqcst;
+        typedef cc::MichaelKVList< cds::gc::EBR, Key, Value, traits_MichaelList_less_stdAlloc_seqcst > MichaelList_EBR_less_stdAlloc_seqcst;
+        typedef cc::MichaelKVList< cds::gc::HE,  Key, Value, traits_MichaelList_less_stdAlloc_seqcst > MichaelList_HE_less_stdAlloc_seqcst;
         typedef cc::MichaelKVList< cds::gc::nogc, Key, Value, traits_MichaelList_less_stdAlloc_seqcst > MichaelList_NOGC_less_stdAlloc_seqcst;
         typedef cc::MichaelKVList< rcu_gpi, Key, Value, traits_MichaelList_less_stdAlloc_seqcst > MichaelList_RCU_GPI_less_stdAlloc_seqcst;
         typedef cc::MichaelKVList< rcu_gpb, Key, Value, traits_MichaelList_less_stdAlloc_seqcst > MichaelList_RCU_GPB_less_stdAlloc_seqcst;
@@ -139,6 +151,8 @@ namespace map2 {
         {};
         typedef cc::MichaelKVList< cds::gc::HP,  Key, Value, traits_MichaelList_less_michaelAlloc > MichaelList_HP_less_michaelAlloc;
         typedef cc::MichaelKVList< cds::gc::DHP, Key, Value, traits_MichaelList_less_michaelAlloc > MichaelList_DHP_less_michaelAlloc;
+        typedef cc::MichaelKVList< cds::gc::EBR, Key, Value, traits_MichaelList_less_michaelAlloc > MichaelList_EBR_less_michaelAlloc;
+        typedef cc::MichaelKVList< cds::gc::HE,  Key, Value, traits_MichaelList_less_michaelAlloc > MichaelList_HE_less_michaelAlloc;
         typedef cc::MichaelKVList< cds::gc::nogc, Key, Value, traits_MichaelList_less_michaelAlloc > MichaelList_NOGC_less_michaelAlloc;
         typedef cc::MichaelKVList< rcu_gpi, Key, Value, traits_MichaelList_less_michaelAlloc > MichaelList_RCU_GPI_less_michaelAlloc;
         typedef cc::MichaelKVList< rcu_gpb, Key, Value, traits_MichaelList_less_michaelAlloc > MichaelList_RCU_GPB_less_michaelAlloc;
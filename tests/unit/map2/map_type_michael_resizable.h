@@ -0,0 +1,89 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#ifndef CDSUNIT_MAP_TYPE_MICHAEL_RESIZABLE_H
+#define CDSUNIT_MAP_TYPE_MICHAEL_RESIZABLE_H
+
+#include "map2/map_type_michael_list.h"
+#include "map2/map_type_lazy_list.h"
+
+#include <cds/container/michael_map_resizable.h>
+
+namespace map2 {
+
+    template <class GC, typename List, typename Traits = cc::michael_map::traits>
+    class ResizableMichaelHashMap : public cc::ResizableMichaelHashMap< GC, List, Traits >
+    {
+        typedef cc::ResizableMichaelHashMap< GC, List, Traits > base_class;
+    public:
+        // The initial table is small, so the buckets are migrated while the test threads run
+        template <typename Config>
+        ResizableMichaelHashMap( Config const& cfg )
+            : base_class( 64, cfg.c_nLoadFactor )
+        {}
+
+        // for testing
+        static CDS_CONSTEXPR bool const c_bExtractSupported = false;
+        static CDS_CONSTEXPR bool const c_bLoadFactorDepended = true;
+        static CDS_CONSTEXPR bool const c_bEraseExactKey = false;
+    };
+
+    struct tag_ResizableMichaelHashMap;
+
+    template <typename Key, typename Value>
+    struct map_type< tag_ResizableMichaelHashMap, Key, Value >: public map_type_base< Key, Value >
+    {
+        typedef map_type_base< Key, Value > base_class;
+        typedef typename base_class::key_hash   key_hash;
+        typedef typename base_class::hash       hash;
+
+        typedef michael_list_type< Key, Value > ml;
+        typedef lazy_list_type< Key, Value > ll;
+
+        struct traits_ResizableMichaelMap_hash :
+            public cc::michael_map::make_traits<
+                co::hash< hash >
+            >::type
+        {};
+
+        typedef ResizableMichaelHashMap< cds::gc::HP,  typename ml::MichaelList_HP_cmp_stdAlloc,  traits_ResizableMichaelMap_hash > ResizableMichaelMap_HP_cmp_stdAlloc;
+        typedef ResizableMichaelHashMap< cds::gc::DHP, typename ml::MichaelList_DHP_cmp_stdAlloc, traits_ResizableMichaelMap_hash > ResizableMichaelMap_DHP_cmp_stdAlloc;
+        typedef ResizableMichaelHashMap< rcu_gpb, typename ml::MichaelList_RCU_GPB_cmp_stdAlloc, traits_ResizableMichaelMap_hash > ResizableMichaelMap_RCU_GPB_cmp_stdAlloc;
+        typedef ResizableMichaelHashMap< cds::gc::HP,  typename ll::LazyList_HP_cmp_stdAlloc,  traits_ResizableMichaelMap_hash > ResizableMichaelMap_Lazy_HP_cmp_stdAlloc;
+    };
+
+    template <class GC, typename List, typename Traits>
+    static inline void print_stat( ResizableMichaelHashMap< GC, List, Traits > const& m )
+    {
+        CPPUNIT_MSG( "  Resize count=" << m.resize_count() << ", bucket count=" << m.bucket_count() );
+    }
+}   // namespace map2
+
+#endif // ifndef CDSUNIT_MAP_TYPE_MICHAEL_RESIZABLE_H
@@ -168,6 +168,15 @@ namespace map2 {
             boost::container::flat_map< Key, Value, less >
             , co::hash< hash2 >
         > StripedMap_boost_flat_map;
+
+        // Optimistic reading: the mutex policy overrides the default striping<> of StripedHashMap_ord
+        typedef StripedHashMap_ord<
+            boost::container::flat_map< Key, Value, less,
+                cc::striped_set::rcu_retired_allocator< rcu_gpb, std::pair< Key, Value >>
+            >
+            , co::hash< hash2 >
+            , co::mutex_policy< cc::striped_set::seqlock_striping< rcu_gpb >>
+        > StripedMap_boost_flat_map_seqlock;
 #   endif  // BOOST_VERSION >= 104800
 
 
@@ -260,6 +269,20 @@ namespace map2 {
             , co::hash< hash2 >
         > RefinableMap_boost_unordered_map;
 
+        // Incremental resizing: the mutex policy overrides the default refinable<> of RefinableHashMap_xxx
+        typedef RefinableHashMap_seq<
+            std::list< std::pair< Key const, Value > >
+            , co::hash< hash2 >
+            , co::less< less >
+            , co::mutex_policy< cc::striped_set::incremental_refinable<> >
+        > RefinableMap_list_incremental;
+
+        typedef RefinableHashMap_ord<
+            std::unordered_map< Key, Value, hash, equal_to >
+            , co::hash< hash2 >
+            , co::mutex_policy< cc::striped_set::incremental_refinable<> >
+        > RefinableMap_hashmap_incremental;
+
 #   if BOOST_VERSION >= 104800
         typedef RefinableHashMap_seq<
             boost::container::list< std::pair< Key const, Value > >
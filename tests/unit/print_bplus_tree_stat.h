@@ -0,0 +1,74 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#ifndef CDSUNIT_PRINT_BPLUS_TREE_STAT_H
+#define CDSUNIT_PRINT_BPLUS_TREE_STAT_H
+
+#include <ostream>
+
+namespace std {
+
+    static inline ostream& operator <<( ostream& o, cds::container::bplus_tree::empty_stat const& /*s*/ )
+    {
+        return o;
+    }
+
+    static inline ostream& operator <<(ostream& o, cds::container::bplus_tree::stat<> const& s)
+    {
+        return o << "\nBPlusTree statistics [cds::container::bplus_tree::stat]:\n"
+            << "\t\t   m_nFindSuccess: " << s.m_nFindSuccess.get()    << "\n"
+            << "\t\t    m_nFindFailed: " << s.m_nFindFailed.get()     << "\n"
+            << "\t\t     m_nFindRetry: " << s.m_nFindRetry.get()      << "\n"
+            << "\t\t m_nInsertSuccess: " << s.m_nInsertSuccess.get()  << "\n"
+            << "\t\t  m_nInsertFailed: " << s.m_nInsertFailed.get()   << "\n"
+            << "\t\t m_nUpdateSuccess: " << s.m_nUpdateSuccess.get()  << "\n"
+            << "\t\t  m_nUpdateFailed: " << s.m_nUpdateFailed.get()   << "\n"
+            << "\t\t   m_nUpdateRetry: " << s.m_nUpdateRetry.get()    << "\n"
+            << "\t\t m_nRemoveSuccess: " << s.m_nRemoveSuccess.get()  << "\n"
+            << "\t\t  m_nRemoveFailed: " << s.m_nRemoveFailed.get()   << "\n"
+            << "\t\t   m_nRemoveRetry: " << s.m_nRemoveRetry.get()    << "\n"
+            << "\t\tm_nExtractSuccess: " << s.m_nExtractSuccess.get() << "\n"
+            << "\t\t m_nExtractFailed: " << s.m_nExtractFailed.get()  << "\n"
+            << "\t\t     m_nLeafSplit: " << s.m_nLeafSplit.get()      << "\n"
+            << "\t\t    m_nInnerSplit: " << s.m_nInnerSplit.get()     << "\n"
+            << "\t\tm_nHeightIncrease: " << s.m_nHeightIncrease.get() << "\n"
+            << "\t\t     m_nLeafMerge: " << s.m_nLeafMerge.get()      << "\n"
+            << "\t\t    m_nInnerMerge: " << s.m_nInnerMerge.get()     << "\n"
+            << "\t\t   m_nMergeFailed: " << s.m_nMergeFailed.get()    << "\n"
+            << "\t\tm_nHeightDecrease: " << s.m_nHeightDecrease.get() << "\n"
+            << "\t\t  m_nDisposedNode: " << s.m_nDisposedNode.get()   << "\n"
+            << "\t\t m_nDisposedValue: " << s.m_nDisposedValue.get()  << "\n"
+            << "\t\tm_nExtractedValue: " << s.m_nExtractedValue.get() << "\n"
+            << "\t\t     m_nRangeScan: " << s.m_nRangeScan.get()      << "\n"
+            << "\t\t  m_nRangeRestart: " << s.m_nRangeRestart.get()   << "\n";
+    }
+} //namespace std
+
+#endif // #ifndef CDSUNIT_PRINT_BPLUS_TREE_STAT_H
@@ -73,6 +73,8 @@ namespace std {
             << "\t\t       m_nRightLeftRotation: " << s.m_nRightLeftRotation.get()   << "\n"
             << "\t\t      m_nInsertRebalanceReq: " << s.m_nInsertRebalanceReq.get()  << "\n"
             << "\t\t      m_nRemoveRebalanceReq: " << s.m_nRemoveRebalanceReq.get()  << "\n"
+            << "\t\t               m_nRangeScan: " << s.m_nRangeScan.get()           << "\n"
+            << "\t\t            m_nRangeRestart: " << s.m_nRangeRestart.get()        << "\n"
             << "\t\tm_nRotateAfterRightRotation: " << s.m_nRotateAfterRightRotation.get() << "\n"
             << "\t\tm_nRemoveAfterRightRotation: " << s.m_nRemoveAfterRightRotation.get() << "\n"
             << "\t\tm_nDamageAfterRightRotation: " << s.m_nDamageAfterRightRotation.get() << "\n"
@@ -86,6 +86,12 @@ namespace std {
             << "\t\t            m_nFalseResizeCount: " << s.m_nFalseResizeCount.get()               << "\n"
             << "\t\t       m_nResizeSuccessNodeMove: " << s.m_nResizeSuccessNodeMove.get()          << "\n"
             << "\t\t          m_nResizeRelocateCall: " << s.m_nResizeRelocateCall.get()             << "\n"
+            << "\t\t           m_nResizeLazyMigrate: " << s.m_nResizeLazyMigrate.get()              << "\n"
+            << "\t\t            m_nDisplacementCall: " << s.m_nDisplacementCall.get()               << "\n"
+            << "\t\t       m_nDisplacementPathFound: " << s.m_nDisplacementPathFound.get()          << "\n"
+            << "\t\t      m_nDisplacementPathFailed: " << s.m_nDisplacementPathFailed.get()         << "\n"
+            << "\t\t     m_nDisplacementPathAborted: " << s.m_nDisplacementPathAborted.get()        << "\n"
+            << "\t\t            m_nDisplacementMove: " << s.m_nDisplacementMove.get()               << "\n"
             << "\t\t               m_nInsertSuccess: " << s.m_nInsertSuccess.get()                  << "\n"
             << "\t\t                m_nInsertFailed: " << s.m_nInsertFailed.get()                   << "\n"
             << "\t\t           m_nInsertResizeCount: " << s.m_nInsertResizeCount.get()              << "\n"
@@ -104,6 +110,8 @@ namespace std {
             << "\t\t                  m_nFindFailed: " << s.m_nFindFailed.get()                     << "\n"
             << "\t\t             m_nFindWithSuccess: " << s.m_nFindWithSuccess.get()                << "\n"
             << "\t\t              m_nFindWithFailed: " << s.m_nFindWithFailed.get()                 << "\n"
+            << "\t\t         m_nFindOptimisticRetry: " << s.m_nFindOptimisticRetry.get()            << "\n"
+            << "\t\t        m_nFindOptimisticLocked: " << s.m_nFindOptimisticLocked.get()           << "\n"
 ;
     }
 
@@ -67,6 +67,8 @@ namespace std {
             << "\t\t       m_nExtractMaxFailed: " << s.m_nExtractMaxFailed.get()      << "\n"
             << "\t\t      m_nExtractMaxRetries: " << s.m_nExtractMaxRetries.get()     << "\n"
             << "\t\t            m_nSearchRetry: " << s.m_nSearchRetry.get()           << "\n"
+            << "\t\t              m_nRangeScan: " << s.m_nRangeScan.get()             << "\n"
+            << "\t\t            m_nRangeReseek: " << s.m_nRangeReseek.get()           << "\n"
             << "\t\t             m_nHelpInsert: " << s.m_nHelpInsert.get()            << "\n"
             << "\t\t             m_nHelpDelete: " << s.m_nHelpDelete.get()            << "\n"
             << "\t\t               m_nHelpMark: " << s.m_nHelpMark.get()              << "\n"
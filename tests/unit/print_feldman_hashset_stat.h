@@ -57,6 +57,11 @@ namespace std {
             << "\t\t       m_nExpandNodeFailed: " << s.m_nExpandNodeFailed.get()        << "\n"
             << "\t\t            m_nSlotChanged: " << s.m_nSlotChanged.get()             << "\n"
             << "\t\t         m_nSlotConverting: " << s.m_nSlotConverting.get()          << "\n"
+            << "\t\t              m_nSlotMoved: " << s.m_nSlotMoved.get()               << "\n"
+            << "\t\t           m_nHeadExpanded: " << s.m_nHeadExpanded.get()            << "\n"
+            << "\t\t            m_nHeadRetired: " << s.m_nHeadRetired.get()             << "\n"
+            << "\t\t         m_nCellBlockGrown: " << s.m_nCellBlockGrown.get()          << "\n"
+            << "\t\t    m_nCellBlockGrowFailed: " << s.m_nCellBlockGrowFailed.get()     << "\n"
             << "\t\t         m_nArrayNodeCount: " << s.m_nArrayNodeCount.get()          << "\n"
             << "\t\t                 m_nHeight: " << s.m_nHeight.get()                  << "\n";
     }
@@ -70,14 +75,15 @@ namespace std {
     {
         o << "Level statistics, height=" << level_stat.size() << "\n";
         size_t i = 0;
-        o << "  i   node_count capacity    data_cell   array_cell   empty_cell\n";
+        o << "  i   node_count capacity    data_cell   array_cell   empty_cell    allocated\n";
         for ( auto it = level_stat.begin(); it != level_stat.end(); ++it, ++i ) {
             o << std::setw( 3 ) << i << std::setw( 0 ) << " "
               << std::setw( 12 ) << it->array_node_count << std::setw( 0 ) << " "
               << std::setw( 8 ) << it->node_capacity << std::setw( 0 ) << " "
               << std::setw( 12 ) << it->data_cell_count << std::setw( 0 ) << " "
               << std::setw( 12 ) << it->array_cell_count << std::setw( 0 ) << " "
-              << std::setw( 12 ) << it->empty_cell_count << std::setw( 0 )
+              << std::setw( 12 ) << it->empty_cell_count << std::setw( 0 ) << " "
+              << std::setw( 12 ) << it->allocated_cell_count << std::setw( 0 )
               << "\n";
         }
         return o;
@@ -78,7 +78,11 @@ namespace std {
             << "\t\t            m_nFastExtract: " << s.m_nFastExtract.get()             << "\n"
             << "\t\t            m_nSlowExtract: " << s.m_nSlowExtract.get()             << "\n"
             << "\t\t         m_nEraseWhileFind: " << s.m_nEraseWhileFind.get()          << "\n"
-            << "\t\t       m_nExtractWhileFind: " << s.m_nExtractWhileFind.get()        << "\n";
+            << "\t\t       m_nExtractWhileFind: " << s.m_nExtractWhileFind.get()        << "\n"
+            << "\t\t              m_nRangeScan: " << s.m_nRangeScan.get()               << "\n"
+            << "\t\t            m_nRangeReseek: " << s.m_nRangeReseek.get()             << "\n"
+            << "\t\t        m_nSnapshotRetries: " << s.m_nSnapshotRetries.get()         << "\n"
+            << "\t\t      m_nSnapshotExclusive: " << s.m_nSnapshotExclusive.get()       << "\n";
     }
 
     static inline ostream& operator <<( ostream& o, cds::intrusive::skip_list::empty_stat const& /*s*/ )
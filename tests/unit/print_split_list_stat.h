@@ -54,7 +54,10 @@ namespace std {
             << "\t\t            m_nBucketCount: " << s.m_nBucketCount.get()             << "\n"
             << "\t\t    m_nInitBucketRecursive: " << s.m_nInitBucketRecursive.get()     << "\n"
             << "\t\t   m_nInitBucketContention: " << s.m_nInitBucketContention.get()    << "\n"
-            << "\t\t     m_nBusyWaitBucketInit: " << s.m_nBusyWaitBucketInit.get()      << "\n";
+            << "\t\t     m_nBusyWaitBucketInit: " << s.m_nBusyWaitBucketInit.get()      << "\n"
+            << "\t\t      m_nBucketTableShrink: " << s.m_nBucketTableShrink.get()       << "\n"
+            << "\t\t       m_nHeadNodeUnlinked: " << s.m_nHeadNodeUnlinked.get()        << "\n"
+            << "\t\t           m_nSegmentFreed: " << s.m_nSegmentFreed.get()            << "\n";
     }
 
     static inline ostream& operator <<( ostream& o, cds::intrusive::split_list::empty_stat const& /*s*/ )
@@ -0,0 +1,68 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#ifndef CDSUNIT_PRINT_UNROLLED_SKIP_LIST_STAT_H
+#define CDSUNIT_PRINT_UNROLLED_SKIP_LIST_STAT_H
+
+#include <ostream>
+#include <cds/container/details/unrolled_skip_list_base.h>
+
+namespace std {
+
+    static inline ostream& operator <<( ostream& o, cds::container::unrolled_skip_list::stat<> const& s )
+    {
+        return
+        o << "Stat [cds::container::unrolled_skip_list::stat]\n"
+            << "\t\t          m_nInsertSuccess: " << s.m_nInsertSuccess.get()           << "\n"
+            << "\t\t           m_nInsertFailed: " << s.m_nInsertFailed.get()            << "\n"
+            << "\t\t              m_nUpdateNew: " << s.m_nUpdateNew.get()               << "\n"
+            << "\t\t         m_nUpdateExisting: " << s.m_nUpdateExisting.get()          << "\n"
+            << "\t\t           m_nUpdateFailed: " << s.m_nUpdateFailed.get()            << "\n"
+            << "\t\t           m_nEraseSuccess: " << s.m_nEraseSuccess.get()            << "\n"
+            << "\t\t            m_nEraseFailed: " << s.m_nEraseFailed.get()             << "\n"
+            << "\t\t            m_nFindSuccess: " << s.m_nFindSuccess.get()             << "\n"
+            << "\t\t             m_nFindFailed: " << s.m_nFindFailed.get()              << "\n"
+            << "\t\t            m_nSearchRetry: " << s.m_nSearchRetry.get()             << "\n"
+            << "\t\t             m_nIndexRetry: " << s.m_nIndexRetry.get()              << "\n"
+            << "\t\t              m_nNodeSplit: " << s.m_nNodeSplit.get()               << "\n"
+            << "\t\t              m_nNodeMerge: " << s.m_nNodeMerge.get()               << "\n"
+            << "\t\t        m_nNodeMergeFailed: " << s.m_nNodeMergeFailed.get()         << "\n"
+            << "\t\t            m_nNodeCreated: " << s.m_nNodeCreated.get()             << "\n"
+            << "\t\t            m_nNodeRetired: " << s.m_nNodeRetired.get()             << "\n";
+    }
+
+    static inline ostream& operator <<( ostream& o, cds::container::unrolled_skip_list::empty_stat const& /*s*/ )
+    {
+        return o;
+    }
+
+} // namespace std
+
+#endif // #ifndef CDSUNIT_PRINT_UNROLLED_SKIP_LIST_STAT_H
@@ -71,7 +71,9 @@
     TEST_CASE(tag_MichaelHashSet, MichaelSet_HP_cmp_stdAlloc) \
     TEST_CASE(tag_MichaelHashSet, MichaelSet_HP_less_michaelAlloc) \
     TEST_CASE(tag_MichaelHashSet, MichaelSet_DHP_cmp_stdAlloc) \
+    TEST_CASE(tag_MichaelHashSet, MichaelSet_HE_cmp_stdAlloc) \
     TEST_CASE(tag_MichaelHashSet, MichaelSet_DHP_less_michaelAlloc) \
+    TEST_CASE(tag_MichaelHashSet, MichaelSet_HE_less_michaelAlloc) \
     TEST_CASE(tag_MichaelHashSet, MichaelSet_RCU_GPI_cmp_stdAlloc) \
     TEST_CASE(tag_MichaelHashSet, MichaelSet_RCU_GPI_less_michaelAlloc) \
     TEST_CASE(tag_MichaelHashSet, MichaelSet_RCU_GPB_cmp_stdAlloc) \
@@ -94,7 +96,9 @@
     CPPUNIT_TEST(MichaelSet_HP_cmp_stdAlloc) \
     CPPUNIT_TEST(MichaelSet_HP_less_michaelAlloc) \
     CPPUNIT_TEST(MichaelSet_DHP_cmp_stdAlloc) \
+    CPPUNIT_TEST(MichaelSet_HE_cmp_stdAlloc) \
     CPPUNIT_TEST(MichaelSet_DHP_less_michaelAlloc) \
+    CPPUNIT_TEST(MichaelSet_HE_less_michaelAlloc) \
     CPPUNIT_TEST(MichaelSet_RCU_GPI_cmp_stdAlloc) \
     CPPUNIT_TEST(MichaelSet_RCU_GPI_less_michaelAlloc) \
     CPPUNIT_TEST(MichaelSet_RCU_GPB_cmp_stdAlloc) \
@@ -174,6 +178,22 @@
 #   define CDSUNIT_TEST_SplitList_RCU_signal
 #endif
 
+#define CDSUNIT_DECLARE_SplitList_Shrink  \
+    TEST_CASE(tag_SplitListSet, SplitList_Michael_HP_dyn_cmp_shrink)\
+    TEST_CASE(tag_SplitListSet, SplitList_Michael_DHP_dyn_cmp_shrink)\
+    TEST_CASE(tag_SplitListSet, SplitList_Michael_HP_st_cmp_shrink)\
+    TEST_CASE(tag_SplitListSet, SplitList_Michael_DHP_st_cmp_shrink)\
+    TEST_CASE(tag_SplitListSet, SplitList_Lazy_HP_dyn_less_shrink)\
+    TEST_CASE(tag_SplitListSet, SplitList_Lazy_DHP_dyn_less_shrink)
+
+#define CDSUNIT_TEST_SplitList_Shrink  \
+    CPPUNIT_TEST(SplitList_Michael_HP_dyn_cmp_shrink)\
+    CPPUNIT_TEST(SplitList_Michael_DHP_dyn_cmp_shrink)\
+    CPPUNIT_TEST(SplitList_Michael_HP_st_cmp_shrink)\
+    CPPUNIT_TEST(SplitList_Michael_DHP_st_cmp_shrink)\
+    CPPUNIT_TEST(SplitList_Lazy_HP_dyn_less_shrink)\
+    CPPUNIT_TEST(SplitList_Lazy_DHP_dyn_less_shrink)
+
 #define CDSUNIT_DECLARE_SplitList  \
     TEST_CASE(tag_SplitListSet, SplitList_Michael_HP_dyn_cmp)\
     TEST_CASE(tag_SplitListSet, SplitList_Michael_HP_dyn_cmp_stat)\
@@ -327,7 +347,13 @@
     TEST_CASE(tag_CuckooSet, CuckooRefinableSet_list_unord_storehash)\
     TEST_CASE(tag_CuckooSet, CuckooRefinableSet_list_ord_storehash)\
     TEST_CASE(tag_CuckooSet, CuckooRefinableSet_vector_unord_storehash)\
-    TEST_CASE(tag_CuckooSet, CuckooRefinableSet_vector_ord_storehash)
+    TEST_CASE(tag_CuckooSet, CuckooRefinableSet_vector_ord_storehash)\
+    TEST_CASE(tag_CuckooSet, CuckooStripedSet_bucketized_unord)\
+    TEST_CASE(tag_CuckooSet, CuckooStripedSet_bucketized_unord_stat)\
+    TEST_CASE(tag_CuckooSet, CuckooRefinableSet_bucketized_unord)\
+    TEST_CASE(tag_CuckooSet, CuckooRefinableSet_bucketized_unord_stat)\
+    TEST_CASE(tag_CuckooSet, CuckooOptimisticSet_bucketized_unord)\
+    TEST_CASE(tag_CuckooSet, CuckooOptimisticSet_bucketized_unord_stat)
 
 #define CDSUNIT_TEST_CuckooSet \
     CPPUNIT_TEST(CuckooStripedSet_list_unord)\
@@ -353,7 +379,13 @@
     CPPUNIT_TEST(CuckooRefinableSet_vector_unord_storehash)\
     CPPUNIT_TEST(CuckooRefinableSet_vector_ord) \
     CPPUNIT_TEST(CuckooRefinableSet_vector_ord_stat) \
-    CPPUNIT_TEST(CuckooRefinableSet_vector_ord_storehash)
+    CPPUNIT_TEST(CuckooRefinableSet_vector_ord_storehash)\
+    CPPUNIT_TEST(CuckooStripedSet_bucketized_unord)\
+    CPPUNIT_TEST(CuckooStripedSet_bucketized_unord_stat)\
+    CPPUNIT_TEST(CuckooRefinableSet_bucketized_unord)\
+    CPPUNIT_TEST(CuckooRefinableSet_bucketized_unord_stat)\
+    CPPUNIT_TEST(CuckooOptimisticSet_bucketized_unord)\
+    CPPUNIT_TEST(CuckooOptimisticSet_bucketized_unord_stat)
 
 //********************************************************************
 // SkipListSet
@@ -430,6 +462,29 @@
     CPPUNIT_TEST(SkipListSet_rcu_gpt_cmp_xorshift_stat)\
     CDSUNIT_TEST_SkipListSet_RCU_signal
 
+//********************************************************************
+// UnrolledSkipListSet
+
+#define CDSUNIT_DECLARE_UnrolledSkipListSet \
+    TEST_CASE(tag_UnrolledSkipListSet, UnrolledSkipListSet_hp_less)\
+    TEST_CASE(tag_UnrolledSkipListSet, UnrolledSkipListSet_hp_less_16)\
+    TEST_CASE(tag_UnrolledSkipListSet, UnrolledSkipListSet_hp_less_64)\
+    TEST_CASE(tag_UnrolledSkipListSet, UnrolledSkipListSet_hp_cmp_stat)\
+    TEST_CASE(tag_UnrolledSkipListSet, UnrolledSkipListSet_dhp_less)\
+    TEST_CASE(tag_UnrolledSkipListSet, UnrolledSkipListSet_dhp_less_16)\
+    TEST_CASE(tag_UnrolledSkipListSet, UnrolledSkipListSet_dhp_less_64)\
+    TEST_CASE(tag_UnrolledSkipListSet, UnrolledSkipListSet_dhp_cmp_stat)
+
+#define CDSUNIT_TEST_UnrolledSkipListSet \
+    CPPUNIT_TEST(UnrolledSkipListSet_hp_less)\
+    CPPUNIT_TEST(UnrolledSkipListSet_hp_less_16)\
+    CPPUNIT_TEST(UnrolledSkipListSet_hp_less_64)\
+    CPPUNIT_TEST(UnrolledSkipListSet_hp_cmp_stat)\
+    CPPUNIT_TEST(UnrolledSkipListSet_dhp_less)\
+    CPPUNIT_TEST(UnrolledSkipListSet_dhp_less_16)\
+    CPPUNIT_TEST(UnrolledSkipListSet_dhp_less_64)\
+    CPPUNIT_TEST(UnrolledSkipListSet_dhp_cmp_stat)
+
 //********************************************************************
 // EllenBinTreeSet
 
@@ -572,7 +627,9 @@
     TEST_CASE( tag_StripedSet, RefinableSet_rational_vector) \
     TEST_CASE( tag_StripedSet, RefinableSet_rational_set) \
     TEST_CASE( tag_StripedSet, RefinableSet_rational_hashset) \
-    TEST_CASE( tag_StripedSet, RefinableSet_rational_boost_unordered_set)
+    TEST_CASE( tag_StripedSet, RefinableSet_rational_boost_unordered_set) \
+    TEST_CASE( tag_StripedSet, RefinableSet_list_incremental) \
+    TEST_CASE( tag_StripedSet, RefinableSet_hashset_incremental)
 
 
 //********************************************************************
@@ -588,7 +645,9 @@
     CPPUNIT_TEST(RefinableSet_rational_vector) \
     CPPUNIT_TEST(RefinableSet_rational_set) \
     CPPUNIT_TEST(RefinableSet_rational_hashset) \
-    CPPUNIT_TEST(RefinableSet_rational_boost_unordered_set)
+    CPPUNIT_TEST(RefinableSet_rational_boost_unordered_set) \
+    CPPUNIT_TEST(RefinableSet_list_incremental) \
+    CPPUNIT_TEST(RefinableSet_hashset_incremental)
 
 #if BOOST_VERSION >= 104800
 #   define CDSUNIT_DECLARE_RefinableSet_boost_container \
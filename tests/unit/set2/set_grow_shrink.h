@@ -0,0 +1,204 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#include "set2/set_type.h"
+#include "cppunit/thread.h"
+
+namespace set2 {
+
+#define TEST_CASE(TAG, X)  void X();
+
+    class Set_GrowShrink: public CppUnitMini::TestCase
+    {
+    public:
+        size_t c_nSetSize = 100000;      // max set size
+        size_t c_nThreadCount = 4;       // thread count
+        size_t c_nPassCount = 10;        // grow-shrink pass count
+        size_t c_nResidentCount = 1000;  // count of items that are never deleted
+        size_t c_nMaxLoadFactor = 4;     // maximum load factor
+        bool   c_bPrintGCState = true;
+
+        size_t c_nLoadFactor = 1;
+
+    protected:
+        typedef size_t  key_type;
+        typedef size_t  value_type;
+
+        template <class Set>
+        class WorkThread: public CppUnitMini::TestThread
+        {
+            Set&     m_Set;
+
+            virtual WorkThread *    clone()
+            {
+                return new WorkThread( *this );
+            }
+        public:
+            size_t  m_nInsertFailed;
+            size_t  m_nFindFailed;
+            size_t  m_nDeleteFailed;
+            size_t  m_nResidentLost;
+
+        public:
+            WorkThread( CppUnitMini::ThreadPool& pool, Set& rSet )
+                : CppUnitMini::TestThread( pool )
+                , m_Set( rSet )
+            {}
+            WorkThread( WorkThread& src )
+                : CppUnitMini::TestThread( src )
+                , m_Set( src.m_Set )
+            {}
+
+            Set_GrowShrink&  getTest()
+            {
+                return reinterpret_cast<Set_GrowShrink&>( m_Pool.m_Test );
+            }
+
+            virtual void init() { cds::threading::Manager::attachThread()   ; }
+            virtual void fini() { cds::threading::Manager::detachThread()   ; }
+
+            virtual void test()
+            {
+                Set& rSet = m_Set;
+                Set_GrowShrink& t = getTest();
+
+                m_nInsertFailed =
+                    m_nFindFailed =
+                    m_nDeleteFailed =
+                    m_nResidentLost = 0;
+
+                // Resident keys are [0, c_nResidentCount), each thread owns keys k: k % nThreadCount == m_nThreadNo
+                size_t const nThreadCount = t.c_nThreadCount;
+                size_t const nFirst = t.c_nResidentCount + m_nThreadNo;
+                size_t const nLast = t.c_nResidentCount + t.c_nSetSize;
+
+                for ( size_t nPass = 0; nPass < t.c_nPassCount; ++nPass ) {
+                    // grow
+                    for ( size_t key = nFirst; key < nLast; key += nThreadCount ) {
+                        if ( !rSet.insert( key ))
+                            ++m_nInsertFailed;
+                    }
+                    for ( size_t key = nFirst; key < nLast; key += nThreadCount ) {
+                        if ( !rSet.contains( key ))
+                            ++m_nFindFailed;
+                    }
+
+                    // shrink
+                    for ( size_t key = nFirst; key < nLast; key += nThreadCount ) {
+                        if ( !rSet.erase( key ))
+                            ++m_nDeleteFailed;
+                    }
+
+                    for ( size_t key = m_nThreadNo; key < t.c_nResidentCount; key += nThreadCount ) {
+                        if ( !rSet.contains( key ))
+                            ++m_nResidentLost;
+                    }
+                }
+            }
+        };
+
+    protected:
+        template <class Set>
+        void do_test( Set& testSet )
+        {
+            typedef WorkThread<Set> work_thread;
+
+            for ( size_t key = 0; key < c_nResidentCount; ++key )
+                CPPUNIT_ASSERT( testSet.insert( key ));
+
+            CppUnitMini::ThreadPool pool( *this );
+            pool.add( new work_thread( pool, testSet ), c_nThreadCount );
+            pool.run();
+            CPPUNIT_MSG( "   Duration=" << pool.avgDuration() );
+
+            size_t nInsertFailed = 0;
+            size_t nFindFailed = 0;
+            size_t nDeleteFailed = 0;
+            size_t nResidentLost = 0;
+            for ( CppUnitMini::ThreadPool::iterator it = pool.begin(); it != pool.end(); ++it ) {
+                work_thread * pThread = static_cast<work_thread *>( *it );
+                assert( pThread != nullptr );
+                nInsertFailed += pThread->m_nInsertFailed;
+                nFindFailed += pThread->m_nFindFailed;
+                nDeleteFailed += pThread->m_nDeleteFailed;
+                nResidentLost += pThread->m_nResidentLost;
+            }
+
+            CPPUNIT_CHECK_EX( nInsertFailed == 0, "insert failed=" << nInsertFailed );
+            CPPUNIT_CHECK_EX( nFindFailed == 0, "find failed=" << nFindFailed );
+            CPPUNIT_CHECK_EX( nDeleteFailed == 0, "delete failed=" << nDeleteFailed );
+            CPPUNIT_CHECK_EX( nResidentLost == 0, "resident lost=" << nResidentLost );
+            CPPUNIT_CHECK_EX( testSet.size() == c_nResidentCount, "size=" << testSet.size() << ", expected=" << c_nResidentCount );
+
+            for ( size_t key = 0; key < c_nResidentCount; ++key )
+                CPPUNIT_CHECK_EX( testSet.contains( key ), "key " << key << " not found" );
+
+            // The set has shrunk from c_nSetSize down to c_nResidentCount items c_nPassCount times,
+            // so the bucket table must have been shrunk and some head nodes must have been unlinked
+            CPPUNIT_CHECK_EX( testSet.statistics().m_nBucketTableShrink.get() != 0, "bucket table has never been shrunk" );
+            CPPUNIT_CHECK_EX( testSet.statistics().m_nHeadNodeUnlinked.get() != 0, "no head node has been unlinked" );
+
+            testSet.clear();
+            CPPUNIT_CHECK_EX( testSet.empty(), ((long long) testSet.size()) );
+
+            additional_check( testSet );
+            print_stat( testSet );
+            additional_cleanup( testSet );
+        }
+
+        template <class Set>
+        void run_test()
+        {
+            CPPUNIT_MSG( "Thread count=" << c_nThreadCount
+                << " max set size=" << c_nSetSize
+                << " resident count=" << c_nResidentCount
+                << " pass count=" << c_nPassCount
+                );
+
+            for ( c_nLoadFactor = 1; c_nLoadFactor <= c_nMaxLoadFactor; c_nLoadFactor *= 2 ) {
+                CPPUNIT_MSG("  LoadFactor = " << c_nLoadFactor );
+                Set s( *this );
+                do_test( s );
+                if ( c_bPrintGCState )
+                    print_gc_state();
+            }
+        }
+
+        void setUpParams( const CppUnitMini::TestCfg& cfg );
+
+#   include "set2/set_defs.h"
+        CDSUNIT_DECLARE_SplitList_Shrink
+
+        CPPUNIT_TEST_SUITE_(Set_GrowShrink, "Map_GrowShrink")
+            CDSUNIT_TEST_SplitList_Shrink
+        CPPUNIT_TEST_SUITE_END();
+
+    };
+} // namespace set2
@@ -572,6 +572,7 @@ namespace set2 {
 #   include "set2/set_defs.h"
     CDSUNIT_DECLARE_MichaelSet
     CDSUNIT_DECLARE_SkipListSet
+    CDSUNIT_DECLARE_UnrolledSkipListSet
     CDSUNIT_DECLARE_SplitList
     CDSUNIT_DECLARE_StripedSet
     CDSUNIT_DECLARE_RefinableSet
@@ -584,6 +585,7 @@ namespace set2 {
         CDSUNIT_TEST_MichaelSet
         CDSUNIT_TEST_SplitList
         CDSUNIT_TEST_SkipListSet
+        CDSUNIT_TEST_UnrolledSkipListSet
         CDSUNIT_TEST_FeldmanHashSet_fixed
         CDSUNIT_TEST_FeldmanHashSet_city
         CDSUNIT_TEST_EllenBinTreeSet
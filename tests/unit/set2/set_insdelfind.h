@@ -253,6 +253,7 @@ namespace set2 {
         CDSUNIT_DECLARE_RefinableSet
         CDSUNIT_DECLARE_CuckooSet
         CDSUNIT_DECLARE_SkipListSet
+        CDSUNIT_DECLARE_UnrolledSkipListSet
         CDSUNIT_DECLARE_EllenBinTreeSet
         CDSUNIT_DECLARE_FeldmanHashSet
         CDSUNIT_DECLARE_StdSet
@@ -261,6 +262,7 @@ namespace set2 {
             CDSUNIT_TEST_MichaelSet
             CDSUNIT_TEST_SplitList
             CDSUNIT_TEST_SkipListSet
+            CDSUNIT_TEST_UnrolledSkipListSet
             CDSUNIT_TEST_FeldmanHashSet
             CDSUNIT_TEST_EllenBinTreeSet
             CDSUNIT_TEST_StripedSet
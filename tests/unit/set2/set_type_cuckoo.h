@@ -93,6 +93,11 @@ namespace set2 {
         {
             typedef cc::cuckoo::refinable<> mutex_policy;
         };
+        template <typename Traits>
+        struct traits_CuckooOptimisticSet : public Traits
+        {
+            typedef cc::cuckoo::optimistic_striping< rcu_gpb > mutex_policy;
+        };
 
         struct traits_CuckooSet_list_unord :
             public cc::cuckoo::make_traits <
@@ -191,6 +196,26 @@ namespace set2 {
         typedef CuckooSet< key_val, traits_CuckooStripedSet<traits_CuckooSet_vector_ord_storehash>> CuckooStripedSet_vector_ord_storehash;
         typedef CuckooSet< key_val, traits_CuckooRefinableSet<traits_CuckooSet_vector_ord_storehash>> CuckooRefinableSet_vector_ord_storehash;
 
+        struct traits_CuckooSet_bucketized_unord :
+            public cc::cuckoo::make_traits <
+                cc::cuckoo::probeset_type< cc::cuckoo::bucketized<4> >
+                , co::equal_to< equal_to >
+                , co::hash< std::tuple< hash, hash2 > >
+            >::type
+        {};
+        typedef CuckooSet< key_val, traits_CuckooStripedSet<traits_CuckooSet_bucketized_unord>> CuckooStripedSet_bucketized_unord;
+        typedef CuckooSet< key_val, traits_CuckooRefinableSet<traits_CuckooSet_bucketized_unord>> CuckooRefinableSet_bucketized_unord;
+
+        struct traits_CuckooSet_bucketized_unord_stat : public traits_CuckooSet_bucketized_unord
+        {
+            typedef cc::cuckoo::stat stat;
+        };
+        typedef CuckooSet< key_val, traits_CuckooStripedSet<traits_CuckooSet_bucketized_unord_stat>> CuckooStripedSet_bucketized_unord_stat;
+        typedef CuckooSet< key_val, traits_CuckooRefinableSet<traits_CuckooSet_bucketized_unord_stat>> CuckooRefinableSet_bucketized_unord_stat;
+
+        typedef CuckooSet< key_val, traits_CuckooOptimisticSet<traits_CuckooSet_bucketized_unord>> CuckooOptimisticSet_bucketized_unord;
+        typedef CuckooSet< key_val, traits_CuckooOptimisticSet<traits_CuckooSet_bucketized_unord_stat>> CuckooOptimisticSet_bucketized_unord_stat;
+
     };
 
     template <typename T, typename Traits >
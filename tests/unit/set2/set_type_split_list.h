@@ -513,6 +513,48 @@ namespace set2 {
         typedef SplitListSet< rcu_shb, key_val, traits_SplitList_Lazy_st_less_stat > SplitList_Lazy_RCU_SHB_st_less_stat;
         typedef SplitListSet< rcu_sht, key_val, traits_SplitList_Lazy_st_less_stat > SplitList_Lazy_RCU_SHT_st_less_stat;
 #endif
+
+        // ***************************************************************************
+        // SplitListSet with shrinkable bucket table (HP/DHP only)
+
+        struct traits_SplitList_Michael_dyn_cmp_shrink :
+            public cc::split_list::make_traits<
+                cc::split_list::ordered_list<cc::michael_list_tag>
+                ,co::hash< hash >
+                ,cc::split_list::shrinkable_bucket_table< true >
+                ,co::stat< cc::split_list::stat<> >
+                ,cc::split_list::ordered_list_traits<
+                    typename cc::michael_list::make_traits<
+                        co::compare< compare >
+                    >::type
+                >
+            >::type
+        {};
+        typedef SplitListSet< cds::gc::HP,  key_val, traits_SplitList_Michael_dyn_cmp_shrink > SplitList_Michael_HP_dyn_cmp_shrink;
+        typedef SplitListSet< cds::gc::DHP, key_val, traits_SplitList_Michael_dyn_cmp_shrink > SplitList_Michael_DHP_dyn_cmp_shrink;
+
+        struct traits_SplitList_Michael_st_cmp_shrink : public traits_SplitList_Michael_dyn_cmp_shrink
+        {
+            enum { dynamic_bucket_table = false };
+        };
+        typedef SplitListSet< cds::gc::HP,  key_val, traits_SplitList_Michael_st_cmp_shrink > SplitList_Michael_HP_st_cmp_shrink;
+        typedef SplitListSet< cds::gc::DHP, key_val, traits_SplitList_Michael_st_cmp_shrink > SplitList_Michael_DHP_st_cmp_shrink;
+
+        struct traits_SplitList_Lazy_dyn_less_shrink :
+            public cc::split_list::make_traits<
+                cc::split_list::ordered_list<cc::lazy_list_tag>
+                ,co::hash< hash >
+                ,cc::split_list::shrinkable_bucket_table< true >
+                ,co::stat< cc::split_list::stat<> >
+                ,cc::split_list::ordered_list_traits<
+                    typename cc::lazy_list::make_traits<
+                        co::less< less >
+                    >::type
+                >
+            >::type
+        {};
+        typedef SplitListSet< cds::gc::HP,  key_val, traits_SplitList_Lazy_dyn_less_shrink > SplitList_Lazy_HP_dyn_less_shrink;
+        typedef SplitListSet< cds::gc::DHP, key_val, traits_SplitList_Lazy_dyn_less_shrink > SplitList_Lazy_DHP_dyn_less_shrink;
     };
 
     template <typename GC, typename T, typename Traits>
@@ -581,6 +581,20 @@ namespace set2 {
             , co::hash< hash2 >
         > RefinableSet_rational_hashset;
 
+        // Incremental resizing: the mutex policy overrides the default refinable<> of RefinableHashSet_xxx
+        typedef RefinableHashSet_seq<
+            std::list< key_val >
+            , co::hash< hash2 >
+            , co::less< less >
+            , co::mutex_policy< cc::striped_set::incremental_refinable<> >
+        > RefinableSet_list_incremental;
+
+        typedef RefinableHashSet_ord<
+            std::unordered_set< key_val, hash, equal_to >
+            , co::hash< hash2 >
+            , co::mutex_policy< cc::striped_set::incremental_refinable<> >
+        > RefinableSet_hashset_incremental;
+
 #if BOOST_VERSION >= 104800
         typedef RefinableHashSet_ord<
             boost::container::set< key_val, less >
@@ -0,0 +1,113 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+
+    (C) Copyright Maxim Khizhinsky (libcds.dev@gmail.com) 2006-2016
+
+    Source code repo: http://github.com/khizmax/libcds/
+    Download: http://sourceforge.net/projects/libcds/files/
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.     
+*/
+
+#ifndef CDSUNIT_SET_TYPE_UNROLLED_SKIP_LIST_H
+#define CDSUNIT_SET_TYPE_UNROLLED_SKIP_LIST_H
+
+#include "set2/set_type.h"
+
+#include <cds/gc/hp.h>
+#include <cds/gc/dhp.h>
+#include <cds/container/unrolled_skip_list_set.h>
+
+#include "print_unrolled_skip_list_stat.h"
+
+namespace set2 {
+
+    template <typename GC, typename T, typename Traits = cc::unrolled_skip_list::traits >
+    class UnrolledSkipListSet : public cc::UnrolledSkipListSet<GC, T, Traits>
+    {
+        typedef cc::UnrolledSkipListSet<GC, T, Traits> base_class;
+    public:
+        template <typename Config>
+        UnrolledSkipListSet( Config const& /*cfg*/ )
+        {}
+
+        // for testing
+        static CDS_CONSTEXPR bool const c_bExtractSupported = false;
+        static CDS_CONSTEXPR bool const c_bLoadFactorDepended = false;
+        static CDS_CONSTEXPR bool const c_bEraseExactKey = false;
+    };
+
+    struct tag_UnrolledSkipListSet;
+
+    template <typename Key, typename Val>
+    struct set_type< tag_UnrolledSkipListSet, Key, Val >: public set_type_base< Key, Val >
+    {
+        typedef set_type_base< Key, Val > base_class;
+        typedef typename base_class::key_val key_val;
+        typedef typename base_class::compare compare;
+        typedef typename base_class::less less;
+
+        class traits_UnrolledSkipListSet_less: public cc::unrolled_skip_list::make_traits <
+                co::less< less >
+                ,co::item_counter< cds::atomicity::item_counter >
+            >::type
+        {};
+        typedef UnrolledSkipListSet< cds::gc::HP, key_val, traits_UnrolledSkipListSet_less >  UnrolledSkipListSet_hp_less;
+        typedef UnrolledSkipListSet< cds::gc::DHP, key_val, traits_UnrolledSkipListSet_less > UnrolledSkipListSet_dhp_less;
+
+        class traits_UnrolledSkipListSet_less_16: public cc::unrolled_skip_list::make_traits <
+                co::less< less >
+                ,co::item_counter< cds::atomicity::item_counter >
+                ,cc::unrolled_skip_list::node_capacity< 16 >
+            >::type
+        {};
+        typedef UnrolledSkipListSet< cds::gc::HP, key_val, traits_UnrolledSkipListSet_less_16 >  UnrolledSkipListSet_hp_less_16;
+        typedef UnrolledSkipListSet< cds::gc::DHP, key_val, traits_UnrolledSkipListSet_less_16 > UnrolledSkipListSet_dhp_less_16;
+
+        class traits_UnrolledSkipListSet_less_64: public cc::unrolled_skip_list::make_traits <
+                co::less< less >
+                ,co::item_counter< cds::atomicity::item_counter >
+                ,cc::unrolled_skip_list::node_capacity< 64 >
+            >::type
+        {};
+        typedef UnrolledSkipListSet< cds::gc::HP, key_val, traits_UnrolledSkipListSet_less_64 >  UnrolledSkipListSet_hp_less_64;
+        typedef UnrolledSkipListSet< cds::gc::DHP, key_val, traits_UnrolledSkipListSet_less_64 > UnrolledSkipListSet_dhp_less_64;
+
+        class traits_UnrolledSkipListSet_cmp_stat: public cc::unrolled_skip_list::make_traits <
+                co::compare< compare >
+                ,co::item_counter< cds::atomicity::item_counter >
+                ,co::stat< cc::unrolled_skip_list::stat<> >
+            >::type
+        {};
+        typedef UnrolledSkipListSet< cds::gc::HP, key_val, traits_UnrolledSkipListSet_cmp_stat >  UnrolledSkipListSet_hp_cmp_stat;
+        typedef UnrolledSkipListSet< cds::gc::DHP, key_val, traits_UnrolledSkipListSet_cmp_stat > UnrolledSkipListSet_dhp_cmp_stat;
+    };
+
+    template <typename GC, typename T, typename Traits>
+    static inline void print_stat( UnrolledSkipListSet<GC, T, Traits> const& s )
+    {
+        CPPUNIT_MSG( s.statistics() );
+    }
+
+} // namespace set2
+
+#endif // #ifndef CDSUNIT_SET_TYPE_UNROLLED_SKIP_LIST_H